@@ -0,0 +1,118 @@
+// Compressed image descriptors and their streaming decoder, shared by the
+// firmware (through assets_generated.h) and the native tests.
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+constexpr uint8_t kAssetFormatRle = 0;
+constexpr uint8_t kAssetFormatQoi = 1;
+
+struct CompressedImage {
+  uint16_t width;
+  uint16_t height;
+  uint8_t format;  // kAssetFormat*
+  uint32_t size;  // Compressed bytes
+  const uint8_t* data;
+};
+
+// Streaming decoder for the images in assets_generated.h, RLE or QOI-565
+// (see tools/build_assets.py for both formats). Runs can span rows, so the
+// state carries across calls and callers decode a stripe at a time. Output is
+// in panel byte order, ready for sprite buffers or swap565 pushes.
+class AssetDecoder {
+ public:
+  explicit AssetDecoder(const CompressedImage& image)
+      : _src(image.data), _end(image.data + image.size), _qoi(image.format == kAssetFormatQoi) {}
+
+  bool read(uint16_t* out, int count) {
+    return _qoi ? readQoi(out, count) : readRle(out, count);
+  }
+
+ private:
+  bool readRle(uint16_t* out, int count) {
+    while (count > 0) {
+      if (_left == 0) {
+        if (_src >= _end) return false;
+        uint8_t control = *_src++;
+        _run = control & 0x80;
+        _left = (control & 0x7F) + 1;
+        if (_run) {
+          if (_end - _src < 2) return false;
+          memcpy(&_pixel, _src, 2);
+          _src += 2;
+        } else if (_end - _src < _left * 2) {
+          return false;
+        }
+      }
+      int n = count < _left ? count : _left;
+      if (_run) {
+        for (int i = 0; i < n; ++i) out[i] = _pixel;
+      } else {
+        memcpy(out, _src, n * 2);
+        _src += n * 2;
+      }
+      out += n;
+      count -= n;
+      _left -= n;
+    }
+    return true;
+  }
+
+  // Colour arithmetic is on native RGB565 (_prev); _pixel keeps it swapped
+  bool readQoi(uint16_t* out, int count) {
+    while (count > 0) {
+      if (_left > 0) {
+        int n = count < _left ? count : _left;
+        for (int i = 0; i < n; ++i) out[i] = _pixel;
+        out += n;
+        count -= n;
+        _left -= n;
+        continue;
+      }
+      if (_src >= _end) return false;
+      uint8_t op = *_src++;
+      uint16_t p;
+      if (op < 0x40) {  // Index into recently seen colours
+        p = _table[op];
+      } else if (op < 0x80) {  // Small difference per channel, -2..1
+        int r = ((_prev >> 11) + ((op >> 4) & 3) - 2) & 31;
+        int g = ((_prev >> 5) + ((op >> 2) & 3) - 2) & 63;
+        int b = (_prev + (op & 3) - 2) & 31;
+        p = r << 11 | g << 5 | b;
+      } else if (op < 0xC0) {  // Green difference, red and blue relative to it
+        if (_src >= _end) return false;
+        int dg = (op & 0x3F) - 32;
+        uint8_t rb = *_src++;
+        int r = ((_prev >> 11) + dg + (rb >> 4) - 8) & 31;
+        int g = ((_prev >> 5) + dg) & 63;
+        int b = (_prev + dg + (rb & 15) - 8) & 31;
+        p = r << 11 | g << 5 | b;
+      } else if (op == 0xFE) {  // Literal, big-endian
+        if (_end - _src < 2) return false;
+        p = _src[0] << 8 | _src[1];
+        _src += 2;
+      } else if (op == 0xFF) {
+        return false;
+      } else {  // Run of the previous pixel, 1..62
+        _left = (op & 0x3F) + 1;
+        continue;
+      }
+      _table[((p >> 11) * 3 + ((p >> 5) & 63) * 5 + (p & 31) * 7) % 64] = p;
+      _prev = p;
+      _pixel = __builtin_bswap16(p);
+      *out++ = _pixel;
+      count--;
+    }
+    return true;
+  }
+
+  const uint8_t* _src;
+  const uint8_t* _end;
+  bool _qoi;
+  uint16_t _pixel = 0;  // Panel byte order
+  uint16_t _prev = 0;
+  uint16_t _table[64] = {};
+  int _left = 0;
+  bool _run = false;
+};
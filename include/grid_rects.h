@@ -0,0 +1,73 @@
+// Module-grid fills merged into rectangles, shared by the firmware and the
+// native tests. Gfx is anything with fillRect(x, y, w, h, color).
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// Fills the set cells of a module grid with as few rectangles as it can:
+// each uncovered set cell starts a run extended right over set cells, then
+// down while the whole run stays set. Runs may overlap cells already filled,
+// which merges lattices such as borders into full-length lines. Cell edges
+// are pixel positions (cols + 1 and rows + 1 of them), so cells can differ in
+// size.
+constexpr int kMaxGridCells = 177 * 177;  // A version 40 QR code
+
+struct GridStats {
+  int modules;  // Set cells, i.e. fills one per cell would have taken
+  int rects;    // fillRect calls made
+};
+
+// One bit per cell, shared by every Gfx type; grids are filled one at a time
+inline uint32_t* gridCoveredBits() {
+  static uint32_t covered[(kMaxGridCells + 31) / 32];
+  return covered;
+}
+
+template <typename Gfx>
+GridStats fillGridRects(Gfx& gfx, int cols, int rows, bool (*isSet)(const void* ctx, int col, int row),
+                        const void* ctx, const int* colEdges, const int* rowEdges, uint32_t color) {
+  uint32_t* covered = gridCoveredBits();
+  GridStats stats = {0, 0};
+  if (cols * rows > kMaxGridCells) return stats;
+  memset(covered, 0, (cols * rows + 31) / 32 * 4);
+  auto isCovered = [cols, covered](int col, int row) {
+    int bit = row * cols + col;
+    return (covered[bit >> 5] >> (bit & 31)) & 1;
+  };
+  for (int row = 0; row < rows; ++row) {
+    for (int col = 0; col < cols; ++col) {
+      if (!isSet(ctx, col, row)) continue;
+      stats.modules++;
+      if (isCovered(col, row)) continue;
+      int endCol = col;
+      while (endCol + 1 < cols && isSet(ctx, endCol + 1, row)) ++endCol;
+      int endRow = row;
+      for (bool full = true; full && endRow + 1 < rows;) {
+        for (int c = col; full && c <= endCol; ++c) full = isSet(ctx, c, endRow + 1);
+        if (full) ++endRow;
+      }
+      for (int r = row; r <= endRow; ++r) {
+        for (int c = col; c <= endCol; ++c) {
+          int bit = r * cols + c;
+          covered[bit >> 5] |= 1u << (bit & 31);
+        }
+      }
+      gfx.fillRect(colEdges[col], rowEdges[row], colEdges[endCol + 1] - colEdges[col],
+                   rowEdges[endRow + 1] - rowEdges[row], color);
+      stats.rects++;
+    }
+  }
+  return stats;
+}
+
+// Edges of count equal cells of size pixels from start
+inline void uniformGridEdges(int* edges, int count, int start, int size) {
+  for (int i = 0; i <= count; ++i) edges[i] = start + i * size;
+}
+
+// Calendar day borders as a grid: columns are left line, interior, right
+// line; each day is top line, interior, bottom line
+inline bool isCalendarBorderCell(const void*, int col, int row) {
+  return col != 1 || row % 3 != 1;
+}
@@ -0,0 +1,232 @@
+// Photo geometry and the fixed-point RGB565 resampler, shared by the firmware
+// and the native tests. Pixel buffers are in sprite byte order.
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "rgb565.h"
+
+// The ESP32-P4 PIE vector path for the bilinear vertical pass. Opt in with
+// -DRESAMPLE_USE_PIE; the portable loop is what the native tests cover.
+#if defined(CONFIG_IDF_TARGET_ESP32P4) && defined(RESAMPLE_USE_PIE)
+#define RESAMPLE_PIE 1
+#else
+#define RESAMPLE_PIE 0
+#endif
+
+// How photos are scaled onto the panel
+enum class PhotoFitMode {
+  Fit,     // Whole photo visible, letterboxed
+  Fill,    // Covers the panel, overflow centre-cropped
+  Centre   // 1:1 pixels, centred and cropped to the panel
+};
+
+// Upright source window for the resampler, in decoded-image pixels
+struct ResampleCrop {
+  int x;
+  int y;
+  int w;
+  int h;
+};
+
+// An upright photo scaled for the panel, and the part of it that lands on it
+struct PhotoFit {
+  float scale;
+  int scaledW;
+  int scaledH;
+  int outW;
+  int outH;
+};
+
+inline PhotoFit fitPhoto(int uprightW, int uprightH, int panelW, int panelH, PhotoFitMode mode) {
+  float scaleX = (float)panelW / uprightW;
+  float scaleY = (float)panelH / uprightH;
+  PhotoFit fit;
+  fit.scale = 1.0f;
+  if (mode == PhotoFitMode::Fit) fit.scale = scaleX < scaleY ? scaleX : scaleY;
+  if (mode == PhotoFitMode::Fill) fit.scale = scaleX > scaleY ? scaleX : scaleY;
+  fit.scaledW = (int)(uprightW * fit.scale + 0.5f);
+  fit.scaledH = (int)(uprightH * fit.scale + 0.5f);
+  if (fit.scaledW < 1) fit.scaledW = 1;
+  if (fit.scaledH < 1) fit.scaledH = 1;
+  fit.outW = fit.scaledW < panelW ? fit.scaledW : panelW;
+  fit.outH = fit.scaledH < panelH ? fit.scaledH : panelH;
+  return fit;
+}
+
+// Centred window of an upright decoded image (the photo at any decode scale)
+// that covers the output
+inline ResampleCrop fitCrop(const PhotoFit& fit, int decUprightW, int decUprightH) {
+  ResampleCrop crop;
+  crop.w = (int)((int64_t)decUprightW * fit.outW / fit.scaledW);
+  crop.h = (int)((int64_t)decUprightH * fit.outH / fit.scaledH);
+  crop.w = crop.w < 1 ? 1 : crop.w > decUprightW ? decUprightW : crop.w;
+  crop.h = crop.h < 1 ? 1 : crop.h > decUprightH ? decUprightH : crop.h;
+  crop.x = (decUprightW - crop.w) / 2;
+  crop.y = (decUprightH - crop.h) / 2;
+  return crop;
+}
+
+// Vertical pass of the bilinear path on one colour plane:
+// out = top + ((bottom - top) * weight >> 5), which is exactly
+// (top * (32 - weight) + bottom * weight) >> 5. Rows are 16-byte aligned and
+// n is a multiple of 8.
+inline void lerpRowsS16(const int16_t* top, const int16_t* bottom, int16_t* out, int n, int weight) {
+#if RESAMPLE_PIE
+  // Eight lanes per step; vmul.s16 shifts its products right by SAR
+  int16_t lane = weight;
+  const int16_t* lanePtr = &lane;
+  asm volatile("esp.movx.w.sar %0" : : "r"(5));
+  asm volatile("esp.vldbc.16.ip q2, %0, 0" : "+r"(lanePtr) : : "memory");
+  for (int i = 0; i < n; i += 8) {
+    asm volatile(
+        "esp.vld.128.ip q0, %0, 16\n"
+        "esp.vld.128.ip q1, %1, 16\n"
+        "esp.vsub.s16 q1, q1, q0\n"
+        "esp.vmul.s16 q1, q1, q2\n"
+        "esp.vadd.s16 q0, q0, q1\n"
+        "esp.vst.128.ip q0, %2, 16\n"
+        : "+r"(top), "+r"(bottom), "+r"(out)
+        :
+        : "memory");
+  }
+#else
+  for (int i = 0; i < n; ++i) {
+    out[i] = top[i] + (((bottom[i] - top[i]) * weight) >> 5);
+  }
+#endif
+}
+
+// Fixed-point RGB565 resampler between sprite buffers (sprite byte order).
+// Shrinking uses a box filter averaging every covered source pixel; enlarging
+// uses bilinear interpolation with 5-bit weights. The EXIF orientation (1-8)
+// is applied in the same pass by walking the source along rotated/mirrored
+// strides, so dst comes out upright. Returns false if the bilinear row
+// buffers can't be allocated.
+inline bool resampleRgb565(const uint16_t* src, int srcW, int srcH, uint8_t orientation,
+                           const ResampleCrop& crop, uint16_t* dst, int dstW, int dstH) {
+  // Source index = base + ox * stepX + oy * stepY for upright coordinates (ox, oy)
+  int32_t base = 0, stepX = 1, stepY = srcW;
+  switch (orientation) {
+    case 2: base = srcW - 1;                        stepX = -1;    stepY = srcW;  break;
+    case 3: base = (srcH - 1) * srcW + srcW - 1;    stepX = -1;    stepY = -srcW; break;
+    case 4: base = (srcH - 1) * srcW;               stepX = 1;     stepY = -srcW; break;
+    case 5: base = 0;                               stepX = srcW;  stepY = 1;     break;
+    case 6: base = (srcH - 1) * srcW;               stepX = -srcW; stepY = 1;     break;
+    case 7: base = (srcH - 1) * srcW + srcW - 1;    stepX = -srcW; stepY = -1;    break;
+    case 8: base = srcW - 1;                        stepX = srcW;  stepY = -1;    break;
+    default: break;
+  }
+  base += crop.x * stepX + crop.y * stepY;
+
+  // 16.16 source step per destination pixel
+  uint32_t xStep = ((uint32_t)crop.w << 16) / dstW;
+  uint32_t yStep = ((uint32_t)crop.h << 16) / dstH;
+
+  if (crop.w >= dstW && crop.h >= dstH) {
+    // Box filter: divide by the block size through a reciprocal table
+    static uint16_t reciprocal[65];
+    if (reciprocal[1] == 0) {
+      for (int n = 1; n <= 64; ++n) reciprocal[n] = 65535 / n;
+    }
+    for (int dy = 0; dy < dstH; ++dy) {
+      int oy0 = (dy * yStep) >> 16;
+      int oy1 = (int)(((dy + 1) * yStep) >> 16);
+      if (oy1 < oy0 + 1) oy1 = oy0 + 1;
+      for (int dx = 0; dx < dstW; ++dx) {
+        int ox0 = (dx * xStep) >> 16;
+        int ox1 = (int)(((dx + 1) * xStep) >> 16);
+        if (ox1 < ox0 + 1) ox1 = ox0 + 1;
+        uint32_t r = 0, g = 0, b = 0;
+        for (int oy = oy0; oy < oy1; ++oy) {
+          const uint16_t* p = src + base + oy * stepY + ox0 * stepX;
+          for (int ox = ox0; ox < ox1; ++ox, p += stepX) {
+            uint16_t c = __builtin_bswap16(*p);
+            r += c >> 11;
+            g += (c >> 5) & 0x3F;
+            b += c & 0x1F;
+          }
+        }
+        uint32_t n = (oy1 - oy0) * (ox1 - ox0);
+        if (n <= 64) {
+          r = (r * reciprocal[n] + 32768) >> 16;
+          g = (g * reciprocal[n] + 32768) >> 16;
+          b = (b * reciprocal[n] + 32768) >> 16;
+        } else {
+          r /= n;
+          g /= n;
+          b /= n;
+        }
+        dst[dy * dstW + dx] = __builtin_bswap16((r << 11) | (g << 5) | b);
+      }
+    }
+    return true;
+  }
+
+  // Bilinear, separably: each source row is interpolated horizontally once
+  // into planar R, G, B (reused by every output row that samples it), then
+  // output rows are a vertical lerp of two such rows.
+  int stride = (dstW + 7) & ~7;  // Whole 8-lane vectors per plane
+  size_t planeBytes = (size_t)stride * 9 * sizeof(int16_t);
+  size_t tableBytes = (size_t)dstW * (2 * sizeof(int32_t) + 1);
+  uint8_t* scratch = (uint8_t*)calloc(1, planeBytes + tableBytes + 15);
+  if (!scratch) return false;
+  int16_t* planes = (int16_t*)(((uintptr_t)scratch + 15) & ~(uintptr_t)15);
+  int16_t* rows[2] = {planes, planes + 3 * stride};
+  int16_t* mixed = planes + 6 * stride;
+  int32_t* left = (int32_t*)(planes + 9 * stride);
+  int32_t* right = left + dstW;
+  uint8_t* weightX = (uint8_t*)(right + dstW);
+  int rowKey[2] = {-1, -1};
+
+  // Sample at pixel centres, clamped to the crop window
+  for (int dx = 0; dx < dstW; ++dx) {
+    int32_t fx = (int32_t)(dx * xStep + xStep / 2) - 32768;
+    if (fx < 0) fx = 0;
+    int ox0 = fx >> 16 < crop.w - 1 ? fx >> 16 : crop.w - 1;
+    int ox1 = ox0 + 1 < crop.w - 1 ? ox0 + 1 : crop.w - 1;
+    left[dx] = ox0 * stepX;
+    right[dx] = ox1 * stepX;
+    weightX[dx] = (fx >> 11) & 31;
+  }
+
+  for (int dy = 0; dy < dstH; ++dy) {
+    int32_t fy = (int32_t)(dy * yStep + yStep / 2) - 32768;
+    if (fy < 0) fy = 0;
+    int oy0 = fy >> 16 < crop.h - 1 ? fy >> 16 : crop.h - 1;
+    int oy1 = oy0 + 1 < crop.h - 1 ? oy0 + 1 : crop.h - 1;
+    int wy = (fy >> 11) & 31;
+
+    // oy0 and oy1 are adjacent or equal, so slot oy & 1 never evicts the other
+    for (int oy : {oy0, oy1}) {
+      if (rowKey[oy & 1] == oy) continue;
+      rowKey[oy & 1] = oy;
+      const uint16_t* row = src + base + oy * stepY;
+      int16_t* r = rows[oy & 1];
+      int16_t* g = r + stride;
+      int16_t* b = g + stride;
+      for (int dx = 0; dx < dstW; ++dx) {
+        uint32_t wx = weightX[dx];
+        uint32_t p0 = spreadRgb565(__builtin_bswap16(row[left[dx]]));
+        uint32_t p1 = spreadRgb565(__builtin_bswap16(row[right[dx]]));
+        uint32_t p = ((p0 * (32 - wx) + p1 * wx) >> 5) & 0x07E0F81F;
+        r[dx] = (p >> 11) & 0x1F;
+        g[dx] = p >> 21;
+        b[dx] = p & 0x1F;
+      }
+    }
+
+    const int16_t* top = rows[oy0 & 1];
+    const int16_t* bottom = rows[oy1 & 1];
+    for (int plane = 0; plane < 3; ++plane) {
+      lerpRowsS16(top + plane * stride, bottom + plane * stride, mixed + plane * stride, stride, wy);
+    }
+    uint16_t* out = dst + dy * dstW;
+    for (int dx = 0; dx < dstW; ++dx) {
+      out[dx] = __builtin_bswap16((mixed[dx] << 11) | (mixed[stride + dx] << 5) | mixed[2 * stride + dx]);
+    }
+  }
+  free(scratch);
+  return true;
+}
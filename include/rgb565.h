@@ -0,0 +1,55 @@
+// RGB565 pixel arithmetic shared by the firmware and the native tests.
+// Sprite byte order is big-endian RGB565 as LovyanGFX canvases store it;
+// native order is the CPU's.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Spread an RGB565 pixel to 0x07E0F81F so R, G and B can be weighted in one
+// 32-bit multiply (weights up to 32 fit between the fields)
+inline uint32_t spreadRgb565(uint16_t c) {
+  return (c | ((uint32_t)c << 16)) & 0x07E0F81F;
+}
+
+inline uint16_t packRgb565(uint32_t spread) {
+  spread &= 0x07E0F81F;
+  return spread | (spread >> 16);
+}
+
+// Blend bg towards fg by alpha/32, two pixels per 32-bit load. Each pixel is
+// spread to 0x07E0F81F so R, G and B can be multiplied in one 32-bit word.
+// bg is sprite byte order; fg is sprite order unless fgNative; out is native.
+// Pairs go through memcpy, which compiles to plain 32-bit loads and stores
+// without breaking strict aliasing once the kernel is inlined.
+inline void blendRgb565Swar(const uint16_t* bg, const uint16_t* fg, uint16_t* out,
+                            size_t count, uint32_t alpha, bool fgNative) {
+  const uint32_t inv = 32 - alpha;
+  for (size_t i = 0; i < count / 2; ++i) {
+    uint32_t b, f;
+    memcpy(&b, bg + i * 2, 4);
+    memcpy(&f, fg + i * 2, 4);
+    // Byte-swap both 16-bit halves at once
+    b = ((b & 0x00FF00FF) << 8) | ((b >> 8) & 0x00FF00FF);
+    if (!fgNative) f = ((f & 0x00FF00FF) << 8) | ((f >> 8) & 0x00FF00FF);
+
+    uint32_t b0 = ((b & 0xFFFF) | (b << 16)) & 0x07E0F81F;
+    uint32_t f0 = ((f & 0xFFFF) | (f << 16)) & 0x07E0F81F;
+    uint32_t b1 = ((b >> 16) | (b & 0xFFFF0000)) & 0x07E0F81F;
+    uint32_t f1 = ((f >> 16) | (f & 0xFFFF0000)) & 0x07E0F81F;
+    uint32_t p0 = ((b0 * inv + f0 * alpha) >> 5) & 0x07E0F81F;
+    uint32_t p1 = ((b1 * inv + f1 * alpha) >> 5) & 0x07E0F81F;
+    uint32_t pair = ((p0 | (p0 >> 16)) & 0xFFFF) | ((p1 | (p1 >> 16)) << 16);
+    memcpy(out + i * 2, &pair, 4);
+  }
+  if (count & 1) {
+    size_t i = count - 1;
+    uint32_t b = __builtin_bswap16(bg[i]);
+    uint32_t f = fgNative ? fg[i] : __builtin_bswap16(fg[i]);
+    b = (b | (b << 16)) & 0x07E0F81F;
+    f = (f | (f << 16)) & 0x07E0F81F;
+    uint32_t p = ((b * inv + f * alpha) >> 5) & 0x07E0F81F;
+    out[i] = p | (p >> 16);
+  }
+}
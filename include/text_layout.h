@@ -0,0 +1,148 @@
+// UTF-8 decoding and line breaking, shared by the firmware and the native
+// tests. Glyph widths come from a caller-supplied advance function, so the
+// breaker itself knows nothing about fonts.
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// Decode one UTF-8 sequence, advancing p; invalid bytes decode as themselves
+inline uint32_t nextCodepoint(const char*& p) {
+  uint8_t c = *p++;
+  int extra = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC0 ? 1 : 0;
+  uint32_t codepoint = extra ? c & (0x3F >> extra) : c;
+  for (; extra > 0 && (*p & 0xC0) == 0x80; --extra) codepoint = (codepoint << 6) | (*p++ & 0x3F);
+  return codepoint;
+}
+
+// Line breaking, a subset of UAX #14: Latin text breaks after spaces and
+// hyphens, CJK ideographs, kana and hangul break between any two characters,
+// never before closing or after opening punctuation, and a word wider than
+// the line breaks anywhere.
+constexpr int kMaxLayoutLines = 3;
+
+enum class BreakClass : uint8_t {
+  Other,
+  Space,
+  Hyphen,
+  Ideograph,
+  Open,
+  Close,
+  Newline
+};
+
+struct TextLayout {
+  uint32_t key;        // 0 = empty; the cache key of whoever filled it
+  uint32_t textHash;
+  uint16_t start[kMaxLayoutLines];  // Byte ranges of each line
+  uint16_t end[kMaxLayoutLines];
+  uint8_t lineCount;
+  bool truncated;      // The last line runs to the end of the text and must be ellipsized
+};
+
+inline BreakClass breakClass(uint32_t c) {
+  if (c == '\n') return BreakClass::Newline;
+  if (c == ' ' || c == '\t' || c == 0x3000) return BreakClass::Space;
+  if (c == '-' || c == 0x2010 || c == 0x2013) return BreakClass::Hyphen;
+  if (c == '(' || c == '[' || c == '{' || c == 0xFF08 ||
+      (c >= 0x3008 && c <= 0x3011 && c % 2 == 0)) {
+    return BreakClass::Open;
+  }
+  if ((c < 0x80 && strchr(")]},.;:!?", (int)c)) || c == 0x3001 || c == 0x3002 ||
+      (c >= 0x3008 && c <= 0x3011 && c % 2 == 1) || c == 0xFF09 || c == 0xFF0C ||
+      c == 0xFF0E || c == 0xFF01 || c == 0xFF1F || c == 0xFF1A || c == 0xFF1B) {
+    return BreakClass::Close;
+  }
+  if ((c >= 0x2E80 && c <= 0x9FFF) || (c >= 0xAC00 && c <= 0xD7AF) ||
+      (c >= 0xF900 && c <= 0xFAFF) || (c >= 0xFF00 && c <= 0xFFEF) ||
+      (c >= 0x20000 && c <= 0x2FFFF)) {
+    return BreakClass::Ideograph;
+  }
+  return BreakClass::Other;
+}
+
+// Whether a line may break between a character of class `before` and one of `after`
+inline bool canBreakBetween(BreakClass before, BreakClass after) {
+  if (after == BreakClass::Close || after == BreakClass::Space || before == BreakClass::Open) {
+    return false;
+  }
+  return before == BreakClass::Space || before == BreakClass::Hyphen ||
+         before == BreakClass::Ideograph || after == BreakClass::Ideograph;
+}
+
+// Fill layout's line ranges for text wrapped to maxWidth in at most maxLines
+// lines. advance(codepoint, utf8) returns a glyph's pen advance in pixels.
+template <typename Advance>
+void breakLines(const char* text, int maxWidth, int maxLines, Advance advance, TextLayout& layout) {
+  maxLines = maxLines < 1 ? 1 : maxLines > kMaxLayoutLines ? kMaxLayoutLines : maxLines;
+  layout.lineCount = 0;
+  layout.truncated = false;
+
+  int length = (int)strlen(text);
+  if (length > 0xFFFF) length = 0xFFFF;
+  int lineStart = 0;
+  int breakAt = -1;          // Latest break opportunity on this line
+  float widthAtBreak = 0;
+  float width = 0;
+  BreakClass prev = BreakClass::Newline;
+  auto endLine = [&](int end, int next) {
+    while (end > lineStart && text[end - 1] == ' ') --end;
+    layout.start[layout.lineCount] = lineStart;
+    layout.end[layout.lineCount] = end;
+    layout.lineCount++;
+    lineStart = next;
+    breakAt = -1;
+  };
+
+  for (const char* p = text; *p && p - text < length;) {
+    int at = p - text;
+    uint32_t codepoint = nextCodepoint(p);
+    BreakClass cls = breakClass(codepoint);
+    if (cls == BreakClass::Newline) {
+      if (layout.lineCount == maxLines - 1) {
+        layout.truncated = at < length - 1;
+        if (!layout.truncated) endLine(at, length);  // A trailing newline ends the text
+        break;
+      }
+      endLine(at, p - text);
+      width = 0;
+      prev = BreakClass::Newline;
+      continue;
+    }
+    if (at > lineStart && canBreakBetween(prev, cls)) {
+      breakAt = at;
+      widthAtBreak = width;
+    }
+    prev = cls;
+
+    char utf8[5] = {};
+    memcpy(utf8, text + at, p - text - at);
+    float glyphWidth = advance(codepoint, utf8);
+    if (cls != BreakClass::Space && width + glyphWidth > maxWidth && at > lineStart) {
+      if (layout.lineCount == maxLines - 1) {
+        layout.truncated = true;
+        break;
+      }
+      if (breakAt > lineStart) {
+        endLine(breakAt, breakAt);
+        width -= widthAtBreak;
+      } else {
+        endLine(at, at);  // No opportunity: break inside the word
+        width = 0;
+      }
+    }
+    if (at == lineStart && cls == BreakClass::Space) {
+      lineStart = p - text;  // Spaces that wrapped to a new line are dropped
+      continue;
+    }
+    width += glyphWidth;
+  }
+
+  if (layout.truncated) {
+    layout.start[layout.lineCount] = lineStart;
+    layout.end[layout.lineCount] = length;
+    layout.lineCount++;
+  } else if (lineStart < length || layout.lineCount == 0) {
+    endLine(length, length);
+  }
+}
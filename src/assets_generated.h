@@ -0,0 +1,2744 @@
+#pragma once
+#include "asset_decoder.h"
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+// Generated by tools/build_assets.py from assets/ - do not edit.
+// Compressed RGB565 decoding to panel byte order; see the script for the formats.
+
+const uint8_t kAssetIcon1Data[3593] PROGMEM = {
+  0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xD1, 0xA8, 0x52, 0xFE, 0x83, 0x07, 0xA5, 0x75, 0x55, 0xFE, 0x5A,
+  0x25, 0xFE, 0x00, 0x20, 0x00, 0xDE, 0x05, 0x19, 0x3D, 0x0C, 0x9B, 0x9B, 0xFE, 0x28, 0xE2, 0x99,
+  0xAD, 0xF5, 0xFE, 0x41, 0x83, 0xFE, 0xC4, 0x8B, 0x7E, 0x09, 0x11, 0x7F, 0x95, 0xBF, 0xFE, 0x08,
+  0x20, 0x00, 0xDC, 0x08, 0x35, 0x20, 0x11, 0x09, 0x11, 0x09, 0xFE, 0x41, 0x63, 0x00, 0xF3, 0xA3,
+  0x76, 0xFE, 0xB4, 0x2A, 0x09, 0x51, 0x6E, 0x6B, 0x35, 0x20, 0xFE, 0x82, 0xE7, 0x00, 0xDC, 0x14,
+  0x20, 0x35, 0x01, 0x3A, 0x35, 0x09, 0x2D, 0xFE, 0x10, 0x60, 0x00, 0xF2, 0x29, 0x11, 0x9D, 0x9B,
+  0x7E, 0xC2, 0x35, 0xA4, 0x66, 0xFE, 0x5A, 0x05, 0x00, 0xDA, 0x14, 0x1D, 0x35, 0x04, 0xC2, 0x35,
+  0x11, 0x29, 0x00, 0xF2, 0xFE, 0x51, 0xE5, 0x11, 0x01, 0x04, 0xC4, 0x7E, 0xFE, 0x31, 0x23, 0x00,
+  0xD8, 0x14, 0x0C, 0x04, 0x01, 0x04, 0xC2, 0x01, 0xA3, 0x75, 0xFE, 0x51, 0xE5, 0x00, 0xF2, 0x29,
+  0x11, 0x3C, 0x04, 0xC3, 0x3A, 0x09, 0x2D, 0xFE, 0x10, 0x81, 0x00, 0xD6, 0x21, 0x2D, 0x09, 0x3A,
+  0x04, 0xC3, 0x3C, 0x11, 0x29, 0x00, 0xF2, 0xA2, 0x76, 0x2D, 0x09, 0x3A, 0x04, 0xC3, 0x3C, 0x11,
+  0x96, 0xBF, 0x00, 0xD6, 0xFE, 0x93, 0x88, 0x11, 0x3C, 0x04, 0xC3, 0x59, 0x09, 0x9C, 0xAB, 0x0D,
+  0x00, 0xF3, 0xAB, 0x40, 0x09, 0x04, 0x01, 0x04, 0xC3, 0x55, 0x1D, 0xFE, 0x72, 0xA6, 0x00, 0xD4,
+  0x3D, 0x1D, 0x35, 0x04, 0xC3, 0x01, 0x04, 0x09, 0x21, 0x00, 0xF5, 0x29, 0x09, 0x04, 0x01, 0x04,
+  0xC3, 0x01, 0x16, 0xFE, 0x49, 0xC4, 0x00, 0xD2, 0x3D, 0x11, 0x01, 0x04, 0xC3, 0x01, 0x04, 0x09,
+  0x29, 0x00, 0xF7, 0x29, 0x09, 0x04, 0x3A, 0x04, 0xC2, 0x01, 0x04, 0xC0, 0xFE, 0x28, 0xE2, 0x99,
+  0xAD, 0xD0, 0xA7, 0x63, 0x04, 0xC0, 0x01, 0x04, 0xC2, 0x01, 0x04, 0x09, 0x29, 0xFE, 0x00, 0x00,
+  0xF9, 0x29, 0x09, 0x04, 0x01, 0x04, 0xC2, 0x3A, 0x09, 0x9C, 0x9A, 0x15, 0x00, 0xCE, 0x0D, 0xFE,
+  0xAB, 0xEA, 0x09, 0x3A, 0x04, 0xC2, 0x01, 0x04, 0x09, 0x29, 0x00, 0xFB, 0x29, 0x09, 0x04, 0x3A,
+  0x04, 0xC2, 0x3A, 0x11, 0xFE, 0x8B, 0x48, 0x00, 0xCE, 0xFE, 0x8B, 0x28, 0x11, 0x35, 0x04, 0xC2,
+  0x01, 0x04, 0x09, 0x29, 0x00, 0xFD, 0x29, 0x09, 0x04, 0x01, 0x04, 0xC2, 0x35, 0xA4, 0x76, 0xFE,
+  0x62, 0x45, 0x00, 0xCC, 0x21, 0x20, 0x35, 0x04, 0xC2, 0x01, 0x04, 0x09, 0x29, 0x00, 0xFD, 0xC1,
+  0x29, 0x09, 0x04, 0x3A, 0x04, 0xC2, 0x01, 0x11, 0x24, 0x00, 0xCA, 0xAB, 0x40, 0x11, 0x01, 0x04,
+  0xC2, 0x3A, 0x04, 0x09, 0x29, 0x00, 0xFD, 0xC3, 0x29, 0x09, 0x04, 0x3A, 0x04, 0xC1, 0x3A, 0x09,
+  0x35, 0xFE, 0x20, 0xA1, 0x00, 0xC8, 0xA5, 0x64, 0x35, 0x09, 0x3A, 0x04, 0xC1, 0x3A, 0x04, 0x09,
+  0xFE, 0x41, 0x83, 0x00, 0xFD, 0xC5, 0x29, 0x09, 0x04, 0x01, 0x04, 0xC1, 0x3A, 0x11, 0x98, 0xBE,
+  0x08, 0x00, 0xC6, 0x08, 0xFE, 0xA3, 0xC9, 0xA7, 0x63, 0x3A, 0x04, 0xC1, 0x01, 0x04, 0x09, 0x29,
+  0x00, 0xFD, 0xC7, 0x29, 0x09, 0x04, 0x01, 0x04, 0xC1, 0x35, 0x16, 0xFE, 0x82, 0xE7, 0x00, 0xC6,
+  0x14, 0x16, 0x35, 0x04, 0xC1, 0x01, 0x04, 0x09, 0x29, 0x00, 0xFD, 0xC9, 0x29, 0x09, 0x04, 0x01,
+  0x04, 0xC1, 0x01, 0x16, 0xFE, 0x5A, 0x05, 0x00, 0xC4, 0x14, 0x16, 0x01, 0x04, 0xC1, 0x01, 0x04,
+  0x09, 0x29, 0x00, 0xFD, 0xCB, 0x29, 0x09, 0x04, 0x01, 0x04, 0xC0, 0x01, 0x04, 0x7E, 0xFE, 0x31,
+  0x23, 0x00, 0xC2, 0x14, 0x0C, 0x04, 0x01, 0x04, 0xC0, 0x01, 0x04, 0x09, 0x29, 0x00, 0xFD, 0xCB,
+  0x05, 0x00, 0x29, 0x0C, 0x04, 0x01, 0x04, 0xC0, 0x01, 0x09, 0x9D, 0x9A, 0xFE, 0x10, 0x81, 0x00,
+  0xC0, 0x21, 0x2D, 0x09, 0x01, 0x04, 0xC0, 0x01, 0x04, 0x0C, 0x29, 0x00, 0x05, 0x00, 0xFD, 0xCD,
+  0xAB, 0x40, 0x04, 0xC0, 0x35, 0x7E, 0xC0, 0x35, 0x11, 0x96, 0xCF, 0x00, 0xC0, 0xFE, 0x93, 0x68,
+  0x11, 0x9D, 0x9A, 0x3D, 0xC0, 0x35, 0x04, 0x3D, 0x21, 0x00, 0xFD, 0xC1, 0x05, 0x1C, 0xCB, 0x6E,
+  0x05, 0xFE, 0x51, 0xE5, 0xFE, 0xC4, 0xAC, 0x09, 0x6B, 0xC0, 0x15, 0x09, 0xA3, 0x77, 0xFE, 0x72,
+  0xA7, 0xC0, 0x2C, 0x09, 0x15, 0x10, 0xC0, 0x09, 0x7F, 0x0C, 0x05, 0x21, 0x1C, 0xCB, 0x05, 0x00,
+  0xEE, 0xAC, 0x21, 0xFE, 0xA4, 0x90, 0xAD, 0x10, 0xA3, 0x87, 0xCD, 0x56, 0xA3, 0x76, 0x7E, 0x10,
+  0x6E, 0x10, 0x15, 0x10, 0xA2, 0x76, 0xC0, 0x10, 0x15, 0x10, 0x15, 0x10, 0x18, 0x10, 0x34, 0x3C,
+  0xCD, 0x9C, 0x9A, 0x20, 0x31, 0x00, 0xEB, 0xFE, 0x7B, 0x4C, 0xFE, 0xFF, 0x39, 0xA3, 0x56, 0x62,
+  0x29, 0xCE, 0x66, 0xCE, 0x29, 0xCE, 0x35, 0x3F, 0x9D, 0xBB, 0xFE, 0x7B, 0x6C, 0x00, 0xE9, 0xFE,
+  0x6A, 0xEA, 0xFE, 0xFF, 0xBB, 0x9A, 0xEC, 0x15, 0x1F, 0xCF, 0x24, 0xCE, 0x1F, 0xCF, 0x15, 0x1F,
+  0x0B, 0x20, 0x00, 0xE7, 0xA5, 0x65, 0x10, 0x24, 0x18, 0x24, 0xF2, 0x18, 0x24, 0x9D, 0xAA, 0x30,
+  0x00, 0xE4, 0x05, 0x00, 0xFE, 0x6B, 0x0A, 0xFE, 0xFF, 0x7A, 0x10, 0x24, 0xF4, 0x10, 0x3A, 0x25,
+  0x00, 0x05, 0x00, 0xE4, 0xFE, 0x9C, 0x90, 0xFE, 0xFF, 0xBB, 0x29, 0x35, 0xF4, 0x29, 0x0B, 0xFE,
+  0x9C, 0xB0, 0x00, 0xE4, 0xA3, 0xA6, 0xA7, 0xD4, 0xAB, 0x52, 0xA6, 0x44, 0x66, 0xF6, 0x25, 0x99,
+  0xCC, 0xFE, 0x70, 0xE3, 0x9B, 0x3B, 0x00, 0xE1, 0xA3, 0xB6, 0xFE, 0xD1, 0xE6, 0xA2, 0x87, 0x9D,
+  0x99, 0x66, 0xF8, 0x5A, 0x56, 0x45, 0x1D, 0x00, 0xE0, 0xFE, 0x91, 0x64, 0xA5, 0xD6, 0x9F, 0x68,
+  0x7E, 0xF9, 0x52, 0x9D, 0x79, 0x27, 0x9B, 0x4B, 0x99, 0x0C, 0xE0, 0xFE, 0xA9, 0x85, 0xA4, 0xA5,
+  0x03, 0xF9, 0x08, 0x3B, 0x9D, 0x89, 0x7F, 0x9D, 0x6A, 0x00, 0xE0, 0xFE, 0xA1, 0x85, 0x0B, 0x46,
+  0x03, 0xF8, 0x08, 0x9D, 0x9A, 0x15, 0x24, 0x9D, 0x5A, 0xFE, 0x00, 0x00, 0xE0, 0x1E, 0x0B, 0x03,
+  0x08, 0xF8, 0x3B, 0x9D, 0x8A, 0xC0, 0x24, 0x3C, 0x00, 0xE0, 0xFE, 0x99, 0x64, 0x3B, 0x2C, 0xF8,
+  0x5A, 0x1C, 0xC1, 0x24, 0x3F, 0x00, 0xE0, 0x22, 0x27, 0x12, 0x7F, 0xFA, 0x12, 0x27, 0x22, 0x00,
+  0xE0, 0xA1, 0xA7, 0xFE, 0xA1, 0x44, 0x2C, 0x9C, 0xAB, 0xF8, 0x66, 0x0B, 0x2C, 0x0A, 0x0E, 0x00,
+  0xE1, 0xA1, 0x97, 0xA4, 0xD6, 0xFE, 0xC2, 0xE7, 0xA4, 0x65, 0x55, 0x6E, 0xF4, 0x3E, 0x0D, 0x2C,
+  0x08, 0x0B, 0x00, 0xE3, 0xFE, 0x39, 0xA3, 0xFE, 0xFE, 0xED, 0xC5, 0x66, 0xC0, 0x0B, 0xD2, 0x06,
+  0xC0, 0x0B, 0xD2, 0x06, 0xC0, 0x0B, 0xC5, 0x2B, 0x00, 0xE3, 0x7E, 0xFE, 0xD5, 0x8A, 0x06, 0x9D,
+  0xAA, 0x7E, 0x66, 0x35, 0x30, 0xC0, 0xA2, 0x67, 0x06, 0x35, 0x2D, 0x35, 0x30, 0x35, 0xCA, 0x30,
+  0x35, 0x2D, 0x35, 0x01, 0xC0, 0x35, 0x2D, 0x35, 0x30, 0x35, 0xCA, 0x30, 0x35, 0x2D, 0x35, 0x06,
+  0x01, 0x30, 0xC0, 0x35, 0x30, 0x35, 0x2D, 0x06, 0x96, 0xDF, 0x08, 0x00, 0xE2, 0xFE, 0x72, 0xE5,
+  0xFE, 0xFF, 0x0D, 0x2D, 0x35, 0xC2, 0x01, 0x69, 0xFE, 0xED, 0x8B, 0x61, 0x2D, 0x06, 0x35, 0xCE,
+  0x01, 0x35, 0xFE, 0xED, 0x6B, 0xC0, 0x35, 0x01, 0x35, 0xCE, 0x06, 0x2D, 0x2F, 0x00, 0x3A, 0xC0,
+  0x35, 0xC2, 0x2D, 0x10, 0xFE, 0x72, 0xE5, 0xFE, 0x00, 0x00, 0xE1, 0xA4, 0x65, 0xFE, 0xEE, 0x2C,
+  0x01, 0x55, 0x35, 0xC1, 0x3A, 0x9C, 0xBC, 0xFE, 0xC2, 0xC7, 0xFE, 0xB1, 0x44, 0xC0, 0xA6, 0x34,
+  0xFE, 0xED, 0x8B, 0x06, 0x35, 0xC2, 0x01, 0xC4, 0x35, 0xC2, 0x01, 0x9A, 0xDC, 0xFE, 0xC2, 0x66,
+  0x10, 0xC0, 0x11, 0x12, 0x01, 0x35, 0xC2, 0x01, 0xC4, 0x35, 0xC2, 0x06, 0x00, 0x3F, 0x10, 0xC0,
+  0x27, 0xFE, 0xF6, 0x4C, 0x3A, 0x35, 0xC1, 0x32, 0x01, 0x20, 0x21, 0x9C, 0xAB, 0xE0, 0xFE, 0x7A,
+  0xE4, 0xFE, 0xFE, 0x6B, 0x52, 0x35, 0x01, 0x35, 0xC0, 0x06, 0xFE, 0xCB, 0x27, 0xFE, 0xA8, 0xE4,
+  0xA5, 0x44, 0xC0, 0x9D, 0xBA, 0xA8, 0x12, 0x2D, 0x35, 0xC2, 0x51, 0x9D, 0xBA, 0x65, 0xC0, 0x0B,
+  0x21, 0x35, 0x01, 0x35, 0xC0, 0x3A, 0xFE, 0xC2, 0x86, 0xFE, 0xA9, 0x04, 0xA4, 0x55, 0xC0, 0x03,
+  0xFE, 0xC2, 0xA6, 0x01, 0x35, 0xC0, 0x01, 0x35, 0x51, 0x0B, 0x3F, 0xC0, 0x0B, 0x21, 0x35, 0x01,
+  0x35, 0xC0, 0x2D, 0xFE, 0xBA, 0x05, 0x99, 0xEE, 0xA3, 0x56, 0xC0, 0x3E, 0xFE, 0xCB, 0x47, 0x06,
+  0x35, 0xC0, 0x01, 0x35, 0x9C, 0xBB, 0x29, 0x3C, 0x00, 0xDF, 0xA2, 0x86, 0xFE, 0xDC, 0xE7, 0xA4,
+  0x75, 0x56, 0xA2, 0x76, 0x1C, 0x01, 0x3A, 0x28, 0xFE, 0xB9, 0xC5, 0x9D, 0xAB, 0x6E, 0x1C, 0x21,
+  0x61, 0x2F, 0x06, 0x62, 0x2D, 0x9A, 0xEB, 0x29, 0x5A, 0xC2, 0x29, 0x3A, 0xA5, 0x35, 0x3C, 0x01,
+  0x99, 0xDD, 0xFE, 0xB1, 0x85, 0xC0, 0x1C, 0xC0, 0x21, 0xC0, 0x12, 0x01, 0x3C, 0x50, 0x3A, 0x29,
+  0x26, 0xC2, 0x29, 0x3A, 0xA6, 0x35, 0x3C, 0x06, 0x2F, 0x10, 0xA2, 0x67, 0x1C, 0x21, 0x1C, 0xA4,
+  0x54, 0x28, 0xA3, 0x65, 0x01, 0x9C, 0xBA, 0x9B, 0xDA, 0x52, 0x29, 0x05, 0xFE, 0x10, 0x40, 0x00,
+  0xDE, 0xFE, 0x6A, 0x63, 0xFE, 0xFD, 0xC8, 0x21, 0x29, 0xC0, 0x26, 0xA5, 0x45, 0x01, 0x2D, 0x33,
+  0x15, 0x6F, 0xC1, 0x61, 0xFE, 0xED, 0x8B, 0xFE, 0xFE, 0xED, 0x1C, 0x29, 0x26, 0x29, 0xC6, 0x17,
+  0x06, 0x9A, 0xDD, 0x21, 0x66, 0x21, 0xC0, 0x1C, 0x21, 0x17, 0x06, 0x17, 0x29, 0xC6, 0x26, 0x29,
+  0xA6, 0x25, 0x0B, 0x00, 0x10, 0x21, 0xC1, 0x15, 0x33, 0x2D, 0x01, 0x9B, 0xCA, 0x26, 0x29, 0xC0,
+  0x56, 0x3B, 0x1B, 0xFE, 0x00, 0x00, 0xDD, 0x6E, 0xFE, 0xCC, 0xA7, 0xA8, 0x61, 0x26, 0xC1, 0x29,
+  0x26, 0x3F, 0x06, 0xFE, 0xD4, 0x09, 0xFE, 0xA8, 0xE4, 0xA4, 0x55, 0xC0, 0x3E, 0x27, 0x01, 0x10,
+  0x29, 0xC1, 0x26, 0x29, 0x2E, 0xC0, 0x29, 0x26, 0x29, 0xC1, 0xA4, 0x46, 0x06, 0xFE, 0xCB, 0x68,
+  0x3E, 0x1C, 0xC0, 0x3E, 0x0A, 0x06, 0x0B, 0x29, 0xC1, 0x26, 0x29, 0x2E, 0xC0, 0x29, 0x26, 0x29,
+  0xC1, 0x10, 0x01, 0x27, 0x3E, 0x1C, 0xC0, 0x3E, 0x2D, 0x06, 0x3F, 0x26, 0x29, 0x26, 0xC1, 0x36,
+  0x35, 0x05, 0x00, 0xDC, 0xFE, 0x41, 0x62, 0x29, 0x51, 0x29, 0xA2, 0x66, 0xC0, 0x26, 0x29, 0x55,
+  0x2E, 0x10, 0xFE, 0xD3, 0xC8, 0xFE, 0xB9, 0xE5, 0x66, 0xAA, 0x00, 0xFE, 0xF5, 0xCA, 0x3F, 0x1A,
+  0x29, 0x26, 0x7E, 0x6E, 0x2E, 0x9D, 0xAB, 0xC0, 0x29, 0x33, 0x2E, 0x26, 0x29, 0x1A, 0xA3, 0x67,
+  0x10, 0xFE, 0xD3, 0x67, 0xFE, 0xB9, 0xC5, 0xC0, 0x06, 0x10, 0x3A, 0x1A, 0x29, 0x26, 0x7E, 0x33,
+  0x29, 0x1C, 0xC0, 0x2E, 0x33, 0x2E, 0x26, 0x29, 0x1A, 0x3F, 0x6B, 0x34, 0xFE, 0xB9, 0xC5, 0x6E,
+  0xFE, 0xD3, 0xC7, 0x10, 0x9C, 0xCA, 0x1A, 0x29, 0x26, 0xA2, 0x76, 0xC0, 0x29, 0x51, 0x29, 0x1D,
+  0x00, 0xDC, 0xA9, 0xE2, 0xA5, 0xC5, 0x46, 0x38, 0xA7, 0x32, 0xFE, 0xE4, 0x87, 0x33, 0x29, 0xC1,
+  0x5A, 0x33, 0x21, 0xC0, 0x33, 0x29, 0x21, 0x29, 0xC0, 0x33, 0x9A, 0xDD, 0xFE, 0xD3, 0x46, 0xFE,
+  0xC2, 0x25, 0x9D, 0xAB, 0xC0, 0xA3, 0x55, 0xA7, 0x32, 0xFE, 0xE4, 0xA7, 0x33, 0x29, 0xC0, 0x26,
+  0x29, 0x33, 0x21, 0xC0, 0x33, 0x29, 0x26, 0x29, 0xC0, 0x33, 0x3E, 0x2D, 0x3D, 0x2E, 0xC0, 0x00,
+  0x3A, 0x0B, 0x33, 0x29, 0xC0, 0x21, 0x29, 0x33, 0x21, 0xC0, 0x33, 0x26, 0x29, 0xC1, 0x33, 0x39,
+  0x28, 0x38, 0x9D, 0xAB, 0x31, 0x2F, 0x97, 0x2E, 0xDB, 0x7A, 0xFE, 0xA1, 0x44, 0xA1, 0x98, 0xC0,
+  0x65, 0x66, 0x10, 0x28, 0x29, 0x6E, 0x56, 0x29, 0x26, 0x29, 0x2E, 0x26, 0x29, 0x26, 0x29, 0x33,
+  0xFE, 0xD3, 0xA6, 0xFE, 0xB1, 0x85, 0x0B, 0x10, 0x6E, 0xC0, 0x10, 0x0B, 0x15, 0x3A, 0x2E, 0x29,
+  0x26, 0x29, 0x26, 0x29, 0xC0, 0x26, 0x29, 0x26, 0x29, 0x2E, 0x3A, 0x1C, 0x0B, 0x10, 0x15, 0xC0,
+  0x10, 0x0B, 0x21, 0x09, 0x33, 0x29, 0x26, 0x29, 0x26, 0x2E, 0x29, 0x26, 0x29, 0x26, 0x2E, 0x29,
+  0x28, 0x10, 0x0B, 0x10, 0x1C, 0xC0, 0x0A, 0x03, 0x00, 0xDA, 0xA4, 0xB5, 0xFE, 0xC1, 0x85, 0x1C,
+  0x21, 0xC2, 0x0B, 0xFE, 0xC2, 0x65, 0xFE, 0xED, 0x48, 0x33, 0x26, 0xC4, 0x2E, 0x33, 0xFE, 0xCB,
+  0x26, 0x0B, 0x1C, 0x6E, 0xC4, 0x1C, 0x0B, 0xFE, 0xCA, 0xC6, 0x2E, 0x33, 0x26, 0xC4, 0x33, 0x2E,
+  0x23, 0x0B, 0x1C, 0x21, 0xC4, 0x1C, 0x0B, 0x32, 0x33, 0x2E, 0x26, 0xC4, 0x33, 0x9D, 0xAB, 0x0A,
+  0x0B, 0xA3, 0x56, 0xC2, 0x1C, 0x24, 0x97, 0x1D, 0x00, 0xDA, 0x22, 0x27, 0x15, 0x1C, 0xC2, 0x21,
+  0x10, 0x38, 0xFE, 0xE4, 0x67, 0x2E, 0x33, 0xC3, 0x9A, 0xCD, 0xFE, 0xC2, 0x85, 0x0B, 0x21, 0xC0,
+  0x1C, 0xC5, 0x21, 0x0B, 0xA9, 0x10, 0x3E, 0x33, 0xC4, 0x3E, 0x05, 0x0B, 0x21, 0x1C, 0xC5, 0x21,
+  0xC0, 0x0B, 0x0F, 0xFE, 0xE4, 0xC7, 0x33, 0xC3, 0x2E, 0x34, 0x38, 0x10, 0x21, 0x1C, 0xC2, 0x15,
+  0x27, 0x22, 0x00, 0xDA, 0xFE, 0x99, 0x44, 0x24, 0x1C, 0xC4, 0x21, 0x10, 0xC0, 0x05, 0xA9, 0x10,
+  0xA5, 0x44, 0x6E, 0x09, 0xFE, 0xC2, 0xA6, 0x21, 0x10, 0x21, 0x1C, 0xC8, 0x21, 0x10, 0x1C, 0x0F,
+  0xA8, 0x21, 0x22, 0xC0, 0x04, 0x0F, 0x1C, 0x10, 0x21, 0x1C, 0xC8, 0x21, 0x10, 0x21, 0x1B, 0x09,
+  0x27, 0x22, 0x3F, 0x0A, 0x10, 0xC0, 0x21, 0x1C, 0xC4, 0x24, 0x07, 0x00, 0xD9, 0xA2, 0xA6, 0x21,
+  0x1C, 0xC6, 0x21, 0xC0, 0x10, 0x0B, 0xC0, 0x10, 0x0B, 0x10, 0x1C, 0x21, 0x1C, 0xCA, 0x21, 0x1C,
+  0x10, 0x0B, 0xC2, 0x10, 0x1C, 0x21, 0x1C, 0xCA, 0x21, 0x1C, 0x10, 0x0B, 0x10, 0x0B, 0xC0, 0x10,
+  0x21, 0xC0, 0x1C, 0xC7, 0x16, 0x00, 0xD8, 0xA4, 0xC6, 0xFE, 0xC1, 0x85, 0x15, 0x1C, 0xC7, 0x21,
+  0xC4, 0x1C, 0xCE, 0x21, 0xC4, 0x1C, 0xCE, 0x21, 0xC4, 0x1C, 0xC7, 0x15, 0x27, 0x3A, 0x00, 0xD8,
+  0xA7, 0xE4, 0x27, 0x15, 0x1C, 0xFD, 0xC4, 0x15, 0x27, 0x9A, 0x3C, 0x00, 0xD8, 0xFE, 0x89, 0x23,
+  0x24, 0x1C, 0xD2, 0x21, 0xC0, 0x1C, 0xD8, 0x21, 0xC0, 0x1C, 0xD2, 0x24, 0x35, 0x00, 0xD8, 0xFE,
+  0xA1, 0x44, 0x24, 0x1C, 0xD0, 0x21, 0xC0, 0x10, 0x15, 0x21, 0xC0, 0x1C, 0xD4, 0x21, 0xC0, 0x10,
+  0xC0, 0x21, 0xC0, 0x1C, 0xD0, 0x24, 0x0A, 0x00, 0xD7, 0x0E, 0x15, 0x1C, 0xD0, 0x21, 0x10, 0xC0,
+  0xA5, 0x44, 0xC0, 0x10, 0x1C, 0x21, 0x1C, 0xD2, 0x21, 0x15, 0x0B, 0x33, 0xC0, 0x10, 0x15, 0x21,
+  0x1C, 0xD0, 0x15, 0x0E, 0x00, 0xD6, 0xA2, 0xB7, 0x24, 0x1C, 0xCF, 0x21, 0x10, 0x33, 0xFE, 0xE5,
+  0x2A, 0xAA, 0x00, 0xC0, 0xFE, 0xDC, 0x48, 0xFE, 0xB1, 0x84, 0x1C, 0xD2, 0x21, 0x15, 0xA2, 0x67,
+  0xFE, 0xE4, 0xC9, 0xFE, 0xF6, 0x4C, 0x2D, 0xFE, 0xE4, 0xA9, 0xFE, 0xB9, 0xA5, 0x1C, 0x21, 0x1C,
+  0xCF, 0x24, 0x20, 0x00, 0xD6, 0x2B, 0x24, 0x1C, 0xCF, 0x21, 0x1C, 0xFE, 0xED, 0x4A, 0xFE, 0xFF,
+  0x0D, 0x9C, 0xCB, 0x01, 0x9E, 0xA7, 0xFE, 0xDB, 0xC6, 0xFE, 0xB1, 0x45, 0x21, 0x1C, 0xD0, 0x21,
+  0x61, 0xFE, 0xE4, 0xC9, 0xFE, 0xFF, 0x2D, 0x35, 0x01, 0x64, 0xFE, 0xDC, 0x47, 0x1C, 0x21, 0x1C,
+  0xCF, 0x24, 0x2B, 0x00, 0xD6, 0x3A, 0xFE, 0xC1, 0x85, 0x45, 0x1C, 0xCD, 0x21, 0x10, 0x38, 0xFE,
+  0xFE, 0xAC, 0x35, 0xC0, 0x3C, 0x9C, 0xB9, 0x99, 0xEC, 0x1A, 0x1C, 0x21, 0x1C, 0xCE, 0x21, 0x1C,
+  0xA2, 0x75, 0x28, 0x35, 0xC0, 0x3C, 0x9C, 0xBA, 0x9B, 0xDA, 0xFE, 0xB9, 0xC4, 0x9C, 0xBC, 0x21,
+  0x1C, 0xCD, 0x69, 0xA1, 0x98, 0x98, 0x0D, 0x00, 0xD6, 0xA5, 0xD5, 0x27, 0x15, 0x1C, 0xCC, 0x21,
+  0x9D, 0xB9, 0x10, 0xFE, 0xD3, 0xCB, 0x01, 0x35, 0xC0, 0x01, 0x9A, 0xDB, 0x9C, 0xBA, 0xFE, 0xCB,
+  0x2A, 0xFE, 0xB1, 0x24, 0x10, 0x21, 0x1C, 0xCC, 0x21, 0x10, 0x0B, 0xFE, 0xCB, 0x4B, 0x3C, 0x35,
+  0xC0, 0x01, 0x9C, 0xBA, 0x29, 0xFE, 0xCB, 0x8A, 0x10, 0x04, 0x21, 0x66, 0xCC, 0x15, 0x27, 0x05,
+  0x00, 0xD6, 0x05, 0x27, 0x15, 0x1C, 0xCB, 0x21, 0x9C, 0xCA, 0xFE, 0xC2, 0xCA, 0xFE, 0xE6, 0x79,
+  0xA9, 0x11, 0x35, 0xC1, 0x01, 0x9A, 0xDB, 0x26, 0xFE, 0xF7, 0x9C, 0xFE, 0xE6, 0x18, 0xFE, 0xBA,
+  0x48, 0x04, 0x21, 0x1C, 0xCA, 0x21, 0x04, 0x17, 0x2C, 0xFE, 0xF7, 0xBD, 0xFE, 0xFE, 0x8D, 0x35,
+  0xC0, 0x01, 0x9C, 0xBA, 0x99, 0xEB, 0xFE, 0xF7, 0x5A, 0x02, 0xFE, 0xC2, 0xAA, 0x3F, 0x21, 0x66,
+  0xCB, 0x15, 0x27, 0x05, 0x00, 0xD6, 0xA5, 0xE5, 0x27, 0x15, 0x1C, 0xCA, 0x21, 0x3F, 0xFE, 0xCB,
+  0xAE, 0xFE, 0xF7, 0xBE, 0x6F, 0x32, 0x35, 0xC1, 0x01, 0x99, 0xEB, 0x26, 0xFE, 0xF7, 0x5B, 0xA5,
+  0x37, 0x9C, 0xCA, 0xFE, 0xC3, 0x2B, 0xFE, 0xB1, 0x03, 0x21, 0x1C, 0xC8, 0x21, 0x3F, 0x12, 0x0C,
+  0x2E, 0x9B, 0xDA, 0x3C, 0x35, 0xC0, 0x01, 0x9B, 0xCA, 0x1A, 0xFE, 0xF7, 0x19, 0x2E, 0x1D, 0x3E,
+  0x3F, 0xA4, 0x46, 0x1C, 0xCA, 0x15, 0x27, 0x08, 0x9B, 0x2B, 0xD6, 0x08, 0x27, 0x15, 0x1C, 0xC9,
+  0x21, 0x3F, 0xFE, 0xCB, 0x6C, 0x2E, 0x9D, 0xBA, 0x6F, 0x03, 0x35, 0x3C, 0x01, 0x9D, 0xA9, 0x99,
+  0xFC, 0x6F, 0xFE, 0xF7, 0x9D, 0x18, 0x1D, 0xC0, 0x37, 0x04, 0xA3, 0x57, 0x1C, 0xC6, 0x21, 0x04,
+  0xFE, 0xC2, 0xCA, 0x1D, 0xC0, 0x18, 0x16, 0x01, 0x65, 0x01, 0x61, 0x99, 0xEB, 0x65, 0xFE, 0xF7,
+  0x7B, 0x24, 0x11, 0xA3, 0x57, 0xFE, 0xCB, 0x4C, 0x3F, 0xA4, 0x46, 0x1C, 0xC9, 0x15, 0x27, 0x05,
+  0x00, 0xD6, 0x05, 0x27, 0x15, 0x1C, 0xC8, 0x21, 0x61, 0xA6, 0x35, 0xFE, 0xEF, 0x5D, 0x1D, 0xC0,
+  0x9B, 0xCB, 0xFE, 0xC3, 0x0B, 0xFE, 0xED, 0x69, 0x35, 0x0B, 0x9C, 0xBA, 0xA3, 0x65, 0xFE, 0xE4,
+  0x47, 0xFE, 0xC3, 0x4D, 0x0C, 0x18, 0xA2, 0x67, 0xFE, 0xEE, 0xBA, 0x21, 0x15, 0x21, 0x1C, 0xC4,
+  0x21, 0x15, 0x21, 0x16, 0x29, 0x18, 0x0C, 0xFE, 0xC3, 0x4C, 0xFE, 0xE4, 0xE9, 0xFE, 0xFE, 0xAC,
+  0x9B, 0xCB, 0x9B, 0xDB, 0xA2, 0x66, 0x99, 0xDE, 0x0D, 0xFE, 0xEF, 0x1C, 0x1D, 0xC0, 0x9D, 0xA9,
+  0x06, 0x9A, 0xDB, 0x21, 0x1C, 0xC8, 0x15, 0x27, 0x05, 0x00, 0xD6, 0xA4, 0xD6, 0x27, 0x15, 0x1C,
+  0xC8, 0x21, 0x3F, 0xFE, 0xDC, 0xF3, 0x2E, 0x18, 0x61, 0xFE, 0xBA, 0x69, 0xFE, 0xA8, 0xC2, 0xFE,
+  0xC2, 0x45, 0xFE, 0xEC, 0xE7, 0xA5, 0x44, 0x6E, 0x03, 0xFE, 0xBA, 0x05, 0x2B, 0x0D, 0x1D, 0x0C,
+  0xA4, 0x46, 0xFE, 0xD4, 0x30, 0x3F, 0x21, 0x1C, 0xC4, 0x21, 0x3F, 0x23, 0x2E, 0x0C, 0x1D, 0x0D,
+  0x2B, 0xA9, 0x12, 0xFE, 0xE4, 0xA7, 0xA7, 0x32, 0xC0, 0x9C, 0xBC, 0x05, 0x2B, 0xFE, 0xBA, 0x89,
+  0x07, 0x18, 0xA3, 0x56, 0x19, 0x3F, 0x21, 0x1C, 0xC8, 0x15, 0x27, 0x3D, 0x00, 0xD6, 0xA4, 0xB5,
+  0x27, 0x15, 0x1C, 0xC7, 0x21, 0x15, 0xA3, 0x67, 0xFE, 0xEF, 0x1B, 0x18, 0x2E, 0xFE, 0xCC, 0x0F,
+  0xFE, 0xB0, 0xE2, 0xA6, 0x25, 0x10, 0xA3, 0x66, 0x1B, 0x0F, 0x21, 0x10, 0x26, 0x33, 0xFE, 0xD4,
+  0xF3, 0x2E, 0x1D, 0x02, 0x15, 0x1C, 0xC6, 0x15, 0x02, 0x1D, 0x2E, 0xFE, 0xD4, 0xD3, 0x33, 0x26,
+  0x10, 0x21, 0x0F, 0x1B, 0x26, 0x10, 0x26, 0x33, 0x23, 0x2E, 0x18, 0x2C, 0x35, 0x15, 0x21, 0x1C,
+  0xC7, 0x15, 0x27, 0x30, 0x00, 0xD6, 0xA3, 0xA6, 0xFE, 0xB9, 0x85, 0x1C, 0xC8, 0x21, 0x9D, 0xB9,
+  0xFE, 0xC2, 0xEB, 0xFE, 0xF7, 0xDF, 0x1D, 0x9C, 0xBA, 0x35, 0x15, 0x21, 0xC0, 0x1C, 0x10, 0xC0,
+  0x1C, 0x21, 0xC0, 0x10, 0xA9, 0x03, 0x18, 0xC0, 0x0C, 0xFE, 0xBA, 0x48, 0x10, 0x21, 0x66, 0xC2,
+  0x21, 0x10, 0x17, 0x0C, 0x18, 0xC0, 0xFE, 0xBA, 0x68, 0x10, 0x21, 0xC0, 0x66, 0x10, 0xC0, 0x1C,
+  0x21, 0xC0, 0x15, 0xA4, 0x56, 0x38, 0x1D, 0x29, 0x08, 0x04, 0x21, 0x1C, 0xC8, 0x24, 0x25, 0x00,
+  0xD6, 0xA2, 0x96, 0x1C, 0xC9, 0x21, 0x3F, 0xFE, 0xCB, 0xCE, 0x2E, 0x29, 0xFE, 0xE6, 0x17, 0x10,
+  0x21, 0x1C, 0xC1, 0x21, 0xC0, 0x1C, 0xC1, 0x15, 0x21, 0xFE, 0xEE, 0xBA, 0x1D, 0x29, 0x12, 0x04,
+  0x21, 0x1C, 0xC2, 0x21, 0x04, 0x12, 0x29, 0x1D, 0x16, 0x21, 0x1C, 0xC2, 0x21, 0xC0, 0x1C, 0xC1,
+  0x21, 0x10, 0xFE, 0xE6, 0x18, 0x29, 0x2E, 0x03, 0x3F, 0x21, 0x1C, 0xC9, 0xFE, 0x18, 0x20, 0x00,
+  0xD6, 0x7A, 0xFE, 0xA9, 0x44, 0x24, 0x1C, 0xC7, 0x21, 0x3F, 0xFE, 0xCC, 0x30, 0x2E, 0x29, 0xFE,
+  0xDD, 0xB6, 0x04, 0x21, 0x1C, 0xC6, 0x21, 0x10, 0xFE, 0xE6, 0x59, 0x29, 0xC0, 0xFE, 0xCB, 0x4C,
+  0x3F, 0xA4, 0x46, 0x1C, 0xC2, 0x21, 0x3F, 0xFE, 0xCB, 0x6C, 0x29, 0xC0, 0x3D, 0x10, 0x21, 0x1C,
+  0xC6, 0x21, 0x04, 0x0C, 0x29, 0x2E, 0x14, 0x3F, 0x21, 0x1C, 0xC7, 0x24, 0x9E, 0x79, 0x03, 0x00,
+  0xD7, 0xFE, 0x91, 0x24, 0x24, 0x1C, 0xC7, 0x21, 0x9C, 0xCA, 0xFE, 0xCB, 0xCE, 0x2E, 0x29, 0xFE,
+  0xE6, 0x38, 0x10, 0x21, 0x1C, 0xC6, 0x15, 0x21, 0xFE, 0xEE, 0xDA, 0x1D, 0x29, 0xFE, 0xC3, 0x0B,
+  0x04, 0x21, 0x1C, 0xC2, 0x21, 0x04, 0x0D, 0x29, 0x1D, 0x1B, 0x21, 0x15, 0x1C, 0xC6, 0x21, 0x10,
+  0x31, 0x29, 0x2E, 0x03, 0x3F, 0x21, 0x1C, 0xC7, 0x24, 0x9D, 0x6A, 0x00, 0xD8, 0xA7, 0xF4, 0x27,
+  0x15, 0x1C, 0xC6, 0x21, 0x04, 0x3C, 0x1D, 0x18, 0x51, 0x06, 0x10, 0x21, 0x1C, 0xC4, 0x21, 0x9D,
+  0xBA, 0xFE, 0xC2, 0x89, 0x1D, 0x18, 0x65, 0xFE, 0xBA, 0x28, 0x10, 0x21, 0x1C, 0xC2, 0x21, 0x10,
+  0x12, 0x0C, 0x18, 0x1D, 0x2B, 0x0B, 0x21, 0x1C, 0xC4, 0x21, 0x10, 0x06, 0x04, 0x18, 0x1D, 0x3C,
+  0xFE, 0xB1, 0x23, 0x21, 0x1C, 0xC6, 0x15, 0x27, 0x22, 0x00, 0xD8, 0xA5, 0xD5, 0x27, 0x15, 0x1C,
+  0xC6, 0x21, 0x15, 0xA2, 0x67, 0xFE, 0xEE, 0xDB, 0x1D, 0x2E, 0xFE, 0xD4, 0x91, 0x33, 0x26, 0x1C,
+  0xC3, 0x21, 0xC0, 0x9B, 0xDB, 0xFE, 0xDD, 0x54, 0x2E, 0x29, 0x31, 0x10, 0x21, 0x1C, 0xC4, 0x21,
+  0x10, 0x31, 0x29, 0x2E, 0x2F, 0x33, 0x21, 0xC0, 0x1C, 0xC3, 0x26, 0x33, 0x39, 0x2E, 0x1D, 0x22,
+  0x21, 0x15, 0x21, 0x1C, 0xC6, 0x15, 0x27, 0x05, 0x00, 0xD8, 0xA2, 0xB7, 0x24, 0x1C, 0xC8, 0x21,
+  0x9C, 0xCA, 0x39, 0x2E, 0x0C, 0x18, 0x08, 0xFE, 0xA8, 0xE2, 0x21, 0xC4, 0x30, 0xFE, 0xCB, 0xAE,
+  0x29, 0x0C, 0x2E, 0x03, 0x3F, 0x21, 0x1C, 0xC4, 0x21, 0x3F, 0x03, 0x2E, 0x0C, 0x29, 0x3E, 0x30,
+  0x21, 0xC4, 0x30, 0x0D, 0x18, 0x0C, 0x2E, 0x39, 0x3F, 0x21, 0x1C, 0xC8, 0x24, 0x20, 0x00, 0xD8,
+  0x7A, 0x0A, 0x24, 0x1C, 0xC7, 0x21, 0x15, 0xA2, 0x78, 0xFE, 0xEE, 0xFB, 0xA6, 0x36, 0x18, 0x0C,
+  0x3E, 0x10, 0x3F, 0xC2, 0x15, 0x23, 0x1D, 0x0C, 0x2E, 0xFE, 0xE6, 0x58, 0x15, 0x1C, 0xC8, 0x15,
+  0x3D, 0x2E, 0x0C, 0x1D, 0x23, 0x15, 0x3F, 0xC2, 0x10, 0x3E, 0x0C, 0x18, 0x29, 0x27, 0x26, 0x15,
+  0x21, 0x1C, 0xC7, 0x7E, 0x0A, 0x03, 0x00, 0xD9, 0xA8, 0xF3, 0xA4, 0xD6, 0x15, 0x1C, 0xC7, 0x21,
+  0x04, 0x3C, 0x1D, 0xC0, 0x18, 0x2E, 0x3D, 0xFE, 0xD4, 0x71, 0x99, 0xEB, 0xC0, 0xA8, 0x15, 0xFE,
+  0xEE, 0x9A, 0x2E, 0x0C, 0x29, 0x9C, 0xBA, 0x17, 0x10, 0x21, 0x1C, 0xC6, 0x21, 0x10, 0x17, 0x04,
+  0x29, 0x0C, 0x2E, 0x11, 0x00, 0x32, 0xC0, 0x34, 0x3D, 0x2E, 0x18, 0x1D, 0xC0, 0x3C, 0xFE, 0xB1,
+  0x23, 0x21, 0x1C, 0xC7, 0x15, 0x27, 0x2A, 0x98, 0x1D, 0xDA, 0xA5, 0xC5, 0x27, 0x15, 0x1C, 0xC8,
+  0x21, 0x3F, 0x0D, 0x07, 0x2E, 0x0C, 0x1D, 0x2E, 0xC2, 0x1D, 0x18, 0x2E, 0x98, 0xFC, 0x2B, 0x04,
+  0x21, 0x1C, 0xC8, 0x21, 0x04, 0x2B, 0x27, 0x2E, 0x18, 0x1D, 0x2E, 0xC0, 0x29, 0x2E, 0x1D, 0x0C,
+  0x2E, 0x07, 0x0D, 0x04, 0x21, 0x1C, 0xC8, 0x15, 0xA1, 0x98, 0x98, 0x1D, 0x00, 0xDA, 0xA1, 0x97,
+  0x15, 0x1C, 0xCA, 0x21, 0x04, 0xA8, 0x14, 0xFE, 0xDD, 0xB6, 0x1D, 0x2E, 0x29, 0xC2, 0x2E, 0x18,
+  0xFE, 0xDD, 0x34, 0x35, 0x04, 0x21, 0x1C, 0xCA, 0x21, 0x04, 0x35, 0x2A, 0x18, 0x2E, 0x29, 0xC2,
+  0x2E, 0x1D, 0xFE, 0xDD, 0x96, 0x0B, 0x04, 0x21, 0x1C, 0xCA, 0x15, 0xFE, 0x10, 0x20, 0x00, 0xDB,
+  0xFE, 0x81, 0x03, 0x24, 0x1C, 0xCA, 0x21, 0x10, 0x04, 0x2B, 0x34, 0x0C, 0x31, 0xC0, 0x9B, 0xCA,
+  0x23, 0x17, 0x3F, 0x15, 0x21, 0x1C, 0xCC, 0x21, 0x15, 0x3F, 0x17, 0x23, 0x07, 0x31, 0xC0, 0x0C,
+  0x34, 0x2B, 0x04, 0x10, 0x21, 0x1C, 0xCA, 0x24, 0x2D, 0x98, 0x0D, 0xDC, 0xA4, 0xC5, 0x27, 0x15,
+  0x1C, 0xCA, 0x21, 0xC0, 0x9D, 0xBA, 0x3F, 0x04, 0x10, 0xC0, 0x04, 0x3F, 0x10, 0x21, 0xC0, 0x1C,
+  0xCE, 0x21, 0xC0, 0x10, 0x3F, 0x04, 0x10, 0xC0, 0x04, 0x3F, 0x0B, 0x21, 0xC0, 0x1C, 0xCA, 0x15,
+  0x27, 0x33, 0x00, 0xDC, 0x03, 0x0A, 0x24, 0x1C, 0xCC, 0x21, 0xC6, 0x1C, 0xD2, 0x21, 0xC6, 0x1C,
+  0xCC, 0x24, 0x0A, 0x03, 0x00, 0xDD, 0xA6, 0xE4, 0x27, 0x15, 0x21, 0xFC, 0x15, 0x27, 0x10, 0x00,
+  0xDE, 0x0E, 0xFE, 0xA9, 0x44, 0x0B, 0xFC, 0x5A, 0x0B, 0x0D, 0x0E, 0x00, 0xDF, 0xFE, 0x82, 0x04,
+  0xFE, 0xE3, 0xA7, 0x9D, 0x8A, 0x7E, 0xFA, 0x37, 0x16, 0xFE, 0x81, 0xE4, 0x00, 0xE0, 0xA8, 0x51,
+  0xFE, 0xF5, 0xC8, 0x66, 0xFD, 0x3E, 0x00, 0xE1, 0xFE, 0x93, 0x25, 0x3B, 0x9C, 0xAC, 0x6E, 0xF8,
+  0x21, 0x3B, 0xFE, 0x8B, 0x24, 0x00, 0xE2, 0xA4, 0x74, 0xFE, 0xE5, 0x27, 0xA3, 0x76, 0x26, 0x7A,
+  0xF6, 0x26, 0x2E, 0x12, 0x1D, 0x00, 0xE3, 0xFE, 0x6A, 0x43, 0x3B, 0x21, 0x29, 0xF6, 0x21, 0x3B,
+  0xFE, 0x62, 0x23, 0x00, 0xE5, 0xFE, 0xB3, 0xA6, 0xA8, 0x62, 0x41, 0x7E, 0xF4, 0x2E, 0x05, 0x97,
+  0xAF, 0x00, 0xE6, 0xA5, 0x74, 0xFE, 0xD4, 0x27, 0xF8, 0x2C, 0x00, 0xE7, 0xFE, 0x59, 0xE3, 0xFE,
+  0xE4, 0x88, 0x24, 0xF4, 0x00, 0xFE, 0x59, 0xC3, 0xFE, 0x00, 0x00, 0xE9, 0xFE, 0x8A, 0xC5, 0xFE,
+  0xEC, 0xA8, 0x42, 0xF2, 0x08, 0x04, 0x00, 0xEB, 0xFE, 0x6A, 0x24, 0xFE, 0xB3, 0x86, 0xF2, 0xFE,
+  0x6A, 0x23, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xCB,
+};
+
+const uint8_t kAssetIcon2Data[3015] PROGMEM = {
+  0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xE0, 0xA1, 0xA7, 0xA2, 0xA7, 0xA2, 0x97, 0xA2, 0x96, 0xA0, 0xA9,
+  0x7E, 0x7A, 0xC0, 0x2D, 0x25, 0x18, 0x05, 0x2B, 0x0E, 0x00, 0xFD, 0xD3, 0xA2, 0xB7, 0xA4, 0xA5,
+  0x30, 0xA2, 0x97, 0xA1, 0x97, 0x6B, 0x15, 0xC0, 0x5A, 0xC2, 0x15, 0xC0, 0x1C, 0x15, 0x0A, 0x30,
+  0x0D, 0x20, 0x00, 0xFD, 0xCD, 0x7A, 0xA4, 0xC6, 0x30, 0x12, 0x1C, 0x12, 0x66, 0x0A, 0xCB, 0x12,
+  0x15, 0x12, 0x9E, 0x69, 0x3D, 0x03, 0x00, 0xFD, 0xC9, 0x3D, 0xA5, 0xC5, 0x15, 0x12, 0x0A, 0xD2,
+  0x12, 0x15, 0x3F, 0x3D, 0x00, 0xFD, 0xC6, 0x20, 0x30, 0x15, 0x12, 0x0A, 0xD6, 0x12, 0x15, 0x30,
+  0x20, 0x00, 0xFD, 0xC3, 0xA5, 0xE5, 0x12, 0xC0, 0x0A, 0xC9, 0x6E, 0x12, 0xC1, 0x0F, 0x0A, 0xCA,
+  0x12, 0xC0, 0x08, 0x00, 0xFD, 0xC0, 0x03, 0xA8, 0xE3, 0x1C, 0x0A, 0xC7, 0x0F, 0x7B, 0xC0, 0x12,
+  0x0A, 0x66, 0xC2, 0x0A, 0x12, 0x19, 0x12, 0x0F, 0x0A, 0xC7, 0x1C, 0x2A, 0x03, 0x00, 0xFB, 0xA1,
+  0x97, 0xA8, 0xF4, 0x1C, 0x0A, 0xC6, 0x12, 0xC0, 0x05, 0x61, 0xC0, 0xA2, 0x66, 0xA3, 0x67, 0xA3,
+  0x66, 0x6B, 0x6E, 0x55, 0x12, 0x51, 0x62, 0x6E, 0x0A, 0x12, 0xC0, 0x0A, 0xC6, 0x1C, 0x3C, 0x0B,
+  0x00, 0xF9, 0x0B, 0x3F, 0x15, 0x0A, 0xC5, 0x12, 0xC0, 0x39, 0x34, 0xA8, 0x13, 0xFE, 0xC3, 0x6C,
+  0xFE, 0xDC, 0xF2, 0xA9, 0x13, 0xA5, 0x46, 0xA4, 0x55, 0x6B, 0xC0, 0x65, 0x9C, 0xBA, 0x99, 0xDB,
+  0xFE, 0xD4, 0x6F, 0xFE, 0xC3, 0x0A, 0xFE, 0xA9, 0xA6, 0x9A, 0xDB, 0x39, 0xA3, 0x66, 0xC0, 0x0A,
+  0xC5, 0x15, 0x3F, 0x0B, 0x00, 0xF7, 0x7E, 0x3F, 0x12, 0x0A, 0xC4, 0x0F, 0x19, 0x39, 0xC0, 0xFE,
+  0xBA, 0xCA, 0xFE, 0xE5, 0x53, 0xFE, 0xFF, 0x1A, 0xA6, 0x25, 0xC0, 0x65, 0x66, 0x66, 0xC2, 0x0D,
+  0x12, 0xC0, 0x9D, 0xB9, 0x9A, 0xDB, 0xFE, 0xDC, 0xF1, 0xFE, 0xBA, 0x89, 0xFE, 0xA1, 0x03, 0x3E,
+  0x19, 0x0A, 0xC5, 0x7E, 0x9E, 0x7A, 0xFE, 0x08, 0x20, 0x00, 0xF6, 0x2D, 0x15, 0x0A, 0xC4, 0x12,
+  0x0A, 0x34, 0x28, 0xFE, 0xE5, 0xD5, 0xFE, 0xFF, 0xBC, 0x1E, 0x9D, 0xBA, 0x65, 0xCA, 0x30, 0xA2,
+  0x66, 0x61, 0xFE, 0xE5, 0x53, 0xFE, 0xB2, 0x48, 0x34, 0x0A, 0x7E, 0x0A, 0xC4, 0x15, 0x2D, 0x00,
+  0xF5, 0xA6, 0xE4, 0x1C, 0x0A, 0xC4, 0x19, 0x05, 0x0A, 0xFE, 0xD4, 0x90, 0xFE, 0xFF, 0x9C, 0x6F,
+  0x3C, 0xC1, 0x6E, 0xCA, 0x3C, 0x60, 0x66, 0x3A, 0x24, 0xFE, 0xD4, 0x2E, 0x05, 0xC0, 0x12, 0x0A,
+  0xC4, 0x1C, 0x10, 0x00, 0xF3, 0xA3, 0xB6, 0xFE, 0xB1, 0x64, 0x0A, 0xC4, 0x7F, 0x39, 0xA6, 0x35,
+  0xFE, 0xED, 0xF6, 0x1E, 0x01, 0x3C, 0x01, 0xCF, 0x30, 0x60, 0x24, 0xA4, 0x45, 0xFE, 0xE5, 0x93,
+  0xFE, 0xA9, 0x85, 0x3E, 0x12, 0x0A, 0xC4, 0x15, 0x28, 0x00, 0xF1, 0x7A, 0xFE, 0x91, 0x24, 0x12,
+  0x0A, 0xC3, 0x19, 0x39, 0xA8, 0x24, 0xFE, 0xF6, 0xB9, 0xA9, 0x03, 0x3C, 0x01, 0xD2, 0x24, 0xC0,
+  0x18, 0x3A, 0xFE, 0xEE, 0x36, 0x2F, 0x3E, 0xA2, 0x77, 0x0A, 0xC3, 0x12, 0x3F, 0xFE, 0x08, 0x00,
+  0x00, 0xF0, 0xA5, 0xE5, 0xA6, 0xD5, 0x0A, 0xC3, 0x12, 0x3E, 0x2F, 0xFE, 0xF6, 0xD9, 0xA7, 0x24,
+  0x3C, 0x01, 0xD3, 0x3C, 0x24, 0xC0, 0x18, 0xA3, 0x57, 0x98, 0xEC, 0xFE, 0xA9, 0xA5, 0x05, 0xA2,
+  0x76, 0x0A, 0xC3, 0x1C, 0x08, 0x00, 0xEF, 0xA1, 0x97, 0x0A, 0x7A, 0x0A, 0xC2, 0x0F, 0x0A, 0x0F,
+  0xFE, 0xEE, 0x37, 0xFE, 0xFF, 0xBD, 0x3C, 0x01, 0xD5, 0x3C, 0x24, 0xC0, 0x18, 0x3A, 0xFE, 0xED,
+  0xD4, 0x0A, 0xC0, 0x0F, 0x0A, 0xC2, 0x0D, 0x0A, 0x0B, 0x00, 0xEE, 0xA6, 0xD4, 0x1C, 0x0A, 0xC3,
+  0x7F, 0x34, 0xFE, 0xDC, 0xF2, 0x1E, 0x3C, 0x01, 0xD7, 0x30, 0x24, 0xC0, 0x18, 0xA5, 0x35, 0x32,
+  0x34, 0x19, 0x0A, 0xC3, 0x1C, 0x0D, 0x00, 0xED, 0x03, 0xFE, 0x99, 0x44, 0xA1, 0x97, 0x0A, 0xC2,
+  0x19, 0x39, 0xFE, 0xBB, 0x0B, 0xFE, 0xFF, 0xBC, 0x3C, 0x01, 0xD8, 0x3C, 0x24, 0xC2, 0x35, 0xFE,
+  0xBA, 0xA9, 0x39, 0xA3, 0x66, 0x56, 0xC2, 0x12, 0x07, 0x03, 0x00, 0xEC, 0xA4, 0xC5, 0x1C, 0x0A,
+  0xC2, 0x0F, 0x0A, 0xC0, 0xFE, 0xF6, 0x57, 0xFE, 0xFF, 0xBC, 0x3C, 0x01, 0xD9, 0x30, 0x24, 0xC0,
+  0x1F, 0xA3, 0x56, 0xFE, 0xED, 0xF5, 0x05, 0x0A, 0xC4, 0x1C, 0x33, 0x00, 0xEC, 0x25, 0xA4, 0xA5,
+  0x0A, 0xC2, 0x19, 0x34, 0xFE, 0xC3, 0x8D, 0x1E, 0x3C, 0x01, 0xDA, 0x3C, 0x24, 0xC1, 0x1F, 0x3A,
+  0xFE, 0xC3, 0x2B, 0x39, 0xA3, 0x66, 0x0A, 0xC2, 0x12, 0x25, 0x00, 0xEB, 0x7E, 0x07, 0x12, 0x0A,
+  0xC2, 0x0F, 0x05, 0xFE, 0xEE, 0x37, 0xFE, 0xFF, 0xBC, 0x3C, 0x01, 0xDB, 0x24, 0xC1, 0x1F, 0x35,
+  0xFE, 0xE5, 0xB4, 0x3E, 0x0F, 0x0A, 0xC2, 0x7E, 0x07, 0x08, 0x00, 0xEA, 0x28, 0xFE, 0xB1, 0x64,
+  0x0A, 0xC2, 0x12, 0x39, 0xFE, 0xBA, 0xA9, 0xFE, 0xFF, 0x9C, 0x3C, 0x6E, 0xDC, 0x30, 0x24, 0xC3,
+  0x14, 0x3E, 0x12, 0x0A, 0xC2, 0x15, 0x28, 0x00, 0xEA, 0xA5, 0xE5, 0x1C, 0x0A, 0xC2, 0x19, 0x34,
+  0xFE, 0xD4, 0x70, 0x1E, 0x3C, 0x01, 0xDC, 0x35, 0x24, 0xC1, 0x18, 0x3A, 0xFE, 0xCC, 0x0E, 0x34,
+  0x19, 0x0A, 0xC2, 0x1C, 0x08, 0x00, 0xEA, 0xA7, 0xF4, 0x15, 0x0A, 0xC2, 0x12, 0x3E, 0xFE, 0xED,
+  0xF6, 0xFE, 0xFF, 0xBC, 0x3C, 0x01, 0xDC, 0x3C, 0x24, 0xC1, 0x1F, 0x35, 0xFE, 0xE5, 0x93, 0x3E,
+  0xA2, 0x77, 0x0A, 0xC2, 0x15, 0x22, 0x00, 0xEA, 0xFE, 0x89, 0x03, 0x12, 0x0A, 0xC1, 0x0F, 0x0A,
+  0xA4, 0x56, 0xFE, 0xFE, 0xFA, 0xA5, 0x35, 0x3C, 0x01, 0xDC, 0x3C, 0x24, 0xC2, 0x29, 0x9A, 0xDC,
+  0xFE, 0xA9, 0x85, 0x0A, 0x0F, 0x0A, 0xC1, 0x12, 0x30, 0x00, 0xEA, 0x07, 0x12, 0x0A, 0xC1, 0x12,
+  0x39, 0xFE, 0xB2, 0x68, 0x01, 0xDF, 0x3C, 0x24, 0xC4, 0xFE, 0xB2, 0x27, 0x3E, 0x12, 0x0A, 0xC1,
+  0x12, 0x42, 0x00, 0xE7, 0xA6, 0x63, 0xA5, 0x64, 0xA2, 0x96, 0x0A, 0x7A, 0x0A, 0xC1, 0x12, 0x39,
+  0xFE, 0xC3, 0x0B, 0xFE, 0xFF, 0xBC, 0x3C, 0x01, 0xDE, 0x24, 0xC3, 0x29, 0xFE, 0xBA, 0xC9, 0x39,
+  0xA3, 0x66, 0x0A, 0xC1, 0x7A, 0x0A, 0x2D, 0x1A, 0x31, 0x00, 0xE1, 0x1A, 0xFE, 0x93, 0x45, 0xFE,
+  0xD4, 0xA7, 0xA5, 0x64, 0xA4, 0x64, 0x9A, 0xCE, 0x12, 0x0A, 0xC2, 0x7F, 0x34, 0xFE, 0xC3, 0x4B,
+  0xFE, 0xFF, 0xBD, 0x3C, 0x01, 0xDD, 0x3C, 0x24, 0xC2, 0x1F, 0xA3, 0x56, 0x06, 0x39, 0x12, 0x0A,
+  0xC2, 0x12, 0xFE, 0xED, 0x08, 0xA5, 0x53, 0x21, 0x9B, 0x9C, 0x1B, 0x1A, 0x00, 0xDC, 0xAA, 0x50,
+  0xFE, 0xBC, 0x26, 0x36, 0xC0, 0x56, 0x66, 0x36, 0x9A, 0xCE, 0x0F, 0x0A, 0xC2, 0x7F, 0x34, 0xFE,
+  0xC3, 0x4B, 0xFE, 0xFF, 0xBD, 0x3C, 0x01, 0xDD, 0x3C, 0x24, 0xC2, 0x1F, 0xA3, 0x56, 0xFE, 0xC3,
+  0x0B, 0x39, 0xA3, 0x66, 0x0A, 0xC2, 0x0F, 0xFE, 0xEC, 0xE8, 0x36, 0x29, 0x2E, 0x3B, 0x36, 0x14,
+  0x15, 0x00, 0xD9, 0xFE, 0x82, 0xE4, 0x36, 0xC0, 0x21, 0x36, 0xC0, 0x9D, 0x9A, 0x9C, 0x9C, 0x99,
+  0xCE, 0x0F, 0x66, 0xC2, 0x7E, 0x34, 0xFE, 0xC3, 0x2B, 0x19, 0x3C, 0x01, 0xDD, 0x3C, 0x24, 0xC2,
+  0x1F, 0x35, 0xFE, 0xBA, 0xEA, 0x39, 0xA3, 0x66, 0x0A, 0xC2, 0x0F, 0xFE, 0xBB, 0xE6, 0x3D, 0x1A,
+  0x36, 0xC0, 0x21, 0x36, 0xC0, 0x3F, 0x00, 0xD6, 0x6E, 0xFE, 0xA3, 0xA5, 0xFE, 0xFD, 0xE9, 0x21,
+  0x2E, 0xC0, 0xFE, 0xB4, 0x06, 0xFE, 0x5A, 0x03, 0x31, 0x05, 0x03, 0xFE, 0x99, 0x44, 0x12, 0x56,
+  0xC1, 0x12, 0x39, 0x32, 0xFE, 0xFF, 0x9C, 0x3C, 0x01, 0xDD, 0x3C, 0x24, 0xC3, 0x6E, 0xFE, 0xBA,
+  0x88, 0x39, 0x12, 0x0A, 0xC1, 0x12, 0x07, 0x03, 0x05, 0x31, 0x06, 0x0C, 0xFE, 0xF5, 0xA8, 0x2E,
+  0x52, 0xA5, 0x54, 0x30, 0x05, 0x00, 0xD4, 0x30, 0x07, 0x9B, 0xAC, 0x3B, 0xFE, 0xCC, 0x86, 0xFE,
+  0x41, 0x62, 0x00, 0xC3, 0xFE, 0x91, 0x24, 0x12, 0x0A, 0xC1, 0x12, 0x52, 0xA7, 0x34, 0x37, 0xA2,
+  0x67, 0x01, 0xDD, 0x61, 0x24, 0xC3, 0x51, 0xFE, 0xB1, 0xE6, 0x05, 0x12, 0x0A, 0xC1, 0x12, 0x3F,
+  0x00, 0xC3, 0x1D, 0x29, 0x3B, 0x9B, 0xAD, 0x07, 0xFE, 0xA3, 0xA5, 0x00, 0xD3, 0xFE, 0x72, 0xA4,
+  0x07, 0x1E, 0x3B, 0x30, 0xFE, 0x08, 0x20, 0x00, 0xC4, 0xFE, 0x81, 0x03, 0x12, 0x0A, 0xC3, 0x12,
+  0xFE, 0xF6, 0x98, 0x0D, 0x3C, 0x01, 0xDC, 0x24, 0xC3, 0x35, 0xFE, 0xEE, 0x15, 0x0A, 0xC4, 0x12,
+  0x2D, 0x00, 0xC4, 0x08, 0x30, 0x3B, 0x1E, 0x07, 0x2F, 0x00, 0xD1, 0xA8, 0x51, 0x2E, 0x21, 0x3B,
+  0x30, 0x00, 0xC6, 0xA6, 0xF4, 0xA5, 0xC5, 0x0A, 0xC2, 0x7F, 0x34, 0xFE, 0xE5, 0x53, 0xFE, 0xFF,
+  0xDD, 0x3C, 0x01, 0xDB, 0x3C, 0x24, 0xC2, 0x18, 0xA4, 0x46, 0xFE, 0xDC, 0xF1, 0x34, 0x12, 0x0A,
+  0xC2, 0xA1, 0x98, 0x13, 0x00, 0xC6, 0xFE, 0xA3, 0xC5, 0x3B, 0x21, 0x2E, 0x3E, 0x00, 0xD0, 0xFE,
+  0xAB, 0xC5, 0x36, 0x2E, 0x3D, 0xFE, 0x08, 0x40, 0x00, 0xC6, 0xA4, 0xC6, 0x1C, 0x0A, 0xC2, 0x19,
+  0x34, 0xFE, 0xC3, 0x8C, 0x1E, 0x3C, 0x01, 0xDB, 0x61, 0x24, 0xC2, 0x1F, 0xA4, 0x45, 0xFE, 0xC3,
+  0x2B, 0x39, 0xA3, 0x66, 0x0A, 0xC2, 0x1C, 0x99, 0x1C, 0x00, 0xC6, 0x0D, 0x3D, 0x2E, 0x36, 0x38,
+  0x00, 0xCF, 0x3E, 0x2E, 0x56, 0x36, 0xFE, 0x41, 0x82, 0x00, 0xC7, 0xA2, 0xA6, 0x12, 0x0A, 0xC2,
+  0x0F, 0x0A, 0xA4, 0x56, 0xFE, 0xFE, 0xFA, 0xA4, 0x46, 0x3C, 0x01, 0xDA, 0x24, 0xC3, 0x6E, 0x9B,
+  0xCB, 0x23, 0x0A, 0x0F, 0x0A, 0xC2, 0x12, 0x16, 0x00, 0xC7, 0xFE, 0x41, 0xA2, 0x36, 0x42, 0x2E,
+  0x3E, 0x00, 0xCE, 0xFE, 0x7A, 0xE4, 0x3B, 0x2E, 0xFE, 0xBC, 0x46, 0x00, 0xC9, 0xFE, 0x89, 0x23,
+  0x12, 0x0A, 0xC2, 0x7F, 0x34, 0xFE, 0xDC, 0xF2, 0x1E, 0x9C, 0xCA, 0x01, 0xD9, 0x30, 0x24, 0xC2,
+  0x18, 0xA4, 0x46, 0xFE, 0xD4, 0x90, 0x34, 0x19, 0x0A, 0xC2, 0x7E, 0x9E, 0x6A, 0x00, 0xC9, 0xFE,
+  0xBC, 0x46, 0x2E, 0x3B, 0xFE, 0x7A, 0xE4, 0x00, 0xCE, 0x19, 0x2E, 0x3B, 0xFE, 0x6A, 0x63, 0x00,
+  0xC9, 0xA6, 0xD4, 0x1C, 0x0A, 0xC2, 0x12, 0x51, 0xA8, 0x25, 0xFE, 0xFF, 0x5B, 0x01, 0xD9, 0x3C,
+  0x24, 0xC4, 0x18, 0x03, 0x05, 0x12, 0x0A, 0xC2, 0x1C, 0x0D, 0x00, 0xC9, 0x1B, 0x3B, 0x2E, 0x19,
+  0x00, 0xCD, 0xA3, 0x75, 0xFE, 0xE5, 0x07, 0x2E, 0xC0, 0xFE, 0x29, 0x01, 0x00, 0xC9, 0xA2, 0xA7,
+  0x12, 0x0A, 0xC3, 0x7F, 0x34, 0xFE, 0xDC, 0xD1, 0x1E, 0x3C, 0x01, 0xD7, 0x30, 0x24, 0xC2, 0x18,
+  0x3A, 0xFE, 0xD4, 0x6F, 0x34, 0x19, 0x0A, 0xC3, 0x12, 0x16, 0x00, 0xC9, 0xA8, 0x61, 0x2E, 0xC0,
+  0x9C, 0x9B, 0x15, 0x00, 0xCC, 0xA7, 0x52, 0xFE, 0xED, 0x68, 0x2E, 0x0D, 0x15, 0x00, 0xCA, 0xA8,
+  0xF3, 0x12, 0x56, 0xC2, 0x6E, 0x0A, 0xA2, 0x77, 0xFE, 0xF6, 0xB9, 0xA7, 0x24, 0x3C, 0x6E, 0xD5,
+  0x30, 0x24, 0xC2, 0x1F, 0xA3, 0x56, 0x98, 0xFC, 0x19, 0x0A, 0x0F, 0x0A, 0xC2, 0x7E, 0x2D, 0x00,
+  0xCA, 0x15, 0xFE, 0xE5, 0x07, 0xA4, 0x65, 0x26, 0x36, 0x00, 0xCC, 0xA8, 0x61, 0x2E, 0xC0, 0x9B,
+  0x9C, 0xFE, 0x08, 0x20, 0x00, 0xCA, 0xA3, 0xB6, 0xFE, 0xB1, 0x64, 0x0A, 0xC3, 0x19, 0x39, 0xFE,
+  0xBA, 0xCA, 0xFE, 0xFF, 0x9C, 0x65, 0x3C, 0x01, 0xD2, 0x6B, 0x35, 0x24, 0xC4, 0x29, 0xFE, 0xBA,
+  0x89, 0xFE, 0xA1, 0x03, 0x12, 0x0A, 0xC3, 0x15, 0x98, 0x0D, 0x00, 0xCA, 0x7E, 0xFE, 0xDC, 0xC7,
+  0x2E, 0xC0, 0xFE, 0x31, 0x01, 0x98, 0xAF, 0xCC, 0x01, 0x2E, 0xC0, 0x3D, 0xFE, 0x00, 0x20, 0x00,
+  0xCB, 0x2D, 0x12, 0x0A, 0xC3, 0x19, 0x34, 0xFE, 0xCB, 0xEE, 0xFE, 0xFF, 0xDD, 0x3C, 0xC0, 0x6E,
+  0xD0, 0x6B, 0x35, 0x24, 0xC3, 0x1F, 0x3A, 0xFE, 0xCB, 0x8C, 0x34, 0x19, 0x0A, 0xC3, 0x12, 0x2D,
+  0x00, 0xCB, 0x05, 0x3D, 0x2E, 0xC0, 0xFE, 0x31, 0x01, 0x00, 0xCC, 0x01, 0x33, 0xC0, 0x02, 0xFE,
+  0x08, 0x20, 0x00, 0xCB, 0x20, 0x12, 0x0A, 0xC4, 0x12, 0x34, 0xFE, 0xD4, 0x50, 0x1E, 0x3C, 0xC0,
+  0x6E, 0xCF, 0x30, 0x24, 0xC2, 0x1F, 0x24, 0x3A, 0xFE, 0xCC, 0x0E, 0x34, 0x12, 0x0A, 0xC4, 0x12,
+  0x20, 0x00, 0xCB, 0x08, 0x02, 0x33, 0xC0, 0xFE, 0x31, 0x01, 0x00, 0xCC, 0x3E, 0xFE, 0xED, 0x08,
+  0x65, 0x9D, 0x8B, 0x00, 0xCD, 0xA6, 0xE4, 0x1C, 0x0A, 0xC4, 0x12, 0x34, 0xFE, 0xCC, 0x0F, 0xFE,
+  0xFF, 0xBC, 0x66, 0x3C, 0x6E, 0xCC, 0x3C, 0x29, 0x24, 0xC2, 0x18, 0x29, 0x35, 0xFE, 0xCB, 0xAD,
+  0x34, 0xA4, 0x55, 0x0A, 0xC4, 0x1C, 0x10, 0x00, 0xCD, 0xFE, 0xD4, 0x67, 0x0B, 0x17, 0x3E, 0x00,
+  0xCB, 0xA5, 0xD5, 0xA5, 0xC5, 0xA2, 0x97, 0x1C, 0x21, 0x2A, 0x9B, 0x4B, 0x00, 0xCB, 0x7A, 0xFE,
+  0x91, 0x24, 0x12, 0x0A, 0xC3, 0x0F, 0x12, 0x34, 0xFE, 0xC3, 0x2B, 0xFE, 0xFF, 0x1A, 0x1E, 0x3C,
+  0xC0, 0x01, 0xC9, 0x30, 0x24, 0xC2, 0x1F, 0x24, 0x3A, 0x99, 0xEC, 0xFE, 0xBA, 0xEA, 0x34, 0xA4,
+  0x55, 0x0A, 0xC4, 0x12, 0x9E, 0x7A, 0x03, 0x00, 0xCB, 0xA4, 0xB5, 0xA5, 0xD5, 0x21, 0x1C, 0xA2,
+  0x66, 0x9D, 0x7A, 0x9A, 0x4C, 0x00, 0xC8, 0x08, 0x35, 0xA3, 0xC7, 0x5A, 0x1C, 0xC1, 0x24, 0x15,
+  0x9A, 0x3C, 0x00, 0xCB, 0x1D, 0xFE, 0xA9, 0x44, 0x0A, 0xC5, 0x19, 0x34, 0x2F, 0xFE, 0xE5, 0x53,
+  0xFE, 0xFF, 0x9C, 0x6F, 0x01, 0x3C, 0xC0, 0x01, 0xC3, 0x3C, 0x65, 0x65, 0xC1, 0x1F, 0x18, 0x24,
+  0xA3, 0x56, 0x29, 0xFE, 0xDC, 0xF1, 0xFE, 0xA9, 0xA6, 0x39, 0xA3, 0x67, 0x0A, 0xC5, 0x7A, 0x1D,
+  0x00, 0xCB, 0xA7, 0xE4, 0x27, 0x5A, 0x1C, 0xC1, 0x7A, 0x1C, 0x25, 0x03, 0x00, 0xC6, 0x2D, 0x27,
+  0x15, 0x1C, 0xC3, 0x0A, 0x1C, 0x99, 0x2C, 0x00, 0xCB, 0xA4, 0xC5, 0x15, 0x0A, 0xC5, 0x19, 0x51,
+  0x39, 0xFE, 0xBA, 0xCA, 0xFE, 0xE5, 0xB5, 0x01, 0x1E, 0x61, 0x01, 0x3C, 0x30, 0x66, 0x69, 0x18,
+  0xC1, 0x24, 0xC0, 0xA2, 0x67, 0x3A, 0x24, 0xFE, 0xE5, 0x53, 0xFE, 0xBA, 0x89, 0xFE, 0xA1, 0x03,
+  0x05, 0x19, 0x0A, 0xC5, 0x15, 0x33, 0x00, 0xCB, 0xA5, 0xE5, 0xA8, 0xD3, 0x15, 0x1C, 0xC3, 0x55,
+  0x1C, 0x9C, 0x4A, 0x00, 0xC5, 0xA3, 0xC6, 0x27, 0x15, 0x1C, 0xC4, 0x12, 0x0D, 0x0A, 0xFE, 0x10,
+  0x20, 0x00, 0xCB, 0xA5, 0xD5, 0x1C, 0x0A, 0xC5, 0x12, 0xC0, 0x39, 0xC0, 0xAA, 0x03, 0xFE, 0xD4,
+  0x2F, 0xFE, 0xED, 0xD5, 0xA8, 0x23, 0x35, 0x3A, 0xC4, 0x35, 0x13, 0x09, 0xFE, 0xD4, 0x2E, 0xFE,
+  0xB2, 0x47, 0x39, 0xC0, 0x12, 0xC0, 0x0A, 0xC5, 0xA1, 0x98, 0x05, 0x00, 0xCB, 0x0B, 0xFE, 0xB1,
+  0x64, 0x1C, 0xC5, 0x15, 0x0A, 0x15, 0x98, 0x0D, 0x00, 0xC4, 0xA8, 0xF3, 0xA4, 0xC6, 0x15, 0x1C,
+  0xC4, 0x12, 0x0A, 0x1C, 0x33, 0x00, 0xCC, 0x05, 0x1C, 0x0A, 0xC6, 0x12, 0xC0, 0x51, 0x34, 0xA2,
+  0x67, 0xA6, 0x44, 0xA8, 0x14, 0xA6, 0x45, 0xA4, 0x56, 0x32, 0xC0, 0x1C, 0x37, 0x99, 0xDC, 0x99,
+  0xEB, 0x05, 0x34, 0xA2, 0x66, 0x12, 0xC0, 0x0A, 0xC6, 0xA1, 0x98, 0x9A, 0x2B, 0x00, 0xCC, 0x05,
+  0x27, 0x15, 0x1C, 0xC4, 0x15, 0x0A, 0x15, 0x9C, 0x3B, 0x00, 0xC4, 0xFE, 0x99, 0x24, 0x24, 0x1C,
+  0xC5, 0x12, 0x0A, 0x1C, 0x9B, 0x3A, 0x00, 0xCD, 0x3D, 0x12, 0xC0, 0x0A, 0xC6, 0x12, 0x19, 0x0F,
+  0x62, 0x65, 0x34, 0xC4, 0x39, 0x05, 0x0F, 0x19, 0x12, 0x0A, 0xC6, 0x12, 0xC0, 0x3D, 0x00, 0xCD,
+  0x22, 0x27, 0x15, 0x1C, 0xC4, 0x15, 0x0A, 0x12, 0x2D, 0x00, 0xC4, 0x07, 0x24, 0x1C, 0xC5, 0x12,
+  0x0A, 0x1C, 0x10, 0x00, 0xCE, 0x28, 0x07, 0x15, 0x0A, 0xC8, 0x12, 0xC0, 0x19, 0xC4, 0x12, 0xC0,
+  0x0A, 0xC8, 0x15, 0x07, 0x28, 0x00, 0xCE, 0x22, 0x27, 0x15, 0x1C, 0xC4, 0x12, 0x0A, 0x12, 0x9E,
+  0x69, 0x00, 0xC4, 0x2D, 0x24, 0x15, 0x1C, 0xC3, 0x15, 0x0A, 0xC0, 0x1C, 0x9A, 0x1B, 0x00, 0xCF,
+  0x0B, 0x22, 0x15, 0x12, 0x0A, 0xD8, 0x12, 0x15, 0x22, 0x0B, 0x00, 0xCF, 0xA6, 0xD4, 0x27, 0x15,
+  0x1C, 0xC4, 0x55, 0x0A, 0x12, 0x22, 0x00, 0xC4, 0x02, 0x27, 0x15, 0x1C, 0xC3, 0x12, 0x0A, 0xC0,
+  0x12, 0x0E, 0x00, 0xD1, 0xA4, 0xB5, 0x3F, 0x1C, 0x12, 0x0A, 0xD4, 0x12, 0x1C, 0x3F, 0x30, 0x00,
+  0xD1, 0x1D, 0x24, 0x15, 0x1C, 0xC3, 0x12, 0x0A, 0xC0, 0x1C, 0x33, 0x00, 0xC4, 0x03, 0x07, 0x27,
+  0x15, 0x1C, 0xC0, 0x15, 0x12, 0x0A, 0xC0, 0x1C, 0x10, 0x00, 0xD3, 0x03, 0x3D, 0x3F, 0x15, 0xC0,
+  0x0D, 0x12, 0xC1, 0x0F, 0x0A, 0xC6, 0x0F, 0xC0, 0x12, 0xC0, 0x0D, 0x15, 0xC0, 0x3F, 0x02, 0x03,
+  0x00, 0xD3, 0x22, 0x27, 0x15, 0x1C, 0xC1, 0x12, 0x0A, 0xC0, 0x15, 0x35, 0x00, 0xC6, 0x16, 0x0A,
+  0x24, 0x15, 0x0D, 0x0A, 0xC0, 0x12, 0x1C, 0x2A, 0x00, 0xD7, 0x2B, 0x25, 0x0A, 0x62, 0x66, 0x05,
+  0x0A, 0xC0, 0x12, 0xC4, 0x0A, 0xC0, 0x05, 0x00, 0x05, 0x0A, 0x25, 0x30, 0x9C, 0x5B, 0xD6, 0x03,
+  0xFE, 0x89, 0x03, 0x27, 0x1C, 0x12, 0x0A, 0xC0, 0x0D, 0x1C, 0x9E, 0x79, 0x0E, 0x00, 0xC7, 0x0B,
+  0x1F, 0x0A, 0x12, 0x15, 0x12, 0x02, 0x08, 0x00, 0xDA, 0x0B, 0xFE, 0xB3, 0xC8, 0x9F, 0xC9, 0xFE,
+  0xB2, 0x46, 0x23, 0x0A, 0x05, 0x66, 0xC2, 0x05, 0x0A, 0xA2, 0x76, 0xA4, 0x45, 0xA8, 0x31, 0xA1,
+  0x46, 0x0B, 0x46, 0xDA, 0x08, 0x02, 0x12, 0x15, 0xC0, 0x0A, 0x9D, 0x4A, 0x0B, 0x00, 0xCA, 0x0B,
+  0x28, 0x7E, 0x46, 0x03, 0x00, 0xDC, 0xFE, 0xCD, 0x6A, 0xFE, 0xFF, 0x2D, 0x9B, 0xCC, 0x9D, 0xBB,
+  0x9C, 0xBB, 0x9D, 0xAA, 0x9D, 0xAB, 0x61, 0xC0, 0x1A, 0xA4, 0x55, 0x64, 0x9D, 0xB9, 0xA4, 0x55,
+  0xA4, 0x64, 0xFE, 0xC4, 0x86, 0xFE, 0x00, 0x00, 0xDC, 0x03, 0xA3, 0x96, 0x30, 0x56, 0x0B, 0x00,
+  0xEF, 0xFE, 0xC5, 0x2A, 0xFE, 0xFE, 0xCD, 0x9D, 0xAA, 0xA2, 0x76, 0x06, 0xC0, 0x6E, 0xC1, 0x06,
+  0x0B, 0x9B, 0xDB, 0x99, 0xEC, 0x5A, 0xA2, 0x86, 0xFE, 0xBC, 0x46, 0x00, 0xFD, 0xD4, 0xFE, 0xC5,
+  0x4A, 0x0B, 0x9D, 0xAB, 0x7E, 0x66, 0xC3, 0x69, 0x01, 0x9A, 0xDB, 0x9B, 0xCA, 0x26, 0x36, 0x19,
+  0x00, 0xFD, 0xD4, 0xFE, 0xC4, 0xC8, 0xAB, 0x40, 0x0B, 0x6E, 0xC5, 0x0B, 0x29, 0xC0, 0x26, 0x36,
+  0xFE, 0xC4, 0x46, 0x00, 0xFD, 0xD4, 0xFE, 0x9B, 0x65, 0xFE, 0xFD, 0xC8, 0x9B, 0xAC, 0x1A, 0xC6,
+  0x29, 0x56, 0xC0, 0xA5, 0x54, 0x23, 0x00, 0xFD, 0xD4, 0x31, 0xFE, 0xDC, 0xE7, 0x07, 0x51, 0xC8,
+  0x07, 0x05, 0x31, 0x00, 0xFD, 0xD5, 0xA4, 0x74, 0xFE, 0x7A, 0xC4, 0xA9, 0x91, 0xA2, 0xA7, 0x5A,
+  0xC4, 0x2D, 0x10, 0x37, 0x1D, 0x00, 0xFD, 0xD8, 0xFE, 0x89, 0x04, 0xA7, 0xB3, 0x42, 0x7A, 0xC2,
+  0x36, 0x06, 0x37, 0x00, 0xFD, 0xDA, 0xFE, 0x91, 0x64, 0xA6, 0xB4, 0x56, 0xC4, 0x10, 0x09, 0x00,
+  0xFD, 0xDA, 0xFE, 0x89, 0x44, 0xA6, 0xC4, 0x46, 0x7A, 0xC2, 0x00, 0x0B, 0x01, 0xFE, 0x00, 0x00,
+  0xFD, 0xDA, 0xFE, 0x89, 0x64, 0x10, 0x42, 0x08, 0xC2, 0x00, 0x10, 0x06, 0xFE, 0x00, 0x00, 0xFD,
+  0xDA, 0xFE, 0x89, 0x24, 0xA6, 0xC4, 0x46, 0x7A, 0xC2, 0x3B, 0x06, 0x01, 0x00, 0xFD, 0xDA, 0xFE,
+  0x91, 0xC5, 0xA8, 0xA2, 0x46, 0x7A, 0xC0, 0x55, 0xC0, 0x66, 0xA2, 0x87, 0x98, 0x6D, 0x00, 0xFD,
+  0xDA, 0xFE, 0xAC, 0x68, 0xFE, 0xFE, 0xED, 0x9C, 0xBB, 0x35, 0xC0, 0x98, 0xFC, 0x29, 0x21, 0xA4,
+  0x64, 0xFE, 0xA3, 0xA5, 0x00, 0xFD, 0xDA, 0x26, 0x0B, 0x2D, 0x35, 0xC0, 0x2E, 0x29, 0x21, 0x3B,
+  0x30, 0x00, 0xFD, 0xDA, 0x26, 0x0B, 0x2D, 0x35, 0xC0, 0x2E, 0x29, 0x21, 0x3B, 0x30, 0x00, 0xFD,
+  0xDA, 0x26, 0x0B, 0x2D, 0x35, 0xC0, 0x2E, 0x29, 0x21, 0x3B, 0x30, 0x00, 0xFD, 0xDA, 0x26, 0x0B,
+  0x2D, 0x35, 0xC0, 0x2E, 0x29, 0x21, 0x3B, 0x30, 0x00, 0xFD, 0xDA, 0x26, 0x0B, 0x2D, 0x35, 0xC0,
+  0x2E, 0x29, 0x21, 0x3B, 0x30, 0x00, 0xFD, 0xDA, 0x26, 0x0B, 0x2D, 0x35, 0xC0, 0x2E, 0x29, 0x21,
+  0x3B, 0x30, 0x00, 0xFD, 0xDA, 0x26, 0x0B, 0x2D, 0x35, 0xC0, 0x2E, 0x29, 0x21, 0x3B, 0x30, 0x00,
+  0xFD, 0xDA, 0x26, 0x0B, 0x2D, 0x35, 0xC0, 0x2E, 0x29, 0x21, 0x3B, 0x30, 0x00, 0xFD, 0xDA, 0x26,
+  0x0B, 0x2D, 0x35, 0xC0, 0x2E, 0x29, 0x21, 0x3B, 0x30, 0x00, 0xFD, 0xDA, 0x26, 0x0B, 0x2D, 0x35,
+  0xC0, 0x2E, 0x29, 0x21, 0x3B, 0x30, 0x00, 0xFD, 0xDA, 0x26, 0x0B, 0x2D, 0x35, 0xC0, 0x2E, 0x29,
+  0x21, 0x3B, 0x30, 0x00, 0xFD, 0xDA, 0x26, 0x0B, 0x2D, 0x35, 0xC0, 0x2E, 0x29, 0x21, 0x3B, 0x30,
+  0x00, 0xFD, 0xDA, 0x26, 0x0B, 0x2D, 0x35, 0xC0, 0x2E, 0x29, 0x21, 0x3B, 0x30, 0x00, 0xFD, 0xDA,
+  0x26, 0x0B, 0x2D, 0x35, 0xC0, 0x2E, 0x29, 0x21, 0x3B, 0x30, 0x00, 0xFD, 0xDA, 0x26, 0x0B, 0x2D,
+  0x35, 0xC0, 0x2E, 0x29, 0x21, 0x3B, 0x30, 0x00, 0xFD, 0xDA, 0x26, 0x0B, 0x2D, 0x35, 0xC0, 0x2E,
+  0x29, 0x21, 0x3B, 0x30, 0x00, 0xFD, 0xDA, 0x26, 0x0B, 0x2D, 0x35, 0xC0, 0x2E, 0x29, 0x21, 0x3B,
+  0x30, 0x00, 0xFD, 0xDA, 0x26, 0x0B, 0x2D, 0x35, 0xC0, 0x2E, 0x29, 0x21, 0x3B, 0x30, 0x00, 0xFD,
+  0xDA, 0x26, 0x0B, 0x2D, 0x35, 0x66, 0x29, 0xC0, 0x21, 0x3B, 0xFE, 0xA3, 0xA5, 0x00, 0xFD, 0xDA,
+  0xFE, 0xAC, 0x88, 0x0B, 0x2D, 0xA2, 0x77, 0x9C, 0xB9, 0x9A, 0xDC, 0x29, 0x21, 0x3B, 0x30, 0x00,
+  0xFD, 0xDA, 0xFE, 0x83, 0x66, 0xFE, 0xFF, 0x0D, 0x32, 0x76, 0x2E, 0x29, 0xC0, 0x56, 0x3B, 0xFE,
+  0x72, 0xA4, 0x00, 0xFD, 0xDA, 0xA7, 0x52, 0x2D, 0x79, 0x26, 0x1A, 0x26, 0x21, 0x2E, 0x1A, 0xFE,
+  0x18, 0xA1, 0x00, 0xFD, 0xDB, 0xFE, 0x51, 0xE3, 0xFE, 0xF5, 0x68, 0x3B, 0x66, 0xC0, 0x3B, 0x29,
+  0xFE, 0x49, 0xC2, 0x00, 0xFD, 0xDD, 0xA7, 0x62, 0xFE, 0x93, 0x65, 0xA8, 0x61, 0xC0, 0x20, 0x39,
+  0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xE3,
+};
+
+const uint8_t kAssetIcon3Data[3037] PROGMEM = {
+  0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xF0, 0xA4, 0x75, 0xFE, 0x62, 0x25, 0xA5, 0x65, 0x66, 0x98, 0xAD,
+  0x00, 0x7E, 0xFE, 0x6A, 0x66, 0xAA, 0x41, 0x7A, 0x98, 0xAD, 0xFE, 0x10, 0x81, 0x00, 0xFD, 0xD7,
+  0x24, 0xFE, 0x93, 0x28, 0xA3, 0x76, 0x56, 0xC0, 0x07, 0x96, 0xBF, 0xA9, 0x41, 0xAC, 0x40, 0x9D,
+  0xAA, 0x5A, 0xA2, 0x87, 0x99, 0xAD, 0x21, 0x00, 0xFD, 0xD6, 0x30, 0x07, 0x9D, 0x9A, 0xC0, 0x6E,
+  0x62, 0x20, 0xA6, 0x63, 0x9D, 0x9A, 0x6E, 0xC0, 0x35, 0xA4, 0x76, 0x3D, 0x00, 0xFD, 0xD5, 0xA5,
+  0x64, 0x3F, 0x30, 0xC3, 0xA7, 0x53, 0xA2, 0x87, 0xC2, 0x3A, 0x09, 0x99, 0xBD, 0x00, 0xFD, 0xD5,
+  0x1C, 0x07, 0x2B, 0x30, 0x7A, 0x2B, 0x0C, 0x04, 0xC3, 0x5A, 0xA1, 0x97, 0x98, 0xAD, 0x00, 0xFD,
+  0xD4, 0xA3, 0x76, 0x2B, 0x30, 0xC3, 0xA7, 0x63, 0x04, 0xC3, 0x56, 0xA4, 0x65, 0xFE, 0x5A, 0x25,
+  0x00, 0xFD, 0xD4, 0xFE, 0x51, 0xC4, 0x07, 0x2B, 0x6E, 0x33, 0x2B, 0x07, 0x04, 0xC3, 0x01, 0x09,
+  0x9C, 0xAB, 0xFE, 0x08, 0x40, 0x52, 0xFD, 0xD3, 0x0D, 0xFE, 0x8B, 0x08, 0xA2, 0x87, 0x30, 0xC1,
+  0x2B, 0x2D, 0x09, 0x04, 0xC2, 0x3C, 0xA4, 0x64, 0xFE, 0x52, 0x05, 0x00, 0xFD, 0xD4, 0xAB, 0x51,
+  0x07, 0x9D, 0x9A, 0x30, 0x33, 0x2B, 0xA3, 0x66, 0x09, 0x66, 0xC2, 0x01, 0x09, 0x9B, 0xAB, 0x08,
+  0x00, 0xFD, 0xD4, 0xFE, 0x82, 0xC7, 0x3F, 0x2B, 0x30, 0x33, 0x2B, 0x2D, 0x09, 0x04, 0xC2, 0x3C,
+  0x16, 0xFE, 0x49, 0xC4, 0x00, 0xFD, 0xD4, 0xA9, 0x52, 0x07, 0x2B, 0x30, 0xC0, 0x2B, 0xA3, 0x66,
+  0xA7, 0x63, 0xC3, 0x59, 0x09, 0x99, 0xBD, 0xFE, 0x00, 0x20, 0x00, 0xFD, 0xD4, 0xFE, 0x72, 0x87,
+  0xA7, 0x63, 0x30, 0xC0, 0x33, 0x2B, 0x28, 0x09, 0x04, 0xC2, 0x3C, 0xA3, 0x75, 0xFE, 0x41, 0x83,
+  0x00, 0xFD, 0xD4, 0xA6, 0x74, 0x3F, 0x2B, 0x30, 0xC0, 0x2B, 0xA3, 0x66, 0xA7, 0x63, 0xC3, 0x01,
+  0x11, 0x97, 0xBE, 0x00, 0xFD, 0xD5, 0xFE, 0x6A, 0x46, 0xA9, 0x62, 0x41, 0x30, 0x33, 0x2B, 0xA6,
+  0x64, 0x09, 0x04, 0xC2, 0x01, 0x11, 0xFE, 0x31, 0x43, 0x00, 0xFD, 0xD4, 0x24, 0x33, 0x30, 0xC2,
+  0x3F, 0x04, 0xC3, 0x3C, 0x11, 0x30, 0x00, 0xFD, 0xD5, 0xFE, 0x59, 0xE5, 0x07, 0x2B, 0x30, 0x33,
+  0x2B, 0xA6, 0x54, 0x09, 0x04, 0xC2, 0x3A, 0xA1, 0x98, 0xFE, 0x29, 0x02, 0x00, 0xFD, 0xD4, 0x1C,
+  0x2B, 0x7F, 0x30, 0xC1, 0x3F, 0x01, 0x04, 0xC2, 0x3C, 0x11, 0xFE, 0x83, 0x07, 0x00, 0xFD, 0xD5,
+  0x38, 0x07, 0x2B, 0x30, 0x33, 0x2B, 0xA6, 0x53, 0x09, 0x04, 0xC4, 0xFE, 0x20, 0xC2, 0x00, 0xFD,
+  0xD4, 0x08, 0xFE, 0x8B, 0x08, 0x3A, 0x30, 0xC1, 0x3F, 0x01, 0x04, 0xC2, 0x01, 0x11, 0xFE, 0x7A,
+  0xC7, 0x00, 0xFD, 0xD5, 0xAB, 0x40, 0x07, 0x2B, 0x30, 0x33, 0x2B, 0xA5, 0x64, 0x09, 0x04, 0xC1,
+  0x01, 0x04, 0x01, 0xFE, 0x18, 0xA1, 0x00, 0xFD, 0xD5, 0x0C, 0x3F, 0x2B, 0x30, 0xC0, 0x33, 0x35,
+  0x04, 0xC2, 0x01, 0x16, 0xFE, 0x72, 0x86, 0x00, 0xFD, 0xD5, 0xA8, 0x62, 0x3F, 0x30, 0xC0, 0x33,
+  0x2B, 0x14, 0x09, 0x04, 0xC1, 0x01, 0x04, 0x35, 0x1C, 0x00, 0xFD, 0xD5, 0x38, 0x3F, 0x30, 0xC2,
+  0x35, 0x04, 0xC2, 0x01, 0x1D, 0xFE, 0x62, 0x45, 0x00, 0xFD, 0xD5, 0xA6, 0x64, 0x3F, 0x2B, 0x30,
+  0x33, 0x2B, 0xA5, 0x54, 0x09, 0x04, 0xC1, 0x01, 0x04, 0x28, 0x0D, 0x00, 0xFD, 0xD5, 0xFE, 0x62,
+  0x26, 0x02, 0x2B, 0x30, 0xC1, 0x35, 0x04, 0xC2, 0x01, 0x1D, 0xFE, 0x5A, 0x05, 0x00, 0xFD, 0xD5,
+  0xA4, 0x65, 0x30, 0xC1, 0x33, 0x2B, 0xA4, 0x65, 0x09, 0x04, 0xC1, 0x01, 0x09, 0x19, 0xFE, 0x08,
+  0x20, 0x00, 0xFD, 0xD5, 0xFE, 0x51, 0xE5, 0x07, 0x2B, 0x30, 0xC1, 0xA7, 0x63, 0x09, 0x04, 0xC1,
+  0x3C, 0x16, 0xFE, 0x51, 0xC4, 0xFE, 0x00, 0x00, 0xFD, 0xD5, 0x0D, 0xFE, 0x8B, 0x28, 0x3A, 0x59,
+  0x33, 0x2B, 0xA4, 0x65, 0x04, 0xC2, 0x59, 0x09, 0x11, 0xFE, 0x00, 0x20, 0x00, 0xFD, 0xD5, 0xAC,
+  0x50, 0x07, 0x2B, 0x30, 0x7A, 0x2B, 0x2D, 0x09, 0x04, 0xC1, 0x3C, 0xA3, 0x75, 0xFE, 0x41, 0x84,
+  0x00, 0xFD, 0xD5, 0x05, 0xFE, 0x82, 0xE7, 0x3F, 0x2B, 0x6E, 0x2B, 0x07, 0x04, 0xC2, 0x01, 0xA1,
+  0x97, 0x3D, 0x00, 0xFD, 0xD6, 0xAA, 0x51, 0x07, 0x2B, 0x30, 0x7B, 0x2B, 0x2D, 0x09, 0x04, 0xC1,
+  0x3C, 0x11, 0x1C, 0x00, 0xFD, 0xD6, 0xFE, 0x7A, 0xA7, 0x3F, 0x30, 0x3A, 0x2B, 0x3F, 0x09, 0x04,
+  0xC1, 0x3C, 0x11, 0x96, 0xBF, 0x00, 0xF9, 0x05, 0x00, 0xC3, 0xA5, 0x55, 0x00, 0xC3, 0x05, 0x00,
+  0xCC, 0xA8, 0x52, 0x3F, 0x2B, 0x3A, 0x50, 0xA3, 0x57, 0xA6, 0x64, 0xA1, 0x96, 0x04, 0xC1, 0x01,
+  0xA2, 0x87, 0xFE, 0x31, 0x23, 0x00, 0xCA, 0x6E, 0x00, 0xC3, 0x2D, 0x00, 0xC3, 0x05, 0x00, 0xE4,
+  0xA4, 0x66, 0xFE, 0x9C, 0xF3, 0xAB, 0x33, 0xFE, 0x8C, 0x51, 0xFE, 0x08, 0x41, 0x00, 0xD0, 0xFE,
+  0x6A, 0x25, 0x3F, 0x30, 0x61, 0xFE, 0xB4, 0xB0, 0xFE, 0xEF, 0x5C, 0xC0, 0xFE, 0xCD, 0x71, 0x97,
+  0xFA, 0x04, 0x56, 0xA2, 0x85, 0xFE, 0x7A, 0xA5, 0x00, 0xCF, 0x14, 0xFE, 0x8C, 0x71, 0x34, 0x94,
+  0xEE, 0x28, 0x00, 0xE3, 0xFE, 0x42, 0x28, 0xA8, 0x44, 0xFE, 0x18, 0xC3, 0x00, 0xC0, 0x35, 0xFE,
+  0xE7, 0x1C, 0x34, 0x30, 0xFE, 0x4A, 0x69, 0x00, 0xC0, 0xA8, 0x44, 0xFE, 0x6B, 0x4D, 0x94, 0xEE,
+  0x00, 0xC9, 0x3C, 0xFE, 0x7B, 0xCE, 0x2B, 0xFE, 0x93, 0x28, 0x6E, 0x6F, 0xFE, 0xE7, 0x3C, 0xA5,
+  0x66, 0x56, 0x9C, 0xB9, 0xFE, 0xBC, 0x6B, 0x79, 0x56, 0xAA, 0x16, 0xFE, 0x8C, 0x30, 0xFE, 0x18,
+  0xC3, 0x00, 0xC9, 0x0C, 0x04, 0x10, 0x00, 0xC0, 0x39, 0xFE, 0xE7, 0x1C, 0x34, 0x30, 0xFE, 0x63,
+  0x2C, 0x00, 0xC0, 0x3C, 0x35, 0x98, 0xCC, 0x00, 0xDD, 0xFE, 0x63, 0x0C, 0xFE, 0xDE, 0xFB, 0xC0,
+  0x97, 0xDD, 0xFE, 0x10, 0x82, 0x00, 0xFE, 0x9C, 0xD3, 0xAE, 0x11, 0x9D, 0x99, 0xA4, 0x66, 0xFE,
+  0x84, 0x30, 0x00, 0x10, 0x25, 0x21, 0x66, 0xFE, 0x4A, 0x49, 0x00, 0xC7, 0xA3, 0x66, 0x08, 0xAB,
+  0x22, 0xC0, 0xFE, 0xC5, 0x74, 0xFE, 0x8A, 0xC6, 0xAB, 0x04, 0xFE, 0xF7, 0x9E, 0xC2, 0xFE, 0xC5,
+  0x0F, 0x99, 0xE9, 0xFE, 0xD5, 0xF5, 0xFE, 0xF7, 0xDF, 0x31, 0x08, 0x19, 0x00, 0xC7, 0x34, 0x1C,
+  0x21, 0x25, 0x10, 0x00, 0x05, 0x0D, 0x25, 0x08, 0x92, 0xFF, 0x00, 0x28, 0xFE, 0xBD, 0xD7, 0x21,
+  0xC0, 0x30, 0x00, 0xDB, 0x6E, 0xFE, 0xB5, 0x96, 0x08, 0x9C, 0xAA, 0x21, 0xFE, 0x52, 0x8A, 0x05,
+  0x20, 0xA3, 0x66, 0x66, 0xA2, 0x77, 0x38, 0x00, 0xFE, 0x6B, 0x6D, 0x21, 0x20, 0x0D, 0x92, 0xFF,
+  0x00, 0xC5, 0x05, 0x00, 0xFE, 0x52, 0x8A, 0x31, 0x9B, 0xBB, 0xA3, 0x66, 0x9D, 0xA9, 0xFE, 0x93,
+  0x28, 0xFE, 0xBD, 0x12, 0x29, 0x60, 0x18, 0x29, 0xFE, 0xD5, 0xB3, 0xFE, 0xBC, 0x4A, 0x3D, 0x1D,
+  0x04, 0x31, 0x08, 0x00, 0x05, 0x00, 0xC5, 0x01, 0x0D, 0x20, 0x21, 0x09, 0x00, 0x38, 0xA8, 0x44,
+  0x51, 0x39, 0x20, 0x05, 0xFE, 0x52, 0x8A, 0x21, 0x20, 0xA4, 0x66, 0x38, 0x05, 0x00, 0xDA, 0xAB,
+  0x22, 0x39, 0x34, 0xC0, 0x1C, 0xFE, 0x8C, 0x71, 0x29, 0x0D, 0x34, 0xC0, 0x39, 0x34, 0x10, 0xFE,
+  0xA5, 0x34, 0x08, 0x34, 0x39, 0x25, 0x2D, 0x00, 0xC6, 0x3C, 0x31, 0x9C, 0xAA, 0x18, 0xA2, 0x67,
+  0xFE, 0xAC, 0x4E, 0xFE, 0xCD, 0xF6, 0x31, 0x18, 0xC0, 0x29, 0xFE, 0xDE, 0x57, 0x96, 0xFA, 0x24,
+  0x18, 0x09, 0x31, 0x3C, 0x00, 0xC6, 0x2D, 0x25, 0xA2, 0x77, 0x34, 0x08, 0x15, 0xFE, 0x21, 0x04,
+  0x34, 0x39, 0x34, 0xC0, 0x0D, 0xFE, 0x29, 0x65, 0x19, 0x0D, 0x34, 0xC0, 0x39, 0xFE, 0x29, 0x45,
+  0x00, 0xDA, 0xFE, 0x73, 0xAE, 0x1C, 0x34, 0xC0, 0x08, 0x0C, 0x93, 0xEE, 0x0D, 0x34, 0x39, 0x34,
+  0x08, 0xFE, 0x84, 0x10, 0x25, 0x39, 0xC0, 0x34, 0x1C, 0xFE, 0x5A, 0xEB, 0xFE, 0x00, 0x00, 0xC5,
+  0x28, 0x94, 0xEE, 0xA5, 0x55, 0x18, 0xC0, 0xA2, 0x77, 0xFE, 0xCE, 0x17, 0xA6, 0x55, 0xA8, 0x25,
+  0x61, 0xC0, 0x6F, 0x9A, 0xCA, 0x9B, 0xCA, 0x29, 0x18, 0xC0, 0x1D, 0x30, 0x28, 0x00, 0xC5, 0x21,
+  0xFE, 0xDE, 0xDB, 0x34, 0x39, 0xC0, 0x25, 0xFE, 0x84, 0x10, 0x08, 0x34, 0x39, 0x34, 0x0D, 0x05,
+  0x0C, 0x08, 0x34, 0xC0, 0x1C, 0xFE, 0x73, 0xAE, 0xFE, 0x00, 0x00, 0xD9, 0x28, 0x20, 0x39, 0x34,
+  0x39, 0xCB, 0x34, 0x08, 0x38, 0xFE, 0x00, 0x20, 0x00, 0xC2, 0x05, 0x00, 0xFE, 0x73, 0x8E, 0x31,
+  0x09, 0x7F, 0xC8, 0x5A, 0x18, 0xC1, 0x09, 0x31, 0xFE, 0x73, 0x8E, 0x00, 0x05, 0x00, 0xC2, 0x05,
+  0x38, 0x08, 0x34, 0x39, 0xCB, 0x34, 0x39, 0x20, 0x28, 0x00, 0xD8, 0x18, 0x1C, 0x34, 0x39, 0xC1,
+  0x34, 0x39, 0xC5, 0x34, 0x39, 0xC1, 0x34, 0x1C, 0xFE, 0x5A, 0xCB, 0x00, 0xC3, 0x28, 0x30, 0xA5,
+  0x55, 0x66, 0xCE, 0x1D, 0x30, 0x28, 0x00, 0xC3, 0x1C, 0xFE, 0xDE, 0xDB, 0x34, 0x39, 0xC1, 0x34,
+  0x39, 0xC5, 0x34, 0x39, 0xC1, 0x34, 0x1C, 0xFE, 0x73, 0x8E, 0x00, 0xD7, 0xAA, 0x33, 0x39, 0x34,
+  0xC0, 0x39, 0x34, 0x39, 0xC9, 0x34, 0x39, 0x34, 0x39, 0x20, 0x2D, 0x00, 0xC0, 0x05, 0x00, 0xFE,
+  0x94, 0xB2, 0x31, 0x09, 0x7F, 0xC1, 0x1D, 0xC0, 0x18, 0xC0, 0x1D, 0xC0, 0x18, 0xC0, 0x1D, 0xC0,
+  0x18, 0xC1, 0x09, 0x31, 0x2D, 0x00, 0x05, 0x00, 0xC0, 0xA5, 0x55, 0x20, 0x39, 0x34, 0x39, 0x34,
+  0x39, 0xC9, 0x34, 0x39, 0x34, 0xC0, 0x39, 0x24, 0x00, 0xD5, 0x14, 0xFE, 0xAD, 0x75, 0x0D, 0x34,
+  0x39, 0x34, 0x9B, 0xAA, 0x0C, 0x20, 0x34, 0xC0, 0x9D, 0x99, 0xC1, 0x34, 0xC0, 0x20, 0x0C, 0xC0,
+  0x39, 0xC0, 0x34, 0x0D, 0x3C, 0x00, 0x05, 0x00, 0xFE, 0x52, 0xAA, 0x31, 0x09, 0x18, 0x1D, 0x30,
+  0x39, 0x1C, 0x04, 0x1D, 0x30, 0x9D, 0x99, 0xC0, 0x30, 0x1D, 0x04, 0x1C, 0x39, 0x30, 0x1D, 0x18,
+  0x09, 0x31, 0xFE, 0x52, 0xAA, 0x00, 0x05, 0x00, 0x3C, 0xAF, 0x00, 0x34, 0x39, 0xC0, 0x0C, 0xC0,
+  0x20, 0x34, 0xC0, 0x11, 0xC1, 0x34, 0xC0, 0x20, 0x0C, 0x3D, 0x34, 0x39, 0x34, 0x0D, 0x29, 0x14,
+  0x00, 0xD4, 0xFE, 0x94, 0x92, 0x1C, 0x34, 0x39, 0xC0, 0x20, 0x38, 0x3D, 0xC0, 0x34, 0xC0, 0x3D,
+  0xC1, 0x34, 0xC0, 0x3D, 0xC1, 0x25, 0x39, 0xC0, 0x34, 0x1C, 0xFE, 0x7B, 0xEF, 0x00, 0xAD, 0x11,
+  0x09, 0x18, 0xC2, 0x08, 0x34, 0x25, 0x1C, 0x1D, 0x1C, 0x34, 0xC0, 0x1C, 0x2C, 0x1C, 0x25, 0x34,
+  0x08, 0x18, 0xC2, 0x09, 0xFE, 0x39, 0xC7, 0x00, 0x31, 0x1C, 0x34, 0x39, 0xC0, 0x25, 0x9C, 0xAA,
+  0xC1, 0x34, 0xC0, 0x3D, 0xC1, 0x34, 0xC0, 0x3D, 0xC0, 0x38, 0x20, 0x39, 0xC0, 0x34, 0x1C, 0x28,
+  0x00, 0xD3, 0xFE, 0x84, 0x30, 0x1C, 0x34, 0x39, 0xC0, 0x34, 0x3D, 0xC1, 0x20, 0x39, 0x34, 0x3D,
+  0xC1, 0x34, 0x39, 0x11, 0x3D, 0xC0, 0x7F, 0x39, 0xC1, 0x34, 0x0D, 0x05, 0x1C, 0x2C, 0x09, 0x18,
+  0x1D, 0x30, 0x34, 0x39, 0xC0, 0x09, 0x1D, 0x9A, 0xBB, 0x34, 0xC0, 0x21, 0x1D, 0x09, 0x39, 0xC0,
+  0x34, 0x30, 0x1D, 0x18, 0x09, 0x2C, 0x1C, 0x05, 0x0D, 0x34, 0x39, 0xC1, 0x0C, 0x3D, 0xC0, 0x11,
+  0x39, 0x34, 0x3D, 0xC1, 0x34, 0x39, 0x20, 0x3D, 0xC1, 0x34, 0x39, 0xC0, 0x34, 0x1C, 0xFE, 0x8C,
+  0x51, 0x00, 0xD1, 0x05, 0x1C, 0x34, 0x39, 0xC1, 0x11, 0x3D, 0xC1, 0x34, 0x39, 0x34, 0x3D, 0xC1,
+  0x34, 0x39, 0x34, 0x3D, 0xC0, 0x38, 0x11, 0x39, 0xC0, 0x34, 0xC0, 0x1D, 0xC0, 0x09, 0x18, 0x1D,
+  0x09, 0x39, 0xC0, 0x34, 0x1C, 0x1D, 0xC0, 0x21, 0x34, 0xC0, 0x21, 0x1D, 0xC0, 0x21, 0x34, 0x39,
+  0xC0, 0x04, 0x1D, 0x18, 0x09, 0x1D, 0xC0, 0x34, 0xC0, 0x39, 0xC0, 0x11, 0x38, 0x3D, 0xC0, 0x34,
+  0x39, 0x34, 0x3D, 0xC1, 0x34, 0x39, 0x34, 0x3D, 0xC1, 0x11, 0x39, 0xC1, 0x34, 0x21, 0x14, 0x00,
+  0xCF, 0x05, 0x1C, 0x34, 0x39, 0xC1, 0x20, 0x3D, 0xC0, 0x38, 0x20, 0x39, 0xC0, 0x34, 0x3D, 0xC1,
+  0x34, 0x39, 0xC0, 0x11, 0x38, 0x3D, 0x38, 0x20, 0x39, 0xC0, 0x04, 0x18, 0x09, 0x18, 0x1D, 0x09,
+  0x08, 0x34, 0xC0, 0x39, 0x09, 0x18, 0x1D, 0x21, 0x34, 0xC0, 0x21, 0x1D, 0x18, 0xC0, 0x39, 0x34,
+  0xC0, 0x08, 0x09, 0x1D, 0x18, 0x09, 0x18, 0x04, 0x39, 0xC0, 0x20, 0x38, 0x3D, 0x38, 0x11, 0x39,
+  0xC0, 0x34, 0x3D, 0xC1, 0x34, 0x39, 0xC0, 0x20, 0x38, 0x3D, 0x38, 0x11, 0x39, 0xC1, 0x34, 0x1C,
+  0x05, 0x00, 0xCD, 0xFE, 0x84, 0x10, 0x21, 0x34, 0x39, 0xC1, 0x11, 0x3D, 0xC0, 0x38, 0x11, 0x39,
+  0xC1, 0x34, 0x3D, 0xC1, 0x34, 0x39, 0xC1, 0x0C, 0x3D, 0xC0, 0x38, 0x25, 0x09, 0x1D, 0x18, 0xC0,
+  0x1D, 0x09, 0x08, 0x34, 0x39, 0x34, 0xA7, 0x44, 0x1D, 0x18, 0x1D, 0x21, 0x34, 0xC0, 0x21, 0x1D,
+  0x18, 0x1D, 0x35, 0x34, 0x39, 0x34, 0x08, 0x09, 0x1D, 0x18, 0xC0, 0x1D, 0x09, 0x25, 0x38, 0x3D,
+  0xC0, 0x0C, 0x39, 0xC1, 0x34, 0x3D, 0xC1, 0x34, 0x39, 0xC1, 0x11, 0x38, 0x3D, 0xC0, 0x11, 0x39,
+  0xC1, 0x34, 0x21, 0x00, 0xFE, 0x00, 0x00, 0xCB, 0xFE, 0x63, 0x2C, 0x21, 0x34, 0x39, 0xC0, 0x34,
+  0x0C, 0x38, 0x3D, 0x38, 0x0C, 0x34, 0x39, 0xC1, 0x34, 0x3D, 0xC1, 0x34, 0x39, 0xC1, 0x34, 0x3D,
+  0x38, 0x0C, 0x04, 0x1D, 0x18, 0xC1, 0x9D, 0x99, 0x39, 0x34, 0x39, 0x34, 0x30, 0x1D, 0x18, 0xC0,
+  0x1D, 0x21, 0x34, 0xC0, 0x21, 0x1D, 0x18, 0xC0, 0x1D, 0x30, 0x34, 0x39, 0x34, 0x39, 0x35, 0x18,
+  0xC1, 0x1D, 0x04, 0x0C, 0x38, 0x3D, 0x34, 0x39, 0xC1, 0x34, 0x3D, 0xC1, 0x34, 0x39, 0xC1, 0x34,
+  0x0C, 0x38, 0x3D, 0x38, 0x0C, 0x34, 0x39, 0xC0, 0x34, 0x21, 0xFE, 0x63, 0x2C, 0x00, 0xC9, 0xAC,
+  0x22, 0x0D, 0x34, 0xC0, 0x39, 0xC0, 0x34, 0x3D, 0xC0, 0x66, 0x0C, 0x34, 0x39, 0xC2, 0x34, 0x3D,
+  0xC1, 0x34, 0x39, 0xC2, 0x34, 0x3D, 0x21, 0x1D, 0x18, 0xC1, 0x1D, 0x30, 0x34, 0x39, 0x34, 0x30,
+  0x1D, 0x18, 0xC1, 0x1D, 0x21, 0x34, 0xC0, 0x21, 0x1D, 0x18, 0xC1, 0x1D, 0x30, 0x34, 0x39, 0x34,
+  0x30, 0x1D, 0x18, 0xC1, 0x1D, 0x21, 0x3D, 0x34, 0x39, 0xC2, 0x34, 0x3D, 0xC1, 0x34, 0x39, 0xC2,
+  0x34, 0x0C, 0x38, 0x3D, 0xC0, 0x34, 0x39, 0xC0, 0x34, 0xC0, 0x0D, 0xFE, 0x31, 0x86, 0x00, 0xC7,
+  0x6E, 0xFE, 0xA5, 0x34, 0x0D, 0x34, 0x39, 0xC2, 0x25, 0x3D, 0x11, 0x39, 0xC4, 0x34, 0x3D, 0xC1,
+  0x34, 0x39, 0xC2, 0x34, 0x08, 0x18, 0xC4, 0x1D, 0x1C, 0x39, 0xA6, 0x55, 0x1D, 0x18, 0xC2, 0x1D,
+  0x21, 0x34, 0xC0, 0x21, 0x1D, 0x18, 0xC2, 0x1D, 0x35, 0x39, 0x1C, 0x1D, 0x18, 0xC4, 0x08, 0x34,
+  0x39, 0xC2, 0x34, 0x3D, 0xC1, 0x34, 0x39, 0xC4, 0x11, 0x3D, 0x25, 0x39, 0xC2, 0x34, 0x0D, 0x15,
+  0x05, 0x00, 0xC6, 0xFE, 0x42, 0x28, 0x1C, 0x34, 0x39, 0xC4, 0x51, 0x39, 0xC5, 0x34, 0x11, 0xC1,
+  0x34, 0x39, 0xC2, 0x34, 0x30, 0x1D, 0x18, 0xC4, 0x09, 0xC0, 0x1D, 0x18, 0xC3, 0x1D, 0x35, 0x0D,
+  0xC0, 0x35, 0x1D, 0x18, 0xC3, 0x1D, 0x09, 0xC0, 0x18, 0xC4, 0x1D, 0x30, 0x34, 0x39, 0xC2, 0x34,
+  0x11, 0xC1, 0x34, 0x39, 0xC5, 0x25, 0x39, 0xC4, 0x34, 0x1C, 0xFE, 0x42, 0x28, 0x00, 0xC6, 0x01,
+  0x0D, 0x34, 0x39, 0xD4, 0x34, 0x39, 0x18, 0xD0, 0x1D, 0xC0, 0x18, 0xD0, 0x39, 0x34, 0x39, 0xD4,
+  0x34, 0x0D, 0x01, 0x00, 0xC5, 0x10, 0x39, 0x34, 0x39, 0xD5, 0x34, 0x1C, 0x1D, 0x18, 0xE2, 0x1D,
+  0x1C, 0x34, 0x39, 0xD5, 0x34, 0x39, 0x10, 0x00, 0xC4, 0xFE, 0x52, 0xAA, 0x1C, 0x34, 0x39, 0xD5,
+  0x34, 0x35, 0x1D, 0x18, 0xE2, 0x1D, 0x35, 0x34, 0x39, 0xD5, 0x34, 0x1C, 0x0D, 0x00, 0xC4, 0xFE,
+  0x84, 0x10, 0x1C, 0x34, 0x39, 0xD6, 0x09, 0x18, 0xE4, 0x09, 0x39, 0xD6, 0x34, 0x1C, 0x31, 0xFE,
+  0x00, 0x00, 0xC4, 0x3C, 0xAF, 0x00, 0x34, 0x39, 0xD4, 0x34, 0x39, 0x09, 0x18, 0xE4, 0x09, 0x39,
+  0x34, 0x39, 0xD4, 0x34, 0x0D, 0x3C, 0x00, 0xC4, 0xFE, 0xAD, 0x55, 0x0D, 0x34, 0x39, 0xD4, 0x34,
+  0x0D, 0x18, 0xE6, 0x08, 0x34, 0x39, 0xD4, 0x34, 0x0D, 0x24, 0x00, 0xC4, 0x29, 0x08, 0x34, 0x39,
+  0xD4, 0x34, 0x0D, 0x1D, 0x18, 0xE4, 0x1D, 0x0D, 0x34, 0x39, 0xD4, 0x34, 0x08, 0x29, 0x00, 0xC4,
+  0x15, 0x0D, 0x34, 0x39, 0xD4, 0x34, 0x39, 0x18, 0xE6, 0x39, 0x34, 0x39, 0xD4, 0x34, 0x0D, 0x15,
+  0x00, 0xC4, 0x28, 0x1C, 0x34, 0x39, 0xD6, 0x09, 0x18, 0xE4, 0x09, 0x39, 0xD6, 0x34, 0x1C, 0x28,
+  0x00, 0xC4, 0xFE, 0x73, 0x8E, 0x1C, 0x34, 0x39, 0xD5, 0x34, 0x04, 0x1D, 0x66, 0xE2, 0x1D, 0x04,
+  0x34, 0x39, 0xD5, 0x34, 0x1C, 0xFE, 0x6B, 0x6D, 0x00, 0xC4, 0xAF, 0x00, 0x0D, 0x34, 0x39, 0xD5,
+  0x34, 0x30, 0x1D, 0x18, 0xE2, 0x1D, 0x30, 0x34, 0x39, 0xD5, 0x34, 0x0D, 0x11, 0x00, 0xC4, 0xA3,
+  0x66, 0xFE, 0xBD, 0xF7, 0x08, 0x34, 0x39, 0xD4, 0x34, 0x0D, 0x1D, 0x18, 0xE2, 0x1D, 0x0D, 0x34,
+  0x39, 0xD4, 0x34, 0x08, 0x11, 0x19, 0x00, 0xC5, 0x31, 0x1C, 0x34, 0x39, 0xD5, 0x34, 0xA9, 0x33,
+  0x18, 0xE2, 0x04, 0x34, 0x39, 0xD5, 0x34, 0x1C, 0x31, 0x00, 0xC6, 0x10, 0x39, 0xC0, 0x34, 0x39,
+  0xD4, 0x34, 0x1C, 0x1D, 0x18, 0xE0, 0x1D, 0x1C, 0x34, 0x39, 0xD4, 0x34, 0x39, 0xC0, 0x10, 0x00,
+  0xC7, 0xFE, 0x73, 0xAE, 0x21, 0x34, 0x39, 0xD5, 0x34, 0x04, 0xA3, 0x66, 0x18, 0xDE, 0x1D, 0x04,
+  0x34, 0x39, 0xD5, 0x34, 0x21, 0xFE, 0x73, 0xAE, 0x00, 0xC8, 0x19, 0xFE, 0xB5, 0x96, 0x0D, 0x34,
+  0x39, 0xD4, 0x34, 0x08, 0x18, 0xE0, 0x08, 0x34, 0x39, 0xD4, 0x34, 0x08, 0x38, 0x19, 0x00, 0xC9,
+  0xAA, 0x33, 0x34, 0x39, 0x34, 0x39, 0xD4, 0x51, 0x1C, 0xA7, 0x44, 0x18, 0xDC, 0x1D, 0x1C, 0x25,
+  0x39, 0xD4, 0x34, 0x39, 0x34, 0x24, 0x00, 0xCB, 0xFE, 0x42, 0x28, 0x0D, 0x34, 0xC0, 0x39, 0xD4,
+  0x34, 0x30, 0x1D, 0x18, 0xDA, 0x1D, 0x30, 0x34, 0x39, 0xD4, 0x34, 0xC0, 0x0D, 0x25, 0x00, 0xCD,
+  0xFE, 0x5A, 0xEB, 0x1C, 0x34, 0x39, 0xD5, 0x34, 0x35, 0x1D, 0x18, 0xD8, 0x1D, 0x35, 0x34, 0x39,
+  0xD5, 0x34, 0x1C, 0x21, 0x00, 0xCF, 0xFE, 0x7B, 0xCF, 0xFE, 0xDE, 0xFB, 0x34, 0x39, 0xD5, 0x34,
+  0x04, 0x1D, 0x18, 0xD6, 0x1D, 0x04, 0x34, 0x39, 0xD5, 0x34, 0x21, 0x2C, 0x00, 0xD1, 0x28, 0x1C,
+  0x34, 0x39, 0xD4, 0x34, 0x39, 0x09, 0x18, 0xD6, 0x09, 0x39, 0x34, 0x39, 0xD4, 0x34, 0x1C, 0x28,
+  0x00, 0xD2, 0xA2, 0x77, 0xFE, 0xAD, 0x55, 0x0D, 0x34, 0x39, 0xD4, 0x34, 0x08, 0x18, 0xD6, 0x08,
+  0x34, 0x39, 0xD4, 0x34, 0x0D, 0x24, 0x14, 0x00, 0xD3, 0xA6, 0x55, 0x0C, 0x39, 0x34, 0x39, 0xD4,
+  0x34, 0x0D, 0x18, 0xD4, 0x0D, 0x34, 0x39, 0xD4, 0x34, 0x39, 0x0C, 0x3C, 0x00, 0xCC, 0xFE, 0x81,
+  0x03, 0xA2, 0x97, 0xC0, 0xA3, 0x76, 0x7A, 0xC1, 0x6E, 0x52, 0xA5, 0x65, 0xA5, 0x55, 0x66, 0xD6,
+  0x56, 0xA2, 0x77, 0xD4, 0x2E, 0x36, 0xD6, 0x3B, 0x0E, 0x1E, 0x2B, 0x26, 0xC1, 0x23, 0x07, 0xC0,
+  0x9E, 0x69, 0x00, 0xC4, 0x2D, 0xA4, 0xC6, 0x56, 0x6E, 0xA2, 0x86, 0x6B, 0x7E, 0xC1, 0x34, 0x66,
+  0xC6, 0x7E, 0xF8, 0x2F, 0xC6, 0x34, 0x03, 0xC1, 0x3B, 0x34, 0x24, 0x1F, 0x27, 0x2D, 0x00, 0xC4,
+  0xA4, 0xC6, 0x27, 0x9F, 0x68, 0x7B, 0x69, 0xC3, 0x1C, 0xC6, 0x6E, 0xC0, 0x7E, 0xA2, 0x87, 0x7E,
+  0xF2, 0x00, 0x29, 0x21, 0xC0, 0x1C, 0xC6, 0x15, 0xC3, 0x1C, 0x12, 0x27, 0x3A, 0x9C, 0x4A, 0xC5,
+  0xFE, 0x91, 0x24, 0x27, 0x12, 0x1C, 0xCD, 0x15, 0xC0, 0x24, 0xA3, 0x76, 0x08, 0x03, 0xEC, 0x08,
+  0x00, 0x24, 0x15, 0xC0, 0x1C, 0xCD, 0x12, 0x27, 0x3F, 0xFE, 0x00, 0x00, 0xC6, 0xA2, 0x96, 0xFE,
+  0xA1, 0x44, 0x27, 0x1C, 0xC0, 0x15, 0xCA, 0x1C, 0xC1, 0x15, 0x21, 0x3B, 0x08, 0x03, 0xEA, 0x08,
+  0x3B, 0x21, 0x15, 0x1C, 0xC1, 0x15, 0xCA, 0x1C, 0xC0, 0x27, 0x0A, 0x13, 0x00, 0xC7, 0xA1, 0x97,
+  0xA6, 0xF5, 0x15, 0x24, 0x27, 0xCB, 0x24, 0x15, 0x1C, 0xC1, 0x3B, 0x08, 0x03, 0xE8, 0x08, 0x3B,
+  0x1C, 0xC1, 0x15, 0x24, 0x27, 0xCB, 0x24, 0x15, 0x25, 0x0B, 0x00, 0xCA, 0x0B, 0xA2, 0xB7, 0x7E,
+  0xC8, 0x7B, 0xA2, 0x86, 0x2A, 0xA3, 0xA6, 0x27, 0x24, 0x15, 0x1C, 0xC0, 0x3B, 0x08, 0x03, 0xE6,
+  0x08, 0x3B, 0x1C, 0xC1, 0x24, 0x27, 0x9E, 0x79, 0x2A, 0x9E, 0x69, 0x3D, 0x33, 0xC8, 0x2B, 0x0B,
+  0x00, 0xDB, 0x7E, 0x3D, 0x07, 0x27, 0x1C, 0xC1, 0x3B, 0xA2, 0x76, 0x03, 0xE4, 0x08, 0x3B, 0x1C,
+  0xC1, 0x27, 0x0A, 0x3D, 0x9D, 0x39, 0x00, 0xEC, 0x7A, 0xA7, 0xD4, 0x24, 0x1C, 0xC1, 0x3B, 0xA2,
+  0x76, 0x66, 0xE2, 0x08, 0x3B, 0x1C, 0xC1, 0x24, 0x1F, 0x99, 0x3C, 0x00, 0xF0, 0xA5, 0xD5, 0x24,
+  0x1C, 0xC1, 0x3B, 0x08, 0x66, 0xE0, 0x08, 0x3B, 0x1C, 0xC1, 0x27, 0x05, 0x00, 0xF3, 0x05, 0x27,
+  0x1C, 0xC1, 0x3B, 0x08, 0x03, 0xDE, 0x08, 0x3B, 0x1C, 0xC1, 0x27, 0x05, 0x00, 0xF5, 0x05, 0x27,
+  0x1C, 0xC1, 0x3B, 0x08, 0x03, 0xDC, 0x08, 0x3B, 0x1C, 0xC1, 0x27, 0x05, 0x00, 0xF7, 0x05, 0x27,
+  0x1C, 0xC1, 0x3B, 0x08, 0xC0, 0x03, 0xD8, 0x08, 0xC0, 0x3B, 0x1C, 0xC1, 0x27, 0x05, 0x00, 0xF9,
+  0xA5, 0xC5, 0x27, 0x1C, 0xC1, 0xA2, 0x86, 0xA2, 0x77, 0x03, 0xD8, 0x00, 0x2C, 0x1C, 0xC1, 0x27,
+  0x05, 0x9B, 0x3B, 0xFB, 0x05, 0x27, 0x1C, 0xC0, 0x15, 0x1C, 0x24, 0xD8, 0x1C, 0x15, 0x1C, 0xC0,
+  0x27, 0x05, 0x00, 0xFD, 0x05, 0x27, 0x15, 0x1C, 0xC1, 0x15, 0xD6, 0x1C, 0xC1, 0x15, 0x27, 0x05,
+  0x00, 0xFD, 0xC1, 0x05, 0x27, 0x1C, 0x15, 0x1C, 0xD8, 0x15, 0x1C, 0x27, 0x05, 0x00, 0xFD, 0xC3,
+  0x3D, 0x15, 0x27, 0x24, 0xD8, 0x27, 0x15, 0x3D, 0x00, 0xFD, 0xC5, 0xA1, 0xA7, 0xA5, 0xC5, 0xA3,
+  0xA6, 0x07, 0xD6, 0x35, 0x10, 0x0E, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xD7,
+};
+
+const uint8_t kAssetIcon4Data[4545] PROGMEM = {
+  0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xDE, 0xA1, 0xA7, 0xA2, 0x97, 0xA1, 0xA8, 0xA2, 0x86, 0xA1, 0x98,
+  0xA1, 0x97, 0x7A, 0x7A, 0xC2, 0x2D, 0x2A, 0x1F, 0x0D, 0x3D, 0x28, 0x0E, 0x00, 0xFD, 0xCE, 0xA2,
+  0xA6, 0xA3, 0xA7, 0xA2, 0xB7, 0xA2, 0xA7, 0xA1, 0x97, 0x7E, 0x7B, 0xC0, 0x69, 0xC0, 0x12, 0xC4,
+  0x15, 0xC0, 0x1C, 0xC0, 0x12, 0x0A, 0x45, 0x22, 0x02, 0x9D, 0x6A, 0x00, 0xFD, 0xC7, 0xA2, 0xB7,
+  0xA4, 0xB5, 0x38, 0x12, 0x1C, 0x15, 0x12, 0x66, 0x0A, 0xCE, 0x0D, 0x12, 0x15, 0x1C, 0x12, 0x38,
+  0x10, 0x20, 0x00, 0xFD, 0xC1, 0xA1, 0x97, 0xA4, 0xC6, 0xA4, 0xB5, 0x12, 0x15, 0x12, 0x0A, 0xD8,
+  0x12, 0x15, 0x12, 0x9E, 0x6A, 0x05, 0x0B, 0x00, 0xFA, 0x16, 0xA4, 0xD6, 0x0A, 0x1C, 0x12, 0x0A,
+  0xDE, 0x12, 0x1C, 0x0A, 0x9C, 0x5B, 0x16, 0x00, 0xF6, 0xA2, 0x96, 0x1A, 0x0D, 0x15, 0x0D, 0x0A,
+  0xE2, 0x0D, 0x15, 0x0D, 0x1F, 0x0E, 0x00, 0xF2, 0x7A, 0xA6, 0xC4, 0x0A, 0x15, 0x0A, 0xE8, 0x15,
+  0x0A, 0x0D, 0x03, 0x00, 0xEF, 0xA3, 0xC6, 0x3F, 0x1C, 0x0A, 0xCE, 0x6E, 0x12, 0x0F, 0x0A, 0xC6,
+  0x0F, 0x12, 0x0F, 0x0A, 0xCE, 0x1C, 0x3F, 0x2B, 0x00, 0xEC, 0x03, 0x1F, 0x15, 0x12, 0x0A, 0xCB,
+  0x0F, 0x7B, 0xC0, 0x12, 0x0A, 0x61, 0x0A, 0x0F, 0x0A, 0xC4, 0x0F, 0x0A, 0x39, 0x0A, 0x12, 0x19,
+  0xC0, 0x0F, 0x0A, 0xCB, 0x12, 0x15, 0x1F, 0x03, 0x00, 0xE9, 0x20, 0x3F, 0x1C, 0x0A, 0xCA, 0x0F,
+  0x19, 0x12, 0x52, 0x61, 0x69, 0x39, 0xA5, 0x45, 0xA6, 0x36, 0x9B, 0xCA, 0x0A, 0x0F, 0x0A, 0xC2,
+  0x0F, 0x0A, 0x2F, 0x20, 0x23, 0x9C, 0xBA, 0x2D, 0x34, 0x05, 0x12, 0x19, 0x0F, 0x0A, 0xCA, 0x1C,
+  0x3F, 0x99, 0x2C, 0x00, 0xE7, 0x3D, 0xA6, 0xE4, 0x12, 0x0A, 0xC9, 0x12, 0x19, 0x05, 0x2D, 0x39,
+  0xA7, 0x25, 0xFE, 0xC3, 0x6D, 0xFE, 0xD5, 0x13, 0xAA, 0x14, 0xA8, 0x14, 0xA5, 0x45, 0xFE, 0xC3,
+  0x8D, 0x2D, 0x19, 0x0A, 0xC2, 0x19, 0x2D, 0x2F, 0x31, 0x07, 0x99, 0xEB, 0xFE, 0xD4, 0xF3, 0x2A,
+  0x3B, 0x39, 0x2D, 0xA2, 0x68, 0x19, 0x12, 0x0A, 0xC9, 0x12, 0x0D, 0x3D, 0x9C, 0x3A, 0xE5, 0x10,
+  0x15, 0x0A, 0xC9, 0x12, 0xC0, 0x39, 0x2D, 0xA8, 0x14, 0xFE, 0xCB, 0xEF, 0xFE, 0xE6, 0x18, 0xFE,
+  0xFF, 0x9E, 0x31, 0xC3, 0x2A, 0xFE, 0xA0, 0xE3, 0x19, 0x0A, 0xC2, 0x19, 0x34, 0x2A, 0x31, 0xC3,
+  0x1B, 0xFE, 0xE6, 0x17, 0x0F, 0xFE, 0xA9, 0xE6, 0x2D, 0x39, 0x19, 0x12, 0x0A, 0xC9, 0x15, 0x10,
+  0x00, 0xE3, 0x22, 0x1C, 0x0A, 0xC8, 0x12, 0x19, 0x39, 0xC0, 0xFE, 0xBA, 0xAA, 0xFE, 0xDD, 0x75,
+  0xFE, 0xFF, 0x9D, 0x31, 0xC4, 0x66, 0x31, 0x2A, 0xFE, 0xA0, 0xE3, 0x19, 0x0A, 0xC2, 0x19, 0x34,
+  0x2A, 0x31, 0x2C, 0x31, 0xC4, 0x9C, 0xCA, 0xFE, 0xDD, 0x55, 0xFE, 0xB2, 0x89, 0x39, 0xC0, 0x19,
+  0x12, 0x0A, 0xC8, 0x1C, 0x22, 0x00, 0xE1, 0xFE, 0x78, 0xE3, 0x1C, 0x0A, 0xC8, 0x19, 0x3E, 0x34,
+  0xFE, 0xBA, 0xCA, 0xFE, 0xE5, 0xF7, 0x31, 0xC9, 0x2A, 0x34, 0x19, 0x0A, 0xC2, 0x19, 0x34, 0x2A,
+  0x31, 0xC9, 0xFE, 0xDD, 0xB6, 0xFE, 0xB2, 0x89, 0x34, 0x05, 0x19, 0x0A, 0xC8, 0x1C, 0x9C, 0x5A,
+  0x00, 0xDF, 0x25, 0x1C, 0x0A, 0xC7, 0x12, 0x5A, 0x2D, 0xAA, 0x04, 0xFE, 0xE5, 0xB6, 0x31, 0xCB,
+  0x2A, 0x34, 0x19, 0x0A, 0xC2, 0x19, 0x34, 0x2A, 0x31, 0xCA, 0x2C, 0xFE, 0xD5, 0x54, 0xFE, 0xAA,
+  0x07, 0x2D, 0xA4, 0x46, 0x12, 0x0A, 0xC7, 0x1C, 0x25, 0x99, 0x0C, 0xDD, 0x22, 0x1C, 0x0A, 0xC7,
+  0x19, 0x3E, 0xC0, 0xFE, 0xCC, 0x50, 0xFE, 0xFF, 0xBE, 0x31, 0xCC, 0x2F, 0xFE, 0xA1, 0x03, 0xA4,
+  0x56, 0x19, 0xC2, 0x1E, 0x39, 0x2F, 0x31, 0xCC, 0x9B, 0xBB, 0xFE, 0xC3, 0xEF, 0x39, 0x05, 0x19,
+  0x0A, 0xC7, 0x1C, 0x22, 0x00, 0xDB, 0xA6, 0xD4, 0x1C, 0x0A, 0xC7, 0x19, 0x2D, 0xA9, 0x14, 0xFE,
+  0xEE, 0x38, 0x31, 0xCE, 0xFE, 0xC3, 0x2C, 0xFE, 0x98, 0x81, 0x39, 0x66, 0xC2, 0x39, 0x14, 0x19,
+  0x31, 0xCD, 0x5A, 0xFE, 0xDD, 0xF7, 0xFE, 0xA9, 0xE6, 0x98, 0xFD, 0xA4, 0x56, 0x0A, 0xC7, 0x1C,
+  0x0D, 0x00, 0xD9, 0xA4, 0xC5, 0x1C, 0x0A, 0xC6, 0x0F, 0x19, 0x9B, 0xCA, 0xFE, 0xC3, 0x4C, 0xFE,
+  0xFF, 0x7D, 0x31, 0x66, 0x31, 0xCD, 0xFE, 0xEE, 0x9A, 0x9A, 0xDA, 0x6F, 0xC4, 0x14, 0x11, 0x31,
+  0xCD, 0x61, 0x2E, 0x9A, 0xDB, 0xFE, 0xBA, 0xEB, 0x2D, 0x19, 0x0A, 0xC7, 0x1C, 0x33, 0x00, 0xD7,
+  0xA2, 0xA7, 0xFE, 0xA9, 0x44, 0x0A, 0xC6, 0x6E, 0x12, 0x2D, 0x25, 0x31, 0xEB, 0x20, 0x5A, 0x6F,
+  0x0C, 0x2D, 0x12, 0x0F, 0x0A, 0xC6, 0x0D, 0x98, 0x0D, 0x00, 0xD5, 0x7A, 0x3F, 0x12, 0x0A, 0xC5,
+  0x0F, 0x0A, 0x39, 0x16, 0x31, 0xC9, 0xFE, 0xDD, 0x54, 0xFE, 0xB2, 0x48, 0x07, 0x31, 0xD4, 0x2C,
+  0x31, 0xFE, 0xD4, 0x91, 0xFE, 0xBA, 0x89, 0xFE, 0xF7, 0x3C, 0x31, 0xC4, 0x1D, 0x66, 0x2E, 0xFE,
+  0xCC, 0x91, 0x34, 0x0F, 0xC0, 0x0A, 0xC5, 0x12, 0x3F, 0x03, 0x00, 0xD4, 0x1F, 0x1C, 0x0A, 0xC5,
+  0x0F, 0xC0, 0x34, 0xFE, 0xDD, 0x34, 0x31, 0xC8, 0x61, 0xFE, 0xCB, 0xEF, 0xFE, 0xA1, 0x03, 0x61,
+  0xFE, 0xBA, 0xEA, 0x2C, 0x31, 0xD2, 0x2C, 0x31, 0x2F, 0x39, 0x34, 0xA6, 0x35, 0xFE, 0xE5, 0xD7,
+  0x31, 0xC4, 0x1D, 0x61, 0x31, 0xFE, 0xD4, 0xB2, 0x34, 0x12, 0x5A, 0x0A, 0xC5, 0x1C, 0x1F, 0x00,
+  0xD3, 0xA3, 0xB6, 0x15, 0x0A, 0xC6, 0x12, 0x2D, 0x16, 0x31, 0x2C, 0x31, 0xC6, 0x97, 0xFC, 0xFE,
+  0xB2, 0x69, 0x2D, 0x19, 0x6E, 0x9A, 0xDB, 0xFE, 0xCC, 0x0F, 0x31, 0x2C, 0x31, 0xCF, 0x2C, 0x31,
+  0xFE, 0xE5, 0xD7, 0x39, 0x0A, 0x19, 0x51, 0x39, 0x25, 0x31, 0xC4, 0x18, 0x0C, 0x31, 0x36, 0x2D,
+  0x19, 0x0A, 0xC6, 0x15, 0x98, 0x0D, 0x00, 0xD1, 0x03, 0x3F, 0x12, 0x0A, 0xC5, 0x19, 0x9B, 0xCA,
+  0xFE, 0xCC, 0x51, 0x31, 0x66, 0x31, 0xC6, 0xFE, 0xDD, 0x75, 0x19, 0x39, 0x19, 0x0A, 0xC0, 0x19,
+  0x2D, 0x2F, 0x31, 0xD1, 0xFE, 0xEE, 0x79, 0x0A, 0xC0, 0x12, 0x0A, 0x12, 0xC0, 0x28, 0xFE, 0xBA,
+  0xCA, 0xFE, 0xF7, 0x1C, 0x31, 0xC3, 0x18, 0xC0, 0x2E, 0xFE, 0xC3, 0xEF, 0x2D, 0x19, 0x0A, 0xC5,
+  0x12, 0x3F, 0x03, 0x00, 0xD0, 0xA6, 0xD4, 0x1C, 0x0A, 0xC5, 0x19, 0x2D, 0xFE, 0xC3, 0x4C, 0x31,
+  0xC8, 0x16, 0xFE, 0x98, 0xA1, 0x0F, 0x7B, 0x0A, 0xC1, 0x0F, 0x0A, 0x66, 0xFE, 0xEE, 0x79, 0x31,
+  0xCF, 0xFE, 0xF6, 0xDB, 0xFE, 0xA9, 0x85, 0x9D, 0xAA, 0x19, 0x0A, 0xC2, 0x1E, 0x34, 0x2A, 0x07,
+  0x31, 0xC2, 0x2C, 0x18, 0xC0, 0x29, 0xFE, 0xBA, 0xEB, 0x34, 0x19, 0x0A, 0xC5, 0x1C, 0x0D, 0x00,
+  0xCF, 0x0E, 0x0A, 0xC6, 0x12, 0x51, 0xA7, 0x35, 0xFE, 0xFF, 0x9E, 0x31, 0xC8, 0x36, 0x03, 0x3E,
+  0x19, 0x0A, 0xC2, 0x12, 0x3E, 0xA6, 0x35, 0x07, 0x31, 0xCD, 0x9A, 0xDB, 0xFE, 0xA9, 0xE7, 0x99,
+  0xEB, 0x19, 0x0A, 0xC3, 0x12, 0x9C, 0xBB, 0xFE, 0xD4, 0xD2, 0x31, 0xC4, 0x1D, 0x61, 0x1D, 0x38,
+  0x3B, 0x3E, 0x12, 0x56, 0xC6, 0x0E, 0x00, 0xCE, 0x1F, 0x1C, 0x0A, 0xC5, 0x0F, 0x3E, 0xFE, 0xEE,
+  0x79, 0x31, 0xCA, 0xFE, 0xEE, 0xBA, 0x19, 0x0A, 0x12, 0x0A, 0xC2, 0x19, 0x34, 0xFE, 0xBA, 0xCA,
+  0x2C, 0x31, 0xCB, 0x1B, 0x20, 0xFE, 0xA1, 0x03, 0x19, 0x0A, 0xC3, 0x19, 0x28, 0xFE, 0xD4, 0x71,
+  0x31, 0xC5, 0x2C, 0x18, 0x0C, 0x2E, 0xFE, 0xDD, 0xF7, 0x39, 0x0F, 0x0A, 0xC5, 0x1C, 0x9C, 0x39,
+  0x00, 0xCD, 0x13, 0xFE, 0xA9, 0x44, 0x0A, 0xC5, 0x19, 0x28, 0xFE, 0xCC, 0x71, 0xFE, 0xFF, 0xFF,
+  0xCC, 0xFE, 0xE5, 0xF7, 0x39, 0x0F, 0xC0, 0x0A, 0xC2, 0x19, 0x28, 0x14, 0x31, 0xCA, 0x2C, 0xFE,
+  0xBA, 0xEB, 0x2D, 0x19, 0x0A, 0xC3, 0x19, 0x28, 0xFE, 0xCB, 0xEF, 0x31, 0xC7, 0x51, 0x66, 0x0C,
+  0x2E, 0xFE, 0xC3, 0xEF, 0x2D, 0x19, 0x0A, 0xC5, 0x0D, 0x13, 0x00, 0xCC, 0xA6, 0xF4, 0x1C, 0x0A,
+  0xC4, 0x12, 0x3E, 0xA8, 0x25, 0xFE, 0xFF, 0xBE, 0x31, 0xCD, 0xFE, 0xD4, 0xF3, 0x28, 0x19, 0x0A,
+  0xC3, 0x19, 0x2D, 0x2F, 0x31, 0xC9, 0xFE, 0xC3, 0x8D, 0x28, 0x19, 0x0A, 0xC3, 0x19, 0x28, 0xFE,
+  0xC3, 0x6D, 0x31, 0xC9, 0x18, 0xC0, 0x1D, 0x04, 0xFE, 0xAA, 0x07, 0x99, 0xEC, 0x12, 0x0A, 0xC4,
+  0x1C, 0x13, 0x9A, 0x1C, 0xCB, 0x0B, 0x0A, 0xC6, 0x19, 0x9C, 0xBA, 0xFE, 0xE5, 0xD7, 0x31, 0xCF,
+  0xFE, 0xCB, 0xCE, 0x28, 0x19, 0x0A, 0xC2, 0x6E, 0x0A, 0x05, 0xFE, 0xEE, 0x79, 0x31, 0xC5, 0x2C,
+  0x31, 0x14, 0x28, 0x19, 0x0A, 0xC3, 0x19, 0x2D, 0xFE, 0xBB, 0x0B, 0x2C, 0x31, 0xC9, 0x1D, 0x18,
+  0x65, 0x2E, 0xFE, 0xD5, 0x55, 0x34, 0x19, 0x55, 0xC6, 0x0B, 0x00, 0xCA, 0xA5, 0xD5, 0x1C, 0x0A,
+  0xC4, 0x12, 0x39, 0xFE, 0xBA, 0xEB, 0x31, 0xD0, 0x2C, 0xFE, 0xBA, 0xEA, 0x34, 0x19, 0x0A, 0xC2,
+  0x12, 0x51, 0xA6, 0x35, 0x07, 0x31, 0xC3, 0x2C, 0x31, 0xFE, 0xD4, 0xB2, 0x28, 0x19, 0x0A, 0xC3,
+  0x19, 0x9C, 0xBA, 0xFE, 0xB2, 0x89, 0x20, 0x31, 0xCA, 0x2C, 0x18, 0xC1, 0x1D, 0xFE, 0xB2, 0xA9,
+  0x39, 0x12, 0x0A, 0xC4, 0x1C, 0x9A, 0x2B, 0x00, 0xCA, 0x35, 0x12, 0x0A, 0xC4, 0x12, 0x39, 0xFE,
+  0xE6, 0x38, 0xFE, 0xFF, 0xFF, 0xD1, 0x0C, 0xFE, 0xB2, 0x07, 0x39, 0x19, 0x0A, 0xC2, 0x19, 0x34,
+  0xFE, 0xBA, 0xCA, 0x2C, 0x31, 0xC1, 0x2C, 0x31, 0xFE, 0xDD, 0x54, 0x2D, 0x12, 0x0F, 0x0A, 0xC2,
+  0x19, 0x9D, 0xA9, 0xA9, 0x14, 0x0C, 0x31, 0xCC, 0x1D, 0x18, 0x0C, 0x2E, 0xFE, 0xDD, 0xB6, 0x39,
+  0x12, 0x0A, 0xC4, 0x12, 0x35, 0x00, 0xC9, 0xA2, 0xB7, 0x12, 0x0A, 0xC4, 0x12, 0x39, 0xFE, 0xBA,
+  0xCA, 0x31, 0xD3, 0xFE, 0xEE, 0xBA, 0x19, 0x0A, 0x12, 0x0A, 0xC2, 0x19, 0x28, 0x14, 0x31, 0xC0,
+  0x2C, 0x31, 0x1B, 0xFE, 0xA1, 0x03, 0x0A, 0x6E, 0x0A, 0xC2, 0x19, 0x3E, 0xA5, 0x46, 0x36, 0x31,
+  0xCD, 0x2C, 0x18, 0xC1, 0x1D, 0x25, 0x39, 0x12, 0x0A, 0xC4, 0x12, 0x20, 0x00, 0xC8, 0x10, 0x1C,
+  0x0A, 0xC4, 0x19, 0x2D, 0xFE, 0xE5, 0x96, 0x31, 0xD4, 0xFE, 0xE5, 0xF7, 0x39, 0x0F, 0xC0, 0x66,
+  0xC2, 0x19, 0x2D, 0xFE, 0xDD, 0x54, 0x31, 0xC0, 0xFE, 0xEE, 0x79, 0x0A, 0xC0, 0x12, 0x0A, 0xC2,
+  0x12, 0x52, 0x1E, 0x16, 0x31, 0xCF, 0x18, 0xC0, 0x65, 0x2E, 0xFE, 0xD5, 0x34, 0x2D, 0x19, 0x0A,
+  0xC4, 0x1C, 0x10, 0x00, 0xC8, 0x3C, 0x12, 0x0A, 0xC3, 0x0F, 0x05, 0x03, 0xFE, 0xFF, 0xBE, 0x31,
+  0xC3, 0xFE, 0xEE, 0x79, 0xFE, 0xD4, 0xF3, 0x31, 0xCE, 0x16, 0x28, 0x19, 0x0A, 0xC2, 0x0F, 0x0A,
+  0x3E, 0xFE, 0xEE, 0xBA, 0x36, 0x1E, 0x9D, 0xAA, 0x12, 0x0A, 0xC2, 0x12, 0x0A, 0xC0, 0xFE, 0xEE,
+  0x59, 0x31, 0xCD, 0xFE, 0xD4, 0xF3, 0xFE, 0xEE, 0x79, 0x31, 0x1D, 0x18, 0xC0, 0x1D, 0x38, 0xFE,
+  0xA9, 0xC6, 0x9B, 0xCB, 0x0F, 0x0A, 0xC3, 0x12, 0x3C, 0xFE, 0x00, 0x00, 0xC7, 0xA2, 0xA6, 0x12,
+  0x0A, 0xC4, 0x19, 0x2D, 0xFE, 0xCC, 0x10, 0x31, 0xC4, 0xFE, 0xC3, 0xCE, 0xFE, 0x98, 0x61, 0xFE,
+  0xDD, 0x14, 0x31, 0xCE, 0xFE, 0xCB, 0xCE, 0x28, 0x19, 0x0A, 0xC2, 0x12, 0x3E, 0xA7, 0x35, 0x6F,
+  0x39, 0x19, 0x0A, 0xC2, 0x6E, 0x0A, 0x3E, 0xFE, 0xE5, 0xF7, 0x31, 0xCB, 0x2C, 0x31, 0x25, 0xFE,
+  0x98, 0x81, 0x00, 0x31, 0x61, 0x18, 0xC0, 0x0C, 0x2E, 0xFE, 0xC3, 0xAE, 0x2D, 0x19, 0x0A, 0xC4,
+  0x12, 0x16, 0x9E, 0x6A, 0xC6, 0x3D, 0x1C, 0x0A, 0xC4, 0x12, 0x39, 0xFE, 0xEE, 0x59, 0x31, 0xC3,
+  0x07, 0x23, 0x0A, 0x34, 0xFE, 0xD4, 0xF3, 0x31, 0xCD, 0x2C, 0xFE, 0xBA, 0xEB, 0x34, 0x19, 0x0A,
+  0xC2, 0x12, 0x52, 0xC0, 0x12, 0x0A, 0xC2, 0x0F, 0x12, 0x34, 0xFE, 0xDD, 0x75, 0x31, 0x2C, 0x31,
+  0xCB, 0xFE, 0xDD, 0x13, 0x34, 0x0A, 0x23, 0x07, 0x31, 0x18, 0xC0, 0x66, 0x2E, 0xFE, 0xDD, 0xD7,
+  0x39, 0x12, 0x0A, 0xC4, 0x1C, 0x3D, 0x9C, 0x3A, 0xC6, 0x22, 0x15, 0x0A, 0xC3, 0x12, 0x3E, 0x03,
+  0x20, 0x31, 0xC3, 0xFE, 0xDD, 0x34, 0x2D, 0x19, 0x0F, 0x34, 0xFE, 0xE4, 0xF3, 0x31, 0xCD, 0x0C,
+  0x03, 0x39, 0x19, 0x0A, 0xC2, 0x12, 0xC0, 0x0A, 0xC3, 0x12, 0x2D, 0x16, 0x31, 0x2C, 0x31, 0xCB,
+  0xFE, 0xE5, 0x13, 0x34, 0x0F, 0x19, 0x2D, 0x2A, 0x31, 0x9D, 0xAA, 0xC1, 0x1D, 0x38, 0xFE, 0xA9,
+  0xE6, 0x05, 0x0F, 0x0A, 0xC3, 0x15, 0x22, 0x00, 0xC6, 0xFE, 0x91, 0x23, 0x12, 0x0A, 0xC3, 0x19,
+  0x2D, 0xFE, 0xC3, 0x8D, 0x31, 0xC4, 0xFE, 0xBA, 0xEB, 0x39, 0x12, 0x0A, 0x19, 0xA1, 0xB6, 0x1C,
+  0x31, 0xCD, 0xFE, 0xEE, 0xBA, 0x19, 0x0A, 0x12, 0x0A, 0xC7, 0x19, 0x28, 0xFE, 0xD4, 0x71, 0x31,
+  0xCD, 0x21, 0x23, 0x19, 0x0A, 0x12, 0x39, 0x05, 0x31, 0x1D, 0x18, 0xC1, 0x2E, 0xFE, 0xBB, 0x4C,
+  0xFE, 0xA0, 0xE3, 0x19, 0x0A, 0xC3, 0x12, 0x38, 0x00, 0xC5, 0x0B, 0x0A, 0x0D, 0x0A, 0xC3, 0x19,
+  0x2D, 0x2A, 0x31, 0xC3, 0x9B, 0xCA, 0xFE, 0xA9, 0x85, 0x0A, 0x12, 0x0A, 0xA3, 0x86, 0xA3, 0x86,
+  0x23, 0x21, 0x31, 0xCD, 0xFE, 0xE5, 0xF7, 0x39, 0x0F, 0xC0, 0x0A, 0xC5, 0x19, 0x28, 0xFE, 0xCB,
+  0xEF, 0x31, 0xCD, 0x21, 0x23, 0x08, 0x29, 0x0A, 0x12, 0x0A, 0x1E, 0x07, 0x31, 0x18, 0xC0, 0x0C,
+  0x2E, 0xFE, 0xD4, 0xD2, 0x2D, 0x19, 0x55, 0xC3, 0x0D, 0x0A, 0x0B, 0x46, 0xC4, 0xA3, 0xB6, 0x12,
+  0x0A, 0xC4, 0x6E, 0x62, 0x11, 0x31, 0xC3, 0xFE, 0xE5, 0xD6, 0x34, 0x19, 0x0D, 0x0A, 0xA4, 0x85,
+  0x08, 0xC0, 0x23, 0x21, 0xFE, 0xFF, 0xFF, 0xCB, 0x2C, 0x31, 0xFE, 0xD4, 0xF3, 0xFE, 0xA0, 0xC2,
+  0x19, 0x0A, 0xC4, 0x19, 0x28, 0xFE, 0xC3, 0x6D, 0x31, 0xCD, 0x21, 0x23, 0x08, 0xC0, 0x41, 0x0A,
+  0x0D, 0x19, 0x34, 0x14, 0xFE, 0xFF, 0xFF, 0x0C, 0x18, 0xC0, 0x2E, 0xFE, 0xE6, 0x18, 0x3E, 0x12,
+  0x0A, 0xC4, 0x12, 0x98, 0x0D, 0x00, 0xC4, 0xA4, 0xC6, 0xA7, 0xF4, 0x0A, 0xC3, 0x0F, 0x05, 0xA5,
+  0x45, 0xFE, 0xFF, 0x7D, 0x31, 0xC3, 0xFE, 0xCC, 0x50, 0x2D, 0x19, 0x0A, 0xC0, 0xA5, 0x85, 0x08,
+  0xC1, 0x23, 0xFE, 0xED, 0x54, 0x31, 0xCB, 0x66, 0x31, 0xFE, 0xC3, 0xCE, 0xFE, 0x98, 0xC2, 0x19,
+  0x0A, 0xC2, 0x19, 0x28, 0xFE, 0xBA, 0xEB, 0xFE, 0xFF, 0xDE, 0x2C, 0xC0, 0x31, 0xCA, 0x35, 0x23,
+  0x08, 0xC1, 0x56, 0x0A, 0xC0, 0x19, 0x2D, 0xFE, 0xCC, 0x50, 0x31, 0x0C, 0x18, 0xC0, 0x1D, 0x9A,
+  0xDB, 0xFE, 0xA9, 0xA5, 0x0A, 0x6E, 0x0A, 0xC3, 0x1C, 0x3A, 0x9C, 0x4A, 0xC4, 0xA6, 0xD4, 0x1C,
+  0x0A, 0xC3, 0x12, 0x39, 0xFE, 0xB2, 0x89, 0x31, 0xC4, 0xFE, 0xBB, 0x0B, 0x39, 0x19, 0x55, 0x12,
+  0xA4, 0x96, 0xC1, 0x6F, 0x9D, 0xA9, 0xFE, 0xDB, 0xAD, 0x31, 0xCE, 0xFE, 0xC3, 0x4C, 0x39, 0x12,
+  0x0A, 0xC0, 0x12, 0x3E, 0x05, 0x31, 0xCE, 0x3D, 0x2F, 0x0F, 0x03, 0xC1, 0x12, 0x0A, 0x19, 0x39,
+  0xFE, 0xBB, 0x0B, 0x31, 0x18, 0xC3, 0xFE, 0xB2, 0x48, 0x3E, 0x12, 0x56, 0xC3, 0x1C, 0x9A, 0x3B,
+  0x00, 0xC4, 0x1F, 0x15, 0x0A, 0xC3, 0x19, 0x34, 0x1E, 0x31, 0xC3, 0x2C, 0xFE, 0xB2, 0x28, 0x3E,
+  0x12, 0x0A, 0xA2, 0x87, 0xA4, 0x85, 0x03, 0xC0, 0x08, 0x9C, 0xBA, 0xFE, 0xE3, 0xEE, 0x31, 0xC3,
+  0x9C, 0xCA, 0xFE, 0xC3, 0x8D, 0x2A, 0xC7, 0x9D, 0xA9, 0xFE, 0xA1, 0x24, 0xA2, 0x66, 0x66, 0xC0,
+  0x0F, 0x05, 0xFE, 0xBA, 0xEB, 0x2F, 0x2A, 0xC6, 0x2F, 0xFE, 0xFF, 0x7D, 0x31, 0xC3, 0x11, 0x23,
+  0x08, 0x03, 0xC0, 0x08, 0x21, 0x0A, 0x12, 0x3E, 0xA8, 0x25, 0x2C, 0x1D, 0x18, 0xC1, 0xA2, 0x67,
+  0x05, 0x39, 0x12, 0x0A, 0xC3, 0x15, 0x1F, 0x00, 0xC4, 0xA8, 0xF3, 0x15, 0x0A, 0xC3, 0x19, 0x2D,
+  0xFE, 0xCB, 0xEF, 0x31, 0xC3, 0x07, 0xFE, 0xA9, 0xA5, 0x0A, 0x12, 0x0A, 0x21, 0x08, 0x03, 0xC0,
+  0x08, 0x9C, 0xBA, 0xFE, 0xE3, 0xCE, 0x31, 0xC3, 0x9A, 0xDB, 0x3E, 0x2D, 0x34, 0xC5, 0x2D, 0x39,
+  0xA3, 0x56, 0x0A, 0xC2, 0x0F, 0x39, 0x2D, 0x34, 0xC5, 0x2D, 0x3E, 0x3B, 0x31, 0xC3, 0x0C, 0x23,
+  0x08, 0x03, 0xC0, 0x08, 0x21, 0x0A, 0x12, 0x0A, 0xA3, 0x66, 0x07, 0x29, 0x18, 0xC0, 0x65, 0x2E,
+  0x2F, 0x34, 0x19, 0x0A, 0xC3, 0x15, 0x2A, 0x00, 0xC4, 0xFE, 0x81, 0x03, 0x12, 0x0A, 0xC3, 0x19,
+  0x9C, 0xB9, 0xFE, 0xD4, 0x91, 0x31, 0xC3, 0xFE, 0xF6, 0xDB, 0x0A, 0xC0, 0x12, 0x0A, 0xA3, 0x86,
+  0x08, 0x03, 0xC0, 0x08, 0x9C, 0xBA, 0xFE, 0xE3, 0xCE, 0x31, 0xC3, 0x07, 0xFE, 0xA9, 0xA5, 0x0F,
+  0x19, 0xC6, 0x12, 0x0A, 0xC4, 0x12, 0x19, 0xC6, 0x0F, 0x23, 0x07, 0x31, 0xC3, 0x0C, 0xFE, 0xC9,
+  0x84, 0x08, 0x03, 0xC0, 0x08, 0x29, 0x0A, 0x12, 0x0A, 0xC0, 0xFE, 0xF6, 0xFB, 0x31, 0x9C, 0xBA,
+  0x18, 0x0C, 0x2E, 0xFE, 0xCC, 0x0F, 0x2D, 0x19, 0x0A, 0xC3, 0x12, 0x9D, 0x6A, 0x00, 0xC4, 0x30,
+  0x12, 0x0A, 0xC3, 0x19, 0x28, 0xFE, 0xD4, 0xB2, 0x31, 0x2C, 0x31, 0xC1, 0xFE, 0xEE, 0x79, 0x3E,
+  0x0F, 0x12, 0x0A, 0x29, 0x08, 0x03, 0xC0, 0x08, 0x23, 0xFE, 0xE3, 0xCE, 0x31, 0xC3, 0x07, 0xFE,
+  0xA9, 0x85, 0x0A, 0x0F, 0x0A, 0xD4, 0x0F, 0x0A, 0x1E, 0x07, 0x31, 0xC3, 0x0C, 0x23, 0x08, 0x03,
+  0xC0, 0x08, 0x29, 0x0A, 0x12, 0x0F, 0x3E, 0xFE, 0xEE, 0x99, 0x31, 0x9C, 0xBA, 0x18, 0x0C, 0x31,
+  0xFE, 0xCC, 0x71, 0xFE, 0xA0, 0xE2, 0x19, 0x55, 0xC3, 0x12, 0x30, 0x00, 0xC4, 0x30, 0x12, 0x0A,
+  0xC3, 0x19, 0x2D, 0xFE, 0xD4, 0xD3, 0xFE, 0xFF, 0xFF, 0xC3, 0xFE, 0xEE, 0x59, 0xFE, 0xA1, 0x03,
+  0x12, 0x66, 0x0A, 0x29, 0x08, 0x03, 0xC0, 0x08, 0x23, 0xFE, 0xE3, 0xCE, 0x31, 0xC3, 0x07, 0xFE,
+  0xA9, 0xA5, 0x0F, 0x19, 0xC7, 0x0A, 0xC4, 0x19, 0xC7, 0x0F, 0x23, 0x07, 0x31, 0xC3, 0x0C, 0xFE,
+  0xC9, 0x84, 0x08, 0x03, 0xC0, 0x08, 0x29, 0x0A, 0x0D, 0x12, 0x39, 0x05, 0x31, 0x9C, 0xBA, 0x18,
+  0x0C, 0x2E, 0xFE, 0xCC, 0x91, 0x2D, 0x19, 0x0A, 0xC3, 0x12, 0x30, 0xFE, 0x00, 0x00, 0xC4, 0x30,
+  0x12, 0x0A, 0xC3, 0x19, 0x2D, 0x11, 0x31, 0xC3, 0xFE, 0xEE, 0x59, 0x39, 0x12, 0x0D, 0x0A, 0x29,
+  0x08, 0x03, 0xC0, 0x08, 0x23, 0xFE, 0xE3, 0xCE, 0x31, 0xC3, 0x3B, 0x39, 0x28, 0x2D, 0xC6, 0x34,
+  0x0A, 0xC4, 0x34, 0x2D, 0xC6, 0x28, 0x39, 0x3B, 0x31, 0xC3, 0x0C, 0x23, 0x08, 0x03, 0xC0, 0x08,
+  0x29, 0x0A, 0x0D, 0x12, 0x39, 0x05, 0x31, 0x9C, 0xBA, 0x18, 0x0C, 0x2E, 0x36, 0x2D, 0x19, 0x0A,
+  0xC3, 0x12, 0x30, 0xFE, 0x00, 0x00, 0xC4, 0x30, 0x12, 0x0A, 0xC3, 0x19, 0x28, 0xFE, 0xD4, 0xB2,
+  0x31, 0x2C, 0x31, 0xC1, 0xFE, 0xEE, 0x79, 0x3E, 0x0F, 0x12, 0x0A, 0x29, 0x08, 0x03, 0xC0, 0x08,
+  0x23, 0xFE, 0xE3, 0xCE, 0x31, 0xC3, 0x9D, 0xBA, 0xFE, 0xCC, 0x51, 0x65, 0x6E, 0xC4, 0x20, 0x25,
+  0x9C, 0xCA, 0x0A, 0xC4, 0x03, 0x25, 0x20, 0x25, 0xC4, 0x20, 0x2C, 0x1B, 0x31, 0xC3, 0x0C, 0x23,
+  0x08, 0x66, 0xC0, 0x08, 0x29, 0x0A, 0x12, 0x0F, 0x3E, 0xFE, 0xEE, 0x99, 0x31, 0x9C, 0xBA, 0x18,
+  0x0C, 0x31, 0xFE, 0xCC, 0x71, 0x2D, 0x19, 0x55, 0xC3, 0x12, 0x30, 0x00, 0xC4, 0xFE, 0x81, 0x03,
+  0x12, 0x0A, 0xC3, 0x19, 0x9C, 0xB9, 0xFE, 0xD4, 0x91, 0xFE, 0xFF, 0xFF, 0xC3, 0xFE, 0xF6, 0xDB,
+  0x0A, 0xC0, 0x12, 0x0A, 0x29, 0x08, 0x03, 0xC0, 0x08, 0x23, 0xFE, 0xE3, 0xCE, 0x31, 0xCE, 0x9C,
+  0xBA, 0x0A, 0xC4, 0x0C, 0x31, 0xCE, 0xFE, 0xE3, 0xCE, 0x23, 0x08, 0x03, 0xC0, 0x08, 0x29, 0x0A,
+  0x12, 0x0A, 0xC0, 0x2A, 0x31, 0x18, 0xC0, 0x65, 0x2E, 0x14, 0x2D, 0x19, 0x0A, 0xC3, 0x12, 0x9D,
+  0x6A, 0x00, 0xC4, 0xA8, 0xF3, 0x15, 0x0A, 0xC3, 0x19, 0x9C, 0xB9, 0xFE, 0xCB, 0xEF, 0x31, 0xC3,
+  0x07, 0xFE, 0xA9, 0xA5, 0x0A, 0x12, 0x0A, 0x21, 0x08, 0x03, 0xC0, 0x08, 0x9C, 0xBA, 0xFE, 0xE3,
+  0xCE, 0x31, 0xC5, 0x66, 0x31, 0x2C, 0xC5, 0x99, 0xEB, 0x0A, 0xC4, 0x2A, 0x2C, 0xC5, 0x31, 0x2C,
+  0x31, 0xC5, 0x0C, 0x23, 0x08, 0x03, 0xC0, 0x08, 0x21, 0x0A, 0x12, 0x0A, 0xA3, 0x66, 0x07, 0xA4,
+  0x46, 0x18, 0xC0, 0x65, 0x2E, 0x2F, 0x34, 0x19, 0x0A, 0xC3, 0x15, 0x9C, 0x5B, 0x00, 0xC4, 0x1F,
+  0x15, 0x0A, 0xC3, 0x19, 0x34, 0xFE, 0xC3, 0x4C, 0x31, 0xC3, 0x2C, 0xFE, 0xB2, 0x28, 0x3E, 0x12,
+  0x0A, 0x21, 0x08, 0x03, 0xC0, 0x08, 0x9C, 0xBA, 0xFE, 0xE3, 0xEE, 0x31, 0xCE, 0x2A, 0x0A, 0xC4,
+  0x2A, 0x31, 0xCE, 0x11, 0x23, 0x08, 0x03, 0xC0, 0x08, 0x21, 0x0A, 0x12, 0x3E, 0x0F, 0x2C, 0x1D,
+  0x18, 0xC1, 0x29, 0xFE, 0xBA, 0xEB, 0xFE, 0xA1, 0x03, 0x12, 0x0A, 0xC3, 0x15, 0x1F, 0x00, 0xC4,
+  0xA5, 0xE5, 0x1C, 0x0A, 0xC3, 0x12, 0x39, 0xFE, 0xB2, 0x89, 0x31, 0xC4, 0xFE, 0xBB, 0x0B, 0x39,
+  0x19, 0x55, 0x12, 0x03, 0xC1, 0x6F, 0x9D, 0xA9, 0x3D, 0x31, 0xCC, 0x2C, 0x31, 0x2A, 0x0A, 0xC4,
+  0x2A, 0x31, 0x2C, 0x31, 0xCC, 0x3D, 0x2F, 0x0F, 0x03, 0xC1, 0x12, 0x0A, 0x19, 0x39, 0xFE, 0xBB,
+  0x0B, 0x31, 0x18, 0xC3, 0xFE, 0xB2, 0x48, 0x3E, 0x12, 0x56, 0xC3, 0x1C, 0x08, 0x00, 0xC4, 0x3A,
+  0x1C, 0x0A, 0xC3, 0x6E, 0x62, 0xA5, 0x45, 0xFE, 0xFF, 0x7D, 0x31, 0xC3, 0xFE, 0xCC, 0x50, 0x2D,
+  0x19, 0x0A, 0xC0, 0xA5, 0x85, 0x7E, 0xC1, 0x23, 0x35, 0x31, 0xCE, 0x3B, 0x0A, 0xC4, 0x3B, 0x31,
+  0xCE, 0x35, 0x23, 0x08, 0xC1, 0x00, 0x0A, 0xC0, 0x19, 0x2D, 0x25, 0x31, 0x0C, 0x18, 0xC0, 0x1D,
+  0x27, 0xFE, 0xA9, 0xA5, 0x0A, 0x6E, 0x0A, 0xC3, 0x1C, 0x3A, 0x9C, 0x4A, 0xC4, 0xA3, 0xB6, 0x12,
+  0x0A, 0xC4, 0x0F, 0x05, 0xFE, 0xEE, 0x9A, 0x31, 0xC3, 0xFE, 0xE5, 0xD6, 0x34, 0x19, 0x0D, 0x0A,
+  0xA4, 0x85, 0x08, 0xC0, 0x9C, 0xBA, 0xFE, 0xE5, 0x13, 0xFE, 0xFF, 0xFF, 0xC4, 0x2C, 0x97, 0xFC,
+  0xC6, 0x11, 0x16, 0x99, 0xEC, 0x0A, 0xC4, 0x1B, 0x16, 0x11, 0x16, 0xC6, 0x2C, 0x31, 0xC4, 0xFE,
+  0xED, 0x13, 0x23, 0x08, 0xC0, 0x41, 0x0A, 0x0D, 0x19, 0x34, 0x14, 0xFE, 0xFF, 0xFF, 0x0C, 0x18,
+  0xC0, 0x2E, 0xFE, 0xE6, 0x17, 0x3E, 0x12, 0x0A, 0xC4, 0x12, 0x98, 0x0D, 0x00, 0xC4, 0x0B, 0x0A,
+  0x0D, 0x0A, 0xC3, 0x19, 0x2D, 0xFE, 0xDD, 0x34, 0x31, 0xC3, 0x9B, 0xCA, 0xFE, 0xA9, 0x85, 0x0A,
+  0x12, 0x0A, 0xA3, 0x86, 0x08, 0x23, 0x21, 0x31, 0xC5, 0x3B, 0x12, 0x3E, 0x05, 0xC7, 0x0A, 0xC4,
+  0x05, 0xC7, 0x3E, 0x12, 0x3B, 0x31, 0xC5, 0x21, 0x23, 0x08, 0x29, 0x0A, 0x12, 0x0A, 0x1E, 0x07,
+  0x31, 0x18, 0xC0, 0x0C, 0x2E, 0xFE, 0xD4, 0xD2, 0x2D, 0x19, 0x55, 0xC3, 0x0D, 0x0A, 0x0B, 0x46,
+  0xC5, 0x38, 0x12, 0x0A, 0xC3, 0x19, 0x2D, 0xFE, 0xC3, 0x8D, 0x31, 0xC4, 0xFE, 0xBA, 0xEB, 0x39,
+  0x12, 0x0A, 0x19, 0x23, 0x24, 0x31, 0xC6, 0x07, 0x1E, 0x0A, 0x0F, 0xC7, 0x0A, 0xC4, 0x0F, 0xC7,
+  0x0A, 0x1E, 0x07, 0x31, 0xC6, 0x24, 0x23, 0x19, 0x0A, 0x12, 0x39, 0xFE, 0xBB, 0x0B, 0x31, 0x18,
+  0xC2, 0x2E, 0xFE, 0xBB, 0x4C, 0x34, 0x19, 0x55, 0xC3, 0x12, 0x38, 0x00, 0xC6, 0x22, 0x15, 0x0A,
+  0xC3, 0x12, 0x3E, 0xA7, 0x35, 0xFE, 0xFF, 0xBE, 0x31, 0xC3, 0x2A, 0x2D, 0x19, 0x0F, 0x34, 0x21,
+  0x31, 0xC7, 0x07, 0x1E, 0x0A, 0x0F, 0x0A, 0xD4, 0x0F, 0x0A, 0x1E, 0x07, 0x31, 0xC7, 0x21, 0x34,
+  0x0F, 0x1E, 0x2D, 0x2A, 0x31, 0x0C, 0x18, 0xC0, 0x1D, 0x9C, 0xBA, 0xFE, 0xA9, 0xE6, 0x9A, 0xDC,
+  0x0F, 0x0A, 0xC3, 0x15, 0x22, 0x00, 0xC6, 0xA4, 0xD6, 0x1C, 0x0A, 0xC4, 0x12, 0x39, 0xFE, 0xEE,
+  0x59, 0x31, 0xC3, 0x07, 0xFE, 0xA9, 0xA5, 0x0A, 0x9D, 0xBA, 0xFE, 0xDD, 0x13, 0x31, 0xC8, 0x07,
+  0xFE, 0xA9, 0x85, 0x0A, 0x0F, 0xC7, 0x0A, 0xC4, 0x0F, 0xC7, 0x0A, 0x1E, 0x07, 0x31, 0xC8, 0xFE,
+  0xDD, 0x13, 0x34, 0x0A, 0x23, 0x07, 0x31, 0x18, 0xC0, 0x13, 0x2E, 0xFE, 0xDD, 0xD6, 0x39, 0x12,
+  0x0A, 0xC4, 0x1C, 0x3D, 0x9C, 0x3A, 0xC6, 0xA2, 0xA6, 0x12, 0x0A, 0xC4, 0x19, 0x2D, 0xFE, 0xCC,
+  0x10, 0x31, 0xC4, 0xFE, 0xC3, 0xCE, 0xFE, 0x98, 0x81, 0xFE, 0xDD, 0x14, 0x31, 0x2C, 0x31, 0xC7,
+  0x07, 0x19, 0x05, 0x0A, 0xD6, 0x05, 0x19, 0x07, 0x31, 0xC7, 0x2C, 0x31, 0x2A, 0x14, 0x00, 0x31,
+  0x18, 0xC1, 0x0C, 0x2E, 0xFE, 0xC3, 0xAE, 0x2D, 0x19, 0x0A, 0xC4, 0x12, 0x16, 0x9E, 0x6A, 0xC7,
+  0x3C, 0x12, 0x0A, 0xC3, 0x0F, 0x05, 0x03, 0x20, 0x31, 0xC3, 0xFE, 0xEE, 0x79, 0xFE, 0xD4, 0xF3,
+  0x31, 0xCA, 0x07, 0xFE, 0xA9, 0xA6, 0x65, 0xC8, 0x0A, 0xC4, 0x1E, 0xC8, 0x2A, 0x07, 0x31, 0xCA,
+  0x16, 0x05, 0x31, 0x18, 0xC1, 0x1D, 0x38, 0xFE, 0xA9, 0xC6, 0x9B, 0xCB, 0x0F, 0x0A, 0xC3, 0x12,
+  0x3C, 0x00, 0xC8, 0x10, 0x1C, 0x0A, 0xC4, 0x19, 0x2D, 0xFE, 0xDD, 0x96, 0x31, 0xD2, 0x9B, 0xCB,
+  0x69, 0x07, 0xC4, 0x65, 0x07, 0x99, 0xEB, 0x0A, 0xC4, 0x05, 0x07, 0x3B, 0x07, 0xC4, 0x00, 0x07,
+  0x31, 0xCD, 0x2C, 0x18, 0xC0, 0x0C, 0x2E, 0xFE, 0xD5, 0x34, 0x2D, 0x19, 0x0A, 0xC4, 0x1C, 0x10,
+  0x9A, 0x2C, 0xC8, 0xA2, 0xB7, 0x12, 0x0A, 0xC4, 0x12, 0x39, 0xFE, 0xBA, 0xCA, 0x31, 0xDC, 0x3B,
+  0x0A, 0xC4, 0x3B, 0x31, 0xD7, 0x1D, 0x18, 0xC1, 0x1D, 0xFE, 0xB2, 0x89, 0xFE, 0xA1, 0x03, 0x12,
+  0x0A, 0xC4, 0x12, 0x20, 0x00, 0xC9, 0xFE, 0x89, 0x23, 0x12, 0x0A, 0xC4, 0x12, 0x39, 0xFE, 0xE6,
+  0x38, 0xFE, 0xFF, 0xFF, 0xDB, 0x98, 0xFC, 0x0A, 0xC4, 0x2A, 0x31, 0xD6, 0x2C, 0x18, 0xC0, 0x0C,
+  0x2E, 0xFE, 0xDD, 0xB6, 0x39, 0x12, 0x0A, 0xC4, 0x12, 0x35, 0x00, 0xCA, 0xA5, 0xD5, 0x1C, 0x0A,
+  0xC4, 0x12, 0x39, 0xFE, 0xBA, 0xEB, 0x31, 0xDB, 0x2A, 0x0A, 0xC4, 0x2A, 0x31, 0xD6, 0x1D, 0x18,
+  0xC1, 0x1D, 0xFE, 0xB2, 0xA9, 0x39, 0x12, 0x0A, 0xC4, 0x1C, 0x9A, 0x2B, 0x00, 0xCA, 0x0B, 0x0A,
+  0xC6, 0x19, 0x34, 0xFE, 0xE5, 0xD7, 0x31, 0xDA, 0x98, 0xFC, 0x0A, 0xC4, 0x2A, 0x31, 0xD5, 0x2C,
+  0x18, 0xC0, 0x65, 0x2E, 0x33, 0x34, 0x19, 0x0A, 0xC6, 0x0B, 0x00, 0xCB, 0xA6, 0xF4, 0x1C, 0x0A,
+  0xC4, 0x12, 0x3E, 0xA8, 0x25, 0xFE, 0xFF, 0xBE, 0x31, 0xD9, 0x2A, 0x0A, 0xC4, 0x2A, 0x31, 0xD5,
+  0x1D, 0x18, 0xC0, 0x1D, 0x04, 0xFE, 0xAA, 0x07, 0x99, 0xEC, 0x12, 0x0A, 0xC4, 0x1C, 0x13, 0x9A,
+  0x1C, 0xCC, 0xA2, 0x96, 0x0D, 0x0A, 0xC5, 0x19, 0x9B, 0xCA, 0xFE, 0xCC, 0x71, 0xFE, 0xFF, 0xFF,
+  0xD9, 0x2A, 0x0A, 0xC4, 0x2A, 0x31, 0xD4, 0x2C, 0x18, 0xC0, 0x0C, 0x2E, 0xFE, 0xC3, 0xEF, 0x2D,
+  0x19, 0x0A, 0xC6, 0x0E, 0x00, 0xCD, 0x1F, 0x1C, 0x0A, 0xC5, 0x6E, 0x3E, 0xFE, 0xEE, 0x79, 0x31,
+  0xD8, 0x99, 0xEB, 0x19, 0xC4, 0x2F, 0x31, 0xD4, 0x18, 0xC0, 0x65, 0x2E, 0xFE, 0xDD, 0xF7, 0x39,
+  0x0F, 0x0A, 0xC5, 0x1C, 0x9C, 0x39, 0x00, 0xCE, 0x0E, 0x0A, 0xC6, 0x12, 0x3E, 0x03, 0xFE, 0xFF,
+  0x9E, 0x31, 0xD7, 0x2A, 0x2D, 0xC4, 0x2A, 0x31, 0xD3, 0x51, 0x66, 0xC0, 0x1D, 0x38, 0xFE, 0xA9,
+  0xE6, 0x9A, 0xDC, 0x12, 0x0A, 0xC6, 0x0E, 0x00, 0xCF, 0xA6, 0xD4, 0x1C, 0x0A, 0xC5, 0x19, 0x2D,
+  0xFE, 0xC3, 0x4C, 0x31, 0xD7, 0x1B, 0xFE, 0xDD, 0x14, 0xC4, 0x1B, 0x31, 0xD2, 0x2C, 0x18, 0xC1,
+  0xA2, 0x67, 0xFE, 0xBA, 0xEB, 0xFE, 0xA0, 0xE3, 0x19, 0x0A, 0xC5, 0x1C, 0x9A, 0x3B, 0x00, 0xD0,
+  0x7A, 0x3F, 0x12, 0x0A, 0xC5, 0x19, 0x28, 0xFE, 0xCC, 0x50, 0x31, 0x2C, 0x31, 0xF0, 0x18, 0xC1,
+  0x2E, 0xFE, 0xC3, 0xEF, 0x2D, 0x19, 0x0A, 0xC5, 0x12, 0x3F, 0x03, 0x00, 0xD1, 0xA3, 0xB6, 0x15,
+  0x0A, 0xC6, 0x12, 0x2D, 0x16, 0x31, 0x2C, 0x31, 0xEE, 0x1D, 0x18, 0x69, 0x31, 0x36, 0x2D, 0x19,
+  0x0A, 0xC6, 0x15, 0x28, 0x00, 0xD3, 0x1F, 0x1C, 0x0A, 0xC5, 0x0F, 0xC0, 0x34, 0xFE, 0xDD, 0x34,
+  0x31, 0xEE, 0x1D, 0x18, 0xC0, 0x31, 0xFE, 0xD4, 0xB2, 0x34, 0x12, 0x0F, 0x0A, 0xC5, 0x1C, 0x9C,
+  0x39, 0x00, 0xD4, 0x03, 0x3F, 0x12, 0x0A, 0xC5, 0x0F, 0xC0, 0x34, 0x16, 0x31, 0xEC, 0x2C, 0x9D,
+  0xA9, 0x6F, 0x2E, 0x36, 0x34, 0x0F, 0xC0, 0x0A, 0xC5, 0x12, 0x3F, 0x03, 0x00, 0xD5, 0xA2, 0xA7,
+  0xFE, 0xA9, 0x44, 0x0A, 0xC6, 0x0F, 0x12, 0x2D, 0x25, 0x31, 0xEA, 0x2C, 0x0C, 0xA2, 0x67, 0x29,
+  0xFE, 0xC3, 0xEF, 0x2D, 0x12, 0x0F, 0x0A, 0xC6, 0x0D, 0xFE, 0x20, 0x41, 0x00, 0xD7, 0xA4, 0xC5,
+  0x1C, 0x0A, 0xC6, 0x0F, 0x19, 0x9B, 0xCA, 0x1E, 0xFE, 0xFF, 0x7D, 0x31, 0x2C, 0x31, 0xCD, 0xFE,
+  0xEE, 0x9A, 0x9A, 0xDA, 0x6F, 0xC4, 0x14, 0x11, 0x31, 0xCC, 0x61, 0x51, 0x2E, 0x38, 0xFE, 0xBA,
+  0xEB, 0x2D, 0x19, 0x0A, 0xC7, 0x1C, 0x33, 0x00, 0xD9, 0xA6, 0xD4, 0x1C, 0x0A, 0xC7, 0x19, 0x2D,
+  0xA9, 0x14, 0xFE, 0xEE, 0x38, 0x31, 0xCE, 0xFE, 0xC3, 0x2C, 0xFE, 0x98, 0x81, 0x39, 0x66, 0xC2,
+  0x39, 0x14, 0x19, 0x31, 0xCB, 0x51, 0xC0, 0x2E, 0xFE, 0xDD, 0xF7, 0xFE, 0xA9, 0xE6, 0x98, 0xFD,
+  0xA4, 0x56, 0x0A, 0xC7, 0x1C, 0x0D, 0x00, 0xDB, 0x22, 0x1C, 0x0A, 0xC7, 0x19, 0x3E, 0xC0, 0x25,
+  0x20, 0x31, 0xCC, 0xFE, 0xC3, 0x8D, 0x39, 0xA4, 0x56, 0x19, 0xC2, 0x1E, 0x39, 0x2F, 0x31, 0xC9,
+  0x2C, 0x55, 0x2E, 0x04, 0xFE, 0xC3, 0xEF, 0x39, 0x6F, 0x19, 0x0A, 0xC7, 0x1C, 0x22, 0x00, 0xDD,
+  0xFE, 0x78, 0xE3, 0x1C, 0x0A, 0xC7, 0x12, 0x5A, 0x2D, 0xAA, 0x04, 0xFE, 0xE5, 0xB6, 0x31, 0xCB,
+  0xFE, 0xC3, 0x6D, 0x34, 0x19, 0x0A, 0xC2, 0x19, 0x34, 0x2A, 0x31, 0xCA, 0x1D, 0xFE, 0xD5, 0x54,
+  0xFE, 0xA9, 0xE7, 0x2D, 0xA4, 0x46, 0x12, 0x0A, 0xC7, 0x1C, 0x25, 0x00, 0xDF, 0x25, 0x1C, 0x0A,
+  0xC8, 0x19, 0x3E, 0x34, 0xFE, 0xBA, 0xCA, 0xFE, 0xE5, 0xF7, 0x31, 0xC9, 0x2A, 0x34, 0x19, 0x0A,
+  0xC2, 0x19, 0x34, 0x2A, 0x31, 0xC8, 0x1D, 0xFE, 0xDD, 0x96, 0xFE, 0xB2, 0x89, 0x34, 0x05, 0x19,
+  0x0A, 0xC8, 0x1C, 0x9C, 0x5A, 0x00, 0xE1, 0x22, 0x1C, 0x0A, 0xC8, 0x12, 0x19, 0x9D, 0xA9, 0xC0,
+  0xFE, 0xBA, 0xAA, 0xFE, 0xDD, 0x75, 0xFE, 0xFF, 0x9D, 0x31, 0xC4, 0x66, 0x31, 0x2A, 0xFE, 0xA0,
+  0xE3, 0x19, 0x0A, 0xC2, 0x19, 0x34, 0x2A, 0x31, 0x2C, 0x31, 0xC4, 0x9B, 0xCA, 0xFE, 0xD5, 0x13,
+  0xFE, 0xB2, 0x69, 0x39, 0xC0, 0x19, 0x12, 0x0A, 0xC8, 0x1C, 0x22, 0x99, 0x1C, 0xE3, 0x0D, 0x15,
+  0x0A, 0xC9, 0x12, 0xC0, 0x39, 0x2D, 0xA8, 0x14, 0xFE, 0xCB, 0xCF, 0xFE, 0xE6, 0x17, 0xFE, 0xFF,
+  0x9E, 0x31, 0xC3, 0x2A, 0xFE, 0xA0, 0xE3, 0x19, 0x55, 0xC2, 0x19, 0x34, 0x2A, 0x31, 0xC3, 0x1B,
+  0xFE, 0xE5, 0xD7, 0xFE, 0xC3, 0xAE, 0xFE, 0xA9, 0xC6, 0x2D, 0x39, 0x12, 0xC0, 0x0A, 0xC9, 0x15,
+  0x10, 0x00, 0xE5, 0x3A, 0xA6, 0xF4, 0x12, 0x0A, 0xC9, 0x12, 0x19, 0x05, 0x2D, 0x39, 0xA7, 0x25,
+  0x2A, 0x16, 0xAB, 0x03, 0xA8, 0x13, 0x31, 0xFE, 0xC3, 0x8D, 0x2D, 0x19, 0x0A, 0xC2, 0x19, 0x2D,
+  0x2F, 0x31, 0x9B, 0xCB, 0x98, 0xFC, 0x16, 0xFE, 0xC3, 0x4C, 0xFE, 0xA9, 0xE6, 0x39, 0x2D, 0x0A,
+  0x19, 0x12, 0x0A, 0xC9, 0x12, 0x0D, 0x3D, 0x9C, 0x3A, 0xE7, 0xA2, 0xB7, 0x3F, 0x1C, 0x0A, 0xCA,
+  0x0F, 0x19, 0x12, 0x05, 0x61, 0x2D, 0x39, 0x23, 0xA6, 0x36, 0x9B, 0xCA, 0x0A, 0x0F, 0x0A, 0xC2,
+  0x0F, 0x0A, 0x2F, 0x20, 0x23, 0x3E, 0x2D, 0x34, 0x05, 0x12, 0x19, 0x0F, 0x0A, 0xCA, 0x1C, 0x3F,
+  0x99, 0x2C, 0x00, 0xE9, 0x7A, 0x1A, 0x15, 0x12, 0x0A, 0xCB, 0x0F, 0x19, 0xC0, 0x12, 0x0A, 0x39,
+  0x0A, 0x0F, 0x0A, 0xC4, 0x0F, 0x0A, 0x39, 0x0A, 0x12, 0x19, 0xC0, 0x0F, 0x0A, 0xCB, 0x12, 0x15,
+  0x1F, 0x03, 0x00, 0xEC, 0x2B, 0x3F, 0x1C, 0x0A, 0xCE, 0x0F, 0x12, 0x0F, 0x0A, 0xC6, 0x0F, 0x12,
+  0x0F, 0x0A, 0xCD, 0x0D, 0x1C, 0x3F, 0x2B, 0x00, 0xEF, 0x03, 0xA6, 0xC4, 0x0A, 0x15, 0x0A, 0xE8,
+  0x15, 0x0A, 0x0D, 0x03, 0x00, 0xF2, 0x0E, 0x1A, 0x0A, 0x1C, 0x55, 0x0A, 0xE2, 0x0D, 0x1C, 0x0D,
+  0x1F, 0x13, 0x00, 0xF6, 0xA2, 0xA6, 0xA4, 0xD6, 0x0A, 0x1C, 0x12, 0x0A, 0xDE, 0x12, 0x1C, 0x0A,
+  0x1A, 0x16, 0x00, 0xFA, 0x0B, 0xA4, 0xC6, 0x35, 0x12, 0x15, 0x12, 0x0A, 0xD8, 0x12, 0x15, 0x12,
+  0x3C, 0x05, 0x0B, 0x00, 0xFD, 0xC1, 0x20, 0x10, 0x35, 0x12, 0x1C, 0x15, 0x12, 0x0D, 0x0A, 0xCE,
+  0x0D, 0x12, 0x15, 0x1C, 0x12, 0x9E, 0x79, 0x10, 0x20, 0x00, 0xFD, 0xC7, 0x16, 0x3D, 0x22, 0x3F,
+  0x0A, 0x12, 0x1C, 0xC0, 0x15, 0xC0, 0x12, 0xC4, 0x15, 0xC0, 0x1C, 0xC0, 0x12, 0x0A, 0x38, 0x22,
+  0x3D, 0x9E, 0x59, 0x00, 0xFD, 0xCE, 0x0E, 0xA2, 0x87, 0x3A, 0xA2, 0x96, 0x1F, 0xA0, 0xA8, 0x7E,
+  0x30, 0xC2, 0x2D, 0x25, 0x1F, 0x0D, 0x3A, 0x9F, 0x68, 0x0B, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+  0xDD,
+};
+
+const uint8_t kAssetIcon5Data[5773] PROGMEM = {
+  0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC0, 0xA3, 0x75, 0xA9, 0x51, 0x00, 0xE0, 0xA9, 0x41, 0xFE, 0x9C,
+  0x07, 0xAA, 0x41, 0xC0, 0x0A, 0xFE, 0x29, 0x22, 0x00, 0xE0, 0x22, 0x15, 0x00, 0xD4, 0xFE, 0xB4,
+  0x06, 0x99, 0xAD, 0x00, 0xDF, 0xFE, 0x4A, 0x04, 0xFE, 0xF6, 0x8C, 0xA4, 0x55, 0x62, 0xC0, 0x10,
+  0x32, 0x07, 0x00, 0xDF, 0x0C, 0xA7, 0x63, 0x00, 0xD3, 0xFE, 0x7A, 0xC4, 0xFE, 0xFE, 0x49, 0xFE,
+  0x72, 0xA4, 0x00, 0xDE, 0xA6, 0x53, 0xFE, 0xEE, 0x6C, 0x06, 0x9D, 0xAA, 0xC2, 0x06, 0x2A, 0x2E,
+  0x00, 0xDE, 0x2F, 0x16, 0x37, 0x00, 0xD1, 0xFE, 0x5A, 0x23, 0xFE, 0xFD, 0xA8, 0x6E, 0xFE, 0x7A,
+  0xA4, 0x00, 0xDE, 0xFE, 0x83, 0x86, 0x10, 0x2D, 0x7E, 0xC2, 0x2D, 0x10, 0x26, 0x00, 0xDE, 0x32,
+  0x3B, 0x36, 0x0B, 0x00, 0xCF, 0xA9, 0x50, 0xFE, 0xF5, 0x88, 0x56, 0x3B, 0x32, 0x00, 0xDD, 0xA2,
+  0x76, 0xFE, 0xE5, 0xEB, 0xA6, 0x54, 0x55, 0x35, 0xC2, 0x32, 0x01, 0x0C, 0x0D, 0x00, 0xDD, 0xFE,
+  0x7A, 0xA4, 0x3B, 0x26, 0x2E, 0x06, 0x00, 0xCD, 0x0D, 0xFE, 0xD4, 0xC7, 0x36, 0x9D, 0x9A, 0x3B,
+  0xFE, 0x82, 0xE4, 0x00, 0xDD, 0xFE, 0x5A, 0x64, 0xFE, 0xFE, 0xED, 0x2D, 0x35, 0xC4, 0x2D, 0x0B,
+  0x1C, 0x00, 0xDD, 0x3F, 0x3B, 0x1A, 0x36, 0x3D, 0x0D, 0x00, 0xCC, 0xFE, 0x8B, 0x24, 0x3B, 0x9C,
+  0xAC, 0x26, 0x3B, 0xFE, 0xAB, 0xE5, 0x00, 0xDD, 0xFE, 0xC5, 0x09, 0x0B, 0x9D, 0xAA, 0x35, 0xC4,
+  0x32, 0x0B, 0x0F, 0x00, 0xDD, 0xFE, 0xAB, 0xE6, 0x3B, 0x26, 0x21, 0x3B, 0x0C, 0x00, 0xCB, 0x06,
+  0x2E, 0x26, 0xC2, 0xA2, 0x67, 0xFE, 0x29, 0x02, 0x00, 0xDB, 0xFE, 0x31, 0x62, 0x01, 0x32, 0x35,
+  0xC6, 0x32, 0x01, 0x17, 0x00, 0xDB, 0x05, 0x37, 0x26, 0xC2, 0x2E, 0x06, 0x00, 0xCA, 0xFE, 0xB4,
+  0x06, 0x3B, 0x21, 0x7E, 0xC0, 0x1A, 0xFE, 0xFE, 0xAC, 0xFE, 0xBC, 0xE9, 0x00, 0xC0, 0x6E, 0x00,
+  0xD6, 0x7E, 0x9F, 0xB9, 0xFE, 0xA4, 0x08, 0x0B, 0x2D, 0x35, 0xC6, 0x2D, 0x0B, 0xFE, 0xAC, 0x08,
+  0x09, 0x08, 0x00, 0xD6, 0x05, 0x00, 0xC0, 0x07, 0x3A, 0x1A, 0x29, 0xC0, 0x21, 0x3B, 0x0C, 0x00,
+  0xC9, 0xFE, 0x39, 0x62, 0x36, 0x26, 0x29, 0xC0, 0x26, 0xA4, 0x56, 0x32, 0xA3, 0x66, 0xFE, 0xA4,
+  0x48, 0x0D, 0x00, 0xD5, 0xA2, 0xB7, 0xA2, 0xC7, 0xA0, 0xC8, 0xA6, 0x53, 0xFE, 0xFE, 0x4C, 0x3A,
+  0x35, 0xC8, 0x3A, 0x2B, 0x3D, 0x0F, 0x03, 0x20, 0x00, 0xD5, 0x0D, 0x1E, 0x0B, 0x32, 0x9A, 0xEB,
+  0x26, 0x29, 0xC0, 0x26, 0x36, 0xFE, 0x39, 0x42, 0x00, 0xC8, 0xFE, 0xA3, 0xC5, 0x3B, 0x21, 0x29,
+  0xC0, 0x2E, 0xA7, 0x25, 0x6E, 0x2D, 0x0B, 0xFE, 0xD5, 0x8A, 0xFE, 0x62, 0xA5, 0xFE, 0x21, 0x01,
+  0x0D, 0x00, 0xCF, 0xA0, 0xA8, 0xA3, 0xC6, 0xA2, 0xC7, 0xA1, 0xA8, 0x6E, 0x9B, 0xBC, 0xFE, 0xBB,
+  0x47, 0x0B, 0x2D, 0x35, 0xC8, 0x2D, 0x0B, 0xFE, 0xBB, 0x67, 0x08, 0x2E, 0x29, 0x14, 0x31, 0x06,
+  0x00, 0xCF, 0x0D, 0x3B, 0x30, 0xFE, 0xD5, 0x8A, 0x0B, 0x2D, 0x35, 0x66, 0x98, 0xFC, 0xC1, 0x21,
+  0xA4, 0x64, 0xFE, 0xA3, 0xA5, 0x00, 0xC7, 0xA5, 0x74, 0x21, 0x29, 0x26, 0x29, 0x26, 0xA4, 0x56,
+  0x01, 0x35, 0xC0, 0x2D, 0xA3, 0x66, 0x6E, 0x06, 0xFE, 0xAC, 0x68, 0x00, 0xCE, 0xA3, 0xD6, 0xA2,
+  0xE7, 0xA1, 0x98, 0x5A, 0x5A, 0x66, 0x7A, 0xFE, 0xE5, 0xAB, 0x06, 0x35, 0xCA, 0x06, 0x02, 0x23,
+  0x1E, 0x23, 0x26, 0x29, 0x17, 0x2E, 0x00, 0xCE, 0xFE, 0xAC, 0x68, 0x06, 0x0B, 0x06, 0x2D, 0x35,
+  0xC0, 0x01, 0x9A, 0xDB, 0x9B, 0xCA, 0x7F, 0x5A, 0x29, 0x56, 0xFE, 0x18, 0xA1, 0x00, 0xC6, 0xFE,
+  0x6A, 0x63, 0x3B, 0x21, 0x7E, 0xC1, 0xA8, 0x14, 0x35, 0xC2, 0x2D, 0x66, 0xA5, 0x44, 0xFE, 0xBD,
+  0x09, 0x00, 0xCC, 0xA1, 0xB7, 0xA3, 0xF7, 0xA2, 0xA7, 0x5A, 0x23, 0xC0, 0x26, 0x9D, 0xAA, 0xFE,
+  0xAA, 0x65, 0x06, 0x2D, 0x35, 0xCA, 0x2D, 0x06, 0xFE, 0xAA, 0x66, 0x0D, 0x26, 0x23, 0xC0, 0x26,
+  0x29, 0x9F, 0x58, 0x9C, 0x2A, 0x00, 0xCC, 0xFE, 0xBD, 0x09, 0x0B, 0x28, 0x2D, 0x35, 0xC2, 0x30,
+  0x98, 0xFC, 0xC1, 0x21, 0x3B, 0x1B, 0x00, 0xC6, 0xFE, 0xB4, 0x26, 0x36, 0x42, 0x29, 0x26, 0x3F,
+  0xA7, 0x25, 0x35, 0xC3, 0x2D, 0x06, 0xFE, 0xB4, 0xC9, 0x00, 0xCB, 0xA2, 0xD7, 0xA4, 0xE6, 0xC0,
+  0x23, 0xC0, 0x26, 0xC1, 0x0D, 0xFE, 0xD4, 0xA9, 0x0B, 0x35, 0xCC, 0x0B, 0x06, 0x0D, 0x26, 0xC1,
+  0x23, 0xC0, 0x26, 0xC0, 0x9C, 0x2A, 0x00, 0xCB, 0x3F, 0x0B, 0x2D, 0x35, 0xC3, 0x01, 0x99, 0xEB,
+  0x9D, 0xAA, 0x29, 0x26, 0x36, 0xFE, 0xB4, 0x06, 0x00, 0xC5, 0xA4, 0x64, 0xFE, 0xE5, 0x27, 0xA3,
+  0x76, 0x26, 0x29, 0x26, 0xA6, 0x35, 0x01, 0x35, 0xC3, 0x32, 0x0B, 0xFE, 0xBD, 0x09, 0x09, 0xA3,
+  0xA6, 0x03, 0xA0, 0xA8, 0xC0, 0x5A, 0x45, 0x9F, 0x69, 0x9F, 0x48, 0x00, 0xC1, 0xA2, 0xE7, 0xA4,
+  0xE6, 0x5A, 0x23, 0x26, 0xC2, 0x51, 0xA8, 0x32, 0xFE, 0xF5, 0x88, 0x6F, 0x1C, 0x30, 0x35, 0x01,
+  0xC6, 0x35, 0x30, 0x1C, 0x3A, 0x2E, 0x11, 0x12, 0x26, 0xC2, 0x23, 0x26, 0x29, 0x9C, 0x1A, 0x00,
+  0xC1, 0x0B, 0x26, 0x34, 0x06, 0x09, 0x06, 0x03, 0x9F, 0x68, 0x9E, 0x59, 0xFE, 0xC5, 0x09, 0xFE,
+  0xFE, 0xED, 0x32, 0x35, 0xC3, 0x01, 0x1C, 0x9A, 0xDB, 0x7A, 0x26, 0x7E, 0x9D, 0x9A, 0x1A, 0x00,
+  0xC4, 0x22, 0x36, 0x26, 0x29, 0xC0, 0x2E, 0x30, 0x35, 0xC5, 0x01, 0x99, 0xDD, 0xFE, 0x88, 0xE3,
+  0x76, 0xC1, 0x5A, 0x29, 0xC1, 0x55, 0x06, 0x0E, 0xA1, 0xA8, 0x29, 0x26, 0x5A, 0x26, 0xC3, 0x0D,
+  0xFE, 0xC3, 0x66, 0xFE, 0xF5, 0xC8, 0x9C, 0xBB, 0x6F, 0x2E, 0x3A, 0xA2, 0x67, 0x6E, 0x1C, 0x6E,
+  0xC0, 0x1C, 0x10, 0x0B, 0x3A, 0x2E, 0x26, 0x1A, 0x38, 0x39, 0x0D, 0xA3, 0x66, 0xC3, 0x23, 0x26,
+  0x29, 0x9C, 0x0A, 0x0E, 0x06, 0xA1, 0xC7, 0x29, 0xC1, 0x26, 0x29, 0xC1, 0x2B, 0x0A, 0x01, 0x35,
+  0xC5, 0x30, 0x2E, 0x66, 0xC0, 0x5A, 0x36, 0x22, 0x00, 0xC4, 0xFE, 0x72, 0x83, 0x3B, 0x9C, 0xAC,
+  0x29, 0xC0, 0x3F, 0x35, 0xC7, 0xA2, 0x67, 0xFE, 0xA2, 0x25, 0x0D, 0xA3, 0x66, 0x5A, 0xC3, 0x26,
+  0x7A, 0x26, 0xC1, 0x23, 0x26, 0xC3, 0x17, 0xA3, 0x66, 0xFE, 0xED, 0x08, 0x2E, 0x66, 0xC2, 0x55,
+  0x6F, 0x29, 0xC2, 0x26, 0x1A, 0x29, 0xC2, 0x2E, 0x17, 0x30, 0x9D, 0xAA, 0x7F, 0xC3, 0x23, 0x26,
+  0xC1, 0x7A, 0x26, 0x23, 0xC3, 0x26, 0x0D, 0x34, 0x06, 0x35, 0xC7, 0x3A, 0x61, 0xC0, 0x21, 0x3B,
+  0xFE, 0x6A, 0x83, 0x00, 0xC4, 0xFE, 0x93, 0x65, 0x3B, 0x21, 0x29, 0x1A, 0x10, 0x01, 0x35, 0xC6,
+  0xA3, 0x56, 0xFE, 0xDD, 0x0A, 0x0D, 0x26, 0xC5, 0x23, 0x26, 0xC7, 0x0D, 0xFE, 0xB2, 0xA5, 0xFE,
+  0xF5, 0xA8, 0x21, 0x29, 0xCE, 0x21, 0x33, 0x0E, 0x0D, 0x26, 0xC7, 0x23, 0x26, 0xC5, 0x0D, 0x1F,
+  0x0B, 0x35, 0xC6, 0x01, 0x9A, 0xDB, 0x1A, 0x29, 0x21, 0x3B, 0xFE, 0x93, 0x45, 0x00, 0xC4, 0xFE,
+  0xAB, 0xE5, 0x36, 0x42, 0x29, 0xC0, 0x1C, 0x01, 0x35, 0xC7, 0xA3, 0x56, 0xFE, 0xC3, 0xE8, 0xFE,
+  0x80, 0x42, 0xA2, 0x66, 0xA2, 0x77, 0xCD, 0x17, 0xFE, 0xDC, 0x87, 0xFE, 0xFD, 0xE8, 0x9C, 0xAC,
+  0x21, 0x26, 0x29, 0xCA, 0x26, 0x21, 0x26, 0x00, 0x36, 0x17, 0x7F, 0xCD, 0x12, 0x08, 0x1B, 0x0B,
+  0x35, 0xC7, 0x01, 0x1C, 0x29, 0xC0, 0x5A, 0xA2, 0x86, 0x04, 0xFE, 0x00, 0x00, 0xC4, 0xFE, 0xC4,
+  0x46, 0x36, 0x26, 0x29, 0xC0, 0xA8, 0x14, 0x35, 0xC9, 0x0B, 0xFE, 0xD4, 0xA9, 0x11, 0x12, 0x0D,
+  0xA2, 0x77, 0x6E, 0xCA, 0x21, 0x11, 0xFE, 0xCB, 0xA6, 0x29, 0x3B, 0x2E, 0x56, 0xC3, 0x29, 0xC0,
+  0x26, 0xC3, 0x2E, 0x3B, 0x29, 0xFE, 0xCB, 0xC6, 0x11, 0x21, 0x6E, 0xCA, 0x21, 0x0D, 0x12, 0x11,
+  0xFE, 0xD4, 0xA9, 0xFE, 0xFE, 0xED, 0x35, 0xC9, 0x2D, 0x29, 0xC0, 0x5A, 0x36, 0xFE, 0xBC, 0x46,
+  0x00, 0xC4, 0xFE, 0xCC, 0x86, 0x36, 0x26, 0x7A, 0x2E, 0x35, 0xCB, 0x0B, 0x35, 0xFE, 0xE5, 0x4A,
+  0xFE, 0xCC, 0x08, 0x2B, 0x61, 0x6F, 0xCA, 0x12, 0x0D, 0xA8, 0x31, 0x39, 0xFE, 0xE4, 0xE7, 0x33,
+  0x38, 0x33, 0x2E, 0xC4, 0x33, 0x3B, 0x33, 0x08, 0x39, 0xFE, 0x99, 0x83, 0x0D, 0x12, 0x26, 0xCA,
+  0x1A, 0x2B, 0x23, 0x2C, 0x35, 0x0B, 0x35, 0xCA, 0x30, 0x2E, 0x29, 0x5A, 0x36, 0x97, 0xBF, 0x00,
+  0xC4, 0xFE, 0xCC, 0x87, 0x36, 0x26, 0x7A, 0x2E, 0x35, 0xC7, 0x6E, 0x0B, 0x01, 0x35, 0x2D, 0x35,
+  0x0B, 0x35, 0xFE, 0x91, 0x23, 0x17, 0x7F, 0xCC, 0x12, 0x0D, 0x2B, 0xA8, 0x31, 0xFE, 0xBB, 0x25,
+  0xA8, 0x31, 0xA4, 0x65, 0xA3, 0x66, 0x6E, 0xC0, 0x17, 0x3E, 0x1D, 0x25, 0xFE, 0xA2, 0x04, 0x2B,
+  0x0D, 0x12, 0x26, 0xCC, 0x55, 0x38, 0x35, 0x0B, 0x35, 0x2D, 0x35, 0x01, 0x0B, 0x3A, 0x35, 0xC7,
+  0x2E, 0x29, 0x5A, 0x36, 0x97, 0xBF, 0x00, 0xC4, 0xFE, 0xC4, 0x66, 0x36, 0x26, 0x7A, 0xA2, 0x67,
+  0x35, 0xC5, 0x6E, 0x2D, 0xFE, 0xCA, 0xE7, 0xFE, 0xDC, 0x28, 0xFE, 0xF6, 0x0B, 0x0B, 0x66, 0x35,
+  0xC0, 0x17, 0x38, 0x9C, 0xAB, 0x7F, 0xCE, 0x66, 0x12, 0x0D, 0x12, 0x26, 0xA2, 0x66, 0x7A, 0xC0,
+  0x30, 0x26, 0x12, 0x0D, 0x12, 0x1A, 0x26, 0xCE, 0x17, 0x38, 0xFE, 0xF6, 0x0B, 0x35, 0xC0, 0x06,
+  0x0B, 0x17, 0x2E, 0x2F, 0x2D, 0x3A, 0x35, 0xC5, 0x99, 0xEC, 0x29, 0x5A, 0x36, 0xFE, 0xC4, 0x66,
+  0x00, 0xC4, 0xFE, 0xB4, 0x26, 0x36, 0x26, 0x29, 0x3A, 0x35, 0xC5, 0x06, 0x97, 0xFF, 0xFE, 0xB1,
+  0x24, 0x66, 0xA5, 0x44, 0xFE, 0xCB, 0x47, 0x2C, 0x35, 0xA4, 0x45, 0x9A, 0xDD, 0x38, 0x9C, 0xAB,
+  0x7F, 0xD3, 0x17, 0xC2, 0x26, 0xD3, 0x17, 0x38, 0x28, 0x10, 0x35, 0x2C, 0x3E, 0x29, 0x06, 0x0B,
+  0x05, 0xA9, 0x11, 0x35, 0xC5, 0x3A, 0x61, 0x5A, 0x36, 0x11, 0x00, 0xC4, 0xFE, 0xA3, 0xA5, 0x3B,
+  0x9C, 0xAC, 0x29, 0x3A, 0x35, 0xC0, 0x6E, 0xA2, 0x67, 0x35, 0xC0, 0x66, 0x0B, 0xFE, 0xDC, 0x69,
+  0xFE, 0xB1, 0x24, 0xA4, 0x45, 0x61, 0x0B, 0x6E, 0xA8, 0x22, 0x3F, 0x05, 0x38, 0x17, 0x7F, 0xEC,
+  0x17, 0x38, 0x05, 0x3F, 0x0C, 0x10, 0x0B, 0x15, 0xA2, 0x67, 0x0B, 0x3F, 0xFE, 0xFE, 0xED, 0x30,
+  0x35, 0xC0, 0x0B, 0x3A, 0x35, 0xC0, 0x99, 0xEC, 0x29, 0x21, 0x3B, 0xFE, 0xA3, 0xA5, 0x00, 0xC4,
+  0xFE, 0x82, 0xE4, 0x3B, 0x21, 0x29, 0x3A, 0x35, 0x06, 0x05, 0xFE, 0xD4, 0x08, 0xFE, 0xFE, 0xAC,
+  0x06, 0x2D, 0x06, 0xFE, 0xCB, 0x27, 0xFE, 0xB1, 0x24, 0xA3, 0x56, 0xC2, 0x10, 0x62, 0xA5, 0x34,
+  0x2B, 0x62, 0x6E, 0xEC, 0x21, 0x2B, 0xA6, 0x74, 0x06, 0x10, 0xA2, 0x67, 0xC2, 0x0B, 0x39, 0xFE,
+  0xFE, 0xCD, 0x2D, 0x06, 0x3A, 0xFE, 0xD4, 0x08, 0x05, 0x06, 0x35, 0x99, 0xEC, 0x29, 0x56, 0x3B,
+  0xFE, 0x7A, 0xE4, 0x00, 0xC4, 0xFE, 0x51, 0xE2, 0x3B, 0x9D, 0x9B, 0x29, 0x6E, 0x2D, 0xA4, 0x55,
+  0xFE, 0xDC, 0x89, 0xFE, 0xA8, 0xC3, 0xFE, 0xC2, 0x86, 0x05, 0x0B, 0x9C, 0xCB, 0xFE, 0xBA, 0x05,
+  0x10, 0xA2, 0x67, 0x66, 0xC1, 0x21, 0xC0, 0x10, 0x9C, 0x7B, 0xF0, 0x10, 0x21, 0xC0, 0x1C, 0xC1,
+  0x21, 0x10, 0x38, 0x30, 0x0B, 0x05, 0xFE, 0xC2, 0xA6, 0x32, 0x04, 0x0B, 0x2D, 0x2E, 0x29, 0x5A,
+  0x3B, 0x37, 0x00, 0xC4, 0xA7, 0x52, 0x26, 0x29, 0xC1, 0x2D, 0x0B, 0x3E, 0xFE, 0xB1, 0x24, 0x10,
+  0x15, 0xFE, 0xDC, 0x49, 0xAA, 0x00, 0x15, 0x1C, 0xC3, 0x21, 0xC0, 0x1C, 0x2B, 0x66, 0xD3, 0x0D,
+  0x66, 0x12, 0xC0, 0x08, 0x0D, 0x26, 0xD3, 0x2B, 0x1C, 0x21, 0xC0, 0x1C, 0xC3, 0x15, 0x00, 0x97,
+  0xFF, 0x15, 0x10, 0x0B, 0x3E, 0xFE, 0xFE, 0xED, 0x2D, 0x29, 0x5A, 0x29, 0x26, 0x36, 0x99, 0xBE,
+  0xC5, 0xFE, 0xCC, 0x86, 0xA9, 0x51, 0x26, 0xC0, 0xA7, 0x24, 0xA2, 0x67, 0xFE, 0xBA, 0x25, 0x10,
+  0xA2, 0x67, 0x1C, 0x61, 0xA6, 0x33, 0x1C, 0xC2, 0x21, 0xC0, 0x10, 0xC0, 0x56, 0x12, 0xC0, 0x17,
+  0x7F, 0xCF, 0x17, 0x12, 0x34, 0xFE, 0xCC, 0x28, 0x1F, 0xC0, 0x28, 0x34, 0x0D, 0xA2, 0x77, 0x26,
+  0xCF, 0x17, 0x12, 0xC0, 0x08, 0x10, 0xC0, 0xA2, 0x67, 0xC0, 0x1C, 0xC2, 0x33, 0x0B, 0x15, 0x21,
+  0x10, 0x3D, 0x32, 0x61, 0x99, 0xEC, 0xC0, 0x36, 0x29, 0x00, 0xC6, 0xFE, 0x8B, 0x24, 0x3B, 0x9C,
+  0xAC, 0x69, 0xA7, 0x25, 0x9D, 0xAB, 0x15, 0x6B, 0xC0, 0x6E, 0xC0, 0x15, 0x1C, 0xC1, 0x21, 0x10,
+  0xC0, 0xA7, 0x23, 0x16, 0x66, 0x9C, 0x8B, 0x55, 0x9B, 0xCC, 0x17, 0x9D, 0xBB, 0x0D, 0xA3, 0x66,
+  0xCB, 0x17, 0x2B, 0xFE, 0xD4, 0xA9, 0xFE, 0xFE, 0xCD, 0x6E, 0xC2, 0x61, 0xFE, 0xCB, 0xE6, 0x26,
+  0x17, 0x26, 0xCB, 0x0D, 0x08, 0x17, 0x38, 0x1B, 0x2A, 0x11, 0x16, 0x9C, 0xBB, 0x9A, 0xDD, 0xC0,
+  0x21, 0x1C, 0xC1, 0x15, 0x21, 0xC0, 0x1C, 0xC0, 0x15, 0x0A, 0xA3, 0x65, 0x1A, 0x6B, 0x3B, 0x0C,
+  0x00, 0xC6, 0xFE, 0x39, 0x62, 0x3B, 0x56, 0x2E, 0xA8, 0x12, 0xFE, 0xDC, 0xCA, 0xFE, 0xB1, 0x04,
+  0xA4, 0x45, 0x66, 0xC1, 0x21, 0x1C, 0xC0, 0x21, 0x9D, 0xBA, 0x11, 0xFE, 0xED, 0x6A, 0x35, 0x01,
+  0x3A, 0x01, 0x35, 0x9D, 0xAB, 0x9A, 0xCC, 0xFE, 0xC3, 0xE8, 0xFE, 0xA2, 0x05, 0x12, 0x0D, 0x26,
+  0xC8, 0x66, 0x26, 0x2C, 0xFE, 0xFF, 0x0D, 0x2D, 0xC0, 0x35, 0xC0, 0x2D, 0x7F, 0x68, 0x1D, 0x21,
+  0x26, 0xC9, 0x0D, 0x12, 0x2F, 0x1B, 0x31, 0x23, 0x35, 0x01, 0xC0, 0x3A, 0x2D, 0xFE, 0xE5, 0x2A,
+  0xFE, 0xBA, 0x46, 0x0B, 0xA3, 0x56, 0x1C, 0xC0, 0x21, 0x1C, 0xC1, 0x21, 0x06, 0x15, 0xFE, 0xFE,
+  0x8A, 0x98, 0xFE, 0x33, 0x3B, 0x1A, 0x00, 0xC7, 0xFE, 0xAA, 0x85, 0xA4, 0x95, 0x56, 0xA2, 0x66,
+  0x09, 0x98, 0xFE, 0x21, 0x1C, 0xC3, 0x21, 0x10, 0x11, 0x35, 0xA3, 0x56, 0x35, 0xC3, 0x3A, 0x6F,
+  0x0B, 0x06, 0x2C, 0xFE, 0xAA, 0x65, 0x0D, 0x17, 0x26, 0xC6, 0x08, 0xFE, 0xC3, 0xA7, 0xFE, 0xFF,
+  0x0D, 0x2D, 0x35, 0xC4, 0x52, 0x9D, 0xC7, 0xFE, 0xBA, 0xE5, 0x0D, 0x26, 0xC6, 0x17, 0x0D, 0x01,
+  0x2C, 0xAB, 0x00, 0x0B, 0x06, 0x3A, 0x35, 0xC3, 0x0B, 0x2D, 0x09, 0x98, 0xFE, 0x21, 0x1C, 0xC3,
+  0x21, 0x10, 0x09, 0x32, 0x62, 0x30, 0x9C, 0x7B, 0xFE, 0x00, 0x00, 0xC8, 0xA3, 0xE7, 0xA7, 0xF4,
+  0x45, 0x7A, 0x10, 0x21, 0x1C, 0xC4, 0x21, 0x65, 0xFE, 0xED, 0x8B, 0xAA, 0x00, 0x2D, 0x35, 0xC5,
+  0x2D, 0x35, 0x06, 0x6E, 0xFE, 0xD4, 0xC9, 0xFE, 0x91, 0x23, 0x0D, 0x26, 0xC4, 0x65, 0x2B, 0xFE,
+  0xED, 0xEB, 0x01, 0x35, 0xC6, 0x99, 0xEC, 0x99, 0xDD, 0x26, 0x66, 0x26, 0xC4, 0x0D, 0x38, 0x0B,
+  0xFE, 0xFE, 0xED, 0x06, 0x35, 0x2D, 0x35, 0xC5, 0x2D, 0x0B, 0xFE, 0xED, 0x4A, 0x10, 0xA2, 0x67,
+  0x1C, 0xC4, 0x21, 0x10, 0x66, 0x08, 0xA1, 0x98, 0x99, 0x1C, 0x9D, 0x29, 0xC8, 0x7E, 0xFE, 0xA9,
+  0x64, 0xA1, 0x98, 0x21, 0xC0, 0x1C, 0xC4, 0x21, 0x10, 0xA6, 0x33, 0xFE, 0xF6, 0x4B, 0x01, 0x35,
+  0xC9, 0x66, 0xA4, 0x45, 0x99, 0xDD, 0xFE, 0x99, 0xE4, 0x0D, 0x26, 0xC3, 0x51, 0x2A, 0xFE, 0xFE,
+  0xAC, 0x35, 0xC7, 0x2E, 0x66, 0xFE, 0x99, 0xA4, 0x12, 0x26, 0xC3, 0x0D, 0xFE, 0xA1, 0xE4, 0x14,
+  0x0B, 0x30, 0x35, 0xC9, 0x01, 0x9C, 0xBA, 0xFE, 0xB9, 0xE5, 0x10, 0xA2, 0x67, 0x66, 0xC4, 0x21,
+  0xC0, 0x24, 0x45, 0x08, 0x00, 0xC8, 0xA0, 0xA8, 0xFE, 0x99, 0x24, 0x24, 0x1C, 0xC6, 0x21, 0x10,
+  0xA9, 0x10, 0xFE, 0xF5, 0xA8, 0x2D, 0x01, 0x35, 0xC9, 0x2D, 0xA3, 0x66, 0x35, 0xFE, 0xA2, 0x05,
+  0x0D, 0x26, 0xC2, 0x0D, 0xFE, 0xA2, 0x45, 0x06, 0x35, 0xC6, 0x30, 0x98, 0xEC, 0x33, 0x23, 0xFE,
+  0x80, 0x82, 0xA2, 0x77, 0xC2, 0x0D, 0x2F, 0x35, 0x06, 0x2D, 0x35, 0xC9, 0x01, 0x2D, 0x33, 0x0A,
+  0x10, 0x21, 0x1C, 0xC6, 0x24, 0x02, 0xFE, 0x10, 0x00, 0x00, 0xC8, 0xFE, 0x68, 0x82, 0xA3, 0xB6,
+  0x1C, 0xC7, 0x21, 0x10, 0x3D, 0xFE, 0xED, 0x68, 0x2E, 0xA5, 0x36, 0x30, 0x35, 0xC2, 0x01, 0xC1,
+  0x35, 0xC2, 0x2D, 0x01, 0x9D, 0xAA, 0xFE, 0x99, 0x84, 0x12, 0xA2, 0x77, 0xC1, 0x12, 0x2A, 0x3A,
+  0x35, 0xC5, 0x01, 0x9B, 0xCA, 0x9A, 0xDB, 0x2E, 0x16, 0x12, 0x26, 0xC1, 0x12, 0x11, 0x28, 0x01,
+  0x2D, 0x35, 0xC2, 0x01, 0xC1, 0x35, 0xC2, 0x30, 0x1C, 0x2E, 0x52, 0x38, 0x9A, 0xDD, 0xA2, 0x67,
+  0x66, 0xC7, 0x31, 0x09, 0x00, 0xC7, 0xA2, 0xD7, 0xA4, 0xF6, 0x17, 0xA5, 0x85, 0x21, 0x1C, 0xC6,
+  0x21, 0x15, 0xFE, 0xE4, 0x87, 0x33, 0x1A, 0x7F, 0x2E, 0xC0, 0x6F, 0xC0, 0xA2, 0x67, 0x6E, 0xA2,
+  0x67, 0x35, 0x01, 0xC0, 0x35, 0xC0, 0x2D, 0xA4, 0x55, 0xFE, 0xE5, 0x6A, 0xFE, 0x88, 0xA2, 0x6F,
+  0xC1, 0x66, 0x2B, 0x0F, 0x01, 0x35, 0xC3, 0x01, 0x30, 0x2E, 0xC0, 0x9B, 0xBC, 0x26, 0x21, 0x26,
+  0xC1, 0x1A, 0x31, 0x0B, 0x2D, 0x35, 0xC0, 0x01, 0xC0, 0x35, 0x51, 0x10, 0x66, 0x3A, 0xC0, 0x2E,
+  0xC0, 0x29, 0x55, 0x33, 0xFE, 0xE4, 0x67, 0xFE, 0xB1, 0x44, 0xA2, 0x67, 0x1C, 0xC6, 0x21, 0x0D,
+  0x17, 0xA1, 0x98, 0x9C, 0x1A, 0x00, 0xC6, 0xFE, 0x70, 0xA2, 0xA1, 0xA8, 0x17, 0xA3, 0x86, 0x24,
+  0x1C, 0xC6, 0x21, 0x10, 0x3D, 0xFE, 0xED, 0x48, 0x33, 0x2E, 0x66, 0xC2, 0x5A, 0xC0, 0x29, 0x2E,
+  0xA2, 0x67, 0xA3, 0x57, 0x35, 0x01, 0x35, 0x2D, 0xA5, 0x44, 0xFE, 0xBB, 0x87, 0xFE, 0x80, 0x42,
+  0xA4, 0x55, 0xC1, 0x08, 0xFE, 0xC3, 0x87, 0xFE, 0xFF, 0x2D, 0x2D, 0x35, 0xC1, 0x01, 0x35, 0x3A,
+  0x1A, 0xA5, 0x54, 0x1B, 0xFE, 0x80, 0x62, 0x26, 0xC1, 0x08, 0x02, 0x10, 0x2D, 0x35, 0x01, 0x35,
+  0x1C, 0x3F, 0x2E, 0x29, 0x5A, 0xC0, 0x29, 0xC2, 0x2E, 0x33, 0x21, 0x38, 0x9A, 0xDD, 0xA2, 0x67,
+  0x66, 0xC6, 0x24, 0x36, 0x17, 0x7F, 0x11, 0xFE, 0x00, 0x00, 0xC5, 0xA1, 0xB7, 0xFE, 0x90, 0xC3,
+  0x26, 0xC1, 0xA5, 0x84, 0x21, 0x1C, 0xC6, 0x21, 0x10, 0x3D, 0x39, 0xA5, 0x43, 0x1A, 0x7E, 0x1A,
+  0x79, 0xC0, 0x6B, 0x22, 0x6B, 0x5A, 0xC0, 0x2E, 0xA4, 0x46, 0x35, 0x01, 0x69, 0x9C, 0xBC, 0xFE,
+  0x91, 0x23, 0x17, 0x7F, 0xC0, 0x66, 0x26, 0xFE, 0xDD, 0x09, 0xFE, 0xFE, 0xED, 0x35, 0x5A, 0x2D,
+  0x10, 0x9B, 0xCB, 0x66, 0xA5, 0x53, 0xFE, 0xD4, 0x26, 0xFE, 0x88, 0xA3, 0x6E, 0xC1, 0x17, 0x38,
+  0x28, 0x3A, 0x01, 0x35, 0x10, 0x2E, 0x56, 0xC0, 0x29, 0x22, 0x66, 0x16, 0xC0, 0x1A, 0x22, 0x1A,
+  0x62, 0x9B, 0xBD, 0xFE, 0xBA, 0x05, 0x9A, 0xDD, 0xA2, 0x67, 0x1C, 0xC6, 0x21, 0x65, 0x9B, 0x8C,
+  0xC2, 0x11, 0x9F, 0x59, 0xC4, 0xA3, 0xE6, 0xA3, 0xE7, 0x4A, 0x26, 0x17, 0x36, 0x24, 0x1C, 0xC7,
+  0x21, 0x1C, 0x9C, 0xBA, 0xFE, 0xC3, 0x0A, 0xFE, 0xEE, 0xB8, 0xA3, 0x66, 0x9D, 0xA8, 0x65, 0x9E,
+  0xA7, 0x9D, 0xB7, 0x9D, 0xB7, 0x1A, 0x16, 0x22, 0x6B, 0x5A, 0x7E, 0xA5, 0x36, 0x32, 0xA4, 0x55,
+  0xFE, 0xBB, 0x67, 0xFE, 0x80, 0x42, 0xA4, 0x55, 0xC1, 0x17, 0x7E, 0xFE, 0xCB, 0xE6, 0x3F, 0x7E,
+  0x55, 0x33, 0x38, 0x33, 0xFE, 0xCB, 0xC6, 0x26, 0x17, 0x26, 0xC1, 0x08, 0x3D, 0xFE, 0xFF, 0x0D,
+  0x32, 0x1C, 0x2E, 0x56, 0x29, 0x22, 0x16, 0x1A, 0x39, 0x24, 0x0F, 0xA2, 0x69, 0x3A, 0x21, 0x9D,
+  0xAA, 0xFE, 0xC3, 0x09, 0xFE, 0xA8, 0xC3, 0xA5, 0x45, 0x6E, 0x1C, 0xC7, 0x7E, 0x36, 0x17, 0x7F,
+  0x23, 0xA0, 0xA8, 0x31, 0x00, 0xC4, 0xFE, 0x60, 0x82, 0x29, 0x23, 0x26, 0xC1, 0xA4, 0x85, 0x24,
+  0x1C, 0xC7, 0x60, 0xFE, 0xD4, 0x30, 0xFE, 0xF7, 0x7E, 0xA3, 0x56, 0x66, 0xC2, 0x66, 0x64, 0x9C,
+  0xB8, 0x0F, 0x9B, 0xD6, 0x1A, 0x1D, 0x6F, 0x5A, 0xA2, 0x77, 0xA8, 0x13, 0xFE, 0xE5, 0x8B, 0xFE,
+  0x88, 0xA2, 0x6F, 0xC2, 0x66, 0x12, 0xAA, 0x20, 0xFE, 0xC3, 0x45, 0xA6, 0x43, 0x6E, 0x9A, 0xCE,
+  0x1E, 0x12, 0x21, 0x26, 0xC2, 0x1A, 0xFE, 0xE5, 0xAB, 0x3A, 0x98, 0xFD, 0x51, 0x29, 0x65, 0x5A,
+  0x05, 0x0F, 0x19, 0x0C, 0x1F, 0x24, 0xC2, 0x6E, 0x61, 0xFE, 0xD4, 0x50, 0x04, 0x1C, 0xC7, 0x7E,
+  0x0D, 0x9C, 0x8B, 0xC1, 0x5A, 0xA0, 0xA8, 0x06, 0x00, 0xC4, 0x09, 0x26, 0xC2, 0x21, 0x26, 0x15,
+  0x6F, 0x1C, 0xC4, 0x21, 0x04, 0xFE, 0xD4, 0xB2, 0xFE, 0xFF, 0xFF, 0x18, 0x0C, 0x18, 0x31, 0x66,
+  0x31, 0x51, 0x18, 0x6F, 0xC0, 0x18, 0x9A, 0xD8, 0x99, 0xF5, 0x1A, 0x22, 0x6B, 0xC0, 0xA5, 0x35,
+  0xFE, 0x99, 0xA4, 0x12, 0x26, 0xC3, 0x12, 0x66, 0x12, 0xC0, 0x0D, 0x12, 0x26, 0xC3, 0x12, 0xAA,
+  0x10, 0x10, 0x29, 0xC0, 0x22, 0x1A, 0x24, 0xA7, 0x1B, 0x18, 0x6F, 0xC0, 0x18, 0x1D, 0x31, 0x2C,
+  0x31, 0x18, 0x0C, 0x18, 0x31, 0x05, 0x04, 0x21, 0x1C, 0xC4, 0x21, 0x15, 0x26, 0x66, 0x26, 0xC2,
+  0x09, 0x00, 0xC4, 0xFE, 0x70, 0x82, 0x26, 0xC3, 0x17, 0x26, 0xA4, 0x85, 0xA2, 0x87, 0x1C, 0xC2,
+  0x6E, 0x04, 0xFE, 0xC3, 0x2C, 0xFE, 0xF7, 0xFF, 0x9C, 0xCA, 0x18, 0x1D, 0x9D, 0xAA, 0xFE, 0x9C,
+  0xF3, 0x98, 0xCC, 0xA6, 0x55, 0xFE, 0xE7, 0x3C, 0xA5, 0x65, 0x51, 0xC0, 0x18, 0x6F, 0xC0, 0x9A,
+  0xD8, 0xFE, 0xED, 0xCD, 0x9C, 0xC5, 0x1A, 0x33, 0xFE, 0xAA, 0x64, 0xFE, 0x80, 0x62, 0x26, 0xCE,
+  0x0D, 0x3A, 0x33, 0x1A, 0x79, 0x18, 0x19, 0x24, 0xC0, 0x65, 0x11, 0xC0, 0x7F, 0x35, 0x2D, 0x31,
+  0x01, 0x04, 0x1D, 0x18, 0x0C, 0x2E, 0xFE, 0xC3, 0x2C, 0xFE, 0xB1, 0x23, 0x21, 0x1C, 0xC2, 0x7E,
+  0x45, 0x26, 0x17, 0x26, 0xC3, 0x9E, 0x79, 0x00, 0xC4, 0x09, 0x26, 0xC4, 0x17, 0x26, 0xA3, 0x86,
+  0x21, 0x24, 0x21, 0x1C, 0x21, 0x61, 0xFE, 0xE6, 0x38, 0xFE, 0xF7, 0xDF, 0x9D, 0xB9, 0x1D, 0x51,
+  0xFE, 0x6B, 0x4D, 0x93, 0xEE, 0xA2, 0x77, 0x3D, 0xA9, 0x44, 0x35, 0x1D, 0x18, 0xC2, 0x6F, 0x1F,
+  0x98, 0xF6, 0xFE, 0xED, 0x49, 0xA3, 0x63, 0xFE, 0xBB, 0x05, 0x0D, 0x26, 0xCE, 0x0D, 0xFE, 0xBB,
+  0x25, 0x2C, 0x9D, 0xAC, 0x2E, 0x1F, 0x24, 0x18, 0xC2, 0x1D, 0x35, 0x1C, 0x98, 0xCC, 0x11, 0x3D,
+  0x04, 0x09, 0x1D, 0x61, 0x29, 0x31, 0x10, 0xA2, 0x67, 0x66, 0x21, 0x7A, 0x21, 0x05, 0x26, 0x17,
+  0x26, 0xC4, 0x9E, 0x69, 0x00, 0xC4, 0xA4, 0xF6, 0xA2, 0xD7, 0x23, 0x26, 0xC4, 0x17, 0xA2, 0x87,
+  0x05, 0x15, 0x21, 0x10, 0xA7, 0x24, 0xFE, 0xEF, 0x7D, 0x18, 0x09, 0xA4, 0x66, 0xFE, 0xAD, 0x75,
+  0xFE, 0x39, 0xC7, 0xA5, 0x55, 0x66, 0x39, 0x0C, 0x2D, 0x31, 0x09, 0x18, 0xC3, 0xA2, 0x67, 0x9B,
+  0xC9, 0xFE, 0xF6, 0x2E, 0xFE, 0xC3, 0x86, 0x0D, 0x26, 0xCE, 0x0D, 0x3E, 0x31, 0xFE, 0xEF, 0x3B,
+  0x29, 0x18, 0xC3, 0x09, 0xA4, 0x66, 0x2D, 0x0C, 0x39, 0x34, 0x39, 0x0C, 0xFE, 0xAD, 0x75, 0x31,
+  0x09, 0x18, 0x09, 0x0B, 0x10, 0x21, 0x15, 0x05, 0x2E, 0x17, 0x26, 0xC4, 0x23, 0xA0, 0xA8, 0x03,
+  0x00, 0xC4, 0xA2, 0xD7, 0x29, 0x23, 0x7A, 0xC5, 0x17, 0xC0, 0x26, 0xA2, 0x76, 0x9D, 0xBA, 0xFE,
+  0xB2, 0x8A, 0xFE, 0xF7, 0xDF, 0x18, 0x09, 0x31, 0xFE, 0x94, 0x92, 0x11, 0x34, 0x55, 0x34, 0x11,
+  0xB0, 0x00, 0xFE, 0xFF, 0xFF, 0x18, 0xC4, 0x69, 0xA1, 0x79, 0x29, 0xFE, 0xC3, 0xEA, 0xFE, 0x80,
+  0x61, 0x26, 0xCE, 0x06, 0x29, 0xFE, 0xF7, 0xDE, 0x24, 0x11, 0x18, 0xC4, 0x31, 0xFE, 0x7B, 0xEF,
+  0xFE, 0x39, 0xE7, 0x34, 0x25, 0x34, 0x11, 0x28, 0xFE, 0xFF, 0xFF, 0x09, 0x18, 0xA2, 0x67, 0x2C,
+  0x1D, 0x33, 0x26, 0x17, 0xC0, 0x26, 0xC5, 0x23, 0xA0, 0xA8, 0x9C, 0x1A, 0x00, 0xC4, 0xA1, 0x97,
+  0xFE, 0x88, 0xC3, 0xCB, 0x06, 0xFE, 0x9A, 0x49, 0xFE, 0xF7, 0xDF, 0x18, 0x09, 0x31, 0xFE, 0xB5,
+  0xB6, 0x0C, 0x34, 0xC0, 0x39, 0x9A, 0xBB, 0x01, 0x31, 0x09, 0x18, 0xC1, 0x69, 0x18, 0x24, 0x9C,
+  0xC7, 0x9A, 0xF1, 0xFE, 0xC3, 0x65, 0x0D, 0x26, 0xCE, 0x0D, 0x32, 0x37, 0x2D, 0x24, 0x18, 0x11,
+  0x18, 0xC1, 0x09, 0x31, 0x01, 0x3D, 0x39, 0x34, 0xC0, 0x0C, 0xFE, 0xB5, 0xB6, 0x31, 0x09, 0x18,
+  0x29, 0x12, 0x06, 0x26, 0xCB, 0x0B, 0x00, 0xC5, 0xFE, 0x60, 0x82, 0xA2, 0xC7, 0x23, 0x26, 0xC8,
+  0x17, 0xA6, 0x45, 0xFE, 0xEF, 0x3C, 0xA4, 0x56, 0x18, 0xC1, 0xFE, 0x7B, 0xCF, 0x0C, 0x6E, 0x0C,
+  0x04, 0xFE, 0xEF, 0x5D, 0x1D, 0x18, 0xC2, 0x24, 0x60, 0x9C, 0xC3, 0x9C, 0xC4, 0x9C, 0xD8, 0x20,
+  0x0D, 0x26, 0xCE, 0x0D, 0x20, 0x00, 0x2D, 0x39, 0x0C, 0x24, 0x18, 0xC2, 0x1D, 0x04, 0xFE, 0x6B,
+  0x4D, 0x94, 0xEE, 0x11, 0x0C, 0xFE, 0x7B, 0xEF, 0x18, 0xC1, 0x1D, 0x38, 0xFE, 0x91, 0x45, 0x17,
+  0x26, 0xC8, 0x23, 0x29, 0x06, 0x9C, 0x0A, 0xC6, 0xA1, 0xB7, 0x26, 0xCB, 0x9D, 0xA9, 0xFE, 0xD5,
+  0x75, 0xFE, 0xFF, 0xFF, 0x9C, 0xBA, 0x18, 0x1D, 0x18, 0x3D, 0x28, 0xA7, 0x44, 0x09, 0x1D, 0x65,
+  0x18, 0xC0, 0x24, 0x18, 0x9C, 0xC5, 0x9C, 0xC3, 0xA0, 0x95, 0x9C, 0xBB, 0x9D, 0xB9, 0xFE, 0xAA,
+  0x44, 0x0D, 0x26, 0xCE, 0x0D, 0x35, 0x33, 0x10, 0x2E, 0x00, 0x13, 0x18, 0x24, 0x18, 0xC0, 0x11,
+  0x1D, 0x09, 0x29, 0x28, 0x3D, 0x18, 0x1D, 0x18, 0x0C, 0x31, 0xFE, 0xD5, 0x55, 0x06, 0x26, 0xCB,
+  0x9B, 0x0A, 0x9F, 0x59, 0xC7, 0xA3, 0xE6, 0xA3, 0xE7, 0x23, 0x26, 0xC8, 0x51, 0xAA, 0x13, 0x18,
+  0x1D, 0x65, 0xC0, 0x18, 0xA3, 0x66, 0xC1, 0x1D, 0x18, 0x24, 0x1F, 0x9F, 0x96, 0x9D, 0xB5, 0x9C,
+  0xC5, 0x9F, 0xA5, 0x6F, 0x66, 0x99, 0xEB, 0x52, 0xFE, 0x91, 0x43, 0x12, 0x26, 0xCE, 0x12, 0xA7,
+  0x32, 0x21, 0x2E, 0x30, 0x35, 0x29, 0x07, 0x0C, 0x05, 0x24, 0xC0, 0x18, 0x1D, 0x31, 0xC1, 0x18,
+  0x11, 0xC0, 0x1D, 0x18, 0xFE, 0x99, 0xC7, 0x12, 0x26, 0xC8, 0x23, 0xA0, 0xA8, 0x9D, 0x29, 0x00,
+  0xC9, 0xFE, 0x68, 0x82, 0x29, 0x23, 0x26, 0xC8, 0x9C, 0xBA, 0xFE, 0xAB, 0x0B, 0xFE, 0xF7, 0xDF,
+  0x24, 0xC1, 0x56, 0xC0, 0x69, 0x18, 0x9E, 0xA7, 0x13, 0x9E, 0xA5, 0x9E, 0xA5, 0x74, 0x35, 0x3C,
+  0x35, 0x99, 0xEC, 0x2E, 0xFE, 0xDC, 0x67, 0x12, 0xA2, 0x77, 0xC2, 0x17, 0x0D, 0xC6, 0x17, 0x26,
+  0xC2, 0x12, 0x31, 0x2E, 0x3A, 0x35, 0x3C, 0x35, 0x29, 0x39, 0xA2, 0x6B, 0x13, 0xA2, 0x6A, 0x18,
+  0x15, 0x1C, 0xC0, 0x24, 0xC1, 0x6E, 0x04, 0x01, 0xA4, 0x56, 0xC8, 0x23, 0xA0, 0xA8, 0x09, 0x00,
+  0xCA, 0x7A, 0xA4, 0xF6, 0x29, 0x26, 0xC8, 0x2B, 0x99, 0xDC, 0xFE, 0xB3, 0x4C, 0xFE, 0xF7, 0x7A,
+  0x60, 0x13, 0x64, 0x69, 0x9F, 0x96, 0x64, 0x35, 0x65, 0x6E, 0x35, 0x3C, 0xC0, 0x35, 0x9A, 0xDB,
+  0x1A, 0xA4, 0x55, 0x0E, 0x0D, 0x26, 0xC0, 0x66, 0x0D, 0x3D, 0xA7, 0x32, 0x7A, 0xC4, 0x2D, 0x3D,
+  0x0D, 0x21, 0x26, 0xC0, 0x0D, 0x0E, 0x38, 0x1A, 0x3F, 0x35, 0xC0, 0x3C, 0x35, 0x2E, 0x29, 0x35,
+  0x0C, 0x1F, 0x39, 0x00, 0x13, 0x6F, 0x37, 0x18, 0xFE, 0x78, 0x00, 0x2B, 0x26, 0xC8, 0x7A, 0x09,
+  0x03, 0x5A, 0xCC, 0xA3, 0xE6, 0x23, 0x26, 0xC7, 0x0D, 0xFE, 0xAA, 0x85, 0xFE, 0xED, 0xAA, 0x2E,
+  0xC1, 0x66, 0x2E, 0xC0, 0x35, 0xC0, 0x3C, 0xC0, 0x35, 0x6F, 0x35, 0x3F, 0x1A, 0xA2, 0x77, 0x9B,
+  0xBC, 0x2B, 0x21, 0x26, 0x65, 0x26, 0xFE, 0xC3, 0x86, 0xFE, 0xED, 0x48, 0xA3, 0x65, 0xC6, 0x21,
+  0x3E, 0x26, 0x1A, 0x26, 0x66, 0x2B, 0x08, 0x2E, 0x51, 0x3F, 0x35, 0x01, 0x35, 0x3C, 0xC0, 0x35,
+  0xC0, 0x69, 0xC0, 0x29, 0x2E, 0xC1, 0x99, 0xDE, 0x06, 0x0D, 0x26, 0xC7, 0x23, 0x31, 0x00, 0xCF,
+  0xA4, 0xF6, 0xA2, 0xD7, 0x23, 0x26, 0xC4, 0x0D, 0xFE, 0xAA, 0x65, 0xFE, 0xFE, 0xCD, 0xC0, 0x35,
+  0x3C, 0xC3, 0x35, 0xC2, 0x6F, 0x9D, 0xAA, 0x3A, 0x61, 0x5A, 0x38, 0xFE, 0xB2, 0x85, 0x0D, 0xA3,
+  0x66, 0xC0, 0x17, 0xFE, 0xD4, 0x06, 0xFE, 0xFD, 0xE8, 0x29, 0x5A, 0xC6, 0x29, 0x00, 0x18, 0x17,
+  0x7F, 0xC0, 0x0D, 0x09, 0x38, 0x9D, 0xAB, 0x29, 0x3A, 0xA5, 0x35, 0x01, 0x35, 0xC2, 0x3C, 0xC3,
+  0x35, 0x06, 0xC0, 0xFE, 0xAA, 0x65, 0x0D, 0xA3, 0x66, 0xC4, 0x23, 0xA0, 0xA8, 0x03, 0x9C, 0x1A,
+  0xCF, 0xA1, 0x97, 0x17, 0x26, 0xC6, 0x65, 0xFE, 0xE5, 0x08, 0x06, 0x9D, 0xAA, 0x35, 0xC5, 0x6F,
+  0xC0, 0x61, 0x9C, 0xBA, 0x9C, 0xCA, 0xC0, 0x56, 0x38, 0x18, 0x12, 0x26, 0xC0, 0x0D, 0x09, 0x3B,
+  0x21, 0x29, 0xC8, 0x21, 0x3B, 0xFE, 0xAA, 0x85, 0x0D, 0x26, 0xC0, 0x12, 0x18, 0x38, 0x21, 0x29,
+  0xC0, 0x0B, 0x30, 0x01, 0xC0, 0x35, 0xC5, 0x2D, 0xA3, 0x66, 0x14, 0x1A, 0x26, 0xC6, 0x17, 0xFE,
+  0x10, 0x20, 0x00, 0xCE, 0x31, 0xA3, 0xE7, 0x23, 0x26, 0xC4, 0x12, 0xA9, 0x21, 0xFE, 0xF5, 0x68,
+  0x3F, 0x30, 0x01, 0xC3, 0x35, 0x30, 0x51, 0x3F, 0x29, 0x55, 0x29, 0x21, 0x33, 0x99, 0xDE, 0xFE,
+  0x89, 0x03, 0x17, 0x26, 0xC0, 0x12, 0x18, 0x33, 0x52, 0x29, 0xC8, 0x26, 0x33, 0x18, 0x12, 0xA2,
+  0x77, 0xC0, 0x17, 0x30, 0x08, 0x33, 0x21, 0x29, 0x1A, 0x29, 0x3F, 0x1C, 0xA2, 0x77, 0x35, 0x01,
+  0xC3, 0x30, 0x3F, 0x29, 0x16, 0x12, 0x26, 0xC4, 0x23, 0xA0, 0xA8, 0x9D, 0x19, 0x00, 0xCE, 0xFE,
+  0x68, 0x82, 0x26, 0x23, 0x26, 0xC4, 0x12, 0xFE, 0xA1, 0xE4, 0x33, 0x21, 0x7E, 0x3F, 0xC0, 0x6F,
+  0x3F, 0xC0, 0x3A, 0x65, 0x56, 0xC0, 0x29, 0xC0, 0x21, 0x33, 0x08, 0x3D, 0x12, 0xA2, 0x77, 0xC1,
+  0x17, 0xFE, 0xDC, 0x67, 0x33, 0x52, 0x29, 0xC8, 0x26, 0x33, 0x31, 0x17, 0x7F, 0xC1, 0x12, 0x3D,
+  0x08, 0x33, 0x21, 0x29, 0xC0, 0x5A, 0x29, 0x2E, 0x3A, 0x3F, 0xC0, 0x0B, 0x3F, 0xC0, 0x29, 0x21,
+  0x33, 0x23, 0x12, 0xA2, 0x77, 0xC4, 0x5A, 0x26, 0x09, 0x00, 0xCD, 0x7A, 0x17, 0x26, 0x23, 0x26,
+  0xC4, 0x12, 0xA7, 0x42, 0xFE, 0xED, 0x68, 0x29, 0xC0, 0x26, 0xC3, 0x29, 0xC2, 0x26, 0x29, 0x3B,
+  0xFE, 0xDC, 0x87, 0xFE, 0x91, 0x23, 0x12, 0xA2, 0x77, 0xC2, 0x12, 0x18, 0x33, 0x52, 0x29, 0xC8,
+  0x26, 0x33, 0x18, 0x12, 0xA2, 0x77, 0xC2, 0x12, 0x38, 0x36, 0x3B, 0x29, 0x5A, 0x29, 0xC2, 0x26,
+  0xC3, 0x29, 0xC0, 0x26, 0x05, 0x12, 0xA2, 0x77, 0xC4, 0x23, 0x26, 0x17, 0x03, 0x00, 0xCC, 0xA1,
+  0xA7, 0x26, 0xC8, 0x12, 0xFE, 0xD4, 0x26, 0x3B, 0x21, 0x29, 0xC3, 0x5A, 0xC1, 0x29, 0xA3, 0x55,
+  0x29, 0xFE, 0xC3, 0x45, 0xFE, 0x88, 0xC3, 0x12, 0x26, 0xC3, 0x0D, 0xFE, 0xAA, 0x64, 0x38, 0x9D,
+  0xAB, 0x29, 0xC8, 0x26, 0x38, 0x3A, 0x0D, 0xA3, 0x66, 0xC3, 0x12, 0x26, 0x2D, 0x29, 0x38, 0x29,
+  0x5A, 0xC1, 0x29, 0xC3, 0x21, 0x3B, 0x1D, 0x12, 0xA2, 0x77, 0xC8, 0xFE, 0x10, 0x20, 0x00, 0xCC,
+  0x0E, 0x26, 0x23, 0x26, 0xC6, 0x12, 0x3D, 0xFE, 0xE5, 0x07, 0x3B, 0x2E, 0x29, 0xC0, 0x2E, 0xC0,
+  0x33, 0xC0, 0x38, 0x21, 0xFE, 0xCB, 0xC6, 0xFE, 0x99, 0x83, 0xFE, 0x80, 0x62, 0xA2, 0x77, 0x26,
+  0xC5, 0x17, 0xFE, 0xD4, 0x47, 0x33, 0x52, 0x7A, 0xC6, 0x26, 0x33, 0xFE, 0xD4, 0x47, 0x17, 0x7F,
+  0xC5, 0x21, 0x0D, 0x0A, 0x0B, 0xFE, 0xED, 0x48, 0x38, 0x33, 0xC0, 0x2E, 0xC0, 0x66, 0xC0, 0x2E,
+  0x3B, 0x9A, 0xBD, 0x3D, 0x12, 0x26, 0xC8, 0x0E, 0x00, 0xCC, 0x0E, 0x26, 0xC9, 0x12, 0xA5, 0x54,
+  0xFE, 0xCB, 0xA6, 0x0D, 0x21, 0xC1, 0x61, 0x9D, 0x9B, 0x0B, 0xFE, 0xB2, 0xA5, 0x3D, 0x99, 0xDE,
+  0x12, 0x26, 0xC7, 0x12, 0x05, 0x29, 0x2E, 0x29, 0xC6, 0x2E, 0x29, 0x05, 0x12, 0x26, 0xC7, 0x12,
+  0x0D, 0x3D, 0x0E, 0x0B, 0x3B, 0x10, 0x21, 0xC1, 0x51, 0x06, 0x38, 0x12, 0x26, 0xC9, 0xFE, 0x18,
+  0x20, 0x00, 0xCC, 0x03, 0x17, 0x26, 0xC9, 0x17, 0x62, 0x2B, 0x3D, 0xC0, 0x38, 0x66, 0x26, 0x0D,
+  0xC0, 0x17, 0x26, 0xC9, 0x2B, 0x9B, 0xCC, 0xFE, 0xAA, 0x63, 0xFE, 0xF5, 0x87, 0x51, 0x7A, 0xC4,
+  0x13, 0x27, 0x33, 0x08, 0x2B, 0x26, 0xC9, 0x17, 0x0D, 0xC0, 0x26, 0xA2, 0x76, 0x38, 0x3D, 0xC0,
+  0x2B, 0x0D, 0x17, 0x26, 0xC9, 0x17, 0x03, 0x00, 0xCD, 0x09, 0x26, 0x23, 0x26, 0xC9, 0x65, 0x17,
+  0xC2, 0x26, 0xCD, 0x9C, 0xBA, 0xA7, 0x34, 0xFE, 0xAA, 0xCB, 0xFE, 0xED, 0xD0, 0xA4, 0x54, 0x66,
+  0x04, 0xC2, 0x3F, 0x04, 0x2D, 0x3A, 0xFE, 0x91, 0x24, 0x01, 0x26, 0xCD, 0x17, 0xC2, 0x1A, 0x26,
+  0xC9, 0x23, 0x26, 0x09, 0x00, 0xCE, 0xA3, 0xE6, 0xA3, 0xE7, 0x23, 0x26, 0xDC, 0x9D, 0xA9, 0xFE,
+  0xB3, 0x8E, 0xFE, 0xEF, 0x3C, 0xA6, 0x45, 0x24, 0xC8, 0xA2, 0x66, 0x38, 0x30, 0x06, 0x26, 0xDC,
+  0x23, 0x29, 0x9D, 0x29, 0x00, 0xCE, 0xA1, 0x97, 0x26, 0xCA, 0x1A, 0x0D, 0xC0, 0x12, 0x7F, 0x26,
+  0xCC, 0x01, 0x30, 0xFE, 0xFF, 0xFF, 0x51, 0x61, 0x11, 0xC8, 0x0C, 0x1D, 0x31, 0x30, 0x01, 0x26,
+  0xCC, 0x21, 0x12, 0x0D, 0xC0, 0x1A, 0x26, 0xCA, 0x0B, 0x00, 0xCF, 0xFE, 0x58, 0x61, 0x29, 0x23,
+  0x26, 0xC5, 0x1A, 0x08, 0xA6, 0x33, 0xA8, 0x22, 0xA2, 0x76, 0x9D, 0xAA, 0x2B, 0x08, 0x26, 0xCA,
+  0x17, 0xA5, 0x56, 0x38, 0x1D, 0x0C, 0x6F, 0xCA, 0x0C, 0x1D, 0x38, 0x3F, 0x17, 0x26, 0xCA, 0x08,
+  0x2B, 0x20, 0x39, 0x2C, 0x30, 0x08, 0x1A, 0x26, 0xC5, 0x23, 0x29, 0x37, 0x00, 0xD0, 0xA0, 0xA8,
+  0x17, 0x26, 0xC5, 0x12, 0x26, 0xFE, 0xC3, 0xC8, 0xFE, 0xEE, 0x0B, 0xA5, 0x54, 0x6F, 0x3A, 0x99,
+  0xDE, 0xFE, 0xBB, 0x67, 0x17, 0x1A, 0x26, 0xC8, 0x01, 0xFE, 0xAA, 0xEB, 0x31, 0x0C, 0x18, 0xCC,
+  0x0C, 0x31, 0xFE, 0xAA, 0xCB, 0x01, 0x26, 0xC8, 0x1A, 0x17, 0x3D, 0x0A, 0xA7, 0x32, 0x06, 0x3A,
+  0x14, 0x16, 0x26, 0x12, 0x26, 0xC5, 0x17, 0xFE, 0x10, 0x00, 0x00, 0xD1, 0xA1, 0xC7, 0x26, 0xC0,
+  0x23, 0x26, 0xC1, 0x17, 0x30, 0xFE, 0xE5, 0x6A, 0xFE, 0xFF, 0x0D, 0x9D, 0xBB, 0x35, 0xC1, 0x01,
+  0x10, 0xFE, 0xD4, 0xE9, 0x26, 0x1A, 0x12, 0xC0, 0x17, 0x26, 0xC4, 0x9C, 0xBA, 0xFE, 0xB3, 0x4D,
+  0xFE, 0xFF, 0xFF, 0x0C, 0x18, 0xCC, 0x0C, 0x31, 0x1F, 0x01, 0x26, 0xC4, 0x17, 0x12, 0xC0, 0x1A,
+  0x26, 0x10, 0xFE, 0xFF, 0x0D, 0x9D, 0xBB, 0x35, 0xC1, 0x01, 0x10, 0xFE, 0xE5, 0x6A, 0x30, 0x17,
+  0x26, 0xC1, 0x23, 0x26, 0xC0, 0x14, 0x00, 0xD3, 0xA2, 0xC7, 0x26, 0xC0, 0x5A, 0x26, 0xC0, 0x12,
+  0xFE, 0xDC, 0xE9, 0x10, 0x9B, 0xCC, 0x35, 0xC3, 0x2D, 0xA6, 0x33, 0xFE, 0xCC, 0x28, 0x12, 0xA8,
+  0x32, 0x6E, 0x9D, 0xAA, 0x0D, 0xC0, 0x26, 0xC2, 0x9C, 0xBA, 0x1F, 0xFE, 0xFF, 0xFF, 0x0C, 0x18,
+  0xCC, 0x0C, 0x31, 0x1F, 0x01, 0x26, 0xC2, 0x0D, 0xC0, 0x3D, 0x16, 0x11, 0x12, 0x28, 0x15, 0x2D,
+  0x35, 0xC3, 0x2D, 0x10, 0x13, 0x12, 0x26, 0xC0, 0x23, 0x26, 0xC0, 0x9C, 0x1A, 0x00, 0xD5, 0xA1,
+  0xB7, 0xA4, 0xF6, 0x29, 0x26, 0x0D, 0xFE, 0xAA, 0x65, 0xFE, 0xFE, 0xED, 0x2D, 0x35, 0xC6, 0x5A,
+  0x99, 0xDE, 0x2D, 0x35, 0x52, 0xFE, 0xDC, 0xEA, 0xFE, 0xA2, 0x25, 0x0D, 0x26, 0xC1, 0x9C, 0xBA,
+  0x1F, 0x31, 0x0C, 0x18, 0xCC, 0x0C, 0x31, 0x1F, 0x01, 0x26, 0xC1, 0x0D, 0x34, 0x1A, 0x28, 0x35,
+  0x2D, 0x02, 0x32, 0x35, 0xC6, 0x2D, 0x0B, 0xFE, 0xAA, 0x65, 0x0D, 0x26, 0x29, 0x14, 0x11, 0x00,
+  0xD7, 0x03, 0xA3, 0xD6, 0xA3, 0xC7, 0x9B, 0xCC, 0xFE, 0xCC, 0x48, 0x0B, 0x9C, 0xBB, 0x35, 0xC7,
+  0xA2, 0x67, 0x35, 0xC0, 0x3A, 0x0B, 0x06, 0xFE, 0xBB, 0x67, 0x0D, 0x2B, 0xC0, 0x9A, 0xDC, 0xFE,
+  0xAB, 0x4D, 0xFE, 0xFF, 0xFF, 0x0C, 0x18, 0xCC, 0x0C, 0x31, 0x1C, 0x3C, 0x2B, 0xC0, 0x0D, 0x3D,
+  0x06, 0x0B, 0x3A, 0x35, 0xC0, 0x06, 0x35, 0xC7, 0x2D, 0x0B, 0xFE, 0xCC, 0x48, 0x00, 0x23, 0x9D,
+  0x49, 0x03, 0x5A, 0xDB, 0xFE, 0x7A, 0x04, 0xFE, 0xF6, 0x2C, 0x35, 0xCD, 0x56, 0x35, 0x0B, 0xFE,
+  0xAA, 0xC6, 0xFE, 0x78, 0x22, 0x12, 0x65, 0xFE, 0xB3, 0x8D, 0x22, 0x9D, 0xAB, 0x24, 0x18, 0xC1,
+  0x24, 0x10, 0x78, 0xC0, 0x10, 0x24, 0x18, 0xC1, 0x24, 0x10, 0x22, 0x29, 0x06, 0x12, 0x00, 0x17,
+  0x0B, 0x35, 0x2D, 0x35, 0xCD, 0x23, 0x19, 0xFE, 0x00, 0x00, 0xDD, 0xFE, 0x4A, 0x03, 0xFE, 0xEE,
+  0xCD, 0x3A, 0x32, 0x35, 0xCE, 0xA2, 0x67, 0x0A, 0x2F, 0xFE, 0xD4, 0x89, 0x0A, 0x28, 0xA2, 0x68,
+  0xA1, 0x79, 0xA3, 0x5D, 0x18, 0x24, 0x0C, 0x9C, 0xC3, 0x07, 0x68, 0xC0, 0x07, 0xA2, 0x6B, 0x0C,
+  0x24, 0x18, 0x1A, 0x13, 0x00, 0x28, 0x0A, 0xFE, 0xCC, 0x69, 0x2F, 0x0A, 0x06, 0x35, 0xCE, 0x32,
+  0x3A, 0x4F, 0xFE, 0x4A, 0x03, 0xFE, 0x00, 0x00, 0xDB, 0xA4, 0x74, 0xFE, 0xE5, 0x48, 0xA9, 0x22,
+  0x32, 0x35, 0xD1, 0x6F, 0x0B, 0x01, 0x3A, 0x35, 0x69, 0x29, 0xA3, 0x4D, 0xA3, 0x4C, 0x9B, 0xE1,
+  0x29, 0x35, 0xC2, 0x29, 0x00, 0x2A, 0x2D, 0x29, 0x2E, 0x35, 0x3A, 0x01, 0x0B, 0x01, 0x35, 0xD1,
+  0x32, 0x29, 0x1E, 0x1D, 0x9C, 0x9C, 0xDA, 0xFE, 0x7A, 0xE4, 0xFE, 0xFD, 0xC8, 0x9C, 0xAB, 0xA8,
+  0x14, 0xA2, 0x78, 0x35, 0xD1, 0x56, 0x35, 0xC1, 0x3C, 0x35, 0xC0, 0x2D, 0x35, 0x3C, 0x35, 0xC2,
+  0x3C, 0x35, 0x2D, 0x35, 0xC0, 0x3C, 0x35, 0xC1, 0x2D, 0x35, 0xD2, 0x21, 0x1A, 0x3B, 0xFE, 0x7A,
+  0xC4, 0x00, 0xDA, 0xFE, 0xC4, 0x46, 0xFE, 0xFD, 0xA8, 0x1A, 0xA5, 0x46, 0x01, 0x35, 0xFC, 0x01,
+  0x0B, 0x1A, 0x36, 0xFE, 0xBC, 0x46, 0x00, 0xD9, 0x6E, 0xFE, 0xD4, 0xC7, 0xA6, 0x63, 0x56, 0x2E,
+  0x35, 0xFD, 0xC0, 0x2E, 0x26, 0x2E, 0x3D, 0x05, 0x00, 0xD9, 0xFE, 0xCC, 0x87, 0x36, 0x26, 0xC0,
+  0x0B, 0x01, 0x35, 0xFA, 0x01, 0x0B, 0x26, 0xC0, 0x36, 0x97, 0xBF, 0x00, 0xDA, 0xFE, 0x9B, 0x85,
+  0x3B, 0x9C, 0xAC, 0x7E, 0x26, 0x0B, 0x35, 0x01, 0xC3, 0x35, 0xEE, 0x01, 0xC3, 0x35, 0x0B, 0x26,
+  0x29, 0x21, 0x3B, 0x28, 0x00, 0xDA, 0xFE, 0x39, 0x62, 0x36, 0x26, 0xC0, 0x29, 0x26, 0x2E, 0xA4,
+  0x46, 0xA2, 0x67, 0xC0, 0x66, 0x10, 0x35, 0xEE, 0x10, 0x1C, 0x21, 0xC0, 0x10, 0x2E, 0x26, 0x29,
+  0x26, 0xC0, 0x36, 0x1A, 0x00, 0xDB, 0xFE, 0x8B, 0x24, 0xFE, 0xFD, 0xE9, 0x26, 0x29, 0xC1, 0x55,
+  0x29, 0xC1, 0x1A, 0x1C, 0x01, 0x35, 0xEA, 0x01, 0x1C, 0x1A, 0x29, 0xC1, 0x1A, 0x29, 0xC1, 0x26,
+  0x07, 0x0C, 0x00, 0xDD, 0x0C, 0x2E, 0x26, 0x29, 0xC6, 0x1C, 0x01, 0xC0, 0x35, 0xC0, 0x01, 0xC0,
+  0x35, 0xDE, 0x01, 0xC0, 0x35, 0xC0, 0x01, 0xC0, 0x1C, 0x29, 0xC6, 0x26, 0x2E, 0x0C, 0x00, 0xDF,
+  0xFE, 0xAB, 0xC5, 0x36, 0x26, 0x29, 0xC6, 0xA3, 0x56, 0x1C, 0xA2, 0x77, 0xC0, 0x21, 0x10, 0x9D,
+  0xBA, 0x30, 0x35, 0xDA, 0x30, 0x3A, 0x10, 0x21, 0x30, 0xC0, 0x1C, 0x3F, 0x26, 0x29, 0xC5, 0x26,
+  0x36, 0x38, 0x00, 0xE0, 0xFE, 0x62, 0x23, 0x3B, 0x9C, 0xAC, 0x29, 0xC7, 0x26, 0x29, 0xC1, 0x26,
+  0x1A, 0x0B, 0x01, 0x35, 0xD8, 0x01, 0x0B, 0x1A, 0x26, 0x29, 0xC1, 0x26, 0x29, 0xC7, 0x21, 0x3B,
+  0x0E, 0x00, 0xE0, 0xA2, 0x76, 0xFE, 0xDC, 0xE7, 0x36, 0x21, 0x29, 0xCD, 0x0B, 0x35, 0x01, 0x35,
+  0xC1, 0x01, 0xC0, 0x1C, 0x3A, 0x30, 0x01, 0x35, 0xC2, 0x01, 0x30, 0x3A, 0x1C, 0x01, 0xC0, 0x35,
+  0xC1, 0x01, 0x3C, 0x0B, 0x29, 0xCD, 0x21, 0x36, 0x05, 0xFE, 0x10, 0x40, 0x00, 0xE1, 0xFE, 0x41,
+  0x62, 0x2E, 0x36, 0x21, 0xC2, 0x26, 0x29, 0xC8, 0x26, 0x3A, 0x1C, 0x30, 0x35, 0x30, 0x55, 0x3F,
+  0x29, 0x26, 0x2E, 0xA4, 0x46, 0x2D, 0x35, 0xC0, 0x2D, 0x10, 0x2E, 0x26, 0x29, 0x3F, 0x21, 0x30,
+  0x35, 0x30, 0x1C, 0x3A, 0x26, 0x29, 0xC8, 0x26, 0x66, 0xC2, 0x36, 0x2E, 0xFE, 0x41, 0x82, 0x00,
+  0xE3, 0xAA, 0x50, 0xFE, 0xCC, 0xA7, 0x3B, 0xC2, 0x36, 0x29, 0x26, 0x29, 0xCA, 0x2E, 0xC0, 0x29,
+  0x26, 0x29, 0xC1, 0x21, 0x29, 0x2E, 0xC0, 0x29, 0x1A, 0x29, 0xC1, 0x26, 0x29, 0x2E, 0xC1, 0x29,
+  0xC9, 0x26, 0xC0, 0x36, 0x3B, 0xC2, 0x35, 0xFE, 0x39, 0x62, 0x00, 0xE5, 0x6E, 0xFE, 0x49, 0xC2,
+  0xAA, 0x50, 0xA3, 0x76, 0x9A, 0xAD, 0x0E, 0x2E, 0x26, 0xC0, 0x29, 0xC3, 0x26, 0x29, 0xDC, 0x26,
+  0x29, 0xC3, 0x26, 0xC0, 0x2E, 0xFE, 0x62, 0x43, 0x37, 0xA5, 0x74, 0x04, 0xFE, 0x49, 0xC2, 0x05,
+  0x00, 0xEC, 0x37, 0x07, 0x29, 0x21, 0x26, 0xC0, 0x21, 0x26, 0x2E, 0x29, 0xDC, 0x2E, 0x26, 0x21,
+  0x26, 0xC0, 0x21, 0x29, 0x07, 0x37, 0x00, 0xF3, 0xFE, 0x72, 0x83, 0x26, 0x3B, 0xC0, 0x36, 0x3B,
+  0x36, 0x3D, 0x29, 0x26, 0x29, 0xC6, 0x26, 0x29, 0xC6, 0x26, 0x29, 0xC6, 0x26, 0x29, 0x3D, 0x36,
+  0x3B, 0x36, 0x3B, 0xC0, 0x26, 0x23, 0x00, 0xF5, 0xA6, 0x63, 0xFE, 0x72, 0xA4, 0xA9, 0x50, 0x7E,
+  0x20, 0xFE, 0x49, 0xC2, 0x0D, 0xFE, 0xCC, 0xA7, 0x36, 0x21, 0x29, 0xC3, 0x26, 0xC0, 0x2E, 0x26,
+  0x29, 0xC4, 0x26, 0x2E, 0x26, 0xC0, 0x29, 0xC3, 0x21, 0x36, 0x35, 0x0D, 0x2F, 0x20, 0xA5, 0x74,
+  0x38, 0xFE, 0x72, 0xA4, 0x31, 0x00, 0xFD, 0x1A, 0x2E, 0xC0, 0x21, 0x26, 0xC1, 0x21, 0x2E, 0xC0,
+  0x9C, 0x9B, 0x3B, 0x21, 0x26, 0xC2, 0x21, 0x3B, 0x99, 0xBE, 0x2E, 0xC0, 0x21, 0x26, 0xC1, 0x21,
+  0x2E, 0xC0, 0x1D, 0x00, 0xFD, 0xC7, 0xFE, 0x49, 0xA2, 0xFE, 0xE5, 0x27, 0x3B, 0x36, 0xC1, 0x3B,
+  0x2E, 0xFE, 0x6A, 0x83, 0xFE, 0x18, 0x80, 0x0C, 0x3B, 0xC0, 0x36, 0xC0, 0x3B, 0xC0, 0x0C, 0x1D,
+  0x20, 0x2E, 0x3B, 0x36, 0xC1, 0x3B, 0x12, 0x2A, 0x00, 0xFD, 0xC9, 0xA4, 0x64, 0xFE, 0x7A, 0xA4,
+  0x0C, 0xA4, 0x74, 0x19, 0xFE, 0x8B, 0x04, 0xFE, 0x28, 0xE1, 0x00, 0xC1, 0xFE, 0x51, 0xC2, 0xFE,
+  0xA3, 0xA5, 0xA6, 0x63, 0xC0, 0x30, 0x32, 0x00, 0xC1, 0xA8, 0x51, 0xFE, 0x8B, 0x24, 0x19, 0x29,
+  0x9C, 0x9C, 0xFE, 0x7A, 0xA4, 0x1A, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xD9,
+};
+
+const uint8_t kAssetIcon6Data[3543] PROGMEM = {
+  0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xDC, 0x6E, 0xA5, 0x74, 0xA7, 0x53, 0xA7, 0x53, 0xA6, 0x63, 0xA6,
+  0x53, 0xA4, 0x65, 0xA3, 0x86, 0xA3, 0x66, 0x7E, 0x6E, 0xC0, 0x2B, 0x23, 0x0A, 0x9D, 0x8A, 0x9C,
+  0xAB, 0x1C, 0x9A, 0xAD, 0x2E, 0x31, 0x00, 0xFD, 0xCB, 0xA3, 0x75, 0x2E, 0xFE, 0x7B, 0x26, 0xFE,
+  0xB4, 0x88, 0xA9, 0x42, 0xA6, 0x53, 0xA3, 0x66, 0xA2, 0x66, 0xC1, 0x66, 0xC0, 0x06, 0xC4, 0x0B,
+  0xC0, 0x10, 0xC1, 0x06, 0x2D, 0x99, 0xCE, 0x98, 0xBE, 0x14, 0xFE, 0x41, 0xA3, 0xFE, 0x10, 0x61,
+  0x00, 0xFD, 0xC3, 0xA8, 0x52, 0xFE, 0x6A, 0xC5, 0xFE, 0xB4, 0xA9, 0xFE, 0xE6, 0x0B, 0x06, 0x10,
+  0x0B, 0x06, 0x65, 0x2D, 0xD0, 0x3A, 0x06, 0x0B, 0x10, 0x06, 0x9A, 0xCC, 0xFE, 0xB4, 0xA9, 0x38,
+  0x05, 0x00, 0xFB, 0xA5, 0x64, 0x38, 0xFE, 0xBD, 0x09, 0x2D, 0x10, 0x0B, 0x62, 0x2D, 0xC2, 0x6E,
+  0x7A, 0xC6, 0x01, 0xC0, 0x35, 0xC6, 0x32, 0x2D, 0xC2, 0x01, 0x0B, 0x10, 0x2D, 0xFE, 0xC5, 0x09,
+  0x38, 0x29, 0x00, 0xF6, 0xFE, 0x39, 0x83, 0xFE, 0xA4, 0x28, 0xFE, 0xEE, 0x2C, 0x10, 0x0B, 0x35,
+  0x2D, 0xC0, 0x32, 0x35, 0xC1, 0x01, 0xC2, 0x35, 0xC0, 0x66, 0xC1, 0x55, 0xC2, 0x30, 0xC1, 0x35,
+  0xC0, 0x01, 0xC2, 0x35, 0xC1, 0x32, 0x2D, 0xC0, 0x35, 0x0B, 0x10, 0x20, 0x19, 0x26, 0x00, 0xF2,
+  0xFE, 0x52, 0x24, 0x0C, 0x06, 0x0B, 0x61, 0x2D, 0xC0, 0x32, 0x35, 0xC0, 0x01, 0xC0, 0x35, 0xC0,
+  0x21, 0x66, 0x61, 0x65, 0x66, 0x65, 0xC0, 0x66, 0xC6, 0x2E, 0xC0, 0x3A, 0x3F, 0x0B, 0x1C, 0x21,
+  0x30, 0x35, 0x01, 0xC0, 0x35, 0xC0, 0x32, 0x2D, 0xC0, 0xA2, 0x76, 0xA2, 0x67, 0x06, 0x0C, 0x0F,
+  0x00, 0xEE, 0xFE, 0x52, 0x04, 0xFE, 0xC5, 0x2A, 0x0B, 0xC0, 0x32, 0x2D, 0x32, 0x35, 0xC0, 0x01,
+  0xC0, 0x30, 0x1C, 0x61, 0x61, 0x2E, 0x29, 0x5A, 0x65, 0x26, 0x29, 0xCC, 0x26, 0x1A, 0x26, 0x29,
+  0x2E, 0x3A, 0x0B, 0x1C, 0x30, 0x01, 0xC0, 0x35, 0xC0, 0x32, 0x2D, 0x32, 0xA3, 0x66, 0xC0, 0x1B,
+  0x0A, 0x00, 0xEA, 0xFE, 0x39, 0x62, 0xFE, 0xBC, 0xE9, 0x0B, 0x06, 0x32, 0x2D, 0x35, 0xC0, 0x01,
+  0xC0, 0x30, 0x9D, 0xA9, 0x3F, 0x2E, 0x29, 0x55, 0x29, 0xC5, 0x26, 0xCA, 0x29, 0xC5, 0x1A, 0x29,
+  0x2E, 0x3F, 0x10, 0x30, 0x01, 0xC0, 0x35, 0xC0, 0x2D, 0x32, 0x0B, 0xC0, 0x07, 0xFE, 0x39, 0x62,
+  0x00, 0xE6, 0x15, 0xFE, 0x93, 0xC7, 0x01, 0x0B, 0x32, 0x2D, 0x35, 0xC0, 0x01, 0x35, 0x1C, 0x3F,
+  0x29, 0x55, 0x29, 0xC3, 0x26, 0xC1, 0x29, 0x2E, 0xC1, 0x6E, 0xC1, 0x6E, 0x7A, 0xC0, 0x38, 0x33,
+  0xC2, 0x2E, 0xC0, 0x29, 0x26, 0xC1, 0x29, 0xC3, 0x1A, 0x29, 0x3F, 0x1C, 0x35, 0x01, 0x35, 0xC0,
+  0x2D, 0x32, 0x0B, 0x01, 0x3D, 0x15, 0x00, 0xE3, 0x0F, 0xFE, 0xDD, 0xEB, 0xA9, 0x31, 0x32, 0x2D,
+  0x35, 0xC0, 0x01, 0x30, 0x9C, 0xBA, 0x2E, 0x26, 0xC0, 0x29, 0xC1, 0x26, 0xC0, 0x29, 0x2E, 0x33,
+  0xC1, 0x2E, 0x52, 0x9D, 0xAA, 0x62, 0x9C, 0xBC, 0x66, 0x56, 0x9D, 0xAA, 0x9D, 0x9A, 0xC0, 0x01,
+  0x1A, 0x6E, 0x27, 0x3E, 0x08, 0x21, 0x2E, 0x33, 0xC1, 0x2E, 0x29, 0x26, 0xC0, 0x29, 0xC1, 0x26,
+  0xC0, 0x2E, 0x0B, 0x30, 0xA2, 0x67, 0x35, 0xC0, 0x2D, 0x32, 0x10, 0x09, 0x0A, 0x00, 0xE0, 0xA2,
+  0x76, 0xFE, 0x9C, 0x07, 0xFE, 0xFE, 0xED, 0x06, 0x2D, 0x35, 0xC0, 0x01, 0x30, 0x9C, 0xBA, 0x29,
+  0x55, 0x29, 0xC1, 0x26, 0xC0, 0x2E, 0x33, 0xC0, 0x2E, 0x9C, 0xBC, 0x9A, 0xCD, 0x9A, 0xCD, 0x9A,
+  0xDE, 0x9B, 0xBC, 0x9D, 0xAB, 0x9D, 0xBA, 0x56, 0x66, 0x66, 0x05, 0x9C, 0xAB, 0x9E, 0x79, 0xC0,
+  0x24, 0x05, 0x00, 0x05, 0x6E, 0x12, 0x28, 0x3A, 0x20, 0x01, 0x2C, 0xA6, 0x42, 0x2E, 0x33, 0xC0,
+  0x2E, 0x26, 0xC0, 0x29, 0xC1, 0x26, 0x29, 0x0B, 0x30, 0xA2, 0x67, 0x35, 0xC0, 0x2D, 0x06, 0x6E,
+  0xFE, 0x9C, 0x07, 0x0D, 0x52, 0xDD, 0xAA, 0x40, 0xFE, 0xD5, 0x8A, 0xFE, 0xFF, 0x0D, 0x32, 0x2D,
+  0x35, 0x01, 0x61, 0x9C, 0xBA, 0x29, 0x1A, 0x29, 0xC0, 0x26, 0xC0, 0x2E, 0x38, 0x33, 0x9C, 0xBC,
+  0x2C, 0xFE, 0xC3, 0x26, 0x3A, 0x9B, 0xCC, 0x05, 0x66, 0xC0, 0x05, 0x6E, 0xC1, 0x7E, 0xC1, 0x9D,
+  0x8A, 0x52, 0xC0, 0x33, 0x12, 0xC1, 0x0A, 0xC1, 0x05, 0x00, 0xC0, 0x05, 0x17, 0x3A, 0x2F, 0x2C,
+  0x1C, 0xA4, 0x54, 0x38, 0x2E, 0x56, 0xC0, 0x29, 0xC0, 0x26, 0x29, 0x0B, 0x30, 0x01, 0x35, 0x2D,
+  0x32, 0x10, 0xFE, 0xD5, 0x8A, 0xFE, 0x31, 0x42, 0xFE, 0x00, 0x00, 0xDB, 0xFE, 0x62, 0x64, 0x32,
+  0x06, 0x2D, 0x35, 0x01, 0x35, 0x9C, 0xBA, 0x2E, 0x55, 0x29, 0xC0, 0x26, 0x29, 0x33, 0xC0, 0x1C,
+  0xFE, 0xCB, 0xC6, 0xFE, 0xAA, 0x45, 0x9B, 0xDC, 0x05, 0x66, 0x05, 0x0A, 0x7E, 0xC2, 0x5A, 0x0A,
+  0xC2, 0x12, 0x9D, 0x8A, 0x9D, 0x9A, 0xC0, 0x33, 0x12, 0x0A, 0xC2, 0x0F, 0x12, 0xC2, 0x0A, 0x05,
+  0x00, 0x05, 0x1C, 0x3C, 0x0B, 0xFE, 0xED, 0x28, 0xA4, 0x54, 0xC0, 0x29, 0x26, 0x29, 0xC0, 0x26,
+  0x29, 0x10, 0x35, 0x01, 0x35, 0x2D, 0x06, 0x32, 0xFE, 0x62, 0x64, 0xFE, 0x00, 0x00, 0xD9, 0xFE,
+  0x8B, 0x86, 0xFE, 0xFE, 0xED, 0x35, 0x2D, 0x35, 0x01, 0x9D, 0xA9, 0x9B, 0xDB, 0x1A, 0x7F, 0xC0,
+  0x26, 0x29, 0x33, 0x2E, 0x98, 0xEF, 0xFE, 0xC2, 0xE6, 0xFE, 0x91, 0x23, 0x9A, 0xCD, 0xC0, 0xA6,
+  0x54, 0x12, 0xC1, 0x0A, 0xC8, 0x12, 0x9D, 0x8A, 0x17, 0xC0, 0x33, 0x12, 0x0A, 0xC8, 0x12, 0xC1,
+  0x02, 0x0D, 0xC0, 0x38, 0x25, 0x39, 0x2E, 0x6E, 0x29, 0x26, 0x29, 0xC0, 0x1A, 0x2E, 0x21, 0x01,
+  0x35, 0x2D, 0x35, 0x0B, 0xFE, 0x83, 0x66, 0x00, 0xD7, 0xFE, 0xA4, 0x48, 0xFE, 0xFF, 0x0D, 0x32,
+  0x2D, 0x01, 0x35, 0x9B, 0xCB, 0x29, 0xC1, 0x26, 0x29, 0x33, 0x29, 0xFE, 0xD4, 0x07, 0xFE, 0xBA,
+  0x45, 0x05, 0x66, 0x41, 0x5A, 0xC0, 0xA2, 0x76, 0x12, 0x0A, 0xCA, 0x12, 0x33, 0x17, 0xC0, 0x33,
+  0x12, 0x0A, 0xCA, 0x12, 0x33, 0x26, 0xC1, 0x00, 0x05, 0xA9, 0x10, 0x1F, 0xFE, 0xF5, 0x68, 0xA2,
+  0x66, 0x29, 0x5A, 0x29, 0xC0, 0x26, 0x0B, 0x35, 0x01, 0x2D, 0x32, 0x10, 0x1E, 0xFE, 0x00, 0x00,
+  0xD4, 0xA2, 0x76, 0xFE, 0xB4, 0xC9, 0x10, 0x2D, 0x35, 0x01, 0x9D, 0xA9, 0x2E, 0x1A, 0x29, 0x26,
+  0xC0, 0x33, 0x29, 0xFE, 0xD3, 0xE7, 0xFE, 0xB2, 0x05, 0x98, 0xEF, 0x05, 0x0F, 0x12, 0x42, 0x17,
+  0x7F, 0xC0, 0x0A, 0xCB, 0x12, 0x9D, 0x8A, 0x17, 0xC0, 0x33, 0x12, 0x0A, 0xCB, 0x26, 0xC0, 0x17,
+  0x02, 0x12, 0x0F, 0x05, 0x00, 0x35, 0x1A, 0x29, 0xA2, 0x66, 0x52, 0xC0, 0x29, 0x55, 0x2E, 0x21,
+  0x01, 0x65, 0x2D, 0x10, 0xFE, 0xB4, 0xA9, 0xFE, 0x08, 0x20, 0x56, 0xD1, 0xA5, 0x64, 0x07, 0x10,
+  0x2D, 0x35, 0x01, 0x9B, 0xCA, 0x9B, 0xDB, 0xC1, 0x26, 0x2E, 0x33, 0x27, 0xFE, 0xB2, 0x05, 0x98,
+  0xEF, 0x05, 0x12, 0xC0, 0x0A, 0xC1, 0x9C, 0x9B, 0xC0, 0x17, 0x02, 0x12, 0x0A, 0xC9, 0x12, 0x9D,
+  0x8A, 0x17, 0xC0, 0x33, 0x12, 0x0A, 0xC9, 0x12, 0x02, 0x17, 0x26, 0xC0, 0x0A, 0x7A, 0x0A, 0x12,
+  0xC0, 0x05, 0x00, 0x35, 0x27, 0x2E, 0xC0, 0x56, 0x29, 0xC1, 0x10, 0x01, 0x65, 0x2D, 0xA5, 0x44,
+  0x07, 0xFE, 0x18, 0xA1, 0x9B, 0xAC, 0xD0, 0xFE, 0x62, 0x64, 0xFE, 0xFF, 0x4E, 0x98, 0xFE, 0x35,
+  0xC0, 0x9A, 0xDB, 0x1A, 0x7F, 0x26, 0x29, 0xA3, 0x55, 0x98, 0xEF, 0xFE, 0xBA, 0x65, 0xFE, 0xA1,
+  0x04, 0x05, 0x12, 0xC0, 0x0A, 0xC2, 0x12, 0x9C, 0x9B, 0x17, 0x7A, 0x2E, 0x12, 0x0A, 0xC9, 0x12,
+  0x33, 0x17, 0xC0, 0x33, 0x12, 0x0A, 0xC9, 0x12, 0x2E, 0x17, 0xC0, 0x2E, 0x12, 0x0A, 0xC2, 0x12,
+  0xC0, 0x05, 0x00, 0x07, 0x03, 0xA7, 0x32, 0x29, 0x26, 0x29, 0x26, 0x3F, 0x35, 0xC0, 0x28, 0x21,
+  0x1F, 0xFE, 0x00, 0x00, 0xD1, 0xFE, 0x8B, 0xA7, 0x10, 0x2D, 0x9A, 0xEB, 0x9D, 0xA9, 0x29, 0x26,
+  0x33, 0x29, 0xFE, 0xCB, 0x46, 0x0A, 0x05, 0x12, 0xC0, 0x0A, 0xC4, 0x12, 0x02, 0x9C, 0xAA, 0x6F,
+  0xC0, 0x0A, 0x0D, 0x0A, 0xC8, 0x12, 0x9D, 0x8A, 0x17, 0xC0, 0x33, 0x12, 0x0A, 0xC8, 0x0D, 0x0A,
+  0x26, 0xC0, 0x17, 0x02, 0x12, 0x0A, 0xC4, 0x12, 0xC0, 0x05, 0x0A, 0x37, 0x29, 0xA2, 0x66, 0x52,
+  0x29, 0x55, 0x3A, 0x28, 0x10, 0xFE, 0x93, 0xA7, 0x00, 0xD3, 0xFE, 0xAC, 0x48, 0xFE, 0xFE, 0x09,
+  0x99, 0xDD, 0x29, 0x26, 0xA3, 0x65, 0x3E, 0xFE, 0xB2, 0x05, 0x98, 0xEF, 0x0A, 0x12, 0x0A, 0xC8,
+  0x9C, 0x9B, 0xC0, 0x17, 0xA3, 0x86, 0x12, 0x0A, 0xC8, 0x12, 0x9D, 0x8A, 0x17, 0xC0, 0x33, 0x12,
+  0x0A, 0xC8, 0x12, 0x9D, 0x9B, 0x17, 0x26, 0xC0, 0x0A, 0xC8, 0x12, 0x0A, 0x00, 0x35, 0x3E, 0x38,
+  0x9D, 0xAB, 0x29, 0x15, 0x0C, 0x21, 0xFE, 0x00, 0x00, 0xD4, 0x08, 0xFE, 0xC4, 0x46, 0x3B, 0x26,
+  0xA2, 0x76, 0xFE, 0xCB, 0x86, 0x0A, 0x05, 0x12, 0x0A, 0xC9, 0x12, 0x9D, 0x8A, 0x17, 0x7B, 0x2E,
+  0x0D, 0x0A, 0xC8, 0x12, 0x33, 0x17, 0xC0, 0x33, 0x12, 0x0A, 0xC8, 0x12, 0x2E, 0x21, 0x17, 0x33,
+  0x12, 0x0A, 0xC9, 0x12, 0x05, 0x0A, 0x01, 0xFE, 0xF5, 0xA8, 0x26, 0x3B, 0xFE, 0xC4, 0x66, 0x08,
+  0x00, 0xD5, 0xA4, 0x64, 0xFE, 0xD4, 0xC7, 0xA6, 0x63, 0xFE, 0xBA, 0x85, 0xFE, 0xA1, 0x04, 0x0A,
+  0x12, 0x0A, 0xCA, 0x12, 0x05, 0x9D, 0x8A, 0xC1, 0x05, 0x12, 0x0A, 0xC7, 0x12, 0x9D, 0x8A, 0x17,
+  0xC0, 0x33, 0x12, 0x0A, 0xC7, 0x12, 0x0A, 0x26, 0xC1, 0x05, 0x12, 0x0A, 0xCA, 0x12, 0x0A, 0x00,
+  0x0C, 0x29, 0x3D, 0x1A, 0x9C, 0xAC, 0xD7, 0x31, 0xFE, 0xA1, 0xE4, 0x99, 0xFF, 0x0F, 0xC0, 0x0A,
+  0xCC, 0x0D, 0x9D, 0x7A, 0x62, 0x17, 0x33, 0x12, 0x0A, 0xC7, 0x12, 0x33, 0x17, 0xC0, 0x33, 0x12,
+  0x0A, 0xC7, 0x12, 0x36, 0x17, 0x21, 0x2B, 0x0A, 0xCD, 0x0F, 0xC0, 0x00, 0xA7, 0x12, 0x31, 0x9A,
+  0xAD, 0xD9, 0xA1, 0xA7, 0x0F, 0x12, 0x0A, 0xCD, 0x12, 0x36, 0x17, 0x26, 0xC0, 0x0A, 0xC8, 0x12,
+  0x33, 0x17, 0xC0, 0x33, 0x12, 0x0A, 0xC8, 0x26, 0xC0, 0x17, 0x36, 0x12, 0x0A, 0xCD, 0x12, 0x0F,
+  0x0E, 0x00, 0xDB, 0xA2, 0xB7, 0x0D, 0xC0, 0x0A, 0xCC, 0x12, 0x0A, 0x26, 0xC0, 0x65, 0x02, 0x12,
+  0x0A, 0xC6, 0x12, 0x33, 0x17, 0xC0, 0x33, 0x12, 0x0A, 0xC6, 0x12, 0x05, 0x26, 0xC1, 0x0A, 0x12,
+  0x0A, 0xCC, 0x0D, 0xC0, 0xFE, 0x28, 0x61, 0x00, 0xDD, 0xA3, 0xC6, 0xA8, 0xF3, 0x0A, 0xCD, 0x12,
+  0x9C, 0x9B, 0x1A, 0x17, 0x33, 0x12, 0x0A, 0xC6, 0x12, 0x33, 0x17, 0xC0, 0x33, 0x12, 0x0A, 0xC6,
+  0x12, 0x33, 0x17, 0x21, 0x2E, 0x12, 0x0A, 0xCD, 0x15, 0x2B, 0x00, 0xDF, 0xA5, 0xC5, 0xA6, 0xF5,
+  0x0A, 0xCC, 0x12, 0x42, 0x17, 0x26, 0xC0, 0x0A, 0xC7, 0x12, 0x33, 0x17, 0xC0, 0x33, 0x12, 0x0A,
+  0xC7, 0x26, 0xC0, 0x17, 0x02, 0x12, 0x0A, 0xCC, 0x1C, 0x9A, 0x1B, 0x00, 0xE1, 0xA6, 0xD4, 0x1C,
+  0x0A, 0xCD, 0x26, 0xC0, 0x17, 0xA4, 0x76, 0x12, 0x0A, 0xC5, 0x12, 0x33, 0x17, 0xC0, 0x33, 0x12,
+  0x0A, 0xC5, 0x12, 0x02, 0x17, 0x26, 0xC0, 0x0A, 0xCD, 0x1C, 0x0D, 0x00, 0xE3, 0xA7, 0xE4, 0x1C,
+  0x0A, 0xCB, 0x12, 0x2E, 0x17, 0x1A, 0x2E, 0x12, 0x0A, 0xC5, 0x12, 0x33, 0x17, 0xC0, 0x33, 0x12,
+  0x0A, 0xC5, 0x12, 0x2E, 0x1A, 0x17, 0x2E, 0x12, 0x0A, 0xCB, 0x1C, 0x1F, 0x00, 0xE5, 0xFE, 0x78,
+  0xE3, 0x15, 0x0A, 0xCA, 0x12, 0x02, 0x1A, 0x26, 0xC0, 0x0A, 0x12, 0x0A, 0xC4, 0x12, 0x33, 0x17,
+  0xC0, 0x33, 0x12, 0x0A, 0xC4, 0x7A, 0x0A, 0x26, 0xC0, 0x1A, 0x02, 0x12, 0x0A, 0xCA, 0x15, 0x9D,
+  0x4A, 0x00, 0xE6, 0x7A, 0xFE, 0x89, 0x03, 0x12, 0x0A, 0xCB, 0x26, 0xC0, 0x17, 0x36, 0x12, 0x0A,
+  0xC4, 0x12, 0x33, 0x17, 0xC0, 0x33, 0x12, 0x0A, 0xC4, 0x12, 0x9D, 0x9B, 0x17, 0x26, 0xC0, 0x0A,
+  0xCB, 0x12, 0x9E, 0x69, 0x03, 0x00, 0xE7, 0xA1, 0x97, 0x02, 0x12, 0x0A, 0xC9, 0x12, 0x33, 0x17,
+  0x21, 0x2E, 0x12, 0x0A, 0xC4, 0x12, 0x33, 0x17, 0xC0, 0x33, 0x12, 0x0A, 0xC4, 0x12, 0x2E, 0x21,
+  0x17, 0x33, 0x12, 0x0A, 0xC9, 0x12, 0x02, 0x0B, 0x00, 0xE9, 0xA2, 0x96, 0x0A, 0x12, 0x0A, 0xC8,
+  0x12, 0x05, 0x26, 0xC1, 0x0A, 0x12, 0x0A, 0xC3, 0x12, 0x33, 0x17, 0xC0, 0x33, 0x12, 0x0A, 0xC3,
+  0x12, 0x0A, 0x26, 0xC1, 0x05, 0x12, 0x0A, 0xC8, 0x12, 0x0A, 0x98, 0x0C, 0x00, 0xEB, 0xA3, 0xA6,
+  0x0D, 0xC0, 0x0A, 0xC8, 0x0D, 0x9D, 0x7A, 0x26, 0x17, 0x33, 0x12, 0x0A, 0xC3, 0x12, 0x33, 0x17,
+  0xC0, 0x33, 0x12, 0x0A, 0xC3, 0x12, 0x36, 0x17, 0x26, 0x2B, 0x0D, 0x0A, 0xC8, 0x0D, 0xC0, 0x25,
+  0x00, 0xED, 0xA4, 0xB5, 0x15, 0x0A, 0xC8, 0x12, 0x36, 0x17, 0x26, 0xC0, 0x0A, 0xC4, 0x12, 0x33,
+  0x17, 0xC0, 0x33, 0x12, 0x0A, 0xC4, 0x26, 0xC0, 0x17, 0x36, 0x12, 0x0A, 0xC8, 0x15, 0x30, 0x00,
+  0xEF, 0xA5, 0xC5, 0x1C, 0x0A, 0xC7, 0x0D, 0x0A, 0x26, 0xC0, 0x1A, 0xA4, 0x66, 0x12, 0x0A, 0xC2,
+  0x12, 0x33, 0x17, 0xC0, 0x33, 0x12, 0x0A, 0xC2, 0x12, 0x05, 0x21, 0x26, 0xC0, 0x0A, 0x12, 0x0A,
+  0xC7, 0x1C, 0x9A, 0x1B, 0x00, 0xF1, 0xA6, 0xD4, 0x1C, 0x0A, 0xC7, 0x12, 0x2E, 0x1A, 0x17, 0x2E,
+  0x12, 0x0A, 0xC2, 0x12, 0x33, 0x17, 0xC0, 0x33, 0x12, 0x0A, 0xC2, 0x12, 0x33, 0x17, 0x1A, 0x2E,
+  0x12, 0x0A, 0xC7, 0x1C, 0x0D, 0x00, 0xF3, 0x1F, 0x1C, 0x0A, 0xC6, 0x12, 0x42, 0x17, 0x26, 0xC0,
+  0x0A, 0xC3, 0x12, 0x33, 0x17, 0xC0, 0x33, 0x12, 0x0A, 0xC3, 0x26, 0xC0, 0x17, 0x02, 0x12, 0x0A,
+  0xC6, 0x1C, 0x1F, 0x00, 0xF5, 0xFE, 0x78, 0xE3, 0x15, 0x0A, 0xC7, 0x26, 0xC0, 0x17, 0x02, 0x12,
+  0x0A, 0xC1, 0x12, 0x33, 0x17, 0xC0, 0x33, 0x12, 0x0A, 0xC1, 0x12, 0x02, 0x1A, 0x26, 0xC0, 0x0A,
+  0x7A, 0x0A, 0xC5, 0x15, 0x25, 0x00, 0xF6, 0x03, 0xFE, 0x89, 0x03, 0x12, 0x0A, 0xC5, 0x12, 0x2E,
+  0x17, 0x1A, 0x2E, 0x12, 0x0A, 0xC1, 0x12, 0x33, 0x17, 0xC0, 0x33, 0x12, 0x0A, 0xC1, 0x12, 0x2E,
+  0x1A, 0x17, 0x2E, 0x12, 0x0A, 0xC5, 0x12, 0x35, 0x03, 0x00, 0xF7, 0x0B, 0xFE, 0x91, 0x24, 0x12,
+  0x0A, 0xC4, 0x12, 0x02, 0x1A, 0x26, 0xC0, 0x0A, 0x0D, 0x0A, 0xC0, 0x12, 0x33, 0x17, 0xC0, 0x33,
+  0x12, 0x0A, 0xC0, 0x0D, 0x0A, 0x26, 0xC0, 0x1A, 0x02, 0x12, 0x0A, 0xC4, 0x12, 0x02, 0x0B, 0x00,
+  0xF9, 0x13, 0x0A, 0x12, 0x0A, 0xC5, 0x26, 0xC0, 0x17, 0x36, 0x12, 0x0A, 0xC0, 0x12, 0x33, 0x17,
+  0xC0, 0x33, 0x12, 0x0A, 0xC0, 0x12, 0x3D, 0x17, 0x26, 0xC0, 0x0A, 0xC5, 0x12, 0x0A, 0x16, 0x00,
+  0xFB, 0x20, 0x0D, 0xC0, 0x0A, 0xC3, 0x12, 0x33, 0x17, 0x26, 0x2E, 0x12, 0x0A, 0xC0, 0x12, 0x33,
+  0x17, 0xC0, 0x33, 0x12, 0x0A, 0xC0, 0x12, 0x2E, 0x21, 0x17, 0x33, 0x12, 0x0A, 0xC3, 0x0D, 0xC0,
+  0x20, 0x00, 0xFD, 0xA3, 0xC6, 0x15, 0x0A, 0xC3, 0x12, 0x05, 0x26, 0xC1, 0x0A, 0x12, 0x0F, 0x12,
+  0x36, 0x26, 0xC0, 0x36, 0x12, 0x0F, 0x12, 0x0A, 0x26, 0xC1, 0x05, 0x12, 0x0A, 0xC3, 0x15, 0x99,
+  0x0C, 0x00, 0xFD, 0xC1, 0xA5, 0xC5, 0x1C, 0x0A, 0xC3, 0x0D, 0x2E, 0x26, 0xC0, 0x2E, 0x05, 0x62,
+  0x6E, 0x9C, 0x9B, 0x41, 0xC0, 0x1C, 0x00, 0x3B, 0xA2, 0x66, 0x2E, 0x26, 0xC0, 0x6E, 0x0D, 0x0A,
+  0xC3, 0xA1, 0x98, 0x02, 0x9B, 0x4B, 0xFD, 0xC3, 0xA6, 0xD4, 0x1C, 0x0A, 0xC2, 0x12, 0x36, 0x9B,
+  0xAC, 0xC0, 0xA6, 0x43, 0xAB, 0x20, 0xA7, 0x22, 0xA5, 0x54, 0x5A, 0x5A, 0xC0, 0x23, 0x26, 0x00,
+  0x13, 0x38, 0x0D, 0xC0, 0x36, 0x12, 0x0A, 0xC2, 0x1C, 0x9B, 0x2A, 0x9A, 0x3C, 0xFD, 0xC5, 0x1F,
+  0x1C, 0x0A, 0x12, 0xC0, 0x9D, 0xAB, 0x05, 0x3C, 0xFE, 0xD4, 0x89, 0x14, 0xA5, 0x55, 0xA2, 0x66,
+  0xC1, 0x10, 0xC0, 0x0B, 0xC1, 0x01, 0x14, 0xFE, 0xD4, 0x89, 0xFE, 0xA2, 0x45, 0x05, 0x00, 0x12,
+  0xC0, 0x0A, 0x1C, 0x1F, 0x99, 0x2C, 0xFD, 0xC7, 0x25, 0x1C, 0x0A, 0x62, 0x13, 0xFE, 0xE5, 0x6A,
+  0x06, 0x0B, 0x62, 0x65, 0xC0, 0x66, 0x2D, 0xC2, 0x30, 0x35, 0xC0, 0x01, 0x0B, 0x06, 0xFE, 0xE5,
+  0x6B, 0x13, 0x00, 0x0A, 0x1C, 0x25, 0x99, 0x0C, 0xFD, 0xC8, 0x03, 0xFE, 0x89, 0x03, 0x12, 0xFE,
+  0xD4, 0x28, 0x06, 0xC0, 0x35, 0x2D, 0x35, 0xCA, 0x2D, 0x35, 0x06, 0xC0, 0x2B, 0x12, 0x30, 0x03,
+  0x00, 0xFD, 0xC9, 0xA0, 0xA8, 0xFE, 0xCC, 0xA9, 0xFE, 0xFF, 0x2D, 0x2D, 0x35, 0xC1, 0x01, 0xC1,
+  0x35, 0xC4, 0x01, 0xC1, 0x35, 0xC1, 0x2D, 0x15, 0xFE, 0xD4, 0xA9, 0xFE, 0x10, 0x00, 0x00, 0xFD,
+  0xCB, 0xFE, 0x31, 0x82, 0x28, 0xA3, 0x65, 0x32, 0x01, 0x35, 0x51, 0x9D, 0xBA, 0x65, 0x66, 0xC0,
+  0x65, 0xC0, 0x3A, 0xC0, 0x3F, 0x0B, 0x21, 0x35, 0x01, 0x32, 0x7E, 0x28, 0xFE, 0x39, 0x82, 0x00,
+  0xFD, 0xCD, 0xFE, 0x49, 0xC3, 0x01, 0x2D, 0x0B, 0x2E, 0x29, 0x55, 0x6F, 0x29, 0xC4, 0x26, 0x1A,
+  0x29, 0x2E, 0x0B, 0x2D, 0x01, 0x36, 0x00, 0xFD, 0xCD, 0x6E, 0x00, 0xFE, 0x62, 0x44, 0xFE, 0xFD,
+  0xE9, 0x9B, 0xBB, 0x26, 0x29, 0xCA, 0x26, 0x1A, 0x07, 0xFE, 0x62, 0x44, 0x00, 0x05, 0x00, 0xFD,
+  0xCF, 0xFE, 0x7A, 0xC4, 0x07, 0x9B, 0xBC, 0x29, 0xCA, 0x21, 0x07, 0x37, 0x00, 0xFD, 0xD3, 0xFE,
+  0x93, 0x45, 0xFE, 0xFD, 0xC8, 0x21, 0x29, 0xC8, 0x21, 0x3B, 0x1B, 0x00, 0xFD, 0xD5, 0xFE, 0xAB,
+  0xC6, 0x3B, 0x21, 0x29, 0xC6, 0x21, 0x3B, 0xFE, 0xAB, 0xC5, 0x00, 0xFD, 0xD6, 0x08, 0xFE, 0xC4,
+  0x46, 0x3B, 0x21, 0x29, 0xC0, 0x2E, 0xC0, 0x29, 0xC0, 0x21, 0x3B, 0x1C, 0x08, 0x00, 0xFD, 0xD7,
+  0xA3, 0x75, 0xFE, 0xD4, 0xC7, 0xA7, 0x62, 0x2E, 0xC0, 0x9D, 0xAB, 0xC0, 0x2E, 0xC0, 0x36, 0x3D,
+  0xFE, 0x10, 0x80, 0x00, 0xFD, 0xD9, 0xA6, 0x63, 0xFE, 0xDD, 0x07, 0x9B, 0xED, 0xFE, 0xC2, 0x45,
+  0x9C, 0xBC, 0x66, 0xA5, 0x33, 0xFE, 0xDC, 0x67, 0xA6, 0x22, 0xFE, 0x20, 0xC1, 0x00, 0xFD, 0xDB,
+  0xAA, 0xC1, 0xFE, 0xC1, 0x85, 0x9D, 0x8A, 0xA2, 0x76, 0x6B, 0x08, 0x1C, 0xFE, 0x61, 0x43, 0x00,
+  0xFD, 0xDB, 0xA4, 0xA5, 0x1C, 0xC0, 0x6E, 0x1C, 0xC0, 0x21, 0x12, 0x52, 0x9A, 0x0B, 0x00, 0xFD,
+  0xD8, 0xA5, 0xC5, 0xA6, 0xC4, 0xA2, 0xB7, 0x1C, 0xC5, 0x45, 0x29, 0x9F, 0x59, 0x02, 0x00, 0xFD,
+  0xD4, 0xA4, 0xB6, 0xA9, 0xD2, 0xA3, 0xB6, 0xC0, 0x9C, 0x8B, 0x15, 0x1C, 0xC4, 0x0A, 0x21, 0x0B,
+  0xC0, 0x23, 0x97, 0x4E, 0x00, 0xFD, 0xD1, 0xA9, 0xE2, 0x0B, 0xC0, 0x46, 0xA1, 0x98, 0x9D, 0x99,
+  0x15, 0x1C, 0xC3, 0x59, 0x0A, 0x2C, 0xA3, 0x87, 0x00, 0x7E, 0x0B, 0x99, 0x3C, 0x97, 0x2E, 0xFD,
+  0xCE, 0x7A, 0x0C, 0xA6, 0xB5, 0x9E, 0x79, 0x0B, 0x56, 0x9A, 0x4C, 0x0D, 0x24, 0x21, 0x1C, 0xC2,
+  0x49, 0x7A, 0x9A, 0x3C, 0x39, 0x03, 0x0B, 0x00, 0x1A, 0x0C, 0xFE, 0x08, 0x00, 0x5A, 0xFD, 0xCC,
+  0x0C, 0x1A, 0x9E, 0x79, 0xA1, 0xA7, 0x9C, 0x5B, 0x97, 0x1D, 0x9D, 0x6A, 0xC0, 0xA7, 0xF4, 0xA3,
+  0xE7, 0x1C, 0x21, 0xC0, 0x0A, 0x76, 0x9D, 0x39, 0x00, 0xC0, 0x25, 0xA9, 0xE3, 0x0E, 0x9F, 0x69,
+  0xA2, 0x97, 0x0C, 0xFE, 0x00, 0x00, 0xFD, 0xCB, 0x2F, 0x1A, 0x9E, 0x79, 0xA1, 0xA8, 0x9A, 0x2B,
+  0x96, 0x2E, 0xC2, 0xFE, 0x7A, 0xC4, 0xA4, 0xF6, 0xFE, 0xA9, 0x44, 0x56, 0xC0, 0x0A, 0xFE, 0xCB,
+  0x46, 0x9D, 0x19, 0x00, 0xC2, 0x39, 0x0E, 0x9F, 0x69, 0x1A, 0x2F, 0x97, 0x2E, 0xFD, 0xC9, 0xA4,
+  0xB5, 0x0B, 0x46, 0x0E, 0x3E, 0x96, 0x2E, 0xC2, 0xA8, 0x51, 0xFE, 0xF5, 0x88, 0x6E, 0x99, 0xDE,
+  0x9A, 0xCE, 0xC0, 0x03, 0x33, 0x2E, 0x3E, 0x00, 0xC2, 0xFE, 0x81, 0x23, 0x0E, 0x9F, 0x69, 0x0B,
+  0x30, 0x9C, 0x5B, 0xFD, 0xC8, 0x23, 0xA3, 0xA6, 0x0B, 0x1E, 0x00, 0xC3, 0xFE, 0xB4, 0x26, 0x36,
+  0x9D, 0x9B, 0x2E, 0x33, 0xC0, 0x2E, 0x21, 0x36, 0x11, 0x00, 0xC3, 0x1E, 0x0B, 0x08, 0x23, 0x00,
+  0xFD, 0xC7, 0xA5, 0xB5, 0x0B, 0x46, 0x08, 0x25, 0x9D, 0x6A, 0xC2, 0xFE, 0x5A, 0x03, 0x3B, 0x21,
+  0x7E, 0x26, 0xC2, 0x29, 0x21, 0x3B, 0x06, 0x00, 0xC2, 0xA3, 0x96, 0x08, 0x56, 0x0B, 0x3F, 0x9B,
+  0x5B, 0xFD, 0xC6, 0x0C, 0x0B, 0xC0, 0x9A, 0x3C, 0x00, 0xC2, 0xA3, 0x75, 0xFE, 0xDC, 0xE7, 0x2E,
+  0x26, 0x29, 0xC4, 0x26, 0x2E, 0x05, 0x15, 0x00, 0xC2, 0x3E, 0x0B, 0xC0, 0x0C, 0x00, 0xFD, 0xC5,
+  0xA1, 0x97, 0xFE, 0xC9, 0xE6, 0x7A, 0x7E, 0x28, 0x9D, 0x5A, 0xC2, 0xFE, 0x8B, 0x24, 0x3B, 0x21,
+  0x29, 0xC6, 0x21, 0x3B, 0x0C, 0x00, 0xC2, 0x28, 0x0B, 0x03, 0x5A, 0xFE, 0x10, 0x20, 0x46, 0xFD,
+  0xC4, 0xA4, 0xC6, 0xFE, 0xDA, 0x06, 0x08, 0x9D, 0x8A, 0x00, 0xC2, 0xA9, 0x50, 0xFE, 0xF5, 0x68,
+  0x26, 0xC0, 0x29, 0xC6, 0x26, 0xC0, 0x29, 0x06, 0x00, 0xC2, 0xFE, 0xB9, 0xA5, 0x08, 0x0B, 0x3A,
+  0x00, 0xFD, 0xC4, 0xA7, 0xD4, 0x0B, 0xC0, 0x9A, 0x5C, 0x00, 0xC2, 0xFE, 0xA3, 0xA5, 0x3B, 0x21,
+  0x7E, 0xC8, 0x21, 0x3B, 0x30, 0x00, 0xC2, 0x04, 0x0B, 0xC0, 0x1C, 0x00, 0xFD, 0xC4, 0x2F, 0x0B,
+  0xC0, 0x98, 0x3D, 0x00, 0xC2, 0x06, 0x29, 0x2E, 0x26, 0x29, 0xC6, 0x26, 0x2E, 0x29, 0xFE, 0x31,
+  0x41, 0x00, 0xC2, 0x27, 0xA8, 0xD3, 0xC0, 0x2F, 0x00, 0xFD, 0xC4, 0x39, 0xA7, 0xC4, 0x1A, 0x97,
+  0x2D, 0x00, 0xC3, 0xFE, 0x51, 0xE3, 0x36, 0x2E, 0x21, 0x26, 0xC0, 0x29, 0xC0, 0x26, 0xC0, 0x21,
+  0x2E, 0x36, 0xFE, 0x5A, 0x03, 0x00, 0xC3, 0x24, 0x1A, 0x12, 0x39, 0x00, 0xFD, 0xC4, 0x2F, 0x03,
+  0xC0, 0x1C, 0x00, 0xC4, 0xFE, 0x49, 0xA2, 0xFE, 0xDD, 0x07, 0x3B, 0x36, 0x29, 0x26, 0xC0, 0x29,
+  0x36, 0x3B, 0x0A, 0x2A, 0x00, 0xC4, 0x1C, 0x03, 0xC0, 0x2F, 0x00, 0xFD, 0xC3, 0xA2, 0xA7, 0xA8,
+  0xF3, 0x7A, 0xC0, 0x46, 0x98, 0x0C, 0x00, 0xC4, 0x15, 0xFE, 0x7A, 0xC4, 0xFE, 0xCC, 0xA7, 0x21,
+  0x36, 0xC0, 0x21, 0x35, 0x37, 0x15, 0x00, 0xC4, 0xA1, 0xA7, 0x3F, 0x0A, 0xC0, 0x07, 0x1D, 0x00,
+  0xFD, 0xC2, 0xFE, 0x89, 0x04, 0xA3, 0xA5, 0x0A, 0xC0, 0xA1, 0x98, 0x9D, 0x49, 0x00, 0xC7, 0xA6,
+  0x63, 0xA4, 0x75, 0xC0, 0x31, 0x00, 0xC7, 0xFE, 0x78, 0xE3, 0x1C, 0x0A, 0xC0, 0xA1, 0x97, 0x9E,
+  0x59, 0x00, 0xFD, 0xC1, 0x16, 0xFE, 0xA9, 0x64, 0x0A, 0xC1, 0x0D, 0x0A, 0xFE, 0x08, 0x20, 0x00,
+  0xD2, 0x08, 0x0A, 0x0D, 0x0A, 0xC1, 0x12, 0x16, 0x00, 0xFD, 0xC0, 0x0B, 0x12, 0xC0, 0x0F, 0xC0,
+  0x12, 0x07, 0xFE, 0x08, 0x00, 0x00, 0xD2, 0x03, 0x07, 0x12, 0x0F, 0xC0, 0x12, 0xC0, 0x0B, 0x00,
+  0xFD, 0xC1, 0xA5, 0xF5, 0xA3, 0xE7, 0x5E, 0xC0, 0x03, 0x9D, 0x09, 0x00, 0xD4, 0x05, 0x03, 0x5E,
+  0xC0, 0x03, 0x9E, 0x18, 0x00, 0xFD, 0xC2, 0xFE, 0x39, 0x62, 0xFE, 0xCB, 0xE8, 0xFE, 0xA9, 0xE5,
+  0xA2, 0x76, 0xFE, 0xC3, 0x87, 0xFE, 0x18, 0x80, 0x00, 0xD4, 0xA7, 0x52, 0xFE, 0xCC, 0x08, 0x3A,
+  0x56, 0xFE, 0xCB, 0x87, 0xFE, 0x29, 0x01, 0x00, 0xFD, 0xC2, 0xFE, 0xA4, 0x48, 0xFE, 0xFF, 0x4E,
+  0x99, 0xED, 0x6F, 0x7C, 0xFE, 0x72, 0xA3, 0x00, 0xD4, 0xFE, 0x83, 0x66, 0xFE, 0xFF, 0x4E, 0x2D,
+  0x6E, 0xA2, 0x76, 0xFE, 0x93, 0x44, 0x00, 0xFD, 0xC1, 0xA5, 0x64, 0xFE, 0xF6, 0x4C, 0xA2, 0x76,
+  0xC0, 0x32, 0x9C, 0xDA, 0x95, 0xDF, 0xFE, 0x00, 0x20, 0x00, 0xD2, 0xA2, 0x76, 0xFE, 0xDD, 0xCB,
+  0x01, 0x2D, 0x7F, 0x9D, 0xB9, 0x97, 0xED, 0xFE, 0x10, 0x60, 0x00, 0xFD, 0xC0, 0xFE, 0x6A, 0xA5,
+  0xFE, 0xFF, 0x0D, 0x2D, 0x35, 0x01, 0x9A, 0xDB, 0x9D, 0xC9, 0xFE, 0x41, 0x62, 0x00, 0xD2, 0xFE,
+  0x49, 0xE3, 0xFE, 0xFE, 0xED, 0x2D, 0x35, 0x01, 0x9B, 0xCA, 0x9D, 0xC9, 0x06, 0x00, 0xFD, 0xC0,
+  0xFE, 0xB4, 0xA9, 0x0B, 0x32, 0x35, 0x01, 0x9A, 0xDB, 0x36, 0x0C, 0x00, 0xD2, 0xFE, 0x93, 0xE7,
+  0xFE, 0xFE, 0xED, 0x2D, 0x35, 0x01, 0x9B, 0xCB, 0x36, 0xFE, 0xA3, 0xC5, 0x00, 0xFD, 0x15, 0xFE,
+  0xE6, 0x0B, 0x01, 0x32, 0x7A, 0x01, 0x9A, 0xDB, 0x31, 0x97, 0xAF, 0x00, 0xD2, 0xFE, 0xD5, 0x6A,
+  0xAB, 0x20, 0x2D, 0x35, 0x01, 0x17, 0x9B, 0xDA, 0x9C, 0x9B, 0xFE, 0x08, 0x40, 0x00, 0xFC, 0xFE,
+  0x39, 0x82, 0x06, 0x32, 0x35, 0xC0, 0x01, 0x0B, 0x29, 0x56, 0xFE, 0x18, 0x80, 0x00, 0xD0, 0xA6,
+  0x63, 0x2D, 0x35, 0x32, 0x35, 0x01, 0x10, 0x9A, 0xDB, 0xA2, 0x77, 0xFE, 0x31, 0x21, 0x00, 0xFC,
+  0xFE, 0x62, 0xA5, 0xFE, 0xFF, 0x0D, 0x32, 0x35, 0x01, 0x61, 0x2E, 0x26, 0x36, 0xFE, 0x39, 0x62,
+  0x00, 0xD0, 0x3B, 0xFE, 0xFE, 0xED, 0x32, 0x35, 0x01, 0x35, 0x99, 0xEC, 0x21, 0xA4, 0x64, 0xFE,
+  0x5A, 0x03, 0x00, 0xFC, 0xFE, 0x8B, 0x86, 0x0B, 0x28, 0x30, 0x55, 0x3A, 0x61, 0x56, 0x3B, 0xFE,
+  0x62, 0x23, 0x00, 0xD0, 0xFE, 0x6A, 0xC5, 0x0B, 0x28, 0x30, 0x55, 0x3A, 0x29, 0x56, 0x3B, 0xFE,
+  0x7A, 0xC4, 0x00, 0xFC, 0xFE, 0x93, 0x65, 0x3B, 0x21, 0x26, 0x65, 0xC0, 0x26, 0x1A, 0x3B, 0x37,
+  0x00, 0xD0, 0x37, 0x3B, 0x21, 0x26, 0x69, 0x1A, 0x26, 0x1A, 0x3B, 0x20, 0x00, 0xFC, 0xFE, 0xAB,
+  0xE5, 0xFE, 0xFD, 0xE9, 0x2E, 0x36, 0xC2, 0x2E, 0xA4, 0x55, 0xFE, 0x93, 0x45, 0x00, 0xD0, 0x1B,
+  0x0C, 0x2E, 0x36, 0xC2, 0x2E, 0x07, 0xFE, 0xAB, 0xE6, 0x00, 0xFC, 0x20, 0xFE, 0xD4, 0xE7, 0x9D,
+  0xAA, 0x6B, 0xC2, 0x29, 0x05, 0x37, 0x00, 0xD0, 0x37, 0x05, 0x29, 0x30, 0xC2, 0x29, 0x02, 0x20,
+  0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xD3,
+};
+
+const uint8_t kAssetIcon7Data[2143] PROGMEM = {
+  0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xD8, 0xA3, 0xA6, 0xA8, 0xD3, 0xA2, 0xA7, 0x09, 0x25, 0x00, 0xC6,
+  0xA8, 0xC3, 0xA5, 0xC5, 0xC0, 0x21, 0x00, 0xC6, 0x25, 0x09, 0x26, 0x09, 0x25, 0x00, 0xFD, 0xC5,
+  0xA2, 0x97, 0xFE, 0xC9, 0xE6, 0xA1, 0xA8, 0x49, 0xA0, 0xA8, 0x00, 0x1A, 0x9E, 0x79, 0xC4, 0xA9,
+  0xD2, 0xA8, 0xF4, 0x45, 0xC0, 0x1D, 0x2C, 0x00, 0xC4, 0x1A, 0xFE, 0xC9, 0xE6, 0x15, 0x08, 0x0E,
+  0x00, 0x1A, 0x9E, 0x79, 0xFD, 0xC4, 0x2C, 0xA8, 0xE4, 0x9E, 0x79, 0x7A, 0x00, 0x1A, 0x2C, 0x97,
+  0x3E, 0xC3, 0xA1, 0x97, 0xFE, 0xC9, 0xE6, 0x03, 0x00, 0xC0, 0x03, 0x00, 0x0B, 0x46, 0xC3, 0x2C,
+  0x1A, 0x9E, 0x79, 0x03, 0x00, 0x1A, 0x2C, 0x97, 0x3E, 0xFD, 0xC4, 0xFE, 0x81, 0x44, 0xA6, 0xD5,
+  0x45, 0x03, 0x00, 0x12, 0x3E, 0x96, 0x2E, 0xC3, 0xA2, 0xA7, 0x03, 0xC4, 0x1D, 0x00, 0xC3, 0x3E,
+  0x12, 0x45, 0x03, 0x00, 0x12, 0x3E, 0x96, 0x2E, 0xFD, 0xC4, 0xFE, 0x81, 0x24, 0x12, 0x45, 0x03,
+  0x00, 0x12, 0x39, 0x97, 0x1D, 0xC3, 0xA2, 0x97, 0x03, 0xC4, 0x1A, 0x00, 0xC3, 0x39, 0x12, 0x45,
+  0x03, 0x00, 0x12, 0x39, 0x97, 0x1D, 0xFD, 0xC4, 0xFE, 0x89, 0x23, 0xA7, 0xD4, 0x46, 0xC1, 0x11,
+  0x35, 0x00, 0xC3, 0x1D, 0x06, 0xC4, 0x1D, 0x00, 0xC3, 0x35, 0x11, 0x06, 0xC1, 0x11, 0x35, 0x00,
+  0xFD, 0xC4, 0xAA, 0x72, 0xA8, 0x74, 0x51, 0x6F, 0x2E, 0x02, 0x29, 0x00, 0xC3, 0xA2, 0x87, 0x3A,
+  0xC4, 0x17, 0x00, 0xC3, 0x29, 0x02, 0x2E, 0x3A, 0x2E, 0x02, 0x29, 0x00, 0xFD, 0xC4, 0xAB, 0x12,
+  0xA8, 0x44, 0x51, 0x6F, 0x22, 0x36, 0x26, 0x00, 0xC3, 0xA2, 0x77, 0x2E, 0xC4, 0x14, 0x00, 0xC3,
+  0x26, 0x36, 0x22, 0x2E, 0x22, 0x36, 0x26, 0x00, 0xFD, 0xC4, 0xAB, 0x22, 0xA8, 0x44, 0x61, 0xC1,
+  0x39, 0x29, 0x00, 0xC3, 0x14, 0x28, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x28, 0xC1, 0x39, 0x29,
+  0x00, 0xFD, 0xC4, 0x29, 0x39, 0x51, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00,
+  0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29,
+  0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD,
+  0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29,
+  0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3,
+  0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29,
+  0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25,
+  0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25,
+  0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25,
+  0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39,
+  0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14,
+  0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39,
+  0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00,
+  0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3,
+  0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00,
+  0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4,
+  0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39,
+  0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14,
+  0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39,
+  0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1,
+  0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4,
+  0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1,
+  0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29,
+  0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00,
+  0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29,
+  0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD,
+  0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29,
+  0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3,
+  0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29,
+  0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25,
+  0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25,
+  0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25,
+  0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39,
+  0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14,
+  0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39,
+  0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00,
+  0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3,
+  0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00,
+  0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4,
+  0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39,
+  0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14,
+  0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39,
+  0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1,
+  0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4,
+  0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1,
+  0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29,
+  0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00,
+  0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29,
+  0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD,
+  0xC4, 0x29, 0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xC3, 0x14, 0x25, 0xC4, 0x14, 0x00, 0xC3, 0x29,
+  0x39, 0x25, 0xC1, 0x39, 0x29, 0x00, 0xFD, 0xC4, 0xAA, 0x33, 0x39, 0x25, 0xC1, 0x39, 0x24, 0x00,
+  0xC3, 0x6E, 0x25, 0xC0, 0x7F, 0xC0, 0x25, 0xC0, 0x05, 0x00, 0xC3, 0x24, 0x39, 0x25, 0xC1, 0x39,
+  0x24, 0x00, 0xFD, 0xC4, 0xA3, 0x66, 0x25, 0xC3, 0x19, 0x00, 0xC4, 0x29, 0x34, 0x51, 0xC0, 0x34,
+  0x29, 0x00, 0xC4, 0x19, 0x25, 0xC3, 0x19, 0x00, 0xFD, 0xC5, 0xA6, 0x55, 0xAF, 0x00, 0x34, 0x0D,
+  0x3C, 0x00, 0xC6, 0x20, 0xA4, 0x66, 0xC0, 0x20, 0x00, 0xC6, 0x3C, 0x0D, 0x34, 0x0D, 0x3C, 0x00,
+  0xFD, 0xC6, 0x19, 0xFE, 0x8C, 0x71, 0x7F, 0x19, 0xFE, 0x08, 0x61, 0x00, 0xC6, 0x08, 0xFE, 0x9C,
+  0xD3, 0xC0, 0x08, 0x00, 0xC6, 0x19, 0xFE, 0x8C, 0x71, 0x28, 0x19, 0xFE, 0x08, 0x61, 0x00, 0xFD,
+  0xC6, 0xA4, 0x66, 0xFE, 0x8C, 0x71, 0xA2, 0x77, 0x19, 0x28, 0x00, 0xC6, 0x08, 0xFE, 0x9C, 0xF3,
+  0xC0, 0x08, 0x00, 0xC6, 0x28, 0x19, 0x2D, 0x19, 0x28, 0x00, 0xFD, 0xC6, 0x28, 0x19, 0x2D, 0x19,
+  0x28, 0x00, 0xC6, 0x08, 0x3C, 0xC0, 0x08, 0x00, 0xC6, 0x28, 0x19, 0x2D, 0x19, 0x28, 0x00, 0xFD,
+  0xC6, 0x28, 0x19, 0x2D, 0x19, 0x28, 0x00, 0xC6, 0x08, 0x3C, 0xC0, 0x08, 0x00, 0xC6, 0x28, 0x19,
+  0x2D, 0x19, 0x28, 0x00, 0xFD, 0xC6, 0x28, 0x19, 0x2D, 0x19, 0x28, 0x00, 0xC6, 0x08, 0x3C, 0xC0,
+  0x08, 0x00, 0xC6, 0x28, 0x19, 0x2D, 0x19, 0x28, 0x00, 0xFD, 0xC6, 0x28, 0x19, 0x2D, 0x19, 0x28,
+  0x00, 0xC6, 0x08, 0x3C, 0xC0, 0x08, 0x00, 0xC6, 0x28, 0x19, 0x2D, 0x19, 0x28, 0x00, 0xFD, 0xC6,
+  0x28, 0x19, 0x2D, 0x19, 0x28, 0x00, 0xC6, 0x08, 0x3C, 0xC0, 0x08, 0x00, 0xC6, 0x28, 0x19, 0x2D,
+  0x19, 0x28, 0x00, 0xFD, 0xC6, 0x28, 0x19, 0x2D, 0x19, 0x28, 0x00, 0xC6, 0x08, 0x3C, 0xC0, 0x08,
+  0x00, 0xC6, 0x28, 0x19, 0x2D, 0x19, 0x28, 0x00, 0xFD, 0xC6, 0x28, 0x19, 0x2D, 0x19, 0x28, 0x00,
+  0xC6, 0x08, 0x3C, 0xC0, 0x08, 0x00, 0xC6, 0x28, 0x19, 0x2D, 0x19, 0x28, 0x00, 0xFD, 0xC6, 0xA3,
+  0x66, 0xFE, 0x8C, 0x92, 0xA2, 0x77, 0x25, 0x19, 0x00, 0xC6, 0xFE, 0x4A, 0x8A, 0x01, 0xC0, 0x05,
+  0x00, 0xC6, 0x19, 0x25, 0x39, 0x25, 0x19, 0x00, 0xFB, 0x7A, 0x1A, 0x65, 0x6E, 0xC2, 0x1A, 0x13,
+  0xA3, 0x67, 0xFE, 0x94, 0x30, 0xA2, 0x77, 0x0B, 0x33, 0x13, 0x1A, 0x13, 0xC2, 0x1A, 0x13, 0xFE,
+  0x62, 0x8A, 0xB0, 0x00, 0xC0, 0x0E, 0x13, 0x1A, 0x13, 0xC2, 0x1A, 0x13, 0x33, 0x0B, 0x1F, 0x0B,
+  0x33, 0x13, 0x1A, 0x13, 0xC1, 0x56, 0xC0, 0x7A, 0x03, 0x00, 0xF2, 0xA7, 0xC4, 0xFE, 0xEA, 0x48,
+  0x9F, 0x69, 0x7A, 0xC5, 0x6E, 0xC1, 0x1E, 0xC8, 0x23, 0xC0, 0x1E, 0xC8, 0x23, 0xC1, 0x1E, 0xC4,
+  0x44, 0x52, 0xA2, 0x96, 0x96, 0x2E, 0x00, 0xF2, 0xA7, 0xD4, 0xFE, 0xF2, 0x69, 0x1E, 0x7E, 0xC5,
+  0x66, 0xC1, 0x26, 0xC7, 0x21, 0xC2, 0x26, 0xC7, 0x21, 0xC1, 0x26, 0xC4, 0x12, 0x45, 0xA2, 0x97,
+  0xFE, 0x58, 0xE2, 0x99, 0x4D, 0xF2, 0x1C, 0xFE, 0xEA, 0x69, 0x1E, 0xE8, 0x50, 0x5A, 0xA2, 0x87,
+  0x12, 0x99, 0x4D, 0xF2, 0x19, 0x1A, 0x03, 0x6E, 0xE6, 0x03, 0xC0, 0x5A, 0x1A, 0x12, 0x99, 0x4D,
+  0xF2, 0x12, 0xFE, 0xDA, 0x26, 0x42, 0x03, 0xE8, 0x00, 0x17, 0x12, 0x99, 0x4D, 0xF2, 0x19, 0x1A,
+  0x08, 0xC0, 0x03, 0x08, 0xE4, 0x03, 0x08, 0xC0, 0x1A, 0x19, 0x00, 0xF2, 0xA1, 0x97, 0xA2, 0x97,
+  0xC0, 0xA3, 0xA6, 0xA6, 0xF5, 0x46, 0x7A, 0xE2, 0x19, 0x24, 0x0A, 0x25, 0xC0, 0x0B, 0x00, 0xF5,
+  0x25, 0xFE, 0xB1, 0x64, 0x46, 0xE4, 0x15, 0x25, 0x00, 0xF8, 0xA3, 0xB6, 0x15, 0x0A, 0xE4, 0x15,
+  0x28, 0x00, 0xF8, 0x28, 0x15, 0x0A, 0xE4, 0x15, 0x28, 0x00, 0xF8, 0x28, 0x15, 0x0A, 0xCF, 0x7E,
+  0xC2, 0x0A, 0xCF, 0x15, 0x28, 0x00, 0xF8, 0x28, 0x15, 0x0A, 0xCD, 0x12, 0x0A, 0x62, 0x66, 0xC0,
+  0x00, 0x0A, 0x12, 0x0A, 0xCD, 0x15, 0x28, 0x9D, 0x5A, 0xF8, 0x28, 0x15, 0x0A, 0xCC, 0x12, 0x52,
+  0x12, 0xFE, 0xC3, 0x27, 0xA8, 0x22, 0xC0, 0x97, 0xFF, 0x0A, 0x05, 0x12, 0x0A, 0xCC, 0x15, 0x28,
+  0x00, 0xF8, 0x28, 0x15, 0x0A, 0xCB, 0x12, 0x05, 0xA7, 0x32, 0xFE, 0xED, 0xAB, 0xAA, 0x00, 0xC2,
+  0xFE, 0xE5, 0x4A, 0xFE, 0xA9, 0xA4, 0x9C, 0xBC, 0x12, 0x0A, 0xCB, 0x15, 0x28, 0x00, 0xF8, 0x28,
+  0x15, 0x0A, 0xCC, 0x12, 0xFE, 0xED, 0xCB, 0x0B, 0x9C, 0xBB, 0x7A, 0xC0, 0x2D, 0xA3, 0x65, 0xFE,
+  0xE4, 0xC7, 0x12, 0x56, 0xCC, 0x15, 0x28, 0x00, 0xF8, 0x28, 0x15, 0x0A, 0xCA, 0x12, 0x9D, 0xAB,
+  0xFE, 0xCB, 0x88, 0x0B, 0x2D, 0x7E, 0xC2, 0x2D, 0x9C, 0xC9, 0xFE, 0xC2, 0xE5, 0x00, 0x12, 0x0A,
+  0xCA, 0x15, 0x28, 0x9D, 0x5A, 0xF8, 0x28, 0x15, 0x0A, 0xCA, 0x12, 0x9D, 0xAB, 0xFE, 0xDC, 0xCA,
+  0x0B, 0x35, 0xC3, 0x30, 0x9B, 0xC9, 0xFE, 0xD3, 0xE6, 0x00, 0x12, 0x0A, 0xCA, 0xA1, 0x97, 0x28,
+  0x9D, 0x5A, 0xF8, 0x28, 0x15, 0x0A, 0xCA, 0x12, 0x9D, 0xAB, 0xFE, 0xDC, 0xEA, 0xFE, 0xFE, 0xCD,
+  0x35, 0xC2, 0x6F, 0x9C, 0xBA, 0x9C, 0xC9, 0xFE, 0xDC, 0x07, 0x00, 0x12, 0x0A, 0xCA, 0x15, 0x28,
+  0x9D, 0x5A, 0xF8, 0x28, 0x15, 0x0A, 0xCA, 0x12, 0x3B, 0xFE, 0xD3, 0xE8, 0xFE, 0xFF, 0x0D, 0x2D,
+  0x35, 0xC0, 0x01, 0x35, 0x98, 0xFC, 0x33, 0xFE, 0xCB, 0x46, 0xFE, 0xA1, 0x04, 0x12, 0x0A, 0xCA,
+  0x15, 0x28, 0x9D, 0x5A, 0xF8, 0x28, 0x15, 0x0A, 0xCA, 0x6E, 0x05, 0xA5, 0x44, 0x1C, 0xA4, 0x55,
+  0x35, 0xC0, 0x51, 0x2E, 0xC0, 0x52, 0xFE, 0xA9, 0xA5, 0x0A, 0x0F, 0x0A, 0xCA, 0x15, 0x98, 0x0D,
+  0x00, 0xF8, 0x28, 0x15, 0x0A, 0xCB, 0x12, 0x9D, 0xAB, 0xFE, 0xBA, 0x65, 0xFE, 0xF5, 0x89, 0xA4,
+  0x54, 0x52, 0x2E, 0x33, 0x21, 0x07, 0x05, 0x12, 0x0A, 0xCB, 0x15, 0x28, 0x9D, 0x5A, 0xF8, 0x28,
+  0x15, 0x0A, 0xCC, 0x12, 0x05, 0xA5, 0x43, 0xFE, 0xD3, 0x86, 0xA7, 0x22, 0x6E, 0x99, 0xEE, 0xFE,
+  0xB1, 0xC5, 0x05, 0x12, 0x0A, 0xCC, 0x15, 0x28, 0x00, 0xF8, 0x28, 0x15, 0x0A, 0xCD, 0x12, 0x0A,
+  0x62, 0x05, 0xC0, 0x00, 0x05, 0x12, 0x0A, 0xCD, 0x15, 0x28, 0x9D, 0x5A, 0xF8, 0x28, 0x15, 0x0A,
+  0xCE, 0x12, 0xC0, 0x0F, 0xC0, 0x12, 0xC0, 0x0A, 0xCE, 0x15, 0x28, 0x00, 0xF8, 0x28, 0x15, 0x0A,
+  0xE4, 0x15, 0x28, 0x00, 0xF8, 0x28, 0x15, 0x0A, 0xE4, 0x15, 0x28, 0x00, 0xF8, 0x28, 0x15, 0x0A,
+  0xC6, 0x7A, 0xD4, 0x0A, 0xC6, 0x15, 0x28, 0x00, 0xF8, 0x28, 0x15, 0x0A, 0xE4, 0x15, 0x28, 0x00,
+  0xF8, 0x28, 0x15, 0x0A, 0xC4, 0x0D, 0x0A, 0x1D, 0x45, 0xD2, 0x1D, 0x0A, 0x0D, 0x0A, 0xC4, 0x15,
+  0x28, 0x00, 0xF8, 0x28, 0x15, 0x0A, 0xC4, 0x0D, 0x0A, 0xFE, 0x08, 0x20, 0x00, 0xD2, 0x08, 0x0A,
+  0x0D, 0x0A, 0xC4, 0x15, 0x28, 0x00, 0xF8, 0x28, 0x15, 0x0A, 0xC4, 0x0D, 0x0A, 0x0B, 0x00, 0xD2,
+  0x0B, 0x0A, 0x0D, 0x0A, 0xC4, 0x15, 0x28, 0x00, 0xF8, 0x28, 0x15, 0x0A, 0xC4, 0x0D, 0x0A, 0x0B,
+  0x00, 0xD2, 0x0B, 0x0A, 0x0D, 0x0A, 0xC4, 0x15, 0x28, 0x00, 0xF8, 0x28, 0x15, 0x0A, 0xC4, 0x0D,
+  0x0A, 0x0B, 0x00, 0xD2, 0x0B, 0x0A, 0x0D, 0x0A, 0xC4, 0x15, 0x28, 0x00, 0xF8, 0x28, 0x15, 0x0A,
+  0xC4, 0x0D, 0x0A, 0x0B, 0x00, 0xD2, 0x0B, 0x0A, 0x0D, 0x0A, 0xC4, 0x15, 0x28, 0x00, 0xF8, 0x28,
+  0xFE, 0xB1, 0x65, 0x0D, 0x12, 0xC4, 0x0D, 0x0B, 0x00, 0xD2, 0x0B, 0x0D, 0x12, 0xC4, 0x0D, 0x1C,
+  0x28, 0x00, 0xF8, 0x25, 0xA6, 0xF5, 0x55, 0x6E, 0xC2, 0x30, 0x35, 0x30, 0x08, 0x00, 0xD2, 0x08,
+  0x30, 0x35, 0x30, 0x35, 0xC2, 0x30, 0x3F, 0x25, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xD1,
+};
+
+const uint8_t kAssetIcon8Data[3476] PROGMEM = {
+  0xFD, 0xFD, 0xC4, 0x6E, 0x00, 0xC4, 0x05, 0x00, 0xDF, 0x05, 0x00, 0xFD, 0xFD, 0xDF, 0xFE, 0x39,
+  0xA4, 0xFE, 0x7B, 0x89, 0xAB, 0x30, 0xA8, 0x43, 0x7E, 0xC0, 0x9D, 0x9A, 0x97, 0xCE, 0xFE, 0x62,
+  0xE7, 0xFE, 0x20, 0xE2, 0x00, 0xD6, 0x3D, 0x08, 0x3A, 0xA8, 0x53, 0x27, 0xC0, 0x1F, 0x99, 0xCC,
+  0xFE, 0x7B, 0xA9, 0x32, 0x00, 0xF4, 0x08, 0x1F, 0xAC, 0x20, 0xA2, 0x67, 0xC0, 0x65, 0x09, 0xC0,
+  0x0E, 0x1A, 0xC0, 0x9B, 0xCB, 0xFE, 0xAC, 0xAA, 0xFE, 0x31, 0x62, 0x00, 0xD2, 0x32, 0x16, 0x30,
+  0x1A, 0xC0, 0x0E, 0x09, 0xC0, 0x0E, 0x1A, 0x6E, 0x09, 0xFE, 0xCD, 0xCE, 0xFE, 0x62, 0x85, 0x00,
+  0xF0, 0xFE, 0x31, 0x83, 0xFE, 0xCD, 0xCF, 0xFE, 0xFF, 0xB4, 0x0E, 0x9D, 0xBA, 0x30, 0x7A, 0x38,
+  0xC2, 0x30, 0xC0, 0xA2, 0x77, 0x1A, 0x9A, 0xE9, 0xFE, 0x93, 0xC7, 0xFE, 0x08, 0x40, 0x00, 0xCE,
+  0x0D, 0xFE, 0x94, 0x4A, 0x09, 0x1A, 0x04, 0x30, 0xC0, 0x38, 0xC2, 0x33, 0x30, 0x38, 0x0E, 0x69,
+  0xFE, 0xC5, 0x4A, 0xFE, 0x31, 0x42, 0x00, 0xED, 0xFE, 0x5A, 0xA6, 0xFE, 0xFF, 0x52, 0x0E, 0x30,
+  0x33, 0x38, 0xC8, 0x30, 0x7F, 0xA1, 0x74, 0xFE, 0xCD, 0x4A, 0xFE, 0x18, 0xC1, 0x00, 0xCC, 0xA7,
+  0x53, 0xFE, 0xCE, 0x0F, 0x1F, 0x38, 0x33, 0x38, 0xC8, 0x33, 0x5F, 0xA2, 0x74, 0x99, 0xEA, 0xFE,
+  0x5A, 0x64, 0x00, 0xEB, 0xFE, 0x62, 0xC7, 0xFE, 0xFF, 0xB3, 0x04, 0x33, 0x38, 0x04, 0xC0, 0x38,
+  0xC6, 0x04, 0xC0, 0x38, 0x30, 0xA0, 0x94, 0x96, 0xEF, 0x2E, 0x00, 0xCA, 0x3D, 0xFE, 0xDE, 0x70,
+  0x1A, 0x30, 0x38, 0x6F, 0xC0, 0x38, 0xC6, 0x04, 0xC0, 0x38, 0x3F, 0x9E, 0xA7, 0xA0, 0x85, 0x2B,
+  0xFE, 0x00, 0x00, 0xE9, 0xFE, 0x41, 0xE4, 0x0E, 0x38, 0xC0, 0x04, 0xC0, 0x9B, 0xD9, 0x33, 0x04,
+  0x38, 0xC4, 0x04, 0x9C, 0xC9, 0x20, 0x04, 0xC0, 0x9D, 0xA9, 0x0B, 0x23, 0x0D, 0x00, 0xC8, 0x0D,
+  0x27, 0x1A, 0x30, 0x38, 0x09, 0x20, 0x1B, 0x04, 0x38, 0xC4, 0x04, 0x33, 0x0F, 0x04, 0xC0, 0x38,
+  0x9C, 0xC8, 0x68, 0xFE, 0x41, 0xA3, 0x00, 0xE7, 0xA4, 0x65, 0xFE, 0xE6, 0x91, 0x09, 0x33, 0x38,
+  0xC0, 0x99, 0xEA, 0x98, 0xFA, 0xA6, 0x37, 0x04, 0x38, 0xC3, 0x04, 0x60, 0xFE, 0xF5, 0x88, 0x66,
+  0xFE, 0xFE, 0xAF, 0x38, 0x04, 0x9B, 0xC8, 0xA3, 0x64, 0xFE, 0x93, 0xC7, 0x00, 0xC8, 0xFE, 0x94,
+  0x2A, 0x1F, 0x30, 0x38, 0x04, 0x0F, 0x29, 0x2E, 0x2C, 0x04, 0x38, 0xC3, 0x04, 0x1E, 0x1A, 0x2F,
+  0x38, 0x04, 0x9D, 0xA8, 0x3A, 0x9A, 0xBD, 0xFE, 0x10, 0x60, 0x00, 0xE6, 0xFE, 0x94, 0x0A, 0x1F,
+  0x30, 0x38, 0x04, 0x9A, 0xD9, 0xFE, 0xED, 0x26, 0x2E, 0x1A, 0xA9, 0x05, 0x04, 0x38, 0xC1, 0x6B,
+  0x38, 0xFE, 0xF5, 0xCA, 0x9D, 0xA8, 0x29, 0xC0, 0x2C, 0x04, 0x2C, 0x32, 0x7F, 0x12, 0xFE, 0x00,
+  0x00, 0xC6, 0xFE, 0x31, 0x83, 0x09, 0x38, 0xC0, 0x04, 0x33, 0x29, 0xC0, 0x1F, 0x06, 0x38, 0x3F,
+  0x38, 0xC1, 0x04, 0x99, 0xEA, 0x1A, 0x2E, 0x0E, 0xFE, 0xF6, 0x8E, 0x04, 0x38, 0x9B, 0xC8, 0x10,
+  0xFE, 0x8B, 0x87, 0xFE, 0x00, 0x00, 0xE5, 0xA6, 0x53, 0xFE, 0xF7, 0x12, 0x04, 0x38, 0xC1, 0x3F,
+  0xFE, 0xF5, 0xEB, 0x1A, 0x29, 0x1F, 0x0F, 0x04, 0x38, 0xC0, 0x04, 0x1E, 0x1A, 0xA2, 0x77, 0x1A,
+  0xFE, 0xF6, 0x8E, 0x04, 0x38, 0xC0, 0x39, 0x0B, 0xFE, 0xA4, 0x68, 0xFE, 0x00, 0x00, 0xC6, 0x16,
+  0xFE, 0xFF, 0xB4, 0x30, 0x38, 0xC0, 0x04, 0x9A, 0xD9, 0xFE, 0xED, 0x47, 0x2E, 0x1A, 0x1E, 0x04,
+  0x38, 0xC0, 0x04, 0x0F, 0x1F, 0x29, 0x1A, 0x12, 0x3F, 0x38, 0x04, 0x9C, 0xC8, 0x9E, 0xA7, 0x42,
+  0xFE, 0x18, 0xA1, 0x9B, 0xAC, 0xE2, 0x6E, 0x00, 0xFE, 0x73, 0x48, 0xFE, 0xFF, 0xD4, 0x30, 0x38,
+  0xC1, 0x04, 0x38, 0xFE, 0xF5, 0xA9, 0x61, 0xC0, 0x2E, 0x2C, 0x04, 0xC0, 0x3B, 0x1A, 0x2E, 0x1A,
+  0xA7, 0x27, 0x04, 0x38, 0xC0, 0x04, 0x14, 0x35, 0x56, 0xFE, 0x18, 0xC1, 0x00, 0xC4, 0xA7, 0x43,
+  0x30, 0x38, 0xC3, 0x04, 0x2A, 0x1A, 0xA2, 0x77, 0x1A, 0x3B, 0x04, 0xC0, 0x2C, 0x2E, 0x29, 0xC0,
+  0xA2, 0x67, 0x38, 0x04, 0x38, 0x04, 0x2C, 0x2D, 0x10, 0xFE, 0x6A, 0xE5, 0x00, 0xE4, 0xFE, 0xC5,
+  0x8E, 0xFE, 0xFF, 0x93, 0x38, 0xC3, 0x04, 0x9D, 0xB9, 0x29, 0xC0, 0x59, 0xA2, 0x79, 0x04, 0x1B,
+  0x1F, 0x29, 0x1A, 0x12, 0x04, 0x38, 0xC1, 0x04, 0x20, 0x2D, 0x10, 0xFE, 0x62, 0x84, 0x00, 0xC2,
+  0x05, 0x00, 0xFE, 0x62, 0xE7, 0xFE, 0xFF, 0xB4, 0x30, 0x38, 0xC3, 0x04, 0x12, 0x9B, 0xC9, 0x29,
+  0x1F, 0x1B, 0x04, 0x01, 0x1F, 0x29, 0xC0, 0x27, 0x04, 0x38, 0xC0, 0x3F, 0x38, 0x32, 0xA2, 0x77,
+  0xFE, 0xBC, 0xE9, 0x00, 0xE3, 0xA4, 0x65, 0xFE, 0xEE, 0xD1, 0x04, 0x38, 0xC4, 0x04, 0x9A, 0xEA,
+  0x1A, 0x2E, 0x1A, 0x12, 0x3A, 0x29, 0xC0, 0x3A, 0x38, 0x04, 0x38, 0xC1, 0x04, 0x2C, 0x2D, 0x0B,
+  0xFE, 0x9C, 0x07, 0x00, 0xC4, 0xFE, 0x9C, 0x8B, 0xFE, 0xFF, 0xB4, 0x30, 0x38, 0xC3, 0x04, 0x38,
+  0xFE, 0xF5, 0xA9, 0x29, 0xC0, 0x3A, 0x12, 0x9B, 0xC9, 0x2E, 0x1A, 0xAA, 0x06, 0x04, 0x38, 0xC3,
+  0x39, 0x7D, 0x9B, 0xAC, 0xFE, 0x08, 0x60, 0x00, 0xE2, 0xAB, 0x30, 0x04, 0x38, 0xC6, 0x04, 0x2F,
+  0x1A, 0x29, 0x1A, 0x29, 0xC1, 0x1B, 0x04, 0x38, 0xC2, 0x04, 0x2C, 0x2D, 0x0B, 0x07, 0x00, 0xC4,
+  0xFE, 0xC5, 0x8E, 0x0E, 0x38, 0xC5, 0x04, 0x20, 0x29, 0xC1, 0x1A, 0x29, 0x1A, 0x2F, 0x04, 0x38,
+  0xC4, 0x9C, 0xC7, 0x35, 0xC0, 0xFE, 0x29, 0x22, 0x00, 0xE2, 0xFE, 0x41, 0xC4, 0x0E, 0x38, 0xC6,
+  0x04, 0xC0, 0xFE, 0xF6, 0x0B, 0x1A, 0x29, 0xC1, 0xA9, 0x06, 0x09, 0x38, 0xC3, 0x04, 0x2C, 0x2D,
+  0xA3, 0x66, 0xFE, 0xCD, 0x6A, 0x00, 0xC4, 0xFE, 0xD6, 0x0F, 0x09, 0x38, 0xC6, 0x09, 0x0F, 0x29,
+  0xC1, 0x1A, 0x17, 0x04, 0xC0, 0x38, 0xC4, 0x01, 0x2D, 0x06, 0xFE, 0x39, 0x83, 0x00, 0xE2, 0x3A,
+  0x0E, 0x38, 0xC6, 0x17, 0x61, 0xC0, 0x29, 0xC1, 0x2E, 0xA3, 0x57, 0x61, 0xA7, 0x16, 0x04, 0x38,
+  0xC1, 0x04, 0x20, 0x2D, 0xA3, 0x66, 0x96, 0xDF, 0xFE, 0x00, 0x00, 0xC4, 0x27, 0x09, 0x38, 0xC4,
+  0x04, 0x9A, 0xD9, 0x3A, 0x0B, 0x2E, 0x29, 0xC1, 0xA3, 0x57, 0xC0, 0x17, 0x38, 0xC2, 0x3F, 0x38,
+  0x9B, 0xD8, 0x2D, 0xA3, 0x66, 0xFE, 0x39, 0xA3, 0xFE, 0x00, 0x00, 0xE2, 0xFE, 0x39, 0xA4, 0x09,
+  0x38, 0xC6, 0x3A, 0x9D, 0xB9, 0x29, 0xC4, 0x1A, 0x2F, 0x04, 0x38, 0xC1, 0x04, 0x19, 0x2D, 0xA4,
+  0x55, 0xFE, 0xC5, 0x2A, 0x00, 0xC4, 0xFE, 0xCD, 0xCF, 0x0E, 0x38, 0xC4, 0x04, 0x2F, 0x98, 0xFA,
+  0x29, 0xC4, 0x1D, 0x3A, 0x38, 0xC2, 0x04, 0x2C, 0x35, 0x5A, 0x01, 0xFE, 0x31, 0x42, 0x00, 0xE2,
+  0xA6, 0x54, 0xFE, 0xF7, 0x12, 0x04, 0x38, 0xC5, 0x3A, 0x1A, 0xC0, 0x29, 0xC1, 0x69, 0x1F, 0x61,
+  0x2F, 0x04, 0x38, 0xC1, 0x04, 0x9B, 0xD8, 0x2D, 0x0B, 0xFE, 0xAC, 0x68, 0x00, 0xC4, 0x16, 0xFE,
+  0xFF, 0xB4, 0x33, 0x38, 0xC3, 0x04, 0x2F, 0x0E, 0x1F, 0x22, 0x29, 0xC1, 0x55, 0xC0, 0x3A, 0x38,
+  0xC2, 0x04, 0x20, 0x2D, 0x01, 0x25, 0xFE, 0x18, 0xA1, 0x00, 0xE3, 0x27, 0x09, 0x38, 0xC5, 0x9D,
+  0xB9, 0x0F, 0x1B, 0x98, 0xFA, 0x9D, 0xB9, 0x1F, 0x2F, 0x1B, 0x0F, 0xA2, 0x68, 0x04, 0x38, 0xC0,
+  0x04, 0x38, 0x9B, 0xD7, 0x2D, 0x10, 0xFE, 0x73, 0x26, 0x00, 0xC2, 0x05, 0x00, 0xFE, 0x7B, 0x89,
+  0xFE, 0xFF, 0xD4, 0x30, 0x7E, 0xC3, 0x04, 0x27, 0x0F, 0x1B, 0x2F, 0x99, 0xE9, 0x29, 0x06, 0x1B,
+  0x0F, 0x1B, 0x38, 0xC2, 0x04, 0x08, 0x2D, 0xA3, 0x66, 0x28, 0x00, 0xE2, 0x05, 0x00, 0xFE, 0x94,
+  0x4A, 0xFE, 0xFF, 0xB4, 0x30, 0x38, 0xC4, 0x33, 0x2C, 0x38, 0xFE, 0xF5, 0xEA, 0x22, 0x56, 0x3B,
+  0x38, 0x2C, 0x38, 0x3F, 0x38, 0xC0, 0x04, 0x19, 0x35, 0x32, 0x01, 0xFE, 0x31, 0x62, 0x00, 0xC4,
+  0xFE, 0x39, 0xA4, 0x09, 0x38, 0xC4, 0x3F, 0x38, 0x2C, 0x38, 0x3B, 0x1A, 0x22, 0x0B, 0x38, 0x2C,
+  0x33, 0x38, 0xC1, 0x04, 0x2C, 0x35, 0x2D, 0x10, 0xFE, 0x8B, 0xC7, 0x00, 0xE4, 0x32, 0x09, 0x38,
+  0xC5, 0xFE, 0xF5, 0xA9, 0x1D, 0x29, 0xC4, 0x1A, 0x2F, 0x04, 0x38, 0x04, 0x38, 0x3C, 0x59, 0x06,
+  0xFE, 0xCD, 0x4A, 0x00, 0xC6, 0xFE, 0xD5, 0xEF, 0x09, 0x38, 0xC3, 0x04, 0x2F, 0x1A, 0x29, 0xC4,
+  0x1D, 0x3A, 0x38, 0xC1, 0x04, 0x9C, 0xC7, 0x35, 0x32, 0x06, 0x17, 0x00, 0xE5, 0xFE, 0xC5, 0x6E,
+  0xFE, 0xFF, 0x93, 0x33, 0x38, 0xC3, 0x3A, 0x1D, 0x29, 0xC4, 0x1A, 0x2F, 0x04, 0x38, 0x04, 0x0D,
+  0x35, 0x2D, 0x10, 0xFE, 0x5A, 0x64, 0x00, 0xC6, 0x03, 0xFE, 0xFF, 0xD4, 0x30, 0x38, 0xC2, 0x04,
+  0x2F, 0x1A, 0x29, 0xC4, 0x1D, 0x3A, 0x38, 0xC0, 0x04, 0x2C, 0x35, 0x2D, 0xA4, 0x55, 0x07, 0x00,
+  0xE6, 0xFE, 0x39, 0xA4, 0x09, 0x38, 0xC4, 0xFE, 0xF5, 0xCA, 0x2E, 0x6B, 0x29, 0xC1, 0x2E, 0x35,
+  0x29, 0x3B, 0x04, 0xC0, 0x20, 0x9D, 0xB7, 0x2D, 0x0B, 0xFE, 0xC5, 0x2A, 0x00, 0xC7, 0x05, 0xFE,
+  0xCD, 0xEF, 0x0E, 0x33, 0x38, 0xC1, 0x04, 0x3B, 0x29, 0x6F, 0x2E, 0x29, 0xC1, 0x35, 0x2E, 0x06,
+  0x38, 0x04, 0x38, 0x9C, 0xC7, 0x55, 0xC0, 0x01, 0x17, 0x00, 0xE7, 0xFE, 0x8B, 0xE9, 0xFE, 0xFF,
+  0xD4, 0x30, 0x38, 0xC3, 0x33, 0x38, 0xFE, 0xF5, 0xEA, 0x9C, 0xC9, 0x1A, 0xFE, 0xF6, 0x8E, 0x38,
+  0x33, 0x38, 0x04, 0x9E, 0xA7, 0x9C, 0xC8, 0x2D, 0x35, 0x32, 0xFE, 0x29, 0x22, 0x97, 0xCF, 0xC8,
+  0x1E, 0x04, 0x38, 0xC4, 0x33, 0x38, 0x9B, 0xC9, 0x1A, 0x22, 0x0B, 0x38, 0x33, 0xC0, 0x04, 0x38,
+  0x01, 0x35, 0x2D, 0xA6, 0x33, 0xFE, 0x83, 0x66, 0xFE, 0x00, 0x00, 0xE9, 0xFE, 0xB5, 0x2D, 0x1F,
+  0x30, 0x38, 0xC1, 0x04, 0x38, 0x04, 0xFE, 0xF5, 0xEB, 0x22, 0x1A, 0xFE, 0xF6, 0x8E, 0x09, 0x04,
+  0xC0, 0x20, 0x35, 0x2D, 0x35, 0xA3, 0x56, 0xFE, 0x5A, 0x44, 0xFE, 0x00, 0x00, 0xCA, 0xFE, 0x62,
+  0xA6, 0xFE, 0xFF, 0xB4, 0x38, 0x33, 0x38, 0xC0, 0x3F, 0xC0, 0x09, 0x99, 0xEB, 0xFE, 0xED, 0x47,
+  0x22, 0x12, 0x04, 0x3F, 0x04, 0x64, 0x01, 0x32, 0x2D, 0x15, 0xFE, 0xAC, 0x88, 0x00, 0xEA, 0xA2,
+  0x76, 0x2A, 0x1F, 0x38, 0x33, 0x38, 0xC1, 0x04, 0xFE, 0xF5, 0xEA, 0x22, 0x1A, 0x07, 0xA7, 0x26,
+  0x38, 0x9D, 0xB7, 0x2D, 0xC0, 0xA3, 0x66, 0xC0, 0x24, 0x00, 0xCC, 0xFE, 0x6B, 0x07, 0x0E, 0x09,
+  0x30, 0x38, 0xC1, 0x04, 0x9A, 0xD9, 0x1A, 0x22, 0x12, 0x04, 0x38, 0x20, 0x35, 0x2D, 0x32, 0xA4,
+  0x55, 0x2B, 0x05, 0x66, 0xEC, 0xFE, 0x8C, 0x0A, 0x09, 0x0E, 0x3F, 0x5A, 0x3F, 0xC0, 0x33, 0x27,
+  0xC1, 0x14, 0x32, 0x2D, 0x01, 0x10, 0x97, 0xDF, 0xFE, 0x41, 0xC3, 0x00, 0xCE, 0xFE, 0x4A, 0x25,
+  0xFE, 0xE6, 0x91, 0xA9, 0x22, 0x04, 0x3C, 0x3F, 0xC0, 0x38, 0x27, 0xC1, 0x20, 0x39, 0x2D, 0xC0,
+  0xA4, 0x55, 0x01, 0x21, 0x00, 0xEF, 0xFE, 0x39, 0x83, 0xFE, 0xBD, 0x2B, 0xFE, 0xFF, 0x30, 0xA2,
+  0x67, 0x66, 0x2C, 0x25, 0x65, 0x0D, 0x64, 0xC0, 0x0B, 0x10, 0x9A, 0xCD, 0xFE, 0x8B, 0xA7, 0xFE,
+  0x10, 0x81, 0x00, 0x05, 0x00, 0xCC, 0x05, 0x00, 0x21, 0xFE, 0x8B, 0xE8, 0xFE, 0xEE, 0xAE, 0x3B,
+  0xC0, 0x31, 0x65, 0x20, 0x0D, 0x01, 0x3A, 0x6F, 0x10, 0x06, 0xFE, 0xBC, 0xE9, 0xFE, 0x39, 0x82,
+  0x00, 0xF2, 0x0A, 0xFE, 0x83, 0x86, 0xFE, 0xC5, 0x29, 0xA7, 0x53, 0xA2, 0x87, 0x32, 0x2D, 0x56,
+  0x9C, 0xAB, 0x97, 0xBF, 0xFE, 0x62, 0xC5, 0x21, 0x00, 0xD4, 0xA3, 0x75, 0xFE, 0x62, 0xA5, 0xFE,
+  0xAC, 0xA8, 0x04, 0xA4, 0x64, 0x2D, 0x32, 0x2D, 0x9D, 0x9B, 0x1B, 0xFE, 0x83, 0x87, 0x0A, 0x00,
+  0xF3, 0xFE, 0x41, 0x82, 0xFE, 0x9B, 0x65, 0x7E, 0xA4, 0x65, 0xA6, 0x53, 0xA5, 0x64, 0xA2, 0x87,
+  0x56, 0x9D, 0x9A, 0x9A, 0xBC, 0x9B, 0xAC, 0x2B, 0x38, 0xA3, 0x66, 0x0C, 0xD2, 0x11, 0x51, 0x2B,
+  0x38, 0x21, 0x16, 0x32, 0x3A, 0x9D, 0x9A, 0x9C, 0x9B, 0x0C, 0x2B, 0x56, 0x22, 0x00, 0xF1, 0xFE,
+  0x51, 0xE2, 0xFE, 0xFD, 0xC8, 0xC1, 0x66, 0x2E, 0x29, 0xC2, 0x36, 0x3B, 0xC1, 0x36, 0xD4, 0x3B,
+  0xC1, 0x36, 0x29, 0xC2, 0x2E, 0x36, 0x3B, 0xC1, 0x37, 0x00, 0xF0, 0xFE, 0xCC, 0xA7, 0x36, 0x9D,
+  0x9A, 0x6F, 0xC2, 0x29, 0xC0, 0x26, 0xDE, 0x29, 0xC0, 0x26, 0xC2, 0x1A, 0x36, 0x97, 0xBF, 0x00,
+  0xEF, 0x15, 0xFE, 0xE5, 0x07, 0x2E, 0x26, 0x7A, 0xEA, 0x26, 0x2E, 0x0D, 0x15, 0x00, 0xEE, 0x15,
+  0xFE, 0xDD, 0x07, 0x29, 0x56, 0x26, 0xD0, 0x29, 0xC6, 0x26, 0xD0, 0x21, 0x29, 0x0A, 0x15, 0x00,
+  0xEF, 0xFE, 0xE5, 0x47, 0xA4, 0x65, 0x66, 0xD0, 0x38, 0x9D, 0xBA, 0x65, 0xC4, 0x22, 0x38, 0x33,
+  0xD0, 0x38, 0x17, 0x00, 0xEE, 0xA4, 0xB5, 0xA5, 0xA5, 0xFE, 0xDB, 0x87, 0xA2, 0x76, 0x66, 0xCF,
+  0x1B, 0x9D, 0xBA, 0xFE, 0xED, 0x4E, 0xFE, 0xF6, 0xB4, 0x61, 0xA2, 0x66, 0xC0, 0x1E, 0x2F, 0x0B,
+  0x05, 0x1B, 0x16, 0xCF, 0x1B, 0x0E, 0x2C, 0x9B, 0x5B, 0x00, 0xEA, 0xA1, 0xA7, 0xFE, 0xA1, 0x84,
+  0xA4, 0xB6, 0x7A, 0x42, 0x56, 0x7A, 0xCE, 0x3E, 0x51, 0xA6, 0x35, 0xFE, 0xEF, 0x3D, 0xA5, 0x45,
+  0x6E, 0xFE, 0xE5, 0x96, 0xC0, 0x2E, 0x29, 0x3F, 0x20, 0x2A, 0x3E, 0x39, 0xCE, 0x36, 0x3E, 0xA3,
+  0x76, 0x9D, 0x8A, 0x9A, 0x5B, 0x99, 0x1C, 0x00, 0xE8, 0xFE, 0xA9, 0x85, 0x1A, 0x9E, 0x79, 0xC0,
+  0x7E, 0xD1, 0x9D, 0xBA, 0xFE, 0xE5, 0x95, 0x2E, 0x9D, 0xB9, 0x9D, 0xBA, 0xFE, 0xD2, 0x27, 0xC0,
+  0x3B, 0x11, 0x2E, 0x03, 0x32, 0x08, 0xD1, 0x00, 0x9C, 0x9B, 0xA1, 0x97, 0x9D, 0x4A, 0xFE, 0x00,
+  0x00, 0xE7, 0xA6, 0xC4, 0x1A, 0x9E, 0x79, 0x7A, 0xD1, 0x08, 0x61, 0xFE, 0xDB, 0x0A, 0xFE, 0xF7,
+  0xBE, 0x61, 0x2E, 0xFE, 0xDC, 0x30, 0x32, 0xC0, 0x26, 0x2E, 0x0C, 0x1D, 0xFE, 0xDA, 0xEA, 0x37,
+  0x08, 0x03, 0xCD, 0x08, 0xC0, 0x9D, 0x9A, 0x41, 0xC0, 0x27, 0x98, 0x0C, 0x9C, 0x4B, 0xE6, 0xFE,
+  0x89, 0x44, 0xA6, 0xC4, 0x03, 0xD2, 0x08, 0x32, 0xFE, 0xE5, 0xB6, 0x2E, 0x1D, 0xFE, 0xEE, 0x9A,
+  0x03, 0x08, 0xC0, 0x03, 0x11, 0x1D, 0x2E, 0x0F, 0x32, 0x08, 0x03, 0xCD, 0x5A, 0x41, 0x15, 0x1C,
+  0x15, 0x7F, 0x9B, 0x4B, 0x99, 0x1C, 0xE6, 0xA8, 0xF3, 0x2C, 0x46, 0x24, 0xD0, 0x29, 0x9D, 0xBA,
+  0xFE, 0xC2, 0x89, 0xFE, 0xF7, 0x9E, 0xC0, 0x2E, 0xFE, 0xCB, 0x8D, 0xFE, 0xB9, 0x23, 0x29, 0xC0,
+  0x07, 0x32, 0x2E, 0x18, 0xC0, 0x2B, 0xFE, 0xB9, 0x64, 0x29, 0x24, 0xCC, 0x1C, 0x15, 0x1C, 0xC0,
+  0x15, 0x24, 0x2A, 0x00, 0xE6, 0xA5, 0xE5, 0x27, 0x9F, 0x68, 0x1C, 0x15, 0xCF, 0x21, 0x9C, 0xBA,
+  0xFE, 0xD4, 0xD2, 0x2E, 0x1D, 0x97, 0xFC, 0x15, 0xC0, 0x1C, 0xC0, 0x15, 0xC0, 0xFE, 0xEE, 0x99,
+  0x1D, 0x2E, 0xFE, 0xD4, 0xD2, 0x3C, 0x21, 0x15, 0xCB, 0x1C, 0xC3, 0x15, 0x27, 0x08, 0x00, 0xE6,
+  0xA1, 0x97, 0x15, 0x24, 0x15, 0x1C, 0xCE, 0x21, 0x15, 0xA2, 0x78, 0xFE, 0xEE, 0xFB, 0x1D, 0x2E,
+  0xFE, 0xCC, 0x0F, 0xFE, 0xB1, 0x03, 0x21, 0x1C, 0xC0, 0x21, 0x3F, 0x14, 0x2E, 0x1D, 0x27, 0x29,
+  0x15, 0x21, 0x1C, 0xCE, 0x15, 0x24, 0x15, 0x0B, 0x00, 0xE7, 0xA3, 0xC6, 0x1C, 0xA1, 0x97, 0x24,
+  0x21, 0xCD, 0x24, 0x9D, 0xA9, 0xFE, 0xCB, 0x6C, 0xFE, 0xF7, 0xDF, 0x61, 0x9D, 0xA9, 0xFE, 0xB9,
+  0xE7, 0x15, 0x21, 0xC2, 0x15, 0x01, 0x38, 0x18, 0x29, 0x26, 0x04, 0x24, 0x21, 0xCD, 0x24, 0x27,
+  0x1C, 0x2B, 0x00, 0xE9, 0xA2, 0xA6, 0x22, 0xA2, 0xA7, 0xA1, 0xA7, 0xCD, 0x6F, 0x9C, 0xCA, 0xFE,
+  0xDD, 0x55, 0x2E, 0xC0, 0xFE, 0xDD, 0x75, 0x37, 0x19, 0x0D, 0xC2, 0x19, 0x37, 0x3B, 0x2E, 0xC0,
+  0xFE, 0xDD, 0x54, 0x37, 0x19, 0x0D, 0xCD, 0x3F, 0x22, 0x16, 0x00, 0xEC, 0xA2, 0xD7, 0xA4, 0xE6,
+  0x5A, 0x26, 0xCB, 0x65, 0xA3, 0x57, 0xFE, 0xE6, 0xDB, 0x1D, 0x2E, 0xFE, 0xAA, 0xEB, 0xFE, 0x80,
+  0x41, 0x26, 0xC4, 0x01, 0xFE, 0xAB, 0x0C, 0x2E, 0x1D, 0x1F, 0xFE, 0x88, 0xE3, 0x1A, 0x26, 0xCB,
+  0x23, 0x26, 0x9C, 0x2A, 0x00, 0xED, 0xA1, 0xB7, 0xFE, 0x88, 0xC3, 0xCE, 0x9D, 0xA9, 0xFE, 0xA2,
+  0x49, 0x1D, 0xC0, 0x38, 0xFE, 0x91, 0x45, 0x9B, 0xBA, 0x26, 0xC4, 0x51, 0x0B, 0x38, 0x1D, 0xC0,
+  0x15, 0x06, 0x26, 0xCE, 0x11, 0x00, 0xEB, 0x7A, 0xFE, 0x78, 0xA2, 0x26, 0xCE, 0x01, 0xFE, 0xBB,
+  0xCF, 0xFE, 0xFF, 0xFF, 0x29, 0xFE, 0xDD, 0xF7, 0x12, 0x26, 0xC6, 0x12, 0x1D, 0x29, 0x31, 0x04,
+  0x01, 0x26, 0xCE, 0x14, 0x03, 0x00, 0xEA, 0xFE, 0x60, 0x82, 0xA2, 0xC7, 0x23, 0x26, 0xCD, 0x01,
+  0xFE, 0xCD, 0x55, 0x2E, 0x31, 0xFE, 0xC4, 0x51, 0x01, 0x26, 0xC6, 0x01, 0xFE, 0xC4, 0x71, 0x31,
+  0x5A, 0xFE, 0xCD, 0x34, 0x01, 0x26, 0xCD, 0x23, 0xA0, 0xA8, 0x9E, 0x39, 0x00, 0xE9, 0xA2, 0xD7,
+  0x29, 0x23, 0x7A, 0xCE, 0x1A, 0xFE, 0xDE, 0x59, 0xFE, 0xF7, 0xDF, 0x2E, 0xFE, 0xAB, 0x0C, 0x01,
+  0x26, 0xC6, 0x01, 0x0B, 0x2E, 0x29, 0x3A, 0x1A, 0x26, 0xCE, 0x23, 0xA0, 0xA8, 0x9C, 0x1A, 0x00,
+  0xE7, 0xA1, 0xA7, 0xFE, 0x88, 0xC3, 0xD0, 0x17, 0xA4, 0x66, 0xFE, 0xEF, 0x1C, 0xA5, 0x45, 0x18,
+  0xFE, 0x9A, 0x08, 0xFE, 0x80, 0x61, 0x26, 0xC6, 0x06, 0x01, 0x18, 0x1D, 0x33, 0x3F, 0x17, 0x26,
+  0xD0, 0x0E, 0x00, 0xE6, 0xFE, 0x68, 0x82, 0x26, 0x23, 0x26, 0xCE, 0x12, 0xAA, 0x13, 0x18, 0x1D,
+  0x38, 0xFE, 0x91, 0x45, 0x17, 0x26, 0xC6, 0x12, 0x0B, 0x38, 0x1D, 0x18, 0x30, 0x12, 0x26, 0xCE,
+  0x23, 0x26, 0x09, 0x00, 0xE5, 0xA2, 0xD7, 0x29, 0x23, 0x7A, 0xCF, 0x06, 0xFE, 0xA2, 0x69, 0xFE,
+  0xF7, 0xDF, 0x1D, 0x98, 0xEC, 0x2B, 0x61, 0x26, 0xC6, 0x1A, 0x2B, 0x13, 0x1D, 0x29, 0xFE, 0xA2,
+  0x69, 0x06, 0x26, 0xCF, 0x23, 0xA0, 0xA8, 0x9C, 0x1A, 0x00, 0xE3, 0x7A, 0x14, 0xA1, 0x98, 0xD1,
+  0x9C, 0xBA, 0xFE, 0xAA, 0xEB, 0xFE, 0xF7, 0xDF, 0x69, 0xFE, 0xDE, 0x38, 0xFE, 0x88, 0xA2, 0x26,
+  0xC8, 0x1A, 0xFE, 0xDE, 0x58, 0x22, 0x29, 0xFE, 0xAA, 0xCB, 0x01, 0x26, 0xD1, 0x14, 0x03, 0x00,
+  0xE2, 0xA3, 0xD6, 0xA3, 0xF7, 0x23, 0x26, 0xD0, 0x01, 0xFE, 0xAB, 0x2C, 0xFE, 0xF7, 0xFF, 0x66,
+  0xFE, 0xDE, 0x18, 0x12, 0x26, 0xC8, 0x12, 0x29, 0xFE, 0xF7, 0xDF, 0x2E, 0x10, 0x01, 0x26, 0xD0,
+  0x23, 0xA0, 0xA8, 0x9C, 0x2A, 0x00, 0xE2, 0x14, 0x26, 0xD2, 0x01, 0xFE, 0xB3, 0x2B, 0xFE, 0xFF,
+  0xBC, 0x55, 0xFE, 0xDD, 0xB4, 0xFE, 0x80, 0x62, 0x26, 0xC8, 0x51, 0x3E, 0x03, 0x7F, 0x0C, 0x01,
+  0x26, 0xD2, 0x14, 0x00, 0xE1, 0xA2, 0xC7, 0xFE, 0x90, 0xC3, 0x4A, 0x26, 0xD1, 0x0D, 0xFE, 0xCC,
+  0x08, 0xFE, 0xFE, 0xEC, 0x62, 0x98, 0xEE, 0x26, 0x66, 0x26, 0xC6, 0x1A, 0x2B, 0xFE, 0xED, 0xEB,
+  0xA5, 0x54, 0x04, 0xFE, 0xC3, 0xA7, 0xFE, 0x80, 0x42, 0x26, 0xD1, 0x5A, 0x29, 0x9C, 0x0A, 0x00,
+  0xE0, 0xFE, 0x60, 0x82, 0x29, 0x4A, 0x26, 0xD1, 0x17, 0xFE, 0xE5, 0x6A, 0xAB, 0x00, 0x62, 0x64,
+  0xFE, 0x99, 0xA3, 0xFE, 0x80, 0x82, 0x26, 0xC6, 0x0D, 0xFE, 0xA2, 0x05, 0xFE, 0xFE, 0xAD, 0x51,
+  0x06, 0xFE, 0xDC, 0xC8, 0x12, 0x26, 0xD1, 0x23, 0xA0, 0xA8, 0x9E, 0x49, 0x00, 0xDF, 0x7A, 0x17,
+  0x26, 0xD2, 0x12, 0xA7, 0x33, 0x2D, 0x35, 0xC1, 0xFE, 0xB2, 0xA5, 0x0D, 0x26, 0xC6, 0x08, 0xFE,
+  0xBB, 0x47, 0xFE, 0xFE, 0xED, 0x2D, 0x01, 0x98, 0xEC, 0xFE, 0x91, 0x23, 0x9C, 0xAC, 0x26, 0xD2,
+  0x17, 0x03, 0x00, 0xDE, 0xA2, 0xB7, 0x29, 0x23, 0x26, 0xD1, 0x0D, 0xFE, 0xAA, 0xA6, 0x0B, 0x2D,
+  0x35, 0x69, 0xFE, 0xCB, 0xC6, 0xFE, 0x80, 0x82, 0x26, 0xC6, 0x0D, 0xFE, 0xD4, 0xC9, 0xFE, 0xFE,
+  0xED, 0x2D, 0x3C, 0x9C, 0xC9, 0xFE, 0xA2, 0x04, 0x12, 0x26, 0xD1, 0x23, 0x29, 0x20, 0x00, 0xDE,
+  0xA3, 0xF6, 0x29, 0x23, 0x26, 0xD1, 0x08, 0xFE, 0xCC, 0x08, 0x0B, 0x2D, 0x3C, 0x64, 0xFE, 0xE4,
+  0xC7, 0x2B, 0x21, 0x26, 0xC4, 0x1A, 0xA3, 0x56, 0xFE, 0xED, 0xEB, 0x01, 0x35, 0x3C, 0x9D, 0xB8,
+  0xFE, 0xC3, 0x25, 0x0D, 0x26, 0xD1, 0x5A, 0xA0, 0xA8, 0x34, 0x00, 0xDE, 0xFE, 0x68, 0x82, 0x26,
+  0xD3, 0x17, 0x31, 0xAB, 0x00, 0x35, 0x01, 0x9D, 0xA9, 0x99, 0xFC, 0xFE, 0x99, 0xA4, 0x12, 0x26,
+  0xC4, 0x12, 0x2F, 0x01, 0x35, 0xC0, 0x3C, 0x13, 0xFE, 0xDC, 0x46, 0x17, 0x26, 0xD1, 0x23, 0x26,
+  0x09, 0x00, 0xDD, 0x7A, 0x14, 0x26, 0x23, 0x26, 0xD0, 0x12, 0xA7, 0x33, 0x2D, 0x3A, 0x35, 0x01,
+  0x9C, 0xBA, 0x9C, 0xC9, 0xFE, 0xB2, 0xC5, 0x0D, 0x26, 0xC4, 0x08, 0xFE, 0xBB, 0x67, 0x0B, 0x2D,
+  0x35, 0x01, 0x9A, 0xDB, 0x9A, 0xDB, 0xFE, 0x91, 0x43, 0x17, 0x26, 0xD0, 0x23, 0x26, 0x14, 0x03,
+  0x00, 0xDC, 0xA1, 0x97, 0x26, 0xD3, 0x0D, 0xFE, 0xAA, 0xA6, 0xFE, 0xFE, 0xED, 0x2D, 0x35, 0xC0,
+  0x1C, 0x33, 0xFE, 0xCB, 0xE6, 0x0D, 0x26, 0xC4, 0x0D, 0xFE, 0xD4, 0xC9, 0xFE, 0xFE, 0xED, 0x2D,
+  0x35, 0x01, 0x99, 0xEC, 0x60, 0xFE, 0xAA, 0x24, 0x0D, 0x26, 0xD3, 0xFE, 0x10, 0x20, 0x00, 0xDC,
+  0x11, 0x26, 0xD3, 0x08, 0xFE, 0xCC, 0x28, 0xFE, 0xFF, 0x0D, 0x35, 0x01, 0xC0, 0x9B, 0xCB, 0x2E,
+  0x9B, 0xBC, 0x2B, 0x62, 0x26, 0xC2, 0x1A, 0xA3, 0x56, 0xFE, 0xEE, 0x0C, 0xA6, 0x43, 0x3C, 0x01,
+  0xC0, 0x98, 0xFC, 0x33, 0xFE, 0xC3, 0x45, 0x0D, 0x26, 0xD3, 0x11, 0x00, 0xDC, 0x20, 0xFE, 0x90,
+  0xC3, 0x23, 0x26, 0xD1, 0x55, 0xFE, 0xDC, 0xE8, 0xAB, 0x10, 0x9D, 0xAA, 0x6E, 0x0B, 0x2E, 0x66,
+  0x2E, 0x16, 0x97, 0xEF, 0x26, 0xC2, 0x12, 0xAA, 0x10, 0xFE, 0xF6, 0x2A, 0x10, 0xC1, 0x61, 0x9D,
+  0xAA, 0x33, 0xFE, 0xDC, 0x67, 0x17, 0x7F, 0xD1, 0x23, 0xA0, 0xA8, 0x20, 0x00, 0xDC, 0xA2, 0xC7,
+  0x29, 0x4A, 0x26, 0xD0, 0x17, 0x38, 0xFE, 0xED, 0x07, 0xA2, 0x66, 0xC2, 0x6F, 0x66, 0x33, 0x0E,
+  0x0D, 0xA3, 0x66, 0xC2, 0x0D, 0x0E, 0x33, 0x1A, 0xC1, 0x21, 0x6E, 0x7A, 0x52, 0x38, 0x17, 0x7F,
+  0xD0, 0x23, 0xA0, 0xA8, 0x9C, 0x0A, 0x00, 0xDC, 0x23, 0x29, 0x4A, 0x26, 0xD0, 0x0D, 0xFE, 0xAA,
+  0x44, 0xFE, 0xFD, 0xE8, 0x33, 0xC4, 0xA3, 0x65, 0xFE, 0xD4, 0x26, 0x12, 0x26, 0xC2, 0x12, 0x1D,
+  0xFE, 0xFE, 0x09, 0x33, 0xC4, 0x00, 0x35, 0x0D, 0x26, 0xD0, 0x23, 0x29, 0x9C, 0x0A, 0x9E, 0x49,
+  0xDC, 0x20, 0x29, 0x4A, 0x26, 0xD0, 0x17, 0xA6, 0x53, 0x35, 0x66, 0xC4, 0x35, 0x9D, 0xAB, 0x26,
+  0xC4, 0x23, 0x35, 0x30, 0xC4, 0x35, 0x05, 0x17, 0x26, 0xD0, 0x5A, 0x29, 0x20, 0x00, 0xDC, 0xA1,
+  0xC7, 0x26, 0x23, 0x26, 0xD1, 0x17, 0x0D, 0xC6, 0x12, 0x26, 0xC4, 0x12, 0x0D, 0xC6, 0x17, 0x26,
+  0xD3, 0x11, 0x00, 0xDC, 0xA1, 0xA7, 0x26, 0x23, 0x26, 0xFD, 0xC0, 0x23, 0x26, 0x0E, 0x00, 0xDC,
+  0x03, 0x17, 0x26, 0xFD, 0xC2, 0x17, 0x03, 0x00, 0xDD, 0xFE, 0x70, 0xA2, 0x26, 0xFD, 0xC2, 0x11,
+  0x00, 0xDE, 0xFE, 0x60, 0x82, 0x29, 0x23, 0x26, 0xFC, 0x23, 0x29, 0x9E, 0x39, 0x00, 0xDE, 0xA2,
+  0xE7, 0xA4, 0xE6, 0x23, 0x26, 0xFC, 0x23, 0x29, 0x9D, 0x19, 0x00, 0xDE, 0x0E, 0x26, 0x23, 0x26,
+  0xFC, 0x23, 0x26, 0x0E, 0x00, 0xDF, 0x11, 0x26, 0xFD, 0xC0, 0x11, 0x00, 0xE0, 0xA3, 0xE6, 0x29,
+  0x23, 0x26, 0xFA, 0x23, 0x29, 0x31, 0x00, 0xE0, 0x0E, 0x26, 0xFD, 0xC0, 0xFE, 0x10, 0x20, 0x00,
+  0xE1, 0x06, 0x29, 0x23, 0x26, 0xF8, 0x23, 0x29, 0x06, 0x00, 0xE2, 0xA1, 0xB7, 0x26, 0x23, 0x26,
+  0xF8, 0x23, 0x26, 0x11, 0x00, 0xE3, 0x06, 0x29, 0x23, 0x26, 0xF6, 0x23, 0x29, 0x06, 0x00, 0xE4,
+  0x0E, 0x26, 0xFA, 0x0E, 0x00, 0xE5, 0x31, 0x29, 0x23, 0x26, 0xF4, 0x23, 0x29, 0x2E, 0x00, 0xE7,
+  0xFE, 0x68, 0x82, 0x29, 0x23, 0x26, 0xF2, 0x23, 0x29, 0x09, 0x00, 0xE8, 0x0B, 0x17, 0x26, 0xF4,
+  0x17, 0x0B, 0x00, 0xE9, 0x14, 0x26, 0xC0, 0x23, 0x26, 0xEE, 0x23, 0x26, 0xC0, 0x14, 0x00, 0xEB,
+  0xA2, 0xC7, 0x29, 0x26, 0x5A, 0x26, 0xEC, 0x23, 0x26, 0x29, 0x9C, 0x0A, 0x00, 0xED, 0xA2, 0xD7,
+  0x29, 0x5A, 0x5A, 0x26, 0xEA, 0x23, 0x26, 0x29, 0x9C, 0x1A, 0x00, 0xEF, 0xA2, 0xC7, 0xA4, 0xF6,
+  0xC0, 0x5A, 0x26, 0xE8, 0x23, 0x26, 0xC0, 0x9C, 0x1A, 0x00, 0xF1, 0x11, 0xA4, 0xF6, 0x29, 0x4A,
+  0x26, 0xE6, 0x23, 0x29, 0x14, 0x11, 0x00, 0xF3, 0x7A, 0xA4, 0xE6, 0x29, 0x26, 0x23, 0xC0, 0x26,
+  0xE0, 0x23, 0xC0, 0x26, 0x29, 0x06, 0x9C, 0x1A, 0x00, 0xF6, 0xA2, 0xC7, 0xA3, 0xD6, 0x29, 0xC0,
+  0x26, 0x5A, 0xC2, 0x26, 0xD6, 0x23, 0xC2, 0x26, 0x29, 0xC0, 0x11, 0x9D, 0x3A, 0x00, 0xFA, 0x20,
+  0x06, 0x17, 0x29, 0xC1, 0x26, 0xD8, 0x29, 0xC1, 0x17, 0x06, 0x23, 0x00, 0xFD, 0xC0, 0xA0, 0xA8,
+  0x20, 0x31, 0xA1, 0xA8, 0x09, 0x7A, 0xD6, 0x09, 0x06, 0x31, 0x20, 0x9E, 0x79, 0x00, 0xFD, 0xFD,
+  0xFD, 0xFD, 0xFD, 0xD5,
+};
+
+const uint8_t kAssetLogoData[13767] PROGMEM = {
+  0x55, 0xFC, 0x66, 0xFE, 0xF9, 0xC7, 0xFE, 0xF8, 0x20, 0xFE, 0xFC, 0x92, 0x31, 0xD9, 0x9B, 0xDB,
+  0x9B, 0xDA, 0x31, 0xFD, 0xF5, 0xFE, 0xFD, 0xF7, 0xFE, 0xF8, 0x00, 0xC0, 0x22, 0xFE, 0xFF, 0x1C,
+  0x31, 0xC4, 0x29, 0x39, 0x31, 0xC5, 0xFE, 0xFE, 0x59, 0xFE, 0xF9, 0xA6, 0xFE, 0xFF, 0x3C, 0x31,
+  0xC5, 0x39, 0xFE, 0xF9, 0x24, 0x22, 0xFE, 0xFB, 0xAE, 0x31, 0xD1, 0x9C, 0xCA, 0xFE, 0xFD, 0xD7,
+  0xA2, 0x67, 0x2C, 0x31, 0xCC, 0x2C, 0x31, 0xE5, 0x2C, 0xC3, 0x31, 0xC8, 0x2C, 0x39, 0xA4, 0x46,
+  0x31, 0xCE, 0x2C, 0xC0, 0x31, 0x2C, 0x31, 0xFE, 0xFC, 0xF3, 0x1D, 0x22, 0x1D, 0xFE, 0xFD, 0x96,
+  0x31, 0xC3, 0xFE, 0xFC, 0x71, 0x1D, 0xA7, 0x14, 0x0A, 0x31, 0xC2, 0x2C, 0x31, 0xFE, 0xFC, 0x30,
+  0x1D, 0xFE, 0xFB, 0xCF, 0x31, 0x2C, 0x31, 0xC1, 0x2C, 0x31, 0xFE, 0xFC, 0x51, 0x1D, 0x22, 0x1D,
+  0xFE, 0xFD, 0x14, 0xFE, 0xFF, 0xFF, 0xCF, 0x1B, 0xFE, 0xF9, 0x45, 0x1D, 0xC0, 0xFE, 0xFB, 0x8E,
+  0x31, 0xEE, 0x2C, 0xC0, 0x31, 0xD0, 0xFE, 0xFD, 0xB6, 0x32, 0x99, 0xFB, 0x15, 0xFE, 0xFE, 0x9A,
+  0x31, 0xC1, 0x0F, 0x61, 0x39, 0xC2, 0x0F, 0xC0, 0xA2, 0x67, 0x31, 0xC4, 0x2C, 0x31, 0xFE, 0xFC,
+  0x92, 0x1D, 0x22, 0x1D, 0xFE, 0xFD, 0x34, 0x31, 0x2C, 0x31, 0xC1, 0xFE, 0xF9, 0x86, 0x1D, 0xC0,
+  0xFE, 0xFD, 0x14, 0xFE, 0xFF, 0xFF, 0x2C, 0x31, 0xC0, 0x2C, 0x31, 0x10, 0x1D, 0xFE, 0xF9, 0xE7,
+  0x31, 0xC3, 0x2C, 0x31, 0x0B, 0x1D, 0xA2, 0x67, 0x1D, 0xFE, 0xFA, 0x08, 0x31, 0xCF, 0x35, 0x1D,
+  0x2E, 0x1D, 0xFE, 0xFA, 0xCB, 0x31, 0xCB, 0xFE, 0xFE, 0xDB, 0xFE, 0xFB, 0xEF, 0x0F, 0x31, 0xDA,
+  0x2C, 0x31, 0xC4, 0x20, 0x28, 0x24, 0xFE, 0xFC, 0xD3, 0x1C, 0x9D, 0xB9, 0x66, 0xFE, 0xFC, 0x71,
+  0xFE, 0xFF, 0x7D, 0x31, 0xC5, 0xFE, 0xFE, 0xFB, 0x2E, 0x1D, 0xC1, 0x06, 0x31, 0xC0, 0x61, 0xFE,
+  0xFC, 0xF3, 0x18, 0x14, 0x15, 0x9D, 0xBA, 0x2E, 0x1D, 0xC0, 0x2E, 0xA3, 0x56, 0xA3, 0x57, 0x08,
+  0x18, 0xFE, 0xFC, 0x51, 0x1B, 0x31, 0xC0, 0xFE, 0xFA, 0x28, 0x1D, 0x22, 0x1D, 0xFE, 0xFD, 0x75,
+  0x31, 0x2C, 0x31, 0xC0, 0x1B, 0x04, 0x1D, 0xC0, 0xFE, 0xFB, 0xEF, 0x31, 0x2C, 0x31, 0xC0, 0x2C,
+  0x31, 0x10, 0x1D, 0x26, 0x2C, 0x31, 0xC2, 0x2C, 0x31, 0x21, 0x1D, 0x22, 0x1D, 0xA6, 0x25, 0x20,
+  0x31, 0xCE, 0x24, 0x1D, 0x22, 0x1D, 0x03, 0x31, 0x2C, 0x31, 0xC6, 0x2C, 0x31, 0x25, 0x33, 0x1D,
+  0xC0, 0x2D, 0x31, 0xC6, 0x39, 0xFE, 0xFD, 0x55, 0x31, 0xD2, 0x28, 0x02, 0x0B, 0xFE, 0xFA, 0x08,
+  0x15, 0x2E, 0x1D, 0xC4, 0x08, 0x20, 0x31, 0xC2, 0x2C, 0x31, 0xFE, 0xFC, 0x10, 0x1D, 0x22, 0x2A,
+  0x29, 0x31, 0xC4, 0x2C, 0x0A, 0x9D, 0xB9, 0x9C, 0xCA, 0x9A, 0xEB, 0x02, 0x9C, 0xCA, 0x21, 0x9C,
+  0xCA, 0x61, 0x66, 0x3F, 0x0F, 0x1B, 0x08, 0x1D, 0xC2, 0x18, 0x31, 0xC2, 0x0F, 0x33, 0x1D, 0xC0,
+  0x1C, 0x31, 0x2C, 0x31, 0xC0, 0x2C, 0x31, 0xFE, 0xFB, 0x8E, 0x1D, 0x15, 0x1B, 0x31, 0xC4, 0x02,
+  0x1D, 0x22, 0x1D, 0xA2, 0x67, 0xFE, 0xFF, 0x3C, 0x31, 0xCE, 0xFE, 0xFE, 0x38, 0x1D, 0xC1, 0x18,
+  0x31, 0xC7, 0x2C, 0x31, 0xFE, 0xFC, 0xF3, 0x1D, 0xC0, 0x22, 0x10, 0x1B, 0x31, 0xC4, 0x2C, 0x31,
+  0x1C, 0x22, 0x9C, 0xCA, 0x31, 0xC7, 0x2C, 0x31, 0xC3, 0xFE, 0xFE, 0xBA, 0xFE, 0xFC, 0xB2, 0xFE,
+  0xFA, 0x8A, 0x10, 0x1D, 0xC9, 0x22, 0x1D, 0xFE, 0xFD, 0xF7, 0x31, 0xC4, 0x2A, 0x1D, 0x22, 0x2D,
+  0x31, 0x2C, 0x31, 0xD1, 0xFE, 0xFA, 0xCB, 0x1D, 0x22, 0x1D, 0xC0, 0xFE, 0xFE, 0x79, 0x31, 0xC2,
+  0x0F, 0xFE, 0xF8, 0x82, 0x1D, 0xC0, 0xFE, 0xFB, 0x4D, 0x31, 0x2C, 0x31, 0xC0, 0x2C, 0x31, 0xFE,
+  0xFB, 0xAE, 0x1D, 0x3F, 0x0A, 0x31, 0xC4, 0x17, 0x1D, 0xC1, 0x33, 0x0A, 0x31, 0xCC, 0x2C, 0x31,
+  0x06, 0x1D, 0x22, 0x1D, 0xFE, 0xFC, 0xD3, 0x31, 0x2C, 0x31, 0xC3, 0x2C, 0x31, 0xC0, 0x02, 0x22,
+  0xC0, 0x1D, 0xC0, 0x25, 0x31, 0xC6, 0x2C, 0x26, 0x1D, 0x35, 0x31, 0xC9, 0x0F, 0x02, 0xFE, 0xFA,
+  0xAA, 0x04, 0x1D, 0xC0, 0x3F, 0x08, 0xFE, 0xFB, 0x0C, 0xA6, 0x25, 0x14, 0xA6, 0x25, 0x13, 0x6E,
+  0xC0, 0x13, 0x9C, 0xCA, 0x1C, 0x32, 0x1D, 0xC0, 0x14, 0xFE, 0xFF, 0xFF, 0x2C, 0x31, 0xC2, 0xFE,
+  0xF9, 0x86, 0x1D, 0xC0, 0xFE, 0xFA, 0xCB, 0x31, 0xCB, 0x2C, 0xC4, 0x31, 0xC1, 0xFE, 0xFA, 0x49,
+  0x1D, 0xC0, 0x2E, 0x3E, 0x31, 0xC3, 0x32, 0x1D, 0xC0, 0x19, 0x31, 0x2C, 0x31, 0x2C, 0xC0, 0x31,
+  0xFE, 0xFB, 0x8E, 0x1D, 0xC0, 0x07, 0x31, 0x2C, 0xC2, 0x31, 0xFE, 0xFE, 0xBA, 0x1D, 0xC1, 0xA8,
+  0x04, 0x2C, 0x31, 0xCE, 0x3A, 0x1D, 0x22, 0x1D, 0x32, 0x1B, 0x31, 0xC5, 0x1B, 0xFE, 0xFB, 0xCF,
+  0x1D, 0xC1, 0x04, 0x02, 0x31, 0xC7, 0xFE, 0xFD, 0xB6, 0x1D, 0xC0, 0xFE, 0xFD, 0x14, 0xFE, 0xFF,
+  0xFF, 0x2C, 0x31, 0xC4, 0x0F, 0xFE, 0xFD, 0x14, 0x2A, 0x1D, 0xC0, 0xFE, 0xF9, 0x65, 0x0B, 0x13,
+  0x39, 0x2C, 0x6E, 0xC9, 0x28, 0x22, 0x1D, 0xFE, 0xFB, 0xEF, 0x31, 0x2C, 0x31, 0xC2, 0x32, 0x1D,
+  0x22, 0x1D, 0x14, 0x31, 0xC3, 0x2C, 0x31, 0xCD, 0x28, 0x2E, 0x1D, 0xA8, 0x04, 0x2C, 0x31, 0xC3,
+  0x36, 0x1D, 0xC0, 0x2E, 0x2D, 0x31, 0xC2, 0x07, 0x3F, 0x1D, 0xC0, 0x26, 0x2D, 0x31, 0xC2, 0x28,
+  0x36, 0x1D, 0x22, 0x1D, 0x2A, 0x31, 0xC9, 0x2C, 0x39, 0x35, 0xFE, 0xFD, 0x14, 0x0B, 0x03, 0x1D,
+  0xC3, 0x08, 0x24, 0xFE, 0xFF, 0xBE, 0xA2, 0x67, 0xC0, 0x2C, 0xFE, 0xFE, 0xBA, 0xFE, 0xFC, 0x51,
+  0x26, 0x1D, 0xC1, 0xFE, 0xFA, 0xCB, 0x2D, 0x31, 0xC6, 0x2C, 0x31, 0x0B, 0x1D, 0xC0, 0xFE, 0xFB,
+  0xEF, 0x31, 0x2C, 0x31, 0xC2, 0x28, 0x29, 0x22, 0x1D, 0x15, 0xFE, 0xFC, 0x10, 0xFE, 0xFE, 0xFB,
+  0x31, 0xC5, 0x2C, 0xC0, 0x31, 0xC1, 0x2C, 0xC0, 0x31, 0xC0, 0xFE, 0xFB, 0x6D, 0x1D, 0xC0, 0xFE,
+  0xFB, 0xCF, 0x31, 0x2C, 0x31, 0xC1, 0x2C, 0x26, 0x1D, 0xC2, 0x28, 0x31, 0xC6, 0x2C, 0x31, 0xC8,
+  0x2C, 0x31, 0xFE, 0xF9, 0x04, 0x1D, 0xFE, 0xF9, 0xC7, 0x31, 0xC2, 0x2C, 0x31, 0xFE, 0xFC, 0x92,
+  0x1D, 0x22, 0x1D, 0x08, 0xFE, 0xFD, 0x34, 0xA4, 0x46, 0xFE, 0xFC, 0x71, 0xFE, 0xFA, 0x08, 0x1D,
+  0xC3, 0x04, 0x29, 0x1C, 0x3A, 0x14, 0x22, 0x1D, 0xC0, 0x22, 0x1D, 0xFE, 0xFC, 0x30, 0x31, 0x2C,
+  0x31, 0xC5, 0x18, 0xFE, 0xFA, 0xEB, 0xFE, 0xF9, 0x45, 0x2E, 0x61, 0xC9, 0x15, 0x14, 0xC0, 0x32,
+  0x22, 0x1D, 0xC1, 0xFE, 0xFA, 0x49, 0x35, 0x31, 0xC0, 0x2C, 0xC0, 0x31, 0xC6, 0x2A, 0x1D, 0xC0,
+  0x0B, 0x31, 0x2C, 0x31, 0xC1, 0x17, 0xFE, 0xF8, 0xC3, 0x15, 0x3A, 0x35, 0x31, 0xC2, 0x2C, 0x31,
+  0xC7, 0x2C, 0x31, 0xC0, 0x0A, 0x29, 0x1D, 0x22, 0x1D, 0xFE, 0xFC, 0x10, 0x31, 0x2C, 0x31, 0xC2,
+  0xFE, 0xF9, 0x86, 0x1D, 0xC1, 0x08, 0x28, 0x31, 0xFE, 0xFC, 0xD3, 0x03, 0x14, 0x3F, 0x07, 0xFE,
+  0xFF, 0x7D, 0x31, 0xC4, 0x2C, 0xC1, 0x31, 0xC2, 0xFE, 0xFD, 0x34, 0x1D, 0xC0, 0x0C, 0x31, 0xC4,
+  0x0F, 0x04, 0x1D, 0x22, 0x1D, 0xD0, 0x22, 0xC0, 0x28, 0x31, 0xC6, 0x29, 0x1D, 0xC2, 0x22, 0xC3,
+  0x1D, 0xC9, 0x10, 0x3A, 0x06, 0x31, 0xCC, 0x19, 0x1D, 0xC0, 0xFE, 0xFB, 0x2C, 0x31, 0xC3, 0x1B,
+  0x39, 0x31, 0xC2, 0x2C, 0x31, 0xC7, 0x2C, 0x31, 0xC1, 0x0F, 0xFE, 0xFC, 0x71, 0x15, 0x1D, 0xC0,
+  0x22, 0x1D, 0x3E, 0x31, 0x2C, 0x31, 0xC2, 0x08, 0x1D, 0xC0, 0x3A, 0x31, 0xC1, 0x61, 0x07, 0x0C,
+  0xFE, 0xF8, 0x82, 0x1D, 0x22, 0x2A, 0xFE, 0xFC, 0xB2, 0x17, 0x2C, 0x31, 0xC5, 0xFE, 0xFE, 0xBA,
+  0xFE, 0xFB, 0xAE, 0x22, 0xC0, 0x1D, 0x0B, 0x31, 0x2C, 0x31, 0xC3, 0x13, 0x1D, 0xC0, 0x22, 0xC2,
+  0x1D, 0xC5, 0x22, 0x6F, 0xC0, 0x22, 0xC0, 0x1D, 0xC1, 0xFE, 0xFB, 0x6D, 0x31, 0xC7, 0x14, 0x37,
+  0x33, 0x1D, 0xC9, 0x33, 0x19, 0x15, 0x9D, 0xBA, 0xA8, 0x04, 0x29, 0x02, 0x0A, 0x31, 0xC1, 0x20,
+  0x3E, 0x25, 0xA2, 0x67, 0xFE, 0xFC, 0x71, 0x20, 0x31, 0xC5, 0xFE, 0xFA, 0xCB, 0x1D, 0xC0, 0xFE,
+  0xFA, 0x69, 0x31, 0xC6, 0x2C, 0x31, 0xC7, 0x2C, 0x31, 0xC2, 0x1C, 0xFE, 0xFB, 0xEF, 0xFE, 0xF8,
+  0xC3, 0x1D, 0xC4, 0xFE, 0xFD, 0x14, 0xFE, 0xFF, 0xFF, 0x2C, 0x31, 0xC2, 0x3B, 0x1D, 0x2E, 0xFE,
+  0xFE, 0xFB, 0x31, 0xC5, 0xFE, 0xFE, 0x79, 0x03, 0x2A, 0x33, 0x1D, 0x2E, 0x37, 0xFE, 0xFA, 0x8A,
+  0xA8, 0x04, 0xC0, 0x65, 0x36, 0x32, 0x1D, 0xC1, 0x22, 0x1D, 0xFE, 0xFC, 0x10, 0x31, 0x2C, 0x31,
+  0xC4, 0xFE, 0xFD, 0xB6, 0x32, 0x1D, 0xCF, 0xA4, 0x46, 0xFE, 0xFB, 0x6D, 0x20, 0x31, 0xC9, 0xFE,
+  0xFE, 0xFB, 0xFE, 0xFD, 0xF7, 0x18, 0xC0, 0x13, 0x65, 0x99, 0xFC, 0xFE, 0xFA, 0xCB, 0x22, 0x1D,
+  0xC1, 0xFE, 0xFD, 0x34, 0x31, 0x1B, 0x0A, 0x31, 0xC2, 0x2C, 0xC1, 0xFE, 0xFA, 0x8A, 0x1D, 0xC1,
+  0x2E, 0x1B, 0x31, 0x2C, 0x31, 0xC0, 0x06, 0x2D, 0x31, 0x3E, 0x1D, 0xC0, 0x19, 0x31, 0xD2, 0x28,
+  0x03, 0x08, 0x1D, 0xC1, 0x32, 0x25, 0x26, 0x1D, 0x22, 0x1D, 0xFE, 0xFD, 0x75, 0x31, 0xC2, 0x2C,
+  0x31, 0x3A, 0x1D, 0x33, 0xFE, 0xFF, 0x3C, 0x31, 0xC8, 0x20, 0x35, 0xFE, 0xFB, 0xCF, 0xFE, 0xF9,
+  0x86, 0x1D, 0xC9, 0xFE, 0xFD, 0x14, 0xFE, 0xFF, 0xFF, 0x2C, 0x31, 0xC5, 0x2C, 0x13, 0xFE, 0xFB,
+  0xAE, 0x3B, 0x32, 0x1D, 0xC5, 0x04, 0xFE, 0xFA, 0x8A, 0x10, 0x21, 0xA4, 0x46, 0xFE, 0xFD, 0xB6,
+  0x3E, 0x31, 0xD3, 0xFE, 0xFB, 0x0C, 0x1D, 0xC0, 0x22, 0x2D, 0x31, 0xC7, 0x1B, 0x2E, 0x1D, 0xC1,
+  0x36, 0x31, 0x2C, 0x31, 0x35, 0x19, 0x1D, 0x21, 0x31, 0xFE, 0xFE, 0x79, 0x22, 0x1D, 0xFE, 0xF9,
+  0xC7, 0x31, 0xCE, 0x20, 0xFE, 0xFD, 0xF7, 0x3F, 0x15, 0x1D, 0xC0, 0x26, 0xFE, 0xFB, 0x2C, 0x36,
+  0x28, 0x2C, 0x31, 0x20, 0x07, 0x1D, 0xC0, 0x18, 0x31, 0xC2, 0x2C, 0x31, 0xFE, 0xFC, 0x10, 0x1D,
+  0xC0, 0x35, 0x31, 0x2C, 0x31, 0xC4, 0x2C, 0x31, 0xC3, 0x39, 0xFE, 0xFD, 0x14, 0x0C, 0xFE, 0xF8,
+  0x82, 0x1D, 0xC5, 0x13, 0xFE, 0xFF, 0xFF, 0xCC, 0x35, 0x08, 0x1D, 0xC2, 0xFE, 0xFA, 0xCB, 0x0A,
+  0x31, 0xCC, 0x2C, 0xC0, 0x31, 0xC4, 0x2C, 0xC0, 0x20, 0x2C, 0x31, 0x3B, 0x1D, 0xC0, 0x22, 0x28,
+  0x31, 0xC8, 0x02, 0xFE, 0xF8, 0xC3, 0x33, 0xFE, 0xFC, 0x30, 0x31, 0xC1, 0x2D, 0x1D, 0xC1, 0x0B,
+  0x31, 0xC0, 0x08, 0x1D, 0x19, 0x31, 0xCB, 0x9C, 0xCA, 0x13, 0xFE, 0xFA, 0xEB, 0x3F, 0x9C, 0xCA,
+  0x33, 0xFE, 0xFB, 0x0C, 0x13, 0x3E, 0x31, 0xC3, 0x2C, 0x31, 0x0A, 0x04, 0x1D, 0xFE, 0xFE, 0x38,
+  0x31, 0xC2, 0x2C, 0x31, 0x36, 0x1D, 0xC0, 0x07, 0x31, 0xC0, 0x2C, 0x31, 0xC7, 0x2C, 0x31, 0xC2,
+  0x39, 0x03, 0xFE, 0xF9, 0x45, 0x1D, 0xC3, 0xFE, 0xFD, 0xF7, 0x31, 0xC9, 0x2C, 0x31, 0xC1, 0x1B,
+  0x26, 0x1D, 0xC0, 0x10, 0x20, 0x31, 0x2C, 0xC2, 0x31, 0xCB, 0x2C, 0xC2, 0x31, 0xC2, 0x20, 0xFE,
+  0xFB, 0xAE, 0x1D, 0xC2, 0xFE, 0xFD, 0xB6, 0x31, 0x2C, 0x31, 0xC7, 0x0F, 0x39, 0x31, 0xC0, 0x0A,
+  0x0C, 0x1D, 0x22, 0x1D, 0xFE, 0xFB, 0x6D, 0x31, 0x2C, 0x31, 0xFE, 0xFC, 0x51, 0x1D, 0x14, 0x31,
+  0xC9, 0x24, 0x2E, 0x04, 0x1D, 0xC0, 0x19, 0x02, 0x20, 0x31, 0xC3, 0x2C, 0x31, 0xC1, 0x2C, 0x31,
+  0x10, 0x1D, 0xFE, 0xFE, 0xFB, 0x31, 0xC4, 0x3A, 0x1D, 0xC1, 0xFE, 0xFB, 0x8E, 0x0F, 0x31, 0xC2,
+  0x2C, 0x31, 0xC6, 0x2C, 0x31, 0xC1, 0x2C, 0xFE, 0xFC, 0x92, 0xFE, 0xF8, 0x41, 0x1D, 0xC1, 0x17,
+  0x31, 0xCC, 0x2C, 0x31, 0x1C, 0x1D, 0xC0, 0xA8, 0x04, 0x2C, 0x31, 0xCC, 0x17, 0x10, 0xA3, 0x57,
+  0xFE, 0xFF, 0x7D, 0x31, 0xC4, 0xFE, 0xFE, 0xBA, 0xFE, 0xFC, 0x30, 0x26, 0x1D, 0xC3, 0x19, 0x31,
+  0xC0, 0x2C, 0x31, 0xC5, 0x2C, 0x31, 0xC1, 0xFE, 0xFD, 0x75, 0x21, 0x1D, 0x22, 0x1D, 0x08, 0x20,
+  0x31, 0x2C, 0x31, 0xFE, 0xFE, 0x79, 0x1D, 0xFE, 0xF9, 0x86, 0x31, 0xC6, 0x20, 0xFE, 0xFC, 0xB2,
+  0x08, 0x1D, 0xC1, 0xFE, 0xFA, 0xEB, 0x06, 0x31, 0xC1, 0x2C, 0x31, 0xC8, 0x28, 0x33, 0x39, 0x31,
+  0xC4, 0x1B, 0xA8, 0x04, 0x9C, 0xCA, 0x22, 0x1D, 0xA6, 0x25, 0xFE, 0xFB, 0x2C, 0x18, 0x0F, 0x31,
+  0xC3, 0x2C, 0x31, 0xC5, 0x2C, 0x31, 0xC0, 0x35, 0xFE, 0xF8, 0x41, 0x1D, 0x22, 0xFE, 0xFE, 0xFB,
+  0x31, 0xCC, 0x2C, 0x31, 0xFE, 0xFB, 0x6D, 0x1D, 0x22, 0x1D, 0x35, 0x31, 0xCB, 0x24, 0x2E, 0x1D,
+  0xC0, 0x15, 0x3F, 0x3E, 0x6E, 0x9C, 0xCA, 0xFE, 0xFA, 0xEB, 0x37, 0x22, 0x66, 0xC6, 0x0C, 0x0F,
+  0x31, 0xC7, 0x1B, 0x07, 0x25, 0x1D, 0xC0, 0x22, 0x1D, 0xA8, 0x04, 0xFE, 0xFF, 0x3C, 0x31, 0xC2,
+  0x0F, 0x1D, 0x37, 0x31, 0xC5, 0x18, 0x37, 0x1D, 0xC0, 0x33, 0x3F, 0x28, 0x31, 0xC7, 0x2C, 0xC0,
+  0x31, 0xC4, 0xFE, 0xFD, 0x14, 0x1B, 0xA3, 0x56, 0xC5, 0xFE, 0xFB, 0x4D, 0x1D, 0xC4, 0x10, 0xFE,
+  0xFA, 0x8A, 0xFE, 0xFC, 0x92, 0x0B, 0x20, 0x31, 0xC3, 0x2C, 0x31, 0xC3, 0x2C, 0x31, 0xFE, 0xFA,
+  0xEB, 0xFE, 0xF8, 0x00, 0x33, 0x3E, 0x31, 0xCB, 0x2C, 0x31, 0x39, 0x10, 0x1D, 0x22, 0x1D, 0xFE,
+  0xF9, 0xC7, 0x31, 0xCA, 0x3E, 0xFE, 0xF8, 0x82, 0x1D, 0x22, 0xC0, 0x1D, 0xC6, 0x22, 0xC0, 0x1D,
+  0xC5, 0x10, 0xFE, 0xFB, 0xCF, 0x35, 0x3E, 0xA2, 0x67, 0xC0, 0x0A, 0x17, 0x36, 0xFE, 0xFB, 0x2C,
+  0x21, 0x1D, 0xC1, 0x22, 0x1D, 0x10, 0x28, 0x31, 0xC1, 0x2C, 0x31, 0x06, 0x1D, 0xFE, 0xF9, 0x86,
+  0x31, 0xC4, 0xFE, 0xFD, 0x14, 0x1D, 0xC0, 0xA2, 0x67, 0x3A, 0x28, 0xFE, 0xFF, 0xFF, 0xC6, 0x2C,
+  0x31, 0xC3, 0x0A, 0x9B, 0xDA, 0x39, 0x31, 0xC9, 0x1B, 0xFE, 0xFB, 0x6D, 0x15, 0x1D, 0xC6, 0x21,
+  0x3B, 0xFE, 0xFC, 0x10, 0x18, 0x3E, 0x31, 0xC5, 0x2C, 0x31, 0xFE, 0xFB, 0xCF, 0x1D, 0xA4, 0x46,
+  0x0A, 0x31, 0xCC, 0x17, 0xFE, 0xF9, 0x45, 0x1D, 0xC3, 0xFE, 0xFB, 0x6D, 0x31, 0x2C, 0x31, 0xC5,
+  0x2C, 0x31, 0x1C, 0x1D, 0x22, 0x1D, 0xC1, 0x15, 0x08, 0x19, 0x14, 0x03, 0x10, 0x2E, 0x1D, 0xC6,
+  0x22, 0x1D, 0xC1, 0x2E, 0xA2, 0x67, 0xC0, 0x33, 0x1D, 0xC6, 0x2E, 0x06, 0x31, 0x2C, 0x31, 0xC1,
+  0x1B, 0x08, 0x1D, 0x08, 0x31, 0xC3, 0x3E, 0x22, 0x1D, 0x07, 0x0B, 0x31, 0xC5, 0x2C, 0x31, 0xC2,
+  0x39, 0x36, 0x3A, 0x08, 0x3F, 0x1D, 0x3F, 0x1B, 0x31, 0xCA, 0x1B, 0x06, 0xFE, 0xFB, 0x6D, 0x1D,
+  0xC2, 0x22, 0x1D, 0xC3, 0xA4, 0x46, 0x25, 0xFE, 0xFB, 0xEF, 0x29, 0x20, 0x31, 0xC3, 0x08, 0x1D,
+  0x3F, 0x0F, 0x31, 0xCA, 0x0A, 0x3A, 0x2E, 0x1D, 0xC3, 0x22, 0x1D, 0x21, 0x31, 0x2C, 0x31, 0xC5,
+  0x2C, 0x26, 0x1D, 0xC1, 0xFE, 0xFA, 0x49, 0x35, 0x1B, 0x31, 0xC2, 0x1B, 0x39, 0x35, 0xFE, 0xFC,
+  0xD3, 0x32, 0x1D, 0xD3, 0x13, 0x31, 0x2C, 0x31, 0x2C, 0x31, 0x0A, 0x25, 0x1D, 0xC0, 0x03, 0x31,
+  0xC3, 0x02, 0x33, 0x02, 0x31, 0xC4, 0x2C, 0x31, 0xC2, 0x17, 0xFE, 0xFC, 0x30, 0x25, 0x22, 0x1D,
+  0xC2, 0xFE, 0xF9, 0x45, 0xFE, 0xFD, 0x14, 0xFE, 0xFF, 0xFF, 0xCE, 0x24, 0x33, 0x1D, 0xC2, 0xA8,
+  0x04, 0xC0, 0x3F, 0x1D, 0xC3, 0x15, 0xFE, 0xFB, 0x6D, 0x17, 0x31, 0xC0, 0xFE, 0xFB, 0xEF, 0x1D,
+  0xC0, 0x15, 0xFE, 0xFF, 0xBE, 0x31, 0xC9, 0x17, 0xFE, 0xF9, 0x04, 0x1D, 0xC6, 0x22, 0x1D, 0xFE,
+  0xFC, 0xD3, 0x31, 0x2C, 0x31, 0xC4, 0x28, 0x22, 0x1D, 0xC0, 0x08, 0x31, 0xC9, 0x3F, 0x1D, 0x22,
+  0x1D, 0xC1, 0x08, 0xFE, 0xFB, 0xAE, 0xFE, 0xFD, 0x34, 0x24, 0x0B, 0x28, 0xC0, 0x17, 0x29, 0x9C,
+  0xCA, 0xFE, 0xFC, 0x51, 0x0C, 0x33, 0x1D, 0xC0, 0xFE, 0xFC, 0x30, 0x31, 0x2C, 0xC0, 0x31, 0xC0,
+  0x17, 0xFE, 0xF9, 0x45, 0x1D, 0x22, 0x1D, 0x37, 0x31, 0xC3, 0x17, 0x0B, 0x31, 0xC2, 0x2C, 0x31,
+  0xC1, 0x2C, 0xFE, 0xFE, 0x38, 0x10, 0x21, 0x1D, 0xC1, 0x22, 0x32, 0x0C, 0xFE, 0xFC, 0x71, 0x06,
+  0x31, 0xCF, 0x2C, 0x31, 0x24, 0x1D, 0x22, 0x1D, 0x10, 0x2C, 0x65, 0x9C, 0xCA, 0x06, 0x02, 0xFE,
+  0xFB, 0xEF, 0x0C, 0x26, 0x1D, 0xC1, 0x2A, 0x9B, 0xDB, 0x1D, 0xC1, 0x32, 0x31, 0xC9, 0x39, 0xFE,
+  0xF8, 0xC3, 0x1D, 0x22, 0x1D, 0xC7, 0x22, 0x3A, 0x31, 0xC5, 0x24, 0x1D, 0x22, 0x1D, 0xFE, 0xFB,
+  0x0C, 0x31, 0xC6, 0x3E, 0x17, 0x2D, 0x2E, 0x1D, 0xC2, 0x22, 0x17, 0x31, 0xC9, 0xFE, 0xFE, 0xBA,
+  0x1D, 0xFE, 0xFA, 0x49, 0x31, 0xC2, 0x1B, 0xFE, 0xFC, 0x51, 0x33, 0x1D, 0x22, 0x1D, 0xC0, 0xA8,
+  0x04, 0x2C, 0x31, 0xC4, 0x2C, 0xC0, 0x31, 0xC1, 0x2C, 0x35, 0xFE, 0xFB, 0x8E, 0x15, 0x1D, 0xC0,
+  0x15, 0xFE, 0xFA, 0xEB, 0xFE, 0xFC, 0xB2, 0x35, 0x39, 0x31, 0xD4, 0x2C, 0x31, 0x0B, 0xFE, 0xF8,
+  0x00, 0xC0, 0xFE, 0xFD, 0xF7, 0x31, 0xC5, 0x2C, 0x1C, 0xFE, 0xFC, 0x92, 0x03, 0x1D, 0xC3, 0x37,
+  0x31, 0xC9, 0x19, 0x1D, 0x22, 0x1D, 0x0F, 0x13, 0x1D, 0xC6, 0x21, 0xFE, 0xFF, 0x7D, 0x31, 0xC4,
+  0x18, 0x1D, 0x22, 0x1D, 0x33, 0xFE, 0xFD, 0x34, 0x1B, 0x2C, 0x31, 0xC1, 0xFE, 0xFE, 0xFB, 0xFE,
+  0xF9, 0xC7, 0x33, 0x22, 0x1D, 0xC5, 0xA4, 0x46, 0xFE, 0xFB, 0x0C, 0x02, 0x28, 0x2C, 0x31, 0xC5,
+  0xFE, 0xFC, 0xB2, 0x1D, 0xFE, 0xFB, 0xCF, 0x31, 0x20, 0x17, 0xFE, 0xFC, 0x30, 0x26, 0x1D, 0xC4,
+  0x33, 0x0A, 0x31, 0xC6, 0x2C, 0x35, 0x0B, 0xFE, 0xF9, 0x45, 0x1D, 0xC0, 0x15, 0x1C, 0xFE, 0xFE,
+  0x79, 0x31, 0xC5, 0x2C, 0x31, 0xD3, 0x0A, 0x3F, 0x1D, 0x18, 0x31, 0x2C, 0x31, 0xC1, 0x2C, 0x31,
+  0xC3, 0xFE, 0xFD, 0x14, 0x33, 0x1D, 0x22, 0x1D, 0x08, 0xFE, 0xFF, 0xFF, 0xC8, 0xFE, 0xFD, 0x14,
+  0x1D, 0x22, 0x1D, 0xFE, 0xFB, 0xEF, 0xFE, 0xFF, 0xFF, 0xC0, 0x32, 0x1D, 0xC4, 0x22, 0x1D, 0x29,
+  0x31, 0xC4, 0x18, 0x1D, 0xC3, 0x10, 0x32, 0x1C, 0x31, 0xC0, 0x17, 0x04, 0x1D, 0xCA, 0x33, 0x32,
+  0x25, 0x29, 0xA5, 0x35, 0x1C, 0xC0, 0x9B, 0xDA, 0x03, 0x1D, 0xC1, 0x32, 0x26, 0x1D, 0xC2, 0x37,
+  0x10, 0x9A, 0xEB, 0xFE, 0xF8, 0x00, 0xC0, 0xA2, 0x67, 0xFE, 0xFF, 0x3C, 0x31, 0xC4, 0xFE, 0xFE,
+  0xBA, 0x10, 0x32, 0x1D, 0xC1, 0x2A, 0x13, 0x2C, 0x31, 0xC2, 0x2C, 0x31, 0xD9, 0xFE, 0xFA, 0xCB,
+  0x1D, 0xFE, 0xFC, 0x51, 0x31, 0x2C, 0x31, 0xC5, 0x2C, 0x31, 0xC0, 0x24, 0x22, 0x1D, 0xC0, 0x03,
+  0x31, 0xC7, 0x2C, 0x26, 0x1D, 0xC0, 0xFE, 0xF9, 0xC7, 0x31, 0x2C, 0x31, 0xFE, 0xFA, 0x49, 0x1D,
+  0xC7, 0x35, 0x31, 0xC3, 0x02, 0x1D, 0xC5, 0xFE, 0xFC, 0x71, 0x31, 0x2C, 0x31, 0x20, 0x3A, 0x07,
+  0x18, 0x1D, 0xD7, 0x32, 0x02, 0x31, 0xC1, 0x2A, 0x1D, 0x22, 0x17, 0x31, 0xC3, 0x17, 0x1D, 0xC2,
+  0x08, 0xFE, 0xFD, 0xB6, 0x31, 0xC1, 0x2C, 0x31, 0xDB, 0x2C, 0x31, 0xFE, 0xFC, 0xB2, 0x1D, 0x08,
+  0x31, 0xC9, 0x2C, 0x31, 0xFE, 0xFB, 0x4D, 0x1D, 0xC0, 0xFE, 0xF9, 0x86, 0x31, 0xC7, 0x18, 0x1D,
+  0xC1, 0x24, 0x31, 0x2C, 0x31, 0x29, 0x1D, 0x22, 0x1D, 0xC0, 0x08, 0xFE, 0xFB, 0x8E, 0x1D, 0x22,
+  0x1D, 0x19, 0x31, 0xC1, 0x2C, 0x31, 0x10, 0x1D, 0x22, 0x1D, 0xC2, 0x08, 0x31, 0xC6, 0x10, 0x1D,
+  0xC3, 0x08, 0x3A, 0xA4, 0x46, 0xA2, 0x67, 0xA7, 0x14, 0xA2, 0x67, 0xC0, 0x3E, 0x2D, 0x0B, 0xFE,
+  0xFA, 0x08, 0x22, 0x1D, 0xC4, 0xFE, 0xFB, 0x2C, 0x1B, 0x31, 0xC0, 0x20, 0x31, 0xFE, 0xFC, 0x92,
+  0x1D, 0xC0, 0x18, 0x31, 0x2C, 0x31, 0xC1, 0x20, 0xFE, 0xFA, 0x49, 0x3F, 0x25, 0xFE, 0xFD, 0x14,
+  0x2C, 0x6E, 0xE2, 0x07, 0x1D, 0xC0, 0x24, 0x31, 0xCA, 0x17, 0x1D, 0xC0, 0x03, 0x31, 0xC7, 0xFE,
+  0xFA, 0xEB, 0xFE, 0xF8, 0x00, 0xC0, 0xA8, 0x04, 0x2C, 0x31, 0x2C, 0x31, 0xFE, 0xFB, 0x6D, 0x1D,
+  0x22, 0xC0, 0x1D, 0xFE, 0xFC, 0x30, 0x31, 0x10, 0x1D, 0x22, 0x1D, 0x35, 0x31, 0x2C, 0x31, 0x1B,
+  0x15, 0x1D, 0xC2, 0x22, 0x1D, 0xFE, 0xFC, 0xF3, 0x31, 0x2C, 0x31, 0xC2, 0x2C, 0x31, 0x0A, 0xA8,
+  0x04, 0x1D, 0xC1, 0xFE, 0xFD, 0x14, 0xFE, 0xFF, 0xFF, 0xC9, 0xFE, 0xFE, 0x38, 0x33, 0x1D, 0xC2,
+  0x14, 0x31, 0xC0, 0x2C, 0x31, 0xC1, 0x13, 0x1D, 0xC0, 0xFE, 0xFB, 0x4D, 0x31, 0xC5, 0x0A, 0x31,
+  0xE3, 0x2C, 0x31, 0xFE, 0xFC, 0xD3, 0x1D, 0xC0, 0x03, 0x31, 0xCA, 0x2C, 0x26, 0x1D, 0xFE, 0xF9,
+  0xC7, 0x31, 0xC6, 0x61, 0x15, 0x1D, 0xC0, 0xFE, 0xFA, 0xEB, 0x31, 0xC0, 0x2C, 0x31, 0x0B, 0xFE,
+  0xF8, 0x00, 0x22, 0x1D, 0xC0, 0x02, 0x31, 0xC0, 0x08, 0x1D, 0xC0, 0x08, 0x2C, 0x31, 0xFE, 0xFE,
+  0xBA, 0x19, 0x1D, 0xC5, 0xFE, 0xFD, 0xF7, 0x31, 0xC6, 0x1B, 0x33, 0x1D, 0xC1, 0x28, 0x31, 0xC0,
+  0x2C, 0x20, 0x2C, 0xC3, 0x20, 0x31, 0x2C, 0x04, 0x1D, 0x22, 0xC0, 0x07, 0x31, 0x2C, 0x31, 0xC3,
+  0xFE, 0xFE, 0x38, 0x1D, 0xC0, 0xFE, 0xF9, 0x45, 0x31, 0xED, 0x19, 0x1D, 0x22, 0x1D, 0xFE, 0xFB,
+  0xEF, 0x31, 0xCA, 0x36, 0x1D, 0x19, 0x31, 0xC6, 0xFE, 0xFE, 0x79, 0x1D, 0x22, 0x1D, 0x0F, 0x31,
+  0x2C, 0xC0, 0x31, 0xFE, 0xFB, 0x8E, 0x1D, 0x22, 0x1D, 0xC0, 0x3A, 0x31, 0xC0, 0x35, 0x1D, 0xC1,
+  0x08, 0xA7, 0x15, 0x2E, 0x1D, 0x22, 0x1D, 0xC0, 0x22, 0x1D, 0x22, 0x1D, 0x25, 0x31, 0x2C, 0x31,
+  0xC0, 0x2C, 0x31, 0xC1, 0xFE, 0xFC, 0xD3, 0x1D, 0xC2, 0x32, 0x13, 0x1B, 0x31, 0xC7, 0x0B, 0x1D,
+  0x22, 0x1D, 0x25, 0x31, 0x2C, 0x31, 0xC4, 0x28, 0x2E, 0x1D, 0xFE, 0xFC, 0x30, 0x31, 0x2C, 0x31,
+  0xE9, 0x3A, 0xFE, 0xFA, 0x08, 0x1D, 0xC3, 0x3A, 0x31, 0xC7, 0x2C, 0x31, 0xFE, 0xFB, 0x4D, 0x1D,
+  0x14, 0x31, 0xC4, 0x2C, 0x31, 0xFE, 0xFD, 0x34, 0x1D, 0x22, 0x1D, 0x24, 0x31, 0xC0, 0x2C, 0x31,
+  0x0B, 0x1D, 0x22, 0x1D, 0x22, 0xFE, 0xFE, 0xFB, 0x31, 0x2C, 0x31, 0x2A, 0x1D, 0x22, 0x1D, 0xC9,
+  0xA8, 0x04, 0x2D, 0x31, 0xC3, 0x2D, 0x0B, 0x22, 0x1D, 0xC4, 0xA6, 0x25, 0xFE, 0xFA, 0x49, 0xFE,
+  0xFB, 0xAE, 0xFE, 0xFD, 0x14, 0x35, 0x2D, 0x0A, 0x1C, 0xFE, 0xFD, 0x34, 0xFE, 0xFA, 0x49, 0x1D,
+  0x22, 0x1D, 0xFE, 0xFA, 0xEB, 0xFE, 0xFF, 0xFF, 0x2C, 0x31, 0xC5, 0x9A, 0xEB, 0xA7, 0x15, 0xFE,
+  0xF9, 0x45, 0xFE, 0xFF, 0xBE, 0x31, 0xC2, 0x0A, 0x19, 0xFE, 0xFC, 0x51, 0x31, 0xDC, 0x2C, 0x31,
+  0xC2, 0x20, 0xFE, 0xFD, 0x75, 0x3B, 0x1D, 0xC0, 0x22, 0x1D, 0xC2, 0x08, 0x31, 0xC7, 0x2C, 0x31,
+  0xFE, 0xFB, 0xCF, 0x1D, 0x08, 0x31, 0xC4, 0x2C, 0x31, 0xFE, 0xFB, 0xEF, 0x1D, 0xC0, 0x22, 0x28,
+  0x31, 0xC0, 0x2C, 0x31, 0x0B, 0x1D, 0x22, 0x1D, 0x33, 0xFE, 0xFF, 0x3C, 0x31, 0x2C, 0x31, 0x07,
+  0x1D, 0xC1, 0x22, 0x1D, 0xA4, 0x46, 0xFE, 0xFC, 0x51, 0x06, 0xC0, 0xFE, 0xFC, 0x30, 0x33, 0x1D,
+  0xC1, 0x04, 0x21, 0x13, 0x18, 0xFE, 0xFC, 0xB2, 0xFE, 0xFA, 0x8A, 0x33, 0x1D, 0xCB, 0x2E, 0x33,
+  0x22, 0x1D, 0xC0, 0x22, 0x1D, 0xA6, 0x25, 0xFE, 0xFF, 0x7D, 0x31, 0xC7, 0x0F, 0xFE, 0xF9, 0x04,
+  0xFE, 0xFE, 0x79, 0x31, 0xC1, 0x2C, 0x31, 0x3E, 0x1D, 0x03, 0x31, 0xD9, 0x2C, 0x31, 0xC2, 0x2C,
+  0x35, 0xFE, 0xFB, 0x6D, 0x21, 0x1D, 0xC8, 0x02, 0x31, 0xC6, 0x2C, 0x31, 0xFE, 0xFB, 0xEF, 0x1D,
+  0x08, 0x31, 0xC4, 0x2C, 0x31, 0x3A, 0x1D, 0xC0, 0xA4, 0x46, 0x0F, 0x31, 0xC0, 0x2C, 0x31, 0xFE,
+  0xFB, 0x8E, 0x1D, 0x22, 0x1D, 0x3F, 0x0F, 0x31, 0xC1, 0x1B, 0x04, 0x1D, 0xC2, 0x29, 0x31, 0xC2,
+  0x35, 0x2E, 0x1D, 0xCD, 0x22, 0x1D, 0xCA, 0x33, 0x29, 0x31, 0xC9, 0x0A, 0x31, 0xC2, 0x2C, 0x31,
+  0x14, 0x33, 0x24, 0x31, 0xD5, 0x2C, 0x31, 0xC3, 0x9A, 0xEB, 0xFE, 0xFD, 0x34, 0xFE, 0xFA, 0xCB,
+  0x3F, 0x1D, 0xC1, 0x04, 0x37, 0x08, 0x6F, 0x9C, 0xCA, 0x22, 0x1D, 0xC2, 0x03, 0x31, 0xC6, 0x2C,
+  0x31, 0xFE, 0xFC, 0x92, 0x1D, 0x08, 0x31, 0xC4, 0x2C, 0x31, 0xFE, 0xFB, 0x2C, 0x1D, 0xC0, 0x37,
+  0x31, 0xC1, 0x2C, 0x31, 0x0B, 0x1D, 0x22, 0x1D, 0x26, 0x2C, 0x31, 0xC2, 0x3B, 0x1D, 0x22, 0x1D,
+  0x15, 0x2C, 0xC0, 0x31, 0xC0, 0x2C, 0x31, 0x14, 0x1D, 0xC1, 0x22, 0x1D, 0xCC, 0x22, 0x6F, 0xC2,
+  0x33, 0xC0, 0x10, 0x08, 0x3A, 0xFE, 0xFE, 0xBA, 0x31, 0xD1, 0x20, 0x2D, 0x31, 0xD2, 0x2C, 0x31,
+  0xC3, 0x1B, 0x35, 0xFE, 0xFB, 0xCF, 0x03, 0x1D, 0xC0, 0x33, 0x25, 0x21, 0x13, 0xFE, 0xFE, 0xBA,
+  0xA6, 0x25, 0x31, 0xC1, 0x2C, 0x28, 0x21, 0x22, 0x1D, 0xC1, 0x35, 0x31, 0xC5, 0x2C, 0x31, 0xFE,
+  0xFC, 0xF3, 0x1D, 0x08, 0x31, 0xC4, 0x2C, 0x31, 0xFE, 0xFB, 0x2C, 0x1D, 0xC0, 0x14, 0x31, 0xC1,
+  0x2C, 0x31, 0xFE, 0xFB, 0xAE, 0x1D, 0x22, 0x1D, 0x37, 0x31, 0xC1, 0x2C, 0x31, 0xFE, 0xFC, 0x30,
+  0x1D, 0x22, 0x1D, 0x08, 0x31, 0xC4, 0x3B, 0x1D, 0xC4, 0x3B, 0xA8, 0x04, 0xFE, 0xF9, 0x04, 0x1D,
+  0xC3, 0x22, 0x2E, 0x02, 0xA7, 0x14, 0x28, 0x39, 0x3E, 0xC2, 0x0A, 0x1B, 0x31, 0xE6, 0x2C, 0x31,
+  0xC3, 0x20, 0x06, 0xFE, 0xFC, 0x71, 0x3B, 0x33, 0x1D, 0xC0, 0xFE, 0xFA, 0x08, 0x03, 0xFE, 0xFE,
+  0x79, 0x2C, 0x31, 0xC9, 0xFE, 0xFC, 0xB2, 0x1D, 0x22, 0x1D, 0xFE, 0xFA, 0xEB, 0x31, 0xC5, 0x2C,
+  0x31, 0xFE, 0xFC, 0xD3, 0xFE, 0xF8, 0x00, 0x37, 0x31, 0xC4, 0x2C, 0x31, 0x2E, 0x1D, 0xC0, 0x2A,
+  0x31, 0xC1, 0x2C, 0x31, 0xFE, 0xFB, 0xCF, 0x1D, 0x22, 0x1D, 0x08, 0x31, 0xC3, 0x13, 0x1D, 0x22,
+  0x1D, 0x19, 0x31, 0xC4, 0x2A, 0x1D, 0xC2, 0x22, 0x02, 0x31, 0xC0, 0x0F, 0x08, 0x1D, 0xC2, 0x20,
+  0x31, 0xCA, 0x2C, 0x31, 0xE0, 0x2C, 0x31, 0xC3, 0x1B, 0x3A, 0x03, 0x07, 0x15, 0x1D, 0xC1, 0x19,
+  0xFE, 0xFD, 0x14, 0x0A, 0xA5, 0x35, 0xC3, 0x2C, 0x31, 0xC6, 0x2C, 0x31, 0xFE, 0xF9, 0x45, 0x1D,
+  0xC0, 0x04, 0x1B, 0x31, 0xC4, 0x2C, 0x31, 0x20, 0x1D, 0x37, 0x31, 0xC4, 0x2C, 0x31, 0xFE, 0xFB,
+  0x4D, 0x1D, 0xC0, 0xFE, 0xFA, 0xEB, 0x31, 0x2C, 0x31, 0x2C, 0x31, 0x1C, 0xFE, 0xF8, 0x00, 0x22,
+  0x1D, 0xFE, 0xF9, 0xC7, 0x31, 0xC3, 0x28, 0x22, 0x1D, 0xC0, 0x0C, 0x31, 0xC4, 0x08, 0x1D, 0xC2,
+  0x20, 0x31, 0x2C, 0xC0, 0x31, 0x17, 0x22, 0x1D, 0xC1, 0x28, 0x31, 0xC4, 0x2C, 0xC4, 0x31, 0xD4,
+  0x2C, 0xC0, 0x31, 0xC4, 0x2C, 0x31, 0xC4, 0x1B, 0xFE, 0xFE, 0x38, 0x03, 0x07, 0x15, 0x1D, 0xC3,
+  0x26, 0xFE, 0xFD, 0xB6, 0x31, 0xC2, 0x2C, 0x31, 0xCA, 0x2C, 0x31, 0xFE, 0xFB, 0x8E, 0x1D, 0x22,
+  0x1D, 0x24, 0x31, 0xC4, 0x2C, 0x31, 0x20, 0x1D, 0x21, 0xFE, 0xFF, 0xBE, 0x31, 0xC3, 0x2C, 0x31,
+  0x0B, 0x1D, 0xC0, 0x3F, 0x31, 0x2C, 0x31, 0x2C, 0x31, 0xFE, 0xFC, 0x51, 0x1D, 0x22, 0x1D, 0x19,
+  0x31, 0xC3, 0x0F, 0xFE, 0xF8, 0x82, 0x1D, 0xC0, 0x2E, 0x31, 0x2C, 0x31, 0xC1, 0x20, 0xFE, 0xF8,
+  0xC3, 0x1D, 0x22, 0x1D, 0xFE, 0xFA, 0x49, 0x31, 0x2C, 0x31, 0xC0, 0x2C, 0x31, 0x07, 0x1D, 0x22,
+  0x1D, 0x08, 0xFE, 0xFD, 0x14, 0xFE, 0xFE, 0xBA, 0x0A, 0x2C, 0x6E, 0xCB, 0x2C, 0x31, 0xD9, 0x0F,
+  0x3A, 0x03, 0x07, 0x21, 0x1D, 0xC3, 0x22, 0xC0, 0x1D, 0x21, 0xFE, 0xFF, 0x3C, 0x31, 0xC0, 0x2C,
+  0x31, 0xCC, 0x2C, 0x31, 0xC0, 0x2E, 0x1D, 0xA2, 0x67, 0x1D, 0xFE, 0xFB, 0xEF, 0x31, 0x2C, 0x31,
+  0xC4, 0xFE, 0xFD, 0x34, 0x1D, 0x3F, 0x0F, 0x31, 0xC3, 0x2C, 0x31, 0x0B, 0x1D, 0xC0, 0x0B, 0x31,
+  0x2C, 0x31, 0x2C, 0x31, 0xFE, 0xFC, 0x92, 0x1D, 0x22, 0x1D, 0x25, 0x31, 0xC4, 0x37, 0x1D, 0xC0,
+  0xFE, 0xFB, 0x6D, 0x31, 0x2C, 0x31, 0xC1, 0x17, 0x1D, 0xC1, 0x22, 0xFE, 0xFE, 0x79, 0x31, 0xC4,
+  0x13, 0x1D, 0xC4, 0x33, 0x26, 0x08, 0x25, 0xA2, 0x67, 0x0C, 0x6F, 0xA2, 0x67, 0x3F, 0x03, 0xA8,
+  0x04, 0x17, 0x0A, 0x31, 0xC9, 0xFE, 0xFC, 0xD3, 0xFE, 0xFA, 0x8A, 0xFE, 0xFF, 0xBE, 0x31, 0xC2,
+  0x2C, 0xFE, 0xFC, 0x51, 0x61, 0xFE, 0xFD, 0xB6, 0x1C, 0x28, 0x1C, 0x9A, 0xEB, 0x9C, 0xCA, 0xFE,
+  0xFC, 0x30, 0xFE, 0xFB, 0x2C, 0x14, 0x04, 0x1D, 0xC3, 0x10, 0x0C, 0x66, 0x1D, 0xC0, 0x22, 0x1D,
+  0x3E, 0x31, 0x2C, 0x31, 0xD0, 0xFE, 0xFD, 0x14, 0xFE, 0xF8, 0x41, 0x1D, 0x22, 0x1D, 0x07, 0xFE,
+  0xFF, 0xFF, 0xC6, 0x02, 0x1D, 0xA4, 0x46, 0x0A, 0x31, 0xC3, 0x2C, 0x31, 0xFE, 0xFB, 0x8E, 0x1D,
+  0xC0, 0xFE, 0xFB, 0xCF, 0x31, 0x2C, 0x31, 0x2C, 0x31, 0xFE, 0xFD, 0x14, 0x1D, 0x22, 0x1D, 0x19,
+  0xFE, 0xFF, 0xFF, 0xC4, 0x14, 0x1D, 0xC0, 0xFE, 0xFB, 0xAE, 0x31, 0x2C, 0x31, 0x2C, 0x31, 0xFE,
+  0xFC, 0xD3, 0x1D, 0x22, 0x1D, 0x2A, 0x31, 0xC5, 0x2C, 0x26, 0x1D, 0x22, 0x1D, 0x22, 0x1D, 0xC4,
+  0x04, 0x36, 0xFE, 0xFB, 0x6D, 0x10, 0x99, 0xFC, 0xFE, 0xF8, 0x82, 0x1D, 0x3F, 0x37, 0x18, 0x20,
+  0x39, 0x31, 0xC4, 0x61, 0x15, 0x1D, 0x13, 0x31, 0x2C, 0x31, 0xC0, 0xFE, 0xFE, 0xFB, 0x1D, 0xC2,
+  0x22, 0x1D, 0xC6, 0x22, 0xFE, 0xF9, 0x86, 0x0B, 0xFE, 0xFD, 0xB6, 0xFE, 0xFF, 0x7D, 0x31, 0xC0,
+  0xFE, 0xFC, 0x10, 0x1D, 0x22, 0x1D, 0x3E, 0x31, 0x20, 0x31, 0xC4, 0x2C, 0xC3, 0x31, 0xC2, 0x20,
+  0x21, 0x37, 0x1D, 0xC3, 0x08, 0x31, 0xC6, 0x13, 0x1D, 0x33, 0xFE, 0xFF, 0x3C, 0x31, 0xC3, 0x2C,
+  0x31, 0x0B, 0x1D, 0xC0, 0x1C, 0x31, 0x2C, 0x31, 0x2C, 0x31, 0x02, 0x1D, 0x22, 0x1D, 0x3B, 0x31,
+  0xC4, 0xFE, 0xFA, 0xCB, 0x1D, 0xC0, 0x10, 0x31, 0x2C, 0x31, 0x2C, 0x31, 0xFE, 0xFB, 0x0C, 0x1D,
+  0x22, 0x1D, 0x02, 0x31, 0x2C, 0x31, 0xC4, 0xFE, 0xFD, 0x75, 0x1D, 0xC5, 0xA8, 0x04, 0x1C, 0x06,
+  0x31, 0xC3, 0x20, 0x0B, 0x1D, 0xC2, 0x33, 0xFE, 0xFC, 0x51, 0x31, 0xC3, 0x2C, 0x21, 0x1D, 0xFE,
+  0xFD, 0xB6, 0x31, 0x2C, 0x31, 0xC0, 0x0A, 0x04, 0x22, 0xC0, 0x1D, 0xC5, 0xA6, 0x25, 0xFE, 0xFA,
+  0x8A, 0xFE, 0xFC, 0xD3, 0xFE, 0xFE, 0xBA, 0x31, 0xC2, 0x2C, 0x31, 0x0F, 0x3F, 0x1D, 0xC0, 0x03,
+  0x31, 0xCF, 0xFE, 0xFA, 0xEB, 0xFE, 0xF8, 0x00, 0xC0, 0x22, 0x1D, 0xC0, 0x22, 0x1D, 0x25, 0x31,
+  0xC6, 0x24, 0x1D, 0x2E, 0x39, 0x31, 0xC3, 0x2C, 0x31, 0x0B, 0x1D, 0xC0, 0xFE, 0xFB, 0xCF, 0x31,
+  0x2C, 0x31, 0xC1, 0x13, 0x1D, 0x22, 0x1D, 0x29, 0x31, 0xC2, 0x2C, 0x31, 0xFE, 0xFB, 0x6D, 0x1D,
+  0xC0, 0x1C, 0x31, 0x2C, 0x31, 0xC1, 0x14, 0x1D, 0xC0, 0xA4, 0x46, 0x0F, 0x31, 0xC7, 0xFE, 0xFC,
+  0x92, 0x04, 0x1D, 0xC0, 0x10, 0x07, 0x02, 0x1B, 0x31, 0xC2, 0x2C, 0xC1, 0x31, 0xC0, 0xFE, 0xFB,
+  0x6D, 0x1D, 0x22, 0xC0, 0x1D, 0xC0, 0x3E, 0x31, 0xC3, 0x02, 0xFE, 0xFB, 0x4D, 0x2C, 0x31, 0xC3,
+  0x03, 0x1D, 0xC0, 0x22, 0x1D, 0xC1, 0x37, 0x0B, 0x18, 0xFE, 0xFF, 0x7D, 0x31, 0xC2, 0x2C, 0x31,
+  0xC3, 0x37, 0x1D, 0x22, 0x1D, 0x2A, 0xFE, 0xFD, 0x75, 0xA8, 0x04, 0xA2, 0x67, 0xC0, 0x06, 0x24,
+  0x07, 0x9D, 0xBA, 0x9C, 0xCA, 0x9B, 0xDA, 0xC0, 0xA6, 0x25, 0xFE, 0xFD, 0xF7, 0x2C, 0x6E, 0xC0,
+  0x3E, 0x1D, 0xC5, 0x20, 0x31, 0x2C, 0x31, 0xC4, 0x06, 0x1D, 0x22, 0x28, 0x31, 0xC3, 0x2C, 0x31,
+  0xFE, 0xFB, 0x8E, 0x1D, 0xC0, 0xFE, 0xFB, 0xCF, 0x31, 0x2C, 0x31, 0xC1, 0x18, 0x1D, 0x22, 0x1D,
+  0xFE, 0xFA, 0xEB, 0x31, 0xC2, 0x2C, 0x31, 0xFE, 0xFB, 0xAE, 0xFE, 0xF8, 0x00, 0xC0, 0x21, 0x31,
+  0x2C, 0x31, 0xC0, 0x1B, 0xFE, 0xF8, 0xC3, 0x1D, 0xC0, 0x36, 0x31, 0xC9, 0x9C, 0xCA, 0x35, 0xA3,
+  0x56, 0x1B, 0x31, 0xC1, 0x2C, 0x31, 0xC6, 0x2C, 0xFE, 0xF9, 0x45, 0x1D, 0xC0, 0x22, 0x1D, 0x25,
+  0x31, 0xCB, 0xFE, 0xFA, 0xCB, 0x1D, 0xC1, 0x10, 0x3F, 0xFE, 0xFE, 0x38, 0x31, 0xC3, 0x2C, 0x31,
+  0xC3, 0x2C, 0x31, 0x17, 0x22, 0x1D, 0xC4, 0x22, 0xC0, 0x1D, 0xC7, 0xFE, 0xFC, 0x30, 0x31, 0x2C,
+  0x31, 0x29, 0xFE, 0xFB, 0x4D, 0x19, 0x03, 0xC0, 0x2A, 0xFE, 0xFC, 0xF3, 0x31, 0xC7, 0xFE, 0xFE,
+  0xFB, 0x22, 0x1D, 0xFE, 0xFE, 0x38, 0x31, 0xC3, 0x2C, 0x31, 0x3F, 0x1D, 0xC0, 0x1C, 0x31, 0x2C,
+  0x31, 0xC1, 0x35, 0x1D, 0x22, 0x1D, 0xFE, 0xFA, 0xEB, 0x31, 0xC2, 0x2C, 0x31, 0x32, 0xFE, 0xF8,
+  0x00, 0xC0, 0x21, 0x31, 0x2C, 0x31, 0xC0, 0x2D, 0x22, 0x1D, 0xC0, 0x3E, 0x31, 0x2C, 0x31, 0xD6,
+  0x2C, 0x31, 0xFE, 0xFD, 0x14, 0x1D, 0xC0, 0x22, 0x1D, 0x02, 0xFE, 0xFF, 0xFF, 0xC9, 0x2C, 0x31,
+  0xFE, 0xFC, 0x92, 0x1D, 0x2E, 0xFE, 0xFC, 0x10, 0x0A, 0x31, 0xC1, 0x2C, 0x31, 0xC6, 0x2C, 0x31,
+  0x9C, 0xCA, 0x03, 0x1D, 0xCE, 0xA4, 0x46, 0xFE, 0xFA, 0x08, 0x0B, 0x31, 0xD1, 0x9A, 0xEB, 0x33,
+  0x1D, 0x24, 0x31, 0xC3, 0x2C, 0x31, 0xFE, 0xFB, 0x2C, 0x1D, 0xC0, 0x1C, 0x31, 0x2C, 0x31, 0xC1,
+  0x17, 0x1D, 0xC1, 0xFE, 0xFA, 0xEB, 0x31, 0xC2, 0x2C, 0x31, 0xFE, 0xFC, 0xF3, 0xFE, 0xF8, 0x00,
+  0xC0, 0x21, 0x31, 0x2C, 0x31, 0xC0, 0x35, 0x1D, 0x22, 0x1D, 0x29, 0x31, 0xC8, 0x2C, 0xC1, 0x31,
+  0xCD, 0x3E, 0xFE, 0xF8, 0x41, 0x1D, 0xC0, 0xFE, 0xFA, 0x08, 0x31, 0xCC, 0x3A, 0x33, 0x29, 0x31,
+  0xC0, 0x2C, 0x31, 0xCA, 0xFE, 0xFE, 0xBA, 0x37, 0x1D, 0x22, 0x1D, 0xC4, 0x10, 0x0C, 0x21, 0xFE,
+  0xFD, 0x14, 0x13, 0x6E, 0xC0, 0x29, 0x0B, 0x3E, 0xA6, 0x25, 0xC4, 0x2C, 0x31, 0xCC, 0x61, 0x15,
+  0x1D, 0x13, 0x31, 0xC3, 0x2C, 0x31, 0xFE, 0xFB, 0x2C, 0x1D, 0xC0, 0xFE, 0xFB, 0xCF, 0x31, 0x2C,
+  0x31, 0xC1, 0xFE, 0xFE, 0xFB, 0x22, 0x1D, 0xC0, 0xFE, 0xFA, 0xEB, 0x31, 0xC4, 0x02, 0xFE, 0xF8,
+  0x00, 0xC0, 0x21, 0x31, 0x2C, 0x31, 0xC0, 0x02, 0x1D, 0xC0, 0x22, 0x39, 0x31, 0xD6, 0x2C, 0xC1,
+  0x31, 0x39, 0xFE, 0xF8, 0x41, 0x1D, 0x2E, 0x28, 0x31, 0xCC, 0x0F, 0x3B, 0x31, 0xCA, 0x2C, 0x31,
+  0xC0, 0xFE, 0xFD, 0x14, 0x3F, 0x1D, 0xC6, 0xFE, 0xFA, 0xCB, 0x0A, 0xA5, 0x35, 0xDD, 0x08, 0x1D,
+  0xFE, 0xFD, 0x34, 0x31, 0x2C, 0x31, 0xC1, 0x2C, 0x31, 0xFE, 0xFB, 0x2C, 0x1D, 0xC0, 0xFE, 0xFB,
+  0x8E, 0x31, 0x2C, 0x31, 0xC1, 0x3E, 0xFE, 0xF8, 0x41, 0x1D, 0xC0, 0xFE, 0xFA, 0xEB, 0x31, 0xC4,
+  0x13, 0xFE, 0xF8, 0x00, 0xC0, 0x21, 0x31, 0x2C, 0xC0, 0x31, 0xFE, 0xFC, 0x71, 0x1D, 0xC0, 0xA8,
+  0x04, 0x20, 0x31, 0xC6, 0x20, 0x13, 0xFE, 0xFB, 0xEF, 0x61, 0xFE, 0xFD, 0x14, 0x2C, 0x6E, 0xCB,
+  0x28, 0xFE, 0xFA, 0x49, 0x1D, 0xC0, 0xFE, 0xFC, 0xF3, 0x31, 0xCE, 0x06, 0x2C, 0x31, 0xCA, 0x3E,
+  0x18, 0x1D, 0xC2, 0xFE, 0xFC, 0x10, 0x18, 0x1D, 0x22, 0xC0, 0x1D, 0xFE, 0xFC, 0x51, 0x31, 0x20,
+  0x2C, 0xC0, 0x31, 0xC7, 0x2C, 0xC0, 0x31, 0xC4, 0x2C, 0x31, 0xC8, 0x2A, 0x1D, 0x3E, 0x31, 0x2C,
+  0x31, 0xC1, 0x2C, 0x31, 0xFE, 0xFB, 0x2C, 0x1D, 0xC0, 0x0B, 0x31, 0x2C, 0x31, 0xC1, 0x0A, 0x33,
+  0x1D, 0xC0, 0xFE, 0xFA, 0xEB, 0x31, 0xC4, 0xFE, 0xFD, 0xB6, 0xFE, 0xF8, 0x00, 0xC0, 0x21, 0x31,
+  0x2C, 0xC0, 0x31, 0x0B, 0x1D, 0xC0, 0x08, 0x31, 0xC5, 0x20, 0x3E, 0xFE, 0xF9, 0x04, 0x1D, 0xC1,
+  0x3F, 0x1B, 0x31, 0xC2, 0x28, 0x24, 0x13, 0x02, 0xC1, 0x14, 0x10, 0x36, 0xFE, 0xF8, 0x41, 0x1D,
+  0xC0, 0x0B, 0x31, 0x2C, 0x31, 0xD7, 0x2C, 0x31, 0xC0, 0x25, 0x04, 0x1D, 0x22, 0x1D, 0xFE, 0xF9,
+  0x45, 0x35, 0x31, 0x2C, 0xFE, 0xF9, 0xC7, 0x1D, 0x22, 0x1D, 0x2E, 0x07, 0x31, 0xC0, 0x2C, 0x31,
+  0xC2, 0x2C, 0x31, 0xD3, 0x2C, 0x31, 0xFE, 0xFB, 0x4D, 0x1D, 0x10, 0x31, 0x2C, 0x31, 0xC3, 0xFE,
+  0xFA, 0xCB, 0x1D, 0xC0, 0x3A, 0x31, 0x2C, 0x31, 0xC1, 0x20, 0x15, 0x1D, 0xC0, 0xFE, 0xFB, 0x0C,
+  0x31, 0xC4, 0x24, 0x1D, 0xC0, 0xFE, 0xFB, 0xEF, 0x31, 0x2C, 0x31, 0xC0, 0x29, 0x1D, 0xC0, 0x36,
+  0x31, 0xC2, 0x2C, 0x31, 0x06, 0xFE, 0xF9, 0x86, 0x1D, 0xC2, 0x03, 0xFE, 0xFE, 0xBA, 0x31, 0xC3,
+  0x3E, 0x1D, 0xC8, 0x3A, 0x31, 0xDB, 0x1C, 0x36, 0x1D, 0xC2, 0xFE, 0xFB, 0x6D, 0x1B, 0x31, 0x2C,
+  0x31, 0x9A, 0xEB, 0xFE, 0xF9, 0x04, 0x1D, 0x22, 0x1D, 0xC0, 0x0B, 0x1B, 0x31, 0xC6, 0x3E, 0xFE,
+  0xFD, 0xF7, 0xFE, 0xFC, 0x92, 0x3F, 0x36, 0x14, 0x08, 0xC0, 0x19, 0xA8, 0x04, 0xFE, 0xFC, 0xD3,
+  0x0A, 0x31, 0xC5, 0x2C, 0x31, 0x2D, 0xFE, 0xF8, 0x00, 0x3A, 0x31, 0x2C, 0x31, 0xC3, 0x36, 0x1D,
+  0xC0, 0x18, 0x31, 0x2C, 0x31, 0xC2, 0x37, 0x1D, 0xC0, 0x3F, 0x31, 0x2C, 0x31, 0xC2, 0x29, 0x1D,
+  0xC0, 0xFE, 0xFB, 0xEF, 0x31, 0x2C, 0x31, 0xC0, 0xFE, 0xFA, 0x08, 0x1D, 0xC0, 0xFE, 0xFA, 0xEB,
+  0x31, 0xC1, 0x2C, 0x31, 0x02, 0x22, 0x66, 0xC1, 0x15, 0xFE, 0xFC, 0x30, 0xFE, 0xFF, 0xBE, 0x31,
+  0xC5, 0xFE, 0xFC, 0xF3, 0x04, 0x1D, 0xC4, 0x2E, 0xFE, 0xFC, 0x71, 0x31, 0xDA, 0x2C, 0xFE, 0xFC,
+  0x51, 0x33, 0x1D, 0x22, 0x1D, 0x26, 0xFE, 0xFD, 0xB6, 0x31, 0xC4, 0x17, 0xFE, 0xF8, 0x82, 0x1D,
+  0x22, 0x1D, 0xC0, 0xA8, 0x04, 0x3E, 0xFE, 0xFE, 0x79, 0x39, 0x28, 0x29, 0xFE, 0xFC, 0xB2, 0xFE,
+  0xFB, 0x2C, 0x08, 0x33, 0x1D, 0xC8, 0x04, 0xFE, 0xFC, 0xD3, 0x31, 0xC4, 0x2C, 0x31, 0xFE, 0xFD,
+  0x34, 0x1D, 0xFE, 0xFA, 0x49, 0x31, 0xC5, 0x3B, 0x1D, 0xC0, 0x2A, 0x31, 0xC4, 0xFE, 0xF9, 0xC7,
+  0x1D, 0xC0, 0xFE, 0xFB, 0x6D, 0x31, 0x2C, 0x31, 0xC2, 0x1C, 0x22, 0x1D, 0xFE, 0xFB, 0xEF, 0x31,
+  0x2C, 0x31, 0xC0, 0x08, 0x1D, 0xC0, 0x3A, 0x31, 0x2C, 0x31, 0xC0, 0xFE, 0xFD, 0x34, 0x1D, 0xC1,
+  0xA6, 0x25, 0x3E, 0xFE, 0xFF, 0x7D, 0x31, 0xC8, 0x39, 0xFE, 0xFB, 0xAE, 0xFE, 0xF9, 0x45, 0xFE,
+  0xF8, 0x41, 0xC0, 0xA6, 0x25, 0xFE, 0xFB, 0x2C, 0x17, 0x31, 0xDA, 0xFE, 0xFE, 0x38, 0x08, 0x1D,
+  0xC2, 0xFE, 0xFB, 0x0C, 0x0F, 0x31, 0x2C, 0x31, 0xC4, 0x3A, 0x04, 0x1D, 0xC0, 0x22, 0x1D, 0xC1,
+  0x33, 0x66, 0x1D, 0xC7, 0x33, 0x04, 0x26, 0x15, 0x1D, 0xC2, 0xFE, 0xFC, 0x92, 0x31, 0xC5, 0x35,
+  0x1D, 0x08, 0x31, 0xC5, 0x2A, 0x1D, 0xC0, 0x14, 0x31, 0xC4, 0x2A, 0x1D, 0xC0, 0x3F, 0x31, 0x2C,
+  0x31, 0xC2, 0x28, 0x2E, 0x1D, 0xFE, 0xFB, 0xEF, 0x31, 0x2C, 0x31, 0xC0, 0x37, 0x1D, 0xC0, 0x3F,
+  0x31, 0x2C, 0x31, 0x06, 0x22, 0x1D, 0xC0, 0xFE, 0xFA, 0xCB, 0xFE, 0xFF, 0x3C, 0x31, 0xCC, 0x2C,
+  0x39, 0xC0, 0xA5, 0x35, 0x31, 0xDA, 0x9C, 0xCA, 0x3F, 0x1D, 0xC0, 0x22, 0x1D, 0xA4, 0x46, 0x36,
+  0x31, 0xC9, 0x28, 0xFE, 0xFA, 0x08, 0x1D, 0xC8, 0x3F, 0x08, 0x29, 0xFE, 0xFC, 0x51, 0x13, 0x0B,
+  0xA6, 0x25, 0x0F, 0x2C, 0x1B, 0x36, 0x3F, 0x1D, 0x22, 0xC0, 0xFE, 0xFE, 0xFB, 0x31, 0xC4, 0x39,
+  0x1D, 0x15, 0x20, 0x31, 0xC4, 0x14, 0x1D, 0xC0, 0xFE, 0xF9, 0x86, 0x31, 0xC2, 0x2C, 0x31, 0x29,
+  0x1D, 0xC0, 0xFE, 0xFB, 0x6D, 0x31, 0x2C, 0x31, 0xC2, 0x39, 0x33, 0x1D, 0x21, 0x31, 0x2C, 0x31,
+  0x20, 0x15, 0x1D, 0xC0, 0x10, 0x31, 0x2C, 0x20, 0x37, 0x1D, 0xC0, 0x21, 0x31, 0xC0, 0x2C, 0x31,
+  0xE6, 0x2C, 0x31, 0xC1, 0xFE, 0xFC, 0xF3, 0x15, 0x1D, 0xC0, 0x22, 0x1D, 0x08, 0x28, 0x31, 0xCC,
+  0x24, 0x3F, 0xFE, 0xFA, 0x08, 0x08, 0xC0, 0x19, 0x18, 0xA8, 0x04, 0xFE, 0xFD, 0x14, 0x06, 0x0A,
+  0xA5, 0x35, 0xC8, 0x06, 0x33, 0x22, 0x1D, 0x1C, 0x31, 0x2C, 0x31, 0xC2, 0x20, 0xFE, 0xF8, 0xC3,
+  0x22, 0x3E, 0x31, 0xC4, 0x19, 0x1D, 0xC0, 0xA8, 0x04, 0x2C, 0x31, 0xC1, 0x2C, 0x31, 0xFE, 0xFB,
+  0x8E, 0x1D, 0xC0, 0x3F, 0x31, 0x2C, 0x31, 0xC2, 0x39, 0x33, 0x1D, 0xFE, 0xFB, 0xEF, 0x31, 0x2C,
+  0x31, 0x0A, 0x33, 0x1D, 0xC0, 0xFE, 0xFB, 0xAE, 0x31, 0xC0, 0xFE, 0xFC, 0xD3, 0x1D, 0xC0, 0x18,
+  0x31, 0x2C, 0x31, 0xEA, 0xFE, 0xFD, 0xB6, 0x14, 0x1D, 0xC0, 0x22, 0xC0, 0x1D, 0x0C, 0xFE, 0xFF,
+  0xBE, 0x31, 0x2C, 0x31, 0xD8, 0x2C, 0x31, 0xC4, 0x2C, 0x31, 0x18, 0x1D, 0xC0, 0x26, 0x2C, 0x31,
+  0xC4, 0x19, 0x1D, 0xFE, 0xFE, 0x79, 0x31, 0xC4, 0x19, 0x1D, 0xC0, 0x33, 0x0A, 0x31, 0xC1, 0x2C,
+  0x31, 0xFE, 0xFC, 0x10, 0x1D, 0xC0, 0x3F, 0x31, 0x2C, 0x31, 0xC2, 0x0A, 0xFE, 0xF8, 0x82, 0x1D,
+  0x21, 0x31, 0x2C, 0x31, 0x3E, 0x33, 0x1D, 0xC0, 0xFE, 0xFB, 0x8E, 0x31, 0xC0, 0x08, 0x1D, 0x2E,
+  0xFE, 0xFE, 0xFB, 0x31, 0xE0, 0x1B, 0x07, 0x0F, 0x31, 0xC4, 0xFE, 0xFB, 0x6D, 0x61, 0x14, 0x1D,
+  0xC2, 0x22, 0x1D, 0x0B, 0x31, 0xD0, 0x2C, 0x31, 0xC3, 0x2C, 0xC0, 0x31, 0xCA, 0x2C, 0x31, 0x0B,
+  0x1D, 0xC0, 0x35, 0x31, 0xC2, 0x2C, 0x31, 0xFE, 0xFB, 0x4D, 0x1D, 0x13, 0x31, 0x2C, 0x31, 0xC2,
+  0x08, 0x1D, 0xC0, 0xA2, 0x67, 0x39, 0x31, 0xC1, 0x2C, 0x31, 0xFE, 0xFC, 0xF3, 0x1D, 0xC0, 0x3F,
+  0x31, 0x2C, 0x31, 0xC2, 0x0A, 0xFE, 0xF8, 0x82, 0x1D, 0x1C, 0x31, 0x2C, 0x31, 0x2D, 0x2E, 0x1D,
+  0xC0, 0xFE, 0xFB, 0x2C, 0x31, 0xFE, 0xFE, 0x79, 0x22, 0x1D, 0x08, 0x31, 0xDF, 0x2C, 0x31, 0x1C,
+  0x1D, 0xFE, 0xFC, 0x71, 0x31, 0x2C, 0x31, 0xC1, 0x35, 0x1D, 0xC4, 0x22, 0x1D, 0x1C, 0x31, 0xE7,
+  0x20, 0x26, 0x1D, 0x3A, 0x31, 0xC2, 0x2C, 0x31, 0xFE, 0xFC, 0xB2, 0x1D, 0xFE, 0xFC, 0x30, 0x31,
+  0x2C, 0x31, 0xC2, 0x08, 0x1D, 0xC1, 0x06, 0x31, 0xC3, 0x13, 0x1D, 0xC0, 0xFE, 0xFB, 0x6D, 0x31,
+  0x2C, 0x31, 0xC2, 0x0F, 0xFE, 0xF8, 0x82, 0x1D, 0x32, 0x31, 0x2C, 0x31, 0xFE, 0xFE, 0xBA, 0x1D,
+  0xC1, 0xFE, 0xFA, 0x49, 0x31, 0xFE, 0xFB, 0x6D, 0x1D, 0xC0, 0x08, 0x31, 0xC4, 0x2C, 0x31, 0xD2,
+  0x2C, 0x31, 0xC5, 0x08, 0x1D, 0x3A, 0x31, 0x2C, 0x31, 0x2C, 0x31, 0xFE, 0xFB, 0xCF, 0x1D, 0xA2,
+  0x67, 0x1D, 0xC3, 0x10, 0x31, 0x2C, 0x31, 0xE7, 0x07, 0x1D, 0xA6, 0x25, 0x1B, 0x31, 0xC3, 0x35,
+  0x1D, 0xFE, 0xFA, 0xCB, 0x31, 0xC4, 0x08, 0x1D, 0x22, 0x1D, 0x13, 0x31, 0xC3, 0xFE, 0xFE, 0x38,
+  0x1D, 0xC0, 0xFE, 0xFB, 0x8E, 0x31, 0x2C, 0x31, 0xC2, 0x20, 0xFE, 0xF9, 0x04, 0x1D, 0xFE, 0xFC,
+  0xD3, 0x31, 0x2C, 0x31, 0x3A, 0x1D, 0xC1, 0x26, 0x3A, 0x04, 0x22, 0x1D, 0x33, 0x3E, 0x31, 0xC6,
+  0x1B, 0x3E, 0x28, 0x35, 0x24, 0x13, 0x07, 0xC3, 0xA2, 0x67, 0xA2, 0x67, 0xA6, 0x25, 0x3E, 0x1B,
+  0x31, 0xC7, 0x1B, 0x15, 0x1D, 0x36, 0x31, 0xC3, 0x2A, 0x1D, 0xC4, 0x0C, 0x31, 0x2C, 0x31, 0xC8,
+  0x2C, 0xC1, 0x31, 0xD1, 0x2C, 0xC0, 0x0F, 0x0B, 0x19, 0xC0, 0xFE, 0xFD, 0x14, 0xFE, 0xFF, 0xFF,
+  0xC2, 0x19, 0x1D, 0x13, 0x31, 0x2C, 0x31, 0xC1, 0x0A, 0x22, 0x26, 0x31, 0xC4, 0xFE, 0xF9, 0xC7,
+  0x1D, 0x22, 0x1D, 0xFE, 0xFD, 0x34, 0x31, 0x2C, 0x31, 0xC1, 0x2D, 0x2E, 0x1D, 0xFE, 0xFB, 0xAE,
+  0x31, 0x2C, 0x31, 0xC3, 0x37, 0x1D, 0xFE, 0xFD, 0x14, 0xFE, 0xFF, 0xFF, 0x2C, 0x31, 0x18, 0x1D,
+  0xC7, 0xFE, 0xFA, 0xCB, 0x0A, 0x2C, 0x0F, 0x17, 0x07, 0xFE, 0xFB, 0xEF, 0xFE, 0xFA, 0x8A, 0x14,
+  0x15, 0x33, 0x1D, 0xCB, 0x22, 0xFE, 0xF9, 0x45, 0x07, 0xFE, 0xFC, 0x10, 0x13, 0x3E, 0x31, 0xC2,
+  0x0F, 0xFE, 0xF8, 0x82, 0x1D, 0x08, 0x31, 0xC2, 0x2C, 0x26, 0x1D, 0xC3, 0xA6, 0x25, 0x1B, 0x31,
+  0xE2, 0xFE, 0xFC, 0xB2, 0x1D, 0xC1, 0x37, 0x31, 0xC2, 0x24, 0x1D, 0x0C, 0x31, 0xC4, 0x37, 0x1D,
+  0xFE, 0xFE, 0xFB, 0x31, 0xC3, 0x19, 0x1D, 0x22, 0x1D, 0xFE, 0xFC, 0x30, 0x31, 0x2C, 0x31, 0xC1,
+  0x0F, 0x10, 0x1D, 0xFE, 0xFB, 0xAE, 0x31, 0x2C, 0x31, 0xC3, 0xFE, 0xF9, 0x86, 0x1D, 0xFE, 0xFD,
+  0x75, 0x31, 0x2C, 0x31, 0x13, 0x1D, 0xC2, 0x03, 0xFE, 0xFB, 0xCF, 0x99, 0xFB, 0xFE, 0xF9, 0x45,
+  0xFE, 0xF8, 0x00, 0xC1, 0xA6, 0x25, 0x2E, 0x1D, 0xC6, 0x10, 0x19, 0xA8, 0x04, 0x21, 0x14, 0x07,
+  0xA2, 0x67, 0x24, 0x18, 0x13, 0x20, 0xFE, 0xFB, 0xAE, 0x3B, 0xFE, 0xF8, 0xC3, 0x9A, 0xEB, 0xC1,
+  0x04, 0x0C, 0x35, 0x31, 0xC0, 0x0F, 0x3F, 0x1D, 0x37, 0x31, 0xC2, 0x3E, 0x2E, 0x1D, 0xC3, 0xFE,
+  0xFC, 0x92, 0x31, 0x2C, 0x31, 0xC5, 0x2C, 0xFE, 0xFB, 0x6D, 0x19, 0xFE, 0xFB, 0x0C, 0xA5, 0x35,
+  0xA6, 0x25, 0x36, 0x13, 0x24, 0x35, 0xA3, 0x56, 0x28, 0x2D, 0x39, 0x3E, 0xC0, 0xA2, 0x67, 0xC5,
+  0x0A, 0x3E, 0x2D, 0x3A, 0x14, 0x26, 0x22, 0xC0, 0x1D, 0x08, 0x31, 0xC3, 0x08, 0x2E, 0x0F, 0x31,
+  0xC3, 0x29, 0x1D, 0x36, 0x31, 0x2C, 0x31, 0xC1, 0xFE, 0xFA, 0x08, 0x1D, 0x22, 0x1D, 0x10, 0x31,
+  0x2C, 0x31, 0xC2, 0xFE, 0xF9, 0x86, 0x1D, 0x1C, 0x31, 0x2C, 0x31, 0xC3, 0xFE, 0xF9, 0xC7, 0x1D,
+  0x18, 0x31, 0x2C, 0x31, 0x02, 0x1D, 0x22, 0x1D, 0x22, 0xFE, 0xFE, 0xBA, 0x31, 0xC1, 0x1C, 0x20,
+  0xFE, 0xFA, 0x8A, 0x26, 0x33, 0x2E, 0x33, 0x04, 0x37, 0x2A, 0xFE, 0xFB, 0x8E, 0x36, 0x17, 0x1B,
+  0x31, 0xCA, 0x2C, 0xFE, 0xFE, 0x79, 0xFE, 0xFB, 0xCF, 0xFE, 0xF9, 0x04, 0x1D, 0xC1, 0x3B, 0x3A,
+  0x2C, 0xA6, 0x25, 0x1D, 0x04, 0x1B, 0x31, 0xC1, 0xFE, 0xFE, 0xBA, 0x1D, 0xC3, 0x26, 0xFE, 0xFF,
+  0xBE, 0x31, 0xC7, 0x1C, 0x1D, 0xC8, 0x22, 0xC0, 0x2E, 0x33, 0xC8, 0x2E, 0x22, 0x1D, 0xC4, 0xFE,
+  0xFA, 0x49, 0x31, 0xC1, 0x2C, 0x31, 0x13, 0x1D, 0xFE, 0xFC, 0xF3, 0x31, 0x2C, 0x31, 0x2C, 0x31,
+  0xFE, 0xFC, 0xB2, 0x1D, 0x2A, 0x31, 0xC1, 0x2C, 0x31, 0xFE, 0xFA, 0xCB, 0x1D, 0x22, 0x1D, 0xFE,
+  0xFB, 0x4D, 0x31, 0x2C, 0x31, 0xC2, 0x36, 0x1D, 0xFE, 0xFC, 0x10, 0x31, 0x2C, 0x31, 0xC3, 0xFE,
+  0xF9, 0xC7, 0x1D, 0x06, 0x31, 0x2C, 0x31, 0x25, 0x1D, 0x22, 0x1D, 0x33, 0x0F, 0x2C, 0xC0, 0x31,
+  0xC3, 0x0F, 0x3E, 0xC0, 0x0F, 0x31, 0xC6, 0x2C, 0xC0, 0x31, 0xC3, 0x2C, 0xC0, 0x31, 0xC2, 0x0F,
+  0xFE, 0xFC, 0x30, 0x33, 0x1D, 0xC1, 0x2A, 0x33, 0x1D, 0x2E, 0x3E, 0x31, 0xC1, 0x24, 0x1D, 0xC3,
+  0x24, 0x31, 0xC8, 0x17, 0x1D, 0xC0, 0x22, 0xC1, 0x1D, 0xD3, 0x22, 0x1D, 0xC0, 0x22, 0x1D, 0xFE,
+  0xFB, 0x8E, 0x31, 0x2C, 0x31, 0xC1, 0x2C, 0x15, 0x08, 0x31, 0xC3, 0x06, 0x1D, 0xC0, 0xFE, 0xFE,
+  0x38, 0x31, 0xC0, 0x2C, 0x31, 0x0B, 0x1D, 0x2E, 0x1D, 0x29, 0x31, 0xC2, 0x2C, 0x31, 0x10, 0x1D,
+  0xFE, 0xFC, 0xD3, 0x31, 0x2C, 0x31, 0xC3, 0x19, 0x1D, 0x39, 0x31, 0x2C, 0x31, 0xFE, 0xFC, 0x51,
+  0x1D, 0x22, 0x1D, 0x33, 0x0F, 0x31, 0xC2, 0x2C, 0x31, 0xC6, 0x2C, 0xC0, 0x31, 0xCE, 0x2C, 0x31,
+  0xC0, 0x17, 0x26, 0x1D, 0xC4, 0x28, 0x31, 0x2C, 0x31, 0xFE, 0xFD, 0x75, 0x1D, 0xC2, 0x32, 0x31,
+  0xC9, 0x28, 0x22, 0x1D, 0xC6, 0x22, 0xC0, 0x1D, 0xD0, 0x22, 0x1D, 0xFE, 0xFC, 0xB2, 0x31, 0x2C,
+  0x31, 0xC0, 0x2C, 0x31, 0x3E, 0x1D, 0xFE, 0xFE, 0xFB, 0x31, 0xC2, 0x61, 0x21, 0x1D, 0xFE, 0xFA,
+  0xEB, 0x31, 0xC0, 0x2C, 0x31, 0xFE, 0xFC, 0xD3, 0xFE, 0xF8, 0x00, 0x2E, 0x1D, 0x29, 0x31, 0xC2,
+  0x2C, 0x31, 0xFE, 0xFD, 0x14, 0x1D, 0x07, 0xFE, 0xFF, 0xFF, 0xC5, 0xFE, 0xF9, 0xC7, 0x1D, 0x9D,
+  0xB9, 0x31, 0x2C, 0x31, 0xFE, 0xFB, 0xCF, 0x1D, 0x22, 0x1D, 0x33, 0x0F, 0x31, 0xDF, 0x2C, 0x31,
+  0x39, 0x26, 0x1D, 0x22, 0x1D, 0xC1, 0x3A, 0x31, 0x2C, 0x31, 0xFE, 0xFD, 0x14, 0x1D, 0x22, 0x1D,
+  0x29, 0xFE, 0xFF, 0xFF, 0x2C, 0x31, 0xC8, 0x0A, 0x33, 0x1D, 0xC9, 0x22, 0xA5, 0x36, 0x03, 0xA4,
+  0x46, 0x29, 0x0B, 0xA3, 0x56, 0x6F, 0xA7, 0x14, 0x9C, 0xCA, 0x1C, 0x9B, 0xDA, 0x26, 0x1D, 0xC4,
+  0x35, 0x31, 0xC4, 0x0A, 0x1D, 0x1C, 0x31, 0x2C, 0x31, 0xC1, 0xFE, 0xFA, 0x8A, 0x1D, 0x3F, 0x0A,
+  0x31, 0xC1, 0xFE, 0xFE, 0xFB, 0x1D, 0xC1, 0x2E, 0x31, 0x2C, 0x31, 0xC2, 0x0A, 0x26, 0x35, 0x31,
+  0xC5, 0x3E, 0x99, 0xFB, 0x31, 0xC0, 0x2C, 0x31, 0xFE, 0xFB, 0xAE, 0x1D, 0x22, 0x1D, 0x33, 0x0F,
+  0x31, 0xE0, 0x2C, 0x31, 0xFE, 0xFE, 0x79, 0xFE, 0xF8, 0x41, 0x1D, 0xC2, 0xFE, 0xFD, 0xB6, 0x31,
+  0x2C, 0x31, 0xFE, 0xFC, 0xD3, 0x1D, 0x22, 0x1D, 0x35, 0x31, 0xCB, 0xFE, 0xF9, 0x45, 0x1D, 0xC4,
+  0x22, 0x37, 0x29, 0xFE, 0xFC, 0x92, 0x24, 0x2D, 0x1B, 0x31, 0xC8, 0x61, 0xFE, 0xFB, 0x4D, 0x1D,
+  0xC2, 0xA4, 0x46, 0xFE, 0xFF, 0x7D, 0x31, 0xC5, 0x3B, 0x04, 0x2C, 0x31, 0xC0, 0x2C, 0x31, 0xFE,
+  0xFC, 0xB2, 0x1D, 0xC0, 0xFE, 0xFD, 0x14, 0xFE, 0xFF, 0xFF, 0x2C, 0x31, 0xC0, 0x02, 0x26, 0x1D,
+  0x25, 0x31, 0x2C, 0x31, 0xC3, 0x1B, 0x2C, 0x31, 0xC9, 0x2C, 0x31, 0x29, 0x1D, 0x22, 0x1D, 0x33,
+  0x0A, 0x2C, 0xC5, 0x31, 0xDA, 0x2C, 0x31, 0x10, 0x1D, 0x22, 0x1D, 0xC0, 0x13, 0x31, 0x2C, 0x31,
+  0x3E, 0x1D, 0xC0, 0xA6, 0x25, 0x1B, 0x31, 0xCB, 0x29, 0x1D, 0x22, 0x1D, 0xC0, 0x15, 0x03, 0x28,
+  0x31, 0xC7, 0x2C, 0xC5, 0x31, 0x0F, 0x2E, 0x1D, 0x22, 0x1D, 0x2A, 0x31, 0xC4, 0x2C, 0x31, 0x18,
+  0x1D, 0xFE, 0xFD, 0x75, 0x31, 0x2C, 0x31, 0xC0, 0x28, 0x22, 0x1D, 0xFE, 0xFA, 0xCB, 0x31, 0xC3,
+  0x20, 0x06, 0x31, 0xCE, 0x2C, 0xC0, 0x31, 0xC2, 0xFE, 0xFE, 0x38, 0x3F, 0x1D, 0xC1, 0x3F, 0x31,
+  0xD7, 0x2C, 0xC0, 0x31, 0xC9, 0x0A, 0x3F, 0x1D, 0x2E, 0x1D, 0x13, 0x31, 0x2C, 0x31, 0x1C, 0x1D,
+  0xC0, 0x2A, 0x31, 0xCC, 0x13, 0x1D, 0xC1, 0x22, 0x17, 0x31, 0xC2, 0x2C, 0x31, 0xCC, 0x9A, 0xEB,
+  0x2E, 0x1D, 0x22, 0x1D, 0xFE, 0xFC, 0x92, 0x31, 0x2C, 0x31, 0xC4, 0x20, 0x3F, 0x08, 0x31, 0xC3,
+  0x08, 0x1D, 0x26, 0x2C, 0x31, 0xCF, 0x2C, 0x31, 0xC5, 0x3E, 0x24, 0xFE, 0xFB, 0x4D, 0x2E, 0x1D,
+  0xC2, 0x22, 0x3A, 0x1C, 0x65, 0x21, 0xC0, 0x14, 0xA3, 0x57, 0xC0, 0x07, 0xC0, 0xA2, 0x67, 0xC0,
+  0x24, 0x35, 0x6E, 0x28, 0xC0, 0x39, 0x3E, 0x0A, 0x1B, 0xA3, 0x56, 0xD0, 0x07, 0x1D, 0xC1, 0x3A,
+  0x31, 0x2C, 0x31, 0x21, 0x1D, 0xC0, 0xFE, 0xFB, 0x8E, 0x31, 0x2C, 0x31, 0xCA, 0x2C, 0x26, 0x1D,
+  0xC0, 0x22, 0x3E, 0x2C, 0xC0, 0x31, 0xCD, 0x2C, 0x31, 0x25, 0x1D, 0x22, 0x1D, 0x33, 0x3E, 0x31,
+  0xC7, 0xFE, 0xFB, 0x4D, 0x1D, 0xFE, 0xFE, 0x38, 0x31, 0xC0, 0x2C, 0x31, 0xFE, 0xFC, 0x51, 0x1D,
+  0x22, 0xFE, 0xFE, 0xBA, 0x31, 0xCC, 0x2C, 0x31, 0xC3, 0x28, 0x07, 0x21, 0x3B, 0x32, 0x33, 0x1D,
+  0xD6, 0x22, 0x2E, 0x33, 0x3F, 0xA2, 0x67, 0x37, 0xA3, 0x57, 0xA2, 0x67, 0x29, 0xA5, 0x35, 0x0F,
+  0x18, 0x28, 0x31, 0xC9, 0xFE, 0xFD, 0xF7, 0x36, 0xA8, 0x04, 0x2C, 0x31, 0x2C, 0x31, 0x21, 0x1D,
+  0xC0, 0xFE, 0xFC, 0xF3, 0x31, 0x2C, 0x31, 0xCB, 0xFE, 0xFD, 0x14, 0x1D, 0x22, 0x1D, 0xFE, 0xFC,
+  0x30, 0xFE, 0xFF, 0xFF, 0x2C, 0x31, 0xCE, 0x1B, 0xFE, 0xF9, 0x04, 0x1D, 0x22, 0x1D, 0x0B, 0x31,
+  0xC8, 0x29, 0x1D, 0x36, 0x31, 0xC2, 0x39, 0x33, 0x1D, 0x13, 0x31, 0xC9, 0x2C, 0x31, 0xC2, 0x1C,
+  0xFE, 0xFC, 0xD3, 0xFE, 0xFA, 0xEB, 0xFE, 0xF9, 0x45, 0x2E, 0x61, 0xC8, 0x22, 0x1D, 0xC0, 0x22,
+  0xC4, 0x1D, 0xD5, 0x3F, 0xFE, 0xFB, 0xCF, 0x31, 0xCC, 0x2C, 0x31, 0xFE, 0xFC, 0x10, 0x1D, 0xC0,
+  0x29, 0x31, 0xCE, 0x19, 0x1D, 0x22, 0x2E, 0x24, 0x31, 0x2C, 0x31, 0xCB, 0x2C, 0x31, 0xFE, 0xFA,
+  0xCB, 0x1D, 0x22, 0x1D, 0x04, 0x0A, 0x31, 0xC8, 0x61, 0xFE, 0xF8, 0xC3, 0x1D, 0x24, 0x31, 0xC2,
+  0xFE, 0xFB, 0x2C, 0x1D, 0x0F, 0x31, 0x2C, 0x31, 0xC9, 0x29, 0x0B, 0x37, 0x22, 0x1D, 0xC7, 0x22,
+  0xC1, 0x1D, 0xCA, 0x37, 0xFE, 0xFA, 0xEB, 0x2D, 0xFE, 0xFD, 0x34, 0xA4, 0x46, 0x29, 0x17, 0xC3,
+  0x9D, 0xB9, 0x24, 0x18, 0x07, 0x9D, 0xBA, 0x03, 0x9C, 0xCA, 0x1C, 0x65, 0xC0, 0x0B, 0xC0, 0x36,
+  0xFE, 0xFF, 0xFF, 0xCC, 0x2C, 0x31, 0xFE, 0xFC, 0xD3, 0xFE, 0xF8, 0x00, 0xA2, 0x67, 0xFE, 0xFE,
+  0xFB, 0x31, 0xCE, 0x28, 0x33, 0x1D, 0xC0, 0x2E, 0xFE, 0xFD, 0x14, 0xFE, 0xFF, 0xFF, 0xCB, 0x2C,
+  0x31, 0xFE, 0xFC, 0x10, 0x1D, 0x22, 0x1D, 0xC0, 0x18, 0x31, 0xCA, 0xFE, 0xFA, 0xEB, 0xFE, 0xF8,
+  0x00, 0x37, 0x2C, 0x31, 0xC1, 0x9A, 0xEB, 0x3F, 0x2D, 0x31, 0x2C, 0x31, 0xC6, 0x0A, 0xFE, 0xFC,
+  0x51, 0x32, 0x1D, 0xC3, 0x33, 0x37, 0xFE, 0xFA, 0x8A, 0x0B, 0x03, 0xA8, 0x04, 0x24, 0xA5, 0x35,
+  0x28, 0x6E, 0x28, 0x0B, 0x29, 0xFE, 0xFC, 0xB2, 0xFE, 0xF9, 0xC7, 0x1D, 0xC3, 0x2E, 0x1C, 0xFE,
+  0xFE, 0xBA, 0x31, 0xE4, 0x2C, 0x31, 0x02, 0x1D, 0x26, 0x2C, 0x31, 0xCF, 0x24, 0x1D, 0xC2, 0x0C,
+  0x1C, 0x31, 0xC1, 0x2C, 0x31, 0xC4, 0x2C, 0x31, 0xFE, 0xFC, 0x30, 0x1D, 0x22, 0x1D, 0xC0, 0xFE,
+  0xFC, 0xB2, 0x31, 0xC9, 0x2C, 0x31, 0x36, 0x1D, 0xC0, 0xFE, 0xFD, 0x14, 0xFE, 0xFF, 0xFF, 0xC2,
+  0x28, 0xA3, 0x56, 0x31, 0xC8, 0x03, 0x1D, 0x22, 0x33, 0xA7, 0x15, 0x2A, 0xFE, 0xFB, 0xCF, 0x13,
+  0x39, 0x31, 0xCC, 0x19, 0x1D, 0x22, 0x1D, 0x3F, 0x06, 0x31, 0xC2, 0x2C, 0xC0, 0x31, 0xC9, 0x2C,
+  0xC6, 0x31, 0xCF, 0x35, 0x1D, 0xFE, 0xFA, 0x8A, 0x31, 0xCF, 0x2C, 0x31, 0xFE, 0xFD, 0x75, 0x2E,
+  0x1D, 0x22, 0x1D, 0x2E, 0xFE, 0xFA, 0xEB, 0x29, 0x31, 0xC3, 0x2C, 0xC0, 0x31, 0xC0, 0xFE, 0xFC,
+  0x30, 0xFE, 0xF8, 0x00, 0x22, 0x1D, 0x04, 0x07, 0x31, 0x2C, 0x31, 0xCA, 0x39, 0x33, 0x1D, 0xFE,
+  0xFB, 0x2C, 0x31, 0x2C, 0x31, 0xCD, 0x9C, 0xCA, 0x0A, 0xC0, 0x2C, 0x31, 0xC4, 0x2C, 0xC0, 0x31,
+  0xC6, 0x61, 0x31, 0x02, 0x1D, 0xA2, 0x67, 0x1D, 0xFE, 0xFB, 0x4D, 0x31, 0x2C, 0x31, 0xC2, 0x2C,
+  0x31, 0xC0, 0x2C, 0xC1, 0x31, 0xDD, 0x0A, 0x1D, 0xFE, 0xFC, 0xD3, 0x31, 0x2C, 0x31, 0xCE, 0x2C,
+  0x31, 0xFE, 0xFE, 0x38, 0x26, 0x1D, 0xC3, 0xFE, 0xF9, 0x45, 0xFE, 0xFB, 0x8E, 0x24, 0x1B, 0x31,
+  0xC2, 0x21, 0x1D, 0xC1, 0x0C, 0x2D, 0x31, 0xCE, 0xFE, 0xF9, 0x86, 0x1D, 0x24, 0x31, 0xD4, 0x2C,
+  0x31, 0xC8, 0x2C, 0x31, 0xC3, 0x1B, 0x32, 0x1D, 0xC0, 0xFE, 0xFC, 0x71, 0x31, 0x2C, 0x31, 0xCD,
+  0x2C, 0xC0, 0x31, 0xD0, 0xFE, 0xFC, 0x51, 0x3B, 0x31, 0xC3, 0x20, 0x0A, 0x31, 0xD1, 0x2C, 0x31,
+  0x0F, 0xFE, 0xFB, 0x6D, 0x22, 0x1D, 0xC0, 0x22, 0x1D, 0xC1, 0x15, 0xFE, 0xFA, 0x8A, 0x21, 0x1C,
+  0x32, 0x1D, 0xC0, 0xFE, 0xFA, 0x49, 0x24, 0x31, 0xD0, 0x18, 0x02, 0x31, 0xD7, 0x2C, 0xC2, 0x31,
+  0xCA, 0x2D, 0x07, 0x3B, 0xFE, 0xFF, 0x3C, 0x31, 0xC3, 0x39, 0x3F, 0x9B, 0xDB, 0xA2, 0x67, 0x0B,
+  0xA5, 0x35, 0xA8, 0x04, 0xA6, 0x25, 0x2D, 0x1B, 0x31, 0xC8, 0x2C, 0xC1, 0x31, 0xC6, 0x0F, 0x2E,
+  0x1D, 0x2D, 0x31, 0xDB, 0x17, 0xFE, 0xFB, 0x2C, 0x33, 0x1D, 0xC6, 0xA2, 0x67, 0xFE, 0xFB, 0x2C,
+  0x3A, 0x31, 0xE4, 0x2C, 0xC0, 0x31, 0xCC, 0x0A, 0x99, 0xFB, 0x36, 0x18, 0x36, 0x31, 0xCB, 0x28,
+  0xFE, 0xF9, 0x86, 0x1D, 0xC5, 0x04, 0xFE, 0xF9, 0xC7, 0xFE, 0xFA, 0xEB, 0x21, 0x36, 0x29, 0x2D,
+  0x0F, 0x31, 0xCC, 0x02, 0xFE, 0xF8, 0x00, 0xC0, 0x24, 0x31, 0xDD, 0x39, 0xFE, 0xFC, 0xB2, 0x3B,
+  0x26, 0x33, 0x04, 0x08, 0xFE, 0xFB, 0x0C, 0x36, 0x0A, 0x31, 0xE2, 0x2C, 0x31, 0xC5, 0x0F, 0x39,
+  0x06, 0x24, 0x9D, 0xB9, 0x14, 0x9B, 0xDB, 0x10, 0x29, 0xFE, 0xFA, 0x08, 0x37, 0x99, 0xFC, 0x1D,
+  0xC2, 0x3F, 0x99, 0xFB, 0x31, 0xCC, 0x3E, 0x24, 0xFE, 0xFC, 0x51, 0x2E, 0x25, 0x9A, 0xEB, 0xFE,
+  0xF8, 0x41, 0x1D, 0xC6, 0xA6, 0x25, 0x37, 0xA7, 0x15, 0xFE, 0xFB, 0x6D, 0x21, 0xFE, 0xFD, 0x14,
+  0xA5, 0x35, 0x3A, 0xA6, 0x25, 0xA2, 0x67, 0x0A, 0x1B, 0x0A, 0x35, 0x26, 0x1D, 0xC0, 0x31, 0xFE,
+  0xFF, 0xFF, 0xE0, 0x2C, 0x0A, 0x0F, 0x31, 0xE8, 0x0F, 0x06, 0xFE, 0xFC, 0xF3, 0xFE, 0xFB, 0xAE,
+  0x36, 0x03, 0xFE, 0xF8, 0x82, 0x1D, 0xC6, 0x33, 0x32, 0xA6, 0x25, 0xFE, 0xFB, 0x4D, 0x21, 0xFE,
+  0xFD, 0x34, 0x18, 0xA8, 0x04, 0x31, 0xC2, 0x14, 0xFE, 0xF9, 0xC7, 0x21, 0x1B, 0x31, 0xCA, 0x2C,
+  0x0A, 0x2D, 0x35, 0x18, 0x36, 0xFE, 0xFC, 0x30, 0x10, 0x9C, 0xCA, 0x99, 0xFC, 0x03, 0x26, 0x99,
+  0xFC, 0x1D, 0xC5, 0x33, 0xA3, 0x57, 0x3F, 0x1D, 0xC0, 0x22, 0x1D, 0xFE, 0xFC, 0x51, 0x31, 0xDE,
+  0x2C, 0x31, 0xC4, 0x2C, 0x31, 0xE2, 0x0B, 0x32, 0x2A, 0x10, 0x1D, 0xC3, 0x22, 0x15, 0x14, 0xA8,
+  0x04, 0xA7, 0x14, 0xA8, 0x04, 0xA8, 0x04, 0x0B, 0xA6, 0x25, 0x20, 0x31, 0xC9, 0x25, 0x1D, 0xC0,
+  0x37, 0x0A, 0x31, 0xC6, 0x2C, 0x31, 0xCC, 0x20, 0x0A, 0x28, 0x99, 0xFB, 0x99, 0xFC, 0xFE, 0xFB,
+  0xCF, 0xFE, 0xFA, 0x8A, 0xFE, 0xF9, 0x45, 0x1D, 0xC3, 0x22, 0x1D, 0x21, 0xFE, 0xFF, 0xFF, 0xFD,
+  0xCA, 0xFE, 0xFD, 0x14, 0xFE, 0xF9, 0xC7, 0x1D, 0xC3, 0x26, 0xFE, 0xFA, 0xEB, 0xFE, 0xFC, 0xB2,
+  0xFE, 0xFE, 0x38, 0x3E, 0x2C, 0x6E, 0xC8, 0x2C, 0xC3, 0x31, 0x2C, 0x20, 0x31, 0xFE, 0xFD, 0x14,
+  0xFE, 0xF8, 0x00, 0x2E, 0x1D, 0xFE, 0xFA, 0xCB, 0xFE, 0xFF, 0xFF, 0xC3, 0x2C, 0x31, 0xC2, 0x2C,
+  0xC8, 0x31, 0xC9, 0x2D, 0xFE, 0xFD, 0x14, 0x2A, 0x1D, 0xC0, 0x22, 0x1D, 0x21, 0xFE, 0xFF, 0xFF,
+  0xFD, 0xC8, 0x20, 0x07, 0x1D, 0xC2, 0x33, 0xFE, 0xFB, 0x2C, 0x29, 0x20, 0x31, 0xC4, 0x2C, 0xC5,
+  0x31, 0xC9, 0x1C, 0x1D, 0xC0, 0x22, 0x1D, 0x21, 0xFE, 0xF7, 0x3D, 0xA2, 0x57, 0x7F, 0x6E, 0xA2,
+  0x66, 0x31, 0xCA, 0x2C, 0x31, 0xC6, 0x2C, 0xC0, 0x31, 0xC3, 0xFE, 0xFD, 0x55, 0xFE, 0xF8, 0x41,
+  0x22, 0x1D, 0x21, 0x31, 0xD3, 0x2C, 0xC1, 0x31, 0xE7, 0x39, 0x1B, 0x31, 0xC1, 0x2C, 0x31, 0xFE,
+  0xFC, 0x10, 0x1D, 0xC2, 0x2A, 0xFE, 0xFE, 0xBA, 0x31, 0xC2, 0x2C, 0xC0, 0x31, 0xCB, 0x2C, 0x0A,
+  0x39, 0x17, 0x99, 0xFB, 0x99, 0xFC, 0xFE, 0xFB, 0x6D, 0x03, 0x1D, 0xC2, 0x5A, 0x5E, 0xFE, 0xEB,
+  0x88, 0xFE, 0xF6, 0x71, 0xA5, 0x36, 0x9C, 0xBB, 0xFE, 0xED, 0x52, 0x9B, 0xDF, 0xA2, 0x76, 0xA4,
+  0x55, 0x6E, 0x07, 0xC0, 0x13, 0xA3, 0x56, 0x17, 0xA5, 0x35, 0x2C, 0x31, 0xCD, 0x2C, 0xC0, 0x31,
+  0xFE, 0xFC, 0xF3, 0x1D, 0xC0, 0x2D, 0x31, 0xDC, 0x2C, 0x61, 0x0A, 0xC0, 0x3E, 0xC1, 0x39, 0x65,
+  0xCA, 0x39, 0x3E, 0xC0, 0x0A, 0xA3, 0x56, 0x31, 0xC7, 0xFE, 0xFA, 0xAA, 0x2E, 0x15, 0x0B, 0x31,
+  0xC2, 0xFE, 0xFD, 0x34, 0xFE, 0xF8, 0xC3, 0xC0, 0x3B, 0x07, 0x31, 0xC0, 0x2C, 0x31, 0xC4, 0x2C,
+  0x0A, 0x17, 0x9A, 0xEB, 0x02, 0x9A, 0xEB, 0x9A, 0xEB, 0x3F, 0x9C, 0xCA, 0x9B, 0xDB, 0x19, 0x08,
+  0x26, 0x9B, 0xDB, 0x33, 0x9D, 0xBA, 0xC6, 0x4A, 0xFE, 0xEB, 0x25, 0xFE, 0xFF, 0x0D, 0xA7, 0x12,
+  0x65, 0xC0, 0x64, 0xFE, 0xFE, 0x80, 0xFE, 0xF4, 0x40, 0xFE, 0xE1, 0x60, 0xFE, 0xE0, 0x00, 0x17,
+  0x1A, 0x1D, 0xC2, 0x33, 0x26, 0xFE, 0xFA, 0x8A, 0xFE, 0xFC, 0xB2, 0x0A, 0x31, 0xCD, 0x20, 0x15,
+  0x1D, 0x14, 0x31, 0xD1, 0x9D, 0xBA, 0x29, 0x14, 0x1C, 0x9C, 0xCA, 0x9C, 0xCA, 0x2A, 0x9D, 0xBA,
+  0x08, 0x03, 0x32, 0x61, 0x61, 0x33, 0xC0, 0x66, 0xC0, 0x33, 0x2E, 0x22, 0xCA, 0x2E, 0xC0, 0x33,
+  0xC0, 0x15, 0xA4, 0x46, 0xA5, 0x36, 0xFE, 0xFD, 0xB6, 0x31, 0xC3, 0xFE, 0xFE, 0x79, 0x1D, 0xC1,
+  0x1C, 0x31, 0x2C, 0x31, 0xC1, 0x1B, 0xC0, 0x31, 0xC6, 0xFE, 0xFE, 0x38, 0xFE, 0xFB, 0x6D, 0x25,
+  0x26, 0x33, 0x1D, 0xCD, 0x22, 0xC0, 0x1D, 0xC0, 0x1A, 0xA2, 0x56, 0xFE, 0xF5, 0x29, 0xFE, 0xFF,
+  0xEF, 0x69, 0x66, 0xC1, 0xA0, 0x8A, 0xA0, 0x81, 0xFE, 0xFF, 0xE0, 0x62, 0xFE, 0xF5, 0xA0, 0xFE,
+  0xE2, 0x60, 0xFE, 0xE0, 0x20, 0x17, 0x1D, 0xC5, 0x10, 0xFE, 0xFC, 0xD3, 0x31, 0xCD, 0x14, 0x1D,
+  0xFE, 0xFD, 0x75, 0x31, 0xD0, 0xFE, 0xFC, 0xB2, 0xFE, 0xF9, 0x04, 0x1D, 0xE3, 0x0C, 0x31, 0xC3,
+  0x07, 0x1D, 0x2E, 0x1D, 0xFE, 0xFB, 0x0C, 0x31, 0xCC, 0x2C, 0x21, 0x1D, 0xC5, 0x22, 0x1D, 0xC0,
+  0x10, 0xA8, 0x04, 0x2A, 0xA3, 0x57, 0xC0, 0x2A, 0x14, 0x15, 0x1D, 0xC2, 0x1A, 0x5E, 0xFE, 0xF5,
+  0x6A, 0x01, 0x61, 0xC0, 0x35, 0x30, 0x35, 0xC0, 0x69, 0xFE, 0xFF, 0x61, 0x69, 0xA3, 0x55, 0xC0,
+  0xFE, 0xF5, 0xE1, 0xFE, 0xE4, 0xAF, 0x9E, 0xBE, 0x9C, 0xD8, 0x3F, 0x25, 0xFE, 0xF8, 0x82, 0x22,
+  0xC0, 0x1D, 0xC0, 0x20, 0x31, 0xCC, 0xFE, 0xF9, 0xE7, 0x1D, 0xFE, 0xFE, 0x18, 0x31, 0xCF, 0xFE,
+  0xFD, 0xF7, 0x1D, 0xE3, 0x15, 0xFE, 0xFB, 0x4D, 0x3E, 0x31, 0xC1, 0x2C, 0x31, 0xFE, 0xFD, 0x14,
+  0x1D, 0x22, 0x1D, 0xFE, 0xFA, 0xAA, 0xFE, 0xFF, 0xFF, 0xCC, 0x2D, 0x22, 0xC0, 0x1D, 0xC5, 0xA3,
+  0x56, 0xFE, 0xFD, 0x96, 0xFE, 0xFF, 0x7D, 0x31, 0xC4, 0x61, 0xFE, 0xFE, 0xBA, 0xFE, 0xFC, 0x71,
+  0x21, 0x1D, 0x1A, 0xFE, 0xE3, 0x05, 0xFE, 0xF7, 0xEE, 0x9D, 0xCB, 0xA2, 0x66, 0x30, 0x35, 0x6E,
+  0x61, 0xA0, 0x8B, 0x9F, 0x8D, 0x9E, 0xA2, 0x04, 0x66, 0xC0, 0x0E, 0xA1, 0x7A, 0xFE, 0xE7, 0x96,
+  0xA2, 0x6F, 0xA1, 0x97, 0x31, 0xFE, 0xFC, 0xD3, 0x1D, 0xC2, 0x33, 0xFE, 0xFF, 0x3C, 0x31, 0xCB,
+  0x25, 0x1D, 0x3E, 0x31, 0xCF, 0x0A, 0xFE, 0xFB, 0x2C, 0x32, 0x9A, 0xEB, 0x33, 0xC5, 0x3F, 0xC0,
+  0xA2, 0x67, 0x32, 0x65, 0xA3, 0x57, 0xC0, 0x08, 0x14, 0xC0, 0x19, 0x25, 0xC0, 0xA6, 0x25, 0xA2,
+  0x67, 0x65, 0xC0, 0xA3, 0x57, 0x6E, 0xC3, 0xA2, 0x67, 0xA3, 0x57, 0xFE, 0xFD, 0x34, 0xA8, 0x04,
+  0x1B, 0x31, 0xC3, 0x2C, 0x31, 0x20, 0xFE, 0xF8, 0x00, 0x22, 0x1D, 0x0C, 0x31, 0xCC, 0x06, 0x1D,
+  0xC0, 0x14, 0x29, 0x32, 0x1D, 0xC2, 0xA2, 0x67, 0xFE, 0xFE, 0x79, 0x31, 0x2C, 0x31, 0xC6, 0x1B,
+  0x0C, 0x17, 0xFE, 0xDD, 0x09, 0xFE, 0xE7, 0x4D, 0xA1, 0x97, 0x30, 0x01, 0x60, 0xFE, 0xFE, 0xF1,
+  0xA8, 0x0C, 0x31, 0x52, 0x9B, 0xB8, 0xA2, 0x9D, 0x04, 0xC0, 0x66, 0xC0, 0x66, 0x9D, 0x81, 0xA7,
+  0x2A, 0xFE, 0xFE, 0xBA, 0x32, 0x1D, 0xC1, 0x6E, 0x1D, 0xFE, 0xFC, 0x92, 0x31, 0x2C, 0x31, 0xC7,
+  0x2C, 0x31, 0x10, 0x32, 0x31, 0xD2, 0x2C, 0x9D, 0xB9, 0x0A, 0x3E, 0xC3, 0x0A, 0x0F, 0xC0, 0xA2,
+  0x67, 0x31, 0xDC, 0x2C, 0x31, 0xFE, 0xFC, 0xD3, 0x1D, 0x22, 0x1D, 0x0C, 0x31, 0xCC, 0xFE, 0xFD,
+  0xD7, 0x1D, 0xC0, 0xFE, 0xFE, 0x9A, 0x31, 0x2C, 0xFE, 0xFD, 0xB6, 0x32, 0x1D, 0x22, 0x1D, 0xA5,
+  0x35, 0x1C, 0x31, 0x2C, 0x31, 0xC4, 0x61, 0x31, 0xFE, 0xF3, 0x2C, 0xFE, 0xE8, 0x00, 0xFE, 0xDD,
+  0x89, 0xFE, 0xCE, 0x8C, 0xA4, 0x85, 0x35, 0x99, 0xFE, 0xFE, 0xF9, 0xE3, 0xFE, 0xF8, 0x62, 0xFE,
+  0xFA, 0xCB, 0xFE, 0xFD, 0x75, 0xFE, 0xFF, 0x5C, 0x21, 0xFE, 0xF7, 0x8B, 0x3F, 0xC3, 0xA1, 0x7C,
+  0xFE, 0xE4, 0xB2, 0xFE, 0xF0, 0xA2, 0x1D, 0xC4, 0xFE, 0xFA, 0x8A, 0x31, 0xCB, 0x0F, 0x39, 0x31,
+  0xEC, 0x66, 0xC7, 0x31, 0xC5, 0x2C, 0x31, 0xFE, 0xFC, 0x51, 0x1D, 0x22, 0x1D, 0xFE, 0xFB, 0x2C,
+  0x31, 0x2C, 0x31, 0xCA, 0xFE, 0xFD, 0xB6, 0x1D, 0x33, 0xFE, 0xFF, 0x3C, 0x31, 0xC1, 0x1B, 0xFE,
+  0xFA, 0x49, 0x1D, 0x22, 0x1D, 0x04, 0xFE, 0xFD, 0xF7, 0x31, 0xC6, 0xFE, 0xFC, 0xF3, 0xFE, 0xF0,
+  0x00, 0x4E, 0xFE, 0xFE, 0x6A, 0xA1, 0x28, 0x6B, 0xA3, 0x85, 0xFE, 0xF1, 0x22, 0x1D, 0xC2, 0x04,
+  0xFE, 0xEA, 0x4A, 0xFE, 0xED, 0x29, 0xFE, 0xFF, 0x80, 0x3F, 0xC1, 0x66, 0xA5, 0x33, 0xFE, 0xEA,
+  0xC0, 0xFE, 0xE0, 0x00, 0xA1, 0xA7, 0x1D, 0xC1, 0x22, 0x1D, 0x08, 0x31, 0xD4, 0xFE, 0xFC, 0xD3,
+  0x99, 0xFB, 0x31, 0xF3, 0x2C, 0x31, 0x10, 0x1D, 0xA2, 0x67, 0x1D, 0xFE, 0xFB, 0x6D, 0x31, 0x2C,
+  0x31, 0xCA, 0x18, 0x1D, 0x2E, 0xFE, 0xFE, 0xDB, 0x31, 0xC0, 0x2C, 0x31, 0x61, 0xFE, 0xF9, 0x86,
+  0x1D, 0x22, 0x1D, 0x22, 0xFE, 0xFC, 0x51, 0x31, 0xC4, 0x18, 0x22, 0x5A, 0xA2, 0x46, 0xFE, 0xFE,
+  0xAA, 0xA6, 0x14, 0xFE, 0xC6, 0x4B, 0xFE, 0xE2, 0x44, 0x1D, 0x22, 0x1D, 0xC0, 0x22, 0x1D, 0x1A,
+  0xFE, 0xE9, 0x60, 0x09, 0x62, 0xC1, 0x3A, 0xA4, 0x44, 0xFE, 0xF5, 0xE0, 0x14, 0x1A, 0x03, 0x2D,
+  0xFE, 0xFE, 0x9A, 0xFE, 0xFD, 0x75, 0x1D, 0xFE, 0xF9, 0x24, 0xFE, 0xFF, 0xDF, 0x31, 0xD1, 0x2C,
+  0x31, 0xFE, 0xFB, 0xCF, 0x1D, 0xFE, 0xFA, 0x8A, 0x20, 0x31, 0xF3, 0xFE, 0xFA, 0xCB, 0x1D, 0x2E,
+  0x1D, 0x10, 0x31, 0x2C, 0x31, 0xCA, 0x29, 0x1D, 0xC0, 0xFE, 0xFE, 0x18, 0x31, 0xC1, 0x2C, 0x31,
+  0x17, 0x22, 0x1D, 0xC2, 0xFE, 0xF9, 0xE7, 0x29, 0x31, 0xC1, 0xFE, 0xFE, 0xFB, 0x1D, 0xC0, 0x1A,
+  0x14, 0xFE, 0xFE, 0xCB, 0xA8, 0x01, 0xFE, 0xEE, 0x6A, 0xFE, 0xD8, 0x61, 0xFE, 0xF4, 0xD3, 0x17,
+  0xFE, 0xFD, 0x34, 0xFE, 0xFA, 0x49, 0xFE, 0xF8, 0x00, 0x22, 0x1D, 0xA5, 0x13, 0xFE, 0xFE, 0xC0,
+  0xA5, 0x33, 0x3F, 0xC1, 0x04, 0x9C, 0xCC, 0xFE, 0xE3, 0x2A, 0xFE, 0xF5, 0xB7, 0x31, 0xC1, 0xFE,
+  0xFE, 0x9A, 0x1D, 0xA4, 0x46, 0xFE, 0xFF, 0x7D, 0x31, 0xD3, 0xFE, 0xFE, 0x59, 0x22, 0x1D, 0xFE,
+  0xFA, 0x08, 0x20, 0x31, 0xEB, 0x2C, 0xC3, 0x31, 0xC0, 0xFE, 0xF9, 0x04, 0x1D, 0x22, 0x1D, 0xFE,
+  0xFC, 0x30, 0x31, 0x2C, 0x31, 0xCA, 0xFE, 0xFE, 0x38, 0x1D, 0xC0, 0xFE, 0xFC, 0xD3, 0x31, 0x2C,
+  0x31, 0xC0, 0x2C, 0x31, 0xFE, 0xFB, 0x0C, 0x1D, 0x22, 0x1D, 0xC2, 0x03, 0xFE, 0xFB, 0x2C, 0xFE,
+  0xFF, 0xBE, 0x0F, 0xFE, 0xFD, 0xB6, 0xC0, 0x9B, 0xCB, 0xFE, 0xE2, 0xC9, 0xFE, 0xFE, 0xEA, 0xA5,
+  0x35, 0x64, 0xFE, 0xED, 0x8C, 0xFE, 0xE7, 0x5E, 0xA4, 0x65, 0x31, 0xC0, 0xFE, 0xFB, 0xEF, 0xFE,
+  0xF8, 0x00, 0xC0, 0x4A, 0xFE, 0xFE, 0x20, 0x09, 0x9D, 0xBB, 0x6E, 0xC2, 0xFE, 0xE7, 0x78, 0xA3,
+  0x6C, 0x31, 0x2C, 0x31, 0xFE, 0xFD, 0x75, 0x1D, 0xA5, 0x35, 0x1B, 0x31, 0xD4, 0xFE, 0xF9, 0x65,
+  0x1D, 0xC0, 0xFE, 0xFA, 0x69, 0x31, 0xD1, 0x2C, 0xC4, 0x31, 0xD8, 0xFE, 0xFD, 0x34, 0x1D, 0xC0,
+  0x22, 0x1D, 0x36, 0x31, 0x2C, 0x31, 0xCA, 0xFE, 0xFE, 0x9A, 0x22, 0x1D, 0xFE, 0xFB, 0x0C, 0x31,
+  0xC4, 0x24, 0x1D, 0xC3, 0x22, 0x1D, 0xFE, 0xF9, 0xC7, 0x31, 0xC2, 0x5A, 0x9B, 0xB9, 0xFE, 0xFF,
+  0x4B, 0x6E, 0xC0, 0xA2, 0x66, 0xFE, 0xEF, 0x12, 0xFE, 0xE6, 0xFD, 0xA3, 0x65, 0x20, 0x31, 0x03,
+  0x1D, 0x4A, 0xFE, 0xF5, 0x40, 0x0E, 0x3A, 0x3F, 0xC1, 0x3A, 0xFE, 0xE7, 0x14, 0xA5, 0x4E, 0xA1,
+  0x96, 0x20, 0x31, 0xFE, 0xFB, 0xEF, 0x1D, 0xA5, 0x35, 0xFE, 0xFF, 0x9E, 0x31, 0xD2, 0x66, 0x31,
+  0xFE, 0xFC, 0xB2, 0x1D, 0xA2, 0x67, 0x1D, 0xFE, 0xFA, 0xAA, 0x31, 0xC0, 0x2C, 0x31, 0xC1, 0x2C,
+  0x31, 0xD8, 0x2C, 0x0F, 0x66, 0x65, 0x39, 0x65, 0x61, 0x9C, 0xCA, 0x24, 0x61, 0x02, 0x61, 0x99,
+  0xFB, 0x9D, 0xBA, 0x9D, 0xB9, 0x9B, 0xDB, 0xFE, 0xF9, 0xC7, 0x22, 0x1D, 0xC2, 0x24, 0xFE, 0xFF,
+  0xFF, 0xCC, 0x2D, 0x2E, 0x1D, 0xA7, 0x14, 0x20, 0x31, 0xC3, 0x39, 0x2E, 0x1D, 0xC4, 0xFE, 0xF9,
+  0x24, 0x20, 0x31, 0x2C, 0x31, 0x9D, 0xAA, 0x9D, 0xA7, 0xFE, 0xFF, 0x6C, 0x11, 0xC0, 0x66, 0x6D,
+  0xFE, 0xEF, 0x11, 0xFE, 0xE7, 0x1D, 0xA2, 0x76, 0x31, 0xFE, 0xFA, 0xEB, 0xFE, 0xF8, 0x00, 0x1A,
+  0xFE, 0xF4, 0xC0, 0x0E, 0x9C, 0xCC, 0x6E, 0xC0, 0x3A, 0x09, 0xFE, 0xEC, 0x25, 0xFE, 0xED, 0x77,
+  0x31, 0xC0, 0x9C, 0xCA, 0xFE, 0xF9, 0x04, 0x1D, 0xA3, 0x56, 0xFE, 0xFF, 0x5D, 0x31, 0xD4, 0x0F,
+  0xFE, 0xF8, 0xC3, 0x1D, 0x22, 0x1D, 0xFE, 0xFA, 0x8A, 0x0F, 0x31, 0xC6, 0x2C, 0x0F, 0x3E, 0x2D,
+  0x9C, 0xCA, 0x9C, 0xCA, 0x61, 0x61, 0x36, 0x9B, 0xDB, 0x9B, 0xDA, 0x1C, 0x61, 0x65, 0x61, 0x9C,
+  0xCA, 0x9B, 0xDB, 0x19, 0x14, 0xC0, 0x65, 0x03, 0x61, 0x65, 0x9B, 0xDB, 0x33, 0xC0, 0x66, 0x22,
+  0x1D, 0xCD, 0x22, 0x28, 0x31, 0xCC, 0x3E, 0x33, 0x1D, 0xC0, 0x13, 0x31, 0x2C, 0x31, 0x2C, 0x31,
+  0x28, 0x22, 0x1D, 0xC5, 0xFE, 0xFB, 0x2C, 0x31, 0xC0, 0x2C, 0x56, 0x9A, 0xD7, 0xFE, 0xFF, 0x2A,
+  0x11, 0xC0, 0x66, 0xC0, 0x6C, 0xFE, 0xF7, 0x0F, 0xFE, 0xE7, 0x3C, 0x76, 0xFE, 0xF0, 0xC2, 0x1D,
+  0x1A, 0xFE, 0xF4, 0xA0, 0x0E, 0x3A, 0xC2, 0xA5, 0x33, 0xFE, 0xEA, 0xC0, 0x17, 0x3B, 0xFE, 0xFB,
+  0xAE, 0x32, 0x1D, 0xC0, 0xA3, 0x56, 0x3E, 0x31, 0xCA, 0xFE, 0xFC, 0xB2, 0x3E, 0x31, 0xC7, 0xFE,
+  0xFC, 0x10, 0x1D, 0xC2, 0x26, 0xFE, 0xFC, 0x71, 0xFE, 0xFE, 0x18, 0xC0, 0x02, 0x2D, 0xFE, 0xFB,
+  0x0C, 0x25, 0x08, 0x26, 0x3F, 0x61, 0x22, 0x1D, 0xD8, 0x22, 0xC3, 0x2E, 0x22, 0xC2, 0x1D, 0xC0,
+  0x22, 0xC0, 0xA7, 0x15, 0x2C, 0x31, 0xCC, 0x9C, 0xCA, 0x3F, 0x1D, 0xC0, 0x08, 0x31, 0xC3, 0xFE,
+  0xFB, 0x6D, 0x1D, 0xC5, 0x22, 0x1D, 0xFE, 0xFB, 0xEF, 0x31, 0xC0, 0x5A, 0xFE, 0xEC, 0x2E, 0xFE,
+  0xFE, 0x88, 0xA8, 0x03, 0x0C, 0x69, 0xC1, 0x68, 0xA3, 0x4C, 0xFE, 0xE3, 0x4B, 0xFE, 0xE8, 0x01,
+  0xFE, 0xF3, 0x2C, 0xFE, 0xF5, 0xD8, 0xFE, 0xF6, 0xEC, 0x3A, 0xC2, 0x66, 0x0E, 0xFE, 0xEA, 0xC0,
+  0x17, 0x1D, 0xC3, 0xA2, 0x67, 0x39, 0x31, 0xCA, 0xFE, 0xF9, 0xC7, 0xFE, 0xFD, 0x96, 0x31, 0xC7,
+  0x0A, 0xFE, 0xF8, 0x82, 0x1D, 0xCE, 0x22, 0xC0, 0x1D, 0xC6, 0x22, 0xC0, 0x1D, 0xC2, 0x2E, 0x3F,
+  0xC1, 0x33, 0xC0, 0x2E, 0x22, 0x1D, 0xCE, 0xFE, 0xFA, 0xAA, 0x31, 0xCD, 0x2C, 0xFE, 0xF9, 0x04,
+  0x1D, 0xC1, 0xFE, 0xFA, 0x49, 0xFE, 0xFE, 0xBA, 0x20, 0xFE, 0xFD, 0xD7, 0x0C, 0x1D, 0xC0, 0x22,
+  0x26, 0x14, 0x61, 0x33, 0x1D, 0xC2, 0x36, 0xFE, 0xFE, 0x59, 0x02, 0xFE, 0xE8, 0x61, 0xFE, 0xF6,
+  0x49, 0xFE, 0xFF, 0xAB, 0x9D, 0xBA, 0xC3, 0x6D, 0xFE, 0xFE, 0x27, 0xFE, 0xE5, 0xD3, 0xFE, 0xE7,
+  0xDF, 0x7A, 0xFE, 0xEF, 0x2E, 0x35, 0x3A, 0xC1, 0x35, 0x09, 0xFE, 0xEB, 0xE5, 0x17, 0x1D, 0x22,
+  0x1D, 0xC1, 0x22, 0xFE, 0xFE, 0xDB, 0x31, 0xCA, 0xFE, 0xFB, 0xEF, 0xFE, 0xFE, 0x79, 0x31, 0xC8,
+  0xFE, 0xFB, 0xCF, 0x1D, 0x22, 0x1D, 0xC0, 0x22, 0x1D, 0xC0, 0x22, 0xC0, 0x2E, 0x22, 0xC0, 0x1D,
+  0xC5, 0x33, 0x32, 0xA5, 0x35, 0xA5, 0x36, 0xA5, 0x35, 0x9D, 0xBA, 0xFE, 0xF9, 0x86, 0x1D, 0xC3,
+  0x0C, 0xFE, 0xFE, 0xFB, 0x3E, 0x0F, 0xC0, 0x0A, 0x3E, 0x2D, 0x61, 0x06, 0x24, 0x9D, 0xB9, 0x9C,
+  0xCA, 0x99, 0xFC, 0x10, 0x9D, 0xBA, 0x18, 0x9B, 0xDA, 0x19, 0x14, 0x08, 0x14, 0x19, 0xA5, 0x36,
+  0x10, 0xFE, 0xFE, 0xFB, 0x31, 0xCE, 0x03, 0x1D, 0xC2, 0xA2, 0x67, 0xA6, 0x25, 0x1D, 0xC0, 0x2A,
+  0x25, 0x2D, 0x2C, 0x31, 0xC0, 0x3E, 0x25, 0xFE, 0xF8, 0xE3, 0x1D, 0x22, 0x1D, 0xC1, 0x1A, 0xFE,
+  0xF4, 0x04, 0xFE, 0xFF, 0xEB, 0x00, 0x05, 0xC2, 0x00, 0xA2, 0x66, 0x11, 0xFE, 0xEE, 0xF5, 0xFE,
+  0xDE, 0xFF, 0xFE, 0xE6, 0xAD, 0xFE, 0xF6, 0xC0, 0x35, 0x6E, 0xC2, 0xFE, 0xEF, 0x34, 0xFE, 0xED,
+  0xF9, 0x14, 0x1D, 0xC3, 0x06, 0xFE, 0xFF, 0xFF, 0xD6, 0x9B, 0xDB, 0xFE, 0xF8, 0xC3, 0x1D, 0xC9,
+  0x22, 0x10, 0x14, 0x29, 0xFE, 0xFC, 0x30, 0xFE, 0xFD, 0x75, 0x0B, 0x0A, 0x31, 0xC4, 0xFE, 0xFD,
+  0xB6, 0x33, 0x1D, 0x22, 0x1D, 0x18, 0x31, 0xE7, 0x08, 0x1D, 0xC4, 0xFE, 0xF9, 0x24, 0xFE, 0xFD,
+  0xF7, 0x31, 0xC6, 0xFE, 0xFE, 0x9A, 0x33, 0x1D, 0x22, 0x1D, 0x2E, 0xFE, 0xF3, 0x0C, 0xFE, 0xEC,
+  0x4C, 0x05, 0xC4, 0x69, 0x66, 0xC0, 0x69, 0xFE, 0xEE, 0xF4, 0x99, 0xB6, 0xFE, 0xDE, 0x20, 0x28,
+  0x35, 0x3A, 0xC1, 0xFE, 0xE6, 0xF3, 0xA7, 0x2D, 0xA0, 0xA7, 0xFE, 0xFA, 0x8A, 0x1D, 0xC2, 0x18,
+  0x31, 0xD7, 0x0B, 0xFE, 0xF9, 0xA6, 0x2E, 0x1D, 0x22, 0x2E, 0xA3, 0x56, 0x03, 0xA6, 0x25, 0xFE,
+  0xFB, 0x8E, 0xFE, 0xFC, 0xB2, 0x24, 0x2D, 0xA5, 0x36, 0x31, 0xC7, 0x66, 0x31, 0x2C, 0x31, 0xFE,
+  0xFB, 0x2C, 0x1D, 0xC0, 0xA2, 0x67, 0xFE, 0xFF, 0x1C, 0x31, 0xC9, 0x2C, 0xC2, 0x31, 0xC6, 0x2C,
+  0x31, 0xCF, 0x19, 0x1D, 0xC3, 0x2E, 0x2D, 0x31, 0x2C, 0xC0, 0x31, 0xC3, 0x2C, 0x31, 0xFE, 0xF9,
+  0x45, 0x1D, 0xC0, 0x19, 0x17, 0x31, 0x9B, 0xCC, 0xFE, 0xF5, 0xEA, 0xFE, 0xFF, 0x8A, 0x9D, 0xBB,
+  0x05, 0xC0, 0x3E, 0x66, 0xC2, 0x37, 0x9A, 0xBD, 0x98, 0xC9, 0x06, 0x28, 0x35, 0xC0, 0x3A, 0xFE,
+  0xE6, 0xF3, 0xFE, 0xEF, 0x3E, 0x31, 0x0A, 0x22, 0x1D, 0xC1, 0xFE, 0xFD, 0x96, 0x31, 0xD0, 0x66,
+  0x31, 0xC6, 0x2D, 0x1C, 0x6F, 0xA2, 0x67, 0xA3, 0x56, 0x31, 0xC7, 0x2C, 0x31, 0xC6, 0x2C, 0x31,
+  0x14, 0x1D, 0xC0, 0x32, 0x31, 0xE8, 0x36, 0x1D, 0xC3, 0x22, 0xFE, 0xFE, 0x18, 0x31, 0xC1, 0x2C,
+  0x31, 0xC0, 0x2C, 0x31, 0xC0, 0x02, 0x22, 0x1D, 0xFE, 0xFB, 0x8E, 0x31, 0xC0, 0x2C, 0x66, 0xFE,
+  0xF2, 0x87, 0xFE, 0xFE, 0x68, 0xFE, 0xFF, 0x8A, 0x9D, 0xBA, 0x3E, 0x39, 0xC4, 0x3E, 0x9C, 0xBA,
+  0x97, 0xCB, 0xA2, 0x75, 0xA6, 0x52, 0xA2, 0x76, 0x7E, 0xFE, 0xE7, 0x56, 0x26, 0x9C, 0xE9, 0xFE,
+  0xFB, 0x4D, 0x1D, 0x22, 0x1D, 0xC0, 0xFE, 0xFD, 0x34, 0x31, 0xE0, 0x2C, 0xC0, 0x31, 0xCC, 0x2C,
+  0x31, 0xFE, 0xFC, 0x92, 0x1D, 0xC0, 0x0C, 0x31, 0xE6, 0x2C, 0x31, 0xFE, 0xFA, 0xEB, 0xFE, 0xF8,
+  0x00, 0xC4, 0x2E, 0xFE, 0xFB, 0xEF, 0x28, 0x31, 0xC3, 0x2C, 0xFE, 0xFC, 0x71, 0x2E, 0x1D, 0x0B,
+  0x31, 0xC3, 0xFE, 0xF1, 0x26, 0xA3, 0x50, 0xFE, 0xFF, 0x6A, 0x3E, 0x66, 0xC4, 0x69, 0x66, 0x32,
+  0x2D, 0x97, 0xCB, 0x54, 0xA6, 0x62, 0xA4, 0x54, 0xFE, 0xE4, 0x2A, 0xFE, 0xEA, 0x08, 0x22, 0x66,
+  0xC1, 0x22, 0x1D, 0x03, 0xFE, 0xFF, 0xFF, 0x2C, 0x31, 0xCE, 0x03, 0x18, 0x31, 0xDC, 0x2C, 0x31,
+  0xFE, 0xFB, 0xCF, 0x1D, 0xC0, 0x21, 0x31, 0x2C, 0x31, 0xC9, 0x2C, 0x31, 0xD8, 0x2C, 0x31, 0x3A,
+  0x1D, 0x22, 0x1D, 0xC0, 0x2E, 0xC0, 0x1D, 0xC1, 0xFE, 0xF9, 0x45, 0xFE, 0xFB, 0xAE, 0xFE, 0xFD,
+  0xD7, 0xFE, 0xFE, 0xFB, 0xFE, 0xFC, 0xB2, 0x32, 0x1D, 0xC0, 0xA8, 0x04, 0x2C, 0x31, 0xC2, 0x2C,
+  0xFE, 0xF9, 0x44, 0x1A, 0xFE, 0xF3, 0x04, 0xFE, 0xFF, 0x8A, 0x39, 0xC3, 0x69, 0xC1, 0x66, 0x32,
+  0xC0, 0x98, 0xCC, 0x9C, 0xA8, 0xA8, 0x30, 0xFE, 0xD9, 0xA0, 0xFE, 0xE8, 0xA2, 0xFE, 0xFA, 0x08,
+  0xFE, 0xFC, 0x10, 0xFE, 0xFE, 0x38, 0xFE, 0xFB, 0x6D, 0xFE, 0xF8, 0x00, 0xC0, 0x1C, 0x31, 0x66,
+  0x31, 0xCD, 0xFE, 0xFE, 0x79, 0x1D, 0x04, 0xFE, 0xFF, 0x9E, 0x31, 0xDB, 0x2C, 0x31, 0xFE, 0xFB,
+  0x0C, 0x1D, 0xC0, 0x36, 0x31, 0x2C, 0x31, 0xC4, 0x2C, 0x31, 0xC4, 0x3A, 0xA4, 0x46, 0x31, 0xD5,
+  0x2C, 0x31, 0xFE, 0xFB, 0x8E, 0x1D, 0xC0, 0x3B, 0x3A, 0xA7, 0x15, 0xC0, 0x9B, 0xDA, 0xFE, 0xFD,
+  0x75, 0x3F, 0xFE, 0xF8, 0xC3, 0x1D, 0xC0, 0x6E, 0x1D, 0xC0, 0x22, 0x1D, 0xFE, 0xFB, 0x8E, 0x31,
+  0x2C, 0x31, 0xC1, 0x39, 0xFE, 0xF8, 0x41, 0x1D, 0xFE, 0xF3, 0xD0, 0xFE, 0xF7, 0xB5, 0xFE, 0xFF,
+  0x07, 0xA1, 0x79, 0xC0, 0x32, 0xC1, 0x66, 0xC2, 0x26, 0x32, 0x9B, 0xBA, 0x99, 0xBA, 0xFE, 0xD6,
+  0x14, 0xAA, 0x17, 0x31, 0xC1, 0x28, 0x22, 0x1D, 0x0B, 0x31, 0x66, 0x31, 0xCD, 0xFE, 0xFC, 0x51,
+  0x1D, 0xA3, 0x56, 0xFE, 0xFF, 0x1C, 0x31, 0xCC, 0x2C, 0xC0, 0x31, 0xCD, 0xFE, 0xF9, 0x24, 0x1D,
+  0xC0, 0x3A, 0x2C, 0xC0, 0x31, 0xC7, 0x9A, 0xEB, 0xFE, 0xFD, 0xF7, 0xFE, 0xFB, 0xCF, 0xFE, 0xF9,
+  0x45, 0x1D, 0xC0, 0xFE, 0xFB, 0xEF, 0x31, 0xD4, 0x2C, 0x31, 0xFE, 0xFB, 0xAE, 0x1D, 0x2E, 0x39,
+  0x31, 0xC4, 0x2C, 0xFE, 0xFC, 0x30, 0x22, 0x1D, 0x22, 0x1D, 0x22, 0x1D, 0x10, 0x31, 0x2C, 0xC1,
+  0x31, 0x02, 0x1D, 0x2E, 0xFE, 0xFF, 0x5D, 0xA5, 0x15, 0xFE, 0xF7, 0x72, 0x37, 0x63, 0x6D, 0xC0,
+  0x2D, 0xC3, 0x69, 0xC0, 0x32, 0x9C, 0xBA, 0xFE, 0xD6, 0x54, 0xA6, 0x3B, 0xA4, 0x75, 0x7E, 0x31,
+  0xFE, 0xFE, 0xFB, 0x2E, 0x1D, 0xFE, 0xFB, 0x0C, 0x31, 0xCF, 0xFE, 0xFB, 0x6D, 0x1D, 0x33, 0x39,
+  0x31, 0xD6, 0x2C, 0x20, 0x2C, 0x9D, 0xB9, 0x3E, 0x3A, 0xFE, 0xFA, 0xCB, 0x1D, 0xC0, 0x33, 0x2C,
+  0x31, 0xC2, 0x0F, 0x39, 0x3A, 0x02, 0xFE, 0xFC, 0x10, 0xFE, 0xFA, 0xEB, 0xFE, 0xF9, 0x86, 0x33,
+  0x9D, 0xBA, 0xC4, 0x3A, 0x31, 0xD3, 0x2C, 0x31, 0x1C, 0x1D, 0xA6, 0x25, 0x1B, 0x31, 0xC3, 0x2C,
+  0x31, 0xC0, 0xA5, 0x36, 0x1D, 0xC1, 0x22, 0x1D, 0x10, 0x28, 0x31, 0xC1, 0xFE, 0xFE, 0xFB, 0xFE,
+  0xF9, 0x45, 0x1D, 0x22, 0xFE, 0xFD, 0x14, 0x0F, 0xFE, 0xEE, 0x39, 0xFE, 0xF6, 0x2A, 0xFE, 0xFF,
+  0x68, 0x9D, 0xBB, 0x6E, 0x2D, 0xC1, 0x26, 0xC2, 0x66, 0x26, 0x21, 0xFE, 0xE6, 0xD3, 0xA4, 0x5F,
+  0xA3, 0x65, 0xA2, 0x77, 0xFE, 0xFE, 0xBA, 0x22, 0x66, 0x25, 0x31, 0xCF, 0xFE, 0xFB, 0x4D, 0x1D,
+  0x3F, 0x0A, 0x31, 0xCB, 0x0A, 0xFE, 0xFC, 0xD3, 0xFE, 0xFB, 0x8E, 0xFE, 0xFA, 0x8A, 0x9B, 0xDA,
+  0x66, 0x08, 0x03, 0x65, 0xC0, 0x03, 0x9D, 0xB9, 0x61, 0x6F, 0x9D, 0xB9, 0x33, 0x1D, 0xC0, 0x22,
+  0x1D, 0x10, 0xFE, 0xFC, 0xB2, 0x99, 0xFC, 0x29, 0x25, 0x03, 0x10, 0x33, 0x1D, 0xC4, 0x22, 0xC2,
+  0x1D, 0xC0, 0xFE, 0xFD, 0xB6, 0x31, 0xD3, 0x2C, 0x31, 0xFE, 0xFC, 0x71, 0x1D, 0x15, 0xFE, 0xFF,
+  0xBE, 0x31, 0xC5, 0xFE, 0xFB, 0x6D, 0x1D, 0xC5, 0x04, 0x29, 0xA5, 0x35, 0x0C, 0xFE, 0xF8, 0x82,
+  0x1D, 0xC2, 0xA4, 0x45, 0x9D, 0xAA, 0xA4, 0x34, 0xFE, 0xF6, 0x27, 0xFE, 0xFF, 0x89, 0x2D, 0xC1,
+  0x69, 0xC3, 0x66, 0xC0, 0x69, 0x69, 0xFE, 0xF6, 0xF0, 0xFE, 0xEF, 0x3D, 0xA6, 0x34, 0xFE, 0xFC,
+  0x91, 0xFE, 0xF8, 0x00, 0xC0, 0xFE, 0xF9, 0xA6, 0x31, 0xCF, 0xFE, 0xFB, 0x6D, 0x1D, 0xFE, 0xF9,
+  0x86, 0x31, 0xCB, 0x20, 0x37, 0x1D, 0xE3, 0xA2, 0x67, 0x1C, 0x31, 0xD4, 0x2C, 0x31, 0xFE, 0xFC,
+  0x92, 0x1D, 0x15, 0x1B, 0x31, 0xC4, 0x3F, 0x1D, 0x22, 0x1D, 0xC1, 0x08, 0x37, 0x1D, 0xCA, 0x5A,
+  0xFE, 0xE9, 0x01, 0xFE, 0xFE, 0x46, 0xA8, 0x02, 0x2D, 0x26, 0xC3, 0x21, 0xC0, 0x69, 0xC1, 0x64,
+  0xA3, 0x4D, 0xFE, 0xED, 0x31, 0xFE, 0xF0, 0x01, 0x22, 0x1D, 0xFE, 0xF9, 0x45, 0x31, 0xCF, 0xFE,
+  0xFB, 0xEF, 0x1D, 0x29, 0x31, 0xCB, 0x17, 0x1D, 0x22, 0x2E, 0x22, 0xC0, 0x1D, 0xC7, 0x22, 0x33,
+  0xA6, 0x25, 0x19, 0x03, 0x1D, 0xC0, 0xA4, 0x46, 0xA7, 0x14, 0x08, 0x6F, 0x19, 0x2A, 0x6F, 0x2A,
+  0xA5, 0x36, 0xA3, 0x56, 0xC0, 0x0C, 0x2A, 0xC0, 0xA3, 0x57, 0xA8, 0x04, 0xFE, 0xFC, 0xD3, 0xFE,
+  0xFE, 0xFB, 0x31, 0xD5, 0x2C, 0x31, 0xFE, 0xFD, 0x14, 0x1D, 0x3F, 0x0A, 0xA5, 0x35, 0xC0, 0x2C,
+  0x31, 0x9C, 0xCA, 0xFE, 0xFA, 0x69, 0x1D, 0x22, 0x1D, 0xC0, 0x18, 0xFE, 0xFE, 0x79, 0x31, 0xC0,
+  0x17, 0x3A, 0x22, 0x1D, 0x22, 0x1D, 0xC4, 0x22, 0x1D, 0x5A, 0xFE, 0xE9, 0xE4, 0xFE, 0xFF, 0x2A,
+  0x9F, 0x95, 0x6B, 0xC2, 0x66, 0xC0, 0x69, 0xC3, 0x13, 0x9B, 0xDC, 0xFE, 0xEA, 0xC2, 0xFE, 0xE8,
+  0x00, 0x1D, 0x04, 0x0F, 0x31, 0xCE, 0xFE, 0xFD, 0x75, 0x1D, 0xFE, 0xFD, 0x96, 0x31, 0xCB, 0xFE,
+  0xFE, 0x9A, 0x1D, 0xC4, 0xA3, 0x56, 0xA6, 0x25, 0x19, 0x18, 0x10, 0xA6, 0x25, 0x07, 0xA4, 0x46,
+  0x2D, 0x0A, 0xA3, 0x56, 0x31, 0x24, 0x1D, 0xC0, 0xFE, 0xFB, 0x8E, 0x31, 0xE6, 0x2C, 0x31, 0xFE,
+  0xFD, 0x34, 0x1D, 0xC0, 0xFE, 0xFE, 0x79, 0x31, 0xC1, 0xFE, 0xFE, 0x38, 0x26, 0x1D, 0x22, 0x1D,
+  0x37, 0x24, 0x31, 0xC4, 0x3A, 0x32, 0x1D, 0xC6, 0xA6, 0x25, 0x03, 0xFE, 0xF7, 0x1D, 0xA1, 0x64,
+  0xFE, 0xFF, 0x0A, 0xA0, 0x85, 0x21, 0x26, 0x21, 0xC0, 0x1A, 0xC4, 0x66, 0x1F, 0xA2, 0x66, 0xFE,
+  0xF4, 0x83, 0xFE, 0xE8, 0x60, 0x9D, 0xCC, 0x39, 0x31, 0xCE, 0x0F, 0xFE, 0xFB, 0xAE, 0x20, 0x31,
+  0xCB, 0x20, 0xFE, 0xF9, 0x86, 0x9C, 0xCA, 0x18, 0xFE, 0xFC, 0x10, 0x07, 0x0B, 0x0A, 0x2C, 0x31,
+  0xC8, 0x13, 0x1D, 0xC0, 0xFE, 0xFB, 0x8E, 0x31, 0x2C, 0x31, 0xC4, 0x2C, 0xC0, 0x31, 0xC2, 0x2C,
+  0xC0, 0x31, 0xD8, 0x02, 0x1D, 0xC0, 0x2E, 0x2C, 0x39, 0x10, 0x22, 0x1D, 0xC1, 0x0B, 0x20, 0x31,
+  0xC4, 0x2C, 0x31, 0x0F, 0x19, 0x1D, 0xC4, 0xFE, 0xFB, 0x0C, 0x0A, 0x31, 0xC0, 0x9D, 0xAB, 0x9A,
+  0xC3, 0xFE, 0xF6, 0xC5, 0xA2, 0x78, 0x66, 0xC0, 0x1A, 0xC5, 0x65, 0xC0, 0x66, 0xA5, 0x34, 0xFE,
+  0xF5, 0xE4, 0xFE, 0xE9, 0xA1, 0xFE, 0xF6, 0x5A, 0x31, 0x2C, 0x31, 0xDD, 0x20, 0xC0, 0x31, 0xC6,
+  0x2C, 0xC0, 0x31, 0xC2, 0x2C, 0x31, 0x24, 0x1D, 0xC0, 0xFE, 0xFB, 0x4D, 0x31, 0x2C, 0x31, 0xE6,
+  0x13, 0x1D, 0xC1, 0xFE, 0xF9, 0x24, 0x33, 0x1D, 0xC1, 0xA6, 0x25, 0x13, 0x31, 0xC7, 0x2C, 0x31,
+  0x9D, 0xBA, 0x37, 0x1D, 0xC2, 0x3A, 0x31, 0xC0, 0x2C, 0x31, 0xC0, 0x96, 0xF2, 0x98, 0xE1, 0xAA,
+  0x35, 0x6E, 0x1A, 0xC5, 0x0E, 0xC2, 0x09, 0xA3, 0x55, 0x9D, 0xB9, 0xFE, 0xF6, 0x91, 0xFE, 0xF7,
+  0xBF, 0x2C, 0x31, 0xE0, 0x2C, 0x31, 0xCC, 0xFE, 0xFE, 0x18, 0x1D, 0xC0, 0xFE, 0xFB, 0x0C, 0x31,
+  0xE8, 0x07, 0x1D, 0xC5, 0x0C, 0xFE, 0xFF, 0x3C, 0x31, 0xC9, 0x2C, 0x31, 0xFE, 0xFE, 0x38, 0x1D,
+  0xC2, 0x3E, 0x31, 0x2C, 0xC2, 0xFE, 0xF6, 0xE9, 0x98, 0xD7, 0x53, 0xA9, 0x34, 0xA2, 0x76, 0x1A,
+  0xC3, 0x0E, 0xC4, 0x09, 0x0E, 0x68, 0xFE, 0xF6, 0xCC, 0xFE, 0xF7, 0x7C, 0xA3, 0x58, 0x31, 0xEE,
+  0x17, 0x22, 0x1D, 0x0C, 0x31, 0xE8, 0xFE, 0xFD, 0xB6, 0x1D, 0xC3, 0xA8, 0x04, 0xFE, 0xFD, 0x34,
+  0x31, 0xCC, 0x66, 0x31, 0x37, 0x1D, 0x22, 0x1D, 0xFE, 0xFA, 0xCB, 0x3E, 0x31, 0xC2, 0x00, 0x9E,
+  0x97, 0x9B, 0xAD, 0x43, 0x0D, 0x1F, 0x62, 0x1A, 0xC0, 0x0E, 0xC5, 0x69, 0x66, 0xC0, 0x68, 0xA0,
+  0x8C, 0xFE, 0xF7, 0x35, 0x24, 0x2C, 0x31, 0xEC, 0x17, 0x1D, 0xC0, 0x25, 0x31, 0xE8, 0xFE, 0xFD,
+  0xD7, 0x1D, 0xC1, 0x14, 0xFE, 0xFC, 0x71, 0x1B, 0x31, 0xC4, 0x2C, 0xC0, 0x31, 0xC6, 0x20, 0xFE,
+  0xF8, 0xE3, 0x1D, 0xC2, 0x3F, 0xFE, 0xFA, 0x49, 0xFE, 0xFB, 0xAE, 0xA7, 0x15, 0xFE, 0xFD, 0xF1,
+  0xFE, 0xFF, 0x00, 0x62, 0x1E, 0x3C, 0x9D, 0x9B, 0xA9, 0x44, 0x1A, 0x0E, 0xC6, 0x07, 0xC0, 0x02,
+  0xC1, 0x3B, 0x34, 0xFE, 0xF6, 0xCD, 0x05, 0x29, 0x31, 0xEB, 0xFE, 0xFE, 0xFB, 0xFE, 0xF8, 0x41,
+  0x1D, 0x19, 0x31, 0xE8, 0x24, 0x1D, 0xC0, 0x0C, 0x31, 0xCE, 0x9C, 0xCA, 0x28, 0xFE, 0xFD, 0x55,
+  0x25, 0x1D, 0xC7, 0xFE, 0xFB, 0x00, 0xFE, 0xFF, 0x60, 0x2B, 0xC0, 0x1E, 0x3C, 0x9C, 0xAC, 0xA8,
+  0x44, 0x1A, 0x0E, 0xC4, 0x07, 0xC0, 0x66, 0xC4, 0x64, 0x09, 0xFE, 0xF7, 0x34, 0xA4, 0x4F, 0x31,
+  0xEA, 0x2D, 0x2E, 0x1D, 0x14, 0x31, 0xE8, 0xFE, 0xFD, 0xD7, 0x1D, 0xC0, 0xFE, 0xFD, 0x14, 0xFE,
+  0xFF, 0xFF, 0x2C, 0x31, 0xC3, 0x28, 0x13, 0xFE, 0xFC, 0x51, 0x9A, 0xEB, 0x9C, 0xCA, 0x36, 0x19,
+  0x14, 0x37, 0x9A, 0xEB, 0x9C, 0xCA, 0x1D, 0xC9, 0xFE, 0xFD, 0x00, 0xFE, 0xFF, 0x20, 0x2B, 0xC1,
+  0x1E, 0x3C, 0x9C, 0x9C, 0xA7, 0x65, 0xA6, 0x43, 0x0E, 0xC2, 0x07, 0xC0, 0x02, 0xC3, 0x3B, 0xC0,
+  0x02, 0x2F, 0x69, 0xA2, 0x5F, 0xFE, 0xF7, 0x7A, 0xA3, 0x5A, 0x31, 0xE8, 0xFE, 0xFE, 0xFB, 0xFE,
+  0xF8, 0x41, 0x1D, 0x08, 0x31, 0xE8, 0x24, 0x1D, 0xC0, 0x24, 0x31, 0xC3, 0xFE, 0xFD, 0xB6, 0x14,
+  0x2E, 0x1D, 0xC8, 0x22, 0xC0, 0x1D, 0xC3, 0x0C, 0xFE, 0xFB, 0xEF, 0x9C, 0xCA, 0x99, 0xFA, 0xFE,
+  0xFE, 0x40, 0xA5, 0x33, 0x2B, 0xC1, 0x66, 0x1E, 0x9C, 0x9C, 0x9A, 0xBE, 0xA2, 0xA9, 0xFE, 0xFF,
+  0x05, 0x0E, 0x09, 0x07, 0x02, 0xC4, 0x3B, 0xC2, 0x66, 0xC0, 0x28, 0x36, 0xFE, 0xF6, 0xEF, 0xFE,
+  0xF7, 0x9C, 0x31, 0xE7, 0x9A, 0xEB, 0xFE, 0xF8, 0x61, 0x1D, 0xFE, 0xF9, 0x65, 0x31, 0xE8, 0xFE,
+  0xFE, 0x59, 0x1D, 0xC0, 0xFE, 0xFE, 0x38, 0x31, 0xC2, 0x20, 0x33, 0x1D, 0xC2, 0x33, 0x04, 0xA7,
+  0x15, 0x19, 0xC1, 0x03, 0x33, 0x1D, 0xC4, 0x04, 0x31, 0xC1, 0xA0, 0x84, 0x2B, 0xC4, 0x26, 0x1E,
+  0x9D, 0x8B, 0xFE, 0xC1, 0x20, 0xFE, 0xE3, 0x63, 0xFE, 0xFF, 0x45, 0x0E, 0x02, 0xC4, 0x3B, 0xC2,
+  0x36, 0xC2, 0x2F, 0x64, 0xA1, 0x7B, 0xFE, 0xF7, 0x11, 0xFE, 0xF7, 0xBE, 0x31, 0xE5, 0x3E, 0x33,
+  0x9D, 0xBA, 0xFE, 0xF9, 0x45, 0x31, 0xDF, 0x0F, 0x13, 0x31, 0xC5, 0xFE, 0xFE, 0x79, 0x1D, 0xC0,
+  0x3A, 0x31, 0xC3, 0xFE, 0xFE, 0x18, 0xFE, 0xFC, 0xF3, 0x6F, 0x13, 0x3A, 0xA7, 0x15, 0x0F, 0xA4,
+  0x46, 0xC3, 0x3E, 0x25, 0xFE, 0xF9, 0x04, 0x1D, 0xC2, 0x04, 0x0F, 0x2C, 0xC0, 0xFE, 0xFF, 0x52,
+  0x26, 0x2B, 0xC4, 0x26, 0x1E, 0xFE, 0xD1, 0x41, 0xFE, 0xD0, 0x00, 0xFE, 0xE2, 0x40, 0x36, 0x00,
+  0x02, 0xC2, 0x3B, 0xC2, 0x36, 0xC0, 0x2F, 0xC3, 0x28, 0x1C, 0xFE, 0xF7, 0x38, 0x2C, 0x31, 0xE4,
+  0x3E, 0x33, 0x1D, 0xA6, 0x25, 0x1B, 0x31, 0xDE, 0x3F, 0x1D, 0xFE, 0xFC, 0x10, 0x31, 0xC4, 0xFE,
+  0xFE, 0x59, 0x1D, 0xC0, 0x3A, 0x31, 0xD1, 0x9B, 0xDB, 0x19, 0x1D, 0xC1, 0xA2, 0x67, 0x39, 0x31,
+  0xC0, 0xFE, 0xFF, 0x0A, 0x26, 0x2B, 0xC5, 0x9F, 0x8B, 0x9B, 0xA2, 0xFE, 0xE4, 0x92, 0xFE, 0xE2,
+  0xCC, 0xFE, 0xE5, 0xF4, 0xFE, 0xF6, 0xE8, 0x34, 0x02, 0xC0, 0x69, 0xC1, 0x36, 0xC2, 0x2F, 0xC4,
+  0x66, 0xFE, 0xEF, 0x18, 0xA5, 0x4A, 0xA2, 0x76, 0xC3, 0x0F, 0x31, 0xDE, 0x3E, 0x33, 0x1D, 0x33,
+  0x0A, 0x31, 0xDE, 0x08, 0x1D, 0xA4, 0x46, 0x0F, 0x31, 0xC3, 0xFE, 0xFE, 0x59, 0x1D, 0xC0, 0x3A,
+  0x31, 0xC4, 0x2C, 0xC0, 0x31, 0xC8, 0x2C, 0x31, 0x0F, 0x3F, 0x1D, 0xC1, 0x35, 0x31, 0x20, 0x00,
+  0x2B, 0xC6, 0x9F, 0x8E, 0xFE, 0xDF, 0x1C, 0xA6, 0x45, 0x7E, 0x9C, 0xBB, 0x9C, 0xB8, 0xFE, 0xF6,
+  0xAB, 0x34, 0x3B, 0xC1, 0x36, 0xC1, 0x2F, 0xC5, 0x65, 0x2A, 0xFE, 0xE6, 0xF8, 0xA5, 0x5A, 0x31,
+  0xC2, 0x39, 0x04, 0xFE, 0xFC, 0xB2, 0x31, 0xDD, 0x3E, 0x33, 0x9D, 0xBA, 0x33, 0x3E, 0x31, 0xDE,
+  0x19, 0x1D, 0xC0, 0xFE, 0xFC, 0xF3, 0x31, 0x2C, 0x31, 0xC1, 0xFE, 0xFE, 0x79, 0x1D, 0xC0, 0xFE,
+  0xFD, 0xF7, 0x31, 0xCF, 0x2C, 0x31, 0xC0, 0xFE, 0xFE, 0xDB, 0x33, 0x1D, 0x6E, 0x1D, 0xFE, 0xFA,
+  0x89, 0x31, 0x9F, 0x93, 0xFE, 0xFE, 0xA0, 0x2B, 0xC4, 0x26, 0xC0, 0xA0, 0x7F, 0xFE, 0xDE, 0xFC,
+  0xA4, 0x75, 0x20, 0x5A, 0x10, 0x2D, 0xFE, 0xEE, 0xAF, 0x34, 0x2F, 0x36, 0xC1, 0x2F, 0xC4, 0x2A,
+  0xC0, 0x23, 0xA0, 0x7A, 0xFE, 0xE6, 0xFA, 0xA5, 0x57, 0x31, 0xC0, 0x2C, 0x31, 0xFE, 0xFC, 0xB2,
+  0xFE, 0xF8, 0x00, 0x19, 0x31, 0xDD, 0x3E, 0x33, 0x1D, 0xA2, 0x67, 0x39, 0x31, 0xDE, 0xFE, 0xFD,
+  0x55, 0x22, 0x1D, 0xFE, 0xFB, 0x8E, 0x31, 0x2C, 0x31, 0xC1, 0x35, 0x1D, 0xC0, 0xFE, 0xFD, 0xB6,
+  0x31, 0xCC, 0x2C, 0x31, 0xC2, 0x02, 0xFE, 0xF8, 0xE3, 0x1D, 0xC3, 0xFE, 0xFA, 0xAC, 0xFE, 0xFE,
+  0x8D, 0x2B, 0x26, 0xC6, 0xFE, 0xEE, 0xAA, 0xFE, 0xDF, 0x1D, 0xA5, 0x64, 0x31, 0xC0, 0x1D, 0x51,
+  0x9D, 0xAC, 0x9D, 0xB1, 0xFE, 0xFE, 0xA5, 0x6C, 0x9D, 0xBB, 0x2F, 0xC4, 0x2A, 0x23, 0x2A, 0x1C,
+  0xA0, 0x7D, 0xFE, 0xE7, 0x1C, 0x1D, 0xA2, 0x77, 0xC0, 0x2C, 0x31, 0xFE, 0xFC, 0x10, 0x22, 0x08,
+  0x31, 0xDD, 0xFE, 0xFE, 0xFB, 0x2E, 0x61, 0x22, 0xFE, 0xFE, 0xDB, 0x31, 0xDF, 0xFE, 0xFE, 0xBA,
+  0x9A, 0xEB, 0xFE, 0xFF, 0x7D, 0x31, 0xC3, 0xFE, 0xFD, 0xD7, 0x1D, 0xC0, 0xFE, 0xFD, 0x75, 0x31,
+  0xC8, 0x2C, 0x31, 0xC3, 0x28, 0xFE, 0xFC, 0x51, 0x03, 0x1D, 0xC6, 0xFE, 0xFD, 0x20, 0xFE, 0xFF,
+  0x00, 0x9D, 0xBB, 0xC6, 0xFE, 0xEE, 0x8D, 0xFE, 0xE7, 0x1E, 0xA5, 0x53, 0x31, 0xC1, 0x2C, 0x0C,
+  0xA0, 0x6A, 0xFE, 0xDD, 0x93, 0xFE, 0xF5, 0x01, 0xFE, 0xFF, 0x03, 0x2F, 0xC3, 0x66, 0x23, 0xC1,
+  0x69, 0xFE, 0xF6, 0x68, 0xFE, 0xE7, 0x3D, 0x1D, 0x31, 0xC2, 0x24, 0xFE, 0xF8, 0x00, 0xFE, 0xFA,
+  0xCB, 0x31, 0x2C, 0x31, 0xDB, 0x2D, 0x22, 0x1D, 0xC0, 0xFE, 0xFE, 0x79, 0x31, 0xE7, 0x24, 0x1D,
+  0xC0, 0xFE, 0xFD, 0x14, 0xFE, 0xFF, 0xFF, 0x2C, 0x31, 0xC3, 0x2C, 0x31, 0xC2, 0x2C, 0xFE, 0xFE,
+  0x59, 0xFE, 0xFC, 0x30, 0x19, 0x2E, 0x1D, 0xC0, 0x22, 0x1D, 0xC4, 0xA8, 0x00, 0x26, 0xC8, 0xFE,
+  0xE6, 0xF1, 0xFE, 0xE7, 0x5F, 0xA3, 0x74, 0x2C, 0x31, 0xC1, 0x2C, 0x5E, 0xFE, 0xE6, 0x18, 0xFE,
+  0xD8, 0x20, 0xFE, 0xEB, 0xE1, 0xFE, 0xFE, 0xA1, 0x66, 0x2F, 0xC0, 0x2A, 0x23, 0xC2, 0x1C, 0xFE,
+  0xEE, 0x8C, 0xFE, 0xE7, 0x3E, 0x1D, 0x31, 0xC3, 0x32, 0xFE, 0xFE, 0xBA, 0x31, 0xDD, 0xFE, 0xFE,
+  0x9A, 0xFE, 0xF8, 0x00, 0xC1, 0x24, 0x31, 0xE7, 0x24, 0x1D, 0xC0, 0xFE, 0xFC, 0x10, 0x31, 0x66,
+  0x31, 0x2C, 0x31, 0xC3, 0xFE, 0xFE, 0xDB, 0xFE, 0xFD, 0x14, 0xFE, 0xFB, 0x0C, 0xFE, 0xF9, 0x45,
+  0x1D, 0xCB, 0xFE, 0xFA, 0x60, 0x35, 0x9C, 0xCC, 0x26, 0xC5, 0x2B, 0xFE, 0xE5, 0x8D, 0xA7, 0x1F,
+  0xFE, 0xFF, 0xFF, 0xC3, 0x2C, 0xC0, 0x9B, 0xCA, 0xFE, 0xE8, 0xA2, 0x9B, 0xBB, 0xFE, 0xE3, 0xA8,
+  0xFE, 0xF6, 0xE7, 0x9C, 0xD5, 0x2A, 0xC0, 0x23, 0xC2, 0x65, 0xFE, 0xE6, 0xB1, 0xFE, 0xE7, 0x5E,
+  0xA4, 0x74, 0x31, 0xE4, 0xFE, 0xFD, 0xF7, 0xFE, 0xF8, 0x00, 0x22, 0x1D, 0x13, 0x31, 0xE7, 0xFE,
+  0xFD, 0xB6, 0x1D, 0xC0, 0xFE, 0xFB, 0x6D, 0x31, 0x2C, 0x31, 0xC1, 0x1B, 0x24, 0xFE, 0xFB, 0xAE,
+  0xFE, 0xF9, 0xA6, 0xFE, 0xF8, 0x41, 0x1D, 0xC3, 0x2E, 0x33, 0x6F, 0xA5, 0x35, 0x66, 0x3F, 0xC0,
+  0x33, 0x2E, 0x22, 0x1D, 0xFE, 0xFC, 0x20, 0x35, 0x9C, 0xCC, 0x6E, 0xC4, 0x21, 0xA3, 0x55, 0xFE,
+  0xD9, 0x80, 0xFE, 0xE8, 0x41, 0x19, 0x10, 0x13, 0xFE, 0xFF, 0x3C, 0x31, 0xC2, 0xFE, 0xF1, 0xE7,
+  0xFE, 0xE8, 0x00, 0xFE, 0xE2, 0xED, 0xFE, 0xDF, 0x3C, 0xFE, 0xEE, 0x6B, 0x1C, 0x6B, 0x2A, 0x23,
+  0xC1, 0x65, 0xFE, 0xE6, 0xB5, 0xA6, 0x3B, 0x25, 0x31, 0xC3, 0x2C, 0x31, 0xDE, 0x07, 0x1D, 0x6E,
+  0x1D, 0xFE, 0xFD, 0x34, 0x31, 0x2C, 0x31, 0xE5, 0x13, 0x1D, 0xC0, 0x08, 0x31, 0xC0, 0x3E, 0xFE,
+  0xFD, 0x14, 0xFE, 0xFA, 0xCB, 0x15, 0x1D, 0xC3, 0xFE, 0xF9, 0x45, 0xFE, 0xFB, 0x0C, 0xFE, 0xFC,
+  0xB2, 0xFE, 0xFE, 0x18, 0xA7, 0x14, 0xA3, 0x57, 0x6E, 0x2C, 0xC0, 0x0F, 0xC0, 0x3E, 0x66, 0x9D,
+  0xB9, 0x9A, 0xEC, 0xFE, 0xFE, 0x44, 0x26, 0xC7, 0x21, 0xFE, 0xD8, 0xE0, 0xFE, 0xE8, 0x00, 0x1D,
+  0xC1, 0xA3, 0x56, 0xFE, 0xF9, 0xC7, 0xFE, 0xFB, 0x6D, 0x31, 0x35, 0x37, 0x1D, 0xFE, 0xF2, 0xCA,
+  0xFE, 0xE7, 0xBE, 0x99, 0xED, 0x9E, 0xB1, 0xFE, 0xF6, 0x64, 0xA0, 0x94, 0x6B, 0xC0, 0x1C, 0x9F,
+  0x8B, 0xFE, 0xE6, 0xF9, 0x10, 0x2C, 0x6E, 0xE2, 0x2C, 0x31, 0xFE, 0xFC, 0x71, 0xFE, 0xF8, 0x00,
+  0x2E, 0x1D, 0x03, 0x31, 0x2C, 0x31, 0xE5, 0xFE, 0xFD, 0x55, 0x1D, 0xC1, 0xFE, 0xFB, 0x4D, 0x9B,
+  0xDA, 0x33, 0x1D, 0xC3, 0xFE, 0xF9, 0x24, 0xFE, 0xFB, 0x8E, 0xFE, 0xFE, 0x18, 0x2C, 0x31, 0xCB,
+  0x68, 0xFE, 0xFE, 0xA1, 0x21, 0x6E, 0xC4, 0x21, 0x26, 0x53, 0xFE, 0xDA, 0x26, 0xFE, 0xE8, 0xA2,
+  0x1D, 0xC8, 0xFE, 0xFA, 0x28, 0xFE, 0xF7, 0xFF, 0x9B, 0xCA, 0x43, 0x9D, 0xB7, 0xFE, 0xEE, 0x6A,
+  0xFE, 0xFE, 0x60, 0xC1, 0xA0, 0x7E, 0xFE, 0xE7, 0x1C, 0xA4, 0x66, 0x31, 0xE3, 0x2C, 0x31, 0x29,
+  0x1D, 0xA2, 0x67, 0x1D, 0xFE, 0xFB, 0xAE, 0x31, 0x2C, 0x31, 0xE3, 0x2C, 0x31, 0xFE, 0xFD, 0x14,
+  0x1D, 0xC4, 0x6E, 0x1D, 0xC0, 0xFE, 0xFA, 0x49, 0x07, 0xFE, 0xFF, 0xBE, 0xA2, 0x67, 0xC2, 0x2C,
+  0x31, 0xC9, 0x9B, 0xD3, 0x21, 0x26, 0x21, 0xC6, 0xA0, 0x7D, 0xFE, 0xDF, 0x1C, 0xA0, 0xB8, 0xFE,
+  0xFD, 0xF7, 0xFE, 0xFB, 0xCF, 0xFE, 0xF9, 0x86, 0x1D, 0xC1, 0x22, 0x1D, 0x22, 0x1D, 0x19, 0x31,
+  0x51, 0x51, 0x51, 0x9D, 0x9B, 0x9E, 0xB1, 0xFE, 0xF6, 0x65, 0x9F, 0xA4, 0xFE, 0xEE, 0x6B, 0xFE,
+  0xE7, 0x3E, 0x1D, 0x31, 0xE5, 0xFE, 0xF9, 0x24, 0xFE, 0xF8, 0x00, 0x22, 0x1D, 0xFE, 0xFB, 0x2C,
+  0x31, 0x2C, 0x31, 0xE3, 0x2C, 0x31, 0xFE, 0xFC, 0x71, 0x1D, 0x22, 0x1D, 0x22, 0xC0, 0x1D, 0xC0,
+  0xFE, 0xFA, 0x69, 0xFE, 0xFE, 0x18, 0x31, 0xC1, 0x2C, 0x31, 0xCD, 0xFE, 0xFF, 0x2E, 0x21, 0x6E,
+  0x21, 0xC6, 0xA0, 0x7F, 0xFE, 0xDE, 0xFC, 0xA6, 0x54, 0x31, 0xC1, 0xFE, 0xFE, 0x38, 0xFE, 0xFB,
+  0x4D, 0x33, 0x9D, 0xBA, 0xC0, 0x22, 0x1D, 0x08, 0x31, 0xC0, 0x2C, 0x18, 0x3D, 0x9D, 0x9C, 0x9E,
+  0x97, 0x9E, 0xC0, 0xA2, 0x6A, 0xA5, 0x3D, 0xA3, 0x75, 0x31, 0xC7, 0x2C, 0xC5, 0x31, 0xD2, 0x2C,
+  0x31, 0x24, 0xFE, 0xF8, 0x00, 0xC0, 0x22, 0x1D, 0xFE, 0xFA, 0x49, 0x31, 0xCA, 0x2C, 0xCD, 0x31,
+  0x2C, 0x31, 0xC8, 0x2C, 0x31, 0xFE, 0xFB, 0xEF, 0x1D, 0x22, 0x1D, 0xC1, 0x37, 0xFE, 0xFD, 0xB6,
+  0x31, 0xD3, 0xFE, 0xFE, 0xC8, 0x9E, 0xA2, 0xC8, 0xFE, 0xEE, 0x8B, 0x34, 0xA4, 0x74, 0x2C, 0xC0,
+  0x31, 0xC1, 0xFE, 0xFE, 0xFB, 0x2E, 0x1D, 0xC1, 0x33, 0x0A, 0x31, 0xC0, 0x2C, 0x55, 0x09, 0x30,
+  0x2F, 0x6D, 0x09, 0x2C, 0x31, 0xE3, 0xFE, 0xFE, 0xFB, 0xFE, 0xF9, 0x24, 0xFE, 0xF8, 0x00, 0xC2,
+  0x15, 0xFE, 0xFD, 0xF7, 0x2D, 0xA2, 0x67, 0xA2, 0x67, 0x2C, 0x31, 0xE0, 0x2C, 0x31, 0x0B, 0x1D,
+  0x22, 0x1D, 0xC0, 0x10, 0xFE, 0xFF, 0xBE, 0x31, 0xD3, 0x2C, 0xFE, 0xFE, 0xA5, 0x21, 0xC8, 0xFE,
+  0xEE, 0x8D, 0xFE, 0xDF, 0x1E, 0xA5, 0x63, 0x31, 0xC5, 0x13, 0xFE, 0xF8, 0x82, 0x9C, 0xCA, 0xC0,
+  0x02, 0x31, 0x2C, 0x31, 0xC0, 0x2C, 0x51, 0x55, 0xC0, 0xA2, 0x77, 0x2C, 0x31, 0xC4, 0x29, 0xFE,
+  0xFA, 0x69, 0xA4, 0x46, 0x3A, 0x6E, 0x10, 0x6F, 0xA3, 0x56, 0xA5, 0x36, 0xA2, 0x67, 0x02, 0x13,
+  0x6E, 0x29, 0xA4, 0x46, 0xA2, 0x67, 0x2D, 0x39, 0x3E, 0x0A, 0x0F, 0xA2, 0x67, 0x2C, 0xC3, 0x1B,
+  0x3E, 0xFE, 0xFE, 0x38, 0xFE, 0xFC, 0x10, 0x04, 0x9B, 0xDB, 0xC5, 0x22, 0x33, 0x04, 0xA3, 0x57,
+  0x37, 0xA2, 0x67, 0x14, 0x19, 0x2A, 0xA5, 0x36, 0xC0, 0x2E, 0x6F, 0xC0, 0x10, 0xC0, 0x66, 0xA2,
+  0x67, 0x6E, 0xC1, 0xA3, 0x57, 0xA4, 0x46, 0x65, 0xC0, 0x31, 0x02, 0x65, 0x02, 0x13, 0x6E, 0x24,
+  0xC0, 0xA7, 0x14, 0xFE, 0xFF, 0xFF, 0xC4, 0x0C, 0x1D, 0xC0, 0x04, 0x13, 0x31, 0xD5, 0x2C, 0xFE,
+  0xFE, 0xA4, 0x9F, 0x95, 0xC8, 0xFE, 0xE6, 0x91, 0xFE, 0xE7, 0x3E, 0xA4, 0x64, 0x31, 0xC4, 0x2C,
+  0x31, 0xFE, 0xFE, 0x79, 0xFE, 0xF8, 0x82, 0x9C, 0xCA, 0xFE, 0xFA, 0x08, 0x31, 0xC3, 0x2C, 0xC2,
+  0x31, 0xC5, 0x36, 0x1D, 0xCC, 0x22, 0x6F, 0x33, 0xC0, 0x3F, 0xC0, 0xA4, 0x46, 0xA2, 0x67, 0xC3,
+  0x04, 0x33, 0x1D, 0xC1, 0x22, 0x1D, 0xC3, 0x22, 0x1D, 0xDF, 0x24, 0x31, 0xC4, 0x08, 0x1D, 0x15,
+  0xFE, 0xFE, 0x9A, 0x31, 0x2C, 0x31, 0xD4, 0x2C, 0x99, 0xE1, 0xFE, 0xFE, 0x60, 0x6E, 0xC6, 0x1C,
+  0xFE, 0xE6, 0xB3, 0x03, 0xA5, 0x63, 0x31, 0xC5, 0x2C, 0x31, 0x07, 0x1D, 0xC0, 0x13, 0x31, 0xCD,
+  0x07, 0x1D, 0x6E, 0xC1, 0x2E, 0xC0, 0x22, 0xC0, 0x1D, 0xF9, 0x33, 0xA5, 0x36, 0xFE, 0xFA, 0x49,
+  0xFE, 0xFD, 0xD7, 0x31, 0xC4, 0x0A, 0x33, 0x2E, 0x0B, 0x31, 0x2C, 0x31, 0xD5, 0x2C, 0x9C, 0xAB,
+  0xFE, 0xEE, 0x8A, 0xFE, 0xFE, 0x80, 0xC6, 0x1C, 0xFE, 0xDE, 0xB6, 0xA5, 0x4B, 0x25, 0x31, 0xC6,
+  0x2C, 0x31, 0x36, 0x1D, 0x32, 0xFE, 0xFF, 0xBE, 0x31, 0xCC, 0x07, 0x1D, 0x22, 0x1D, 0xC5, 0x22,
+  0x2E, 0x33, 0x3F, 0xC0, 0xA4, 0x46, 0x32, 0x26, 0x37, 0xA2, 0x67, 0x66, 0x08, 0xC1, 0x19, 0xC1,
+  0x66, 0xD0, 0x19, 0x6F, 0xC5, 0x0C, 0xA3, 0x57, 0xC1, 0x3A, 0x6E, 0xC0, 0x10, 0x6F, 0x6E, 0xA4,
+  0x46, 0xA5, 0x36, 0x07, 0x18, 0xA6, 0x25, 0x39, 0x20, 0xA2, 0x67, 0xC6, 0x24, 0x1D, 0x13, 0x31,
+  0x2C, 0x31, 0xD6, 0x2C, 0x9C, 0xAA, 0x9C, 0xAB, 0xFE, 0xEE, 0x69, 0xFE, 0xFE, 0x80, 0x66, 0xC4,
+  0x6B, 0xFE, 0xDE, 0xB8, 0xA5, 0x59, 0x2C, 0x31, 0xC8, 0x24, 0x1D, 0xC0, 0xFE, 0xFD, 0x55, 0x31,
+  0x2C, 0x31, 0xCA, 0x18, 0x1D, 0xC0, 0xA7, 0x14, 0xFE, 0xFA, 0x8A, 0xFE, 0xFB, 0xCF, 0xFE, 0xFC,
+  0xF3, 0x13, 0xA3, 0x56, 0x17, 0xA3, 0x56, 0x39, 0x6E, 0xA2, 0x67, 0xC0, 0x20, 0x31, 0x2C, 0x31,
+  0xF8, 0x2C, 0x31, 0x3F, 0x1C, 0x31, 0x2C, 0x31, 0xD8, 0x9D, 0xAA, 0x30, 0x9D, 0x9A, 0xFE, 0xEE,
+  0x6B, 0xFE, 0xFE, 0x60, 0xC4, 0xA0, 0x7B, 0xFE, 0xDE, 0xDA, 0x09, 0x2C, 0x31, 0xC8, 0x20, 0xFE,
+  0xF9, 0x04, 0x1D, 0x3B, 0x31, 0xCC, 0x29, 0x22, 0xFE, 0xFC, 0x10, 0x1B, 0x31, 0xF3, 0x2C, 0xC6,
+  0x31, 0xCA, 0x2C, 0xFE, 0xFD, 0x75, 0x31, 0xDB, 0x2C, 0x09, 0x30, 0x9D, 0x9B, 0xFE, 0xE6, 0x6D,
+  0x1C, 0xC3, 0x3C, 0xFE, 0xDE, 0xDC, 0x09, 0x31, 0xC8, 0x2C, 0x31, 0x19, 0x1D, 0xA6, 0x25, 0xFE,
+  0xFF, 0x9E, 0x31, 0xCB, 0x20, 0xFE, 0xFE, 0xBA, 0x31, 0xC1, 0x2C, 0xC0, 0x31, 0xDA, 0x2C, 0xC2,
+  0x31, 0xD8, 0x2C, 0x31, 0xC8, 0x2C, 0x31, 0xDE, 0x2C, 0x18, 0x9D, 0x99, 0x9C, 0xAC, 0xFE, 0xE6,
+  0x70, 0xFE, 0xFE, 0x60, 0xC2, 0xFE, 0xEE, 0x68, 0x2F, 0x11, 0x31, 0xC9, 0x39, 0x10, 0x1D, 0xA2,
+  0x67, 0xFE, 0xFE, 0xDB, 0x31, 0xFD, 0xD0, 0x2C, 0x0A, 0x39, 0xC1, 0x3E, 0xA3, 0x57, 0x31, 0xE2,
+  0x2C, 0x18, 0x35, 0x9D, 0x9C, 0x9D, 0xC2, 0xFE, 0xFE, 0x62, 0x68, 0xC0, 0xFE, 0xEE, 0x6B, 0x2F,
+  0x11, 0x31, 0xC7, 0x39, 0x25, 0xFE, 0xF8, 0xE3, 0x1D, 0xC1, 0x3E, 0x31, 0xED, 0x39, 0xFE, 0xFC,
+  0xB2, 0x3F, 0x61, 0xFE, 0xFD, 0x14, 0xFE, 0xFF, 0xFF, 0xD7, 0x29, 0xFE, 0xFA, 0xCB, 0x08, 0x15,
+  0x33, 0xC3, 0xA2, 0x67, 0x32, 0xA6, 0x25, 0x2D, 0x1B, 0xC0, 0xFE, 0xFE, 0x38, 0x9C, 0xCA, 0xA3,
+  0x57, 0x28, 0x0F, 0x31, 0xD9, 0x2C, 0x55, 0x3D, 0x9C, 0x9C, 0x9D, 0xB6, 0xFE, 0xF6, 0x64, 0x1C,
+  0xFE, 0xE6, 0x6E, 0xFE, 0xDF, 0x1E, 0x1D, 0x31, 0xC6, 0xFE, 0xFC, 0xF3, 0xFE, 0xFA, 0x28, 0x10,
+  0x21, 0x32, 0xA2, 0x67, 0x14, 0x31, 0xCF, 0x39, 0xFE, 0xFB, 0x2C, 0x36, 0xFE, 0xFB, 0xCF, 0x1B,
+  0x31, 0xD7, 0xFE, 0xFB, 0xEF, 0x33, 0x9D, 0xBA, 0xC2, 0x02, 0x31, 0xD6, 0x02, 0x08, 0xFE, 0xF8,
+  0x82, 0x1D, 0xC5, 0x22, 0xA7, 0x15, 0xFE, 0xFA, 0xCB, 0x1B, 0xFE, 0xFD, 0xB6, 0x15, 0x1D, 0xC1,
+  0x22, 0x03, 0x2E, 0xFE, 0xFE, 0x79, 0x31, 0xD8, 0x51, 0x9C, 0xBA, 0x20, 0x9D, 0xB7, 0xFE, 0xFE,
+  0x42, 0xFE, 0xE6, 0x90, 0xFE, 0xE7, 0x3E, 0x1D, 0x31, 0xC7, 0x2C, 0x31, 0xC0, 0x2C, 0x31, 0xD1,
+  0x61, 0x28, 0x65, 0xA2, 0x67, 0x31, 0xD8, 0xFE, 0xFA, 0xCB, 0xFE, 0xF8, 0x00, 0xC3, 0x14, 0x31,
+  0xD8, 0x20, 0x3E, 0x17, 0x9C, 0xCA, 0x24, 0xC0, 0x06, 0x28, 0x0F, 0x31, 0xC2, 0x20, 0x2D, 0x3A,
+  0x24, 0xC0, 0x3A, 0x0B, 0x0F, 0x31, 0xD9, 0x9D, 0xAA, 0x9D, 0x99, 0x9C, 0xAC, 0x9E, 0xB1, 0x7E,
+  0x03, 0x20, 0x31, 0xFD, 0x1C, 0x07, 0x9D, 0xBA, 0x02, 0x17, 0xFE, 0xFF, 0xFF, 0xFD, 0xCB, 0x2C,
+  0x18, 0x30, 0x0D, 0x7A, 0xA5, 0x56, 0x2C, 0x31, 0xFD, 0xFD, 0xD2, 0x2C, 0x09, 0x9C, 0xAA, 0xC0,
+  0x04, 0x2C, 0x31, 0xFD, 0xC1, 0x2C, 0x31, 0xFD, 0xCF, 0x51, 0x04, 0x35, 0x09, 0x2C, 0x31, 0xFD,
+  0xFD, 0xD4, 0x1D, 0x09, 0x1D, 0x31, 0xD9,
+};
+
+constexpr int kAssetIcon1 = 0;
+constexpr int kAssetIcon2 = 1;
+constexpr int kAssetIcon3 = 2;
+constexpr int kAssetIcon4 = 3;
+constexpr int kAssetIcon5 = 4;
+constexpr int kAssetIcon6 = 5;
+constexpr int kAssetIcon7 = 6;
+constexpr int kAssetIcon8 = 7;
+constexpr int kAssetLogo = 8;
+constexpr int kAssetCount = 9;
+
+const CompressedImage kAssets[kAssetCount] = {
+  {100, 100, kAssetFormatQoi, 3593, kAssetIcon1Data},
+  {100, 100, kAssetFormatQoi, 3015, kAssetIcon2Data},
+  {100, 100, kAssetFormatQoi, 3037, kAssetIcon3Data},
+  {100, 100, kAssetFormatQoi, 4545, kAssetIcon4Data},
+  {100, 100, kAssetFormatQoi, 5773, kAssetIcon5Data},
+  {100, 100, kAssetFormatQoi, 3543, kAssetIcon6Data},
+  {100, 100, kAssetFormatQoi, 2143, kAssetIcon7Data},
+  {100, 100, kAssetFormatQoi, 3476, kAssetIcon8Data},
+  {150, 150, kAssetFormatQoi, 13767, kAssetLogoData},
+};
@@ -1,308 +0,0 @@
-#pragma once
-#include <Arduino.h>
-
-constexpr int kIcon1Width = 60;
-constexpr int kIcon1Height = 60;
-
-const uint16_t kIcon1Data[3600] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20C1, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x20C1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3963, 0xBC2A, 0xC48B, 0xB40A, 0x3142, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3142, 0xB40A, 0xC48B, 0xB42A, 0x3963, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xB40A, 0xCCAB, 0xBC6A, 0xCCAB, 0xBC4A, 0x1881, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1881, 0xBC4A, 0xCCAB, 0xBC6A, 0xCCAB, 0xB40A, 0x0820, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1881, 0xBC4A, 0xC46B, 0xC46B, 0xBC4A, 0xCCAB, 0x9BA9, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x9BA9, 0xCCAB, 0xBC4A, 0xC46B, 0xC46B, 0xBC4A, 0x1881, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xAC0A, 0xCC8B, 0xBC6B, 0xC46B, 0xBC4A, 0xCCCC, 0x7AC6, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x7AC6, 0xCCCC, 0xBC4A, 0xC46B, 0xBC6B, 0xCC8B, 0xAC0A, 0x0820, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3143, 0xC48B, 0xC48B, 0xBC6B, 0xC46B, 0xBC6B, 0xD4CB, 0x51E4,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x51E4, 0xD4CB, 0xBC6B, 0xC46B, 0xBC6B, 0xC48B, 0xC48B, 0x3143, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3943, 0xC48B, 0xC48B, 0xBC6B, 0xC46B, 0xC46B, 0xC48B,
-  0x2902, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2902,
-  0xC48B, 0xC46B, 0xC46B, 0xBC6B, 0xC48B, 0xC48B, 0x3943, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3943, 0xC48B, 0xC48B, 0xBC6B, 0xBC6B, 0xC48B,
-  0xB40A, 0x1061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0xB40A,
-  0xC48B, 0xBC6B, 0xBC6B, 0xC48B, 0xC48B, 0x3943, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3943, 0xC48B, 0xC48B, 0xBC6B, 0xBC6B,
-  0xCCAB, 0x9368, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9368, 0xCCAB,
-  0xBC6B, 0xBC6B, 0xC48B, 0xC48B, 0x3943, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3943, 0xC48B, 0xC48B, 0xBC6B,
-  0xBC6A, 0xD4CC, 0x6A66, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6A66, 0xCCCC, 0xBC6A,
-  0xBC6B, 0xC48B, 0xC48B, 0x3943, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3943, 0xC48B, 0xC48B,
-  0xBC6B, 0xBC6B, 0xCCCB, 0x4183, 0x0000, 0x0000, 0x0000, 0x0000, 0x4183, 0xCCCB, 0xBC6B, 0xBC6B,
-  0xC48B, 0xC48B, 0x3943, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3943, 0xC48B,
-  0xC48B, 0xBC6B, 0xC46B, 0xC46B, 0x20C2, 0x0000, 0x0000, 0x20E2, 0xC46B, 0xC46B, 0xBC6B, 0xC48B,
-  0xC48B, 0x3943, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3122,
-  0xC46A, 0xC46B, 0xBC4A, 0xCC8B, 0xABC9, 0x0000, 0x0020, 0xA3C9, 0xCC8B, 0xBC4A, 0xC46B, 0xC46A,
-  0x3122, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x0841,
-  0x49C5, 0xC4AC, 0xC4AC, 0xC48B, 0xD4EC, 0x8328, 0x8328, 0xD4EC, 0xC48B, 0xC4AC, 0xC4AC, 0x49C4,
-  0x0841, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x39A6, 0xBD73, 0xEE97, 0xEE97, 0xEE97, 0xEE97, 0xEE97, 0xEE97, 0xEE97, 0xEE97, 0xEE97,
-  0xE677, 0xF6D8, 0xFEF8, 0xF6F8, 0xF6D8, 0xFF18, 0xFF18, 0xF6D8, 0xF6F8, 0xFEF8, 0xF6D8, 0xE677,
-  0xEE97, 0xEE97, 0xEE97, 0xEE97, 0xEE97, 0xEE97, 0xEE97, 0xEE97, 0xEE97, 0xBD73, 0x39A6, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3144, 0xF719, 0xFF7A, 0xFF19, 0xFF19, 0xFF19, 0xFF19, 0xFF19, 0xFF19, 0xFF19, 0xFF19, 0xFF19,
-  0xFF39, 0xFF19, 0xFF19, 0xFF19, 0xFF19, 0xFEF9, 0xFEF9, 0xFF19, 0xFF19, 0xFF19, 0xFF19, 0xFF39,
-  0xFF19, 0xFF19, 0xFF19, 0xFF19, 0xFF19, 0xFF19, 0xFF19, 0xFF19, 0xFF19, 0xFF7A, 0xF6F9, 0x2944,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-  0xA4F1, 0xFFDC, 0xF719, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A,
-  0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A,
-  0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF5A, 0xF719, 0xFFDC, 0xA4F1,
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041,
-  0xD4D0, 0xF5F5, 0xEDB4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4,
-  0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4,
-  0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xF5B4, 0xEDB4, 0xF5F5, 0xCCB0,
-  0x2040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x48A2, 0xDA06,
-  0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5,
-  0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5,
-  0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xD1C5, 0xC9A5,
-  0xB985, 0x4081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9164, 0xE206,
-  0xC9E6, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206,
-  0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206,
-  0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xC9E6,
-  0xC185, 0x8103, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8944, 0xE227,
-  0xD1E6, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206,
-  0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206,
-  0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xC1A5,
-  0xB985, 0x78E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8924, 0xC9C6,
-  0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5,
-  0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5,
-  0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xC1C5, 0xB185,
-  0xC185, 0x8103, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x50A2, 0xC185,
-  0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904,
-  0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904,
-  0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904, 0xA904,
-  0xC185, 0x50A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x40C2,
-  0xDC89, 0xE4A9, 0xE4A9, 0xDCA9, 0xDC89, 0xDC89, 0xE4A9, 0xE4A9, 0xE4A9, 0xE4A9, 0xE4A9, 0xE4A9,
-  0xE4A9, 0xE4A9, 0xE4A9, 0xE4A9, 0xDCA9, 0xDC89, 0xDC89, 0xDCA9, 0xE4A9, 0xE4A9, 0xE4A9, 0xE4A9,
-  0xE4A9, 0xE4A9, 0xE4A9, 0xE4A9, 0xE4A9, 0xE4A9, 0xDC89, 0xDC89, 0xDCA9, 0xE4A9, 0xE4A9, 0xDC89,
-  0x40C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8386,
-  0xFF4E, 0xFECD, 0xFEED, 0xFF0D, 0xFF2D, 0xFF2D, 0xFF0D, 0xFEED, 0xFEED, 0xFEED, 0xFEED, 0xFEED,
-  0xFEED, 0xFEED, 0xFEED, 0xFEED, 0xFF0D, 0xFF2D, 0xFF2D, 0xFF0D, 0xFEED, 0xFEED, 0xFEED, 0xFEED,
-  0xFEED, 0xFEED, 0xFEED, 0xFEED, 0xFEED, 0xFF0D, 0xFF2D, 0xFF2D, 0xFF0D, 0xFEED, 0xFECD, 0xFF4E,
-  0x8386, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2902, 0xFEAD,
-  0xFE8D, 0xF66C, 0xFEAC, 0xED8B, 0xC2C7, 0xCB47, 0xF62C, 0xFE8C, 0xFE6C, 0xFE8C, 0xFE8C, 0xFE8C,
-  0xFE8C, 0xFE8C, 0xF66C, 0xFEAC, 0xF5EB, 0xCB07, 0xCB07, 0xF5EB, 0xFEAC, 0xF66C, 0xFE8C, 0xFE8C,
-  0xFE8C, 0xFE8C, 0xFE8C, 0xFE6C, 0xFE8C, 0xF62C, 0xCB47, 0xC2C7, 0xED8B, 0xFEAC, 0xF66C, 0xFE8D,
-  0xFEAD, 0x2902, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9B85, 0xFE2A,
-  0xF62B, 0xFEAD, 0xFE8C, 0xBA26, 0xB104, 0xA8E4, 0xCB67, 0xFEED, 0xFE8C, 0xF62B, 0xF5C9, 0xF5A9,
-  0xF5C9, 0xF62B, 0xFE8C, 0xFECD, 0xC2C6, 0xA8E4, 0xA8E4, 0xC2C6, 0xFECD, 0xFE8C, 0xF62B, 0xF5C9,
-  0xF5A9, 0xF5C9, 0xF62B, 0xFE8C, 0xFEED, 0xCB67, 0xA8E4, 0xB104, 0xBA26, 0xFE8C, 0xFEAD, 0xF62B,
-  0xFE2A, 0x9B85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20C1, 0xF568, 0xF568,
-  0xED47, 0xF60A, 0xF66C, 0xB9E5, 0xB144, 0xB104, 0xCAE7, 0xFECD, 0xF5A9, 0xED47, 0xF568, 0xF568,
-  0xED68, 0xED47, 0xF5EA, 0xFEAD, 0xC266, 0xB124, 0xB124, 0xC266, 0xFEAD, 0xF5EA, 0xED47, 0xED68,
-  0xF568, 0xF568, 0xED47, 0xF5A9, 0xFECD, 0xCAE7, 0xB104, 0xB144, 0xB9E5, 0xF66C, 0xF60A, 0xED48,
-  0xF567, 0xF568, 0x20C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x82A4, 0xFD88, 0xED68,
-  0xF5A8, 0xED47, 0xF60A, 0xDC89, 0xB9A5, 0xBA25, 0xED49, 0xF5C9, 0xF567, 0xF5A8, 0xED68, 0xED28,
-  0xF568, 0xF5A8, 0xED47, 0xF5E9, 0xE4E9, 0xB9E5, 0xB9E5, 0xE4E9, 0xF5E9, 0xED47, 0xF5A8, 0xF568,
-  0xED28, 0xED68, 0xF5A8, 0xED67, 0xF5C9, 0xED4A, 0xBA25, 0xB9A5, 0xDC89, 0xF60A, 0xED47, 0xF5A8,
-  0xED68, 0xFD88, 0x82A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA184, 0xB9C5, 0xBA25,
-  0xD3C6, 0xF588, 0xF568, 0xF588, 0xED48, 0xED68, 0xF568, 0xF588, 0xED48, 0xCB46, 0xBA05, 0xB9C5,
-  0xBA05, 0xD386, 0xF568, 0xF568, 0xF588, 0xED48, 0xED48, 0xF588, 0xF568, 0xF568, 0xD386, 0xBA05,
-  0xB9C5, 0xBA05, 0xCB46, 0xED48, 0xF588, 0xF568, 0xED68, 0xED48, 0xF588, 0xF568, 0xF588, 0xD3C6,
-  0xBA25, 0xB9C5, 0xA184, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3061, 0xB965, 0xB164, 0xB144,
-  0xB124, 0xCAC6, 0xF568, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5C8, 0xED08, 0xBA25, 0xB124, 0xB164, 0xB165,
-  0xB144, 0xA904, 0xC265, 0xED48, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xED48, 0xC265, 0xA904, 0xB144,
-  0xB165, 0xB144, 0xB124, 0xBA25, 0xED08, 0xF5C8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF568, 0xCAC6, 0xB124,
-  0xB144, 0xB164, 0xB965, 0x3061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60C2, 0xC185, 0xB164, 0xB185,
-  0xB185, 0xB124, 0xBA05, 0xDBC6, 0xE487, 0xE467, 0xD366, 0xB9A5, 0xB144, 0xB185, 0xB185, 0xB185,
-  0xB185, 0xB185, 0xB144, 0xB9E5, 0xD3A6, 0xE487, 0xE487, 0xD3A6, 0xB9E5, 0xB144, 0xB185, 0xB185,
-  0xB185, 0xB185, 0xB185, 0xB144, 0xB9A5, 0xD366, 0xE467, 0xE487, 0xDBC6, 0xBA05, 0xB124, 0xB185,
-  0xB185, 0xB164, 0xC185, 0x60C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9123, 0xB985, 0xB165, 0xB165,
-  0xB165, 0xB185, 0xB144, 0xB124, 0xB144, 0xB144, 0xB124, 0xB165, 0xB185, 0xB165, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB185, 0xB164, 0xB124, 0xB144, 0xB144, 0xB124, 0xB164, 0xB185, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB165, 0xB185, 0xB165, 0xB124, 0xB144, 0xB144, 0xB124, 0xB144, 0xB185, 0xB165,
-  0xB165, 0xB165, 0xB985, 0x9124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xA964, 0xB185, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB165,
-  0xB165, 0xB165, 0xB165, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB165, 0xB165, 0xB165,
-  0xB165, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB185, 0xA964, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2841, 0xB985, 0xB165, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB185, 0xB144, 0xB104, 0xB144, 0xB185,
-  0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165,
-  0xB185, 0xB144, 0xB104, 0xB144, 0xB185, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB165, 0xB985, 0x2841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3881, 0xC185, 0xB164, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB185, 0xB144, 0xBA26, 0xD3C8, 0xC266, 0xB144,
-  0xB185, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB185,
-  0xB144, 0xC266, 0xD3C8, 0xBA05, 0xB144, 0xB185, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB164, 0xC185, 0x3881, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x50A2, 0xC185, 0xB164, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB185, 0xB165, 0xB9E5, 0xF64C, 0xFF2D, 0xF60A, 0xB9E4,
-  0xB165, 0xB185, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB185, 0xB144,
-  0xC266, 0xFE8C, 0xFF2D, 0xED89, 0xB9A4, 0xB165, 0xB185, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB164, 0xC185, 0x50A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x58C2, 0xC185, 0xB164, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB165, 0xB165, 0xB185, 0xB164, 0xA8E3, 0xD3A9, 0xFEED, 0xF66C, 0xFE4A, 0xD3A8,
-  0xB104, 0xB164, 0xB185, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB185, 0xB164, 0xA8E4,
-  0xDC4A, 0xFEED, 0xF66C, 0xF62A, 0xCB48, 0xA904, 0xB164, 0xB185, 0xB165, 0xB165, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB164, 0xC185, 0x58C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x58C2, 0xC185, 0xB164, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB165, 0xB185, 0xB164, 0xB185, 0xDD55, 0xF759, 0xFE6B, 0xFEAD, 0xF5C8, 0xF6B4,
-  0xE5F8, 0xB9C6, 0xB144, 0xB185, 0xB165, 0xB165, 0xB165, 0xB165, 0xB185, 0xB144, 0xB9E6, 0xE5D7,
-  0xF757, 0xFE6B, 0xFEAD, 0xF5A8, 0xF6F7, 0xDD76, 0xB185, 0xB164, 0xB185, 0xB165, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB164, 0xC185, 0x58C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x58C2, 0xC185, 0xB164, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB165, 0xB165, 0xB164, 0xE5F7, 0xFFFF, 0xF6F7, 0xFEAB, 0xFE8D, 0xF587, 0xEE53,
-  0xFFFF, 0xEE99, 0xB1A5, 0xB164, 0xB185, 0xB165, 0xB165, 0xB185, 0xB164, 0xB1A5, 0xEE99, 0xFFFF,
-  0xF6D5, 0xFEAB, 0xF66C, 0xF587, 0xEEB6, 0xFFFF, 0xE5F7, 0xB164, 0xB165, 0xB165, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB164, 0xC185, 0x58C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x58C2, 0xC185, 0xB164, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB185, 0xB103, 0xCC0F, 0xFFFF, 0xE638, 0xB9E6, 0xE4A8, 0xF5C9, 0xE4C7, 0xB9E5,
-  0xDD96, 0xFFFF, 0xD4D2, 0xB103, 0xB185, 0xB165, 0xB165, 0xB185, 0xB103, 0xD4D2, 0xFFFF, 0xDD75,
-  0xB9E5, 0xED08, 0xF5C8, 0xE467, 0xB9E6, 0xE638, 0xFFFF, 0xCC0F, 0xB103, 0xB185, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB164, 0xC185, 0x58C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x50A2, 0xC185, 0xB164, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB165, 0xB164, 0xE679, 0xF7BE, 0xC289, 0xA8E3, 0xB185, 0xC245, 0xB9A5, 0xB103,
-  0xB9E7, 0xF75D, 0xEF1C, 0xB1A6, 0xB164, 0xB185, 0xB185, 0xB164, 0xB9A6, 0xEF3C, 0xF75D, 0xB9E7,
-  0xB103, 0xB185, 0xC245, 0xB185, 0xB0E3, 0xC289, 0xF7BE, 0xE679, 0xB164, 0xB165, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB164, 0xC185, 0x50A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4081, 0xC185, 0xB164, 0xB165, 0xB165,
-  0xB165, 0xB185, 0xB144, 0xB9E7, 0xF79E, 0xEEBA, 0xB164, 0xB185, 0xB165, 0xB144, 0xB165, 0xB185,
-  0xB123, 0xE5F7, 0xF7FF, 0xBA89, 0xB124, 0xB185, 0xB185, 0xB124, 0xBA89, 0xF7FF, 0xE5F7, 0xB123,
-  0xB185, 0xB165, 0xB144, 0xB165, 0xB185, 0xB164, 0xEEBA, 0xF79E, 0xB9E7, 0xB144, 0xB185, 0xB165,
-  0xB165, 0xB165, 0xB164, 0xC185, 0x3881, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xB985, 0xB165, 0xB165, 0xB165,
-  0xB165, 0xB185, 0xB144, 0xBA07, 0xF79E, 0xE699, 0xB164, 0xB185, 0xB165, 0xB185, 0xB165, 0xB185,
-  0xB123, 0xE5D6, 0xF7FF, 0xC289, 0xB123, 0xB185, 0xB185, 0xB123, 0xC289, 0xF7FF, 0xE5D6, 0xB123,
-  0xB185, 0xB165, 0xB185, 0xB165, 0xB185, 0xB164, 0xE699, 0xF79E, 0xBA07, 0xB144, 0xB185, 0xB165,
-  0xB165, 0xB165, 0xB165, 0xB985, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xA964, 0xB185, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB165, 0xB165, 0xEEBA, 0xF79E, 0xBA28, 0xB123, 0xB1A5, 0xB185, 0xB185, 0xB144,
-  0xB9A6, 0xEF3C, 0xEF5D, 0xB9C6, 0xB164, 0xB185, 0xB185, 0xB164, 0xB9C6, 0xEF5D, 0xEF3C, 0xB1A6,
-  0xB144, 0xB185, 0xB185, 0xB1A5, 0xB123, 0xBA28, 0xF7BE, 0xEEBA, 0xB164, 0xB165, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB185, 0xA964, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8923, 0xB985, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB185, 0xB103, 0xD471, 0xFFFF, 0xDDB6, 0xB144, 0xB103, 0xB124, 0xB103, 0xB103,
-  0xDD13, 0xFFFF, 0xDD34, 0xB103, 0xB185, 0xB165, 0xB165, 0xB185, 0xB103, 0xDD34, 0xFFFF, 0xDD13,
-  0xB103, 0xB103, 0xB124, 0xB103, 0xB144, 0xDDB6, 0xFFFF, 0xD471, 0xB103, 0xB185, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB985, 0x8923, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60C2, 0xC185, 0xB164, 0xB165,
-  0xB165, 0xB165, 0xB185, 0xB164, 0xB185, 0xE679, 0xFFFF, 0xE658, 0xCB6D, 0xC2A9, 0xC34C, 0xE5D7,
-  0xFFFF, 0xEEFB, 0xB9E7, 0xB144, 0xB185, 0xB165, 0xB165, 0xB185, 0xB144, 0xB9E7, 0xEF1B, 0xFFFF,
-  0xE5D7, 0xC34C, 0xC2A9, 0xCB6D, 0xE658, 0xFFFF, 0xE679, 0xB185, 0xB164, 0xB185, 0xB165, 0xB165,
-  0xB165, 0xB164, 0xC185, 0x60C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3061, 0xB985, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB165, 0xB185, 0xB144, 0xB9E6, 0xE5F7, 0xFFFF, 0xFFFF, 0xF7FF, 0xFFFF, 0xFFFF,
-  0xE679, 0xBA48, 0xB124, 0xB185, 0xB165, 0xB165, 0xB165, 0xB165, 0xB185, 0xB124, 0xBA48, 0xE679,
-  0xFFFF, 0xFFFF, 0xF7FF, 0xFFFF, 0xFFFF, 0xE5F7, 0xB9E6, 0xB144, 0xB185, 0xB165, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB985, 0x3061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0xA144, 0xB985, 0xB165,
-  0xB165, 0xB165, 0xB165, 0xB165, 0xB185, 0xB144, 0xB144, 0xC32C, 0xDCF3, 0xDD96, 0xDD14, 0xCB6D,
-  0xB164, 0xB144, 0xB185, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB185, 0xB144, 0xB165,
-  0xCB6D, 0xDD14, 0xDD96, 0xDCF3, 0xC32C, 0xB144, 0xB144, 0xB185, 0xB165, 0xB165, 0xB165, 0xB165,
-  0xB165, 0xB985, 0x9944, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60C2, 0xC185, 0xB185,
-  0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB123, 0xB103, 0xB123, 0xB123, 0xB123,
-  0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185,
-  0xB123, 0xB123, 0xB123, 0xB103, 0xB123, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185,
-  0xB185, 0xC185, 0x60C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1820, 0xB144, 0xB124,
-  0xB124, 0xB124, 0xB124, 0xB124, 0xB124, 0xB124, 0xB124, 0xB145, 0xB145, 0xB145, 0xB145, 0xB145,
-  0xB124, 0xB124, 0xB124, 0xB124, 0xB124, 0xB124, 0xB124, 0xB124, 0xB124, 0xB124, 0xB124, 0xB124,
-  0xB145, 0xB145, 0xB145, 0xB145, 0xB145, 0xB124, 0xB124, 0xB124, 0xB124, 0xB124, 0xB124, 0xB124,
-  0xB124, 0xB144, 0x1820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x89E3, 0xE3A7,
-  0xCB66, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366,
-  0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366,
-  0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xD366, 0xCB66,
-  0xE3A7, 0x8A04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20E1, 0xF5A8,
-  0xF5C8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8,
-  0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8,
-  0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5C8,
-  0xF5A8, 0x2901, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x82C4,
-  0xFDC8, 0xED48, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568,
-  0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568,
-  0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xED48, 0xFDC8,
-  0x82C4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840,
-  0xCC27, 0xE4C8, 0xDC87, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7,
-  0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7,
-  0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDCA7, 0xDC87, 0xE4C8, 0xCC27,
-  0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3902, 0xDC68, 0xD427, 0xD427, 0xD427, 0xD427, 0xD427, 0xD427, 0xD427, 0xD427, 0xD427, 0xD427,
-  0xD427, 0xD427, 0xD427, 0xD427, 0xD427, 0xD427, 0xD427, 0xD427, 0xD427, 0xD427, 0xD427, 0xD427,
-  0xD427, 0xD427, 0xD427, 0xD427, 0xD427, 0xD427, 0xD427, 0xD427, 0xD427, 0xD427, 0xE468, 0x3922,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x6203, 0xDC47, 0xD447, 0xD447, 0xD447, 0xD447, 0xD447, 0xD447, 0xD447, 0xD447, 0xD447,
-  0xD447, 0xD447, 0xD447, 0xD447, 0xD447, 0xD447, 0xD447, 0xD447, 0xD447, 0xD447, 0xD447, 0xD447,
-  0xD447, 0xD447, 0xD447, 0xD447, 0xD447, 0xD447, 0xD447, 0xD447, 0xD447, 0xDC47, 0x6203, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1880, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1,
-  0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1,
-  0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x1880, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
@@ -1,308 +0,0 @@
-#pragma once
-#include <Arduino.h>
-
-constexpr int kIcon2Width = 60;
-constexpr int kIcon2Height = 60;
-
-const uint16_t kIcon2Data[3600] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x1820, 0x1820, 0x1820, 0x1820, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3061, 0x60C2, 0x8903, 0x9944, 0xA144, 0xA144, 0xA144, 0xA144, 0x9944, 0x8903, 0x60C2, 0x3061,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4882, 0x9124,
-  0xB164, 0xB165, 0xA964, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0xA964, 0xB165, 0xB164,
-  0x9124, 0x4882, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3061, 0x9124, 0xB165, 0xA964,
-  0xA144, 0xA144, 0xA144, 0xA164, 0xA965, 0xA965, 0xA965, 0xA965, 0xA164, 0xA144, 0xA144, 0xA144,
-  0xA964, 0xB165, 0x9124, 0x3061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x58C2, 0xB164, 0xA964, 0xA144, 0xA144,
-  0xA964, 0xA965, 0xA144, 0xA103, 0xA0E3, 0xA0E3, 0xA0E3, 0xA0E3, 0xA103, 0xA144, 0xA965, 0xA964,
-  0xA144, 0xA144, 0xA964, 0xB164, 0x58C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x70E3, 0xB165, 0xA144, 0xA144, 0xA964, 0xA965,
-  0xA123, 0xA0E3, 0xA985, 0xBAA9, 0xC38D, 0xCBEE, 0xCBEE, 0xC36C, 0xB268, 0xA965, 0xA0E3, 0xA123,
-  0xA965, 0xA164, 0xA144, 0xA144, 0xB165, 0x70E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x68E3, 0xB165, 0xA144, 0xA144, 0xA964, 0xA144, 0xA0E3,
-  0xB268, 0xDCF2, 0xF6D9, 0xFF9C, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFBD, 0xFF5B, 0xF677, 0xD490, 0xB227,
-  0xA0E3, 0xA144, 0xA964, 0xA144, 0xA144, 0xB165, 0x68E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x50A2, 0xB165, 0xA144, 0xA144, 0xA965, 0xA123, 0xA964, 0xDCD1,
-  0xFF7C, 0xFFDD, 0xFF9C, 0xFF5B, 0xFF5B, 0xFF5B, 0xFF5B, 0xFF5B, 0xFF7B, 0xFF9C, 0xFF9B, 0xFF19,
-  0xD490, 0xA164, 0xA124, 0xA964, 0xA144, 0xA144, 0xB165, 0x50A2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2040, 0xA964, 0xA144, 0xA144, 0xA965, 0xA103, 0xB1E6, 0xEE57, 0xFFFD,
-  0xFF7B, 0xFF5B, 0xFF5B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF5B, 0xFF5B, 0xFF19,
-  0xFF9A, 0xEDF5, 0xA9C6, 0xA123, 0xA964, 0xA144, 0xA144, 0xA964, 0x2040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x8103, 0xA964, 0xA144, 0xA964, 0xA124, 0xA9C6, 0xF6D9, 0xFFBD, 0xFF3B,
-  0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF5B,
-  0xFEF8, 0xFF7A, 0xF656, 0xA9C6, 0xA124, 0xA964, 0xA144, 0xA964, 0x8103, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3061, 0xB164, 0xA144, 0xA144, 0xA144, 0xA144, 0xEE16, 0xFFDD, 0xFF5B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF5B, 0xFEF8, 0xFF7A, 0xE5B4, 0xA124, 0xA144, 0xA144, 0xA144, 0xB164, 0x3061, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x7903, 0xB164, 0xA144, 0xA965, 0xA0E3, 0xD42F, 0xFFFD, 0xFF5B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF39, 0xFEF8, 0xFF9B, 0xCBEE, 0xA0E3, 0xA965, 0xA144, 0xB164, 0x7903, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1820, 0xA144, 0xA144, 0xA164, 0xA124, 0xA9C6, 0xFF1A, 0xFF7C, 0xFF5B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF5A, 0xFEF9, 0xFF39, 0xF6B7, 0xA9A6, 0xA144, 0xA164, 0xA144, 0xA144, 0x1820, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4081, 0xB165, 0xA144, 0xA965, 0xA0E3, 0xCC0E, 0xFFDD, 0xFF5B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF5B, 0xFF19, 0xFEF8, 0xFF7A, 0xCBAD, 0xA0E3, 0xA965, 0xA144, 0xB165, 0x4081, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x68E3, 0xB164, 0xA144, 0xA964, 0xA123, 0xEDF6, 0xFFBC, 0xFF5B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF19, 0xFEF8, 0xFF5A, 0xE593, 0xA103, 0xA964, 0xA144, 0xB164, 0x68E3, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x8103, 0xB164, 0xA144, 0xA144, 0xA9C6, 0xFEFA, 0xFF7C, 0xFF5B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF3A, 0xFEF9, 0xFF39, 0xF697, 0xA9A5, 0xA144, 0xA144, 0xB164, 0x7903, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18A1,
-  0x3101, 0x9144, 0xA964, 0xA164, 0xA123, 0xB268, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF3A, 0xFF19, 0xFF19, 0xFF19, 0xB227, 0xA123, 0xA164, 0xA964, 0x9144, 0x3101,
-  0x18A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x6A63, 0xC466, 0xF568,
-  0xFDC8, 0xB205, 0xA124, 0xA964, 0xA103, 0xBA89, 0xFF9C, 0xFF5B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF3A, 0xFF19, 0xFF19, 0xFF39, 0xBA68, 0xA103, 0xA964, 0xA124, 0xB205, 0xFDC8,
-  0xF568, 0xC466, 0x6A63, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2901, 0xCC87, 0xFE09, 0xFDE9, 0xDCE7,
-  0xBC46, 0xA9C5, 0xA144, 0xA964, 0xA103, 0xBA89, 0xFF7C, 0xFF5B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF3A, 0xFF19, 0xFF19, 0xFF19, 0xB268, 0xA123, 0xA964, 0xA144, 0xA9C5, 0xBC46,
-  0xDCE7, 0xFDE9, 0xFE09, 0xCC87, 0x2901, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3101, 0xE527, 0xFE09, 0xC486, 0x49C2, 0x0840,
-  0x0000, 0x8903, 0xA964, 0xA164, 0xA124, 0xB207, 0xFF3B, 0xFF7C, 0xFF5B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF19, 0xFF19, 0xFF19, 0xFED8, 0xB1E6, 0xA124, 0xA164, 0xA964, 0x8903, 0x0000,
-  0x0840, 0x49C2, 0xC466, 0xFE09, 0xE527, 0x3101, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0xD4A7, 0xFE09, 0xA3C5, 0x0840, 0x0000, 0x0000,
-  0x0000, 0x70E3, 0xB164, 0xA144, 0xA144, 0xA964, 0xF698, 0xFF9C, 0xFF5B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF5B, 0xFF19, 0xFF19, 0xFF3A, 0xEE36, 0xA144, 0xA144, 0xA144, 0xB164, 0x70E3, 0x0000,
-  0x0000, 0x0000, 0x0840, 0xA3C5, 0xFE09, 0xD4A7, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x72A4, 0xFE09, 0xC466, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x58A2, 0xB165, 0xA144, 0xA965, 0xA0E3, 0xDD12, 0xFFDD, 0xFF5B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF3A, 0xFF19, 0xFEF9, 0xFF7A, 0xDCD0, 0xA0E3, 0xA965, 0xA144, 0xB165, 0x58A2, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0xC466, 0xFE09, 0x72A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xD4C7, 0xFDC8, 0x3942, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2841, 0xB164, 0xA144, 0xA964, 0xA103, 0xBACA, 0xFFBC, 0xFF5B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF5B, 0xFF19, 0xFF19, 0xFEF9, 0xFF5A, 0xBAA9, 0xA103, 0xA964, 0xA144, 0xB164, 0x2841, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3942, 0xFDC8, 0xD4C7, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3101, 0xFDC8, 0xCC86, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x9924, 0xA964, 0xA144, 0xA164, 0xA123, 0xEDF6, 0xFFBD, 0xFF5B, 0xFF7B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B,
-  0xFF3A, 0xFF19, 0xFEF9, 0xFF7A, 0xE593, 0xA103, 0xA964, 0xA144, 0xA964, 0x9924, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCC86, 0xFDC8, 0x3101, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x49A2, 0xFE09, 0xA3A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x58C2, 0xB165, 0xA144, 0xA964, 0xA103, 0xB268, 0xFF7C, 0xFF7B, 0xFF5B, 0xFF7B,
-  0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7C, 0xFF5A,
-  0xFF19, 0xFF19, 0xFF19, 0xFF19, 0xB248, 0xA123, 0xA964, 0xA144, 0xB165, 0x58C2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA3A5, 0xFE09, 0x49A2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x49A2, 0xFE29, 0x8B24, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xA144, 0xA944, 0xA144, 0xA965, 0xA0E3, 0xCBCE, 0xFFDD, 0xFF5B, 0xFF5B,
-  0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7C, 0xFF5B, 0xFF19,
-  0xFEF9, 0xFEF9, 0xFF7A, 0xCB8C, 0xA0E3, 0xA965, 0xA144, 0xA944, 0xA144, 0x1020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B24, 0xFE29, 0x49A2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x4182, 0xFE29, 0x7AE4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x50A2, 0xB165, 0xA144, 0xA144, 0xA964, 0xA0E3, 0xD44F, 0xFFDD, 0xFF7C,
-  0xFF5B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF7B, 0xFF5A, 0xFF19, 0xFEF8,
-  0xFF19, 0xFF7A, 0xCC0E, 0xA0E3, 0xA964, 0xA144, 0xA144, 0xB165, 0x50A2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x82E4, 0xFE29, 0x4182, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3861, 0x9964, 0xC245, 0xA1A4, 0x4882, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x8903, 0xB164, 0xA144, 0xA144, 0xA964, 0xA0E3, 0xC38D, 0xFF3B,
-  0xFFDD, 0xFF7B, 0xFF5B, 0xFF5B, 0xFF5B, 0xFF7B, 0xFF5B, 0xFF5B, 0xFF19, 0xFEF8, 0xFF19, 0xFF7A,
-  0xFED8, 0xC34B, 0xA0E3, 0xA964, 0xA144, 0xA144, 0xA964, 0x8903, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x50A2, 0xA9C4, 0xC245, 0x9164, 0x3061, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x4081, 0xC185, 0xB965, 0xB144, 0xB165, 0xB985, 0x60C2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1820, 0xA144, 0xA964, 0xA144, 0xA144, 0xA964, 0xA0E3, 0xB207,
-  0xDD33, 0xFF5B, 0xFFDD, 0xFFBC, 0xFF9C, 0xFF7B, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF7A, 0xFEF8, 0xDCF1,
-  0xB1E6, 0xA0E3, 0xA964, 0xA144, 0xA144, 0xA964, 0xA144, 0x1820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x68E3, 0xC9A5, 0xB165, 0xB144, 0xB965, 0xB165, 0x3861, 0x0000, 0x0000,
-  0x0000, 0x0800, 0xA144, 0xB985, 0xB164, 0xB185, 0xB165, 0xA964, 0xA964, 0x2040, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2841, 0xA944, 0xA964, 0xA144, 0xA144, 0xA965, 0xA124,
-  0xA0E3, 0xB207, 0xCBCD, 0xE532, 0xEE15, 0xF656, 0xF656, 0xEE15, 0xDD32, 0xCBCD, 0xB207, 0xA0E3,
-  0xA124, 0xA965, 0xA144, 0xA144, 0xA964, 0xA944, 0x2841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2041, 0xB985, 0xB165, 0xB165, 0xB185, 0xB165, 0xA964, 0x9124, 0x0000, 0x0000,
-  0x0000, 0x1820, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xA964, 0xB164, 0x4081, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2841, 0x9944, 0xB164, 0xA144, 0xA144, 0xA964,
-  0xA964, 0xA124, 0xA0E3, 0xA103, 0xA144, 0xA985, 0xA985, 0xA144, 0xA103, 0xA0E3, 0xA124, 0xA964,
-  0xA964, 0xA144, 0xA144, 0xB164, 0x9944, 0x2841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x4081, 0xC185, 0xB164, 0xB165, 0xB165, 0xB165, 0xA964, 0xA144, 0x1820, 0x0000,
-  0x0000, 0x1820, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xA144, 0xB164, 0x3861, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0x7903, 0xB165, 0xA964, 0xA144,
-  0xA144, 0xA964, 0xA965, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0xA965, 0xA964, 0xA144,
-  0xA144, 0xA964, 0xB165, 0x7903, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x4081, 0xC185, 0xB164, 0xB165, 0xB165, 0xB165, 0xA144, 0xA144, 0x1020, 0x0000,
-  0x0000, 0x0000, 0x9124, 0xC185, 0xB164, 0xB165, 0xA964, 0xA964, 0xA144, 0x1020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4081, 0x9124, 0xB165,
-  0xA964, 0xA144, 0xA164, 0xA964, 0xA964, 0xA964, 0xA964, 0xA964, 0xA964, 0xA164, 0xA144, 0xA964,
-  0xB165, 0x9124, 0x4081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xB164, 0xB985, 0xB164, 0xB164, 0xA144, 0xB164, 0x8903, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2841, 0xA944, 0xB985, 0xB165, 0xB164, 0xB164, 0x4081, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x4081,
-  0x8103, 0xA184, 0xA124, 0xA0E4, 0xA0E4, 0xA104, 0xA104, 0xA0E4, 0xA104, 0xA124, 0xA164, 0x8103,
-  0x4082, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x4881, 0xB965, 0xB985, 0xB165, 0xB165, 0xA144, 0x2040, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1020, 0x50A2, 0x68C3, 0x60C2, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xAC28, 0xEDAB, 0xD449, 0xCBC8, 0xC367, 0xCB67, 0xCBC8, 0xCBA7, 0xECA7, 0xA365, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0x58C2, 0x68E3, 0x50A2, 0x1020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x0000, 0xAC89, 0xFF4E, 0xFEED, 0xFF0D, 0xFF0D, 0xFF0D, 0xFF0D, 0xF5C9, 0xFDE8, 0xA3C5, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xAC47, 0xFE4B, 0xEDCA, 0xF5EA, 0xF5EA, 0xF5EA, 0xF5A9, 0xED28, 0xFDA8, 0xABC5, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x6A63, 0xFDE8, 0xF588, 0xF588, 0xF588, 0xF588, 0xF588, 0xF5A8, 0xFDE9, 0x6A63, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x4182, 0xC326, 0xE347, 0xDB47, 0xDB47, 0xE347, 0xC306, 0x4182, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xA144, 0xD9C6, 0xC9A6, 0xC9A6, 0xD9C6, 0xA144, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xA9A5, 0xDA06, 0xD1E6, 0xD1E6, 0xDA06, 0xA9A5, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xA185, 0xDA06, 0xD1E6, 0xD1E6, 0xDA06, 0xA185, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xC4A9, 0xFE2C, 0xF5AB, 0xECE8, 0xF508, 0xBBE6, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xC54A, 0xFF0D, 0xF68C, 0xED88, 0xFDC8, 0xC466, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xC52A, 0xFECD, 0xF66C, 0xED68, 0xFDA8, 0xBC46, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xC52A, 0xFEED, 0xF66C, 0xED68, 0xFDA8, 0xBC46, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xC52A, 0xFEED, 0xF66C, 0xED68, 0xFDA8, 0xBC46, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xC52A, 0xFEED, 0xF66C, 0xED68, 0xFDA8, 0xBC46, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xC52A, 0xFEED, 0xF66C, 0xED68, 0xFDA8, 0xBC46, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xC52A, 0xFEED, 0xF66C, 0xED68, 0xFDA8, 0xBC46, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xC52A, 0xFEED, 0xF66C, 0xED68, 0xFDA8, 0xBC46, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xC52A, 0xFEED, 0xF66C, 0xED68, 0xFDA8, 0xBC46, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xC52A, 0xFEED, 0xF66C, 0xED68, 0xFDA8, 0xBC46, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xC52A, 0xFEED, 0xF66C, 0xED68, 0xFDA8, 0xBC46, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xCD4A, 0xFEED, 0xF62B, 0xED48, 0xFDA8, 0xC466, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x9BE7, 0xFF0D, 0xED88, 0xED48, 0xFE09, 0x9345, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1060, 0xB406, 0xF568, 0xF588, 0xB406, 0x1060, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20C1, 0x20C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
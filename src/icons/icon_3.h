@@ -1,308 +0,0 @@
-#pragma once
-#include <Arduino.h>
-
-constexpr int kIcon3Width = 60;
-constexpr int kIcon3Height = 60;
-
-const uint16_t kIcon3Data[3600] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1061, 0x1081, 0x0000, 0x0000, 0x18A1, 0x1081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x51C5,
-  0x9B49, 0x9B49, 0x6225, 0x8B28, 0xC48B, 0xC46B, 0x5A25, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20A2, 0xA389,
-  0x9B49, 0x9328, 0xB3EA, 0xCCAB, 0xC46B, 0xC48B, 0xC46B, 0x1081, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6225, 0xA369,
-  0x9328, 0x9348, 0xBC4A, 0xC46B, 0xC46B, 0xBC6B, 0xC46B, 0x18A1, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0x9348, 0x9B48,
-  0x9328, 0xA3A9, 0xC48B, 0xC46B, 0xBC6B, 0xCCAB, 0x9368, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x51E5, 0xA389, 0x9328,
-  0x9348, 0xBC2A, 0xC48B, 0xC46B, 0xBC6B, 0xCCAB, 0x3122, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x8B08, 0x9B49, 0x9328,
-  0xA3A9, 0xC48B, 0xC46B, 0xBC6B, 0xCCAB, 0x8B28, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4984, 0xA389, 0x9328, 0x9348,
-  0xBC2A, 0xC48B, 0xC46B, 0xC46B, 0xC48B, 0x28E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x82E7, 0x9B69, 0x9328, 0xA389,
-  0xC48B, 0xC46B, 0xBC6B, 0xCCAB, 0x7AE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3943, 0xA389, 0x9348, 0x9328, 0xB42A,
-  0xC48B, 0xC46B, 0xC46B, 0xC48B, 0x20C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7AA7, 0x9B69, 0x9328, 0xA389, 0xC46B,
-  0xC46B, 0xBC6B, 0xCCCC, 0x72A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x28E2, 0x9B69, 0x9348, 0x9328, 0xB40A, 0xC48B,
-  0xC46B, 0xC46B, 0xBC6A, 0x18A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6A66, 0xA369, 0x9328, 0x9B89, 0xC46B, 0xC46B,
-  0xBC6B, 0xCCCC, 0x6A66, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18A1, 0x9B69, 0x9348, 0x9328, 0xB40A, 0xC48B, 0xC46B,
-  0xC48B, 0xBC2A, 0x1061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5A05, 0xA389, 0x9328, 0x9B69, 0xC46B, 0xC46B, 0xBC6A,
-  0xCCCC, 0x5A25, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0x9328, 0x9B49, 0x9328, 0xB3EA, 0xC48B, 0xBC6B, 0xC48B,
-  0xB42A, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x51A4, 0xA389, 0x9328, 0x9B69, 0xC46B, 0xC46B, 0xBC6A, 0xCCCC,
-  0x51E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x8B08, 0x9B69, 0x9328, 0xABEA, 0xC48B, 0xBC6B, 0xC48B, 0xABE9,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x4163, 0xA389, 0x9348, 0x9B69, 0xBC6B, 0xC46B, 0xBC6B, 0xCCCB, 0x49A4,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x82C7, 0x9B69, 0x8AE7, 0xABA9, 0xC48B, 0xBC6B, 0xCCAC, 0xA3C9, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4228, 0x4A69, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x28A1, 0xA369, 0x9328, 0xB48F, 0xCD71, 0xC46A, 0xBC6B, 0xC44A, 0x3102, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4A69, 0x4228, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186, 0x6B6D, 0x1082,
-  0x18E3, 0xD6BA, 0xE71C, 0x31A6, 0x0020, 0x6B4D, 0x39E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4208, 0xB4F2, 0x9B69, 0xA3EC, 0xF7DF, 0xF7DF, 0xCCEE, 0xC46B, 0xD5D4, 0x4208, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39E7, 0x6B4D, 0x0020, 0x31A6, 0xE71C, 0xD6BA, 0x18E3,
-  0x1082, 0x6B6D, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0xB5B6, 0xF79E, 0x738E,
-  0x4228, 0xDEDB, 0xDEDB, 0x630C, 0x52AA, 0xF79E, 0xCE59, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xE73C, 0xFFFF, 0xBD32, 0xBCD0, 0xFFDF, 0xF7BF, 0xD592, 0xD5D3, 0xFFFF, 0xE73C, 0x1082,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0xCE59, 0xEF7D, 0x52AA, 0x630C, 0xDEDB, 0xDEDB, 0x4228,
-  0x738E, 0xF79E, 0xB5B6, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C7, 0xD6BA, 0xCE79, 0xB596,
-  0x94B2, 0xD69A, 0xD69A, 0xA514, 0xA534, 0xCE79, 0xDEDB, 0x528A, 0x0000, 0x0000, 0x0020, 0x0000,
-  0x528A, 0xFFFF, 0xF79E, 0xE6B9, 0xD657, 0xF7DF, 0xF7BF, 0xE698, 0xEEFA, 0xF79E, 0xFFFF, 0x528A,
-  0x0000, 0x0020, 0x0000, 0x0000, 0x528A, 0xDEDB, 0xCE79, 0xA534, 0xA514, 0xD69A, 0xD69A, 0x94B2,
-  0xB596, 0xCE79, 0xD6BA, 0x31A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C71, 0xDEDB, 0xCE59, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xD6BA, 0xA534, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xBDD7, 0xFFFF, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xFFFF, 0xBDD7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xA534, 0xD6BA, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE59, 0xDEDB, 0x9492, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C7, 0xD6BA, 0xCE59, 0xCE59, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xCE59, 0xDEDB, 0x528A, 0x0000, 0x0000, 0x528A,
-  0xFFFF, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xFFFF,
-  0x528A, 0x0000, 0x0000, 0x528A, 0xDEDB, 0xCE59, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE59, 0xCE59, 0xD6BA, 0x39C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0xBDD7, 0xD69A, 0xCE59, 0xBDD7, 0xBDD7,
-  0xCE59, 0xBDF7, 0xBDD7, 0xCE59, 0xBDF7, 0xBDD7, 0xCE59, 0xCE79, 0xCE59, 0x18E3, 0x18E3, 0xE73C,
-  0xF7BE, 0xEF7D, 0xD69A, 0xDEDB, 0xF79E, 0xD6BA, 0xD6BA, 0xF79E, 0xDEDB, 0xD69A, 0xEF7D, 0xF7BE,
-  0xE73C, 0x18E3, 0x18E3, 0xCE59, 0xCE79, 0xCE59, 0xBDD7, 0xBDF7, 0xCE59, 0xBDD7, 0xBDF7, 0xCE59,
-  0xBDD7, 0xBDD7, 0xCE59, 0xD69A, 0xBDD7, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xAD55, 0xD6BA, 0xCE59, 0xC618, 0xB596, 0xBDD7,
-  0xCE79, 0xB5B6, 0xB5B6, 0xCE79, 0xBDF7, 0xB596, 0xC618, 0xCE79, 0xD69A, 0xB5B6, 0xCE79, 0xFFDF,
-  0xF79E, 0xE71C, 0xC638, 0xDEDB, 0xF79E, 0xCE79, 0xCE79, 0xF79E, 0xD6BA, 0xC638, 0xE71C, 0xF79E,
-  0xFFDF, 0xCE79, 0xB5B6, 0xD69A, 0xCE79, 0xC618, 0xB596, 0xBDF7, 0xCE79, 0xB5B6, 0xB5B6, 0xCE79,
-  0xBDD7, 0xB596, 0xC618, 0xCE59, 0xD6BA, 0xAD55, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xA534, 0xDEDB, 0xCE59, 0xCE59, 0xB5B6, 0xB5B6, 0xCE59,
-  0xCE79, 0xBDD7, 0xB5B6, 0xCE59, 0xCE59, 0xB5B6, 0xB5B6, 0xC638, 0xCE79, 0xF79E, 0xFFDF, 0xF79E,
-  0xEF5D, 0xCE59, 0xCE79, 0xEF7D, 0xF79E, 0xCE79, 0xCE79, 0xF79E, 0xEF7D, 0xCE79, 0xCE59, 0xEF5D,
-  0xF79E, 0xFFDF, 0xF79E, 0xCE79, 0xC638, 0xB5B6, 0xB5B6, 0xCE59, 0xCE59, 0xB5B6, 0xBDD7, 0xCE79,
-  0xCE59, 0xB5B6, 0xB5B6, 0xCE59, 0xCE59, 0xDEDB, 0xA534, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0841, 0xA514, 0xDEDB, 0xCE59, 0xC638, 0xB5B6, 0xB596, 0xC618, 0xCE79,
-  0xCE79, 0xBDD7, 0xB5B6, 0xCE59, 0xCE79, 0xC638, 0xB596, 0xB5B6, 0xEF5D, 0xF7BE, 0xF79E, 0xE73C,
-  0xCE79, 0xCE59, 0xE71C, 0xF7BE, 0xF79E, 0xCE79, 0xCE79, 0xF79E, 0xF7BE, 0xE71C, 0xCE59, 0xCE79,
-  0xE73C, 0xF79E, 0xF7BE, 0xEF5D, 0xB5B6, 0xB596, 0xC638, 0xCE79, 0xCE59, 0xB5B6, 0xBDD7, 0xCE79,
-  0xCE79, 0xC618, 0xB596, 0xB5B6, 0xC638, 0xCE59, 0xDEDB, 0xA514, 0x0841, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x7BEF, 0xDEFB, 0xC638, 0xCE79, 0xBDD7, 0xB596, 0xC618, 0xCE79, 0xCE79,
-  0xCE79, 0xB5B6, 0xB5B6, 0xCE59, 0xCE79, 0xCE79, 0xBDF7, 0xDEDB, 0xF7BE, 0xF79E, 0xF79E, 0xD69A,
-  0xCE59, 0xE71C, 0xF7BE, 0xF79E, 0xF79E, 0xCE79, 0xCE79, 0xF79E, 0xF79E, 0xF7BE, 0xE71C, 0xCE59,
-  0xD69A, 0xF79E, 0xF79E, 0xF7BE, 0xDEDB, 0xBDF7, 0xCE79, 0xCE79, 0xCE59, 0xB5B6, 0xB5B6, 0xCE79,
-  0xCE79, 0xCE79, 0xC618, 0xB596, 0xBDD7, 0xCE79, 0xC638, 0xDEFB, 0x7BEF, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2965, 0xD69A, 0xCE59, 0xCE79, 0xCE79, 0xCE59, 0xC638, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xBDF7, 0xBDD7, 0xCE59, 0xCE79, 0xCE59, 0xD6BA, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xEF5D,
-  0xE73C, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xD6BA, 0xD6BA, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xE73C,
-  0xEF5D, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0xD6BA, 0xCE59, 0xCE79, 0xCE59, 0xBDD7, 0xBDF7, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xC638, 0xCE59, 0xCE79, 0xCE79, 0xCE59, 0xD6BA, 0x2965, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x8410, 0xDEDB, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xE71C, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF7BE,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xE71C, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xDEDB, 0x8410, 0x0000, 0x0000,
-  0x0000, 0x0020, 0xB596, 0xD69A, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xEF7D, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xEF7D, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xD69A, 0xB596, 0x0020, 0x0000,
-  0x0000, 0x18C3, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xD69A, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xD69A, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0x18C3, 0x0000,
-  0x0000, 0x18E3, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xD6BA, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xD6BA, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0x2104, 0x0000,
-  0x0000, 0x2104, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xD69A, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xD69A, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0x2104, 0x0000,
-  0x0000, 0x1082, 0xC638, 0xCE79, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xCE79, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xCE79, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xCE79, 0xC638, 0x1082, 0x0000,
-  0x0000, 0x0000, 0xA514, 0xD6BA, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xEF5D, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xEF5D, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xD6BA, 0xA514, 0x0000, 0x0000,
-  0x0020, 0x0000, 0x5ACB, 0xDEDB, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xDEFB, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xDEFB, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xDEDB, 0x5ACB, 0x0000, 0x0020,
-  0x0000, 0x0000, 0x0841, 0xB5B6, 0xD69A, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xEF7D, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xEF7D, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xD69A, 0xB5B6, 0x0841, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x4208, 0xDEDB, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xD6BA, 0xF7BE, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xD6BA, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xDEDB, 0x4208, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x632C, 0xDEFB, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xDEFB, 0xF7BE, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF79E, 0xF7BE, 0xDEFB, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79,
-  0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xCE59, 0xDEFB, 0x632C, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8410, 0xDEFB, 0xCE58, 0xCE59, 0xCE59, 0xCE59, 0xCE59,
-  0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xE71C, 0xF7BE, 0xF79E,
-  0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-  0xF79E, 0xF7BE, 0xE71C, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE59,
-  0xCE59, 0xCE59, 0xCE59, 0xCE59, 0xCE58, 0xDEFB, 0x83EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94B2, 0xD6DB, 0xCE79, 0xCE9A, 0xCE9A, 0xCE9A,
-  0xCE9A, 0xCE9A, 0xCE9A, 0xCE9A, 0xCE9A, 0xCE9A, 0xCE9A, 0xCE9A, 0xCE9A, 0xCE9A, 0xEF7D, 0xF7DF,
-  0xF7DF, 0xF7DF, 0xF7DF, 0xF7DF, 0xF7DF, 0xF7DF, 0xF7DF, 0xF7DF, 0xF7DF, 0xF7DF, 0xF7DF, 0xF7DF,
-  0xF7DF, 0xEF7D, 0xCE9A, 0xCE9A, 0xCE9A, 0xCE9A, 0xCE9A, 0xCE9A, 0xCE9A, 0xCE9A, 0xCE9A, 0xCE9A,
-  0xCE9A, 0xCE9A, 0xCE9A, 0xCE79, 0xD6DB, 0x94B2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1820, 0x1840, 0x2061, 0x2041, 0x30C2, 0xBD34, 0xD5D7, 0xCDB6, 0xCDB6, 0xCDB6,
-  0xCDB6, 0xCDB6, 0xCDB6, 0xCDB6, 0xCDB6, 0xCDB6, 0xCDB6, 0xCDB6, 0xCDB6, 0xCDB6, 0xCDD6, 0xEE9A,
-  0xEEBA, 0xEEBA, 0xEEBA, 0xEEBA, 0xEEBA, 0xEEBA, 0xEEBA, 0xEEBA, 0xEEBA, 0xEEBA, 0xEEBA, 0xEEBA,
-  0xEE9A, 0xCDD6, 0xCDB6, 0xCDB6, 0xCDB6, 0xCDB6, 0xCDB6, 0xCDB6, 0xCDB6, 0xCDB6, 0xCDB6, 0xCDB6,
-  0xCDB6, 0xCDB6, 0xCDB6, 0xD5D7, 0xBD34, 0x28C2, 0x2041, 0x2061, 0x1841, 0x1820, 0x0000, 0x0000,
-  0x0000, 0x1820, 0xB165, 0xB985, 0xC1C5, 0xC9E6, 0xC9C5, 0xC1A5, 0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6,
-  0xC9E6, 0xD206, 0xD206, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD206, 0xD1E6, 0xD1E6,
-  0xD206, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD206,
-  0xD1E6, 0xD1E6, 0xD206, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD206, 0xD206, 0xC9E6,
-  0xC9E6, 0xC9E6, 0xC9E6, 0xC9E6, 0xC1A5, 0xC9C5, 0xC9E6, 0xC1C5, 0xB985, 0xB165, 0x1820, 0x0000,
-  0x0000, 0x0000, 0x9124, 0xC185, 0xA964, 0xB164, 0xB165, 0xB165, 0xB164, 0xB164, 0xB164, 0xB164,
-  0xB164, 0xB985, 0xC1C5, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6,
-  0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6,
-  0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xC9C5, 0xB985, 0xB165,
-  0xB164, 0xB164, 0xB164, 0xB164, 0xB165, 0xB165, 0xB164, 0xA964, 0xC185, 0x9124, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2841, 0xA964, 0xC185, 0xC185, 0xC185, 0xC185, 0xC185, 0xC185, 0xC185, 0xC185,
-  0xB985, 0xB165, 0xB164, 0xB9A5, 0xD206, 0xD206, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6,
-  0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6,
-  0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD206, 0xD206, 0xB9A5, 0xB164, 0xB165, 0xB985,
-  0xC185, 0xC185, 0xC185, 0xC185, 0xC185, 0xC185, 0xC185, 0xC185, 0xA964, 0x2041, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1020, 0x58C2, 0x70E3, 0x70E3, 0x70E3, 0x70E3, 0x70E3, 0x70E3, 0x7903,
-  0x9124, 0xB164, 0xC185, 0xB164, 0xB985, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6,
-  0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6,
-  0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xB985, 0xB164, 0xC185, 0xB164, 0x9124,
-  0x7903, 0x70E3, 0x70E3, 0x70E3, 0x70E3, 0x70E3, 0x70E3, 0x58C2, 0x1020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1820, 0x60C2, 0xB985, 0xB165, 0xB985, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6,
-  0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6,
-  0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xB985, 0xB165, 0xB985, 0x60C2, 0x1820, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3061, 0xA964, 0xB965, 0xB985, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6,
-  0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6,
-  0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xB985, 0xB965, 0xA964, 0x3061, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xB965, 0xB985, 0xD1E6, 0xD206, 0xD1E6, 0xD1E6,
-  0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6, 0xD1E6,
-  0xD1E6, 0xD1E6, 0xD206, 0xD1E6, 0xB985, 0xB965, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xB965, 0xB985, 0xC9E6, 0xD206, 0xD206,
-  0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206,
-  0xD206, 0xD206, 0xC9E6, 0xB985, 0xB965, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xB985, 0xB165, 0xB985, 0xB9A5,
-  0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5,
-  0xB9A5, 0xB985, 0xB165, 0xB985, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xB985, 0xB164, 0xB164,
-  0xB164, 0xB164, 0xB164, 0xB164, 0xB164, 0xB164, 0xB164, 0xB164, 0xB164, 0xB164, 0xB164, 0xB164,
-  0xB164, 0xB164, 0xB985, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0x9124, 0xB165, 0xB165,
-  0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165,
-  0xB165, 0xB165, 0x9124, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1820, 0x1820,
-  0x1820, 0x1820, 0x1820, 0x1820, 0x1820, 0x1820, 0x1820, 0x1820, 0x1820, 0x1820, 0x1820, 0x1820,
-  0x1820, 0x1820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
@@ -1,308 +0,0 @@
-#pragma once
-#include <Arduino.h>
-
-constexpr int kIcon4Width = 60;
-constexpr int kIcon4Height = 60;
-
-const uint16_t kIcon4Data[3600] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x1020, 0x1820, 0x1820, 0x1820, 0x1820, 0x1020, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0x4882,
-  0x68E3, 0x8903, 0x9924, 0xA144, 0xA944, 0xA144, 0xA144, 0xA944, 0xA144, 0x9924, 0x8903, 0x68E3,
-  0x48A2, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2040, 0x58C2, 0x8924, 0xA964, 0xB165,
-  0xB164, 0xA964, 0xA964, 0xA944, 0xA144, 0xA144, 0xA144, 0xA144, 0xA944, 0xA964, 0xA964, 0xB164,
-  0xB165, 0xA964, 0x8924, 0x58C2, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3061, 0x78E3, 0xA944, 0xB165, 0xA964, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA964, 0xB165, 0xA964, 0x7903, 0x3061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2041, 0x7903, 0xA964, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA964, 0xA965, 0xA164, 0xA144, 0xA144, 0xA144, 0xA144, 0xA164, 0xA965, 0xA964, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xB164, 0xA964, 0x7903, 0x2041, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x58C2, 0xA964, 0xB164, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0xA965,
-  0xA144, 0xA124, 0xA103, 0xA144, 0xA164, 0xA144, 0xA144, 0xA164, 0xA144, 0xA103, 0xA123, 0xA144,
-  0xA965, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xB164, 0xA964, 0x60C2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1820, 0x8923, 0xB165, 0xA144, 0xA144, 0xA144, 0xA144, 0xA164, 0xA965, 0xA144, 0xA103, 0xA0E2,
-  0xA144, 0xB207, 0xBB0B, 0xA9C6, 0xA144, 0xA164, 0xA164, 0xA144, 0xA9C6, 0xBB0B, 0xB207, 0xA144,
-  0xA0E2, 0xA103, 0xA144, 0xA965, 0xA164, 0xA144, 0xA144, 0xA144, 0xA144, 0xB165, 0x8923, 0x1820,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3061,
-  0xA144, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA965, 0xA144, 0xA0E2, 0xA144, 0xBAEB, 0xD4F3,
-  0xEEBA, 0xFFBE, 0xFFFF, 0xBACA, 0xA103, 0xA964, 0xA964, 0xA103, 0xBACA, 0xFFFF, 0xFFBE, 0xEEBA,
-  0xD513, 0xBAEB, 0xA144, 0xA0E2, 0xA144, 0xA965, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0xA144,
-  0x3061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4081, 0xA964,
-  0xA964, 0xA144, 0xA144, 0xA144, 0xA964, 0xA964, 0xA0E2, 0xA985, 0xCC0F, 0xEEDA, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xBAAA, 0xA103, 0xA964, 0xA964, 0xA103, 0xBAAA, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xEEBA, 0xCBEF, 0xA165, 0xA0E3, 0xA964, 0xA964, 0xA144, 0xA144, 0xA144, 0xA964,
-  0xA964, 0x4081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4081, 0xB164, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA965, 0xA123, 0xA103, 0xC3CE, 0xF71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xBAAA, 0xA103, 0xA965, 0xA965, 0xA103, 0xBAAA, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEEFB, 0xC38D, 0xA103, 0xA124, 0xA965, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xB164, 0x4081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3061, 0xA964, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA965, 0xA0E3, 0xAA07, 0xE617, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xB289, 0xA0E2, 0xA144, 0xA144, 0xA0E2, 0xB289, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xDDB6, 0xA9C6, 0xA103, 0xA965, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA964, 0x3061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1820, 0xA144, 0xA964, 0xA144, 0xA144,
-  0xA144, 0xA965, 0xA0E2, 0xBB0B, 0xF77D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xF6FB, 0xEE9A, 0xEEBA, 0xEEBA, 0xEE9A, 0xF6FB, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xEF1C, 0xBACA, 0xA0E2, 0xA965, 0xA144,
-  0xA144, 0xA144, 0xA964, 0xA144, 0x1820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8903, 0xA964, 0xA144, 0xA144, 0xA144,
-  0xA965, 0xA0E2, 0xC3AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEEBA, 0xCBCE, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFF9E, 0xC3AD, 0xF6FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xC36D, 0xA0E2, 0xA965,
-  0xA144, 0xA144, 0xA144, 0xA964, 0x8923, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x58A2, 0xB165, 0xA144, 0xA144, 0xA144, 0xA965,
-  0xA0E2, 0xC3AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDD75, 0xA985, 0x9881, 0xCC0F,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xBAEB, 0x98A1, 0xA9A5, 0xE5B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF7DF, 0xC36D, 0xA0E2,
-  0xA965, 0xA144, 0xA144, 0xA144, 0xB165, 0x58C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2040, 0xA964, 0xA144, 0xA144, 0xA144, 0xA965, 0xA0E3,
-  0xBB0B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xC3AE, 0xA0E3, 0xA144, 0xA985, 0xA0E2,
-  0xDD54, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xC38D, 0xA0C2, 0xA985, 0xA124, 0xA103, 0xCBEF, 0xFFBE, 0xFFFF, 0xFFFF, 0xF7BE, 0xF7BE, 0xBACA,
-  0xA103, 0xA965, 0xA144, 0xA144, 0xA144, 0xA964, 0x2040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7903, 0xB164, 0xA144, 0xA144, 0xA964, 0xA123, 0xA9E7,
-  0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xBAAA, 0xA0E3, 0xA985, 0xA144, 0xA144,
-  0xA124, 0xEE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCC0F,
-  0xA0C2, 0xA965, 0xA144, 0xA985, 0xA0E2, 0xC34C, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xEF3C,
-  0xA9C6, 0xA124, 0xA164, 0xA144, 0xA144, 0xB164, 0x7903, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2861, 0xB164, 0xA144, 0xA144, 0xA144, 0xA964, 0xA103, 0xE638,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xB227, 0xA103, 0xA965, 0xA964,
-  0xA123, 0xA9E6, 0xF75D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xD4B2, 0xA0C2,
-  0xA965, 0xA144, 0xA965, 0xA0E2, 0xC32C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xF7FF,
-  0xDDD6, 0xA103, 0xA964, 0xA144, 0xA144, 0xA144, 0xB164, 0x2861, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x78E3, 0xB164, 0xA144, 0xA144, 0xA965, 0xA0E2, 0xCBCE, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6DB, 0xA965, 0xA144, 0xA964,
-  0xA965, 0xA0E3, 0xBACA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xDD54, 0xA0E2, 0xA964,
-  0xA144, 0xA965, 0xA0E3, 0xBAAA, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D,
-  0xF7FF, 0xC38D, 0xA0E3, 0xA965, 0xA144, 0xA144, 0xB164, 0x78E3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2020, 0xA964, 0xA144, 0xA144, 0xA164, 0xA144, 0xA985, 0xF75C, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE617, 0xA103, 0xA164,
-  0xA144, 0xA965, 0xA0C2, 0xCC0F, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xE5D7, 0xA103, 0xA144, 0xA164,
-  0xA965, 0xA103, 0xB248, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,
-  0xF7BE, 0xEEDB, 0xA965, 0xA144, 0xA164, 0xA144, 0xA144, 0xA964, 0x2040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x58A2, 0xB165, 0xA144, 0xA144, 0xA965, 0xA0E2, 0xCC30, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xDD13, 0xA0E2,
-  0xA965, 0xA144, 0xA965, 0xA0E2, 0xDD54, 0xFFFF, 0xFFFF, 0xEE79, 0xA144, 0xA144, 0xA964, 0xA965,
-  0xA103, 0xA9E7, 0xF73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xF77D, 0xFFFF, 0xC3EF, 0xA0E2, 0xA965, 0xA144, 0xA144, 0xB165, 0x58A2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x8923, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xF6FB, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFF9D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xCBEF,
-  0xA0C2, 0xA965, 0xA164, 0xA144, 0xA123, 0xEEBA, 0xF71C, 0xA985, 0xA124, 0xA964, 0xA964, 0xA123,
-  0xA9A5, 0xF6DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9D, 0xFFDF,
-  0xF79E, 0xF7DF, 0xE679, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x8923, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2040, 0xA964, 0xA144, 0xA144, 0xA965, 0xA103, 0xBB0B, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xEE9A, 0xA9C6, 0xF6FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xBB0B, 0xA0E3, 0xA965, 0xA964, 0xA123, 0xB207, 0xB228, 0xA103, 0xA965, 0xA964, 0xA144, 0xA164,
-  0xEE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6FB, 0xA9E6, 0xEE9A,
-  0xFFFF, 0xF77D, 0xF7DF, 0xBACA, 0xA103, 0xA964, 0xA144, 0xA144, 0xA964, 0x2040, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x4882, 0xB165, 0xA144, 0xA144, 0xA965, 0xA0E2, 0xDD34, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xCC30, 0x9881, 0xA9E7, 0xF6DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF7D, 0xB227, 0xA103, 0xA965, 0xA964, 0xA124, 0xA124, 0xA964, 0xA164, 0xA144, 0xA123, 0xE618,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6DB, 0xB1E7, 0x9881, 0xCC30,
-  0xFFFF, 0xEF5D, 0xFFFF, 0xD4D2, 0xA0E2, 0xA965, 0xA144, 0xA144, 0xB165, 0x4882, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x68E3, 0xB164, 0xA144, 0xA144, 0xA144, 0xA144, 0xF6DB, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xB227, 0xA144, 0xA944, 0xD247, 0xF6DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xF6DB, 0xA965, 0xA144, 0xA964, 0xA164, 0xA964, 0xA164, 0xA144, 0xA103, 0xE596, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6FB, 0xD247, 0xA944, 0xA144, 0xB227,
-  0xFFBE, 0xF79E, 0xF7DF, 0xE679, 0xA144, 0xA144, 0xA144, 0xA144, 0xB164, 0x68E3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x8103, 0xA964, 0xA144, 0xA964, 0xA123, 0xB227, 0xFFDF, 0xFFFF, 0xFFFF, 0xEE9A,
-  0xA124, 0xA144, 0xB9A5, 0xD1C5, 0xD247, 0xF6DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xE5F7, 0xA103, 0xA144, 0xA164, 0xA144, 0xA144, 0xA0E2, 0xDD14, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6DA, 0xD248, 0xD1C5, 0xB9A5, 0xA144, 0xA124,
-  0xEE9A, 0xF7FF, 0xF79E, 0xEF5D, 0xAA07, 0xA124, 0xA164, 0xA144, 0xA964, 0x8103, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x9924, 0xA964, 0xA144, 0xA965, 0xA0E3, 0xBB2C, 0xFFFF, 0xFFDF, 0xFFFF, 0xDD34,
-  0xA0E2, 0xA164, 0xC1A5, 0xD227, 0xC984, 0xDB2B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xDD34, 0xA103, 0xA964, 0xA964, 0xA123, 0xD4D2, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDB4B, 0xC984, 0xD227, 0xC1A5, 0xA164, 0xA0E2,
-  0xDD34, 0xFFFF, 0xEF7D, 0xF7DF, 0xBAEB, 0xA103, 0xA964, 0xA144, 0xA964, 0x9924, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xA144, 0xA944, 0xA144, 0xA965, 0xA0E2, 0xCBEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xCC30,
-  0xA0E2, 0xA165, 0xC9C6, 0xD206, 0xD1A5, 0xDB2B, 0xFFFF, 0xFFFF, 0xFFFF, 0xE5B6, 0xB248, 0xBACA,
-  0xBAAA, 0xBAAA, 0xBAAA, 0xBACA, 0xA965, 0xA144, 0xA144, 0xA965, 0xBACA, 0xBAAA, 0xBAAA, 0xBAAA,
-  0xBACA, 0xB248, 0xE5B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xDB2B, 0xD1A5, 0xD206, 0xC1C6, 0xA165, 0xA0E2,
-  0xCC30, 0xFFFF, 0xEF5D, 0xF7FF, 0xC3AE, 0xA0E2, 0xA965, 0xA144, 0xA944, 0xA144, 0x1020, 0x0000,
-  0x0000, 0x1820, 0xA944, 0xA144, 0xA144, 0xA965, 0xA0C2, 0xD491, 0xFFFF, 0xFFDF, 0xFFFF, 0xC36D,
-  0xA0E3, 0xA965, 0xC9E6, 0xD206, 0xD1A5, 0xDB2B, 0xFFFF, 0xFFDF, 0xFFFF, 0xDCF3, 0x9881, 0xA124,
-  0xA103, 0xA103, 0xA103, 0xA103, 0xA144, 0xA144, 0xA144, 0xA144, 0xA103, 0xA103, 0xA103, 0xA103,
-  0xA124, 0x9881, 0xDCF3, 0xFFFF, 0xFFDF, 0xFFFF, 0xDB2B, 0xD1A5, 0xD206, 0xC9E6, 0xA965, 0xA0E2,
-  0xC38D, 0xFFFF, 0xEF5D, 0xFFFF, 0xCC30, 0xA0E2, 0xA965, 0xA144, 0xA144, 0xA944, 0x1820, 0x0000,
-  0x0000, 0x1820, 0xA144, 0xA144, 0xA144, 0xA965, 0xA0E2, 0xD4D2, 0xFFFF, 0xFFDF, 0xFFFF, 0xBB2C,
-  0xA0E3, 0xA965, 0xC9E6, 0xD206, 0xD1A5, 0xDB2B, 0xFFFF, 0xFFDF, 0xFFFF, 0xDD13, 0x98C2, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA124, 0xA144, 0xA144, 0xA144, 0xA144, 0xA124, 0xA144, 0xA144, 0xA144,
-  0xA144, 0x98C2, 0xDD13, 0xFFFF, 0xFFDF, 0xFFFF, 0xDB2B, 0xD1A5, 0xD206, 0xC9E6, 0xA965, 0xA0E3,
-  0xC32C, 0xFFFF, 0xEF7D, 0xFFFF, 0xCC91, 0xA0E2, 0xA965, 0xA144, 0xA144, 0xA144, 0x1820, 0x0000,
-  0x0000, 0x1820, 0xA144, 0xA144, 0xA144, 0xA965, 0xA0E2, 0xD4D2, 0xFFFF, 0xFFDF, 0xFFFF, 0xBB2C,
-  0xA0E3, 0xA965, 0xC9E6, 0xD206, 0xD1A5, 0xDB2B, 0xFFFF, 0xFFDF, 0xFFFF, 0xDD75, 0xA9A5, 0xB228,
-  0xB207, 0xB207, 0xB207, 0xB207, 0xA965, 0xA144, 0xA144, 0xA965, 0xB207, 0xB207, 0xB207, 0xB207,
-  0xB228, 0xA9A5, 0xDD75, 0xFFFF, 0xFFDF, 0xFFFF, 0xDB2B, 0xD1A5, 0xD206, 0xC9E6, 0xA965, 0xA0E3,
-  0xC32C, 0xFFFF, 0xEF7D, 0xFFFF, 0xCC91, 0xA0E2, 0xA965, 0xA144, 0xA144, 0xA144, 0x1820, 0x0000,
-  0x0000, 0x1820, 0xA944, 0xA144, 0xA144, 0xA965, 0xA0C2, 0xD491, 0xFFFF, 0xFFDF, 0xFFFF, 0xC36D,
-  0xA0E3, 0xA965, 0xC9E6, 0xD206, 0xD1A5, 0xDB2B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF,
-  0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xB248, 0xA123, 0xA123, 0xB248, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF,
-  0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDB2B, 0xD1A5, 0xD206, 0xC9E6, 0xA965, 0xA0E2,
-  0xC36D, 0xFFFF, 0xEF5D, 0xFFFF, 0xCC30, 0xA0E2, 0xA965, 0xA144, 0xA144, 0xA944, 0x1820, 0x0000,
-  0x0000, 0x1020, 0xA144, 0xA944, 0xA144, 0xA965, 0xA0E2, 0xCBEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xCC30,
-  0xA0E2, 0xA165, 0xC9C6, 0xD206, 0xD1A5, 0xDB2B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB268, 0xA123, 0xA123, 0xB268, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDB2B, 0xD1A5, 0xD206, 0xC1C6, 0xA165, 0xA0E2,
-  0xCC30, 0xFFFF, 0xEF5D, 0xF7FF, 0xC3AE, 0xA0E2, 0xA965, 0xA144, 0xA944, 0xA144, 0x1020, 0x0000,
-  0x0000, 0x0000, 0x9924, 0xA964, 0xA144, 0xA965, 0xA0E3, 0xBB2C, 0xFFFF, 0xFFDF, 0xFFFF, 0xDD34,
-  0xA0E2, 0xA164, 0xC1A5, 0xD227, 0xC984, 0xDB4B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB269, 0xA123, 0xA123, 0xB269, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDB4B, 0xC984, 0xD227, 0xC1A5, 0xA164, 0xA0E2,
-  0xDD34, 0xFFFF, 0xF77D, 0xF7DF, 0xBAEB, 0xA103, 0xA964, 0xA144, 0xA964, 0x9944, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x8103, 0xA964, 0xA144, 0xA964, 0xA123, 0xB227, 0xFFDF, 0xFFFF, 0xFFFF, 0xEE9A,
-  0xA124, 0xA144, 0xB9A5, 0xD1C5, 0xD248, 0xF6DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xF71C, 0xE5B6, 0xE5F7,
-  0xE5F7, 0xE5F7, 0xE5F7, 0xE5F7, 0xB207, 0xA124, 0xA124, 0xB207, 0xE5F7, 0xE5F7, 0xE5F7, 0xE5F7,
-  0xE5F7, 0xE5B6, 0xF71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6DA, 0xD248, 0xD1C5, 0xB9A5, 0xA144, 0xA124,
-  0xEE99, 0xF7DF, 0xF79E, 0xEF5D, 0xAA07, 0xA124, 0xA164, 0xA144, 0xA964, 0x8103, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x68E3, 0xB164, 0xA144, 0xA144, 0xA144, 0xA144, 0xF6DB, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xB227, 0xA144, 0xA944, 0xD247, 0xF6FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD4F3, 0x9861, 0xA103,
-  0xA0E3, 0xA0E3, 0xA0E3, 0xA0E3, 0xA144, 0xA144, 0xA144, 0xA144, 0xA0E3, 0xA0E3, 0xA0E3, 0xA0E3,
-  0xA103, 0x9861, 0xD4F3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6FB, 0xD247, 0xA944, 0xA144, 0xB228,
-  0xFFBE, 0xF79E, 0xF7DF, 0xE679, 0xA144, 0xA144, 0xA144, 0xA144, 0xB164, 0x68E3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x4882, 0xB165, 0xA144, 0xA144, 0xA965, 0xA0E2, 0xDD34, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xCC30, 0x9881, 0xB1E7, 0xF6DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDD34, 0xA103, 0xA9A5,
-  0xA985, 0xA985, 0xA985, 0xA985, 0xA164, 0xA144, 0xA144, 0xA164, 0xA985, 0xA985, 0xA985, 0xA985,
-  0xA9A5, 0xA103, 0xDD34, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6FB, 0xB1E7, 0x9881, 0xCC30,
-  0xFFFF, 0xEF5D, 0xFFFF, 0xD4D2, 0xA0E2, 0xA965, 0xA144, 0xA144, 0xB165, 0x4882, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2040, 0xA964, 0xA144, 0xA144, 0xA965, 0xA103, 0xBB0B, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xEE9A, 0xA9E6, 0xF6FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD4D3, 0x9860, 0xA0E3,
-  0xA0E2, 0xA0E2, 0xA0E2, 0xA0E2, 0xA144, 0xA144, 0xA144, 0xA144, 0xA0E2, 0xA0E2, 0xA0E2, 0xA0E2,
-  0xA0E3, 0x9860, 0xD4D3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6FB, 0xA9E6, 0xEE9A,
-  0xFFFF, 0xF77D, 0xF7DF, 0xBACA, 0xA103, 0xA964, 0xA144, 0xA144, 0xA964, 0x2040, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x8923, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xF6FB, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEEBA, 0xD4F3, 0xDD34,
-  0xDD14, 0xDD14, 0xDD14, 0xDD14, 0xA9E7, 0xA144, 0xA144, 0xA9E7, 0xDD14, 0xDD14, 0xDD14, 0xDD14,
-  0xDD34, 0xD4F3, 0xEEBA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xFFDF,
-  0xF79E, 0xF7DF, 0xE679, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x8923, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x58A2, 0xB165, 0xA144, 0xA144, 0xA965, 0xA0E2, 0xCC30, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB269, 0xA123, 0xA123, 0xB269, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF,
-  0xF77D, 0xFFFF, 0xC3EF, 0xA0E2, 0xA965, 0xA144, 0xA144, 0xB165, 0x58A2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2020, 0xA964, 0xA144, 0xA144, 0xA164, 0xA144, 0xA985, 0xF73C, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB248, 0xA123, 0xA123, 0xB248, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,
-  0xF7DF, 0xEEDB, 0xA965, 0xA144, 0xA164, 0xA144, 0xA144, 0xA964, 0x2040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x78E3, 0xB164, 0xA144, 0xA144, 0xA965, 0xA0E2, 0xCBCE, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB269, 0xA124, 0xA124, 0xB269, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF77D,
-  0xF7FF, 0xC38D, 0xA0E3, 0xA965, 0xA144, 0xA144, 0xB164, 0x78E3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2861, 0xB164, 0xA144, 0xA144, 0xA144, 0xA964, 0xA103, 0xE638,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB248, 0xA103, 0xA103, 0xB248, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D, 0xF7FF,
-  0xDDD6, 0xA103, 0xA964, 0xA144, 0xA144, 0xA144, 0xB164, 0x2861, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7903, 0xB164, 0xA144, 0xA144, 0xA964, 0xA123, 0xA9E7,
-  0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB289, 0xA964, 0xA964, 0xB289, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xF7BE, 0xEF3C,
-  0xA9C6, 0xA124, 0xA164, 0xA144, 0xA144, 0xB164, 0x7903, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2040, 0xA964, 0xA144, 0xA144, 0xA144, 0xA965, 0xA0E3,
-  0xBB0B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D, 0xF73C, 0xF73C, 0xF77D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xF79E, 0xF7BE, 0xBACA,
-  0xA103, 0xA965, 0xA144, 0xA144, 0xA144, 0xA964, 0x2040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x58C2, 0xB165, 0xA144, 0xA144, 0xA144, 0xA965,
-  0xA0E2, 0xC3AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF79E, 0xF7DF, 0xC36D, 0xA0E2,
-  0xA965, 0xA144, 0xA144, 0xA144, 0xB165, 0x58C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8923, 0xA964, 0xA144, 0xA144, 0xA144,
-  0xA965, 0xA0E2, 0xC3AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7DF, 0xF7BE, 0xC36D, 0xA0E2, 0xA965,
-  0xA144, 0xA144, 0xA144, 0xA964, 0x8923, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1820, 0xA144, 0xA964, 0xA144, 0xA144,
-  0xA144, 0xA965, 0xA0E2, 0xBB0B, 0xF77D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xF6FB, 0xEE9A, 0xEEBA, 0xEEBA, 0xEE9A, 0xF6FB, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xEF3C, 0xBACA, 0xA0E2, 0xA965, 0xA144,
-  0xA144, 0xA144, 0xA964, 0xA144, 0x1820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3061, 0xA964, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA965, 0xA0E3, 0xAA07, 0xE617, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xB289, 0xA0E2, 0xA144, 0xA144, 0xA0E2, 0xB289, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDDB6, 0xA9C6, 0xA103, 0xA965, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA964, 0x3061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4081, 0xB164, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA965, 0xA123, 0xA103, 0xC3AE, 0xF71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xBAAA, 0xA103, 0xA965, 0xA965, 0xA103, 0xBAAA, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEEDA, 0xC38D, 0xA103, 0xA124, 0xA965, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xB165, 0x4081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4081, 0xA964,
-  0xA964, 0xA144, 0xA144, 0xA144, 0xA964, 0xA964, 0xA0E2, 0xA985, 0xCC0F, 0xEEBA, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xBAAA, 0xA103, 0xA964, 0xA964, 0xA103, 0xBAAA, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xEE9A, 0xC3CE, 0xA965, 0xA0E3, 0xA964, 0xA964, 0xA144, 0xA144, 0xA144, 0xA964,
-  0xA964, 0x4081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3061,
-  0xA144, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA965, 0xA144, 0xA0E2, 0xA144, 0xBAEB, 0xD4F3,
-  0xEEBA, 0xFFBE, 0xFFFF, 0xBACA, 0xA103, 0xA964, 0xA964, 0xA103, 0xBACA, 0xFFFF, 0xFFBE, 0xEEBA,
-  0xD4F3, 0xBACA, 0xA144, 0xA0E2, 0xA144, 0xA965, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0xA144,
-  0x3061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1820, 0x8923, 0xB165, 0xA144, 0xA144, 0xA144, 0xA144, 0xA164, 0xA965, 0xA144, 0xA103, 0xA0E2,
-  0xA144, 0xB207, 0xBB0B, 0xA9C6, 0xA144, 0xA164, 0xA164, 0xA144, 0xA9C6, 0xBB0B, 0xB207, 0xA144,
-  0xA0E2, 0xA103, 0xA144, 0xA965, 0xA164, 0xA144, 0xA144, 0xA144, 0xA144, 0xB165, 0x8923, 0x1820,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x58A2, 0xA964, 0xB164, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0xA965,
-  0xA144, 0xA124, 0xA103, 0xA144, 0xA164, 0xA144, 0xA144, 0xA164, 0xA144, 0xA103, 0xA123, 0xA144,
-  0xA965, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xB164, 0xA944, 0x60C2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2041, 0x7903, 0xA964, 0xB164, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA964, 0xA965, 0xA164, 0xA144, 0xA144, 0xA144, 0xA144, 0xA164, 0xA965, 0xA964, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0xA964, 0x7903, 0x2041, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3061, 0x7903, 0xA944, 0xB165, 0xA964, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA964, 0xB165, 0xA964, 0x7903, 0x3061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2040, 0x58C2, 0x8923, 0xA964, 0xB165,
-  0xB164, 0xA964, 0xA964, 0xA944, 0xA144, 0xA144, 0xA144, 0xA144, 0xA944, 0xA964, 0xA964, 0xB164,
-  0xB165, 0xA964, 0x8923, 0x58C2, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2040, 0x4882,
-  0x68E3, 0x8903, 0x9924, 0xA144, 0xA944, 0xA144, 0xA144, 0xA944, 0xA144, 0x9924, 0x8903, 0x68E3,
-  0x4882, 0x2040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x1020, 0x1820, 0x1820, 0x1820, 0x1820, 0x1020, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
@@ -1,308 +0,0 @@
-#pragma once
-#include <Arduino.h>
-
-constexpr int kIcon5Width = 60;
-constexpr int kIcon5Height = 60;
-
-const uint16_t kIcon5Data[3600] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20E1, 0x20E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3962, 0x6A83, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1060, 0xB4C9, 0xFEAC, 0xFEAC, 0xB4C9, 0x1060, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x6A83, 0x3962, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0xE548, 0x82E4, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x9C07, 0xFF4E, 0xF68C, 0xF68C, 0xFF4E, 0x9C07, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x82E4, 0xE548, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB406, 0xFE29, 0x7AC4, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18A1, 0xF64C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xF64C, 0x18A1, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x7AC4, 0xFE29, 0xB426, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x7AA4, 0xFDC8, 0xFDA8, 0xA3A5, 0x0000, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x7306, 0xFF0D, 0xF66C, 0xFE8C, 0xFE8C, 0xF66C, 0xFF0D, 0x7305, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0000, 0xA385, 0xFDA8, 0xFDC8, 0x7AA4, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x20C1, 0xED68, 0xF568, 0xF568, 0xEDA9, 0x18A1, 0x0000, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0xD58A, 0xFECD, 0xF68C, 0xFE8C, 0xFE8C, 0xF68C, 0xFECD, 0xD58A, 0x0820, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0000, 0x18C1, 0xED89, 0xF568, 0xF568, 0xF568, 0x20E1, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x9B65, 0xFDC8, 0xED48, 0xED68, 0xFECD, 0xC54A, 0x20E1, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x3841,
-  0x5841, 0x9A05, 0xFECD, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFECD, 0x9A05, 0x6041,
-  0x3861, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2901, 0xCD6A, 0xFECD, 0xED68, 0xED48, 0xFDC8, 0x9B85, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1880, 0xE547, 0xF588, 0xED47, 0xF60A, 0xFE8D, 0xFECD, 0xEE4C, 0xBCE9, 0x2922,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4061, 0x80A2, 0x90E3,
-  0x8862, 0xD469, 0xFEED, 0xF66C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xF66C, 0xFEED, 0xD469, 0x8862,
-  0x90E3, 0x80A2, 0x4861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2922, 0xBCE9, 0xEE4C, 0xFECD, 0xFE8D, 0xF60A, 0xED47, 0xF588, 0xE528, 0x1880, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x6243, 0xFDC8, 0xED48, 0xF588, 0xFE8C, 0xFE8C, 0xF68C, 0xFE8C, 0xFF2E, 0x39C3,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1820, 0x70A2, 0x90C3, 0x88C3, 0x8082,
-  0x9144, 0xF66C, 0xFEAD, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFEAD, 0xF66C, 0x9144,
-  0x8082, 0x88C3, 0x90C3, 0x70A2, 0x1820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x39C3, 0xFF2E, 0xFE8C, 0xF68C, 0xFE8C, 0xFE8C, 0xF588, 0xED48, 0xFDC8, 0x6243, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xABC6, 0xFDC8, 0xED47, 0xF5EA, 0xFEAD, 0xFE8C, 0xFE8C, 0xF66C, 0xFECD, 0x7224,
-  0x4821, 0x6082, 0x5882, 0x5061, 0x3041, 0x0000, 0x1820, 0x80A2, 0x90C3, 0x80C3, 0x88C3, 0x8062,
-  0xBB05, 0xFE2A, 0xF62B, 0xFE6C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE6C, 0xF62B, 0xFE2A, 0xBB05,
-  0x8062, 0x88C3, 0x80A3, 0x90C3, 0x80A2, 0x1820, 0x0000, 0x3041, 0x5061, 0x5882, 0x6082, 0x4821,
-  0x7224, 0xFECD, 0xF66C, 0xFE8C, 0xFE8C, 0xFEAD, 0xF5EA, 0xED47, 0xFDC8, 0xABE5, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xD4C7, 0xF5A8, 0xED48, 0xF62B, 0xFEAD, 0xFE8C, 0xFE8C, 0xF66C, 0xFEED, 0xC367,
-  0x8842, 0x9103, 0x90C3, 0x90C3, 0x90C3, 0x70A2, 0x78A2, 0x88C3, 0x80C3, 0x88C3, 0x88A3, 0x88C3,
-  0xE4C7, 0xF588, 0xED48, 0xF588, 0xF5A9, 0xF5A9, 0xF5A9, 0xF5A9, 0xF588, 0xED48, 0xF588, 0xE4C7,
-  0x88C3, 0x88A3, 0x88C3, 0x80C3, 0x88C3, 0x78A2, 0x70A2, 0x90C3, 0x90C3, 0x90C3, 0x9103, 0x8842,
-  0xC387, 0xFEED, 0xF66C, 0xFE8C, 0xFE8C, 0xFEAD, 0xF62B, 0xED48, 0xF5A8, 0xD4C7, 0x0020, 0x0000,
-  0x0000, 0x1881, 0xED48, 0xF568, 0xF568, 0xFE6C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFEAD, 0xEE0B,
-  0x9123, 0x7842, 0x80A2, 0x80C3, 0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8062, 0xAA85,
-  0xFE08, 0xED68, 0xED68, 0xED68, 0xED68, 0xED48, 0xED48, 0xED68, 0xED68, 0xED68, 0xED68, 0xFE08,
-  0xAA85, 0x8062, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80C3, 0x80C3, 0x80A2, 0x7842, 0x9123,
-  0xEE0B, 0xFEAD, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE6C, 0xF568, 0xF568, 0xED48, 0x1881, 0x0000,
-  0x0000, 0x20C1, 0xF568, 0xF568, 0xF588, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFEAD,
-  0xEDCB, 0xAA65, 0x9103, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80A2, 0x9983,
-  0xCBE6, 0xF568, 0xFDC8, 0xF5A8, 0xF588, 0xF588, 0xF588, 0xF588, 0xF5A8, 0xFDC8, 0xF568, 0xCBE6,
-  0x9984, 0x80A2, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x9103, 0xAA65, 0xEDCB,
-  0xFEAD, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xF588, 0xF568, 0xF588, 0x20C1, 0x0000,
-  0x0000, 0x20C1, 0xF568, 0xF568, 0xF5A9, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFEAC, 0xFECD,
-  0xFEED, 0xFECD, 0xEDAB, 0x9103, 0x80A2, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8082,
-  0x8062, 0x9983, 0xBB05, 0xD447, 0xE4E7, 0xED27, 0xED27, 0xE4E7, 0xD447, 0xBB05, 0x9983, 0x8062,
-  0x8082, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80A2, 0x9103, 0xEDAB, 0xFECD, 0xFEED,
-  0xFECD, 0xFEAC, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xF5A9, 0xF568, 0xF568, 0x20C1, 0x0000,
-  0x0000, 0x20C1, 0xF588, 0xF568, 0xF5C9, 0xFEAD, 0xFE8C, 0xFE8C, 0xFE8C, 0xFEAC, 0xCB27, 0xD3C8,
-  0xEDCB, 0xFEED, 0xF68C, 0x9123, 0x80A2, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x8082, 0x8062, 0x8082, 0x88E3, 0x9103, 0x9103, 0x88E3, 0x8082, 0x8062, 0x8082, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80A2, 0x9123, 0xF68C, 0xFEED, 0xEDCB,
-  0xD3C8, 0xCB27, 0xFEAC, 0xFE8C, 0xFE8C, 0xFE8C, 0xFEAD, 0xF5C9, 0xF568, 0xF588, 0x20C1, 0x0000,
-  0x0000, 0x18A1, 0xED48, 0xF568, 0xF5C9, 0xFEAD, 0xFE8C, 0xFECD, 0xFEAD, 0xF60B, 0xB185, 0xA904,
-  0xB185, 0xCB07, 0xDCA9, 0x9123, 0x80A2, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88A3, 0x88A3, 0x88A3, 0x88A3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80A2, 0x9123, 0xDCA9, 0xCB07, 0xB185,
-  0xA904, 0xB185, 0xF60B, 0xFEAD, 0xFECD, 0xFE8C, 0xFEAD, 0xF5C9, 0xF568, 0xED48, 0x18A0, 0x0000,
-  0x0000, 0x0020, 0xD4C7, 0xF588, 0xF5A9, 0xFEED, 0xD3C8, 0xD3A8, 0xFF0D, 0xE52A, 0xB124, 0xB1A5,
-  0xB165, 0xB124, 0xB124, 0x88E3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88A2, 0x8062, 0x8062, 0x88A3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88E3, 0xB124, 0xB124, 0xB165,
-  0xB1A5, 0xB124, 0xE52A, 0xFF0D, 0xD3A8, 0xD3C8, 0xFEED, 0xF5A9, 0xF588, 0xD4C7, 0x0020, 0x0000,
-  0x0000, 0x0000, 0xABE5, 0xFDA8, 0xED68, 0xFEAC, 0xC266, 0xA8C4, 0xCAE7, 0xCB27, 0xB124, 0xB185,
-  0xB165, 0xB144, 0xA924, 0x8062, 0x8062, 0x80A2, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x8062, 0x88E3, 0xA225, 0xA225, 0x88E3, 0x8082, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80A2, 0x8062, 0x8062, 0xA924, 0xB144, 0xB165,
-  0xB185, 0xB124, 0xCB27, 0xCAE7, 0xA8C3, 0xC266, 0xFEAC, 0xED68, 0xFDA8, 0xABE5, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x6243, 0xFE09, 0xF5C8, 0xF60B, 0xB1A5, 0xB185, 0xB144, 0xB144, 0xB185, 0xB144,
-  0xB165, 0xCAC7, 0xCB07, 0xAA86, 0xA205, 0x9103, 0x8062, 0x8082, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x8062, 0xAA85, 0xEE0B, 0xFECD, 0xFECD, 0xEDCB, 0xA204, 0x8082, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8082, 0x8062, 0x9103, 0xA205, 0xAA86, 0xCB07, 0xC2A6, 0xB164,
-  0xB144, 0xB185, 0xB144, 0xB144, 0xB185, 0xB1A5, 0xF60B, 0xF5C8, 0xFE09, 0x6243, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1881, 0xD3E6, 0xDC27, 0xD387, 0xB144, 0xB185, 0xB185, 0xB185, 0xB164, 0xB9C5,
-  0xED6B, 0xFEED, 0xFECD, 0xFEED, 0xFEAD, 0xF62C, 0xD489, 0x99E4, 0x8062, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x8082, 0x99E4, 0xFEAD, 0xFECD, 0xFE8C, 0xFE6C, 0xFECD, 0xF5E9, 0x9983, 0x8082, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x8062, 0x99E4, 0xD489, 0xF62C, 0xFEAD, 0xFEED, 0xFECD, 0xFECD, 0xED4A,
-  0xB9A5, 0xB164, 0xB185, 0xB185, 0xB185, 0xB144, 0xD387, 0xDC27, 0xD3E6, 0x1881, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x70A3, 0xB945, 0xA924, 0xB165, 0xB165, 0xB165, 0xB185, 0xB124, 0xDC49,
-  0xFF2D, 0xF66C, 0xFE6C, 0xFE6C, 0xFE8C, 0xFEAC, 0xFEED, 0xFEAD, 0xC3C8, 0x8082, 0x88A2, 0x88C3,
-  0x88C3, 0x8062, 0xD469, 0xFEED, 0xF66C, 0xFE8C, 0xFE8C, 0xF68C, 0xFE4A, 0xC385, 0x8062, 0x88C3,
-  0x88C3, 0x88A2, 0x8082, 0xC3C8, 0xFEAD, 0xFEED, 0xFEAC, 0xFE8C, 0xFE6C, 0xFE6C, 0xF66C, 0xFF2D,
-  0xDC28, 0xB104, 0xB185, 0xB165, 0xB165, 0xB165, 0xA924, 0xB945, 0x70A3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x58A2, 0xC185, 0xB185, 0xB165, 0xB165, 0xB165, 0xB185, 0xB144, 0xE488,
-  0xFE8C, 0xFE8D, 0xFEAD, 0xFEAD, 0xFEAD, 0xFE8C, 0xF66C, 0xFE8C, 0xFF0D, 0xD4A9, 0x8082, 0x88C3,
-  0x88C3, 0x8082, 0xDD2A, 0xFECD, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8D, 0xFE0A, 0xD426, 0x8082, 0x88C3,
-  0x88C3, 0x8082, 0xD4A9, 0xFF0D, 0xFE8C, 0xF66C, 0xFE8C, 0xFEAD, 0xFEAD, 0xFEAD, 0xFE8D, 0xFE8C,
-  0xE487, 0xB144, 0xB185, 0xB165, 0xB165, 0xB165, 0xB185, 0xC185, 0x58A2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2020, 0x88C3, 0xA944, 0xB185, 0xB165, 0xB165, 0xB165, 0xB185, 0xB124, 0xD386,
-  0xF5E8, 0xF5CA, 0xF5EA, 0xF60A, 0xF62B, 0xF66C, 0xFE8C, 0xFEAD, 0xF66C, 0xFF0D, 0xC3E8, 0x8062,
-  0x88E3, 0x8062, 0xD469, 0xFF0D, 0xF66C, 0xFE8C, 0xFEAD, 0xF64C, 0xFDC8, 0xCBA6, 0x8062, 0x88E3,
-  0x8062, 0xC3E8, 0xFF0D, 0xF66C, 0xFEAD, 0xFE8C, 0xF66C, 0xF62B, 0xF60A, 0xF5EA, 0xF5CA, 0xF5E8,
-  0xD386, 0xB124, 0xB185, 0xB165, 0xB165, 0xB165, 0xB185, 0xA944, 0x88C3, 0x2020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x6082, 0x88C3, 0x90E3, 0xB985, 0xB165, 0xB165, 0xB165, 0xB185, 0xB164, 0xB9A5,
-  0xE487, 0xF546, 0xED26, 0xED26, 0xED26, 0xF547, 0xF588, 0xF5EA, 0xF66C, 0xFE8D, 0xFECD, 0xA1E4,
-  0x8082, 0x8082, 0x99C4, 0xFEAC, 0xFECD, 0xFE8C, 0xF64B, 0xF5C9, 0xF568, 0x9984, 0x80A2, 0x8082,
-  0xA1E4, 0xFECD, 0xFE8D, 0xF66C, 0xF5EA, 0xF588, 0xF547, 0xED26, 0xED26, 0xED26, 0xF546, 0xE467,
-  0xB1A5, 0xB164, 0xB165, 0xB165, 0xB165, 0xB165, 0xB985, 0x90E3, 0x88C3, 0x6082, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x80A2, 0x88C3, 0x88C3, 0xA944, 0xB185, 0xB165, 0xB165, 0xB165, 0xB185, 0xB165,
-  0xB103, 0xD46D, 0xF6F7, 0xEE95, 0xEE52, 0xEDEE, 0xED89, 0xED26, 0xF547, 0xF5C9, 0xFECD, 0xD4C9,
-  0x8062, 0x88E3, 0x8082, 0xAA25, 0xED49, 0xF5E9, 0xF588, 0xE4E7, 0xA204, 0x8082, 0x88E3, 0x8062,
-  0xD4C9, 0xFECD, 0xF5C9, 0xF547, 0xED26, 0xED89, 0xEDEE, 0xEE52, 0xEE95, 0xF6F7, 0xD44D, 0xB103,
-  0xB165, 0xB185, 0xB165, 0xB165, 0xB165, 0xB185, 0xA944, 0x88C3, 0x88C3, 0x80A2, 0x0800, 0x0000,
-  0x0000, 0x1020, 0x88C3, 0x88C3, 0x80A2, 0x90E3, 0xB165, 0xB185, 0xB165, 0xB165, 0xB185, 0xB123,
-  0xD491, 0xF7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xF77C, 0xF6D7, 0xEDEE, 0xED27, 0xF567, 0xF5EA,
-  0x9143, 0x80A2, 0x88C3, 0x8062, 0x88C2, 0xA1C4, 0xA1C4, 0x88E3, 0x8082, 0x88C3, 0x80A2, 0x9143,
-  0xF5EA, 0xF567, 0xED27, 0xEDEE, 0xF6D7, 0xF77C, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0xD491,
-  0xB123, 0xB185, 0xB165, 0xB165, 0xB185, 0xB165, 0x90E3, 0x80A2, 0x88C3, 0x88C3, 0x1020, 0x0000,
-  0x0000, 0x1020, 0x88C3, 0x88C3, 0x88C3, 0x80A2, 0x90E3, 0xB164, 0xB985, 0xB185, 0xB123, 0xC32C,
-  0xF7FF, 0xFFDE, 0xD699, 0x738D, 0x7BCE, 0xDEFB, 0xF7DF, 0xF7BF, 0xF7BF, 0xF6F8, 0xEDAC, 0xF566,
-  0xA1E4, 0x8082, 0x88C3, 0x88C3, 0x88A3, 0x8082, 0x8082, 0x88A3, 0x88C3, 0x88C3, 0x8082, 0xA1E4,
-  0xF566, 0xEDAC, 0xF6F8, 0xF7BF, 0xF7BF, 0xF7DF, 0xDEFB, 0x7BCE, 0x738D, 0xD699, 0xFFDE, 0xF7FF,
-  0xC32C, 0xB123, 0xB185, 0xB985, 0xB164, 0x90E3, 0x80A2, 0x88C3, 0x88C3, 0x88C3, 0x1020, 0x0000,
-  0x0000, 0x0800, 0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x80A2, 0x88C3, 0x9904, 0xA965, 0xA903, 0xDD75,
-  0xF7FF, 0xF79E, 0x632C, 0x39C7, 0x31A6, 0x7BCF, 0xFFDF, 0xF77D, 0xF79E, 0xF7BF, 0xF79E, 0xF6D4,
-  0xAA65, 0x8062, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8062, 0xAA65,
-  0xF6D4, 0xF79E, 0xF7BF, 0xF79E, 0xF77D, 0xFFDF, 0x7BCF, 0x31A6, 0x39C7, 0x632C, 0xF79E, 0xF7FF,
-  0xDD75, 0xA903, 0xA965, 0x9904, 0x88C3, 0x80A2, 0x88C3, 0x88C3, 0x88C3, 0x80C3, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x7082, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80A2, 0x88C3, 0x8882, 0xD5D7,
-  0xF7FF, 0xF79E, 0x5AEB, 0x39E7, 0x39C7, 0x738E, 0xFFDF, 0xF79D, 0xF79E, 0xF79E, 0xF79F, 0xFF57,
-  0xAA65, 0x8062, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8062, 0xAA65,
-  0xFF57, 0xF79F, 0xF79E, 0xF79E, 0xF79D, 0xFFDF, 0x738E, 0x39C7, 0x39E7, 0x5AEB, 0xF79E, 0xF7FF,
-  0xD5D7, 0x8882, 0x88C3, 0x80A2, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x7082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3841, 0x90C3, 0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8041, 0xC492,
-  0xFFFF, 0xF7BE, 0xC638, 0x5AEB, 0x632C, 0xD69A, 0xFFDF, 0xF79E, 0xF7BF, 0xF75B, 0xF6D1, 0xFDE8,
-  0xA1E3, 0x8082, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8082, 0xA1E3,
-  0xFDE8, 0xF6D1, 0xF75B, 0xF7BF, 0xF79E, 0xFFDF, 0xD69A, 0x632C, 0x5AEB, 0xC638, 0xF7BE, 0xFFFF,
-  0xC492, 0x8041, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80C3, 0x90C3, 0x3841, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x68A2, 0x90C3, 0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8082, 0x9186,
-  0xEF5D, 0xF7DF, 0xFFDF, 0xF7BF, 0xF7BF, 0xFFDF, 0xF79E, 0xF75A, 0xF6D3, 0xFE8D, 0xFE4A, 0xED48,
-  0x9143, 0x80A2, 0x88C3, 0x8082, 0x8082, 0x8082, 0x8082, 0x8082, 0x80A2, 0x88C3, 0x80A2, 0x9143,
-  0xED48, 0xFE4A, 0xFE8D, 0xF6D3, 0xF75A, 0xF79E, 0xFFDF, 0xF7BF, 0xF7BF, 0xFFDF, 0xF7DF, 0xEF5D,
-  0x9186, 0x8082, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80C3, 0x90C3, 0x68A2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1000, 0x78A2, 0x90C3, 0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x88E3, 0x8041,
-  0xA249, 0xF75B, 0xF739, 0xF738, 0xF716, 0xF6D3, 0xF6AF, 0xFE6C, 0xFE8B, 0xF66C, 0xF5C9, 0xD406,
-  0x8082, 0x88C3, 0x8082, 0x9143, 0x99C4, 0x99A4, 0x99A4, 0x99C4, 0x9143, 0x8082, 0x88C3, 0x8082,
-  0xD406, 0xF5C9, 0xF66C, 0xFE8B, 0xFE6C, 0xF6AF, 0xF6D3, 0xF716, 0xF738, 0xF739, 0xF75B, 0xA249,
-  0x8041, 0x88E3, 0x88C3, 0x88C3, 0x88C3, 0x80C3, 0x90C3, 0x78A2, 0x1000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x6082, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88A2, 0x88E3,
-  0xD488, 0xFE8C, 0xFE8C, 0xFE6B, 0xFE6B, 0xFE8B, 0xFE8C, 0xFEAD, 0xF64C, 0xED68, 0xF5A8, 0xA204,
-  0x8082, 0x88C3, 0xC386, 0xF568, 0xF588, 0xF588, 0xF588, 0xF588, 0xF568, 0xC386, 0x88C3, 0x8082,
-  0xA204, 0xF5A8, 0xED68, 0xF64C, 0xFEAD, 0xFE8C, 0xFE8B, 0xFE6B, 0xFE6B, 0xFE8C, 0xFE8C, 0xD468,
-  0x88E3, 0x88A2, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x6082, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5882, 0x90C3, 0x80C3, 0x88C3, 0x88C3, 0x8062, 0xBB46,
-  0xFF2D, 0xFEAD, 0xFEAD, 0xFEAD, 0xFEAD, 0xFEAD, 0xFE6C, 0xF5EA, 0xED48, 0xFDC8, 0xCBA6, 0x8082,
-  0x8082, 0xB2A5, 0xFDE8, 0xED68, 0xED68, 0xF568, 0xF568, 0xED68, 0xED68, 0xFDE8, 0xB2A5, 0x8082,
-  0x8082, 0xCBA6, 0xFDC8, 0xED48, 0xF5EA, 0xFE6C, 0xFEAD, 0xFEAD, 0xFEAD, 0xFEAD, 0xFEAD, 0xFF2D,
-  0xBB46, 0x8062, 0x88C3, 0x88C3, 0x80C3, 0x90C3, 0x5882, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8082, 0xD426,
-  0xF5C9, 0xF60A, 0xF62B, 0xF62B, 0xF60A, 0xF5C9, 0xED68, 0xED47, 0xFDC8, 0xD447, 0x88C3, 0x88C3,
-  0x8082, 0xD3E6, 0xF5A8, 0xED68, 0xF568, 0xF568, 0xF568, 0xF568, 0xED68, 0xF5A8, 0xD3E6, 0x8082,
-  0x88C3, 0x88C3, 0xD447, 0xFDC8, 0xED47, 0xED68, 0xF5C9, 0xF60A, 0xF62B, 0xF62B, 0xF60A, 0xF5C9,
-  0xD426, 0x8082, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2820, 0x90C3, 0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x8062, 0xC386,
-  0xFDC8, 0xED27, 0xED47, 0xED47, 0xED47, 0xF568, 0xF5A8, 0xF5A8, 0xCBA6, 0x88C3, 0x80A2, 0x88C3,
-  0x8062, 0xC366, 0xFDC8, 0xED48, 0xF568, 0xF568, 0xF568, 0xF568, 0xED48, 0xFDC8, 0xC366, 0x8062,
-  0x88C3, 0x80A2, 0x88C3, 0xCBA6, 0xF5C8, 0xF5A8, 0xF568, 0xED47, 0xED47, 0xED47, 0xED27, 0xFDC8,
-  0xC386, 0x8062, 0x88C3, 0x88C3, 0x88C3, 0x80C3, 0x90C3, 0x2820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2841, 0x90C3, 0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x80A2, 0x9143,
-  0xE4C7, 0xFDC8, 0xF5C8, 0xF5C8, 0xF5A8, 0xED68, 0xD447, 0xA204, 0x8082, 0x88A3, 0x88C3, 0x88C3,
-  0x80A2, 0x9143, 0xED68, 0xF588, 0xED68, 0xF568, 0xF568, 0xED68, 0xF588, 0xED68, 0x9143, 0x80A2,
-  0x88C3, 0x88C3, 0x88A3, 0x8082, 0xA204, 0xD447, 0xED68, 0xF5A8, 0xF5C8, 0xF5C8, 0xFDC8, 0xE4C7,
-  0x9123, 0x80A2, 0x88C3, 0x88C3, 0x88C3, 0x80C3, 0x90C3, 0x2841, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2820, 0x90C3, 0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8082,
-  0x8903, 0xB285, 0xB2C5, 0xB2A5, 0xAA44, 0x9163, 0x8082, 0x8082, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88E3, 0x7841, 0xAA03, 0xF567, 0xED46, 0xF546, 0xF546, 0xED46, 0xF567, 0xAA03, 0x7841, 0x88E3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8062, 0x8082, 0x9163, 0xAA44, 0xB2A5, 0xB2C5, 0xB285, 0x88E3,
-  0x8082, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80C3, 0x90C3, 0x2820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x8082, 0x8062, 0x8082, 0x8062, 0x8082, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x8082, 0x9186, 0xC471, 0xEEB6, 0xF6D6, 0xF6D6, 0xF6D6, 0xF6D6, 0xEEB6, 0xC471, 0x9186, 0x8082,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8082, 0x8062, 0x8082, 0x8062, 0x8082, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6882, 0x90C3, 0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x8062, 0x8082, 0x8082, 0x8062, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8082,
-  0x9186, 0xEF1C, 0xFFFF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xFFFF, 0xEF1C, 0x9186,
-  0x8082, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8062, 0x8082, 0x8082, 0x8062,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80C3, 0x90C3, 0x6882, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2020, 0x90C3, 0x88C3, 0x88C3, 0x88C3, 0x88A2, 0x88A2,
-  0xBB27, 0xDCEA, 0xDD0A, 0xBB87, 0x88E3, 0x80A2, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8041,
-  0xC471, 0xFFFF, 0xEF5D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xEF5D, 0xFFFF, 0xC471,
-  0x8041, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80A2, 0x88E3, 0xBB87, 0xDD0A, 0xDCEA, 0xBB27,
-  0x88A2, 0x88A2, 0x88C3, 0x88C3, 0x88C3, 0x90C3, 0x2020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4061, 0x90C3, 0x88C3, 0x88C3, 0x88A2, 0xD4A9,
-  0xFF2D, 0xFECD, 0xFECD, 0xFF2D, 0xE54A, 0x88C3, 0x88A2, 0x80A2, 0x8062, 0x88C3, 0x88E3, 0x8041,
-  0xCD14, 0xFFFF, 0xF77D, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF77D, 0xFFFF, 0xCD14,
-  0x8041, 0x88E3, 0x88C3, 0x8062, 0x80A2, 0x88A2, 0x88C3, 0xE54A, 0xFF2D, 0xFECD, 0xFECD, 0xFF2D,
-  0xD4A9, 0x88A2, 0x88C3, 0x88C3, 0x90C3, 0x4041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3841, 0x88C3, 0x8842, 0xB2C6, 0xFF2D,
-  0xF66C, 0xFE8C, 0xFE8C, 0xF66C, 0xFECD, 0xE58B, 0xE58B, 0xE58B, 0xBB67, 0x80A2, 0x88E3, 0x8041,
-  0xCCF4, 0xFFFF, 0xF77D, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF77D, 0xFFFF, 0xCCF4,
-  0x8041, 0x88E3, 0x80A2, 0xBB47, 0xE58B, 0xE58B, 0xE58B, 0xFECD, 0xF66C, 0xFE8C, 0xFE8C, 0xF66C,
-  0xFF2D, 0xB2C6, 0x8842, 0x88C3, 0x3841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0x5881, 0xE54A, 0xFECD,
-  0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFECD, 0xFECD, 0xFECD, 0xFF2D, 0xD469, 0x8042, 0x8061,
-  0xCD33, 0xFFFF, 0xF79E, 0xF79E, 0xF79F, 0xF77D, 0xF77D, 0xF79F, 0xF79E, 0xF79E, 0xFFFF, 0xCD33,
-  0x8061, 0x8062, 0xD469, 0xFF2D, 0xFECD, 0xFECD, 0xFECD, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C,
-  0xFECD, 0xE54A, 0x5881, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xB4C8, 0xFEED, 0xF66C,
-  0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFEAC, 0xD469, 0xEDAB,
-  0xF68D, 0xF6AF, 0xF738, 0xF77C, 0xF6D1, 0xFE8E, 0xFE8E, 0xF6D1, 0xF77C, 0xF738, 0xF6AF, 0xF68D,
-  0xEDAB, 0xD489, 0xFEAC, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C,
-  0xF66C, 0xFEED, 0xB4A8, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5A03, 0xFDE9, 0xF62B, 0xFEAD,
-  0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFEED, 0xFECD,
-  0xFE8C, 0xFE8B, 0xFE8C, 0xFE8D, 0xFE8B, 0xFE8C, 0xFE8C, 0xFE8B, 0xFE8D, 0xFE8C, 0xFE8B, 0xFE8C,
-  0xFECD, 0xFEED, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C,
-  0xFEAD, 0xF62B, 0xFDE9, 0x5A03, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B24, 0xFDA8, 0xEDA9, 0xFEAD,
-  0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xF68C, 0xFE8C,
-  0xFE8C, 0xFE8D, 0xFE8C, 0xFE8C, 0xFE8D, 0xFE8C, 0xFE8C, 0xFE8D, 0xFE8C, 0xFE8C, 0xFE8D, 0xFE8C,
-  0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C,
-  0xFEAD, 0xEDA9, 0xFDA8, 0x8B24, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x82E4, 0xFDC8, 0xED47, 0xF62B,
-  0xFEAD, 0xFEAD, 0xFEAD, 0xFEAD, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C,
-  0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C,
-  0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFEAD, 0xFEAD, 0xFEAD, 0xFEAD,
-  0xF62B, 0xED48, 0xFDC8, 0x82E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3942, 0xFDA8, 0xF568, 0xED68,
-  0xF5C9, 0xF62B, 0xF62B, 0xF64B, 0xFEAD, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C,
-  0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C,
-  0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFEAD, 0xF64B, 0xF62B, 0xF62B, 0xF5C9,
-  0xED68, 0xF568, 0xFDC8, 0x3942, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x72A3, 0xF588, 0xED68,
-  0xED68, 0xED68, 0xED47, 0xF568, 0xF64B, 0xFEAD, 0xFEAD, 0xFEAD, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C,
-  0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C,
-  0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFEAD, 0xFEAD, 0xFEAD, 0xF64B, 0xF568, 0xED47, 0xED68, 0xED68,
-  0xED68, 0xF588, 0x72A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA385, 0xFDC8,
-  0xED48, 0xF568, 0xF568, 0xF568, 0xF568, 0xF5C9, 0xF60A, 0xF5EA, 0xF5A9, 0xF66C, 0xFEAD, 0xFE8C,
-  0xFE8C, 0xFE8C, 0xFEAD, 0xFEAD, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFEAD, 0xFEAD, 0xFE8C, 0xFE8C,
-  0xFE8C, 0xFEAD, 0xF66C, 0xF5A9, 0xF5EA, 0xF60A, 0xF5C9, 0xF568, 0xF568, 0xF568, 0xF568, 0xED48,
-  0xFDC8, 0x9B85, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3962, 0xFDC8,
-  0xF568, 0xED48, 0xED68, 0xED68, 0xF568, 0xED68, 0xED47, 0xED68, 0xED47, 0xF5A9, 0xFE6C, 0xFEAD,
-  0xFEAD, 0xFEAD, 0xF62B, 0xF5EA, 0xFE8C, 0xFEAD, 0xFEAD, 0xFE8C, 0xF5EA, 0xF62B, 0xFEAD, 0xFEAD,
-  0xFEAD, 0xFE6C, 0xF5A9, 0xED47, 0xED68, 0xED47, 0xED68, 0xF568, 0xED68, 0xED68, 0xED48, 0xF568,
-  0xFDC8, 0x3962, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6A83,
-  0xF568, 0xFDC8, 0xFDC8, 0xFDA8, 0xED68, 0xED68, 0xF568, 0xF568, 0xED68, 0xED68, 0xF568, 0xF5C9,
-  0xF5EA, 0xF5A9, 0xF568, 0xED47, 0xF588, 0xF5EA, 0xF5EA, 0xF588, 0xED47, 0xF568, 0xF5A9, 0xF5EA,
-  0xF5C9, 0xF568, 0xED68, 0xED68, 0xF568, 0xF568, 0xED68, 0xED68, 0xFDA8, 0xFDC8, 0xFDC8, 0xF588,
-  0x6A63, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x20C1, 0x5A03, 0x51E3, 0x8304, 0xFDE9, 0xF568, 0xED68, 0xED68, 0xF588, 0xED68, 0xF568, 0xED68,
-  0xED47, 0xF568, 0xF568, 0xF568, 0xF568, 0xED47, 0xED47, 0xF568, 0xF568, 0xF568, 0xF568, 0xED47,
-  0xED68, 0xF568, 0xED68, 0xF588, 0xED68, 0xED68, 0xF568, 0xFDE9, 0x8304, 0x51E3, 0x5A03, 0x20C1,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x8304, 0xF568, 0xFDA8, 0xF588, 0xDCE7, 0xF588, 0xED68, 0xED68,
-  0xF568, 0xED68, 0xED68, 0xF568, 0xED68, 0xF568, 0xF568, 0xED68, 0xF568, 0xED68, 0xED68, 0xF568,
-  0xED68, 0xED68, 0xF588, 0xDCE7, 0xF588, 0xFDA8, 0xF568, 0x8304, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20A1, 0x4182, 0x3141, 0x0840, 0xB406, 0xFE09, 0xF568,
-  0xF568, 0xF588, 0xFDA8, 0xF588, 0xFDA8, 0xF568, 0xF568, 0xFDA8, 0xF588, 0xFDA8, 0xF588, 0xF568,
-  0xF568, 0xFE09, 0xB406, 0x1060, 0x3941, 0x4182, 0x20A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0xA3C5, 0xED68,
-  0xF568, 0xED48, 0x7284, 0x3962, 0xCCA7, 0xF568, 0xF568, 0xCCA7, 0x3962, 0x7283, 0xED48, 0xF568,
-  0xED48, 0xA3C5, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1880,
-  0x20E1, 0x1060, 0x0000, 0x0000, 0x0000, 0x20C1, 0x20C1, 0x0000, 0x0000, 0x0000, 0x1060, 0x20E1,
-  0x1880, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
@@ -1,308 +0,0 @@
-#pragma once
-#include <Arduino.h>
-
-constexpr int kIcon6Width = 60;
-constexpr int kIcon6Height = 60;
-
-const uint16_t kIcon6Data[3600] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0840, 0x18C1, 0x20E1, 0x20E1, 0x20E1, 0x20E1, 0x18C1, 0x0840, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20C1, 0x5A24, 0x8B87,
-  0xB4A9, 0xD56A, 0xE60B, 0xF66C, 0xFE8C, 0xFE8C, 0xFE8C, 0xFE8C, 0xF66C, 0xE60B, 0xD56A, 0xB4A9,
-  0x8B87, 0x5224, 0x20C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3142, 0x8346, 0xC52A, 0xF66C, 0xFEED, 0xFF0D,
-  0xFEED, 0xFECD, 0xFECD, 0xFEAD, 0xFEAD, 0xFEAD, 0xFEAD, 0xFEAD, 0xFEAD, 0xFECD, 0xFECD, 0xFEED,
-  0xFF0D, 0xFEED, 0xF66C, 0xC52A, 0x8346, 0x3142, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0840, 0x6264, 0xC509, 0xFEAC, 0xFF0D, 0xFEED, 0xFEAD, 0xF68C, 0xF68C,
-  0xF66C, 0xF66C, 0xF64C, 0xF64B, 0xF62B, 0xF62B, 0xF62B, 0xF62B, 0xF64B, 0xF64C, 0xF66C, 0xF66C,
-  0xF68C, 0xF68C, 0xFEAD, 0xFEED, 0xFF0D, 0xFEAC, 0xC509, 0x6264, 0x0840, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0x72E5, 0xDDCB, 0xFEED, 0xFEED, 0xFEAD, 0xF68C, 0xF66C, 0xF64B, 0xF60A, 0xF5C9,
-  0xF589, 0xF568, 0xED68, 0xED48, 0xED48, 0xED47, 0xED47, 0xED48, 0xED48, 0xED68, 0xF568, 0xF589,
-  0xF5C9, 0xF60A, 0xF64B, 0xF66C, 0xF68C, 0xFEAD, 0xFEED, 0xFEED, 0xDDCB, 0x72E5, 0x0820, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5A24, 0xD5AA, 0xFF0D, 0xFECD, 0xF68C, 0xF66C, 0xF62B, 0xF5C9, 0xF588, 0xED48, 0xED47, 0xED68,
-  0xF568, 0xF588, 0xF5A8, 0xF5A8, 0xF5C8, 0xF5C8, 0xF5C8, 0xF5C8, 0xF5A8, 0xF5A8, 0xF588, 0xF568,
-  0xED68, 0xED47, 0xED48, 0xF588, 0xF5C9, 0xF62B, 0xF66C, 0xF68C, 0xFECD, 0xFF0D, 0xD5AA, 0x5A24,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20A1, 0xB488,
-  0xFEED, 0xFECD, 0xF68C, 0xF66C, 0xF60A, 0xF588, 0xED47, 0xED47, 0xF588, 0xF5A8, 0xF5A8, 0xF588,
-  0xED28, 0xE4A7, 0xDC27, 0xD3E7, 0xD3A6, 0xBB25, 0xBB25, 0xD3A6, 0xD3E6, 0xDC27, 0xE4A7, 0xED08,
-  0xF588, 0xF5A8, 0xF5A8, 0xF588, 0xED47, 0xED47, 0xF588, 0xF5EA, 0xF66C, 0xF68C, 0xFECD, 0xFEED,
-  0xAC88, 0x20A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5204, 0xEE0B, 0xFF0D,
-  0xF68C, 0xF66C, 0xF5EA, 0xED68, 0xED47, 0xF588, 0xFDC8, 0xF588, 0xE4C7, 0xD3C6, 0xC2E6, 0xB205,
-  0xA984, 0xA144, 0xA124, 0xA104, 0xA104, 0x8062, 0x8062, 0xA104, 0xA104, 0xA124, 0xA144, 0xA984,
-  0xB205, 0xC2C6, 0xD3C6, 0xE4C7, 0xF588, 0xFDC8, 0xF588, 0xED47, 0xED68, 0xF5EA, 0xF66C, 0xF68C,
-  0xFF0D, 0xEE0B, 0x5204, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8346, 0xFECD, 0xFECD, 0xF66C,
-  0xF60A, 0xF568, 0xED47, 0xF5A8, 0xF5A8, 0xE4E7, 0xBB45, 0xA1C4, 0xA964, 0xA104, 0xA104, 0xA124,
-  0xA144, 0xA144, 0xA964, 0xA964, 0xA164, 0x88E3, 0x88E3, 0xA164, 0xA964, 0xA964, 0xA144, 0xA144,
-  0xA124, 0xA104, 0xA104, 0xA964, 0xA1C4, 0xBB25, 0xE4E7, 0xF5A8, 0xF5A8, 0xED47, 0xF568, 0xF60A,
-  0xF66C, 0xFECD, 0xFECD, 0x8346, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA428, 0xFF0D, 0xF68D, 0xF64B, 0xF5A9,
-  0xED47, 0xF588, 0xF5A8, 0xDC87, 0xBAA5, 0xA964, 0x8082, 0x8082, 0xA124, 0xA964, 0xA964, 0xA964,
-  0xA164, 0xA144, 0xA144, 0xA144, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144, 0xA144, 0xA144, 0xA164,
-  0xA964, 0xA964, 0xA964, 0xA144, 0x8082, 0x8082, 0xA964, 0xBAA5, 0xDC87, 0xF5A8, 0xF588, 0xED47,
-  0xF5A9, 0xF64B, 0xF68D, 0xFF0D, 0xA428, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0xAC88, 0xFF0D, 0xF68C, 0xF60A, 0xED68, 0xF568,
-  0xF5C8, 0xE4A7, 0xBA85, 0xA124, 0xA104, 0xA944, 0x9924, 0x80A2, 0x9903, 0xA964, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA964, 0x9903, 0x80A2, 0x9924, 0xA964, 0xA104, 0xA124, 0xBA85, 0xE487, 0xF5A8,
-  0xF568, 0xED68, 0xF60A, 0xF68C, 0xFF0D, 0xAC88, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3122, 0xFEAD, 0xFE8C, 0xF5C9, 0xED47, 0xF5A8, 0xED28,
-  0xC2E6, 0xA144, 0xA104, 0xA964, 0xA964, 0xA964, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA144, 0x88C3, 0x88A3, 0xA144, 0xA964, 0xA964, 0xA964, 0xA104, 0xA144, 0xC2E6,
-  0xED28, 0xF5A8, 0xED47, 0xF5C9, 0xFEAC, 0xFEAD, 0x3122, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x49E3, 0xFE0A, 0xED67, 0xF5A8, 0xDC27, 0xA9A5,
-  0xA104, 0xA164, 0xA964, 0xA144, 0xA144, 0xA144, 0xA964, 0x90E3, 0x80A2, 0x9924, 0xA964, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA964, 0xA124, 0x80A2, 0x90E3, 0xA964, 0xA144, 0xA144, 0xA144, 0xA964, 0xA164, 0xA104,
-  0xA9A5, 0xDC27, 0xF5A8, 0xED67, 0xFDEA, 0x49E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6223, 0xFDA8, 0xC306, 0xA104, 0xA144,
-  0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x9924, 0x80A2, 0x90E3, 0xA964, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA964, 0x9103, 0x80A2, 0x9924, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964,
-  0xA144, 0xA104, 0xC306, 0xFDA8, 0x6243, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6123, 0xB124, 0xA144, 0xA964,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA944, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA944, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA964, 0xA144, 0xB124, 0x6122, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x68E2, 0xB165, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x90E3, 0x80A2, 0x9924, 0xA964,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA964, 0x9924, 0x80A2, 0x90E3, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xB165, 0x68E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x78E3, 0xB165,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x9924, 0x80A2, 0x90E3, 0xA964,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA964, 0x90E3, 0x80A2, 0x9924, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xB165, 0x78E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x8903,
-  0xB164, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0x88C3, 0x88C3, 0xA144,
-  0xA944, 0xA144, 0xA144, 0xA144, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144, 0xA144, 0xA144, 0xA944,
-  0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xB164,
-  0x8903, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020,
-  0x9124, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x9103, 0x80A2, 0x9903,
-  0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964,
-  0x9904, 0x80A2, 0x9103, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x9124,
-  0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1820, 0xA144, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0xA124, 0x80A2, 0x90E3,
-  0xA944, 0xA144, 0xA144, 0xA144, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964,
-  0x90E3, 0x80A2, 0xA124, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0xA144, 0x1820,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2841, 0xA944, 0xA944, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA944, 0x88E3, 0x80A2,
-  0xA144, 0xA964, 0xA144, 0xA144, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144, 0xA144, 0xA964, 0xA144,
-  0x88A2, 0x88C3, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA944, 0xA944, 0x2841, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3861, 0xB164, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x9903, 0x80A2,
-  0x9903, 0xA964, 0xA144, 0xA144, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144, 0xA144, 0xA964, 0x9903,
-  0x80A2, 0x9903, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x3061, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x4881, 0xB165, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0xA144, 0x88C3,
-  0x88C3, 0xA144, 0xA144, 0xA144, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144, 0xA144, 0xA144, 0x88C3,
-  0x88A3, 0xA144, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xB164, 0x4081, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x58A2, 0xB165, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x90E3,
-  0x80A2, 0x9924, 0xA964, 0xA144, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144, 0xA964, 0xA124, 0x80A2,
-  0x90E3, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xB165, 0x58A2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x68C2, 0xB165, 0xA144, 0xA144, 0xA144, 0xA964, 0x9924,
-  0x80A2, 0x90E3, 0xA964, 0xA144, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA144, 0xA964, 0x9103, 0x80A2,
-  0x9924, 0xA964, 0xA144, 0xA144, 0xA144, 0xB165, 0x68C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x78E3, 0xB165, 0xA144, 0xA144, 0xA944, 0xA144,
-  0x88C3, 0x88C3, 0xA144, 0xA964, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA944, 0xA144, 0x88C3, 0x88C3,
-  0xA144, 0xA944, 0xA144, 0xA144, 0xB165, 0x78E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x8903, 0xB164, 0xA144, 0xA144, 0xA964,
-  0x90E3, 0x80A2, 0x9944, 0xA964, 0xA144, 0x88C3, 0x88C3, 0xA144, 0xA964, 0x9944, 0x80A2, 0x90E3,
-  0xA964, 0xA144, 0xA144, 0xB164, 0x8903, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0x9124, 0xA964, 0xA144, 0xA964,
-  0xA144, 0x8062, 0x8882, 0xA124, 0xA164, 0x8903, 0x8903, 0xA164, 0xA124, 0x8882, 0x8062, 0xA144,
-  0xA964, 0xA144, 0xA964, 0x9124, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1820, 0xA144, 0xA964, 0xA124,
-  0xA104, 0xA1C4, 0xC3C8, 0xE54A, 0xEDCB, 0xEDEB, 0xEDEB, 0xEDCB, 0xE54A, 0xC3C8, 0xA1C4, 0xA104,
-  0xA124, 0xA964, 0xA144, 0x1820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2841, 0xA944, 0xA9C5,
-  0xDCA9, 0xFEAC, 0xFEED, 0xFECD, 0xFECD, 0xFECD, 0xFECD, 0xFECD, 0xFECD, 0xFEED, 0xFEAC, 0xDCA9,
-  0xA9C5, 0xA144, 0x2841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x38A1, 0xF5EB,
-  0xFF0D, 0xFE8C, 0xFE8C, 0xFE6C, 0xF66C, 0xF64C, 0xF64C, 0xF66C, 0xFE6C, 0xFE8C, 0xFE8C, 0xFF0D,
-  0xF5EC, 0x38A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6AA5,
-  0xFECD, 0xF62B, 0xF5C9, 0xF588, 0xF568, 0xF568, 0xF568, 0xF568, 0xF588, 0xF5C9, 0xF62B, 0xFECD,
-  0x6AA5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x7AE4, 0xFDC8, 0xED47, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xED47, 0xFDC8, 0x7AE4,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x9365, 0xFDE9, 0xED48, 0xF568, 0xED68, 0xED68, 0xF568, 0xED48, 0xFDE9, 0x9365, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xABE6, 0xFDC8, 0xED68, 0xF5A8, 0xF5A8, 0xED68, 0xFDC8, 0xABE6, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0840, 0xBC66, 0xF568, 0xDBE7, 0xD3E7, 0xF568, 0xBC66, 0x0840, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x38C1, 0xC225, 0xA924, 0xA924, 0xBA05, 0x30C1, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0x58E2, 0xA144, 0xB145, 0xB185, 0xB185, 0xB144, 0x9924, 0x60E3, 0x1020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x50C2, 0xC1C6, 0xEA27, 0xC9A5, 0xB184, 0xB165, 0xB185, 0xA964, 0xB9A5, 0xEA47, 0xC1C6, 0x50C2,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7103,
-  0xE227, 0xE227, 0x9164, 0x8103, 0xB945, 0xB165, 0xB165, 0xA924, 0x78E3, 0x9164, 0xE227, 0xE227,
-  0x7103, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60E3, 0xE227,
-  0xC9E6, 0x50C2, 0x0000, 0x28E1, 0xCAA6, 0xA944, 0xA144, 0xC2A6, 0x28E1, 0x0000, 0x50C2, 0xD1E6,
-  0xE227, 0x60E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xD206, 0xDA06,
-  0x40A2, 0x0000, 0x0000, 0xA3C5, 0xFDC8, 0xE4A7, 0xE4A7, 0xFDC8, 0xABC5, 0x0000, 0x0000, 0x40A2,
-  0xDA06, 0xD206, 0x2061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8944, 0xEA47, 0x7923,
-  0x0000, 0x0000, 0x49A2, 0xFDC8, 0xED68, 0xF588, 0xF588, 0xED68, 0xFDC8, 0x49A2, 0x0000, 0x0000,
-  0x7923, 0xEA47, 0x8944, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xC9E6, 0xD1E6, 0x1820,
-  0x0000, 0x0820, 0xD4A7, 0xFDA8, 0xED68, 0xED68, 0xED68, 0xED68, 0xFDA8, 0xD4A7, 0x0820, 0x0000,
-  0x1820, 0xD1E6, 0xC9E6, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3881, 0xE227, 0x9964, 0x0000,
-  0x0000, 0x7AE4, 0xFDC8, 0xED48, 0xF568, 0xF568, 0xF568, 0xF568, 0xED48, 0xFDC8, 0x7AE4, 0x0000,
-  0x0000, 0x9964, 0xE227, 0x3881, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x48C2, 0xF247, 0x8123, 0x0000,
-  0x0000, 0x6243, 0xFDE8, 0xED68, 0xED48, 0xED68, 0xED68, 0xED48, 0xED68, 0xFDE9, 0x6243, 0x0000,
-  0x0000, 0x8123, 0xF247, 0x48C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x48A2, 0xEA27, 0x68E3, 0x0000,
-  0x0000, 0x0000, 0x7AA4, 0xFDA8, 0xFDC8, 0xFDA8, 0xFDA8, 0xFDC8, 0xFDA8, 0x7AA4, 0x0000, 0x0000,
-  0x0000, 0x68E3, 0xEA27, 0x40A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x8923, 0xA964, 0x9924, 0x1820,
-  0x0000, 0x0000, 0x0000, 0x3121, 0x9365, 0xB406, 0xB406, 0x9365, 0x3121, 0x0000, 0x0000, 0x0000,
-  0x1820, 0x9924, 0xA964, 0x8923, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3861, 0xB985, 0xA164, 0xB985, 0x48A2,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x48A2, 0xB985, 0xA164, 0xB985, 0x3861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2040, 0x9904, 0xA0E4, 0xA104, 0x3061,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3061, 0xA104, 0xA0E4, 0xA104, 0x2040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xC448, 0xD409, 0xCC27, 0x1060,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1081, 0xCC89, 0xD408, 0xBBE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x41C3, 0xFF0D, 0xFEED, 0xFEAB, 0x6223,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x62A5, 0xFF4E, 0xFEED, 0xFE4A, 0x4162, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9C07, 0xFEED, 0xF66C, 0xFE2A, 0xB3E5,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xBCC9, 0xFECD, 0xF66C, 0xFE2A, 0x9344, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xDDAA, 0xFEAD, 0xF68D, 0xFE0A, 0xE507,
-  0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080,
-  0xEE2B, 0xFEAC, 0xF68D, 0xFE0A, 0xCC86, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20E1, 0xF68C, 0xFEAD, 0xFE8C, 0xF5A9, 0xF588,
-  0x3141, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3982,
-  0xFECD, 0xF68D, 0xF66C, 0xF588, 0xED48, 0x18A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3962, 0xFE0A, 0xF5C9, 0xF5A9, 0xED48, 0xFDC8,
-  0x5A02, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5A23,
-  0xFE4A, 0xF5C9, 0xF588, 0xED48, 0xFDA8, 0x3962, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3962, 0xFD88, 0xED47, 0xF568, 0xED68, 0xFDC8,
-  0x5A03, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5A03,
-  0xFDC8, 0xED47, 0xF568, 0xED68, 0xFDA8, 0x3962, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x20E1, 0x20C1, 0x20C1, 0x20C1, 0x20E1,
-  0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840,
-  0x20E1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
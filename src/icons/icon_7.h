@@ -1,308 +0,0 @@
-#pragma once
-#include <Arduino.h>
-
-constexpr int kIcon7Width = 60;
-constexpr int kIcon7Height = 60;
-
-const uint16_t kIcon7Data[3600] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1840, 0x1840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xA9A5, 0xDA06, 0xA9A5,
-  0x1020, 0x0000, 0x0000, 0x0000, 0x58E3, 0xD206, 0xD206, 0x58E3, 0x0000, 0x0000, 0x0000, 0x1020,
-  0xA9A5, 0xDA06, 0xA9A5, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x48C2, 0xE227, 0xC9E6, 0xE227,
-  0x48C2, 0x0000, 0x0000, 0x0000, 0xB1A5, 0xDA06, 0xDA06, 0xB1A5, 0x0000, 0x0000, 0x0000, 0x48C2,
-  0xE227, 0xC9E6, 0xE227, 0x48C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x50C2, 0xEA06, 0xD1E6, 0xEA06,
-  0x50C2, 0x0000, 0x0000, 0x0000, 0xB9A5, 0xE206, 0xE206, 0xB9A5, 0x0000, 0x0000, 0x0000, 0x50C2,
-  0xEA06, 0xD1E6, 0xEA06, 0x50C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x38C2, 0xAA27, 0x9A07, 0xAA27,
-  0x38C2, 0x0000, 0x0000, 0x0000, 0x81C6, 0xA227, 0xA227, 0x81C6, 0x0000, 0x0000, 0x0000, 0x38C2,
-  0xAA27, 0x9A07, 0xAA27, 0x38C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4269, 0x3A28, 0x4269,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x31E7, 0x3A49, 0x3A49, 0x31E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4269, 0x3A28, 0x4269, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4228, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4228, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4A69, 0x4208, 0x4A69,
-  0x18C3, 0x0000, 0x0000, 0x0000, 0x39E7, 0x4A49, 0x4A49, 0x39E7, 0x0000, 0x0000, 0x0000, 0x18C3,
-  0x4A69, 0x4208, 0x4A69, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39E7, 0x52AA, 0x39E7,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x18E3, 0x528A, 0x528A, 0x18E3, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x39E7, 0x52AA, 0x39E7, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39E7, 0xA534, 0x39E7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8430, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x39E7, 0xA534, 0x39E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39E7, 0xAD55, 0x39E7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x8C51, 0x8C51, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x39E7, 0xAD55, 0x39E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39E7, 0xAD55, 0x39E7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x8430, 0x8430, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x39E7, 0xAD55, 0x39E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39E7, 0xAD55, 0x39E7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x8430, 0x8430, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x39E7, 0xAD55, 0x39E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x41E7, 0xAD34, 0x41E7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x8C30, 0x8C30, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x41E7, 0xAD34, 0x41E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31E7, 0xA575, 0x31E7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8471, 0x8471, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x31E7, 0xA575, 0x31E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x58E3, 0x60E3, 0x60E3, 0x6103, 0x60E3, 0x8208, 0xC3EF, 0x8208,
-  0x60E3, 0x6103, 0x60E3, 0x60E3, 0x6104, 0xAB4D, 0xAB4D, 0x6104, 0x60E3, 0x60E3, 0x6103, 0x60E3,
-  0x8208, 0xC3EF, 0x8208, 0x60E3, 0x6103, 0x60E3, 0x58E3, 0x58C2, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1841, 0xEA49, 0xF269, 0xF269, 0xF269, 0xF269, 0xEA48, 0xE207, 0xEA48,
-  0xF269, 0xF269, 0xF269, 0xF269, 0xF269, 0xE208, 0xE208, 0xF269, 0xF269, 0xF269, 0xF269, 0xF269,
-  0xEA48, 0xE207, 0xEA48, 0xF269, 0xF269, 0xF269, 0xE227, 0xDA06, 0x1840, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1020, 0xC9E6, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD227, 0xD207,
-  0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207, 0xD207,
-  0xD207, 0xD227, 0xD207, 0xD207, 0xD207, 0xD207, 0xC9E6, 0xC1C6, 0x1020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1820, 0xD206, 0xDA06, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206,
-  0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206,
-  0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xDA06, 0xD206, 0x1820, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x4082, 0x58C2, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185,
-  0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185,
-  0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0xB185, 0x58C2, 0x4082, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xA944, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA944, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xA144, 0xA944, 0xA944, 0xA944, 0xA944,
-  0xA944, 0xA944, 0xA944, 0xA964, 0xA964, 0xA144, 0xA144, 0xA964, 0xA944, 0xA944, 0xA944, 0xA944,
-  0xA944, 0xA944, 0xA944, 0xA944, 0xA144, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA104, 0xA964, 0xA964, 0xA104, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA124, 0xCBE8, 0xEDEB, 0xEDEB, 0xCBA7, 0xA124, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA964, 0xA104, 0xCBA8, 0xFF2D, 0xFEAC, 0xFECD, 0xFECC, 0xC306, 0xA104, 0xA964, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA164, 0xA124, 0xED8B, 0xFECD, 0xF66C, 0xFE8C, 0xFE8C, 0xE487, 0xA124, 0xA164, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA964, 0xA104, 0xE54A, 0xFEED, 0xF68C, 0xFE8D, 0xFE0A, 0xDC47, 0xA124, 0xA964, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA964, 0xA104, 0xBAA6, 0xFE6B, 0xFE8B, 0xFE0A, 0xF588, 0xBA65, 0xA124, 0xA964, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA964, 0xA124, 0xBA45, 0xD3E6, 0xD3E6, 0xBA45, 0xA124, 0xA164, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA964, 0xA124, 0xA104, 0xA104, 0xA124, 0xA964, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA164, 0xA164, 0xA164, 0xA164, 0xA144, 0xA144, 0xA144, 0xA144,
-  0xA144, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964,
-  0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165,
-  0xA964, 0xA144, 0xA144, 0xA144, 0xA144, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xA144, 0xA144, 0xA144, 0xA964, 0x70E3,
-  0x4882, 0x4882, 0x4882, 0x4882, 0x4882, 0x4882, 0x4882, 0x4882, 0x4882, 0x4882, 0x4882, 0x4882,
-  0x70E3, 0xA964, 0xA144, 0xA144, 0xA144, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xA144, 0xA144, 0xA144, 0xB165, 0x4081,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4081, 0xB165, 0xA144, 0xA144, 0xA144, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xA144, 0xA144, 0xA144, 0xB165, 0x4882,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4882, 0xB165, 0xA144, 0xA144, 0xA144, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xA144, 0xA144, 0xA144, 0xB165, 0x4882,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4882, 0xB165, 0xA144, 0xA144, 0xA144, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0xA964, 0xA144, 0xA144, 0xA144, 0xB165, 0x4882,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4882, 0xB165, 0xA144, 0xA144, 0xA144, 0xA964, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1820, 0x1820, 0x1820, 0x1820, 0x1820, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x1820, 0x1820, 0x1820, 0x1820, 0x1820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
@@ -1,308 +0,0 @@
-#pragma once
-#include <Arduino.h>
-
-constexpr int kIcon8Width = 60;
-constexpr int kIcon8Height = 60;
-
-const uint16_t kIcon8Data[3600] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x20E2, 0x2102, 0x2102, 0x1061, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1061, 0x2102, 0x2102, 0x20E2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x20E2, 0x942A, 0xDE50, 0xFF32, 0xFF32, 0xFF32, 0xEEB1, 0xB52D, 0x4A04,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4A05, 0xB52D, 0xEEB1, 0xFF32, 0xFF32, 0xFF32, 0xDE50, 0x9409, 0x20E1, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x6B07, 0xF712, 0xFFB4, 0xFF73, 0xFF53, 0xFF32, 0xFF53, 0xFF53, 0xFFB4, 0xFF72,
-  0xAC89, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0xACEC,
-  0xFF93, 0xFFB3, 0xFF53, 0xFF53, 0xFF32, 0xFF53, 0xFF73, 0xFFB4, 0xF6CF, 0x6AC5, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x7B88, 0xFFD4, 0xFF53, 0xFF33, 0xFF32, 0xFF32, 0xFF32, 0xFF32, 0xFF32, 0xFF32, 0xFF53,
-  0xFF92, 0xCD4A, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0xCDCE, 0xFFD4,
-  0xFF33, 0xFF33, 0xFF32, 0xFF32, 0xFF32, 0xFF32, 0xFF32, 0xFF33, 0xFF73, 0xFF4F, 0x7B46, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5245, 0xFFB4, 0xFF33, 0xFEF1, 0xF5EB, 0xFEF1, 0xFF53, 0xFF32, 0xFF32, 0xFF53, 0xF62C, 0xF66E,
-  0xF733, 0xFF4F, 0xAC68, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xACEC, 0xFFD4, 0xF712,
-  0xF68E, 0xF62C, 0xFF53, 0xFF32, 0xFF32, 0xFF53, 0xFEF1, 0xF5EB, 0xFEF1, 0xFF12, 0xFF0D, 0x5224,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840,
-  0xDE50, 0xFF73, 0xFF53, 0xF64D, 0xED26, 0xF5CA, 0xFF32, 0xFF32, 0xFF53, 0xF66E, 0xED26, 0xF5A9,
-  0xFF33, 0xF6F1, 0xFEED, 0x41C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x41E4, 0xFFB3, 0xFF32, 0xFF32,
-  0xF5A9, 0xED26, 0xF66E, 0xFF53, 0xFF32, 0xFF32, 0xF5CA, 0xED26, 0xF64D, 0xFF53, 0xFF0F, 0xDDAA,
-  0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5265,
-  0xFFB4, 0xFF12, 0xFF32, 0xFF53, 0xF5EB, 0xED26, 0xF60C, 0xFF74, 0xFEAF, 0xF547, 0xF568, 0xFEF1,
-  0xFF53, 0xFF12, 0xFF0E, 0xB4A9, 0x0000, 0x0000, 0x0000, 0x0000, 0xB50D, 0xFFB4, 0xFF12, 0xFF53,
-  0xFEF1, 0xF568, 0xF547, 0xFEAF, 0xFF74, 0xF60C, 0xED26, 0xF5EB, 0xFF53, 0xFF53, 0xF6F0, 0xFEED,
-  0x5244, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9C6B,
-  0xFFB4, 0xFF12, 0xFF32, 0xFF53, 0xFF32, 0xF5A9, 0xED47, 0xF64D, 0xF5A9, 0xED47, 0xFE8F, 0xFF53,
-  0xFF32, 0xFF33, 0xFECE, 0xE60B, 0x1060, 0x0000, 0x0000, 0x1060, 0xEEB1, 0xFF53, 0xFF32, 0xFF32,
-  0xFF53, 0xFEAF, 0xED47, 0xF5A9, 0xF64D, 0xED47, 0xF5A9, 0xFF32, 0xFF53, 0xFF33, 0xFF11, 0xFF0D,
-  0x9C07, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBD4D,
-  0xFF93, 0xFF32, 0xFF32, 0xFF32, 0xFF53, 0xFEF1, 0xF588, 0xED47, 0xED47, 0xF66E, 0xFF74, 0xFF32,
-  0xFF32, 0xFF33, 0xFECE, 0xFE8C, 0x2102, 0x0000, 0x0000, 0x2102, 0xFF32, 0xFF53, 0xFF32, 0xFF32,
-  0xFF32, 0xFF74, 0xF66E, 0xED47, 0xED47, 0xF588, 0xFEF1, 0xFF53, 0xFF32, 0xFF53, 0xFF11, 0xFEED,
-  0xBCE9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBD6D,
-  0xFF93, 0xFF32, 0xFF32, 0xFF53, 0xFF11, 0xF60C, 0xF5A9, 0xF568, 0xF588, 0xF5EB, 0xFEAF, 0xFF53,
-  0xFF32, 0xFF33, 0xFEAE, 0xFE8C, 0x2102, 0x0000, 0x0000, 0x2922, 0xFF32, 0xFF53, 0xFF32, 0xFF32,
-  0xFF53, 0xFEAF, 0xF5EB, 0xF588, 0xF568, 0xF5A9, 0xF60C, 0xFF11, 0xFF53, 0xFF53, 0xFF11, 0xFEED,
-  0xBCE9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB52D,
-  0xFFB4, 0xFF32, 0xFF32, 0xFF53, 0xFEF1, 0xED47, 0xF567, 0xF568, 0xF568, 0xED26, 0xF64D, 0xFF53,
-  0xFF32, 0xFF32, 0xFEAD, 0xF66C, 0x20E1, 0x0000, 0x0000, 0x20E2, 0xFF12, 0xFF53, 0xFF32, 0xFF32,
-  0xFF53, 0xF64D, 0xED26, 0xF568, 0xF568, 0xF567, 0xED47, 0xFEF1, 0xFF53, 0xFF53, 0xFEF0, 0xFEED,
-  0xB4A9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x83C9,
-  0xFFD4, 0xFF12, 0xFF32, 0xFF33, 0xFF32, 0xFEF1, 0xF68E, 0xED47, 0xF60B, 0xFEF1, 0xFF11, 0xFF52,
-  0xFF53, 0xFEF0, 0xFEAC, 0xDDAB, 0x0020, 0x0000, 0x0000, 0x0020, 0xDE50, 0xFF73, 0xFF32, 0xFF32,
-  0xFF53, 0xFF11, 0xFEF1, 0xF60B, 0xED47, 0xF68E, 0xFEF1, 0xFF32, 0xFF32, 0xFF53, 0xF6AE, 0xFF0D,
-  0x8386, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3163,
-  0xFF73, 0xFF32, 0xFF32, 0xFF53, 0xFEF1, 0xF5CA, 0xF5A9, 0xF568, 0xF589, 0xF5A9, 0xF66E, 0xFF53,
-  0xFF32, 0xF68D, 0xFF0D, 0x8BC7, 0x0000, 0x0000, 0x0000, 0x0000, 0x940A, 0xFFD4, 0xFF12, 0xFF32,
-  0xFF53, 0xF68E, 0xF5A9, 0xF589, 0xF568, 0xF5A9, 0xF5CA, 0xFEF1, 0xFF53, 0xFF11, 0xF68C, 0xFECD,
-  0x3162, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xB50C, 0xFFB4, 0xF712, 0xFF53, 0xFEF1, 0xF568, 0xF568, 0xF568, 0xF588, 0xED47, 0xF64D, 0xFF74,
-  0xFECF, 0xFE8C, 0xF68C, 0x20C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x20E2, 0xF732, 0xFF53, 0xFF32,
-  0xFF53, 0xF66D, 0xED47, 0xF588, 0xF568, 0xF568, 0xF568, 0xFEF1, 0xFF53, 0xF68D, 0xFF0D, 0xB4A9,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x20E2, 0xEED1, 0xFF93, 0xF712, 0xFF32, 0xFF32, 0xFEAF, 0xED26, 0xF60B, 0xFF53, 0xFF32, 0xFEF0,
-  0xF66C, 0xFF2D, 0x6AC5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B07, 0xFFD4, 0xFF32,
-  0xFF32, 0xFF32, 0xFF32, 0xF60B, 0xED26, 0xFEAF, 0xFF53, 0xFF32, 0xF68E, 0xFECC, 0xEE4C, 0x20E1,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3183, 0xEED1, 0xFFD4, 0xFF53, 0xFF53, 0xFEF1, 0xF589, 0xF64D, 0xFF53, 0xFECF, 0xFECC,
-  0xFF0D, 0x8366, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x83A9, 0xFFD4,
-  0xFF93, 0xFF33, 0xFF53, 0xF64D, 0xF589, 0xFEF1, 0xFF32, 0xFEAD, 0xFEED, 0xEE4C, 0x3162, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x20E2, 0xAD0C, 0xF6F1, 0xFF52, 0xFF31, 0xFF10, 0xFEEF, 0xFEAD, 0xFEAC, 0xCD6A,
-  0x49E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A25,
-  0xCDCE, 0xFF31, 0xFF32, 0xFF11, 0xFEF0, 0xFECE, 0xFEAD, 0xF66C, 0xACA9, 0x20E1, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x72C4, 0xC4E8, 0xEE0B, 0xF64B, 0xF64B, 0xD56A, 0x93C6, 0x4182,
-  0x3101, 0x4162, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x4162, 0x3101,
-  0x4182, 0x93A6, 0xD569, 0xF64B, 0xF64B, 0xEE0B, 0xC4E9, 0x72C4, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x9BA5, 0xF588, 0xE527, 0xED48, 0xF568, 0xF568, 0xED47, 0xED47, 0xFDA8,
-  0xFDC8, 0xFDA8, 0xFDA8, 0xFDA8, 0xFDA8, 0xFDA8, 0xFDA8, 0xFDA8, 0xFDA8, 0xFDA8, 0xFDA8, 0xFDC8,
-  0xFDA8, 0xED47, 0xED47, 0xF568, 0xF568, 0xED48, 0xE527, 0xF588, 0x9B85, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1060, 0xED28, 0xF588, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xED48,
-  0xED48, 0xED48, 0xED48, 0xED68, 0xED68, 0xED68, 0xED68, 0xED68, 0xED68, 0xED48, 0xED48, 0xED48,
-  0xED48, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF568, 0xF588, 0xE528, 0x1060, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0040, 0xDD47, 0xF5C8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8,
-  0xF5A8, 0xF5A8, 0xF5A8, 0xF588, 0xF546, 0xF546, 0xF546, 0xF546, 0xF588, 0xF5A8, 0xF5A8, 0xF5A8,
-  0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5A8, 0xF5C8, 0xDD47, 0x0040, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2041, 0x7123, 0xDB87, 0xE3C7, 0xE3A7, 0xE3A7, 0xE3A7, 0xE3A7, 0xE3A7, 0xE3A7, 0xE3A7,
-  0xE3A7, 0xE3C7, 0xE386, 0xE449, 0xF693, 0xF673, 0xF673, 0xF693, 0xE449, 0xE386, 0xE3C7, 0xE3A7,
-  0xE3A7, 0xE3A7, 0xE3A7, 0xE3A7, 0xE3A7, 0xE3A7, 0xE3A7, 0xE3C7, 0xDB87, 0x6923, 0x1840, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3061, 0xD1E6, 0xE207, 0xD1A6, 0xC9A6, 0xD1A6, 0xC9A6, 0xC9A6, 0xC9A6, 0xC9A6, 0xC9A6, 0xC9A6,
-  0xC9A6, 0xD1C6, 0xC965, 0xE555, 0xF7FF, 0xE4D3, 0xE4D3, 0xF7FF, 0xE555, 0xC965, 0xD1C6, 0xC9A6,
-  0xC9A6, 0xC9A6, 0xC9A6, 0xC9A6, 0xC9A6, 0xC9A6, 0xC9A6, 0xC9A6, 0xD1C6, 0xD9E6, 0xB165, 0x2861,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x9964, 0xE227, 0xC9E6, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206,
-  0xD226, 0xD1C5, 0xDB2B, 0xF7DF, 0xF6FB, 0xD206, 0xD206, 0xF6FB, 0xF7DF, 0xDB2B, 0xD1C5, 0xD226,
-  0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xD206, 0xC9E6, 0xB185, 0xC185, 0x8903,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x9944, 0xC1A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5,
-  0xB9A5, 0xB944, 0xE595, 0xFFFF, 0xD3EE, 0xB944, 0xB944, 0xD3EE, 0xFFFF, 0xE595, 0xB944, 0xB9A5,
-  0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB9A5, 0xB185, 0xB164, 0xB985, 0x9124,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x68E3, 0xC185, 0xB164, 0xB164, 0xB164, 0xB164, 0xB164, 0xB164, 0xB164, 0xB164, 0xB164, 0xB165,
-  0xB144, 0xBA28, 0xF79E, 0xEEFB, 0xB1A5, 0xB164, 0xB164, 0xB1A5, 0xEEFB, 0xF79E, 0xBA28, 0xB144,
-  0xB165, 0xB164, 0xB164, 0xB164, 0xB164, 0xB164, 0xB164, 0xB164, 0xB165, 0xB165, 0xC9A5, 0x68E3,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x8103, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB185,
-  0xB103, 0xD430, 0xFFFF, 0xD4B2, 0xB103, 0xB185, 0xB185, 0xB103, 0xD4B2, 0xFFFF, 0xCC30, 0xB103,
-  0xB185, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0xB165, 0x8103, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x4881, 0x90E3, 0x88E3, 0x90E3, 0x90E3, 0x90E3, 0x90E3, 0x90E3, 0x90E3, 0x90E3,
-  0x8882, 0xDDF7, 0xFFFF, 0xA228, 0x8882, 0x90E3, 0x90E3, 0x8882, 0xA228, 0xFFFF, 0xDDF7, 0x8882,
-  0x90E3, 0x90E3, 0x90E3, 0x90E3, 0x90E3, 0x90E3, 0x90E3, 0x88E3, 0x90E3, 0x4861, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0x80A2, 0x88C3, 0x80A2, 0x80A2, 0x80A2, 0x80A2, 0x80A2, 0x80A2, 0x88C3, 0x8082,
-  0x8945, 0xEF7D, 0xE6DB, 0x88C3, 0x80A2, 0x88C3, 0x88C3, 0x80A2, 0x88C3, 0xE6DB, 0xEF7D, 0x8925,
-  0x8082, 0x88C3, 0x80A2, 0x80A2, 0x80A2, 0x80A2, 0x80A2, 0x80A2, 0x88C3, 0x80A2, 0x1020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x70A2, 0x90C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8061,
-  0xA249, 0xFFFF, 0xCD55, 0x8041, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8061, 0xCD55, 0xFFFF, 0xA249,
-  0x8061, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x90C3, 0x70A2, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5061, 0x90C3, 0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8041,
-  0xB36D, 0xFFFF, 0xBC10, 0x8041, 0x88E3, 0x88C3, 0x88C3, 0x88E3, 0x8041, 0xBC10, 0xFFFF, 0xB34D,
-  0x8041, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80C3, 0x90C3, 0x5061,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1820,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88E3, 0x8041,
-  0xBC30, 0xFFFF, 0xAB2C, 0x8041, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8041, 0xAB2C, 0xFFFF, 0xBC30,
-  0x8041, 0x88E3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x1820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6882,
-  0x88C3, 0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8041,
-  0xC4D3, 0xFFFF, 0xA2AA, 0x8041, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8041, 0xA2AA, 0xFFFF, 0xC4D3,
-  0x8041, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80C3, 0x88C3,
-  0x6882, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2020, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8041,
-  0xCCD0, 0xFFBA, 0xA268, 0x8061, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8061, 0xA268, 0xFFDA, 0xCCD0,
-  0x8041, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x2020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5061, 0x90C3,
-  0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88A2,
-  0xE56A, 0xFF2C, 0xBB06, 0x8042, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8042, 0xBB67, 0xFF2D, 0xDD09,
-  0x8082, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80C3,
-  0x90C3, 0x5061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x78A2, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8082, 0x9984,
-  0xF66C, 0xFEED, 0xD447, 0x8062, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8062, 0xDCE9, 0xFF0D, 0xF5EA,
-  0x9143, 0x80A2, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x78A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2020, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8062, 0xB2C6,
-  0xFEED, 0xFEAD, 0xED48, 0x88E3, 0x88A3, 0x88C3, 0x88C3, 0x80A2, 0x8903, 0xEE0B, 0xFEAD, 0xFE6B,
-  0xAA24, 0x8062, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x2020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3841, 0x90C3, 0x80C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8042, 0xCC28,
-  0xFEED, 0xF66C, 0xF5E9, 0x99A3, 0x8082, 0x88C3, 0x88C3, 0x8062, 0xA205, 0xFEAC, 0xF68C, 0xFE6B,
-  0xC365, 0x8062, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x80C3, 0x90C3, 0x3841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4861, 0x90C3, 0x80C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88A3, 0xE58B,
-  0xFEED, 0xF68D, 0xFE09, 0xB2C5, 0x8062, 0x88C3, 0x88C3, 0x8042, 0xBB87, 0xFF0D, 0xF68D, 0xFE4B,
-  0xDC66, 0x80A3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x80C3, 0x90C3, 0x4861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5061, 0x90C3, 0x80C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8082, 0x9163, 0xF5EA,
-  0xF60A, 0xF5CA, 0xF5A8, 0xD406, 0x8082, 0x88C3, 0x88C3, 0x8062, 0xD468, 0xFE4B, 0xF5EA, 0xF5A9,
-  0xED48, 0x9143, 0x80A2, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x80C3, 0x90C3, 0x5061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5061, 0x90C3, 0x80C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x8062, 0xAA64, 0xFDC8,
-  0xF568, 0xF568, 0xF5A8, 0xED07, 0x8903, 0x88A3, 0x88A3, 0x8903, 0xED07, 0xF588, 0xF568, 0xF568,
-  0xFDC8, 0xAA64, 0x8062, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x80C3, 0x90C3, 0x5061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5061, 0x90C3, 0x80C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80A2, 0x9143, 0xA1C4,
-  0x99A4, 0x99A4, 0x99A4, 0x99A4, 0x88E3, 0x88A3, 0x88A3, 0x88E3, 0x99A4, 0x99A4, 0x99A4, 0x99A4,
-  0xA1C4, 0x9123, 0x80A2, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x80C3, 0x90C3, 0x5061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5061, 0x90C3, 0x80C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80A2, 0x8082,
-  0x8082, 0x8082, 0x8082, 0x8082, 0x88A3, 0x88C3, 0x88C3, 0x88A3, 0x8082, 0x8082, 0x8082, 0x8082,
-  0x8082, 0x80A2, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x80C3, 0x90C3, 0x5061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3841, 0x90C3, 0x80C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x80C3, 0x90C3, 0x3841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2020, 0x90C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x2020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x78A2, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x78A2, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5882, 0x90C3,
-  0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80C3,
-  0x90C3, 0x5882, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2820, 0x90C3,
-  0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80C3,
-  0x90C3, 0x2020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7082,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x70A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2820,
-  0x90C3, 0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80C3, 0x90C3,
-  0x2020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5882, 0x90C3, 0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80C3, 0x90C3, 0x5861,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x78A2, 0x88C3, 0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80C3, 0x88C3, 0x78A2, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1820, 0x80A2, 0x88C3, 0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80C3, 0x88C3, 0x80C3, 0x1820, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2020, 0x80A2, 0x88C3, 0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80C3, 0x88C3, 0x80A2, 0x2020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1020, 0x70A2, 0x90C3, 0x88C3, 0x80C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x80C3, 0x88C3, 0x90C3, 0x70A2, 0x1020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x5061, 0x88C3, 0x90C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x90C3, 0x88C3, 0x5061, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x4061, 0x6882, 0x80A2, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3, 0x88C3,
-  0x88C3, 0x88C3, 0x80A2, 0x6882, 0x4861, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x1020, 0x1020,
-  0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020,
-  0x1020, 0x1020, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
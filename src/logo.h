@@ -1,1883 +0,0 @@
-#pragma once
-#include <Arduino.h>
-
-constexpr int kLogoWidth = 150;
-constexpr int kLogoHeight = 150;
-
-const uint16_t kLogoData[22500] PROGMEM = {
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xF9C7, 0xF820, 0xFC92, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF5D, 0xFEBA, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDF7, 0xF800, 0xF800, 0xF820,
-  0xFF1C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDF7, 0xFF1C, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE59, 0xF9A6, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFF1C, 0xF924, 0xF820, 0xFBAE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFF7D, 0xFDD7, 0xFE18, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFF1C, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFCF3, 0xF800, 0xF820, 0xF800, 0xFD96, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFC71, 0xF800, 0xF8E3, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC30, 0xF800,
-  0xFBCF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC51, 0xF800, 0xF820, 0xF800,
-  0xFD14, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xF945, 0xF800, 0xF800, 0xFB8E, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDB6, 0xF945, 0xF861, 0xF8E3, 0xFE9A,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xFF3C, 0xFF1C, 0xFF1C, 0xFF1C, 0xFF1C, 0xFF7D, 0xFF7D, 0xFFBE,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC92, 0xF800, 0xF820, 0xF800,
-  0xFD34, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF986, 0xF800, 0xF800, 0xFD14, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBAE, 0xF800, 0xF9E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFB8E, 0xF800, 0xF841, 0xF800, 0xFA08, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFE18, 0xF800, 0xF841, 0xF800, 0xFACB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xFBEF, 0xFC92, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFEDB, 0xFDD7, 0xFCD3,
-  0xFBCF, 0xFB6D, 0xFB4D, 0xFC71, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFEFB, 0xF841, 0xF800, 0xF800, 0xF800, 0xFE59, 0xFFFF, 0xFFFF, 0xFFBE, 0xFCF3, 0xFACB, 0xF9C7,
-  0xF8E3, 0xF882, 0xF841, 0xF800, 0xF800, 0xF841, 0xF8A2, 0xF904, 0xF9A6, 0xFACB, 0xFC51, 0xFF9E,
-  0xFFFF, 0xFFFF, 0xFA28, 0xF800, 0xF820, 0xF800, 0xFD75, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFF9E,
-  0xF8A2, 0xF800, 0xF800, 0xFBEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBAE, 0xF800,
-  0xF924, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBEF, 0xF800, 0xF820, 0xF800,
-  0xF8C3, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDD7, 0xF800, 0xF820, 0xF800, 0xFC71, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCF3,
-  0xF861, 0xF800, 0xF800, 0xFEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF1C, 0xFD55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xFD55,
-  0xFB8E, 0xFA08, 0xF8E3, 0xF841, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF9A6, 0xFFBE,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC10, 0xF800, 0xF820, 0xFA28, 0xFDF7, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFF5D, 0xFEFB, 0xFE79, 0xFDB6, 0xFD55, 0xFCD3,
-  0xFBEF, 0xFB6D, 0xFB2C, 0xFB0C, 0xFB6D, 0xFF7D, 0xFF9E, 0xF9A6, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xFDB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xF861, 0xF800, 0xF800, 0xFBCF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB8E, 0xF800, 0xF8E3, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFD55, 0xF800, 0xF820, 0xF800, 0xF841, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFE38, 0xF800, 0xF800, 0xF800, 0xFDB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCF3, 0xF800, 0xF800, 0xF820, 0xF8C3, 0xFF9E, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBCF, 0xF820, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFEBA, 0xFCB2, 0xFA8A, 0xF8C3, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xFDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFA28, 0xF800, 0xF820, 0xFEFB, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFACB, 0xF800, 0xF820, 0xF800, 0xF800, 0xFE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D,
-  0xF882, 0xF800, 0xF800, 0xFB4D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBAE, 0xF800,
-  0xF882, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE9A, 0xF800, 0xF800, 0xF800,
-  0xF861, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFE59, 0xF800, 0xF820, 0xF800, 0xFCD3, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFD55, 0xF820, 0xF820,
-  0xF800, 0xF800, 0xFCF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xF924, 0xF800, 0xFE18, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFF7D, 0xFD55, 0xFAAA, 0xF8A2, 0xF800, 0xF800, 0xF882, 0xF9A6, 0xFB0C, 0xFBCF,
-  0xFCB2, 0xFD75, 0xFD96, 0xFDB6, 0xFDB6, 0xFD96, 0xFD14, 0xFBCF, 0xF945, 0xF800, 0xF800, 0xFCB2,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF986, 0xF800, 0xF800, 0xFACB, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA49, 0xF800, 0xF800, 0xF841,
-  0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF945, 0xF800, 0xF800, 0xF9E7, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFB8E, 0xF800, 0xF800, 0xFD75, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF,
-  0xFFDF, 0xFFFF, 0xFEBA, 0xF800, 0xF800, 0xF800, 0xF904, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFB4D, 0xF800, 0xF820, 0xF800, 0xF945, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFF9E, 0xFBCF, 0xF800, 0xF800, 0xF800, 0xF8A2, 0xFD55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDB6, 0xF800, 0xF800, 0xFD14, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xFD14, 0xFA28, 0xF800, 0xF800, 0xF965, 0xFB8E,
-  0xFD96, 0xFF1C, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFEDB, 0xF820, 0xF800, 0xFBEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xF945, 0xF800, 0xF820, 0xF800, 0xFCB2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFEDB, 0xF841, 0xF800, 0xF904, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFA49, 0xF800, 0xF800, 0xF841, 0xFEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD75, 0xF882, 0xF800,
-  0xF800, 0xF924, 0xFEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xFA49, 0xF800, 0xF820, 0xF800,
-  0xFA28, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFF1C, 0xFE18, 0xFD14, 0xFB8E, 0xF986, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF9A6,
-  0xFDD7, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFEBA, 0xFC51, 0xF924, 0xF800, 0xF800, 0xF800, 0xFACB,
-  0xFEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB8E,
-  0xF800, 0xF800, 0xFBEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xFB0C, 0xF820,
-  0xF800, 0xF8E3, 0xFC10, 0xFEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFB6D, 0xF800, 0xF800, 0xFBCF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF924, 0xF800, 0xF800, 0xF800, 0xF800, 0xFEDB,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF904, 0xF800, 0xF9C7,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC92, 0xF800, 0xF820, 0xF800, 0xF9A6, 0xFD34,
-  0xFDB6, 0xFC71, 0xFA08, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF8A2, 0xFB0C, 0xFBCF, 0xFB4D,
-  0xF9C7, 0xF820, 0xF800, 0xF800, 0xF820, 0xF800, 0xFC30, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDB6, 0xFAEB, 0xF945, 0xF841, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF8E3, 0xF9C7, 0xF9C7, 0xF945, 0xF820,
-  0xF800, 0xF800, 0xF800, 0xFA49, 0xFE18, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA28, 0xF800, 0xF800, 0xFB8E, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFE9A, 0xF8C3, 0xF8E3, 0xFB4D, 0xFE18, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFF5D, 0xFB0C, 0xF800, 0xF820, 0xF800, 0xFC10, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xF986, 0xF800, 0xF800, 0xF800, 0xF9A6, 0xFEDB, 0xFFFF, 0xFCD3, 0xF986, 0xF9C7, 0xFB6D, 0xFD75,
-  0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFD34, 0xF800, 0xF800, 0xFAAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF7D, 0xF8A2, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF820,
-  0xFEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB0C, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF820, 0xF820, 0xF820, 0xF820, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF8C3, 0xFB4D, 0xFE59, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9E7,
-  0xF800, 0xF800, 0xFB2C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xFF1C, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xFC71, 0xF8E3, 0xF800, 0xF800, 0xF820, 0xF800, 0xFC51,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9A6, 0xF800, 0xF800, 0xFB4D, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFBE, 0xFD75, 0xFAAA, 0xF882, 0xF800, 0xF820, 0xFA28, 0xFCB2, 0xFE9A, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEBA, 0xFBAE, 0xF820, 0xF820, 0xF800, 0xFB8E,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD96, 0xF800, 0xF800, 0xF820, 0xF820,
-  0xF820, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF841, 0xF841,
-  0xF820, 0xF820, 0xF800, 0xF800, 0xF800, 0xFB6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFCB2, 0xF965, 0xF861, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF861, 0xF9E7, 0xF8E3, 0xF882, 0xF986, 0xFB0C, 0xFD55,
-  0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFC51, 0xFA08, 0xFA49, 0xFC71, 0xFFBE, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFACB, 0xF800, 0xF800, 0xFA69, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEBA, 0xFBEF, 0xF8C3, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFD14, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFA69, 0xF800, 0xF841, 0xFEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE79,
-  0xFC71, 0xFA28, 0xF861, 0xF800, 0xF841, 0xF965, 0xFA8A, 0xFB8E, 0xFB8E, 0xFB6D, 0xFA49, 0xF945,
-  0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xFC10, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFDB6, 0xF945, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF882, 0xFB6D, 0xFFBE,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFB,
-  0xFDF7, 0xFDB6, 0xFDB6, 0xFD96, 0xFD75, 0xFC92, 0xFACB, 0xF820, 0xF800, 0xF800, 0xF800, 0xFD34,
-  0xFFFF, 0xFF9E, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFA8A, 0xF800,
-  0xF800, 0xF800, 0xF841, 0xFF9E, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFE59, 0xFEFB, 0xFFFF, 0xFC51,
-  0xF800, 0xF800, 0xF9E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB,
-  0xFC71, 0xF9A6, 0xF800, 0xF800, 0xF800, 0xF945, 0xFA08, 0xF924, 0xF800, 0xF820, 0xF800, 0xFD75,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB4D, 0xF800, 0xF861, 0xFF3C, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFE18, 0xFBCF, 0xF986,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFD14,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFD96, 0xFBAE,
-  0xFA69, 0xF945, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF8A2, 0xFA8A, 0xFBAE,
-  0xFBEF, 0xFC71, 0xFDB6, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFB0C, 0xF800, 0xF800, 0xF820, 0xFEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xF841, 0xF800, 0xF800, 0xF800, 0xFD34, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFE18, 0xF9E7, 0xF800, 0xFBEF, 0xFFFF, 0xFE79, 0xF820, 0xF800, 0xF9C7, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFBE, 0xFDF7, 0xFB6D, 0xF8E3, 0xF800, 0xF800, 0xF924, 0xFB2C, 0xFD34, 0xFEDB, 0xFFDF,
-  0xFFFF, 0xFFBE, 0xFA8A, 0xF800, 0xF800, 0xFDB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFC10, 0xF800, 0xF800, 0xFE18, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF1C, 0xFD14, 0xFAAA, 0xF882, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFD96, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE18, 0xF9A6, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xFACB, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFBE, 0xFFDF, 0xFFFF, 0xFA69, 0xF800, 0xF800, 0xF820, 0xFEDB,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD55, 0xF8C3,
-  0xF861, 0xFC30, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC10, 0xF800, 0xF800, 0xF800, 0xFE79, 0xFFFF, 0xFFFF,
-  0xF9A6, 0xF800, 0xF9E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xFD96, 0xFAEB, 0xF882, 0xF800, 0xF861, 0xFB0C, 0xFD96,
-  0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFF5D, 0xF8A2, 0xF800, 0xFE38,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFD34, 0xF800, 0xF800, 0xFA8A, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFF1C, 0xFC71, 0xF945, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFDF7,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xF924, 0xF800, 0xF800, 0xF8C3, 0xFFBE, 0xFFFF, 0xFFDF, 0xFFDF,
-  0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE,
-  0xFBAE, 0xF800, 0xF800, 0xF800, 0xF800, 0xFDB6, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xFF1C, 0xFFFF, 0xFFFF, 0xFF5D, 0xFAAA, 0xF800,
-  0xF820, 0xF800, 0xFB6D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC51, 0xF800, 0xF9C7, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDD7, 0xFB2C, 0xF8A2, 0xF800,
-  0xF800, 0xF9E7, 0xFD55, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFBAE, 0xF800, 0xFEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFE38, 0xF800, 0xF800, 0xF800, 0xFB8E, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFC92, 0xF841, 0xF800, 0xF800, 0xF800, 0xFE9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBCF, 0xF800,
-  0xF800, 0xF904, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE9A, 0xFBAE, 0xFC10, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFEBA, 0xFC30, 0xF924, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF9E7,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFD75, 0xF904, 0xF800, 0xF820, 0xF800, 0xF9A6, 0xFFBE, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFE79, 0xF800, 0xF986, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE,
-  0xFCB2, 0xF9A6, 0xF800, 0xF800, 0xF800, 0xFAEB, 0xFE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xF861, 0xFF1C,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xF882, 0xF800, 0xF820, 0xF800, 0xF8C3,
-  0xFB2C, 0xFDB6, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFE18, 0xF841, 0xF800, 0xF820, 0xFEFB,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB6D, 0xF800, 0xF820, 0xF800, 0xFE18, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDD7, 0xF841,
-  0xF800, 0xF800, 0xF8E3, 0xFB6D, 0xFC51, 0xFC71, 0xFBEF, 0xFAEB, 0xF965, 0xF820, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFAAA, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xFD75, 0xFA08, 0xF800, 0xF800, 0xF820, 0xF800,
-  0xF904, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xF800, 0xF965, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDB6, 0xF965, 0xF800, 0xF800, 0xF861, 0xFB6D, 0xFEDB, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD14, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFB4D, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF8C3, 0xFA8A, 0xFC92, 0xFE79,
-  0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFAEB, 0xF800, 0xF861, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFF1C, 0xF8C3, 0xF800,
-  0xF820, 0xF800, 0xF9C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFF3C, 0xF882, 0xF800, 0xF820, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF8C3, 0xFBCF, 0xFE18, 0xFF3C, 0xFF7D, 0xFF7D, 0xFF5D, 0xFE9A, 0xFD34, 0xFB2C, 0xF904,
-  0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xF8C3, 0xFEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFE59, 0xF800, 0xF986, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD14, 0xF800, 0xF800,
-  0xF841, 0xFB4D, 0xFEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF5D, 0xFEBA, 0xFF1C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xFB6D, 0xF8E3, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF904, 0xFA69, 0xFC10, 0xFDB6, 0xFF3C, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBCF, 0xF800, 0xF882, 0xFF5D,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFE9A, 0xF945, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFB6D, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBCF, 0xF800, 0xF820,
-  0xF800, 0xF800, 0xF800, 0xF8E3, 0xF9A6, 0xF9E7, 0xF9C7, 0xF986, 0xF8C3, 0xF841, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF841, 0xF882,
-  0xF882, 0xF861, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF841, 0xFE59,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xF9A6, 0xF800, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFF3C, 0xF820, 0xF800, 0xFA8A, 0xFE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF1C, 0xFD34, 0xFB4D, 0xF9A6, 0xF882,
-  0xF800, 0xF882, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xFE59, 0xFB6D, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF882, 0xFA08, 0xFBEF, 0xFDF7, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xF9A6, 0xF800, 0xF882, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF5D, 0xFB4D, 0xF841, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF820, 0xF800, 0xFBEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xF924, 0xF800, 0xF800, 0xF800, 0xFA49, 0xFE18, 0xFF9E, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFF9E, 0xFF1C, 0xFE18, 0xFCD3, 0xF945, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xFD96, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFF5D, 0xFA08,
-  0xF800, 0xF800, 0xF986, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD55, 0xF861, 0xFD55, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE9A, 0xFC30,
-  0xFA08, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF945, 0xFD14, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFDD7, 0xF861, 0xF800, 0xF800, 0xF800, 0xF800, 0xF904, 0xF904, 0xF882, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF8E3, 0xFB6D, 0xFE9A, 0xFFFF, 0xFFFF, 0xFBEF, 0xF800, 0xF800, 0xF8E3, 0xFFBE,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE9A,
-  0xF904, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xFCD3,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xF820, 0xF800, 0xF800,
-  0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFB6D, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF9A6, 0xFBAE, 0xFD34, 0xFDD7, 0xFE79, 0xFEDB,
-  0xFEDB, 0xFE9A, 0xFDF7, 0xFD75, 0xFC51, 0xFAAA, 0xF861, 0xF800, 0xF800, 0xFC30, 0xFFFF, 0xFFDF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFE9A, 0xF945, 0xF800, 0xF820, 0xF800, 0xF965, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFE9A, 0xFE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFE38, 0xFBAE, 0xF904, 0xF800, 0xF800, 0xF800, 0xF820, 0xF945, 0xFAAA, 0xFC71, 0xFE59,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFDD7, 0xF800, 0xF820, 0xF800, 0xFBAE,
-  0xFFDF, 0xFFBE, 0xFF3C, 0xFE59, 0xFD55, 0xFBEF, 0xFAAA, 0xF924, 0xF800, 0xF800, 0xF800, 0xFA28,
-  0xF986, 0xF800, 0xF800, 0xF800, 0xF945, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF1C, 0xF8C3, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xFE38, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFDD7, 0xF800, 0xF820, 0xF800, 0xFB0C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFF3C, 0xFE9A, 0xFC10, 0xF841, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820,
-  0xFE9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFEBA, 0xF800, 0xFA49, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xFC51, 0xF861, 0xF800, 0xF820,
-  0xF800, 0xF800, 0xF904, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFE18, 0xFB8E, 0xF8E3, 0xF800, 0xF800, 0xF8E3, 0xFAEB, 0xFCB2,
-  0xFE18, 0xFF1C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFB8E, 0xF800, 0xF800, 0xFDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFEBA, 0xFC92, 0xF986, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF965, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9E7, 0xF800,
-  0xF820, 0xF800, 0xFC92, 0xFD96, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF904, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDB6, 0xF800, 0xF820, 0xF800,
-  0xF861, 0xFD34, 0xFF9E, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFB, 0xF9C7, 0xF861, 0xF820, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF882, 0xFB0C, 0xFD55, 0xFEDB, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCB2, 0xF800, 0xFBCF, 0xFFFF, 0xFFBE, 0xFE9A,
-  0xFC30, 0xF924, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF861, 0xFF5D, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFE18, 0xFB8E, 0xF945, 0xF800, 0xF800,
-  0xF8E3, 0xFBCF, 0xFE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF5D, 0xF882, 0xF800, 0xFDB6,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD14,
-  0xF861, 0xF800, 0xF820, 0xF800, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFD14, 0xF800, 0xF820, 0xF800, 0xFBEF, 0xFFFF, 0xFFFF, 0xF945, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xFB0C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFDB6, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF8C3, 0xF945, 0xFBCF, 0xFFFF,
-  0xFFFF, 0xFE9A, 0xF8A2, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF861, 0xF945, 0xFA08, 0xFB0C, 0xFBAE, 0xFBCF, 0xFBCF, 0xFB2C, 0xF986,
-  0xF800, 0xF800, 0xF800, 0xF945, 0xF924, 0xF800, 0xF800, 0xF800, 0xF800, 0xF965, 0xFBAE, 0xFAEB,
-  0xF800, 0xF800, 0xF841, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEBA, 0xFBAE,
-  0xF945, 0xF800, 0xF800, 0xF800, 0xFA28, 0xFD96, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFACB, 0xF800, 0xFC51, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFDD7, 0xF820, 0xF800, 0xF800, 0xF986, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF924, 0xF800, 0xF800,
-  0xF9C7, 0xFFFF, 0xFFDF, 0xFFFF, 0xFA49, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xFE18, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD55, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xFC71, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFBE, 0xFE38, 0xFD75, 0xFACB,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF945, 0xFD55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA28, 0xF800, 0xF820, 0xFE9A, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFE9A, 0xF800, 0xF800, 0xF800, 0xF800, 0xF9A6, 0xFDB6, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCB2, 0xF800, 0xF9A6,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFB4D, 0xF800, 0xF800, 0xF986, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFDB6, 0xF800, 0xF800, 0xF800, 0xFDD7, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB0C, 0xF800,
-  0xF820, 0xF800, 0xF800, 0xF9A6, 0xFB8E, 0xF800, 0xF820, 0xF800, 0xF9E7, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFBAE, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF9A6, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFBAE, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF9A6, 0xFB4D, 0xFBCF, 0xFC10, 0xFCF3, 0xFD34, 0xFD34, 0xFC51, 0xFC10, 0xFB8E, 0xFA08, 0xF820,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFB2C, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFBE, 0xFFFF,
-  0xFC92, 0xF800, 0xF800, 0xFDB6, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFA49, 0xF882,
-  0xFA08, 0xFD14, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFD75, 0xF800, 0xF800, 0xFDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE9A, 0xF800, 0xF800, 0xF986, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAEB, 0xF800, 0xF800, 0xF904,
-  0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB6D, 0xF800, 0xF820, 0xF820, 0xF800, 0xFC30, 0xFFFF, 0xFBAE,
-  0xF800, 0xF820, 0xF800, 0xFE18, 0xFFFF, 0xFFDF, 0xFFFF, 0xFF9E, 0xF8E3, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF820, 0xF800, 0xFCF3, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFF5D, 0xF841, 0xF800, 0xF800, 0xF800, 0xFD14, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE38, 0xF861, 0xF800, 0xF800, 0xF800, 0xF800, 0xFCB2,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD96, 0xF800, 0xF800, 0xFB4D, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCD3, 0xF800, 0xF800,
-  0xF986, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xF924, 0xF800, 0xF9C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFBE, 0xF8E3, 0xF800, 0xF800, 0xFAEB, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB8E, 0xF800,
-  0xF820, 0xF800, 0xF800, 0xFD55, 0xFFFF, 0xFFFF, 0xF9A6, 0xF800, 0xF800, 0xF9A6, 0xFFDF, 0xFFFF,
-  0xFEBA, 0xF9E7, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFDF7, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xF861, 0xF800, 0xF800, 0xF800, 0xFEDB,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFBE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFBE, 0xFFFF, 0xFFDF,
-  0xF8A2, 0xF800, 0xF820, 0xF820, 0xFD75, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFE38, 0xF800, 0xF800, 0xF945, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xF9E7, 0xF800, 0xF820, 0xF800, 0xFBEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA49, 0xF800, 0xF9E7, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE79, 0xF800, 0xF820, 0xF800, 0xFC92,
-  0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFB8E, 0xF800, 0xF820, 0xF800, 0xF800, 0xFE38, 0xFFFF, 0xFFFF,
-  0xFE18, 0xF800, 0xF800, 0xF800, 0xF9A6, 0xFA8A, 0xF841, 0xF800, 0xF820, 0xF800, 0xF800, 0xF820,
-  0xF800, 0xF820, 0xF800, 0xFCF3, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFCD3, 0xF800, 0xF800, 0xF800, 0xF800, 0xF945, 0xFD96, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB8E, 0xF800, 0xF820, 0xF800, 0xFCF3, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xF841, 0xF800, 0xFC30, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE38, 0xFA08, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xFE38, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFB4D, 0xF800, 0xF9C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFD34, 0xF800, 0xF820, 0xF800, 0xFDD7, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB8E, 0xF800,
-  0xF820, 0xF800, 0xF820, 0xFEFB, 0xFFFF, 0xFFDF, 0xFFFF, 0xFA28, 0xF800, 0xF820, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF904, 0xFEFB, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFB, 0xFB8E, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF8C3, 0xFA49, 0xFBAE, 0xFD14, 0xFE18, 0xFEFB, 0xFF5D, 0xFEBA, 0xFD34, 0xFA49, 0xF800,
-  0xF820, 0xF800, 0xFAEB, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF3C, 0xF800, 0xF945, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF5D, 0xF9E7, 0xFC51, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFD75,
-  0xFA69, 0xF800, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBCF, 0xF800, 0xF9A6, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBEF, 0xF800, 0xF800, 0xF820, 0xFEDB,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB8E, 0xF800, 0xF820, 0xF800, 0xF861, 0xFF3C, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFD75, 0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xF882, 0xFC51, 0xFE59, 0xFE59, 0xFC30,
-  0xF861, 0xF800, 0xF800, 0xF800, 0xF8A2, 0xFBEF, 0xFD96, 0xFDB6, 0xFCB2, 0xFA8A, 0xF861, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF841, 0xF861, 0xF820, 0xF800, 0xF800, 0xF820, 0xF800, 0xF8C3, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xF904, 0xFE79, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFC51, 0xF800, 0xF986, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFE18, 0xFB6D, 0xF904, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xFD55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFBEF, 0xF800, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFB4D, 0xF800, 0xF800, 0xF882, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB8E, 0xF800,
-  0xF820, 0xF800, 0xF882, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xF8A2, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xFDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE18, 0xF841, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF861, 0xFDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCB2, 0xF861, 0xFDD7, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF3C, 0xFD34, 0xFACB, 0xF882, 0xF800, 0xF800, 0xF800, 0xF8A2,
-  0xF965, 0xF9A6, 0xF9C7, 0xF945, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF986, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC92, 0xF800, 0xF9A6, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB2C, 0xF800, 0xF800, 0xF965, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB8E, 0xF800, 0xF820, 0xF800, 0xF924, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFA69, 0xF800, 0xF820, 0xF800, 0xF8E3, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xF9C7, 0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF841, 0xF841, 0xF841,
-  0xF841, 0xF861, 0xF861, 0xF8C3, 0xF9A6, 0xFB4D, 0xFEBA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFBE, 0xFEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xFE18, 0xFBCF, 0xF986, 0xF800, 0xF800,
-  0xF861, 0xFA08, 0xFBEF, 0xFD96, 0xFEBA, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFEDB, 0xFBEF,
-  0xF820, 0xF800, 0xF800, 0xF800, 0xFE18, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFCF3, 0xF800, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFB2C, 0xF800, 0xF800, 0xF9C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBAE, 0xF800,
-  0xF820, 0xF800, 0xF965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC30, 0xF800, 0xF820, 0xF800,
-  0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA69, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xFA69, 0xFB6D, 0xF904, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xFB2C,
-  0xFD55, 0xFE38, 0xFEDB, 0xFF1C, 0xFF3C, 0xFF3C, 0xFF3C, 0xFF3C, 0xFF5D, 0xFF9E, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFE59, 0xFC71, 0xFA69,
-  0xF861, 0xF800, 0xF800, 0xFA08, 0xFC71, 0xFE79, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCB2, 0xF800, 0xF820, 0xF800, 0xFAEB, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCD3, 0xF800, 0xF965, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB2C, 0xF800, 0xF800, 0xFA28, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBCF, 0xF800, 0xF820, 0xF800, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFD96, 0xF800, 0xF820, 0xF800, 0xF9E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFA28, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xFD55, 0xFFFF, 0xFFFF, 0xFF7D, 0xF9A6,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xFCD3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xFE38,
-  0xFC71, 0xFA8A, 0xF8E3, 0xF800, 0xF800, 0xF800, 0xF9E7, 0xFD14, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xF945, 0xF800, 0xF800, 0xF8A2, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFCD3, 0xF800, 0xF965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFB4D, 0xF800, 0xF800, 0xFAEB, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBCF, 0xF800,
-  0xF820, 0xF800, 0xF9C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xF820, 0xF800, 0xF800,
-  0xFAAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9A6, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xFCD3, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFE9A, 0xF820, 0xF800, 0xF800, 0xF800, 0xFEDB, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF9E, 0xFE38, 0xFC71, 0xFA8A, 0xF8E3, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF924, 0xFDB6,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB8E, 0xF800, 0xF820, 0xF800, 0xFDD7,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCD3, 0xF800, 0xF904, 0xFFBE,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB8E, 0xF800, 0xF800, 0xFB6D, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC51, 0xF800, 0xF820, 0xF800, 0xF9E7, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFF7D, 0xF882, 0xF800, 0xF800, 0xFB2C, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFBE, 0xF8C3, 0xF800, 0xF820, 0xF800, 0xFA49, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFA8A, 0xF800, 0xF820, 0xF800, 0xF9A6, 0xFD14, 0xFEBA, 0xFF5D, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFF7D, 0xFE38, 0xFC71, 0xFA8A, 0xF904, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF820, 0xF820, 0xF800, 0xF904, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFB2C, 0xF800, 0xF841, 0xF800, 0xFBEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFD34, 0xF800, 0xF882, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFB8E, 0xF800, 0xF800, 0xFB8E, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC92, 0xF800,
-  0xF820, 0xF800, 0xFA08, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF965, 0xF800, 0xF800,
-  0xFB6D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE9A, 0xF800, 0xF800, 0xF800, 0xF820, 0xFE79,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD96, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF861, 0xF924, 0xF9A6, 0xFA08, 0xFA49, 0xFAAA, 0xFACB, 0xFB0C, 0xFB6D, 0xFC71, 0xFD75,
-  0xFE9A, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFCD3, 0xFA8A, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFC51, 0xFC10, 0xFDB6,
-  0xFEBA, 0xFEDB, 0xFEBA, 0xFDF7, 0xFD75, 0xFC30, 0xFB2C, 0xF9C7, 0xF8A2, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF8C3, 0xFAAA, 0xFA8A, 0xF800, 0xF800, 0xF820, 0xF800, 0xFC51, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD14, 0xF841, 0xF800, 0xF820, 0xF800, 0xFA8A,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD55, 0xF800, 0xF882, 0xFF5D,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB8E, 0xF800, 0xF800, 0xFBCF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFD14, 0xF800, 0xF820, 0xF800, 0xF9E7, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xF9C7, 0xF800, 0xF800, 0xFBAE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFCD3, 0xF800, 0xF820, 0xF800, 0xFA28, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xF924, 0xF800, 0xF820, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF8A2, 0xFA49, 0xFB6D, 0xFBAE, 0xFACB, 0xF882, 0xF800, 0xF882, 0xF965, 0xFACB, 0xFCD3, 0xFF1C,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xF8E3, 0xF800, 0xFD96, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFEFB, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF986, 0xFB8E, 0xFDB6, 0xFF7D, 0xFFFF, 0xFFFF, 0xFC10,
-  0xF800, 0xF820, 0xF800, 0xFC51, 0xFFFF, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFBEF, 0xF965,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFD96, 0xF800, 0xF861, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFB8E, 0xF800, 0xF800, 0xFBCF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFD55, 0xF800,
-  0xF820, 0xF800, 0xFA69, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFACB, 0xF800, 0xF800,
-  0xFBAE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB0C, 0xF800, 0xF820, 0xF800, 0xFD55, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD75, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF904, 0xFBCF, 0xFE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE,
-  0xFB8E, 0xF800, 0xF800, 0xF800, 0xF800, 0xF861, 0xFC51, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xF904, 0xF800, 0xFDB6, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFF5D, 0xF8A2, 0xF820, 0xF820,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF8C3, 0xFA8A, 0xFCD3, 0xFEBA, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFF7D, 0xF882, 0xF800, 0xF800, 0xF986, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFAEB, 0xF800, 0xF800, 0xF820, 0xF800, 0xF800, 0xF820, 0xF800, 0xFA08,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDD7, 0xF800, 0xF841, 0xFF1C,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB8E, 0xF800, 0xF800, 0xFBCF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD96, 0xF800, 0xF820, 0xF800, 0xFB0C, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFB6D, 0xF800, 0xF800, 0xFBCF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xF9C7, 0xF800, 0xF800, 0xF882, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFC92, 0xF8A2, 0xF800, 0xF800, 0xF8C3, 0xFA8A, 0xFD55, 0xFF9E, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFB6D, 0xF800, 0xF820, 0xF820, 0xF800,
-  0xF800, 0xFC51, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD55, 0xFB4D, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xF986, 0xF800, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF965, 0xFB8E,
-  0xFDB6, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xF965, 0xF800, 0xF820, 0xF800, 0xFA28, 0xFD75, 0xFE79, 0xFEBA, 0xFEBA, 0xFE59, 0xFDD7, 0xFD75,
-  0xFD14, 0xFC92, 0xFBEF, 0xFBEF, 0xFCB2, 0xFDF7, 0xFFDF, 0xFFFF, 0xFFFF, 0xFC51, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFCD3, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFE59, 0xF800, 0xF820, 0xFEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFB8E, 0xF800, 0xF800, 0xFBCF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDB6, 0xF800,
-  0xF820, 0xF800, 0xFAEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBAE, 0xF800, 0xF800,
-  0xFBEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFF9E, 0xF8C3, 0xF800, 0xF800, 0xFA49, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xFE18, 0xFE79,
-  0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xF945, 0xF800, 0xF800, 0xF820, 0xF800, 0xFA08, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFACB, 0xF800, 0xF800,
-  0xF800, 0xF8C3, 0xFB6D, 0xFE38, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFE9A, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF820, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xFC30, 0xFFFF, 0xFFDF, 0xFFFF, 0xFDF7, 0xFB4D, 0xF9E7, 0xF986, 0xF986, 0xFA28, 0xFCF3, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFB, 0xF820, 0xF800, 0xFE38,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB6D, 0xF800, 0xF800, 0xFBCF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE18, 0xF800, 0xF820, 0xF800, 0xFAEB, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFC30, 0xF800, 0xF800, 0xFBEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFEFB,
-  0xF820, 0xF800, 0xF800, 0xFC51, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFD14, 0xF800, 0xF800, 0xF820,
-  0xF800, 0xFD55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFC92, 0xF800, 0xF841, 0xFC10, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFF7D, 0xF986,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF882, 0xFA08, 0xFE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFF3C, 0xF861, 0xF800, 0xFDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFB2C, 0xF800, 0xF800, 0xFBCF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE9A, 0xF800,
-  0xF800, 0xF800, 0xFAEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCF3, 0xF800, 0xF800,
-  0xFBEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFE18, 0xF800, 0xF820, 0xF800, 0xFDF7, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFF3C, 0xF841, 0xF800, 0xF800, 0xFA08, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE38, 0xF861, 0xFDF7,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFEBA, 0xF965, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF8C3, 0xFAAA, 0xFBEF, 0xFD14, 0xFD96, 0xFDB6, 0xFDB6, 0xFDF7, 0xFE79, 0xFF3C, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xF8E3, 0xF800, 0xFD96,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB2C, 0xF800, 0xF800, 0xFBCF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFB, 0xF820, 0xF800, 0xF800, 0xFAEB, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFD55, 0xF800, 0xF800, 0xFBEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFD55,
-  0xF800, 0xF800, 0xF820, 0xFF1C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFF1C, 0xF841, 0xF800, 0xF841,
-  0xFEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xFA69, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFD14, 0xF882, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFACB, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xF9A6, 0xF800, 0xFD34, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFB2C, 0xF800, 0xF800, 0xFB8E, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF3C, 0xF841,
-  0xF800, 0xF800, 0xFAEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD96, 0xF800, 0xF800,
-  0xFBEF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFC71, 0xF800, 0xF800, 0xF904, 0xFFBE, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFD96, 0xFBEF, 0xFBAE, 0xFD14, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFEDB, 0xFA49, 0xF800, 0xF800, 0xFCF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE59, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF3C, 0xFACB, 0xF800, 0xF800, 0xF800, 0xF800, 0xFC10, 0xFACB, 0xF800, 0xF820, 0xF820, 0xF800,
-  0xFC51, 0xFFFF, 0xFFBE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA28, 0xF800, 0xFC51,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB2C, 0xF800, 0xF800, 0xFB8E, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF5D, 0xF861, 0xF800, 0xF800, 0xFAEB, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFDB6, 0xF800, 0xF800, 0xFBEF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFB8E,
-  0xF800, 0xF800, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFC51,
-  0xF904, 0xF800, 0xF800, 0xF800, 0xF882, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xFDD7,
-  0xFD96, 0xFD55, 0xFD55, 0xFD55, 0xFCB2, 0xFBAE, 0xFA49, 0xF841, 0xF800, 0xF800, 0xFB8E, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFCF3, 0xF8A2, 0xF800, 0xF820, 0xF800, 0xF945, 0xFE18,
-  0xFFFF, 0xFFDF, 0xF9C7, 0xF800, 0xF820, 0xF800, 0xF841, 0xFD75, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFB4D, 0xF800, 0xFBAE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFACB, 0xF800, 0xF800, 0xFB4D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xF8E3,
-  0xF800, 0xF800, 0xFB0C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDD7, 0xF800, 0xF800,
-  0xFBEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFB0C, 0xF800, 0xF800, 0xFA49, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFE59, 0xF986, 0xF800, 0xF800, 0xF800, 0xF800, 0xF986, 0xFEBA, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC51, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xFB4D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEBA, 0xFA49, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xFB6D, 0xFF9E, 0xFFFF, 0xFFDF, 0xFFFF, 0xFF3C, 0xF904, 0xF800, 0xF820,
-  0xF800, 0xF800, 0xFB8E, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF3C, 0xFDF7, 0xFC92, 0xFB6D, 0xFA49, 0xF9C7, 0xF9A6, 0xF9A6, 0xF9E7, 0xFAEB, 0xFCD3, 0xFF5D,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC10, 0xF800, 0xFB4D,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA49, 0xF800, 0xF800, 0xFACB, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF965, 0xF800, 0xF800, 0xFB6D, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFDF7, 0xF800, 0xF800, 0xFBEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFA08,
-  0xF800, 0xF800, 0xFAEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFD55, 0xF820, 0xF800, 0xF800,
-  0xF800, 0xF8E3, 0xFC30, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCF3,
-  0xF8A2, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF841, 0xFC71, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFC51, 0xF861, 0xF800, 0xF820, 0xF800, 0xF924, 0xFDB6, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFE9A, 0xF882, 0xF800, 0xF820, 0xF800, 0xF800, 0xF904, 0xFC51, 0xFE79,
-  0xFF1C, 0xFEDB, 0xFDF7, 0xFCB2, 0xFB2C, 0xF9A6, 0xF861, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF8A2, 0xFCD3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFD34, 0xF800, 0xFA49, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFA69, 0xF800, 0xF800, 0xFA28, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9C7,
-  0xF800, 0xF800, 0xFB6D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEBA, 0xF820, 0xF800,
-  0xFBEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF9A6, 0xF800, 0xF800, 0xFB4D, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFD34, 0xF800, 0xF800, 0xF800, 0xF8C3, 0xFC51, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF1C, 0xFBAE, 0xF945, 0xF841, 0xF841, 0xF904,
-  0xFB2C, 0xFE9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE38, 0xF9A6, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xFB0C, 0xFF7D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE38, 0xF8A2,
-  0xF800, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF861, 0xF841, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF861, 0xF8A2, 0xF924, 0xF8E3, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xFC92, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE18, 0xF800, 0xF9A6,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA28, 0xF800, 0xF800, 0xF9C7, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA28, 0xF800, 0xF800, 0xFB6D, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xF841, 0xF800, 0xFBEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF965,
-  0xF800, 0xF800, 0xFB6D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFE59, 0xF820, 0xF800, 0xF800, 0xFACB, 0xFF3C,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFF1C, 0xFF1C, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xFB6D,
-  0xF800, 0xF800, 0xF820, 0xF800, 0xF882, 0xFD34, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xFA08, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF882, 0xF9A6, 0xFB0C, 0xFC51, 0xFD96, 0xFE79, 0xFF3C,
-  0xFF7D, 0xFFDF, 0xFF9E, 0xFD34, 0xF882, 0xF800, 0xF820, 0xF820, 0xFEFB, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFF1C, 0xF800, 0xF8E3, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xF9C7, 0xF800, 0xF800, 0xF986, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB0C,
-  0xF800, 0xF800, 0xFB6D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF1C, 0xF861, 0xF800,
-  0xFBEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFBE, 0xF8E3, 0xF800, 0xF800, 0xFBAE, 0xFFFF, 0xFFDF, 0xFFBE,
-  0xF965, 0xF800, 0xF800, 0xFBEF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFCF3, 0xF8E3, 0xF800, 0xF800, 0xF820, 0xF800, 0xF9A6, 0xFEDB, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFDD7, 0xFB6D, 0xFA08, 0xF9A6, 0xF9A6, 0xF9E7, 0xFACB, 0xFBCF, 0xFD14, 0xFE59, 0xFF5D,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE59, 0xF861,
-  0xF820, 0xF800, 0xFBCF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xF8C3, 0xF820,
-  0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9E7, 0xF800, 0xF800, 0xF904, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB8E, 0xF800, 0xF800, 0xFB6D, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFF1C, 0xF861, 0xF800, 0xFBEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFF5D, 0xF861,
-  0xF800, 0xF800, 0xFBAE, 0xFFFF, 0xFFFF, 0xFCD3, 0xF800, 0xF800, 0xFACB, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDB6, 0xF9C7, 0xF800, 0xF800, 0xF820,
-  0xF820, 0xF800, 0xFAAA, 0xFFBE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFDB6, 0xF800, 0xF800, 0xF924, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9E7, 0xF800, 0xFE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xF9E7, 0xF800, 0xF800, 0xF861, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC10,
-  0xF800, 0xF800, 0xFB6D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF5D, 0xF882, 0xF800,
-  0xFBEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFF3C, 0xF861, 0xF800, 0xF800, 0xFB8E, 0xFFFF, 0xFFFF, 0xF9A6,
-  0xF800, 0xF841, 0xFEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFF9E, 0xFD75, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB6D, 0xFB2C,
-  0xF9C7, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xFB8E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFB8E, 0xF800, 0xF800, 0xFE18, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB4D, 0xF800,
-  0xFD96, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9A6, 0xF800, 0xF800, 0xF841, 0xFF1C,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCF3, 0xF800, 0xF800, 0xFB6D, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFF5D, 0xF882, 0xF800, 0xFBCF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFEFB, 0xF841,
-  0xF800, 0xF800, 0xFB2C, 0xFFFF, 0xFE79, 0xF820, 0xF800, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBCF, 0xF800, 0xFC71, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFE18, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF800,
-  0xFBCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xF924, 0xF800, 0xFB4D, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCB2, 0xF800, 0xFC30, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xF9A6, 0xF800, 0xF800, 0xF800, 0xFE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD96,
-  0xF800, 0xF800, 0xFB6D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xF882, 0xF800,
-  0xFC30, 0xFFFF, 0xFFDF, 0xFFFF, 0xFEBA, 0xF800, 0xF800, 0xF800, 0xFA49, 0xFFFF, 0xFB6D, 0xF800,
-  0xF800, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xF9A6, 0xF800, 0xFB4D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBCF, 0xF800, 0xF841,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFBAE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFD75, 0xF800, 0xF8C3, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE18, 0xF800,
-  0xFACB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9A6, 0xF800, 0xF820, 0xF800, 0xFD96,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE38, 0xF800, 0xF800, 0xFB8E, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xF904, 0xF800, 0xFCD3, 0xFFFF, 0xFFDF, 0xFFFF, 0xFE38, 0xF800,
-  0xF800, 0xF800, 0xF924, 0xFE38, 0xF8A2, 0xF820, 0xF800, 0xF861, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xFF3C, 0xFEDB, 0xFE18, 0xFDD7, 0xFD96, 0xFD75,
-  0xFD75, 0xFD75, 0xFD75, 0xFD75, 0xFDB6, 0xFDF7, 0xFEBA, 0xFF3C, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xF8E3, 0xF800, 0xFA49, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFA28, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFAAA, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFF7D,
-  0xFB8E, 0xF9E7, 0xF9E7, 0xFD14, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9E7, 0xF800, 0xFD96, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF5D, 0xF820, 0xF924, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xF9C7, 0xF800, 0xF820, 0xF800, 0xFD34, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFB,
-  0xF841, 0xF800, 0xFBAE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF965, 0xF800,
-  0xFD14, 0xFFFF, 0xFFDF, 0xFFFF, 0xFDB6, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xFACB, 0xFF5D, 0xFFDF, 0xFF7D, 0xFE9A, 0xFD75, 0xFBEF, 0xFA8A, 0xF9C7, 0xF8E3,
-  0xF861, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF820, 0xF945, 0xFA8A, 0xFC10, 0xFD96, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF7D, 0xF882, 0xF800, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF924, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF8C3, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCB2, 0xF800, 0xF800, 0xF800, 0xF965, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFDD7, 0xF800, 0xFAAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF965,
-  0xF800, 0xFEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9E7, 0xF800, 0xF820, 0xF800, 0xFC30,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xF8C3, 0xF800, 0xFBAE, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF986, 0xF800, 0xFD75, 0xFFFF, 0xFFDF, 0xFFFF, 0xFD96, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF986, 0xFBCF, 0xFAEB, 0xF945, 0xF800, 0xF800, 0xF800, 0xF8C3, 0xF841,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF8C3, 0xF9E7, 0xFAEB, 0xFBEF,
-  0xFCB2, 0xFD75, 0xFDB6, 0xFDD7, 0xFDB6, 0xFD96, 0xFCD3, 0xFBAE, 0xFA69, 0xF8C3, 0xF800, 0xF800,
-  0xF800, 0xF8A2, 0xFAAA, 0xFE18, 0xFFFF, 0xFFFF, 0xFF7D, 0xF882, 0xF800, 0xF965, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFF3C, 0xF841, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFC92, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFB6D, 0xF9E7, 0xFB0C, 0xFBAE,
-  0xFC71, 0xFD34, 0xFD96, 0xFDD7, 0xFE18, 0xFE79, 0xFEDB, 0xFEFB, 0xFF1C, 0xFF3C, 0xFF3C, 0xFF7D,
-  0xFF7D, 0xFF7D, 0xFF7D, 0xFF7D, 0xFF7D, 0xFF7D, 0xFF5D, 0xFF3C, 0xFEFB, 0xFE38, 0xFCB2, 0xF924,
-  0xF820, 0xF820, 0xF800, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9A6, 0xF841, 0xFF7D,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB0C, 0xF800, 0xFD34, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFA08, 0xF800, 0xF820, 0xF800, 0xFBAE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xF986, 0xF800, 0xFBCF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9C7, 0xF800,
-  0xFDB6, 0xFFFF, 0xFFDF, 0xFFFF, 0xFD55, 0xF800, 0xF820, 0xF800, 0xF820, 0xFEBA, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFEBA, 0xFCD3, 0xFA8A, 0xF924, 0xF861, 0xF841, 0xF861, 0xF8A2, 0xF965, 0xFA28, 0xFB8E,
-  0xFD34, 0xFE9A, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFE79, 0xFBCF, 0xF904, 0xF800, 0xF800, 0xF800, 0xFA69, 0xFE38,
-  0xFFDF, 0xF882, 0xF800, 0xF8A2, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEBA, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF924, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFEBA, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF820, 0xF820, 0xF841, 0xF861, 0xF861, 0xF861, 0xF861, 0xF861, 0xF861, 0xF861, 0xF861, 0xF861,
-  0xF861, 0xF841, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFA49, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFD96, 0xF800, 0xFCF3, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCB2,
-  0xF800, 0xFA28, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFACB, 0xF800, 0xF820, 0xF800, 0xFB4D,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA49, 0xF800, 0xFC10, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9C7, 0xF800, 0xFE59, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCF3, 0xF800,
-  0xF820, 0xF800, 0xF861, 0xFF7D, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D,
-  0xFF3C, 0xFF3C, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF7D, 0xFC30, 0xF861, 0xF800, 0xF800, 0xF800, 0xFA28, 0xF861, 0xF800, 0xF841, 0xFF3C, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFDD7, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFDD7, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE9A, 0xF800, 0xF800, 0xF820, 0xF820,
-  0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF800,
-  0xF800, 0xF820, 0xF800, 0xFB8E, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF8E3, 0xF9A6,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE59, 0xF800, 0xF800, 0xFE38, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFB8E, 0xF800, 0xF841, 0xF800, 0xFB0C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFBAE, 0xF800, 0xFCD3, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9E7, 0xF800,
-  0xFF1C, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC51, 0xF800, 0xF820, 0xF800, 0xF861, 0xFF7D, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFE9A, 0xF924, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xFEDB, 0xFFFF, 0xFFDF, 0xFFFF, 0xFD75, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xFC30, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFEDB, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820,
-  0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xFCB2, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC51, 0xF800, 0xFEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE,
-  0xF904, 0xF800, 0xFAEB, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCD3, 0xF800, 0xF841, 0xF800, 0xFB0C,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFD14, 0xF800, 0xFD75, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9C7, 0xF800, 0xFFBE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBCF, 0xF800,
-  0xF820, 0xF800, 0xF861, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFF1C, 0xF924, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xFE38, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFD14, 0xF800, 0xF820, 0xF800, 0xFB0C, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF5D, 0xF861, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF8C3, 0xF986, 0xFA08,
-  0xFB0C, 0xFB8E, 0xFBEF, 0xFC10, 0xFCF3, 0xFC71, 0xFBCF, 0xFB2C, 0xF924, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xFE18, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF5D, 0xF800,
-  0xFBCF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA8A, 0xF800, 0xF882, 0xFF5D, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFEFB, 0xF800, 0xF800, 0xF800, 0xFB2C, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF5D, 0xF924, 0xFE18, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC51, 0xFB6D,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBAE, 0xF800, 0xF820, 0xF800, 0xF861, 0xFF7D, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFE79, 0xF841,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xFDB6, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCD3, 0xF800, 0xF820, 0xF800,
-  0xFE18, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xF945, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF965, 0xFB0C,
-  0xFC92, 0xFDD7, 0xFEFB, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFBE, 0xFB4D, 0xF800, 0xF800, 0xF800, 0xF800, 0xF882, 0xFF7D, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA69, 0xF8A2, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFCB2, 0xF800, 0xF800, 0xFD14, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFD55, 0xF924, 0xF800, 0xFCF3,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB0C, 0xF800,
-  0xF820, 0xF800, 0xF861, 0xFF5D, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBAE, 0xF800, 0xF820, 0xF800, 0xF800, 0xFD96, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFC51, 0xF800, 0xF800, 0xF8C3, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB0C, 0xF800, 0xF820, 0xF800,
-  0xF800, 0xF8E3, 0xFC71, 0xFEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFF7D, 0xF841, 0xF800,
-  0xF820, 0xF800, 0xFA28, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFDB6,
-  0xF800, 0xFD75, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFEDB, 0xF820, 0xF800, 0xFACB, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFE38, 0xF882, 0xF800, 0xF800, 0xF800, 0xF882, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF5D,
-  0xF882, 0xF800, 0xF841, 0xF800, 0xFD96, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBCF, 0xF800, 0xF800, 0xFA28,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFD96, 0xF800, 0xF800, 0xF800, 0xF820, 0xFE9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFF3C, 0xF841, 0xF800, 0xF820, 0xF800, 0xFC92, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xF882, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xF9A6, 0xF800, 0xF924, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF3C, 0xFDD7, 0xFB4D, 0xF841, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF820, 0xFB4D, 0xFBCF, 0xFBAE, 0xFBEF, 0xFBEF, 0xFCB2, 0xFD14, 0xFD14, 0xFD75,
-  0xFD75, 0xFDB6, 0xFDB6, 0xFDD7, 0xFE18, 0xFE38, 0xFEDB, 0xFEDB, 0xFF1C, 0xFF3C, 0xFF5D, 0xFF9E,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD75, 0xF800, 0xF800, 0xF800, 0xFE38, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFBEF, 0xF800, 0xF800, 0xFB8E, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF924, 0xF800, 0xF800,
-  0xF820, 0xFF3C, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCF3, 0xF800, 0xF820,
-  0xF800, 0xF861, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFB4D, 0xF800, 0xFE38, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC51, 0xF800, 0xF820, 0xFEBA, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xFD75, 0xFBEF, 0xFA69, 0xF945,
-  0xF861, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF820, 0xF841, 0xF861, 0xF882, 0xF8C3, 0xF965, 0xF9C7, 0xFA08, 0xFB0C, 0xFBAE, 0xFC92,
-  0xFDB6, 0xFEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFDF7, 0xFA49, 0xFB4D, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBEF, 0xF800, 0xF800, 0xFCF3,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFD14, 0xF800, 0xF820, 0xF800, 0xFC30, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFF9E, 0xF904, 0xF800, 0xF820, 0xF800, 0xFB8E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDF7, 0xF800, 0xFA49, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFF1C, 0xF861, 0xF800, 0xFD96, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEBA, 0xFCD3, 0xFAEB,
-  0xF945, 0xF841, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF820, 0xF800, 0xF800, 0xF820, 0xF820, 0xF820, 0xF820, 0xF820, 0xF820, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF882, 0xFBCF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFC10, 0xF800, 0xF800, 0xFDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9E7, 0xF800,
-  0xF820, 0xF841, 0xFDD7, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFACB, 0xF800, 0xF820, 0xF800,
-  0xF8A2, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFBE, 0xF8C3, 0xF800, 0xFDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB2C, 0xF800, 0xFC92, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFDF7, 0xFB8E, 0xF965, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF820, 0xF820, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF965, 0xFAEB, 0xFC10, 0xFD34, 0xFDB6, 0xFDF7, 0xFE9A, 0xFE9A,
-  0xFE9A, 0xFE9A, 0xFE9A, 0xFE38, 0xFDD7, 0xFDB6, 0xFD75, 0xFD14, 0xFC71, 0xFBEF, 0xFBCF, 0xFBAE,
-  0xFBAE, 0xFB8E, 0xFB8E, 0xFD34, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCD3, 0xF800, 0xF841, 0xFEFB,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xF861, 0xF800, 0xF800, 0xF841, 0xFD14, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFC10, 0xF800, 0xF820, 0xF800, 0xF800, 0xFDB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAEB, 0xF800, 0xF965, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFF3C, 0xF882, 0xFC10, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFF5D, 0xFC51, 0xF945, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF861,
-  0xF965, 0xFA8A, 0xFB8E, 0xFC71, 0xFD75, 0xFDD7, 0xFE79, 0xFEDB, 0xFEFB, 0xFEDB, 0xFE79, 0xFDF7,
-  0xFCB2, 0xF9C7, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF841, 0xFBCF, 0xFEBA, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFD55, 0xF800, 0xF924, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDD7,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xFAAA, 0xFEBA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC30, 0xF800, 0xF820, 0xF800, 0xF800, 0xFCB2,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFD34, 0xF800, 0xF800, 0xFD14, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xFF3C, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC71, 0xF800, 0xF820,
-  0xF861, 0xF945, 0xFA28, 0xFBCF, 0xFD96, 0xFF1C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9E7, 0xF800, 0xF820, 0xF800,
-  0xF882, 0xFE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF,
-  0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE18, 0xF800, 0xFA8A, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFD75, 0xF841, 0xF800, 0xF820, 0xF800, 0xF841,
-  0xFAEB, 0xFDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFC30,
-  0xF800, 0xF820, 0xF800, 0xF8A2, 0xFD75, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF1C, 0xF861, 0xF800, 0xFB2C, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xFF5D, 0xFF5D, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFBE, 0xFFFF, 0xFD55, 0xF800, 0xF841, 0xF800, 0xFB4D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFF5D, 0xF800, 0xFCD3, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFE38, 0xF924, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF945, 0xFB8E, 0xFDD7, 0xFF9E,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFBEF, 0xF800, 0xF800, 0xF800, 0xFAAA, 0xFEFB, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xF986, 0xF800, 0xFDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xF945, 0xF800, 0xF800,
-  0xFC71, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFC51, 0xFA69, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCD3, 0xFF5D, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFF7D, 0xFB6D, 0xF820, 0xF800,
-  0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF8E3, 0xFA8A, 0xFBEF, 0xFBCF, 0xF945, 0xF800, 0xF800,
-  0xFA49, 0xFDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDB6, 0xFD55, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFEFB, 0xFA8A, 0xFA69, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF1C, 0xFB6D, 0xFACB, 0xFB0C, 0xFB8E, 0xFC30, 0xFD34, 0xFDF7, 0xFEFB, 0xFF9E, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xF841, 0xF800, 0xFEFB, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE9A, 0xFB2C, 0xF861, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF841, 0xFB2C, 0xFE38, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF5D, 0xFE79, 0xFD34, 0xFACB, 0xFD34, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xF986, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF8A2, 0xF9C7, 0xFAEB, 0xFBEF, 0xFD34, 0xFDF7, 0xFEFB, 0xFF7D, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFD55, 0xF800, 0xF800, 0xFDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF1C, 0xFCB2, 0xFA69, 0xF924, 0xF861, 0xF8A2, 0xF9A6, 0xFB0C, 0xFD34, 0xFF5D, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xFF1C, 0xFE59, 0xFDD7, 0xFD75, 0xFCB2,
-  0xFC10, 0xFBAE, 0xFB0C, 0xFA08, 0xF965, 0xF882, 0xF800, 0xF800, 0xF800, 0xF800, 0xF882, 0xFFBE,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFF3C, 0xFDD7, 0xFC51, 0xFB2C, 0xFA08, 0xF945, 0xF841, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF8C3, 0xF965, 0xFA49, 0xFB6D, 0xFBEF, 0xFD14, 0xFDB6,
-  0xFE38, 0xFEFB, 0xFF3C, 0xFF5D, 0xFF9E, 0xFF5D, 0xFE18, 0xF924, 0xF800, 0xF800, 0xFD14, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFF5D, 0xFF7D,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xFE59, 0xFCF3, 0xFBAE, 0xFA49, 0xF986,
-  0xF882, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF861, 0xF945, 0xFA08,
-  0xFB4D, 0xFBEF, 0xFD34, 0xFDB6, 0xFEBA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCB2, 0xF9C7, 0xFBEF,
-  0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFF5D, 0xFEFB, 0xFE18, 0xFDB6, 0xFD34, 0xFC30, 0xFBAE, 0xFB2C, 0xFA49, 0xF986,
-  0xF924, 0xF841, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF861, 0xF8C3, 0xF882,
-  0xF800, 0xF800, 0xF820, 0xF800, 0xFC51, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE79, 0xFC30, 0xFA28,
-  0xF8C3, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF8E3, 0xF9C7, 0xFACB, 0xFBAE, 0xFCB2,
-  0xFDB6, 0xFE79, 0xFF3C, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFA08, 0xF800, 0xF800, 0xF965, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFF5D, 0xFEDB, 0xFDF7, 0xFD14,
-  0xFBCF, 0xFA8A, 0xF945, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xFBEF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFD14, 0xF9C7, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF924, 0xFAEB, 0xFCB2, 0xFE38,
-  0xFF3C, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFBE, 0xFFFF, 0xFD14, 0xF800, 0xF841,
-  0xF800, 0xFACB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFB, 0xFD14, 0xFA28,
-  0xF800, 0xF800, 0xF820, 0xF800, 0xFBEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFA8A, 0xF800, 0xF800, 0xF800, 0xF800, 0xF861,
-  0xFB2C, 0xFDF7, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF,
-  0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFBCF, 0xF800, 0xF800, 0xF820, 0xF800, 0xFBEF, 0xF73D, 0xEF7E, 0xF79F,
-  0xF7BF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD55, 0xF841, 0xF820, 0xF800, 0xFBEF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF1C, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC10,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xFA28, 0xFEBA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFF5D, 0xFF1C, 0xFE9A, 0xFDB6, 0xFCD3, 0xFB6D, 0xF986, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF000, 0xE820, 0xEB88, 0xF671, 0xF714, 0xEE93, 0xED52, 0xECB4, 0xF4F4, 0xFD75, 0xFD95,
-  0xFD75, 0xFD75, 0xFD96, 0xFDF7, 0xFE9A, 0xFF3C, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF,
-  0xFFFF, 0xFCF3, 0xF800, 0xF800, 0xFC10, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFF9E, 0xFF5D, 0xFF5D, 0xFF3C, 0xFF3C, 0xFF3C, 0xFF1C, 0xFEFB, 0xFEFB, 0xFEFB, 0xFEFB, 0xFEFB,
-  0xFEFB, 0xFEFB, 0xFEFB, 0xFEFB, 0xFEFB, 0xFEFB, 0xFEFB, 0xFF1C, 0xFF3C, 0xFF3C, 0xFF5D, 0xFFBE,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAAA, 0xF841, 0xF8E3,
-  0xFE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD34, 0xF8C3, 0xF8C3, 0xFA69, 0xFD75, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFF5D, 0xFE9A, 0xFDD7, 0xFD55,
-  0xFC92, 0xFBCF, 0xFB6D, 0xFAEB, 0xFA49, 0xF9E7, 0xF9A6, 0xF924, 0xF882, 0xF861, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xE800, 0xEB25, 0xFF0D, 0xFFEE, 0xFFCD, 0xFFCD,
-  0xFFAB, 0xFE80, 0xF440, 0xE160, 0xE000, 0xE800, 0xF000, 0xF800, 0xF800, 0xF800, 0xF800, 0xF861,
-  0xF924, 0xFA8A, 0xFCB2, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xF8E3, 0xF800, 0xFCB2, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xFDF7, 0xFCB2, 0xFBCF, 0xFB4D, 0xFACB,
-  0xFA28, 0xF9C7, 0xF9A6, 0xF986, 0xF945, 0xF904, 0xF8C3, 0xF861, 0xF861, 0xF841, 0xF841, 0xF861,
-  0xF841, 0xF820, 0xF820, 0xF820, 0xF820, 0xF820, 0xF820, 0xF820, 0xF820, 0xF820, 0xF820, 0xF820,
-  0xF820, 0xF841, 0xF841, 0xF861, 0xF861, 0xF8E3, 0xF965, 0xFA08, 0xFDB6, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFE79, 0xF800, 0xF800, 0xF800, 0xFBCF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF9E, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE38, 0xFB6D,
-  0xFA08, 0xF924, 0xF861, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF820, 0xF800, 0xF800, 0xF000, 0xE840,
-  0xF529, 0xFFEF, 0xFFEE, 0xFFCE, 0xFFCE, 0xFFCE, 0xFFD0, 0xFFC9, 0xFFE0, 0xFFA0, 0xF5A0, 0xE260,
-  0xE020, 0xE800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF8C3, 0xFCD3, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xF9C7, 0xF800, 0xFD75, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCB2,
-  0xF904, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xFAAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD75, 0xF800, 0xF841, 0xF800,
-  0xFB0C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF904, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF820, 0xF800, 0xF800, 0xF8C3, 0xF9C7, 0xFA28, 0xFA8A, 0xFA8A, 0xFA28, 0xF9C7, 0xF8E3, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF000, 0xE820, 0xF56A, 0xFFEF, 0xFFAE, 0xFFAE, 0xFFCE, 0xFFAE, 0xFFCE,
-  0xFFCE, 0xFFCD, 0xFF61, 0xFF60, 0xFFC0, 0xFFC0, 0xF5E1, 0xE4AF, 0xEC73, 0xF3EF, 0xFB6D, 0xFA08,
-  0xF882, 0xF820, 0xF820, 0xF800, 0xF800, 0xFCD3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9E7, 0xF800, 0xFE18, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDF7, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF8E3, 0xFB4D, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFD14, 0xF800, 0xF820, 0xF800, 0xFAAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFB, 0xF820, 0xF820,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF861, 0xFD96, 0xFF7D, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFEBA, 0xFC71, 0xF904, 0xF800, 0xF000, 0xE305, 0xF7EE,
-  0xFF8E, 0xFFCE, 0xFFAE, 0xFFCE, 0xFFEE, 0xFFAD, 0xFFB0, 0xF794, 0xF74C, 0xFF60, 0xFF40, 0xFF40,
-  0xFFA0, 0xFFC3, 0xE796, 0xE7DF, 0xF7FF, 0xFFFF, 0xFCD3, 0xF800, 0xF800, 0xF800, 0xF800, 0xF861,
-  0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFA08, 0xF800, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF5D, 0xFB2C,
-  0xF945, 0xF882, 0xF861, 0xF861, 0xF861, 0xF861, 0xF861, 0xF861, 0xF861, 0xF882, 0xF882, 0xF8C3,
-  0xF945, 0xF924, 0xF986, 0xF986, 0xF9A6, 0xF9C7, 0xF9C7, 0xF9E7, 0xFA08, 0xFA08, 0xFACB, 0xFB0C,
-  0xFAEB, 0xFAEB, 0xFB4D, 0xFB6D, 0xFB6D, 0xFB6D, 0xFB6D, 0xFB6D, 0xFBAE, 0xFC10, 0xFD34, 0xFE38,
-  0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCD3, 0xF800, 0xF820, 0xF800,
-  0xFAAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFE59, 0xF800, 0xF800, 0xF9C7, 0xFB0C, 0xF945, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF841, 0xFE79, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFF9E, 0xFAAA, 0xE800, 0xDD09, 0xE74D, 0xF76D, 0xFFAE, 0xFFEF, 0xFFAD, 0xFEF1, 0xFFFD,
-  0xFFFF, 0xF7BF, 0xE71A, 0xFF41, 0xFF60, 0xFF60, 0xFF40, 0xFF40, 0xFF20, 0xE6D6, 0xEFBF, 0xFEBA,
-  0xF945, 0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xFC92, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBAE, 0xF945, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFF7D, 0xFF5D, 0xFF3C, 0xFF3C, 0xFF3C,
-  0xFF3C, 0xFF3C, 0xFF5D, 0xFF7D, 0xFF7D, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFCD3, 0xF800, 0xF820, 0xF800, 0xFAAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDD7, 0xF800, 0xF800,
-  0xFE9A, 0xFFFF, 0xFFDF, 0xFDB6, 0xF945, 0xF800, 0xF820, 0xF800, 0xF8A2, 0xFEBA, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFFFF, 0xF32C, 0xE800, 0xDD89, 0xCE8C,
-  0xEF0D, 0xFFCE, 0xFEED, 0xF9E3, 0xF862, 0xFACB, 0xFD75, 0xFF5C, 0xEFBF, 0xF78B, 0xFF40, 0xFF40,
-  0xFF40, 0xFF40, 0xFF40, 0xFF65, 0xE4B2, 0xF0A2, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xFA8A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFF7D, 0xFF1C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC51, 0xF800, 0xF820, 0xF800,
-  0xFB2C, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFDB6, 0xF800, 0xF861, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xFA49,
-  0xF800, 0xF820, 0xF800, 0xF8A2, 0xFDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFCF3, 0xF000, 0xE020, 0xFE6A, 0xD68B, 0xD68C, 0xEEEC, 0xF122, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF8A2, 0xEA4A, 0xED29, 0xFF80, 0xFF40, 0xFF40, 0xFF40, 0xFF20, 0xFFC0, 0xEAC0, 0xE000,
-  0xF820, 0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCD3, 0xFBEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFBAE, 0xF800, 0xF841, 0xF800, 0xFB6D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDB6, 0xF800, 0xF841,
-  0xFEDB, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFBE, 0xF986, 0xF800, 0xF820, 0xF800, 0xF820, 0xFC51,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDB6, 0xF820, 0xF020, 0xE060, 0xFEAA, 0xF76C,
-  0xC64B, 0xE244, 0xF800, 0xF820, 0xF800, 0xF800, 0xF820, 0xF800, 0xF000, 0xE960, 0xFF80, 0xFF40,
-  0xFF40, 0xFF40, 0xFF20, 0xFFA0, 0xF5E0, 0xE000, 0xF000, 0xF986, 0xFC10, 0xFE9A, 0xFD75, 0xF800,
-  0xF924, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBCF,
-  0xF800, 0xFA8A, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFACB, 0xF800, 0xF841, 0xF800,
-  0xFBAE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFDF7, 0xF800, 0xF800, 0xFE18, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFE9A, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF9E7, 0xFDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFB,
-  0xF800, 0xF800, 0xF000, 0xE000, 0xFECB, 0xFFCC, 0xEE6A, 0xD861, 0xF4D3, 0xFE9A, 0xFD34, 0xFA49,
-  0xF800, 0xF820, 0xF800, 0xE8A0, 0xFEC0, 0xFF60, 0xFF40, 0xFF40, 0xFF40, 0xFF60, 0xFEE0, 0xE32A,
-  0xF5B7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE9A, 0xF800, 0xF882, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE59, 0xF820, 0xF800, 0xFA08, 0xFFBE, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xF904, 0xF800, 0xF820, 0xF800, 0xFC30, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE38, 0xF800, 0xF800,
-  0xFCD3, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB0C, 0xF800, 0xF820, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF986, 0xFB2C, 0xFFBE, 0xFF7D, 0xFDB6, 0xFDB6, 0xF514, 0xE2C9, 0xFEEA, 0xFF8C,
-  0xFF6A, 0xED8C, 0xE75E, 0xF7DF, 0xFFFF, 0xFFFF, 0xFBEF, 0xF800, 0xF800, 0xE800, 0xFE20, 0xFF80,
-  0xFF20, 0xFF40, 0xFF40, 0xFF40, 0xFF40, 0xE778, 0xEFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFD75, 0xF800,
-  0xF8A2, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xF965, 0xF800, 0xF800, 0xFA69, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD34, 0xF800, 0xF800, 0xF820, 0xF800,
-  0xFD34, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFE9A, 0xF820, 0xF800, 0xFB0C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFDD7, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xF9C7, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xF7FF, 0xE75B, 0xFF4B, 0xFF6B, 0xFF6B, 0xFFAB, 0xEF12, 0xE6FD, 0xEF5D, 0xFFBE,
-  0xFFFF, 0xF986, 0xF800, 0xE800, 0xF540, 0xFFA0, 0xFF20, 0xFF40, 0xFF40, 0xFF40, 0xFF20, 0xE714,
-  0xEFBF, 0xFFDE, 0xFFBE, 0xFFFF, 0xFBEF, 0xF800, 0xF8A2, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCB2, 0xF800, 0xF841, 0xF800, 0xFAAA, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFF7D, 0xFF5D, 0xFF3C,
-  0xFF1C, 0xFEFB, 0xFEBA, 0xFE38, 0xFDD7, 0xFD96, 0xFD55, 0xFD14, 0xFC30, 0xFBCF, 0xFB6D, 0xFACB,
-  0xF9C7, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xFDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFB, 0xF841, 0xF800,
-  0xF8E3, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF1C, 0xF841, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF924, 0xFFBE, 0xFFFF, 0xFFDF, 0xFFFF, 0xF79E, 0xEF3A, 0xFF6C, 0xFF6B,
-  0xFF6B, 0xFF4B, 0xFF6A, 0xEF11, 0xE71D, 0xEF5D, 0xFFFF, 0xFAEB, 0xF800, 0xF000, 0xF4C0, 0xFFA0,
-  0xFF20, 0xFF40, 0xFF40, 0xFF20, 0xFF80, 0xEC25, 0xED77, 0xFFFF, 0xFFFF, 0xFF7D, 0xF904, 0xF800,
-  0xF861, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF7D, 0xF8C3, 0xF800, 0xF820, 0xF800, 0xFA8A, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFF7D, 0xFF3C, 0xFEFB, 0xFE79, 0xFDF7, 0xFDB6, 0xFD75, 0xFD34,
-  0xFC92, 0xFBEF, 0xFBCF, 0xFB8E, 0xFB6D, 0xFB2C, 0xFAAA, 0xFA08, 0xF9E7, 0xF9C7, 0xF9C7, 0xF9A6,
-  0xF986, 0xF945, 0xF924, 0xF882, 0xF861, 0xF861, 0xF841, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820,
-  0xFEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFF3C, 0xF861, 0xF800, 0xF800, 0xFD96, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFEDB, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFB2C, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xF7BF, 0xEEF8, 0xFF2A, 0xFF6B, 0xFF6B, 0xFF4B, 0xFF4B, 0xFF69, 0xF70F, 0xE73C,
-  0xEF1C, 0xF0C2, 0xF800, 0xF000, 0xF4A0, 0xFFA0, 0xFF20, 0xFF20, 0xFF20, 0xFF20, 0xFFC0, 0xEAC0,
-  0xE800, 0xFA69, 0xFBAE, 0xF945, 0xF800, 0xF800, 0xF861, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCB2, 0xFF3C, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC10, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF924, 0xFC71, 0xFE18, 0xFE18, 0xFD55, 0xFC10, 0xFB0C, 0xFA08, 0xF9A6, 0xF924, 0xF882, 0xF841,
-  0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF820, 0xF820, 0xF820, 0xF820, 0xF820, 0xF841, 0xF820, 0xF820, 0xF820,
-  0xF820, 0xF800, 0xF800, 0xF820, 0xF820, 0xF904, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xF882, 0xF800,
-  0xF800, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB6D, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xFBEF, 0xFFFF, 0xFFFF, 0xF7FF, 0xEC2E, 0xFE88, 0xFF8B,
-  0xFF4B, 0xFF4A, 0xFF4A, 0xFF4A, 0xFF48, 0xF7AF, 0xE34B, 0xE801, 0xF32C, 0xF5D8, 0xF6EC, 0xFF20,
-  0xFF20, 0xFF20, 0xFF20, 0xFF00, 0xFFA0, 0xEAC0, 0xE800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF841, 0xFF1C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xF9C7, 0xFD96, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFF5D, 0xF882, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF820, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF841,
-  0xF882, 0xF882, 0xF882, 0xF861, 0xF861, 0xF841, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFAAA,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF904, 0xF800, 0xF800, 0xF800, 0xFA49, 0xFEBA, 0xFFBE, 0xFDD7,
-  0xFAAA, 0xF800, 0xF800, 0xF820, 0xF924, 0xF9C7, 0xF986, 0xF861, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xFA49, 0xFE59, 0xFD55, 0xE861, 0xF649, 0xFFAB, 0xFF4A, 0xFF4A, 0xFF4A, 0xFF4A, 0xFF4A, 0xFF69,
-  0xFE27, 0xE5D3, 0xE7DF, 0xEFDF, 0xEF2E, 0xFF00, 0xFF20, 0xFF20, 0xFF20, 0xFF00, 0xFF80, 0xEBE5,
-  0xE800, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF820, 0xFEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFBEF, 0xFE79, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFBCF, 0xF800, 0xF820, 0xF800,
-  0xF800, 0xF820, 0xF800, 0xF800, 0xF820, 0xF820, 0xF841, 0xF820, 0xF820, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF861, 0xF945, 0xF9E7, 0xFA8A, 0xFB2C, 0xFACB, 0xF986, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xFAAA, 0xFEFB, 0xFF3C, 0xFF7D, 0xFF7D, 0xFF5D, 0xFF3C, 0xFEFB,
-  0xFEBA, 0xFE59, 0xFDD7, 0xFD75, 0xFCF3, 0xFC10, 0xFBAE, 0xFB4D, 0xFACB, 0xFA28, 0xF9E7, 0xF9C7,
-  0xF9A6, 0xF9C7, 0xF9E7, 0xFA8A, 0xFBAE, 0xFEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF986, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF841, 0xF904, 0xF800, 0xF800, 0xFA28, 0xFCF3, 0xFEFB, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFF3C, 0xFCF3, 0xF8E3, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF000, 0xF404, 0xFFEB,
-  0xFF2A, 0xFF4A, 0xFF4A, 0xFF4A, 0xFF4A, 0xFF2A, 0xFF6A, 0xFF6B, 0xEEF5, 0xDEFF, 0xE6AD, 0xF6C0,
-  0xFF00, 0xFF20, 0xFF20, 0xFF20, 0xFF20, 0xEF34, 0xEDF9, 0xF9C7, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xFE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFF5D, 0xF8C3, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF820, 0xF8C3, 0xF9C7, 0xFB0C, 0xFC30, 0xFD75, 0xFE79, 0xFF5D, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDB6, 0xF861, 0xF800, 0xF820, 0xF800, 0xFDB6, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9A6, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF924,
-  0xFDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE9A, 0xF861, 0xF800,
-  0xF820, 0xF800, 0xF841, 0xF30C, 0xEC4C, 0xFF4A, 0xFF4A, 0xFF4A, 0xFF4A, 0xFF4A, 0xFF4A, 0xFF49,
-  0xFF29, 0xFF29, 0xFF28, 0xEEF4, 0xCE0B, 0xDE20, 0xF6C0, 0xFF00, 0xFF20, 0xFF20, 0xFF20, 0xE6F3,
-  0xEFDF, 0xFFDE, 0xFA8A, 0xF800, 0xF800, 0xF800, 0xF800, 0xFDB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE79, 0xF9A6, 0xF841,
-  0xF800, 0xF820, 0xF841, 0xF8A2, 0xF986, 0xFA49, 0xFB8E, 0xFCB2, 0xFDD7, 0xFEFB, 0xFF9E, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFB2C, 0xF800, 0xF800, 0xF841, 0xFF1C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9E7, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF841, 0xFEFB, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF945, 0xF800, 0xF800, 0xF9E7, 0xFE9A, 0xFFFF, 0xF75E, 0xF5EA,
-  0xFF8A, 0xFF2A, 0xFF4A, 0xFF4A, 0xFF49, 0xFF29, 0xFF29, 0xFF29, 0xFF29, 0xFF48, 0xE687, 0xC580,
-  0xDE20, 0xF6C0, 0xFF00, 0xFF00, 0xFF20, 0xE6F3, 0xEF3E, 0xFFFF, 0xFF5D, 0xF820, 0xF800, 0xF800,
-  0xF800, 0xFD96, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFB, 0xFEBA, 0xFEDB, 0xFF1C, 0xFF7D, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFCB2, 0xF800, 0xF800, 0xF945, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA49, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xFE18,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFD55, 0xF820, 0xF800,
-  0xFB8E, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFBF, 0xF287, 0xFE68, 0xFF8A, 0xFF29, 0xFF49, 0xFF29, 0xFF29,
-  0xFF29, 0xFF29, 0xFF29, 0xFF29, 0xFF49, 0xF6C7, 0xCDA1, 0xD5E0, 0xEEA0, 0xF6E0, 0xFF00, 0xE756,
-  0xEFDF, 0xFF5C, 0xFB4D, 0xF800, 0xF820, 0xF800, 0xF800, 0xFD34, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFC92, 0xF800, 0xF800, 0xFAAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFAEB, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF841, 0xFBEF, 0xFEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFC71, 0xF841, 0xF800, 0xFB8E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF126,
-  0xF181, 0xFF6A, 0xFF49, 0xFF29, 0xFF29, 0xFF29, 0xFF29, 0xFF29, 0xFF29, 0xFF28, 0xFF08, 0xFF28,
-  0xFF08, 0xD5E2, 0xCDC0, 0xEE80, 0xF700, 0xE42A, 0xEA08, 0xF820, 0xF800, 0xF800, 0xF800, 0xF820,
-  0xF800, 0xFC71, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC71, 0xFDB6, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBCF, 0xF800, 0xF800, 0xFBEF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB4D, 0xF800, 0xF820, 0xF800, 0xF800, 0xF841, 0xF841, 0xF800,
-  0xF800, 0xF800, 0xF945, 0xFBAE, 0xFDD7, 0xFEFB, 0xFCB2, 0xF945, 0xF800, 0xF800, 0xF904, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF944, 0xF000, 0xF304, 0xFF8A, 0xFF29, 0xFF29, 0xFF29,
-  0xFF29, 0xFF29, 0xFF28, 0xFF28, 0xFF28, 0xFF08, 0xFF28, 0xFF28, 0xDE24, 0xCDA0, 0xE6A0, 0xD9A0,
-  0xE8A2, 0xFA08, 0xFC10, 0xFE38, 0xFB6D, 0xF800, 0xF800, 0xFBCF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFE79, 0xF800, 0xF8A2, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFB0C, 0xF800, 0xF800, 0xFD34, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE38, 0xFEBA, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB8E, 0xF800,
-  0xF800, 0xFA69, 0xFE38, 0xFF1C, 0xFF1C, 0xFE79, 0xFD75, 0xFB6D, 0xF8C3, 0xF800, 0xF800, 0xF820,
-  0xF800, 0xF800, 0xF820, 0xF800, 0xFB8E, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF1C, 0xF841,
-  0xF800, 0xF3D0, 0xF7B5, 0xFF07, 0xFF29, 0xFF29, 0xFF28, 0xFF28, 0xFF28, 0xFF08, 0xFF08, 0xFF08,
-  0xFF08, 0xFF07, 0xFF28, 0xEE85, 0xCDA0, 0xD614, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xF820,
-  0xF800, 0xFB8E, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC51, 0xF800, 0xF861, 0xFF1C, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF924, 0xF800, 0xF800, 0xFE38, 0xFFDF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF3C, 0xFDF7, 0xFBCF,
-  0xF945, 0xF800, 0xF800, 0xFBEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBAE, 0xF800, 0xF841, 0xFF1C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFC30, 0xF820, 0xF800, 0xF820, 0xF800, 0xF820, 0xF800, 0xFBAE, 0xFFFF,
-  0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFD55, 0xF800, 0xF841, 0xFF5D, 0xEFFF, 0xF772, 0xFF48, 0xFF09,
-  0xFF28, 0xFF28, 0xFF08, 0xFF08, 0xFF08, 0xFF08, 0xFF08, 0xFF07, 0xFF07, 0xFF28, 0xF6A6, 0xD654,
-  0xDF1D, 0xF79E, 0xFFBE, 0xFFFF, 0xFEFB, 0xF841, 0xF800, 0xFB0C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFB6D, 0xF800, 0xF861, 0xFF1C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFBE, 0xFFDF, 0xFF7D, 0xFF3C, 0xFE38, 0xFACB,
-  0xF800, 0xF800, 0xF861, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xFF1C, 0xFE38, 0xFD55,
-  0xFC10, 0xFAEB, 0xF986, 0xF861, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFE38, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBCF, 0xF800,
-  0xF8C3, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF882, 0xF800,
-  0xF800, 0xF800, 0xF820, 0xF800, 0xF8C3, 0xFEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFB, 0xF945, 0xF800,
-  0xF820, 0xFD14, 0xFF7D, 0xEE39, 0xF62A, 0xFF68, 0xFF08, 0xFF28, 0xFF08, 0xFF08, 0xFF08, 0xFF07,
-  0xFF07, 0xFF07, 0xFF07, 0xFEE7, 0xFF07, 0xFEE7, 0xE6D3, 0xEF5E, 0xF7BE, 0xFFFF, 0xFEBA, 0xF820,
-  0xF800, 0xFA08, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB4D, 0xF800, 0xF882, 0xFF5D, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF5D, 0xFCD3, 0xFB8E, 0xFA8A, 0xF9E7, 0xF9C7, 0xF9A6, 0xF986, 0xF965, 0xF965, 0xF986, 0xF924,
-  0xF8E3, 0xF904, 0xF8A2, 0xF861, 0xF800, 0xF800, 0xF820, 0xF800, 0xF8C3, 0xFCB2, 0xFBCF, 0xFB0C,
-  0xFA08, 0xF986, 0xF8C3, 0xF861, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF820,
-  0xF820, 0xF820, 0xF800, 0xF800, 0xFDB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC71, 0xF800, 0xF8E3, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFB6D, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF8A2,
-  0xFB0C, 0xFBAE, 0xFAAA, 0xF882, 0xF800, 0xF800, 0xF800, 0xF800, 0xF881, 0xF020, 0xE8A0, 0xF627,
-  0xFF89, 0xFF08, 0xFF08, 0xFF08, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFEE7, 0xFEE7, 0xFEE6,
-  0xFEE5, 0xF6F0, 0xEF3D, 0xF7FF, 0xFC91, 0xF800, 0xF800, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFB6D, 0xF800, 0xF986, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xF965, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF841, 0xFBCF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC92, 0xF800,
-  0xF8E3, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB6D, 0xF800, 0xF820, 0xF800,
-  0xF800, 0xF800, 0xF9A6, 0xF965, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF000, 0xE901, 0xFE46, 0xFF48, 0xFF08, 0xFF07, 0xFF07, 0xFF07,
-  0xFF07, 0xFF07, 0xFEE7, 0xFEE7, 0xFEE6, 0xFEE6, 0xFEE6, 0xFEC4, 0xF72C, 0xED31, 0xF001, 0xF820,
-  0xF800, 0xF945, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFBEF, 0xF800, 0xFB0C, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE9A,
-  0xF800, 0xF820, 0xF841, 0xF820, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF820, 0xF861, 0xF924, 0xF9E7, 0xF986, 0xF800, 0xF800, 0xF882, 0xF965, 0xF9A6,
-  0xF9C7, 0xF9E7, 0xFA28, 0xFA49, 0xFA28, 0xFACB, 0xFB2C, 0xFB2C, 0xFAAA, 0xFA28, 0xFA28, 0xFA8A,
-  0xFB8E, 0xFCD3, 0xFEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFD14, 0xF800, 0xF882, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFF7D, 0xFA69, 0xF800, 0xF820, 0xF800, 0xF800, 0xFACB, 0xFE79, 0xFFFF, 0xFFFF, 0xFE9A, 0xFB4D,
-  0xF820, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xF000,
-  0xE9E4, 0xFF2A, 0xFF06, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFEE7, 0xFEE7, 0xFEE6, 0xFEE6, 0xFEE6,
-  0xFEE6, 0xFEE6, 0xFEE5, 0xFE44, 0xEAC2, 0xE800, 0xF800, 0xF8A2, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFD75, 0xF800, 0xFD96, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE9A, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF861, 0xF924, 0xF9E7, 0xFACB, 0xFBAE, 0xFC71, 0xFD75, 0xFDF7, 0xFEFB, 0xFF5D, 0xFFBE, 0xFFFF,
-  0xFDD7, 0xF800, 0xF800, 0xFB8E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFD34, 0xF800,
-  0xF800, 0xFE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE38, 0xF924, 0xF800, 0xF820, 0xF800, 0xF965, 0xFDD7,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE38, 0xF945, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF8C3, 0xFC71, 0xF71D, 0xEF3A, 0xFF0A, 0xFF07, 0xFEE7, 0xFF07,
-  0xFEE7, 0xFEE7, 0xFEE6, 0xFEE6, 0xFEE6, 0xFEE6, 0xFEE6, 0xFEE6, 0xFEC6, 0xFF06, 0xFF46, 0xF483,
-  0xE860, 0xF001, 0xFF1C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xFBAE, 0xFFBE, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE,
-  0xF986, 0xF904, 0xFACB, 0xFC10, 0xFD75, 0xFE79, 0xFF5D, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD96, 0xF800, 0xF800, 0xFB8E, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD55, 0xF800, 0xF800, 0xFB2C, 0xFFDF, 0xFF1C, 0xFBAE, 0xF820,
-  0xF800, 0xF800, 0xF800, 0xFB8E, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFF7D, 0xF9E7, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFB0C, 0xFF5D, 0xFFFF,
-  0xFFFF, 0xF79F, 0xE6D4, 0xF6C5, 0xFF07, 0xFEE7, 0xFEE7, 0xFEE6, 0xFEE6, 0xFEE6, 0xFEE6, 0xFEE6,
-  0xFEE6, 0xFEE6, 0xFEC5, 0xFEC5, 0xFEA5, 0xFF46, 0xF5E4, 0xE9A1, 0xF65A, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFDD7, 0xF800, 0xF800, 0xFB4D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD96, 0xF800,
-  0xF800, 0xF800, 0xF924, 0xF861, 0xF800, 0xF800, 0xF800, 0xF8C3, 0xFD96, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFF9E, 0xF965, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xFB4D, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xE6AF, 0xD5A0, 0xFEE7, 0xFF07,
-  0xFEE6, 0xFEE6, 0xFEE6, 0xFEE6, 0xFEE6, 0xFEE6, 0xFEE6, 0xFEC5, 0xFEC5, 0xFEC5, 0xFEC5, 0xFEA5,
-  0xFF05, 0xFEA3, 0xF691, 0xF7BF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE18, 0xF800, 0xF800, 0xFB0C, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD75, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xFAAA, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFE38, 0xF800, 0xF800, 0xF800, 0xF800, 0xFF3C, 0xFFFF, 0xFFDF, 0xFFDF,
-  0xFFDF, 0xFFDF, 0xF6E9, 0xDDE0, 0xD5A1, 0xF6C6, 0xFF06, 0xFEE6, 0xFEE6, 0xFEE6, 0xFEE6, 0xFEE6,
-  0xFEC5, 0xFEC5, 0xFEC5, 0xFEC5, 0xFEC5, 0xFEC5, 0xFEA5, 0xFEC5, 0xFEC3, 0xF6CC, 0xF77C, 0xF7DF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFE9A, 0xF820, 0xF800, 0xFAAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDB6, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF904, 0xFD34, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF965, 0xF800,
-  0xF820, 0xF800, 0xFACB, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEC3, 0xF680, 0xDDE0, 0xCDA1,
-  0xF6A6, 0xFF06, 0xFEC6, 0xFEE6, 0xFEE6, 0xFEC5, 0xFEC5, 0xFEC5, 0xFEC5, 0xFEC5, 0xFEC5, 0xFEC5,
-  0xFEC4, 0xFEA4, 0xFEA4, 0xFEA2, 0xFEA6, 0xF735, 0xF7BF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE9A, 0xF800, 0xF800, 0xFA08, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDD7, 0xF800, 0xF800, 0xF800, 0xF9C7, 0xFC71, 0xFF9E, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xF8E3, 0xF800, 0xF800, 0xF800, 0xF800, 0xF882, 0xFA49, 0xFBAE,
-  0xFC92, 0xFDF1, 0xFF00, 0xFEC0, 0xF680, 0xDDE0, 0xCD80, 0xF6A5, 0xFEE6, 0xFEC5, 0xFEC5, 0xFEC5,
-  0xFEC5, 0xFEC5, 0xFEC5, 0xFEC5, 0xFEC5, 0xFEC4, 0xFEC4, 0xFEA4, 0xFEA4, 0xFEA4, 0xFEA3, 0xFEA2,
-  0xF6CD, 0xF77C, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFEFB, 0xF841, 0xF800, 0xF9E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDD7, 0xF800,
-  0xF800, 0xFAAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xFEDB, 0xFD55, 0xFA08, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFB00, 0xFF60, 0xFEC0, 0xFEC0, 0xF680,
-  0xDDE0, 0xCD60, 0xEE64, 0xFEE6, 0xFEC5, 0xFEC5, 0xFEC5, 0xFEC5, 0xFEC5, 0xFEC5, 0xFEC4, 0xFEC4,
-  0xFEA4, 0xFEA4, 0xFEA4, 0xFEA4, 0xFEA4, 0xFEA4, 0xFE82, 0xFEA5, 0xF734, 0xF7BF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFB, 0xF841, 0xF800, 0xF9C7, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDD7, 0xF800, 0xF800, 0xFD14, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xFD96, 0xFC51, 0xFB8E, 0xFB0C, 0xFA49, 0xF9E7, 0xF9C7, 0xF965,
-  0xF8A2, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xFD00, 0xFF20, 0xFEC0, 0xFEC0, 0xFEC0, 0xF680, 0xDDE0, 0xC560, 0xEE44, 0xFF05, 0xFEC5,
-  0xFEC5, 0xFEC5, 0xFEC5, 0xFEC4, 0xFEC4, 0xFEA4, 0xFEA4, 0xFEA4, 0xFEA4, 0xFEA4, 0xFEA3, 0xFEA3,
-  0xFEA4, 0xFE82, 0xFE81, 0xF6CA, 0xF77A, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFEFB, 0xF841, 0xF800, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDD7, 0xF800,
-  0xF800, 0xFDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDB6, 0xF9C7, 0xF841, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF820, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xFAAA, 0xFBEF, 0xFB6D, 0xFA88, 0xFE40, 0xFEE0, 0xFEC0, 0xFEC0, 0xFEC0,
-  0xFEA0, 0xF680, 0xDE00, 0xC540, 0xE583, 0xFF05, 0xFEC5, 0xFEA5, 0xFEC4, 0xFEA4, 0xFEA4, 0xFEA4,
-  0xFEA4, 0xFEA4, 0xFEA4, 0xFEA3, 0xFEA3, 0xFEA3, 0xFEA3, 0xFE83, 0xFE83, 0xFE81, 0xFE83, 0xF6EF,
-  0xF79C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF3C, 0xF861, 0xF800, 0xF965, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE59, 0xF800, 0xF800, 0xFE38, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFBE, 0xF861, 0xF800, 0xF800, 0xF800, 0xF800, 0xF861, 0xF8A2, 0xF986, 0xF9E7, 0xF9E7, 0xF9E7,
-  0xF986, 0xF861, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF8A2, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFB, 0xFEC0, 0xFEC0, 0xFEC0, 0xFEC0, 0xFEC0, 0xFEC0, 0xFEA0, 0xF680, 0xDE20, 0xC120, 0xE363,
-  0xFF45, 0xFEC5, 0xFEA4, 0xFEA4, 0xFEA4, 0xFEA4, 0xFEA4, 0xFEA4, 0xFEA3, 0xFEA3, 0xFEA3, 0xFEA3,
-  0xFE83, 0xFE83, 0xFE83, 0xFE83, 0xFE82, 0xFE60, 0xFE84, 0xF711, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF3C, 0xF861, 0xF800, 0xF945, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFF7D, 0xFD96, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE79, 0xF800,
-  0xF800, 0xFE38, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE18, 0xFCF3, 0xFD14, 0xFD96, 0xFE38,
-  0xFF1C, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF3C, 0xFCF3, 0xF904, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF8A2, 0xFF7D, 0xFFDF, 0xFFDF, 0xFF52, 0xFEA0, 0xFEC0, 0xFEC0, 0xFEC0, 0xFEC0,
-  0xFEC0, 0xFEC0, 0xFEA0, 0xF680, 0xD141, 0xD000, 0xE240, 0xFE83, 0xFEC3, 0xFEA4, 0xFEA4, 0xFEA4,
-  0xFEA4, 0xFEA3, 0xFEA3, 0xFEA3, 0xFEA3, 0xFE83, 0xFE83, 0xFE82, 0xFE82, 0xFE82, 0xFE82, 0xFE82,
-  0xFE81, 0xFE60, 0xF738, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF3C, 0xF861, 0xF800, 0xF8C3, 0xFF9E, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB6D, 0xF800, 0xFC10, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE59, 0xF800, 0xF800, 0xFE38, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFF5D, 0xF9E7, 0xF800, 0xF800, 0xF800, 0xF841, 0xFF1C, 0xFFFF, 0xFFFF,
-  0xFF0A, 0xFEA0, 0xFEC0, 0xFEC0, 0xFEC0, 0xFEC0, 0xFEC0, 0xFEC0, 0xFEC0, 0xF6A2, 0xDE17, 0xE492,
-  0xE2CC, 0xE5F4, 0xF6E8, 0xFEA2, 0xFEA4, 0xFEA4, 0xFEA3, 0xFEA3, 0xFEA3, 0xFE83, 0xFE83, 0xFE83,
-  0xFE83, 0xFE82, 0xFE82, 0xFE82, 0xFE82, 0xFE82, 0xFE82, 0xFE62, 0xEF18, 0xF7BF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF3C, 0xF861, 0xF800, 0xF861, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xF9A6, 0xF800, 0xF882, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE59, 0xF800,
-  0xF800, 0xFE38, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFF7D, 0xF882,
-  0xF800, 0xF800, 0xF800, 0xFE18, 0xFFFF, 0xFFBE, 0xFEC3, 0xFEC0, 0xFEC0, 0xFEC0, 0xFEC0, 0xFEC0,
-  0xFEC0, 0xFEC0, 0xFEC0, 0xF6A5, 0xDF1C, 0xEFDF, 0xF7FF, 0xEF7E, 0xE6FA, 0xF6AB, 0xFEA2, 0xFEA3,
-  0xFEA3, 0xFEA3, 0xFE83, 0xFE83, 0xFE83, 0xFE82, 0xFE82, 0xFE82, 0xFE82, 0xFE82, 0xFE82, 0xFE82,
-  0xFE61, 0xFE62, 0xE6F8, 0xF79F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF1C, 0xF8A2, 0xFCB2, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF3C, 0xF861, 0xF800, 0xF861, 0xFF3C, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9E7, 0xF800, 0xF800, 0xFCF3, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE79, 0xF800, 0xF800, 0xFDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFEDB, 0xF861, 0xF800, 0xF820, 0xF800, 0xFA89, 0xFFFF, 0xFFD9,
-  0xFEA0, 0xFEC0, 0xFEC0, 0xFEC0, 0xFEC0, 0xFEC0, 0xFEC0, 0xFEA0, 0xFEA0, 0xF6A7, 0xDEFC, 0xF77D,
-  0xFFBE, 0xF7BE, 0xEF7E, 0xDF1C, 0xEEAF, 0xFEA2, 0xFE82, 0xFE83, 0xFE83, 0xFE83, 0xFE82, 0xFE82,
-  0xFE82, 0xFE82, 0xFE82, 0xFE82, 0xFE62, 0xFE62, 0xFE61, 0xF663, 0xE6FA, 0xF79E, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFCB2, 0xF800, 0xF9E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFF3C, 0xF861, 0xF800, 0xF841, 0xFF1C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFD55, 0xF820, 0xF800, 0xFB8E, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE18, 0xF800,
-  0xF800, 0xFDB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD55, 0xF8E3, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xFAAC, 0xFE8D, 0xFEC0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0,
-  0xFEA0, 0xFEA0, 0xFEA0, 0xEEAA, 0xDF1D, 0xF7BE, 0xFFFF, 0xFFFF, 0xF7BE, 0xEF7D, 0xE71E, 0xE6B4,
-  0xFEA5, 0xFEC3, 0xFE63, 0xFE82, 0xFE82, 0xFE82, 0xFE82, 0xFE82, 0xFE82, 0xFE62, 0xFE61, 0xFE62,
-  0xFE60, 0xF665, 0xE71C, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC10, 0xF820, 0xF9A6, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFB, 0xF841, 0xF800, 0xF820, 0xFEDB, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEBA, 0xFDF7, 0xFF7D, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDD7, 0xF800, 0xF800, 0xFD75, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFEDB, 0xFC51, 0xF986, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFD20,
-  0xFF00, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xEE8D, 0xE71E, 0xF7BE,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF77D, 0xE77F, 0xDD93, 0xF501, 0xFF03, 0xFE82, 0xFE82, 0xFE82,
-  0xFE82, 0xFE82, 0xFE62, 0xFE61, 0xFE61, 0xFE61, 0xFE60, 0xF668, 0xE73D, 0xF7BE, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFDD7, 0xF800, 0xFACB, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFEFB, 0xF820, 0xF800, 0xF800, 0xFE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDD7, 0xF800,
-  0xF800, 0xFD14, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFE59, 0xFC30, 0xF9E7, 0xF841, 0xF800, 0xF800, 0xF820, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF900, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0,
-  0xFEA0, 0xFEA0, 0xFEA0, 0xE6F1, 0xE75F, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7FF,
-  0xE618, 0xD820, 0xEBE1, 0xFEA1, 0xFE81, 0xFE82, 0xFE82, 0xFE62, 0xFE61, 0xFE61, 0xFE61, 0xFE61,
-  0xFE60, 0xEE8C, 0xE73E, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC30, 0xFEBA, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE9A, 0xF800, 0xF800, 0xF800, 0xFDD7, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDD7, 0xF800, 0xF800, 0xFC10, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xFD14, 0xFB0C, 0xF945, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFA60, 0xFF00,
-  0xFE80, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEC0, 0xE58D, 0xE67B, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xF73C, 0xE8A2, 0xD800, 0xE3A8, 0xF6E7, 0xFE60,
-  0xFE62, 0xFE62, 0xFE61, 0xFE61, 0xFE61, 0xFE61, 0xFE40, 0xE6B1, 0xE75E, 0xFFDE, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFDF7, 0xF800, 0xF820, 0xF800, 0xFD96, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDB6, 0xF800,
-  0xF800, 0xFB6D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xFDD7, 0xFBAE, 0xF9A6, 0xF841,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF841, 0xF861, 0xF882, 0xF924, 0xF904, 0xF882, 0xF882,
-  0xF861, 0xF841, 0xF820, 0xF800, 0xFC20, 0xFF00, 0xFE80, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0,
-  0xFEA0, 0xFE80, 0xFEE0, 0xD980, 0xE841, 0xF9E7, 0xFBAE, 0xFD96, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xF1E7, 0xE800, 0xE2ED, 0xDF3C, 0xEE6B, 0xFE60, 0xFE61, 0xFE62, 0xFE61, 0xFE61, 0xFE61,
-  0xFE40, 0xE6B5, 0xEF7E, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD75, 0xF800, 0xF820, 0xF800, 0xFD34, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD96, 0xF800, 0xF800, 0xF9A6, 0xFFFF, 0xFFFF, 0xFF3C, 0xFD14,
-  0xFACB, 0xF8E3, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF945, 0xFB0C, 0xFCB2, 0xFE18, 0xFEFB,
-  0xFF5D, 0xFF7D, 0xFFDF, 0xFFDF, 0xFF7D, 0xFF7D, 0xFF3C, 0xFF1C, 0xFEBA, 0xFDF8, 0xFE44, 0xFEA0,
-  0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFE80, 0xD8E0, 0xE800, 0xF800,
-  0xF800, 0xF800, 0xF861, 0xF9C7, 0xFB6D, 0xFD14, 0xFE18, 0xF965, 0xF800, 0xF2CA, 0xE7BE, 0xDEDC,
-  0xE693, 0xF664, 0xFE60, 0xFE61, 0xFE61, 0xFE60, 0xF642, 0xE6F9, 0xEF7E, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-  0xFC71, 0xF800, 0xF841, 0xF800, 0xFC71, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD55, 0xF800,
-  0xF800, 0xF800, 0xFB4D, 0xFAAA, 0xF861, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF924, 0xFB8E,
-  0xFE18, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFD, 0xFEA1, 0xFE80, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0,
-  0xFE80, 0xFEA0, 0xF661, 0xDA26, 0xE8A2, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xFA28, 0xF7FF, 0xEF5C, 0xDF1D, 0xDEB9, 0xEE6A, 0xFE60, 0xFE60, 0xFE60,
-  0xF666, 0xE71C, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB0C, 0xF800, 0xF841, 0xF800, 0xFBAE, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFD14, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820,
-  0xF800, 0xF800, 0xFA49, 0xFD75, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF55, 0xFE80, 0xFEA0,
-  0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xF685, 0xDF1C, 0xF71C, 0xFDF7,
-  0xFBCF, 0xF986, 0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xF820, 0xF800, 0xF9E7, 0xFFFF, 0xF7BE,
-  0xEF7D, 0xE73C, 0xD6DC, 0xDE93, 0xF665, 0xFE40, 0xEE6B, 0xE73E, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xF924, 0xF800, 0xF820, 0xF800, 0xFB2C, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFC71, 0xF800,
-  0xF820, 0xF800, 0xF820, 0xF820, 0xF800, 0xF800, 0xFA69, 0xFE18, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFF2E, 0xFE80, 0xFEA0, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80,
-  0xFE80, 0xFE80, 0xF687, 0xDEFC, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFE38, 0xFB4D, 0xF861, 0xF800,
-  0xF800, 0xF820, 0xF800, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFDF, 0xF79E, 0xEF5C, 0xDEFD, 0xD6BA, 0xE670,
-  0xE6B4, 0xE75E, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFDD7, 0xF800, 0xF800, 0xF820, 0xF800, 0xFA49, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-  0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF,
-  0xFFDF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFBEF, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF965, 0xFDB6,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEC8, 0xFE80, 0xFE80,
-  0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xEE8B, 0xDF1D, 0xF79D, 0xFFDF,
-  0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFB, 0xFB2C, 0xF800, 0xF800, 0xF800, 0xF861, 0xFF5D, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xF7BE, 0xEF7D, 0xE71C, 0xDEFD, 0xDF1C, 0xEF7D, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFB, 0xF924,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF8E3, 0xFDF7, 0xFEFB, 0xFF3C, 0xFF7D, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFB8E, 0xF800,
-  0xF820, 0xF800, 0xF800, 0xFBAE, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFEA5, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80,
-  0xFE80, 0xFE80, 0xEE8D, 0xDF1E, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFD96, 0xF882, 0xF800, 0xF800, 0xFD55, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF79E, 0xEF7D,
-  0xEF7D, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDF7, 0xFA69, 0xFAEB,
-  0xFB4D, 0xFB6D, 0xFBAE, 0xFBCF, 0xFC30, 0xFCD3, 0xFD14, 0xFD55, 0xFD96, 0xFDB6, 0xFDF7, 0xFE79,
-  0xFEBA, 0xFEFB, 0xFF1C, 0xFF3C, 0xFF5D, 0xFF7D, 0xFFBE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF,
-  0xFF9E, 0xFF3C, 0xFE38, 0xFC10, 0xF8A2, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF820, 0xF861, 0xF8A2, 0xF904, 0xF965, 0xF9A6, 0xF9C7, 0xF9E7, 0xFA28, 0xFACB, 0xFACB, 0xFB2C,
-  0xFB4D, 0xFB4D, 0xFBAE, 0xFBAE, 0xFB8E, 0xFBCF, 0xFBEF, 0xFBEF, 0xFBEF, 0xFC51, 0xFCD3, 0xFCB2,
-  0xFCB2, 0xFD14, 0xFD55, 0xFD34, 0xFD55, 0xFD96, 0xFDB6, 0xFDD7, 0xFDD7, 0xFEBA, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAAA, 0xF800, 0xF800, 0xF8A2, 0xFD96, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFEA4, 0xFE80, 0xFE80,
-  0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xE691, 0xE73E, 0xF7BE, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFE79, 0xF882, 0xF800, 0xFA08, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFD34, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF841, 0xF861, 0xF861, 0xF882, 0xF882,
-  0xF904, 0xF945, 0xF945, 0xF945, 0xF945, 0xF945, 0xF8A2, 0xF861, 0xF800, 0xF800, 0xF800, 0xF820,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xFDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9A6, 0xF800,
-  0xF8E3, 0xFE9A, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xF6F1, 0xFE60, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80,
-  0xFE80, 0xFE60, 0xE6B3, 0xE73E, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFFF, 0xFD75, 0xF800, 0xF800, 0xFD96, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD75, 0xF800, 0xF820,
-  0xF820, 0xF820, 0xF841, 0xF841, 0xF820, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF861, 0xF904, 0xFA49, 0xFDD7, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFF5D, 0xF861, 0xF841, 0xFE79, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xEF5E, 0xEE8A, 0xFE80,
-  0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE60, 0xDEB6, 0xE75E, 0xFFDE, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFA49, 0xF800, 0xF945,
-  0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFD75, 0xF800, 0xF820, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xF800, 0xF820, 0xF841, 0xF861, 0xF882, 0xF882, 0xF904, 0xF945, 0xF924, 0xF965, 0xF9A6, 0xF986,
-  0xF9A6, 0xF9A6, 0xF9A6, 0xF9E7, 0xF9E7, 0xF9E7, 0xF9C7, 0xF9C7, 0xF9C7, 0xF9C7, 0xF9C7, 0xF9C7,
-  0xF9C7, 0xF9C7, 0xF9C7, 0xF9C7, 0xF9C7, 0xF9C7, 0xF9C7, 0xF9C7, 0xF9C7, 0xF9C7, 0xF9C7, 0xF9C7,
-  0xF9E7, 0xFA08, 0xFA08, 0xFA08, 0xFA08, 0xFA08, 0xFA08, 0xFA08, 0xFAAA, 0xFB0C, 0xFB0C, 0xFB0C,
-  0xFB4D, 0xFB6D, 0xFB6D, 0xFBAE, 0xFBCF, 0xFBEF, 0xFC71, 0xFD14, 0xFD75, 0xFDB6, 0xFE79, 0xFF1C,
-  0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDD7, 0xF800, 0xFD96,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xEF5D, 0xDEDC, 0xEE69, 0xFE80, 0xFE60, 0xFE60, 0xFE60, 0xFE60, 0xFE60,
-  0xFE60, 0xFE61, 0xDEB8, 0xEF5E, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFDD7, 0xF800, 0xF800, 0xFD55, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDB6, 0xF800, 0xF800,
-  0xF8E3, 0xFA8A, 0xFBCF, 0xFCF3, 0xFD96, 0xFDF7, 0xFE9A, 0xFEFB, 0xFF1C, 0xFF3C, 0xFF7D, 0xFF7D,
-  0xFFBE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFB6D, 0xFBCF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xE71C, 0xD6BB,
-  0xEE6B, 0xFE60, 0xFE60, 0xFE60, 0xFE60, 0xFE60, 0xFE60, 0xF663, 0xDEDA, 0xEF7D, 0xFFDF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xF904, 0xF800,
-  0xFA69, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFDF7, 0xF820, 0xFC10, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFD75, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xEF7D, 0xE71C, 0xD6BC, 0xE66D, 0xFE60, 0xFE60, 0xFE60, 0xFE60,
-  0xFE60, 0xF665, 0xDEDC, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF9E7, 0xF800, 0xF8C3, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFEBA, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF79E,
-  0xE73C, 0xD6BC, 0xE670, 0xFE60, 0xFE60, 0xFE60, 0xFE60, 0xEE68, 0xDEFD, 0xF79D, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF1C, 0xF8C3, 0xF800,
-  0xF841, 0xFEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFF5D,
-  0xFF1C, 0xFF1C, 0xFF1C, 0xFF3C, 0xFF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF79E, 0xE73C, 0xD6DD, 0xDE74, 0xFE62, 0xFE60,
-  0xFE60, 0xEE6B, 0xDEFD, 0xF79D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFF1C, 0xFCF3, 0xF8E3, 0xF800, 0xF800, 0xF800, 0xFF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF1C, 0xFCB2, 0xFB6D, 0xFB2C, 0xFD14,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFDF7, 0xFACB, 0xF9A6, 0xF8E3, 0xF861, 0xF861, 0xF861, 0xF861, 0xF861, 0xF8A2, 0xF945,
-  0xFA08, 0xFC10, 0xFF9E, 0xFF9E, 0xFE38, 0xFDB6, 0xFE18, 0xFEDB, 0xFF7D, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFDF, 0xF7BE, 0xEF5C, 0xD6DC, 0xD677, 0xF664, 0xFE60, 0xE66E, 0xDF1E, 0xF7BE, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCF3, 0xFA28, 0xF8C3, 0xF904, 0xF945, 0xF986,
-  0xFCB2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF1C, 0xFB2C, 0xFA49, 0xFBCF, 0xFF9E, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFBEF, 0xF861, 0xF800, 0xF800, 0xF800, 0xF800, 0xFD55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFD55, 0xF9A6, 0xF882, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF820, 0xF904, 0xFACB, 0xFF9E, 0xFDB6, 0xF8E3, 0xF800,
-  0xF800, 0xF800, 0xF820, 0xF986, 0xFB2C, 0xFE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xEF3C, 0xD6DC, 0xD678,
-  0xFE42, 0xE690, 0xE73E, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFBE, 0xFEDB, 0xFEBA, 0xFEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFACB, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800,
-  0xFCB2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFF3C, 0xFE9A, 0xFE18, 0xFDD7, 0xFDD7, 0xFE59, 0xFEDB, 0xFF7D,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xFEFB, 0xFE38, 0xFDD7, 0xFDD7, 0xFE38, 0xFE79, 0xFF7D,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xE73C, 0xD6BC, 0xDE73, 0xE693, 0xE73E, 0xFFBE, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFEBA, 0xFD75, 0xFD14, 0xFD55, 0xFE9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF79E, 0xE71C,
-  0xD6BA, 0xDEBA, 0xEF5D, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xEF7D, 0xDEFB, 0xDEFB, 0xEF5D, 0xFFDF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE,
-  0xEF5D, 0xE73C, 0xEF7D, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xEF7D, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
-};
@@ -1,8 +1,23 @@
 #include <Arduino.h>
 #include <M5Unified.h>
 #include <SD_MMC.h>
+#include <freertos/stream_buffer.h>
+#include <sys/stat.h>
+#include <lgfx/utility/lgfx_tjpgd.h>
 #include <qrcode.h>
-#include "logo.h"
+#include "asset_decoder.h"
+#include "assets_generated.h"
+#include "grid_rects.h"
+#include "resample_rgb565.h"
+#include "rgb565.h"
+#include "text_layout.h"
+
+#if __has_include(<driver/ppa.h>)
+#include <driver/ppa.h>
+#define HAS_PPA 1
+#else
+#define HAS_PPA 0
+#endif
 
 namespace {
 const char* kAppName = "M5Stack Tab 5 Adventure";
@@ -26,22 +41,29 @@ enum class Screen {
   App8
 };
 
-struct Icon {
-  const char* label;
-  int x;
-  int y;
-  int w;
-  int h;
-};
-
 Screen g_screen = Screen::Welcome;
 bool g_needsRedraw = true;
 bool g_sdMounted = false;
-Icon g_icons[8];
 
 // Photo frame state
-String g_photoFiles[100];
+// Photo index: one fixed-size record per photo, names packed into one arena
+struct PhotoEntry {
+  uint32_t nameOffset;   // Into g_photoNames
+  uint32_t size;
+  uint32_t mtime;
+  uint32_t captureDate;  // YYYYMMDD from EXIF or the filename prefix, 0 if unknown
+  uint32_t captureTime;  // HHMMSS
+  uint8_t orientation;   // EXIF orientation 1-8
+  uint8_t reserved[3];
+  uint32_t thumbOffset;  // File offset of the EXIF thumbnail JPEG, 0 if none
+  uint32_t thumbLength;
+};
+PhotoEntry* g_photos = nullptr;
 int g_photoCount = 0;
+int g_photoCapacity = 0;
+char* g_photoNames = nullptr;
+size_t g_photoNamesUsed = 0;
+size_t g_photoNamesCapacity = 0;
 int g_currentPhotoIndex = -1;
 unsigned long g_lastPhotoChange = 0;
 const unsigned long kPhotoInterval = 15000; // 15 seconds
@@ -70,13 +92,13 @@ struct TodoTask {
 };
 TodoTask g_tasks[50];
 int g_taskCount = 0;
-int g_taskScrollOffset = 0;
 
 // Custom fonts from SD card
 bool g_fontsLoaded = false;
 
 constexpr int kIconCount = 8;
 constexpr int kIconDisplaySize = 200;  // Size to display icons on screen
+constexpr int kIconDecodeSize = 512;   // Largest icon PNG we decode
 
 const char* kIconLabels[kIconCount] = {
   "Calendar", "To-Do", "Photo Frame", "News",
@@ -89,280 +111,1445 @@ const char* getIconPath(int index) {
   return g_iconPath;
 }
 
-// Load custom fonts from SD card
-void loadCustomFonts() {
-  // Disabled for now - use built-in fonts
-  g_fontsLoaded = false;
-}
+const char* kSdMountPoint = "/sdcard";
+const char* kPhotoDir = "/M5Stack-Tab-5-Adventure/photo-frame";
+const char* kPhotoIndexPath = "/M5Stack-Tab-5-Adventure/photo-frame/.index";
 
-// Helper to set font for calendar events (small size)
-void setCalendarFont() {
-  M5.Display.setFont(&fonts::efontTW_24);
-  M5.Display.setTextSize(1.5);
+const char* getPhotoName(int index) {
+  return g_photoNames + g_photos[index].nameOffset;
 }
 
-// Helper to set font for todo list (medium size)
-void setTodoFont() {
-  M5.Display.setFont(&fonts::efontTW_24);
-  M5.Display.setTextSize(2);
+char g_photoPath[320];
+const char* getPhotoPath(int index) {
+  snprintf(g_photoPath, sizeof(g_photoPath), "%s/%s", kPhotoDir, getPhotoName(index));
+  return g_photoPath;
 }
 
-// Unload custom font
-void unloadCustomFont() {
-  M5.Display.setFont(&fonts::Font0);
-}
+// Canvas pool: long-lived PSRAM buffers allocated once at boot and sized from
+// the display geometry. Screens borrow a canvas of any size that fits a slab
+// and return it when done, so nothing is allocated on the drawing hot path.
+struct PooledCanvas {
+  M5Canvas canvas{&M5.Display};
+  uint16_t* pixels = nullptr;
+  size_t capacity = 0;  // In pixels
+  bool inUse = false;
+};
 
-// Parse date from YYYYMMDD format
-void parseDate(const String& dateStr, int& year, int& month, int& day) {
-  if (dateStr.length() >= 8) {
-    year = dateStr.substring(0, 4).toInt();
-    month = dateStr.substring(4, 6).toInt();
-    day = dateStr.substring(6, 8).toInt();
+constexpr int kCanvasPoolSize = 8;
+PooledCanvas g_canvasPool[kCanvasPoolSize];
+
+// Slabs are not tied to their roles below: borrowCanvas() hands out the
+// smallest free one that fits, so the list only sizes the pool for the most
+// canvases that are borrowed at once.
+void initCanvasPool() {
+  size_t screenPixels = (size_t)M5.Display.width() * M5.Display.height();
+  const size_t capacities[kCanvasPoolSize] = {
+    screenPixels,       // Current photo / frame
+    screenPixels,       // Next photo / frame
+    screenPixels,       // Fit-size decode output / transition scratch
+    screenPixels * 4,   // JPEG decode scratch, below 2x the fit size per axis
+    (size_t)kIconDecodeSize * kIconDecodeSize,  // Dashboard icon decode
+    screenPixels,       // Dashboard layer cache, kept from its first paint
+    screenPixels,       // Framebuffer A of the presentation layer
+    screenPixels,       // Framebuffer B
+  };
+  for (int i = 0; i < kCanvasPoolSize; ++i) {
+    auto& slot = g_canvasPool[i];
+    // 64-byte alignment keeps the buffers usable for DMA and cache-line writeback
+    slot.pixels = (uint16_t*)heap_caps_aligned_alloc(64, capacities[i] * 2, MALLOC_CAP_SPIRAM);
+    slot.capacity = slot.pixels ? capacities[i] : 0;
   }
 }
 
-// Parse time from HHMMSS format
-String parseTime(const String& timeStr) {
-  if (timeStr.length() >= 6) {
-    int hour = timeStr.substring(0, 2).toInt();
-    int minute = timeStr.substring(2, 4).toInt();
-    char buf[10];
-    snprintf(buf, sizeof(buf), "%02d:%02d", hour, minute);
-    return String(buf);
+PooledCanvas* findPooledCanvas(const M5Canvas* canvas) {
+  for (auto& slot : g_canvasPool) {
+    if (&slot.canvas == canvas) return &slot;
   }
-  return "";
+  return nullptr;
 }
 
-// Load calendar events from .ics file
-void loadCalendarEvents() {
-  g_eventCount = 0;
-  if (!g_sdMounted) return;
-  
-  File file = SD_MMC.open("/M5Stack-Tab-5-Adventure/calendar/calendar.ics");
-  if (!file) return;
-  
-  String currentSummary = "";
-  String currentDate = "";
-  String currentTime = "";
-  String currentRRule = "";
-  
-  while (file.available() && g_eventCount < 800) {
-    String line = file.readStringUntil('\n');
-    line.trim();
-    
-    if (line.startsWith("SUMMARY:")) {
-      currentSummary = line.substring(8);
-    } else if (line.startsWith("RRULE:")) {
-      currentRRule = line.substring(6);
-    } else if (line.startsWith("DTSTART")) {
-      int colonPos = line.indexOf(':');
-      if (colonPos > 0) {
-        String datetime = line.substring(colonPos + 1);
-        if (datetime.length() >= 8) {
-          currentDate = datetime.substring(0, 8);
-          if (datetime.length() >= 15 && datetime.charAt(8) == 'T') {
-            currentTime = parseTime(datetime.substring(9, 15));
-          }
-        }
-      }
-    } else if (line.startsWith("END:VEVENT")) {
-      if (currentSummary.length() > 0 && currentDate.length() >= 8) {
-        int year, month, day;
-        parseDate(currentDate, year, month, day);
-        g_events[g_eventCount] = {currentSummary, year, month, day, currentTime, currentRRule};
-        g_eventCount++;
-      }
-      currentSummary = "";
-      currentDate = "";
-      currentTime = "";
-      currentRRule = "";
-    }
-  }
-  file.close();
+// Re-point a borrowed canvas at its slab with new dimensions
+bool resizeCanvas(M5Canvas& canvas, int w, int h) {
+  PooledCanvas* slot = findPooledCanvas(&canvas);
+  if (!slot || w <= 0 || h <= 0 || (size_t)w * h > slot->capacity) return false;
+  canvas.setBuffer(slot->pixels, w, h, 16);
+  return true;
 }
 
-// Load todo tasks from JSON
-void loadTodoTasks() {
-  g_taskCount = 0;
-  if (!g_sdMounted) return;
-  
-  File file = SD_MMC.open("/M5Stack-Tab-5-Adventure/tasks/tasks.json");
-  if (!file) return;
-  
-  // Read entire file as bytes to preserve UTF-8 encoding
-  size_t fileSize = file.size();
-  uint8_t* buffer = (uint8_t*)malloc(fileSize + 1);
-  if (!buffer) {
-    file.close();
-    return;
+// Borrow the smallest free canvas that can hold w x h pixels
+M5Canvas* borrowCanvas(int w, int h) {
+  PooledCanvas* best = nullptr;
+  for (auto& slot : g_canvasPool) {
+    if (slot.inUse || slot.capacity < (size_t)w * h) continue;
+    if (!best || slot.capacity < best->capacity) best = &slot;
   }
-  
-  file.read(buffer, fileSize);
-  buffer[fileSize] = 0;
-  String content = String((char*)buffer);
-  free(buffer);
-  file.close();
-  
-  // Simple JSON parsing for tasks - improved for UTF-8
-  int pos = 0;
-  while (pos < content.length() && g_taskCount < 50) {
-    int titlePos = content.indexOf("\"title\"", pos);
-    if (titlePos < 0) break;
-    
-    int valueStart = content.indexOf(":", titlePos);
-    if (valueStart < 0) break;
-    valueStart = content.indexOf("\"", valueStart);
-    if (valueStart < 0) break;
-    valueStart++;
-    
-    int valueEnd = valueStart;
-    while (valueEnd < content.length()) {
-      if (content.charAt(valueEnd) == '"' && content.charAt(valueEnd - 1) != '\\') {
-        break;
-      }
-      valueEnd++;
-    }
-    
-    String title = content.substring(valueStart, valueEnd);
-    
-    // Check if completed
-    bool completed = false;
-    int statusPos = content.indexOf("\"status\"", valueEnd);
-    int nextTaskPos = content.indexOf("\"title\"", valueEnd + 1);
-    if (statusPos > 0 && (nextTaskPos < 0 || statusPos < nextTaskPos)) {
-      int statusStart = content.indexOf("\"", statusPos + 8);
-      if (statusStart > 0) {
-        statusStart++;
-        int statusEnd = content.indexOf("\"", statusStart);
-        if (statusEnd > 0) {
-          String status = content.substring(statusStart, statusEnd);
-          completed = (status == "completed");
+  if (!best) return nullptr;
+  best->inUse = true;
+  best->canvas.setBuffer(best->pixels, w, h, 16);
+  return &best->canvas;
+}
+
+void returnCanvas(M5Canvas* canvas) {
+  PooledCanvas* slot = findPooledCanvas(canvas);
+  if (slot) slot->inUse = false;
+}
+
+// Presentation layer. Screens draw into the back one of two PSRAM framebuffers
+// and mark the rectangles they changed. presentFrame() narrows those to the
+// tiles whose pixels really differ from what the panel shows, merges them
+// into rectangles, queues them over DMA and swaps, so the next frame is drawn
+// while the previous one is still streaming out. The pushed rectangles are
+// copied into the new back buffer before the next frame, so both buffers stay
+// complete and a frame only needs to redraw what changed.
+constexpr int kDirtyTileW = 80;
+constexpr int kDirtyTileH = 16;
+constexpr int kMaxDirtyRects = 16;
+constexpr int kMaxPresentedRects = 32;
+
+struct DirtyRect {
+  int x;
+  int y;
+  int w;
+  int h;
+};
+
+M5Canvas* g_frameBuffers[2] = {nullptr, nullptr};
+int g_backIndex = 0;
+DirtyRect g_dirtyRects[kMaxDirtyRects];
+int g_dirtyCount = 0;
+bool g_dirtyAll = false;  // Panel contents unknown: push every tile
+uint8_t* g_tileChanged = nullptr;
+DirtyRect g_presentedRects[kMaxPresentedRects];  // Pushed from the front buffer
+int g_presentedCount = 0;
+bool g_presentedAll = false;  // Too many rects to list: copy the whole frame
+int g_tileCols = 0;
+int g_tileRows = 0;
+int g_drawnScreen = -1;
+bool g_screenChanged = true;  // First draw since entering the current screen
+uint32_t g_bytesPushed = 0;   // Pixel bytes sent to the panel, for profiling
+uint32_t g_tapBytesStart = 0; // g_bytesPushed when the last tap was handled
+bool g_tapPending = false;    // That tap's redraw has not been reported yet
+
+struct FrameStats {
+  uint32_t frames;
+  uint32_t drawUs;      // Rendering the last frame into the back buffer
+  uint32_t presentUs;   // Diffing and queueing its DMA transfers
+  uint32_t avgFrameUs;  // Running average of draw + present
+  uint32_t maxFrameUs;
+  uint32_t bytes;       // Pushed for the last frame
+  uint16_t rects;
+};
+FrameStats g_frameStats = {};
+uint32_t g_frameStartUs = 0;
+constexpr uint32_t kFrameStatsLogMs = 10000;  // Summary interval at info level
+uint32_t g_frameStatsLoggedMs = 0;
+
+// Bring the back buffer up to date with what the front buffer last pushed
+void syncBackBuffer() {
+  M5Canvas* back = g_frameBuffers[g_backIndex];
+  M5Canvas* front = g_frameBuffers[g_backIndex ^ 1];
+  if (back && front && (g_presentedAll || g_presentedCount > 0)) {
+    int stride = back->width();
+    uint16_t* dst = (uint16_t*)back->getBuffer();
+    const uint16_t* src = (const uint16_t*)front->getBuffer();
+    if (g_presentedAll) {
+      memcpy(dst, src, (size_t)stride * back->height() * 2);
+    } else {
+      for (int i = 0; i < g_presentedCount; ++i) {
+        const DirtyRect& r = g_presentedRects[i];
+        for (int row = r.y; row < r.y + r.h; ++row) {
+          memcpy(dst + row * stride + r.x, src + row * stride + r.x, r.w * 2);
         }
       }
     }
-    
-    if (title.length() > 0) {
-      g_tasks[g_taskCount] = {title, completed};
-      g_taskCount++;
-    }
-    
-    pos = valueEnd + 1;
   }
+  g_presentedCount = 0;
+  g_presentedAll = false;
 }
 
-// Calendar helper functions
-int getDaysInMonth(int year, int month) {
-  if (month == 2) {
-    bool isLeap = (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
-    return isLeap ? 29 : 28;
+// The framebuffer screens draw into; the panel itself if there is no memory
+LovyanGFX& screenGfx() {
+  int w = M5.Display.width();
+  int h = M5.Display.height();
+  if (!g_frameBuffers[0]) g_frameBuffers[0] = borrowCanvas(w, h);
+  if (g_frameBuffers[0] && !g_frameBuffers[1]) g_frameBuffers[1] = borrowCanvas(w, h);
+  // Single-buffered fallback: the last flush may still be reading the buffer
+  if (!g_frameBuffers[1]) M5.Display.waitDMA();
+  M5Canvas* back = g_frameBuffers[g_backIndex];
+  return back ? (LovyanGFX&)*back : (LovyanGFX&)M5.Display;
+}
+
+void markDirty(int x, int y, int w, int h) {
+  int right = min(x + w, (int)M5.Display.width());
+  int bottom = min(y + h, (int)M5.Display.height());
+  x = max(x, 0);
+  y = max(y, 0);
+  if (right <= x || bottom <= y) return;
+  DirtyRect rect = {x, y, right - x, bottom - y};
+
+  // Grow an overlapping or touching rectangle, otherwise take a free slot;
+  // when full, merge into the one whose bounding box grows least
+  int best = -1;
+  long bestGrowth = 0;
+  for (int i = 0; i < g_dirtyCount; ++i) {
+    DirtyRect& r = g_dirtyRects[i];
+    int ux = min(r.x, rect.x);
+    int uy = min(r.y, rect.y);
+    int uw = max(r.x + r.w, rect.x + rect.w) - ux;
+    int uh = max(r.y + r.h, rect.y + rect.h) - uy;
+    bool touching = rect.x <= r.x + r.w && r.x <= rect.x + rect.w &&
+                    rect.y <= r.y + r.h && r.y <= rect.y + rect.h;
+    long growth = (long)uw * uh - (long)r.w * r.h;
+    if (touching || (g_dirtyCount == kMaxDirtyRects && (best < 0 || growth < bestGrowth))) {
+      best = i;
+      bestGrowth = growth;
+      if (touching) break;
+    }
   }
-  if (month == 4 || month == 6 || month == 9 || month == 11) {
-    return 30;
+  if (best < 0) {
+    g_dirtyRects[g_dirtyCount++] = rect;
+    return;
   }
-  return 31;
+  DirtyRect& r = g_dirtyRects[best];
+  int ux = min(r.x, rect.x);
+  int uy = min(r.y, rect.y);
+  r.w = max(r.x + r.w, rect.x + rect.w) - ux;
+  r.h = max(r.y + r.h, rect.y + rect.h) - uy;
+  r.x = ux;
+  r.y = uy;
 }
 
-int getFirstDayOfMonth(int year, int month) {
-  // Zeller's congruence for day of week (0=Sun, 1=Mon, etc.)
-  if (month < 3) {
-    month += 12;
-    year -= 1;
+// Start a frame. The back buffer holds the current frame, so callers draw
+// only what changed; on entering a screen all of it is pushed, since another
+// screen owned the panel
+LovyanGFX& beginFrame() {
+  g_frameStartUs = micros();
+  LovyanGFX& gfx = screenGfx();
+  syncBackBuffer();
+  if (g_screenChanged) g_dirtyAll = true;
+  return gfx;
+}
+
+// Exact tile comparison against the front buffer, which holds what the panel shows
+bool tileDiffers(const uint16_t* back, const uint16_t* front, int stride, int x, int y, int w, int h) {
+  for (int row = y; row < y + h; ++row) {
+    if (memcmp(back + row * stride + x, front + row * stride + x, w * 2) != 0) return true;
   }
-  int q = 1; // First day
-  int m = month;
-  int k = year % 100;
-  int j = year / 100;
-  int h = (q + ((13 * (m + 1)) / 5) + k + (k / 4) + (j / 4) - (2 * j)) % 7;
-  // Convert to 0=Sun, 1=Mon, etc.
-  return (h + 6) % 7;
+  return false;
 }
 
-int getDayOfWeek(int year, int month, int day) {
-  // Zeller's congruence
-  if (month < 3) {
-    month += 12;
-    year -= 1;
+bool tileTouched(int x, int y, int w, int h) {
+  for (int i = 0; i < g_dirtyCount; ++i) {
+    const DirtyRect& r = g_dirtyRects[i];
+    if (x < r.x + r.w && r.x < x + w && y < r.y + r.h && r.y < y + h) return true;
   }
-  int q = day;
-  int m = month;
-  int k = year % 100;
-  int j = year / 100;
-  int h = (q + ((13 * (m + 1)) / 5) + k + (k / 4) + (j / 4) - (2 * j)) % 7;
-  return (h + 6) % 7;
+  return false;
 }
 
-void advanceDate(int& year, int& month, int& day, int days) {
-  day += days;
-  while (day > getDaysInMonth(year, month)) {
-    day -= getDaysInMonth(year, month);
-    month++;
-    if (month > 12) {
-      month = 1;
-      year++;
+// Queue the changed parts of frame to the panel; returns the rectangle count
+int flushDirty(M5Canvas& frame) {
+  int screenW = frame.width();
+  int screenH = frame.height();
+  if (!g_tileChanged) {
+    g_tileCols = (screenW + kDirtyTileW - 1) / kDirtyTileW;
+    g_tileRows = (screenH + kDirtyTileH - 1) / kDirtyTileH;
+    g_tileChanged = (uint8_t*)calloc(g_tileCols * g_tileRows, 1);
+    if (!g_tileChanged) {
+      M5.Display.pushImageDMA(0, 0, screenW, screenH, (const lgfx::swap565_t*)frame.getBuffer());
+      g_frameStats.bytes = screenW * screenH * 2;
+      g_presentedAll = true;
+      return 1;
     }
   }
-  while (day < 1) {
-    month--;
-    if (month < 1) {
-      month = 12;
-      year--;
+
+  // Keep only marked tiles whose pixels differ from the panel's. Single
+  // buffered there is no copy to compare with, so every marked tile goes.
+  const uint16_t* pixels = (const uint16_t*)frame.getBuffer();
+  M5Canvas* other = g_frameBuffers[g_backIndex ^ 1];
+  const uint16_t* front = other && other != &frame ? (const uint16_t*)other->getBuffer() : nullptr;
+  for (int ty = 0; ty < g_tileRows; ++ty) {
+    for (int tx = 0; tx < g_tileCols; ++tx) {
+      int x = tx * kDirtyTileW;
+      int y = ty * kDirtyTileH;
+      int w = min(kDirtyTileW, screenW - x);
+      int h = min(kDirtyTileH, screenH - y);
+      uint8_t& changed = g_tileChanged[ty * g_tileCols + tx];
+      changed = 0;
+      if (!g_dirtyAll && !tileTouched(x, y, w, h)) continue;
+      changed = g_dirtyAll || !front || tileDiffers(pixels, front, screenW, x, y, w, h);
     }
-    day += getDaysInMonth(year, month);
   }
-}
 
-// Check if an event occurs on a specific date (considering recurrence)
-bool eventOccursOnDate(const CalendarEvent& event, int year, int month, int day) {
-  // Direct date match
-  if (event.year == year && event.month == month && event.day == day) {
-    return true;
-  }
-  
-  // Check recurrence rule
-  if (event.rrule.length() > 0) {
-    // Check UNTIL clause if present
-    int untilPos = event.rrule.indexOf("UNTIL=");
-    if (untilPos >= 0) {
-      String untilStr = event.rrule.substring(untilPos + 6);
-      int semicolon = untilStr.indexOf(';');
-      if (semicolon > 0) {
-        untilStr = untilStr.substring(0, semicolon);
-      }
-      // Parse UNTIL date (format: YYYYMMDD)
-      if (untilStr.length() >= 8) {
-        int untilYear = untilStr.substring(0, 4).toInt();
-        int untilMonth = untilStr.substring(4, 6).toInt();
-        int untilDay = untilStr.substring(6, 8).toInt();
-        
-        // Check if current date is after UNTIL date
-        if (year > untilYear || 
-            (year == untilYear && month > untilMonth) ||
-            (year == untilYear && month == untilMonth && day > untilDay)) {
-          return false; // Event has expired
-        }
+  // Greedy cover: a horizontal run of changed tiles, extended down while the
+  // rows below have the same run changed
+  int rects = 0;
+  uint32_t bytes = 0;
+  for (int ty = 0; ty < g_tileRows; ++ty) {
+    for (int tx = 0; tx < g_tileCols; ++tx) {
+      if (!g_tileChanged[ty * g_tileCols + tx]) continue;
+      int tx1 = tx;
+      while (tx1 < g_tileCols && g_tileChanged[ty * g_tileCols + tx1]) ++tx1;
+      int ty1 = ty + 1;
+      for (; ty1 < g_tileRows; ++ty1) {
+        bool full = true;
+        for (int c = tx; c < tx1 && full; ++c) full = g_tileChanged[ty1 * g_tileCols + c];
+        if (!full) break;
       }
-    }
-    
-    // Handle FREQ=YEARLY (most common in the data)
-    if (event.rrule.indexOf("FREQ=YEARLY") >= 0) {
-      // Event recurs yearly on same month/day
-      if (event.month == month && event.day == day) {
-        // Only show if current date is on or after the original event date
-        if (year > event.year || (year == event.year && month >= event.month)) {
-          return true;
-        }
+      for (int r = ty; r < ty1; ++r) memset(g_tileChanged + r * g_tileCols + tx, 0, tx1 - tx);
+
+      int x = tx * kDirtyTileW;
+      int y = ty * kDirtyTileH;
+      int w = min(tx1 * kDirtyTileW, screenW) - x;
+      int h = min(ty1 * kDirtyTileH, screenH) - y;
+      // The clip window makes the driver send just this part of the buffer
+      M5.Display.setClipRect(x, y, w, h);
+      M5.Display.pushImageDMA(0, 0, screenW, screenH, (const lgfx::swap565_t*)pixels);
+      if (g_presentedCount < kMaxPresentedRects) {
+        g_presentedRects[g_presentedCount++] = {x, y, w, h};
+      } else {
+        g_presentedAll = true;
       }
+      bytes += w * h * 2;
+      ++rects;
+      tx = tx1 - 1;
     }
-    // Can add more FREQ types here (DAILY, WEEKLY, MONTHLY)
   }
-  
-  return false;
+  M5.Display.clearClipRect();
+  g_frameStats.bytes = bytes;
+  return rects;
 }
 
-void drawCalendar() {
-  M5.Display.clear(TFT_BLACK);
-  M5.Display.setTextColor(TFT_WHITE);
-  
+// Finish a frame started with beginFrame(): flush it and swap buffers
+void presentFrame() {
+  M5Canvas* frame = g_frameBuffers[g_backIndex];
+  if (!frame || (!g_dirtyAll && g_dirtyCount == 0)) {
+    g_dirtyCount = 0;
+    g_dirtyAll = false;
+    return;
+  }
+  uint32_t drawnUs = micros();
+  g_frameStats.rects = flushDirty(*frame);
+  g_dirtyCount = 0;
+  g_dirtyAll = false;
+  // Swap only if DMA now reads this buffer; otherwise the other may still be busy
+  if (g_frameBuffers[1] && g_frameStats.rects > 0) {
+    g_backIndex ^= 1;
+  } else {
+    g_presentedCount = 0;  // Nothing for syncBackBuffer() to copy
+    g_presentedAll = false;
+  }
+
+  uint32_t now = micros();
+  FrameStats& stats = g_frameStats;
+  stats.drawUs = drawnUs - g_frameStartUs;
+  stats.presentUs = now - drawnUs;
+  uint32_t frameUs = now - g_frameStartUs;
+  stats.avgFrameUs = stats.frames ? (stats.avgFrameUs * 7 + frameUs) / 8 : frameUs;
+  stats.maxFrameUs = max(stats.maxFrameUs, frameUs);
+  stats.frames++;
+  g_bytesPushed += stats.bytes;
+  log_d("Frame %u: draw %u us, present %u us, %u rects, %u of %u bytes", stats.frames,
+        stats.drawUs, stats.presentUs, stats.rects, stats.bytes,
+        (unsigned)(frame->width() * frame->height() * 2));
+  if (millis() - g_frameStatsLoggedMs >= kFrameStatsLogMs) {
+    g_frameStatsLoggedMs = millis();
+    log_i("Frames: %u, avg %u us, max %u us, %u bytes pushed", stats.frames, stats.avgFrameUs,
+          stats.maxFrameUs, (unsigned)g_bytesPushed);
+  }
+}
+
+// Retained widget tree. Each screen is a tree built once with its layout
+// cached; state changes invalidate() the widgets they affect, and the next
+// frame repaints only those and their children. Taps descend into the
+// topmost child under the point, so routing costs O(depth).
+class Widget {
+ public:
+  virtual ~Widget() = default;
+
+  void setBounds(int x, int y, int w, int h) {
+    _x = x;
+    _y = y;
+    _w = w;
+    _h = h;
+    invalidate();
+  }
+
+  void add(Widget& child) {
+    child._parent = this;
+    if (_lastChild) {
+      _lastChild->_next = &child;
+    } else {
+      _firstChild = &child;
+    }
+    _lastChild = &child;
+    child.invalidate();
+  }
+
+  void setOnTap(void (*onTap)(Widget&), int tag = 0) {
+    _onTap = onTap;
+    _tag = tag;
+  }
+
+  int tag() const { return _tag; }
+  bool needsPaint() const { return _dirty || _childDirty; }
+
+  bool contains(int px, int py) const {
+    return px >= _x && px < _x + _w && py >= _y && py < _y + _h;
+  }
+
+  void invalidate() {
+    _dirty = true;
+    for (Widget* p = _parent; p && !p->_childDirty; p = p->_parent) p->_childDirty = true;
+    g_needsRedraw = true;
+  }
+
+  // Deepest widget under the point that handles taps; later siblings are on top
+  Widget* hitTest(int px, int py) {
+    if (!contains(px, py)) return nullptr;
+    Widget* hit = nullptr;
+    for (Widget* c = _firstChild; c; c = c->_next) {
+      if (c->contains(px, py)) hit = c;
+    }
+    if (hit) {
+      Widget* target = hit->hitTest(px, py);
+      if (target) return target;
+    }
+    return _onTap ? this : nullptr;
+  }
+
+  bool tap(int px, int py) {
+    Widget* target = hitTest(px, py);
+    if (!target) return false;
+    target->_onTap(*target);
+    return true;
+  }
+
+  // Repaint invalidated widgets and mark their bounds for presentFrame()
+  virtual void paint(LovyanGFX& gfx, bool force = false) {
+    if (force || _dirty) {
+      draw(gfx);
+      markDirty(_x, _y, _w, _h);
+      force = true;
+    } else if (!_childDirty) {
+      return;
+    }
+    for (Widget* c = _firstChild; c; c = c->_next) c->paint(gfx, force);
+    _dirty = false;
+    _childDirty = false;
+  }
+
+ protected:
+  virtual void draw(LovyanGFX& gfx) {}  // Plain widgets are invisible tap zones
+
+  int _x = 0;
+  int _y = 0;
+  int _w = 0;
+  int _h = 0;
+
+ private:
+  Widget* _parent = nullptr;
+  Widget* _firstChild = nullptr;
+  Widget* _lastChild = nullptr;
+  Widget* _next = nullptr;
+  void (*_onTap)(Widget&) = nullptr;
+  int _tag = 0;
+  bool _dirty = true;
+  bool _childDirty = true;
+};
+
+class Container : public Widget {
+ public:
+  void setBackground(uint16_t color) {
+    _background = color;
+    invalidate();
+  }
+
+ protected:
+  void draw(LovyanGFX& gfx) override {
+    gfx.fillRect(_x, _y, _w, _h, _background);
+  }
+
+  uint16_t _background = TFT_BLACK;
+};
+
+// A subtree rendered into its own full-screen canvas and blitted as one piece;
+// only invalidated children are redrawn into the canvas
+class CachedLayer : public Container {
+ public:
+  void paint(LovyanGFX& gfx, bool force = false) override {
+    if (!_cache) _cache = borrowCanvas(M5.Display.width(), M5.Display.height());
+    if (!_cache) {
+      Container::paint(gfx, force);
+      return;
+    }
+    bool changed = needsPaint();
+    if (changed) Container::paint(*_cache);
+    if (changed || force) {
+      _cache->pushSprite(&gfx, 0, 0);
+      markDirty(_x, _y, _w, _h);
+    }
+  }
+
+ private:
+  M5Canvas* _cache = nullptr;
+};
+
+class Label : public Widget {
+ public:
+  void setText(const char* text) {
+    if (strncmp(_text, text, sizeof(_text) - 1) == 0) return;
+    strlcpy(_text, text, sizeof(_text));
+    invalidate();
+  }
+
+  void setStyle(const lgfx::IFont* font, float size, uint16_t color, uint8_t datum) {
+    _font = font;
+    _size = size;
+    _color = color;
+    _datum = datum;
+    invalidate();
+  }
+
+ protected:
+  void draw(LovyanGFX& gfx) override {
+    gfx.fillRect(_x, _y, _w, _h, TFT_BLACK);
+    if (!_text[0]) return;
+    // Anchor on the edge or centre the datum names
+    int ax = _datum % 3 == 0 ? _x : _datum % 3 == 1 ? _x + _w / 2 : _x + _w;
+    int ay = _datum / 3 == 0 ? _y : _datum / 3 == 1 ? _y + _h / 2 : _y + _h;
+    gfx.setFont(_font);
+    gfx.setTextSize(_size);
+    gfx.setTextColor(_color);
+    gfx.setTextDatum(_datum);
+    gfx.drawString(_text, ax, ay);
+    gfx.setTextDatum(TL_DATUM);
+    gfx.setFont(&fonts::Font0);
+  }
+
+ private:
+  char _text[96] = "";
+  const lgfx::IFont* _font = &fonts::Font0;
+  float _size = 1;
+  uint16_t _color = TFT_WHITE;
+  uint8_t _datum = TL_DATUM;
+};
+
+class Button : public Container {
+ public:
+  void setText(const char* text) {
+    _text = text;
+    invalidate();
+  }
+
+  void setBorder(bool border) {
+    if (border == _border) return;
+    _border = border;
+    invalidate();
+  }
+
+  // Unfilled buttons draw over whatever is underneath
+  void setFilled(bool filled) {
+    _filled = filled;
+    invalidate();
+  }
+
+ protected:
+  void draw(LovyanGFX& gfx) override {
+    if (_filled) Container::draw(gfx);
+    if (_border) gfx.drawRect(_x, _y, _w, _h, TFT_WHITE);
+    if (_text) {
+      gfx.setFont(&fonts::Font0);
+      gfx.setTextSize(1);
+      gfx.setTextColor(TFT_WHITE);
+      gfx.setCursor(_x + 8, _y + 8);
+      gfx.print(_text);
+    }
+  }
+
+ private:
+  const char* _text = nullptr;
+  bool _border = false;
+  bool _filled = true;
+};
+
+// Fixed-height rows drawn by a callback; scrolling repaints only the list
+class List : public Widget {
+ public:
+  void setRows(int rowHeight, void (*drawRow)(LovyanGFX& gfx, int index, int x, int y, int w, int h)) {
+    _rowHeight = rowHeight;
+    _drawRow = drawRow;
+    invalidate();
+  }
+
+  void setEmptyText(const char* text) { _emptyText = text; }
+
+  void setCount(int count) {
+    _count = count;
+    _first = constrain(_first, 0, max(0, _count - visibleRows()));
+    invalidate();
+  }
+
+  int count() const { return _count; }
+  int first() const { return _first; }
+  int visibleRows() const { return _rowHeight > 0 ? _h / _rowHeight : 0; }
+
+  bool scrollTo(int first) {
+    first = constrain(first, 0, max(0, _count - visibleRows()));
+    if (first == _first) return false;
+    _first = first;
+    invalidate();
+    return true;
+  }
+
+ protected:
+  void draw(LovyanGFX& gfx) override {
+    gfx.fillRect(_x, _y, _w, _h, TFT_BLACK);
+    if (_count == 0 && _emptyText) {
+      gfx.setFont(&fonts::Font0);
+      gfx.setTextSize(1);
+      gfx.setTextColor(TFT_WHITE);
+      gfx.setTextDatum(MC_DATUM);
+      gfx.drawString(_emptyText, _x + _w / 2, _y + _h / 2);
+      gfx.setTextDatum(TL_DATUM);
+      return;
+    }
+    for (int i = _first; i < _count && i < _first + visibleRows(); ++i) {
+      _drawRow(gfx, i, _x, _y + (i - _first) * _rowHeight, _w, _rowHeight);
+    }
+  }
+
+ private:
+  void (*_drawRow)(LovyanGFX&, int, int, int, int, int) = nullptr;
+  const char* _emptyText = nullptr;
+  int _rowHeight = 0;
+  int _count = 0;
+  int _first = 0;
+};
+
+// Free-form content drawn by a callback within the widget's bounds
+class View : public Widget {
+ public:
+  void setPainter(void (*painter)(LovyanGFX& gfx, int x, int y, int w, int h)) {
+    _painter = painter;
+    invalidate();
+  }
+
+ protected:
+  void draw(LovyanGFX& gfx) override {
+    if (_painter) _painter(gfx, _x, _y, _w, _h);
+  }
+
+ private:
+  void (*_painter)(LovyanGFX&, int, int, int, int) = nullptr;
+};
+
+// Custom UI font: a VLW (anti-aliased, e.g. from Processing's font tool) at
+// 24 px, like efontTW_24 which it replaces when present
+const char* kUiFontPath = "/M5Stack-Tab-5-Adventure/fonts/ui.vlw";
+const char* kUiFontUsagePath = "/M5Stack-Tab-5-Adventure/fonts/ui.usage";
+constexpr uint32_t kFontUsageMagic = 0x31535546;  // "FUS1"
+
+// Font data read from SD through a page cache. The VLW loader keeps glyph
+// metrics in RAM and reads each bitmap through this wrapper on demand, so a
+// full CJK font stays on the card. Page use is counted and saved; at boot the
+// pages used most last session (decayed by half each boot) are read in and
+// pinned.
+class PagedFontReader : public lgfx::DataWrapper {
+ public:
+  static constexpr uint32_t kPageSize = 4096;
+  static constexpr int kPageCount = 32;  // 128 KB of PSRAM
+  static constexpr int kHotPages = 12;   // Pinned from the usage stats
+
+  bool open(const char* path) {
+    release();
+    _file = SD_MMC.open(path);
+    if (!_file) return false;
+    _size = _file.size();
+    _pos = 0;
+    _filePages = (_size + kPageSize - 1) / kPageSize;
+    _pages = (uint8_t*)heap_caps_malloc(kPageCount * kPageSize, MALLOC_CAP_SPIRAM);
+    _useCounts = (uint16_t*)heap_caps_calloc(_filePages, sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+    if (!_pages || !_useCounts) {
+      release();
+      return false;
+    }
+    for (int i = 0; i < kPageCount; ++i) {
+      _slots[i] = {UINT32_MAX, 0, false};
+    }
+    return true;
+  }
+
+  int read(uint8_t* buf, uint32_t len) override {
+    uint32_t got = 0;
+    while (got < len && _pos < _size) {
+      const uint8_t* page = fetchPage(_pos / kPageSize);
+      if (!page) break;
+      uint32_t offset = _pos % kPageSize;
+      uint32_t n = min(len - got, min(kPageSize - offset, _size - _pos));
+      memcpy(buf + got, page + offset, n);
+      got += n;
+      _pos += n;
+    }
+    return got;
+  }
+
+  void skip(int32_t offset) override {
+    seek(_pos + offset);
+  }
+
+  bool seek(uint32_t offset) override {
+    _pos = min(offset, _size);
+    return true;
+  }
+
+  void close() override {}  // The file stays open as long as the font is in use
+
+  // Close the file and free the page buffer and usage counts
+  void release() {
+    if (_file) _file.close();
+    heap_caps_free(_pages);
+    heap_caps_free(_useCounts);
+    _pages = nullptr;
+    _useCounts = nullptr;
+    _size = 0;
+    _pos = 0;
+    _filePages = 0;
+    _counting = false;
+    _usageChanged = false;
+  }
+
+  int32_t tell() override {
+    return _pos;
+  }
+
+  // Pin the most used pages from the saved stats, then start counting
+  void loadUsage(const char* path) {
+    File file = SD_MMC.open(path);
+    uint32_t header[2] = {};
+    if (file && file.read((uint8_t*)header, sizeof(header)) == sizeof(header) &&
+        header[0] == kFontUsageMagic && header[1] == _size) {
+      file.read((uint8_t*)_useCounts, _filePages * sizeof(uint16_t));
+      for (uint32_t i = 0; i < _filePages; ++i) _useCounts[i] >>= 1;
+    }
+    if (file) file.close();
+
+    for (int hot = 0; hot < kHotPages; ++hot) {
+      uint32_t best = UINT32_MAX;
+      for (uint32_t i = 0; i < _filePages; ++i) {
+        if (_useCounts[i] > 0 && !isCached(i) && (best == UINT32_MAX || _useCounts[i] > _useCounts[best])) {
+          best = i;
+        }
+      }
+      if (best == UINT32_MAX) break;
+      if (fetchPage(best)) _slots[findSlot(best)].pinned = true;
+    }
+    _counting = true;
+    _usageChanged = false;
+  }
+
+  void saveUsage(const char* path) {
+    if (!_usageChanged) return;
+    File file = SD_MMC.open(path, FILE_WRITE);
+    if (!file) return;
+    uint32_t header[2] = {kFontUsageMagic, _size};
+    file.write((const uint8_t*)header, sizeof(header));
+    file.write((const uint8_t*)_useCounts, _filePages * sizeof(uint16_t));
+    file.close();
+    _usageChanged = false;
+  }
+
+  uint32_t hits() const { return _hits; }
+  uint32_t misses() const { return _misses; }
+
+ private:
+  struct Slot {
+    uint32_t page;     // UINT32_MAX = empty
+    uint32_t lastUse;
+    bool pinned;
+  };
+
+  int findSlot(uint32_t page) const {
+    for (int i = 0; i < kPageCount; ++i) {
+      if (_slots[i].page == page) return i;
+    }
+    return -1;
+  }
+
+  bool isCached(uint32_t page) const { return findSlot(page) >= 0; }
+
+  const uint8_t* fetchPage(uint32_t page) {
+    if (_counting && _useCounts[page] < UINT16_MAX) {
+      _useCounts[page]++;
+      _usageChanged = true;
+    }
+    int slot = findSlot(page);
+    if (slot >= 0) {
+      _hits++;
+    } else {
+      // Least recently used unpinned slot
+      for (int i = 0; i < kPageCount; ++i) {
+        if (_slots[i].pinned) continue;
+        if (slot < 0 || _slots[i].lastUse < _slots[slot].lastUse) slot = i;
+      }
+      if (slot < 0) return nullptr;
+      _misses++;
+      _slots[slot].page = UINT32_MAX;
+      uint32_t n = min(kPageSize, _size - page * kPageSize);
+      if (!_file.seek(page * kPageSize) || _file.read(_pages + slot * kPageSize, n) != n) {
+        return nullptr;
+      }
+      _slots[slot].page = page;
+    }
+    _slots[slot].lastUse = ++_clock;
+    return _pages + slot * kPageSize;
+  }
+
+  File _file;
+  uint8_t* _pages = nullptr;
+  uint16_t* _useCounts = nullptr;  // Per file page, saturating
+  Slot _slots[kPageCount];
+  uint32_t _size = 0;
+  uint32_t _pos = 0;
+  uint32_t _filePages = 0;
+  uint32_t _clock = 0;
+  uint32_t _hits = 0;
+  uint32_t _misses = 0;
+  bool _counting = false;  // Off while the loader reads the metrics
+  bool _usageChanged = false;
+};
+
+PagedFontReader g_uiFontReader;
+lgfx::VLWfont g_uiFont;
+
+// Load custom fonts from SD card; the built-in efont is used without them
+void loadCustomFonts() {
+  g_fontsLoaded = false;
+  if (!g_sdMounted || !SD_MMC.exists(kUiFontPath)) return;
+  if (!g_uiFontReader.open(kUiFontPath) || !g_uiFont.loadFont(&g_uiFontReader)) {
+    g_uiFontReader.release();
+    log_w("Failed to load %s, using built-in fonts", kUiFontPath);
+    return;
+  }
+  g_uiFontReader.loadUsage(kUiFontUsagePath);
+  g_fontsLoaded = true;
+}
+
+// Persist font page usage so the next boot can pin the hot pages
+void saveFontUsage() {
+  if (!g_fontsLoaded) return;
+  g_uiFontReader.saveUsage(kUiFontUsagePath);
+  log_i("UI font pages: %u hits, %u misses", (unsigned)g_uiFontReader.hits(),
+        (unsigned)g_uiFontReader.misses());
+}
+
+const lgfx::IFont* uiFont() {
+  return g_fontsLoaded ? (const lgfx::IFont*)&g_uiFont : &fonts::efontTW_24;
+}
+
+// Helper to set font for calendar events (small size)
+void setCalendarFont(LovyanGFX& gfx) {
+  gfx.setFont(uiFont());
+  gfx.setTextSize(1.5);
+}
+
+// Helper to set font for todo list (medium size)
+void setTodoFont(LovyanGFX& gfx) {
+  gfx.setFont(uiFont());
+  gfx.setTextSize(2);
+}
+
+// Unload custom font
+void unloadCustomFont(LovyanGFX& gfx) {
+  gfx.setFont(&fonts::Font0);
+}
+
+// Glyph cache. Text is drawn from per-glyph coverage masks rasterised once at
+// the drawn size (box-filtered, so fractional sizes come out anti-aliased)
+// and kept in an LRU keyed by font, size and codepoint; a hit is a blend into
+// a small buffer and one pushImage instead of a font lookup and scaled draw.
+constexpr int kGlyphCacheSize = 256;
+constexpr int kGlyphBuckets = 512;
+constexpr int kGlyphMaxSize = 48;     // Largest cached glyph edge after scaling
+constexpr int kGlyphRasterSize = 48;  // Scratch cell glyphs are drawn into at size 1
+
+struct GlyphEntry {
+  const lgfx::IFont* font;
+  uint32_t codepoint;
+  uint16_t scale;   // Text size in 1/16ths
+  uint8_t w;        // Mask size
+  uint8_t h;
+  float advance;    // Scaled pen advance
+  int16_t newer;    // LRU list, newest first
+  int16_t older;
+  int16_t nextInBucket;
+};
+
+struct GlyphCacheStats {
+  uint32_t hits;
+  uint32_t misses;
+  uint32_t evictions;
+};
+
+GlyphEntry g_glyphs[kGlyphCacheSize];
+int16_t g_glyphBuckets[kGlyphBuckets];
+uint8_t* g_glyphAlpha = nullptr;  // kGlyphCacheSize masks of kGlyphMaxSize^2
+int g_glyphCount = 0;
+int16_t g_glyphNewest = -1;
+int16_t g_glyphOldest = -1;
+GlyphCacheStats g_glyphStats = {};
+M5Canvas g_glyphScratch;
+uint8_t g_glyphScratchPixels[kGlyphRasterSize * kGlyphRasterSize];
+
+bool initGlyphCache() {
+  if (g_glyphAlpha) return true;
+  g_glyphAlpha = (uint8_t*)heap_caps_malloc(kGlyphCacheSize * kGlyphMaxSize * kGlyphMaxSize,
+                                            MALLOC_CAP_SPIRAM);
+  if (!g_glyphAlpha) return false;
+  memset(g_glyphBuckets, 0xFF, sizeof(g_glyphBuckets));
+  // Grayscale keeps all 256 anti-aliasing levels of smooth fonts as coverage
+  g_glyphScratch.setBuffer(g_glyphScratchPixels, kGlyphRasterSize, kGlyphRasterSize,
+                           lgfx::grayscale_8bit);
+  return true;
+}
+
+uint32_t glyphBucket(const lgfx::IFont* font, uint16_t scale, uint32_t codepoint) {
+  uint32_t hash = (uint32_t)(uintptr_t)font * 2654435761u ^ scale * 40503u ^ codepoint * 16777619u;
+  return (hash ^ (hash >> 15)) % kGlyphBuckets;
+}
+
+void unlinkGlyph(int16_t i) {
+  GlyphEntry& e = g_glyphs[i];
+  if (e.newer >= 0) {
+    g_glyphs[e.newer].older = e.older;
+  } else {
+    g_glyphNewest = e.older;
+  }
+  if (e.older >= 0) {
+    g_glyphs[e.older].newer = e.newer;
+  } else {
+    g_glyphOldest = e.newer;
+  }
+}
+
+void pushGlyphNewest(int16_t i) {
+  g_glyphs[i].newer = -1;
+  g_glyphs[i].older = g_glyphNewest;
+  if (g_glyphNewest >= 0) g_glyphs[g_glyphNewest].newer = i;
+  g_glyphNewest = i;
+  if (g_glyphOldest < 0) g_glyphOldest = i;
+}
+
+// Draw one codepoint at size 1 and box-filter it down (or up) to the text size
+bool rasteriseGlyph(GlyphEntry& e, const char* utf8, uint8_t* alpha) {
+  g_glyphScratch.setFont(e.font);
+  g_glyphScratch.setTextSize(1);
+  int srcW = g_glyphScratch.textWidth(utf8);
+  int srcH = g_glyphScratch.fontHeight();
+  float scale = e.scale / 16.0f;
+  int w = (int)ceilf(srcW * scale);
+  int h = (int)ceilf(srcH * scale);
+  if (srcW > kGlyphRasterSize || srcH > kGlyphRasterSize || w > kGlyphMaxSize || h > kGlyphMaxSize) {
+    return false;
+  }
+  g_glyphScratch.fillScreen(TFT_BLACK);
+  g_glyphScratch.setTextColor(TFT_WHITE);
+  g_glyphScratch.setTextDatum(TL_DATUM);
+  g_glyphScratch.drawString(utf8, 0, 0);
+
+  // Coverage of each output pixel's footprint; the gray level is the ink
+  float inv = 1.0f / scale;
+  float norm = scale * scale;
+  for (int dy = 0; dy < h; ++dy) {
+    float y0 = dy * inv;
+    float y1 = min((dy + 1) * inv, (float)srcH);
+    for (int dx = 0; dx < w; ++dx) {
+      float x0 = dx * inv;
+      float x1 = min((dx + 1) * inv, (float)srcW);
+      float cover = 0;
+      for (int sy = (int)y0; sy < y1; ++sy) {
+        float wy = min(y1, sy + 1.0f) - max(y0, (float)sy);
+        const uint8_t* row = g_glyphScratchPixels + sy * kGlyphRasterSize;
+        for (int sx = (int)x0; sx < x1; ++sx) {
+          uint8_t ink = row[sx];
+          if (ink) cover += ink * wy * (min(x1, sx + 1.0f) - max(x0, (float)sx));
+        }
+      }
+      alpha[dy * w + dx] = (uint8_t)min(255.0f, cover * norm + 0.5f);
+    }
+  }
+  e.w = w;
+  e.h = h;
+  e.advance = srcW * scale;
+  return true;
+}
+
+// Cached mask for a glyph, rasterising (and evicting the least recently used)
+// on a miss; nullptr if it cannot be cached
+const GlyphEntry* findGlyph(const lgfx::IFont* font, uint16_t scale, uint32_t codepoint,
+                            const char* utf8, const uint8_t*& alpha) {
+  if (!initGlyphCache()) return nullptr;
+  uint32_t bucket = glyphBucket(font, scale, codepoint);
+  for (int16_t i = g_glyphBuckets[bucket]; i >= 0; i = g_glyphs[i].nextInBucket) {
+    GlyphEntry& e = g_glyphs[i];
+    if (e.font == font && e.scale == scale && e.codepoint == codepoint) {
+      g_glyphStats.hits++;
+      if (g_glyphNewest != i) {
+        unlinkGlyph(i);
+        pushGlyphNewest(i);
+      }
+      alpha = g_glyphAlpha + i * kGlyphMaxSize * kGlyphMaxSize;
+      return e.w ? &e : nullptr;
+    }
+  }
+
+  g_glyphStats.misses++;
+  int16_t i;
+  if (g_glyphCount < kGlyphCacheSize) {
+    i = g_glyphCount++;
+  } else {
+    i = g_glyphOldest;
+    unlinkGlyph(i);
+    GlyphEntry& old = g_glyphs[i];
+    int16_t* link = &g_glyphBuckets[glyphBucket(old.font, old.scale, old.codepoint)];
+    while (*link != i) link = &g_glyphs[*link].nextInBucket;
+    *link = old.nextInBucket;
+    g_glyphStats.evictions++;
+  }
+  GlyphEntry& e = g_glyphs[i];
+  e.font = font;
+  e.scale = scale;
+  e.codepoint = codepoint;
+  e.w = 0;  // Cached as uncacheable if rasterising fails
+  alpha = g_glyphAlpha + i * kGlyphMaxSize * kGlyphMaxSize;
+  rasteriseGlyph(e, utf8, (uint8_t*)alpha);
+  e.nextInBucket = g_glyphBuckets[bucket];
+  g_glyphBuckets[bucket] = i;
+  pushGlyphNewest(i);
+  return e.w ? &e : nullptr;
+}
+
+// Draw text top-left at (x, y) over a solid background in gfx's current font
+// and size, through the glyph cache; returns the pen advance in pixels.
+// Glyphs too large to cache fall back to drawString. A length >= 0 draws only
+// that many bytes.
+int drawCachedText(LovyanGFX& gfx, const char* text, int x, int y, uint16_t color,
+                   uint16_t background, int length = -1) {
+  static uint16_t pixels[kGlyphMaxSize * kGlyphMaxSize];
+  const lgfx::IFont* font = gfx.getFont();
+  uint16_t scale = (uint16_t)(gfx.getTextSizeX() * 16 + 0.5f);
+  uint32_t fg = spreadRgb565(color);
+  uint32_t bg = spreadRgb565(background);
+  float pen = x;
+  const char* end = length >= 0 ? text + length : nullptr;
+  gfx.startWrite();
+  for (const char* p = text; *p && p != end;) {
+    const char* start = p;
+    uint32_t codepoint = nextCodepoint(p);
+    char utf8[5] = {};
+    memcpy(utf8, start, p - start);  // At most 4 bytes
+    const uint8_t* alpha = nullptr;
+    const GlyphEntry* glyph = findGlyph(font, scale, codepoint, utf8, alpha);
+    if (!glyph) {
+      gfx.setTextColor(color);
+      gfx.setTextDatum(TL_DATUM);
+      pen += gfx.drawString(utf8, (int)pen, y);
+      continue;
+    }
+    int n = glyph->w * glyph->h;
+    for (int k = 0; k < n; ++k) {
+      uint32_t a = (alpha[k] + 4) >> 3;  // 0..32
+      pixels[k] = __builtin_bswap16(packRgb565((fg * a + bg * (32 - a)) >> 5));
+    }
+    gfx.pushImage((int)(pen + 0.5f), y, glyph->w, glyph->h, (const lgfx::swap565_t*)pixels);
+    pen += glyph->advance;
+  }
+  gfx.endWrite();
+  return (int)(pen + 0.5f) - x;
+}
+
+// Width-aware truncation. Text that does not fit a pixel budget is cut at a
+// codepoint boundary and ends in "...", measured with the font's real advances.
+// Results are memoised per (string id, font, size, width) and revalidated by
+// a hash of the text, so an unchanged string is never measured again.
+constexpr int kEllipsisCacheSize = 128;
+constexpr int kEllipsisMaxBytes = 96;
+
+struct EllipsisEntry {
+  uint32_t key;       // 0 = empty
+  uint32_t textHash;
+  char text[kEllipsisMaxBytes];
+};
+
+EllipsisEntry g_ellipsisCache[kEllipsisCacheSize];
+
+// String ids: a namespace in the top byte, the item index below
+constexpr uint32_t kTextIdEventTime = 1u << 24;
+constexpr uint32_t kTextIdEventSummary = 2u << 24;
+constexpr uint32_t kTextIdTaskTitle = 3u << 24;
+
+// Pen advance of one glyph in gfx's current font and size
+float glyphAdvance(LovyanGFX& gfx, uint16_t scale, uint32_t codepoint, const char* utf8) {
+  const uint8_t* alpha = nullptr;
+  const GlyphEntry* glyph = findGlyph(gfx.getFont(), scale, codepoint, utf8, alpha);
+  return glyph ? glyph->advance : gfx.textWidth(utf8);
+}
+
+const char* ellipsizeText(LovyanGFX& gfx, uint32_t id, const char* text, int maxWidth) {
+  uint16_t scale = (uint16_t)(gfx.getTextSizeX() * 16 + 0.5f);
+  uint32_t key = 2166136261u;
+  auto mix = [&key](uint32_t value) {
+    for (int i = 0; i < 4; ++i, value >>= 8) key = (key ^ (value & 0xFF)) * 16777619u;
+  };
+  mix(id);
+  mix((uint32_t)(uintptr_t)gfx.getFont());
+  mix(scale);
+  mix(maxWidth);
+  key |= 1;
+  uint32_t textHash = 2166136261u;
+  for (const char* p = text; *p; ++p) textHash = (textHash ^ (uint8_t)*p) * 16777619u;
+
+  EllipsisEntry& entry = g_ellipsisCache[key % kEllipsisCacheSize];
+  if (entry.key == key && entry.textHash == textHash) return entry.text;
+
+  // Walk codepoints, remembering the last cut that still leaves room for "..."
+  float dotsWidth = 3 * glyphAdvance(gfx, scale, '.', ".");
+  float width = 0;
+  int cut = 0;
+  bool fits = true;
+  for (const char* p = text; *p;) {
+    const char* start = p;
+    uint32_t codepoint = nextCodepoint(p);
+    char utf8[5] = {};
+    memcpy(utf8, start, p - start);
+    if (codepoint == '\n') {
+      fits = false;  // Only the first line is shown
+      break;
+    }
+    width += glyphAdvance(gfx, scale, codepoint, utf8);
+    if (width > maxWidth || p - text > kEllipsisMaxBytes - 4) {
+      fits = false;
+      break;
+    }
+    if (width + dotsWidth <= maxWidth) cut = p - text;
+  }
+  if (fits) {
+    memcpy(entry.text, text, strlen(text) + 1);
+  } else {
+    memcpy(entry.text, text, cut);
+    memcpy(entry.text + cut, "...", 4);
+  }
+  entry.key = key;
+  entry.textHash = textHash;
+  return entry.text;
+}
+
+// Line layouts are cached per (string id, font, size, width, line limit)
+// and revalidated by a hash of the text; breaking itself is in text_layout.h.
+constexpr int kLayoutCacheSize = 64;
+
+TextLayout g_layoutCache[kLayoutCacheSize];
+
+const TextLayout& layoutText(LovyanGFX& gfx, uint32_t id, const char* text, int maxWidth,
+                             int maxLines) {
+  maxLines = constrain(maxLines, 1, kMaxLayoutLines);
+  uint16_t scale = (uint16_t)(gfx.getTextSizeX() * 16 + 0.5f);
+  uint32_t key = 2166136261u;
+  auto mix = [&key](uint32_t value) {
+    for (int i = 0; i < 4; ++i, value >>= 8) key = (key ^ (value & 0xFF)) * 16777619u;
+  };
+  mix(id);
+  mix((uint32_t)(uintptr_t)gfx.getFont());
+  mix(scale);
+  mix(maxWidth);
+  mix(maxLines);
+  key |= 1;
+  uint32_t textHash = 2166136261u;
+  for (const char* p = text; *p; ++p) textHash = (textHash ^ (uint8_t)*p) * 16777619u;
+
+  TextLayout& layout = g_layoutCache[key % kLayoutCacheSize];
+  if (layout.key == key && layout.textHash == textHash) return layout;
+  layout.key = key;
+  layout.textHash = textHash;
+  breakLines(text, maxWidth, maxLines, [&](uint32_t codepoint, const char* utf8) {
+    return glyphAdvance(gfx, scale, codepoint, utf8);
+  }, layout);
+  return layout;
+}
+
+// Draw text wrapped to at most maxLines lines of maxWidth, ellipsizing the
+// last line if the text does not fit; returns the number of lines drawn
+int drawTextLines(LovyanGFX& gfx, uint32_t id, const char* text, int x, int y, int maxWidth,
+                  int maxLines, int lineHeight, uint16_t color, uint16_t background) {
+  const TextLayout& layout = layoutText(gfx, id, text, maxWidth, maxLines);
+  int lines = layout.lineCount;
+  for (int i = 0; i < lines; ++i) {
+    const char* line = text + layout.start[i];
+    if (layout.truncated && i == lines - 1) {
+      line = ellipsizeText(gfx, id, line, maxWidth);
+      drawCachedText(gfx, line, x, y + i * lineHeight, color, background);
+    } else {
+      drawCachedText(gfx, line, x, y + i * lineHeight, color, background,
+                     layout.end[i] - layout.start[i]);
+    }
+  }
+  return lines;
+}
+
+// Parse date from YYYYMMDD format
+void parseDate(const String& dateStr, int& year, int& month, int& day) {
+  if (dateStr.length() >= 8) {
+    year = dateStr.substring(0, 4).toInt();
+    month = dateStr.substring(4, 6).toInt();
+    day = dateStr.substring(6, 8).toInt();
+  }
+}
+
+// Parse time from HHMMSS format
+String parseTime(const String& timeStr) {
+  if (timeStr.length() >= 6) {
+    int hour = timeStr.substring(0, 2).toInt();
+    int minute = timeStr.substring(2, 4).toInt();
+    char buf[10];
+    snprintf(buf, sizeof(buf), "%02d:%02d", hour, minute);
+    return String(buf);
+  }
+  return "";
+}
+
+// Load calendar events from .ics file
+void loadCalendarEvents() {
+  g_eventCount = 0;
+  if (!g_sdMounted) return;
+  
+  File file = SD_MMC.open("/M5Stack-Tab-5-Adventure/calendar/calendar.ics");
+  if (!file) return;
+  
+  String currentSummary = "";
+  String currentDate = "";
+  String currentTime = "";
+  String currentRRule = "";
+  
+  while (file.available() && g_eventCount < 800) {
+    String line = file.readStringUntil('\n');
+    line.trim();
+    
+    if (line.startsWith("SUMMARY:")) {
+      currentSummary = line.substring(8);
+    } else if (line.startsWith("RRULE:")) {
+      currentRRule = line.substring(6);
+    } else if (line.startsWith("DTSTART")) {
+      int colonPos = line.indexOf(':');
+      if (colonPos > 0) {
+        String datetime = line.substring(colonPos + 1);
+        if (datetime.length() >= 8) {
+          currentDate = datetime.substring(0, 8);
+          if (datetime.length() >= 15 && datetime.charAt(8) == 'T') {
+            currentTime = parseTime(datetime.substring(9, 15));
+          }
+        }
+      }
+    } else if (line.startsWith("END:VEVENT")) {
+      if (currentSummary.length() > 0 && currentDate.length() >= 8) {
+        int year, month, day;
+        parseDate(currentDate, year, month, day);
+        g_events[g_eventCount] = {currentSummary, year, month, day, currentTime, currentRRule};
+        g_eventCount++;
+      }
+      currentSummary = "";
+      currentDate = "";
+      currentTime = "";
+      currentRRule = "";
+    }
+  }
+  file.close();
+}
+
+// Load todo tasks from JSON
+void loadTodoTasks() {
+  g_taskCount = 0;
+  if (!g_sdMounted) return;
+  
+  File file = SD_MMC.open("/M5Stack-Tab-5-Adventure/tasks/tasks.json");
+  if (!file) return;
+  
+  // Read entire file as bytes to preserve UTF-8 encoding
+  size_t fileSize = file.size();
+  uint8_t* buffer = (uint8_t*)malloc(fileSize + 1);
+  if (!buffer) {
+    file.close();
+    return;
+  }
+  
+  file.read(buffer, fileSize);
+  buffer[fileSize] = 0;
+  String content = String((char*)buffer);
+  free(buffer);
+  file.close();
+  
+  // Simple JSON parsing for tasks - improved for UTF-8
+  int pos = 0;
+  while (pos < content.length() && g_taskCount < 50) {
+    int titlePos = content.indexOf("\"title\"", pos);
+    if (titlePos < 0) break;
+    
+    int valueStart = content.indexOf(":", titlePos);
+    if (valueStart < 0) break;
+    valueStart = content.indexOf("\"", valueStart);
+    if (valueStart < 0) break;
+    valueStart++;
+    
+    int valueEnd = valueStart;
+    while (valueEnd < content.length()) {
+      if (content.charAt(valueEnd) == '"' && content.charAt(valueEnd - 1) != '\\') {
+        break;
+      }
+      valueEnd++;
+    }
+    
+    String title = content.substring(valueStart, valueEnd);
+    
+    // Check if completed
+    bool completed = false;
+    int statusPos = content.indexOf("\"status\"", valueEnd);
+    int nextTaskPos = content.indexOf("\"title\"", valueEnd + 1);
+    if (statusPos > 0 && (nextTaskPos < 0 || statusPos < nextTaskPos)) {
+      int statusStart = content.indexOf("\"", statusPos + 8);
+      if (statusStart > 0) {
+        statusStart++;
+        int statusEnd = content.indexOf("\"", statusStart);
+        if (statusEnd > 0) {
+          String status = content.substring(statusStart, statusEnd);
+          completed = (status == "completed");
+        }
+      }
+    }
+    
+    if (title.length() > 0) {
+      g_tasks[g_taskCount] = {title, completed};
+      g_taskCount++;
+    }
+    
+    pos = valueEnd + 1;
+  }
+}
+
+// Calendar helper functions
+int getDaysInMonth(int year, int month) {
+  if (month == 2) {
+    bool isLeap = (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
+    return isLeap ? 29 : 28;
+  }
+  if (month == 4 || month == 6 || month == 9 || month == 11) {
+    return 30;
+  }
+  return 31;
+}
+
+int getFirstDayOfMonth(int year, int month) {
+  // Zeller's congruence for day of week (0=Sun, 1=Mon, etc.)
+  if (month < 3) {
+    month += 12;
+    year -= 1;
+  }
+  int q = 1; // First day
+  int m = month;
+  int k = year % 100;
+  int j = year / 100;
+  int h = (q + ((13 * (m + 1)) / 5) + k + (k / 4) + (j / 4) - (2 * j)) % 7;
+  // Convert to 0=Sun, 1=Mon, etc.
+  return (h + 6) % 7;
+}
+
+int getDayOfWeek(int year, int month, int day) {
+  // Zeller's congruence
+  if (month < 3) {
+    month += 12;
+    year -= 1;
+  }
+  int q = day;
+  int m = month;
+  int k = year % 100;
+  int j = year / 100;
+  int h = (q + ((13 * (m + 1)) / 5) + k + (k / 4) + (j / 4) - (2 * j)) % 7;
+  return (h + 6) % 7;
+}
+
+void advanceDate(int& year, int& month, int& day, int days) {
+  day += days;
+  while (day > getDaysInMonth(year, month)) {
+    day -= getDaysInMonth(year, month);
+    month++;
+    if (month > 12) {
+      month = 1;
+      year++;
+    }
+  }
+  while (day < 1) {
+    month--;
+    if (month < 1) {
+      month = 12;
+      year--;
+    }
+    day += getDaysInMonth(year, month);
+  }
+}
+
+// Check if an event occurs on a specific date (considering recurrence)
+bool eventOccursOnDate(const CalendarEvent& event, int year, int month, int day) {
+  // Direct date match
+  if (event.year == year && event.month == month && event.day == day) {
+    return true;
+  }
+  
+  // Check recurrence rule
+  if (event.rrule.length() > 0) {
+    // Check UNTIL clause if present
+    int untilPos = event.rrule.indexOf("UNTIL=");
+    if (untilPos >= 0) {
+      String untilStr = event.rrule.substring(untilPos + 6);
+      int semicolon = untilStr.indexOf(';');
+      if (semicolon > 0) {
+        untilStr = untilStr.substring(0, semicolon);
+      }
+      // Parse UNTIL date (format: YYYYMMDD)
+      if (untilStr.length() >= 8) {
+        int untilYear = untilStr.substring(0, 4).toInt();
+        int untilMonth = untilStr.substring(4, 6).toInt();
+        int untilDay = untilStr.substring(6, 8).toInt();
+        
+        // Check if current date is after UNTIL date
+        if (year > untilYear || 
+            (year == untilYear && month > untilMonth) ||
+            (year == untilYear && month == untilMonth && day > untilDay)) {
+          return false; // Event has expired
+        }
+      }
+    }
+    
+    // Handle FREQ=YEARLY (most common in the data)
+    if (event.rrule.indexOf("FREQ=YEARLY") >= 0) {
+      // Event recurs yearly on same month/day
+      if (event.month == month && event.day == day) {
+        // Only show if current date is on or after the original event date
+        if (year > event.year || (year == event.year && month >= event.month)) {
+          return true;
+        }
+      }
+    }
+    // Can add more FREQ types here (DAILY, WEEKLY, MONTHLY)
+  }
+  
+  return false;
+}
+
+GridStats g_calendarBorderStats = {};  // Last draw, for profiling
+GridStats g_qrGridStats = {};
+
+// Week header and day grid; the navigation hint is a separate label
+void paintCalendarWeek(LovyanGFX& gfx, int x, int y, int w, int h) {
+  gfx.fillRect(x, y, w, h, TFT_BLACK);
+  gfx.setTextColor(TFT_WHITE);
+  
   // Calculate week start
   int year = g_calendarYear;
   int month = g_calendarMonth;
@@ -381,380 +1568,1926 @@ void drawCalendar() {
   int endYear = startYear, endMonth = startMonth, endDay = startDay;
   advanceDate(endYear, endMonth, endDay, 6);
   
-  M5.Display.setTextSize(2);
-  M5.Display.setTextDatum(TC_DATUM);
+  gfx.setTextSize(2);
+  gfx.setTextDatum(TC_DATUM);
   const char* monthNames[] = {"", "Jan", "Feb", "Mar", "Apr", "May", "Jun", 
                                "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
   char header[64];
   if (startMonth == endMonth) {
     snprintf(header, sizeof(header), "%s %d-%d, %d", monthNames[startMonth], startDay, endDay, startYear);
   } else {
-    snprintf(header, sizeof(header), "%s %d - %s %d, %d", 
-             monthNames[startMonth], startDay, monthNames[endMonth], endDay, endYear);
+    snprintf(header, sizeof(header), "%s %d - %s %d, %d", 
+             monthNames[startMonth], startDay, monthNames[endMonth], endDay, endYear);
+  }
+  gfx.drawString(header, x + w / 2, y + 10);
+  
+  // Day names
+  const char* dayNames[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+  
+  // Draw 7 horizontal blocks for the week below the header
+  int headerHeight = 50;
+  int cellH = (h - headerHeight) / 7;
+  int gridStartY = y + headerHeight;
+  
+  for (int dow = 0; dow < 7; dow++) {
+    int dayYear = startYear;
+    int dayMonth = startMonth;
+    int dayDay = startDay;
+    advanceDate(dayYear, dayMonth, dayDay, dow);
+    
+    int cellY = gridStartY + (dow * cellH);
+    
+    // Highlight today
+    bool isToday = (dayYear == 2026 && dayMonth == 2 && dayDay == 9);
+    uint16_t cellBg = isToday ? TFT_DARKGREY : TFT_BLACK;
+    if (isToday) {
+      gfx.fillRect(x + 2, cellY + 2, w - 4, cellH - 4, TFT_DARKGREY);
+    }
+    
+    // Draw day name and date on the left
+    gfx.setTextDatum(TL_DATUM);
+    gfx.setTextSize(2);
+    char dayLabel[32];
+    snprintf(dayLabel, sizeof(dayLabel), "%s %d/%d", dayNames[dow], dayMonth, dayDay);
+    gfx.drawString(dayLabel, x + 10, cellY + 5);
+    
+    // Show events for this day - arranged horizontally with wrapping
+    int eventX = x + 200;  // Start events after the date
+    int eventY = cellY + 10;
+    int lineHeight = 30;
+    int rowLines = 1;  // Tallest wrapped summary in the current row
+    setCalendarFont(gfx);
+    gfx.setTextSize(1);
+    
+    for (int i = 0; i < g_eventCount; i++) {
+      // Use recurrence-aware date matching
+      if (eventOccursOnDate(g_events[i], dayYear, dayMonth, dayDay)) {
+        
+        // Check if we need to wrap to next line
+        if (eventX > x + w - 300 && eventY < cellY + cellH - lineHeight - 5) {
+          eventX = x + 200;
+          eventY += lineHeight * rowLines;
+          rowLines = 1;
+        }
+        
+        // Stop if we run out of vertical space
+        if (eventY > cellY + cellH - lineHeight - 5) {
+          break;
+        }
+        
+        // Show time if available
+        if (g_events[i].time.length() > 0) {
+          const char* time = ellipsizeText(gfx, kTextIdEventTime | i, g_events[i].time.c_str(), 75);
+          drawCachedText(gfx, time, eventX, eventY, TFT_CYAN, cellBg);
+          eventX += 80;
+        }
+        
+        // Show event name, wrapped within its slot over the lines left in the cell
+        int maxLines = (cellY + cellH - 5 - eventY) / lineHeight;
+        int lines = drawTextLines(gfx, kTextIdEventSummary | i, g_events[i].summary.c_str(),
+                                  eventX, eventY, 240, maxLines, lineHeight, TFT_YELLOW, cellBg);
+        rowLines = max(rowLines, lines);
+        
+        // Move to next event position
+        eventX += 250;
+      }
+    }
+    unloadCustomFont(gfx);
+  }
+
+  // Cell borders, with the shared lines between days merged
+  int colEdges[4] = {x, x + 1, x + w - 1, x + w};
+  int rowEdges[7 * 3 + 1];
+  for (int dow = 0; dow < 7; dow++) {
+    int cellY = gridStartY + dow * cellH;
+    rowEdges[dow * 3] = cellY;
+    rowEdges[dow * 3 + 1] = cellY + 1;
+    rowEdges[dow * 3 + 2] = cellY + cellH - 1;
+  }
+  rowEdges[7 * 3] = gridStartY + 7 * cellH;
+  g_calendarBorderStats = fillGridRects(gfx, 3, 7 * 3, isCalendarBorderCell, nullptr, colEdges,
+                                       rowEdges, TFT_DARKGREY);
+  gfx.setTextDatum(TL_DATUM);
+}
+
+// One task: checkbox, title and separator
+void drawTodoRow(LovyanGFX& gfx, int index, int x, int y, int w, int h) {
+  const TodoTask& task = g_tasks[index];
+
+  // Checkbox
+  int cbSize = 40;
+  int cbX = x + 20;
+  int cbY = y + 10;
+  gfx.drawRect(cbX, cbY, cbSize, cbSize, TFT_WHITE);
+  if (task.completed) {
+    gfx.fillRect(cbX + 3, cbY + 3, cbSize - 6, cbSize - 6, TFT_GREEN);
+  }
+
+  // Task text
+  // Task text: one line at full size, or two smaller lines if it does not fit
+  setTodoFont(gfx);
+  int textX = cbX + cbSize + 10;
+  int textW = x + w - 10 - textX;
+  uint16_t textColor = task.completed ? TFT_DARKGREY : TFT_WHITE;
+  if (layoutText(gfx, kTextIdTaskTitle | index, task.title.c_str(), textW, 1).truncated) {
+    gfx.setTextSize(1.5);
+    drawTextLines(gfx, kTextIdTaskTitle | index, task.title.c_str(), textX, y + 4, textW, 2,
+                  36, textColor, TFT_BLACK);
+  } else {
+    drawCachedText(gfx, task.title.c_str(), textX, y + 15, textColor, TFT_BLACK);
+  }
+  unloadCustomFont(gfx);
+
+  // Separator line
+  gfx.drawLine(x + 10, y + h - 2, x + w - 10, y + h - 2, TFT_DARKGREY);
+}
+
+// Byte-mode capacity of each QR version at ECC_LOW; the smallest that fits is used
+const uint16_t kQrCapacityLow[40] = {
+  17, 32, 53, 78, 106, 134, 154, 192, 230, 271, 321, 367, 425, 458, 520, 586, 644, 718, 792, 858,
+  929, 1003, 1091, 1171, 1273, 1367, 1465, 1528, 1628, 1732, 1840, 1952, 2068, 2188, 2303, 2431,
+  2563, 2699, 2809, 2953,
+};
+
+// The last QR drawn, rasterised at its scale into a 1-bpp canvas (white and
+// black palette) keyed by text, version, ECC and size, so a redraw is one push
+M5Canvas g_qrCanvas;
+uint32_t g_qrKey = 0;
+
+int pickQrVersion(const char* text) {
+  size_t length = strlen(text);
+  for (int version = 1; version <= 40; ++version) {
+    if (length <= kQrCapacityLow[version - 1]) return version;
+  }
+  return 0;  // Too long for any QR code
+}
+
+void drawQRCode(LovyanGFX& gfx, const char* text, int x, int y, int size) {
+  int version = pickQrVersion(text);
+  if (version == 0) return;
+  uint32_t key = 2166136261u;
+  for (const char* p = text; *p; ++p) key = (key ^ (uint8_t)*p) * 16777619u;
+  key = (key ^ (version << 24 | ECC_LOW << 16 | size)) * 16777619u | 1;
+
+  if (key != g_qrKey) {
+    QRCode qrcode;
+    uint8_t qrcodeData[qrcode_getBufferSize(version)];
+    qrcode_initText(&qrcode, qrcodeData, version, ECC_LOW, text);
+
+    int scale = max(1, size / (int)qrcode.size);
+    int drawSize = qrcode.size * scale;
+    g_qrCanvas.deleteSprite();
+    g_qrCanvas.setColorDepth(lgfx::palette_1bit);
+    if (!g_qrCanvas.createSprite(drawSize, drawSize)) {
+      g_qrKey = 0;
+      return;
+    }
+    g_qrCanvas.setPaletteColor(0, TFT_WHITE);
+    g_qrCanvas.setPaletteColor(1, TFT_BLACK);
+    g_qrCanvas.fillScreen(0);
+    int edges[177 + 1];
+    uniformGridEdges(edges, qrcode.size, 0, scale);
+    auto isDark = [](const void* ctx, int col, int row) {
+      return qrcode_getModule((QRCode*)ctx, col, row);
+    };
+    g_qrGridStats = fillGridRects(g_qrCanvas, qrcode.size, qrcode.size, isDark, &qrcode, edges,
+                                  edges, 1);
+    g_qrCanvas.drawRect(0, 0, drawSize, drawSize, 1);
+    log_d("QR v%d: %d dark modules drawn with %d fills", version, g_qrGridStats.modules,
+          g_qrGridStats.rects);
+    g_qrKey = key;
+  }
+  g_qrCanvas.pushSprite(&gfx, x, y);
+}
+
+// Streams a file from SD through a small ring buffer for the image decoders.
+// A read-ahead task keeps the ring topped up so SD reads overlap decoding,
+// and peak memory no longer depends on the size of the file.
+class SdStreamReader : public lgfx::DataWrapper {
+ public:
+  static constexpr size_t kRingSize = 16 * 1024;
+  static constexpr size_t kChunkSize = 4 * 1024;
+  static constexpr uint32_t kReadTimeoutMs = 1000;
+
+  ~SdStreamReader() override {
+    close();
+    if (_ring) vStreamBufferDelete(_ring);
+    if (_done) vSemaphoreDelete(_done);
+    free(_chunk);
+  }
+
+  // Takes over the file handle; it is closed again by close()
+  bool open(File file) {
+    close();
+    if (!file) return false;
+    if (!_ring) {
+      _ring = xStreamBufferCreate(kRingSize, 1);
+      _done = xSemaphoreCreateBinary();
+      _chunk = (uint8_t*)malloc(kChunkSize);
+      if (!_ring || !_done || !_chunk) return false;
+    }
+    _file = file;
+    _size = file.size();
+    return startReadAhead(0);
+  }
+
+  int read(uint8_t* buf, uint32_t len) override {
+    uint32_t want = min<uint32_t>(len, _size - _pos);
+    uint32_t got = 0;
+    while (got < want) {
+      size_t n = xStreamBufferReceive(_ring, buf + got, want - got, pdMS_TO_TICKS(kReadTimeoutMs));
+      if (n == 0) break;  // Read-ahead stalled on an SD error
+      got += n;
+    }
+    _pos += got;
+    return got;
+  }
+
+  void skip(int32_t offset) override {
+    seek(_pos + offset);
+  }
+
+  bool seek(uint32_t offset) override {
+    if (offset > _size) offset = _size;
+    // Short forward skips drain the ring; anything else restarts read-ahead
+    if (offset >= _pos && offset - _pos <= kRingSize) {
+      uint8_t scratch[256];
+      while (_pos < offset) {
+        if (read(scratch, min<uint32_t>(sizeof(scratch), offset - _pos)) <= 0) return false;
+      }
+      return true;
+    }
+    stopReadAhead();
+    return startReadAhead(offset);
+  }
+
+  void close() override {
+    stopReadAhead();
+    if (_file) _file.close();
+    _size = 0;
+    _pos = 0;
+  }
+
+  int32_t tell() override {
+    return _pos;
+  }
+
+ private:
+  bool startReadAhead(uint32_t offset) {
+    if (!_file.seek(offset)) return false;
+    _pos = offset;
+    xStreamBufferReset(_ring);
+    _stop = false;
+    if (xTaskCreatePinnedToCore(readAheadTask, "sd_stream", 4096, this, 2, &_task, tskNO_AFFINITY) != pdPASS) {
+      _task = nullptr;
+      return false;
+    }
+    return true;
+  }
+
+  void stopReadAhead() {
+    if (!_task) return;
+    _stop = true;
+    xSemaphoreTake(_done, portMAX_DELAY);
+    _task = nullptr;
+  }
+
+  static void readAheadTask(void* arg) {
+    SdStreamReader* self = (SdStreamReader*)arg;
+    while (!self->_stop) {
+      size_t n = self->_file.read(self->_chunk, kChunkSize);
+      if (n == 0) break;  // End of file
+      size_t sent = 0;
+      while (sent < n && !self->_stop) {
+        sent += xStreamBufferSend(self->_ring, self->_chunk + sent, n - sent, pdMS_TO_TICKS(50));
+      }
+    }
+    xSemaphoreGive(self->_done);
+    vTaskDelete(nullptr);
+  }
+
+  File _file;
+  StreamBufferHandle_t _ring = nullptr;
+  SemaphoreHandle_t _done = nullptr;
+  TaskHandle_t _task = nullptr;
+  uint8_t* _chunk = nullptr;
+  volatile bool _stop = false;
+  uint32_t _size = 0;
+  uint32_t _pos = 0;
+};
+
+SdStreamReader g_imageStream;
+
+// In-memory stand-in for File in the header readers below
+struct MemoryReader {
+  const uint8_t* data;
+  size_t len;
+  size_t pos;
+
+  bool seek(size_t offset) {
+    if (offset > len) return false;
+    pos = offset;
+    return true;
+  }
+
+  size_t read(uint8_t* buf, size_t n) {
+    n = min(n, len - pos);
+    memcpy(buf, data + pos, n);
+    pos += n;
+    return n;
+  }
+};
+
+// Read image dimensions from the JPEG SOF marker by walking segment headers
+template <typename Reader>
+bool readJpegSize(Reader& file, int& width, int& height) {
+  uint8_t buf[5];
+  if (!file.seek(0) || file.read(buf, 2) != 2 || buf[0] != 0xFF || buf[1] != 0xD8) return false;
+  size_t pos = 2;
+  while (file.seek(pos) && file.read(buf, 4) == 4) {
+    if (buf[0] != 0xFF) return false;
+    uint8_t marker = buf[1];
+    if (marker == 0xFF) {  // Fill byte
+      pos++;
+      continue;
+    }
+    size_t segLen = (buf[2] << 8) | buf[3];
+    // SOF0..SOF15, excluding DHT (C4), JPG (C8) and DAC (CC)
+    if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+      if (file.read(buf, 5) != 5) return false;
+      height = (buf[1] << 8) | buf[2];
+      width = (buf[3] << 8) | buf[4];
+      return width > 0 && height > 0;
+    }
+    pos += 2 + segLen;
+  }
+  return false;
+}
+
+// Read image dimensions from the PNG IHDR chunk
+bool readPngSize(File& file, int& width, int& height) {
+  uint8_t buf[24];
+  if (!file.seek(0) || file.read(buf, sizeof(buf)) != sizeof(buf)) return false;
+  if (buf[0] != 0x89 || buf[1] != 'P' || buf[2] != 'N' || buf[3] != 'G') return false;
+  width = (buf[16] << 24) | (buf[17] << 16) | (buf[18] << 8) | buf[19];
+  height = (buf[20] << 24) | (buf[21] << 16) | (buf[22] << 8) | buf[23];
+  return width > 0 && height > 0;
+}
+
+// Largest JPEG IDCT downscale (1, 2, 4 or 8) that still covers the target size
+int pickJpegScaleDiv(int srcW, int srcH, int targetW, int targetH) {
+  int div = 1;
+  while (div < 8 && srcW / (div * 2) >= targetW && srcH / (div * 2) >= targetH) {
+    div *= 2;
+  }
+  return div;
+}
+
+constexpr PhotoFitMode kPhotoFitMode = PhotoFitMode::Fit;
+
+// Decode a compressed asset onto gfx in stripes of rows. When gfx is the back
+// framebuffer, rows are decoded straight into it with no staging copy.
+bool drawCompressedImage(LovyanGFX& gfx, const CompressedImage& image, int x, int y) {
+  AssetDecoder decoder(image);
+  M5Canvas* back = g_frameBuffers[g_backIndex];
+  if (back && &gfx == (LovyanGFX*)back && x >= 0 && y >= 0 &&
+      x + image.width <= back->width() && y + image.height <= back->height()) {
+    uint16_t* dst = (uint16_t*)back->getBuffer() + y * back->width() + x;
+    for (int row = 0; row < image.height; ++row, dst += back->width()) {
+      if (!decoder.read(dst, image.width)) return false;
+    }
+    return true;
+  }
+
+  static uint16_t stripe[4096];
+  int rows = max(1, (int)(sizeof(stripe) / 2) / image.width);
+  bool ok = true;
+  gfx.startWrite();
+  for (int row = 0; ok && row < image.height; row += rows) {
+    int n = min(rows, image.height - row);
+    ok = decoder.read(stripe, n * image.width);
+    if (ok) gfx.pushImage(x, y + row, image.width, n, (const lgfx::swap565_t*)stripe);
+  }
+  gfx.endWrite();
+  return ok;
+}
+
+void paintWelcome(LovyanGFX& gfx, int x, int y, int w, int h) {
+  gfx.setTextColor(TFT_WHITE);
+
+  // Large centered app name - use smooth FreeSans font
+  gfx.setFont(&fonts::FreeSans24pt7b);
+  gfx.setTextSize(1);  // No scaling for smooth font
+  gfx.setTextDatum(MC_DATUM);
+  gfx.drawString(kAppName, w / 2, h / 2 - 50);
+  
+  // Chinese subtitle centered
+  gfx.setFont(&fonts::efontTW_24);
+  gfx.setTextSize(1.5);  // Slightly larger than normal
+  gfx.drawString("有趣的ESP32之旅", w / 2, h / 2 + 10);
+  gfx.setFont(&fonts::Font0);
+
+  // Left-aligned version info - larger text
+  gfx.setTextDatum(TL_DATUM);
+  gfx.setTextSize(2);
+  gfx.setCursor(20, h / 2 + 50);
+  gfx.print("Version: ");
+  gfx.println(kAppVersion);
+  gfx.setCursor(20, h / 2 + 75);
+  gfx.print("Author: ");
+  gfx.println(kAuthor);
+  gfx.setCursor(20, h / 2 + 100);
+  gfx.print("Build: ");
+  gfx.print(__DATE__);
+  gfx.print(" ");
+  gfx.println(__TIME__);
+  
+  // Show SD card status
+  gfx.setCursor(20, h / 2 + 125);
+  gfx.print("SD Card: ");
+  if (g_sdMounted) {
+    gfx.setTextColor(TFT_GREEN);
+    gfx.println("OK");
+    gfx.setTextColor(TFT_WHITE);
+  } else {
+    gfx.setTextColor(TFT_RED);
+    gfx.println("Not Found");
+    gfx.setTextColor(TFT_WHITE);
+  }
+
+  int qrSize = 140;
+  int logoX = 150;
+  int logoY = 150;
+  int qrX = w - qrSize - 20;
+  int qrY = h - qrSize - 20;
+
+  // Draw logo
+  drawCompressedImage(gfx, kAssets[kAssetLogo], logoX, logoY);
+
+  // Draw QR code
+  drawQRCode(gfx, kGithubUrl, qrX, qrY, qrSize);
+  gfx.setCursor(qrX, qrY - 14);
+  gfx.print("GitHub");
+}
+
+// Dashboard icons decoded once and kept scaled in PSRAM. Pixels are the icon
+// composited over black (sprite byte order), so on the black dashboard a
+// redraw is a plain blit; alpha keeps the coverage for other backgrounds.
+struct IconTile {
+  uint32_t key;     // 0 until the icon has been loaded (or failed to load)
+  int w;
+  int h;
+  uint16_t* pixels;
+  uint8_t* alpha;
+};
+IconTile g_iconTiles[kIconCount];
+
+void releaseIconTile(IconTile& tile) {
+  heap_caps_free(tile.pixels);
+  tile = {};
+}
+
+// One PSRAM block per tile: w*h RGB565 pixels followed by w*h alpha bytes,
+// the same layout as a format 1 tile in the asset pack
+bool allocIconTile(IconTile& tile, int w, int h) {
+  tile.pixels = (uint16_t*)heap_caps_malloc((size_t)w * h * 3, MALLOC_CAP_SPIRAM);
+  if (!tile.pixels) return false;
+  tile.alpha = (uint8_t*)(tile.pixels + w * h);
+  tile.w = w;
+  tile.h = h;
+  return true;
+}
+
+// SD asset pack written by tools/build_assets.py --pack: pre-decoded tiles
+// behind an offset table. The file is opened once at boot and the table kept
+// in RAM, so each asset costs one seek and one contiguous read.
+const char* kAssetPackPath = "/M5Stack-Tab-5-Adventure/assets.pack";
+constexpr uint32_t kAssetPackMagic = 0x314B5041;  // "APK1"
+
+enum AssetPackFormat : uint8_t {
+  kPackRgb565 = 0,       // RGB565, panel byte order
+  kPackRgb565Alpha = 1,  // RGB565 composited on black, then an alpha plane
+};
+
+struct AssetPackHeader {
+  uint32_t magic;
+  uint32_t count;
+  uint32_t reserved[2];
+};
+
+struct __attribute__((packed)) AssetPackEntry {
+  uint32_t nameHash;  // FNV-1a of the asset name, e.g. "icon-1"
+  uint16_t width;
+  uint16_t height;
+  uint8_t format;
+  uint8_t reserved[3];
+  uint32_t offset;    // Sector aligned
+  uint32_t size;
+};
+
+File g_assetPack;
+AssetPackEntry* g_assetPackEntries = nullptr;
+uint32_t g_assetPackCount = 0;
+
+void openAssetPack() {
+  if (!g_sdMounted) return;
+  g_assetPack = SD_MMC.open(kAssetPackPath);
+  if (!g_assetPack) return;
+  AssetPackHeader header;
+  if (g_assetPack.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+      header.magic == kAssetPackMagic && header.count > 0 && header.count <= 1024) {
+    size_t tableBytes = header.count * sizeof(AssetPackEntry);
+    g_assetPackEntries = (AssetPackEntry*)malloc(tableBytes);
+    if (g_assetPackEntries && g_assetPack.read((uint8_t*)g_assetPackEntries, tableBytes) == tableBytes) {
+      g_assetPackCount = header.count;
+      return;
+    }
+  }
+  free(g_assetPackEntries);
+  g_assetPackEntries = nullptr;
+  g_assetPack.close();
+}
+
+const AssetPackEntry* findPackAsset(const char* name) {
+  uint32_t hash = 2166136261u;
+  for (const char* p = name; *p; ++p) {
+    hash = (hash ^ (uint8_t)*p) * 16777619u;
+  }
+  for (uint32_t i = 0; i < g_assetPackCount; ++i) {
+    if (g_assetPackEntries[i].nameHash == hash) return &g_assetPackEntries[i];
+  }
+  return nullptr;
+}
+
+bool readPackAsset(const AssetPackEntry& entry, void* dst) {
+  return g_assetPack.seek(entry.offset) &&
+         g_assetPack.read((uint8_t*)dst, entry.size) == entry.size;
+}
+
+const AssetPackEntry* findPackIcon(int index) {
+  char name[16];
+  snprintf(name, sizeof(name), "icon-%d", index + 1);
+  return findPackAsset(name);
+}
+
+// Identifies an icon's source at a given on-screen size: its asset pack entry,
+// else the size and mtime of its PNG on SD (zero when only the compiled-in
+// icon is left), so a replaced icon file is reloaded on the next visit. The
+// pack itself is read at boot, so its changes need a restart.
+uint32_t iconTileKey(int index) {
+  uint32_t words[3] = {(uint32_t)kIconDisplaySize, 0, 0};
+  const AssetPackEntry* entry = findPackIcon(index);
+  if (entry) {
+    words[1] = entry->offset;
+    words[2] = entry->size;
+  } else if (g_sdMounted) {
+    char vfsPath[96];
+    snprintf(vfsPath, sizeof(vfsPath), "%s%s", kSdMountPoint, getIconPath(index));
+    struct stat info;
+    if (stat(vfsPath, &info) == 0) {
+      words[1] = info.st_size;
+      words[2] = info.st_mtime;
+    }
+  }
+  uint32_t hash = 2166136261u;
+  for (const char* p = getIconPath(index); *p; ++p) {
+    hash = (hash ^ (uint8_t)*p) * 16777619u;
+  }
+  const uint8_t* bytes = (const uint8_t*)words;
+  for (size_t i = 0; i < sizeof(words); ++i) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash | 1;
+}
+
+// Load icon `index` from the asset pack as-is: no decoding or scaling
+bool loadPackIconTile(int index, IconTile& tile) {
+  const AssetPackEntry* entry = findPackIcon(index);
+  if (!entry || entry->width == 0 || entry->height == 0) return false;
+  size_t pixels = (size_t)entry->width * entry->height;
+  bool hasAlpha = entry->format == kPackRgb565Alpha;
+  if ((!hasAlpha && entry->format != kPackRgb565) || entry->size != pixels * (hasAlpha ? 3 : 2)) {
+    return false;
+  }
+  if (!allocIconTile(tile, entry->width, entry->height)) return false;
+  if (!readPackAsset(*entry, tile.pixels)) {
+    releaseIconTile(tile);
+    return false;
+  }
+  if (!hasAlpha) memset(tile.alpha, 255, pixels);
+  return true;
+}
+
+// Decode icon PNG `index` onto black and onto white, scale both to fit
+// kIconDisplaySize and recover alpha from the difference between them
+bool loadSdIconTile(int index, IconTile& tile) {
+  if (!g_sdMounted) return false;
+
+  File file = SD_MMC.open(getIconPath(index));
+  int srcW, srcH;
+  if (!file || !readPngSize(file, srcW, srcH)) return false;
+
+  // Oversized PNGs are scaled down by the decoder to fit the decode canvas
+  float decodeScale = min(1.0f, (float)kIconDecodeSize / max(srcW, srcH));
+  int decW = max(1, (int)(srcW * decodeScale));
+  int decH = max(1, (int)(srcH * decodeScale));
+  float scale = min((float)kIconDisplaySize / decW, (float)kIconDisplaySize / decH);
+  int w = max(1, (int)(decW * scale));
+  int h = max(1, (int)(decH * scale));
+
+  bool ok = allocIconTile(tile, w, h);
+  M5Canvas* decoded = borrowCanvas(decW, decH);
+  M5Canvas* white = borrowCanvas(w, h);
+  ok = ok && decoded && white && g_imageStream.open(file);
+  ResampleCrop crop = {0, 0, decW, decH};
+  if (ok) {
+    decoded->fillScreen(TFT_BLACK);
+    ok = decoded->drawPng(&g_imageStream, 0, 0, decW, decH, 0, 0, decodeScale, decodeScale);
+  }
+  ok = ok && resampleRgb565((const uint16_t*)decoded->getBuffer(), decW, decH, 1, crop, tile.pixels, w, h);
+  if (ok) {
+    decoded->fillScreen(TFT_WHITE);
+    ok = g_imageStream.seek(0) &&
+         decoded->drawPng(&g_imageStream, 0, 0, decW, decH, 0, 0, decodeScale, decodeScale);
+  }
+  uint16_t* onWhite = white ? (uint16_t*)white->getBuffer() : nullptr;
+  ok = ok && resampleRgb565((const uint16_t*)decoded->getBuffer(), decW, decH, 1, crop, onWhite, w, h);
+  if (ok) {
+    // Over black a pixel is c*a, over white c*a + (1-a): the gap is 1-a
+    for (int i = 0; i < w * h; ++i) {
+      int gapG = ((__builtin_bswap16(onWhite[i]) >> 5) & 0x3F) - ((__builtin_bswap16(tile.pixels[i]) >> 5) & 0x3F);
+      tile.alpha[i] = (63 - constrain(gapG, 0, 63)) * 255 / 63;
+    }
+  }
+  g_imageStream.close();
+  returnCanvas(white);
+  returnCanvas(decoded);
+  if (!ok) releaseIconTile(tile);
+  return ok;
+}
+
+// Upscale a compiled-in icon (pre-scaled on black by tools/build_assets.py) by the
+// largest whole ratio that fits kIconDisplaySize; replication needs no filtering
+bool loadBuiltinIconTile(int index, IconTile& tile) {
+  const CompressedImage& icon = kAssets[kAssetIcon1 + index];
+  int ratio = max(1, kIconDisplaySize / max(icon.width, icon.height));
+  int w = icon.width * ratio;
+  int h = icon.height * ratio;
+  if (!allocIconTile(tile, w, h)) return false;
+  AssetDecoder decoder(icon);
+  for (int sy = 0; sy < icon.height; ++sy) {
+    uint16_t* row = tile.pixels + sy * ratio * w;
+    // Decode into the tail of the row, then spread it out in place from the left
+    uint16_t* src = row + w - icon.width;
+    if (!decoder.read(src, icon.width)) {
+      releaseIconTile(tile);
+      return false;
+    }
+    for (int sx = 0; sx < icon.width; ++sx) {
+      uint16_t c = src[sx];
+      for (int r = 0; r < ratio; ++r) row[sx * ratio + r] = c;
+    }
+    for (int r = 1; r < ratio; ++r) memcpy(row + r * w, row, w * 2);
+  }
+  memset(tile.alpha, 255, w * h);
+  return true;
+}
+
+// Icon asset lookup: the SD asset pack, then the SD PNG, then the compiled-in icon.
+// The result is cached under the key either way, including a failure.
+bool loadIconTile(int index, IconTile& tile, uint32_t key) {
+  releaseIconTile(tile);
+  bool ok = loadPackIconTile(index, tile) || loadSdIconTile(index, tile) ||
+            loadBuiltinIconTile(index, tile);
+  tile.key = key;
+  return ok;
+}
+
+// Draw a tile centred at (cx, cy) over a solid background colour
+void drawIconTile(LovyanGFX& gfx, const IconTile& tile, int cx, int cy, uint16_t background) {
+  int x = cx - tile.w / 2;
+  int y = cy - tile.h / 2;
+  if (background == TFT_BLACK) {
+    gfx.pushImage(x, y, tile.w, tile.h, (const lgfx::swap565_t*)tile.pixels);
+    return;
+  }
+  // Premultiplied over black, so out = pixel + background * (1 - a)
+  uint16_t row[kIconDisplaySize];
+  uint32_t bg = spreadRgb565(background);
+  for (int ty = 0; ty < tile.h; ++ty) {
+    const uint16_t* src = tile.pixels + ty * tile.w;
+    const uint8_t* alpha = tile.alpha + ty * tile.w;
+    for (int tx = 0; tx < tile.w; ++tx) {
+      uint32_t inv = (255 - alpha[tx] + 4) >> 3;  // 0..32
+      uint32_t sum = spreadRgb565(__builtin_bswap16(src[tx])) + (((bg * inv) >> 5) & 0x07E0F81F);
+      row[tx] = __builtin_bswap16(packRgb565(sum));
+    }
+    gfx.pushImage(x, y + ty, tile.w, 1, (const lgfx::swap565_t*)row);
+  }
+}
+
+// An icon tile centred in the widget's bounds
+class IconImage : public Widget {
+ public:
+  void setTile(const IconTile* tile) {
+    _tile = tile;
+    invalidate();
+  }
+
+ protected:
+  void draw(LovyanGFX& gfx) override {
+    if (_tile && _tile->pixels) drawIconTile(gfx, *_tile, _x + _w / 2, _y + _h / 2, TFT_BLACK);
+  }
+
+ private:
+  const IconTile* _tile = nullptr;
+};
+
+// Scaled JPEG decoding straight through tjpgd. drawJpg() always runs the full
+// IDCT and zooms while pushing, so a 1/8 decode would cost as much as 1/1;
+// tjpgd's own scale argument (0-3) skips the IDCT work for the dropped detail.
+constexpr size_t kJpegWorkspaceSize = 8192;
+uint8_t g_jpegWorkspace[kJpegWorkspaceSize];
+
+struct JpegScaledTarget {
+  lgfx::DataWrapper* stream;
+  uint16_t* pixels;  // Sprite byte order
+  int w;
+  int h;
+  int offX;  // Output origin within the scaled image
+  int offY;
+};
+
+uint32_t jpegReadData(lgfxJdec* jdec, uint8_t* buf, uint32_t len) {
+  JpegScaledTarget* target = (JpegScaledTarget*)jdec->device;
+  if (!buf) {
+    target->stream->skip(len);
+    return len;
+  }
+  int n = target->stream->read(buf, len);
+  return n > 0 ? n : 0;
+}
+
+// Copies one decoded RGB888 block into the output window, clipped
+uint32_t jpegWriteBlock(lgfxJdec* jdec, void* bitmap, lgfxJrect* rect) {
+  JpegScaledTarget* target = (JpegScaledTarget*)jdec->device;
+  int blockW = rect->right - rect->left + 1;
+  int x0 = max<int>(rect->left, target->offX);
+  int x1 = min<int>(rect->right + 1, target->offX + target->w);
+  int y0 = max<int>(rect->top, target->offY);
+  int y1 = min<int>(rect->bottom + 1, target->offY + target->h);
+  for (int y = y0; y < y1; ++y) {
+    const uint8_t* src = (const uint8_t*)bitmap + ((y - rect->top) * blockW + x0 - rect->left) * 3;
+    uint16_t* dst = target->pixels + (y - target->offY) * target->w + x0 - target->offX;
+    for (int x = x0; x < x1; ++x, src += 3) {
+      uint16_t c = ((src[0] & 0xF8) << 8) | ((src[1] & 0xFC) << 3) | (src[2] >> 3);
+      *dst++ = __builtin_bswap16(c);
+    }
+  }
+  // Stop after the block holding the window's bottom-right corner
+  return rect->bottom + 1 < target->offY + target->h || rect->right + 1 < target->offX + target->w;
+}
+
+// Decode the JPEG at 1/div (div = 1, 2, 4 or 8) into out, which receives the
+// out.width() x out.height() window at (offX, offY) of the scaled image
+bool decodeJpegScaled(lgfx::DataWrapper& stream, int div, int offX, int offY, M5Canvas& out) {
+  uint8_t scale = 0;
+  while ((1 << scale) < div && scale < 3) ++scale;
+  JpegScaledTarget target = {&stream, (uint16_t*)out.getBuffer(), (int)out.width(),
+                             (int)out.height(), offX, offY};
+  lgfxJdec jdec;
+  if (lgfx_jd_prepare(&jdec, jpegReadData, g_jpegWorkspace, kJpegWorkspaceSize, &target) != 0) {
+    return false;
+  }
+  auto res = lgfx_jd_decomp(&jdec, jpegWriteBlock, scale);
+  // JDR_INTR is the early stop above
+  return res == 0 || res == JDR_INTR;
+}
+
+// Decode a photo scaled for the panel according to kPhotoFitMode.
+// JPEGs are decoded at the smallest IDCT scale that still covers the scaled
+// size, then resampled; decode memory follows the output size, not the source.
+bool decodePhotoForDisplay(SdStreamReader& stream, int srcW, int srcH, bool isPng,
+                           uint8_t orientation, M5Canvas& out) {
+  // EXIF orientations 5-8 swap the axes of the upright image
+  bool swapAxes = orientation >= 5 && orientation <= 8;
+  int uprightW = swapAxes ? srcH : srcW;
+  int uprightH = swapAxes ? srcW : srcH;
+
+  PhotoFit fit = fitPhoto(uprightW, uprightH, M5.Display.width(), M5.Display.height(), kPhotoFitMode);
+  int outW = fit.outW;
+  int outH = fit.outH;
+  if (!resizeCanvas(out, outW, outH)) return false;
+
+  if (isPng) {
+    // PNG has no IDCT scaling or EXIF; let the decoder scale and crop
+    return out.drawPng(&stream, 0, 0, outW, outH, (fit.scaledW - outW) / 2, (fit.scaledH - outH) / 2,
+                       fit.scale, fit.scale);
+  }
+
+  int div = pickJpegScaleDiv(srcW, srcH, swapAxes ? fit.scaledH : fit.scaledW,
+                             swapAxes ? fit.scaledW : fit.scaledH);
+  int decW = (srcW + div - 1) / div;
+  int decH = (srcH + div - 1) / div;
+
+  // Visible window in upright decoded pixels
+  ResampleCrop crop = fitCrop(fit, swapAxes ? decH : decW, swapAxes ? decW : decH);
+
+  if (orientation <= 1 && crop.w == outW && crop.h == outH) {
+    // The decoder output is already the right size: decode only the window
+    return decodeJpegScaled(stream, div, crop.x, crop.y, out);
+  }
+
+  M5Canvas* decoded = borrowCanvas(decW, decH);
+  if (!decoded) return false;
+  bool ok = decodeJpegScaled(stream, div, 0, 0, *decoded) &&
+            resampleRgb565((const uint16_t*)decoded->getBuffer(), decW, decH, orientation, crop,
+                           (uint16_t*)out.getBuffer(), outW, outH);
+  returnCanvas(decoded);
+  return ok;
+}
+
+// EXIF metadata from the JPEG APP1 segment. Only the first kExifReadBytes of
+// the file are read, which covers the IFD tables of camera JPEGs; the
+// embedded thumbnail itself is only located, not read.
+constexpr size_t kExifReadBytes = 8192;
+
+struct ExifReader {
+  const uint8_t* data;
+  size_t len;
+  size_t tiff;  // Offset of the TIFF header; IFD offsets are relative to it
+  bool bigEndian;
+
+  uint16_t get16(size_t pos) const {
+    if (pos + 2 > len) return 0;
+    return bigEndian ? (data[pos] << 8) | data[pos + 1] : data[pos] | (data[pos + 1] << 8);
+  }
+
+  uint32_t get32(size_t pos) const {
+    if (pos + 4 > len) return 0;
+    return bigEndian ? ((uint32_t)get16(pos) << 16) | get16(pos + 2)
+                     : get16(pos) | ((uint32_t)get16(pos + 2) << 16);
+  }
+
+  // Returns the offset of the 12-byte entry for `tag` in the IFD, or 0
+  size_t findTag(uint32_t ifd, uint16_t tag) const {
+    if (ifd == 0) return 0;
+    size_t pos = tiff + ifd;
+    uint16_t count = get16(pos);
+    for (uint16_t i = 0; i < count; ++i) {
+      size_t entry = pos + 2 + i * 12;
+      if (entry + 12 > len) return 0;
+      if (get16(entry) == tag) return entry;
+    }
+    return 0;
+  }
+
+  uint32_t nextIfd(uint32_t ifd) const {
+    return ifd ? get32(tiff + ifd + 2 + get16(tiff + ifd) * 12) : 0;
+  }
+};
+
+// Fill orientation, capture date/time and thumbnail location from EXIF.
+// The capture date from the filename is kept when there is no DateTimeOriginal.
+void readExifInfo(File& file, PhotoEntry& entry) {
+  entry.orientation = 1;
+  entry.thumbOffset = 0;
+  entry.thumbLength = 0;
+
+  uint8_t* buf = (uint8_t*)malloc(kExifReadBytes);
+  if (!buf) return;
+  size_t len = file.seek(0) ? file.read(buf, kExifReadBytes) : 0;
+
+  // Find APP1 "Exif\0\0" among the leading APPn segments
+  size_t pos = 2;
+  size_t tiff = 0;
+  while (len >= 4 && buf[0] == 0xFF && buf[1] == 0xD8 && pos + 10 <= len && buf[pos] == 0xFF) {
+    uint8_t marker = buf[pos + 1];
+    size_t segLen = (buf[pos + 2] << 8) | buf[pos + 3];
+    if (marker == 0xE1 && memcmp(buf + pos + 4, "Exif\0\0", 6) == 0) {
+      tiff = pos + 10;
+      break;
+    }
+    if (marker < 0xE0 || marker > 0xEF) break;  // Past the APPn segments
+    pos += 2 + segLen;
+  }
+
+  if (tiff && tiff + 8 <= len && (buf[tiff] == 'I' || buf[tiff] == 'M')) {
+    ExifReader exif = {buf, len, tiff, buf[tiff] == 'M'};
+    uint32_t ifd0 = exif.get32(tiff + 4);
+
+    size_t tag = exif.findTag(ifd0, 0x0112);  // Orientation
+    if (tag) {
+      uint16_t orientation = exif.get16(tag + 8);
+      if (orientation >= 1 && orientation <= 8) entry.orientation = orientation;
+    }
+
+    tag = exif.findTag(ifd0, 0x8769);  // Exif sub-IFD
+    if (tag) {
+      size_t date = exif.findTag(exif.get32(tag + 8), 0x9003);  // DateTimeOriginal
+      size_t text = date ? tiff + exif.get32(date + 8) : 0;
+      // "YYYY:MM:DD HH:MM:SS"
+      if (text && text + 19 <= len && buf[text + 4] == ':' && buf[text + 10] == ' ') {
+        const char* t = (const char*)buf + text;
+        auto num = [t](int at, int digits) {
+          uint32_t v = 0;
+          for (int i = 0; i < digits; ++i) v = v * 10 + (t[at + i] - '0');
+          return v;
+        };
+        entry.captureDate = num(0, 4) * 10000 + num(5, 2) * 100 + num(8, 2);
+        entry.captureTime = num(11, 2) * 10000 + num(14, 2) * 100 + num(17, 2);
+      }
+    }
+
+    uint32_t ifd1 = exif.nextIfd(ifd0);  // Thumbnail IFD
+    size_t thumbTag = exif.findTag(ifd1, 0x0201);
+    size_t lengthTag = exif.findTag(ifd1, 0x0202);
+    if (thumbTag && lengthTag) {
+      entry.thumbOffset = tiff + exif.get32(thumbTag + 8);
+      entry.thumbLength = exif.get32(lengthTag + 8);
+    }
+  }
+  free(buf);
+}
+
+// Photo cache: each photo pre-scaled to the panel and stored as raw sprite
+// pixels under photo-frame/.cache, so showing it is one sequential read.
+const char* kPhotoCacheDir = "/M5Stack-Tab-5-Adventure/photo-frame/.cache";
+const char* kPhotoCacheIndexPath = "/M5Stack-Tab-5-Adventure/photo-frame/.cache/lru.bin";
+constexpr uint32_t kPhotoCacheMaxBytes = 64UL * 1024 * 1024;
+constexpr uint32_t kPhotoCacheMagic = 0x37363550;  // "P567": oriented, with fit mode
+constexpr uint32_t kPhotoCacheIndexMagic = 0x31494350;  // "PCI1"
+
+struct PhotoCacheHeader {
+  uint32_t magic;
+  uint16_t width;
+  uint16_t height;
+  uint16_t panelWidth;
+  uint16_t panelHeight;
+  uint16_t fitMode;
+  uint16_t reserved;
+};
+
+struct PhotoCacheEntry {
+  uint32_t key;
+  uint32_t bytes;
+  uint32_t lastUse;
+};
+
+PhotoCacheEntry* g_cacheEntries = nullptr;
+int g_cacheEntryCount = 0;
+int g_cacheEntryCapacity = 0;
+uint32_t g_cacheBytes = 0;
+uint32_t g_cacheClock = 0;
+bool g_cacheIndexLoaded = false;
+bool g_cacheIndexDirty = false;  // lastUse bumped since lru.bin was written
+uint32_t g_cacheIndexSavedAt = 0;
+constexpr uint32_t kPhotoCacheSaveInterval = 10 * 60 * 1000;
+int g_cacheFillCursor = 0;
+bool g_cacheFillComplete = false;  // Pre-fill pass done; reset by loadPhotoList()
+
+// Keys the pre-fill gave up on (decode failed, or too large to cache)
+uint32_t* g_cacheSkipKeys = nullptr;
+int g_cacheSkipCount = 0;
+int g_cacheSkipCapacity = 0;
+
+// FNV-1a over file name, size and modification time
+uint32_t photoCacheKey(const PhotoEntry& photo) {
+  uint32_t hash = 2166136261u;
+  for (const char* p = g_photoNames + photo.nameOffset; *p; ++p) {
+    hash = (hash ^ (uint8_t)*p) * 16777619u;
+  }
+  uint32_t words[2] = {photo.size, photo.mtime};
+  const uint8_t* bytes = (const uint8_t*)words;
+  for (size_t i = 0; i < sizeof(words); ++i) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+char g_cachePath[80];
+const char* getPhotoCachePath(uint32_t key) {
+  snprintf(g_cachePath, sizeof(g_cachePath), "%s/%08lx.565", kPhotoCacheDir, (unsigned long)key);
+  return g_cachePath;
+}
+
+int findPhotoCacheEntry(uint32_t key) {
+  for (int i = 0; i < g_cacheEntryCount; ++i) {
+    if (g_cacheEntries[i].key == key) return i;
+  }
+  return -1;
+}
+
+bool addPhotoCacheEntry(const PhotoCacheEntry& entry) {
+  if (g_cacheEntryCount == g_cacheEntryCapacity) {
+    int capacity = g_cacheEntryCapacity ? g_cacheEntryCapacity * 2 : 64;
+    void* grown = realloc(g_cacheEntries, capacity * sizeof(PhotoCacheEntry));
+    if (!grown) return false;
+    g_cacheEntries = (PhotoCacheEntry*)grown;
+    g_cacheEntryCapacity = capacity;
+  }
+  g_cacheEntries[g_cacheEntryCount++] = entry;
+  g_cacheBytes += entry.bytes;
+  return true;
+}
+
+void removePhotoCacheEntry(int i) {
+  g_cacheBytes -= g_cacheEntries[i].bytes;
+  g_cacheEntries[i] = g_cacheEntries[--g_cacheEntryCount];
+}
+
+void loadPhotoCacheIndex() {
+  if (g_cacheIndexLoaded || !g_sdMounted) return;
+  g_cacheIndexLoaded = true;
+  g_cacheEntryCount = 0;
+  g_cacheBytes = 0;
+  if (!SD_MMC.exists(kPhotoCacheDir)) {
+    SD_MMC.mkdir(kPhotoCacheDir);
+    return;
+  }
+
+  File file = SD_MMC.open(kPhotoCacheIndexPath);
+  if (!file) return;
+  uint32_t header[3];
+  if (file.read((uint8_t*)header, sizeof(header)) == sizeof(header) && header[0] == kPhotoCacheIndexMagic) {
+    g_cacheClock = header[2];
+    PhotoCacheEntry entry;
+    for (uint32_t i = 0; i < header[1]; ++i) {
+      if (file.read((uint8_t*)&entry, sizeof(entry)) != sizeof(entry)) break;
+      addPhotoCacheEntry(entry);
+    }
+  }
+  file.close();
+}
+
+void savePhotoCacheIndex() {
+  File file = SD_MMC.open(kPhotoCacheIndexPath, FILE_WRITE);
+  if (!file) return;
+  uint32_t header[3] = {kPhotoCacheIndexMagic, (uint32_t)g_cacheEntryCount, g_cacheClock};
+  file.write((const uint8_t*)header, sizeof(header));
+  file.write((const uint8_t*)g_cacheEntries, g_cacheEntryCount * sizeof(PhotoCacheEntry));
+  file.close();
+  g_cacheIndexDirty = false;
+  g_cacheIndexSavedAt = millis();
+}
+
+// Write lru.bin if cache hits have reordered it since the last save
+void flushPhotoCacheIndex() {
+  if (g_cacheIndexDirty && g_sdMounted) savePhotoCacheIndex();
+}
+
+bool isPhotoCacheSkipped(uint32_t key) {
+  for (int i = 0; i < g_cacheSkipCount; ++i) {
+    if (g_cacheSkipKeys[i] == key) return true;
+  }
+  return false;
+}
+
+void skipPhotoCacheKey(uint32_t key) {
+  if (g_cacheSkipCount == g_cacheSkipCapacity) {
+    int capacity = g_cacheSkipCapacity ? g_cacheSkipCapacity * 2 : 16;
+    void* grown = realloc(g_cacheSkipKeys, capacity * sizeof(uint32_t));
+    if (!grown) return;
+    g_cacheSkipKeys = (uint32_t*)grown;
+    g_cacheSkipCapacity = capacity;
+  }
+  g_cacheSkipKeys[g_cacheSkipCount++] = key;
+}
+
+// Drop least recently used entries until `incoming` more bytes fit under the cap
+void evictPhotoCache(uint32_t incoming) {
+  while (g_cacheEntryCount > 0 && g_cacheBytes + incoming > kPhotoCacheMaxBytes) {
+    int oldest = 0;
+    for (int i = 1; i < g_cacheEntryCount; ++i) {
+      if (g_cacheEntries[i].lastUse < g_cacheEntries[oldest].lastUse) oldest = i;
+    }
+    SD_MMC.remove(getPhotoCachePath(g_cacheEntries[oldest].key));
+    removePhotoCacheEntry(oldest);
+  }
+}
+
+bool readCachedPhoto(uint32_t key, M5Canvas& out) {
+  int entry = findPhotoCacheEntry(key);
+  if (entry < 0) return false;
+
+  File file = SD_MMC.open(getPhotoCachePath(key));
+  PhotoCacheHeader header;
+  bool ok = file && file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+            header.magic == kPhotoCacheMagic &&
+            header.panelWidth == M5.Display.width() && header.panelHeight == M5.Display.height() &&
+            header.fitMode == (uint16_t)kPhotoFitMode;
+  if (ok) {
+    size_t bytes = (size_t)header.width * header.height * 2;
+    ok = resizeCanvas(out, header.width, header.height) &&
+         file.read((uint8_t*)out.getBuffer(), bytes) == bytes;
+  }
+  if (file) file.close();
+
+  if (ok) {
+    g_cacheEntries[entry].lastUse = ++g_cacheClock;
+    g_cacheIndexDirty = true;
+  } else {
+    // Stale or unreadable: forget it so the next fill pass rebuilds it
+    SD_MMC.remove(getPhotoCachePath(key));
+    removePhotoCacheEntry(entry);
   }
-  M5.Display.drawString(header, M5.Display.width() / 2, 10);
-  
-  // Day names
-  const char* dayNames[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
-  
-  // Draw 7 horizontal blocks for the week
-  int w = M5.Display.width();
-  int headerHeight = 50;
-  int footerHeight = 25;
-  int availableHeight = M5.Display.height() - headerHeight - footerHeight;
-  int cellH = availableHeight / 7;
-  int gridStartY = headerHeight;
-  
-  for (int dow = 0; dow < 7; dow++) {
-    int dayYear = startYear;
-    int dayMonth = startMonth;
-    int dayDay = startDay;
-    advanceDate(dayYear, dayMonth, dayDay, dow);
-    
-    int y = gridStartY + (dow * cellH);
-    
-    // Highlight today
-    bool isToday = (dayYear == 2026 && dayMonth == 2 && dayDay == 9);
-    if (isToday) {
-      M5.Display.fillRect(2, y + 2, w - 4, cellH - 4, TFT_DARKGREY);
+  return ok;
+}
+
+// Store a decoded photo. Without `evict` it is only stored if it fits as is.
+bool writeCachedPhoto(uint32_t key, M5Canvas& canvas, bool evict) {
+  uint32_t bytes = sizeof(PhotoCacheHeader) + canvas.width() * canvas.height() * 2;
+  if (bytes > kPhotoCacheMaxBytes) return false;
+  if (evict) evictPhotoCache(bytes);
+  if (g_cacheBytes + bytes > kPhotoCacheMaxBytes) return false;
+
+  File file = SD_MMC.open(getPhotoCachePath(key), FILE_WRITE);
+  if (!file) return false;
+  PhotoCacheHeader header = {kPhotoCacheMagic, (uint16_t)canvas.width(), (uint16_t)canvas.height(),
+                             (uint16_t)M5.Display.width(), (uint16_t)M5.Display.height(),
+                             (uint16_t)kPhotoFitMode, 0};
+  bool ok = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+  ok = ok && file.write((const uint8_t*)canvas.getBuffer(), bytes - sizeof(header)) == bytes - sizeof(header);
+  file.close();
+
+  if (!ok) {
+    SD_MMC.remove(getPhotoCachePath(key));
+    return false;
+  }
+  addPhotoCacheEntry({key, bytes, ++g_cacheClock});
+  savePhotoCacheIndex();
+  return true;
+}
+
+// Stream a photo file from SD and decode it to fit the display
+bool decodePhotoFile(File& file, const char* path, uint8_t orientation, M5Canvas& out) {
+  String lowerPath = path;
+  lowerPath.toLowerCase();
+  bool isPng = lowerPath.endsWith(".png");
+
+  int srcW = 0, srcH = 0;
+  bool known = isPng ? readPngSize(file, srcW, srcH) : readJpegSize(file, srcW, srcH);
+  if (!known || !g_imageStream.open(file)) return false;
+
+  bool ok = decodePhotoForDisplay(g_imageStream, srcW, srcH, isPng, orientation, out);
+  g_imageStream.close();
+  return ok;
+}
+
+// Load a photo scaled to the display, from the cache or by decoding and caching it
+bool loadPhoto(int index, M5Canvas& out) {
+  uint32_t key = photoCacheKey(g_photos[index]);
+  if (readCachedPhoto(key, out)) return true;
+
+  const char* photoPath = getPhotoPath(index);
+  File file = SD_MMC.open(photoPath);
+  if (!file) return false;
+  bool ok = decodePhotoFile(file, photoPath, g_photos[index].orientation, out);
+  if (ok) {
+    writeCachedPhoto(key, out, true);
+  }
+  file.close();
+  return ok;
+}
+
+// Clear only the bars around a centred image, not the area it will cover
+void clearLetterbox(LovyanGFX& gfx, int x, int y, int w, int h) {
+  if (y > 0) gfx.fillRect(0, 0, gfx.width(), y, TFT_BLACK);
+  if (y + h < gfx.height()) gfx.fillRect(0, y + h, gfx.width(), gfx.height() - y - h, TFT_BLACK);
+  if (x > 0) gfx.fillRect(0, y, x, h, TFT_BLACK);
+  if (x + w < gfx.width()) gfx.fillRect(x + w, y, gfx.width() - x - w, h, TFT_BLACK);
+}
+
+// Load a photo centred on a black full-screen frame
+bool loadPhotoFrame(int index, M5Canvas& frame) {
+  M5Canvas* photo = borrowCanvas(frame.width(), frame.height());
+  if (!photo) return false;
+  bool ok = loadPhoto(index, *photo);
+  if (ok) {
+    int x = (frame.width() - photo->width()) / 2;
+    int y = (frame.height() - photo->height()) / 2;
+    clearLetterbox(frame, x, y, photo->width(), photo->height());
+    photo->pushSprite(&frame, x, y);
+  }
+  returnCanvas(photo);
+  return ok;
+}
+
+// Cache one not-yet-cached photo; called from the photo worker while the slideshow is idle.
+// One pass over the list per loadPhotoList(): the pre-fill never evicts, so it
+// stops for good once the cache is full, and photos that fail are not retried.
+void fillPhotoCacheStep() {
+  if (g_photoCount == 0 || !g_sdMounted) return;
+  if (millis() - g_cacheIndexSavedAt > kPhotoCacheSaveInterval) flushPhotoCacheIndex();
+  if (g_cacheFillComplete) return;
+  // Keep well clear of the next slideshow change
+  if (millis() - g_lastPhotoChange > kPhotoInterval / 2) return;
+
+  // A full-panel photo is the largest entry there can be
+  uint32_t worstBytes = sizeof(PhotoCacheHeader) + M5.Display.width() * M5.Display.height() * 2;
+  while (g_cacheFillCursor < g_photoCount) {
+    if (g_cacheBytes + worstBytes > kPhotoCacheMaxBytes) break;
+    int index = g_cacheFillCursor++;
+
+    uint32_t key = photoCacheKey(g_photos[index]);
+    if (findPhotoCacheEntry(key) >= 0 || isPhotoCacheSkipped(key)) continue;
+
+    const char* photoPath = getPhotoPath(index);
+    File file = SD_MMC.open(photoPath);
+    M5Canvas* canvas = file ? borrowCanvas(M5.Display.width(), M5.Display.height()) : nullptr;
+    bool cached = canvas && decodePhotoFile(file, photoPath, g_photos[index].orientation, *canvas) &&
+                  writeCachedPhoto(key, *canvas, false);
+    // A missing canvas is a transient shortage, not a property of the photo
+    if (!cached && (!file || canvas)) skipPhotoCacheKey(key);
+    returnCanvas(canvas);
+    if (file) file.close();
+    return;  // One photo per idle step
+  }
+  g_cacheFillComplete = true;
+}
+
+// On-SD photo index: header, PhotoEntry records, then the name arena.
+// It caches the parsed EXIF metadata. FAT does not bump a directory's mtime
+// when files are added, so the index is shown as stored and revalidated by a
+// background walk (see photoIndexScanStep()).
+constexpr uint32_t kPhotoIndexMagic = 0x33585049;  // "IPX3": no directory mtime
+
+struct PhotoIndexHeader {
+  uint32_t magic;
+  uint32_t count;
+  uint32_t namesBytes;
+};
+
+bool reservePhotoIndex(int count, size_t namesBytes) {
+  if (count > g_photoCapacity) {
+    int capacity = max(count, max(64, g_photoCapacity * 2));
+    void* grown = ps_realloc(g_photos, capacity * sizeof(PhotoEntry));
+    if (!grown) return false;
+    g_photos = (PhotoEntry*)grown;
+    g_photoCapacity = capacity;
+  }
+  if (namesBytes > g_photoNamesCapacity) {
+    size_t capacity = max(namesBytes, max((size_t)4096, g_photoNamesCapacity * 2));
+    void* grown = ps_realloc(g_photoNames, capacity);
+    if (!grown) return false;
+    g_photoNames = (char*)grown;
+    g_photoNamesCapacity = capacity;
+  }
+  return true;
+}
+
+bool addPhotoEntry(const char* name, PhotoEntry entry) {
+  size_t nameBytes = strlen(name) + 1;
+  if (!reservePhotoIndex(g_photoCount + 1, g_photoNamesUsed + nameBytes)) return false;
+  entry.nameOffset = g_photoNamesUsed;
+  memcpy(g_photoNames + g_photoNamesUsed, name, nameBytes);
+  g_photoNamesUsed += nameBytes;
+  g_photos[g_photoCount++] = entry;
+  return true;
+}
+
+bool isPhotoFileName(const char* name) {
+  if (name[0] == '.') return false;  // Hidden files and macOS "._" resource forks
+  const char* ext = strrchr(name, '.');
+  return ext && (strcasecmp(ext, ".jpg") == 0 || strcasecmp(ext, ".jpeg") == 0 ||
+                 strcasecmp(ext, ".png") == 0);
+}
+
+// Camera exports are named YYYYMMDD_HHMMSS-...; anything else has no date
+void parseCaptureDate(const char* name, PhotoEntry& entry) {
+  entry.captureDate = 0;
+  entry.captureTime = 0;
+  uint32_t date = 0, time = 0;
+  for (int i = 0; i < 15; ++i) {
+    if (i == 8) {
+      if (name[i] != '_') return;
+    } else if (name[i] < '0' || name[i] > '9') {
+      return;
+    } else if (i < 8) {
+      date = date * 10 + (name[i] - '0');
+    } else {
+      time = time * 10 + (name[i] - '0');
+    }
+  }
+  entry.captureDate = date;
+  entry.captureTime = time;
+}
+
+// Binary search a name-sorted index
+const PhotoEntry* findPhotoEntry(const PhotoEntry* photos, const char* names, int count, const char* name) {
+  int lo = 0, hi = count - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    int cmp = strcmp(names + photos[mid].nameOffset, name);
+    if (cmp == 0) return &photos[mid];
+    if (cmp < 0) lo = mid + 1;
+    else hi = mid - 1;
+  }
+  return nullptr;
+}
+
+// Load the stored index in one read per section
+bool readPhotoIndexFile() {
+  File file = SD_MMC.open(kPhotoIndexPath);
+  if (!file) return false;
+  PhotoIndexHeader header;
+  bool ok = file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+            header.magic == kPhotoIndexMagic &&
+            reservePhotoIndex(header.count, header.namesBytes);
+  if (ok) {
+    size_t entryBytes = header.count * sizeof(PhotoEntry);
+    ok = file.read((uint8_t*)g_photos, entryBytes) == entryBytes &&
+         file.read((uint8_t*)g_photoNames, header.namesBytes) == header.namesBytes;
+  }
+  file.close();
+  if (!ok) return false;
+  g_photoCount = header.count;
+  g_photoNamesUsed = header.namesBytes;
+  return true;
+}
+
+void writePhotoIndexFile() {
+  File file = SD_MMC.open(kPhotoIndexPath, FILE_WRITE);
+  if (!file) return;
+  PhotoIndexHeader header = {kPhotoIndexMagic, (uint32_t)g_photoCount, (uint32_t)g_photoNamesUsed};
+  file.write((const uint8_t*)&header, sizeof(header));
+  file.write((const uint8_t*)g_photos, g_photoCount * sizeof(PhotoEntry));
+  file.write((const uint8_t*)g_photoNames, g_photoNamesUsed);
+  file.close();
+}
+
+// Slideshow order: a shuffle bag over the photo index. Every photo is shown
+// once per pass, a new pass never starts with the photo just shown, and the
+// upcoming picks are known in advance so the loader can prefetch them.
+constexpr bool kFavourRecentPhotos = true;
+constexpr int kRecentPhotoDays = 60;     // Relative to the newest capture date
+constexpr float kRecentPhotoWeight = 3.0f;
+
+int* g_shuffleBag = nullptr;
+int g_shuffleBagSize = 0;
+int g_shufflePos = 0;
+int g_lastShuffledPhoto = -1;
+
+// Full-screen frames: the photo on screen, and the next photo decoded into a
+// pooled canvas while the current one shows
+M5Canvas* g_photoFrame = nullptr;
+M5Canvas* g_prefetchCanvas = nullptr;
+int g_prefetchIndex = -1;  // Last photo a prefetch was attempted for
+bool g_prefetchReady = false;
+
+// Days since 1970-01-01 for a YYYYMMDD date
+int32_t daysFromDate(uint32_t yyyymmdd) {
+  int y = yyyymmdd / 10000;
+  int m = (yyyymmdd / 100) % 100;
+  int d = yyyymmdd % 100;
+  y -= m <= 2;
+  int era = (y >= 0 ? y : y - 399) / 400;
+  int yoe = y - era * 400;
+  int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + doe - 719468;
+}
+
+void refillShuffleBag() {
+  if (g_shuffleBagSize != g_photoCount) {
+    free(g_shuffleBag);
+    g_shuffleBag = (int*)ps_malloc(g_photoCount * sizeof(int));
+    g_shuffleBagSize = g_shuffleBag ? g_photoCount : 0;
+  }
+  g_shufflePos = 0;
+  if (g_shuffleBagSize == 0) return;
+
+  for (int i = 0; i < g_shuffleBagSize; ++i) {
+    g_shuffleBag[i] = i;
+  }
+
+  uint32_t newest = 0;
+  if (kFavourRecentPhotos) {
+    for (int i = 0; i < g_photoCount; ++i) {
+      newest = max(newest, g_photos[i].captureDate);
+    }
+  }
+
+  if (newest == 0) {
+    // Fisher-Yates
+    for (int i = g_shuffleBagSize - 1; i > 0; --i) {
+      int j = random(i + 1);
+      std::swap(g_shuffleBag[i], g_shuffleBag[j]);
+    }
+  } else {
+    // Weighted shuffle: sort by exponential keys -ln(u)/w so recent photos
+    // tend to come earlier in each pass while still appearing exactly once
+    float* keys = (float*)ps_malloc(g_shuffleBagSize * sizeof(float));
+    if (!keys) return;
+    int32_t newestDay = daysFromDate(newest);
+    for (int i = 0; i < g_shuffleBagSize; ++i) {
+      uint32_t date = g_photos[i].captureDate;
+      bool recent = date != 0 && newestDay - daysFromDate(date) <= kRecentPhotoDays;
+      float u = (esp_random() + 1.0f) / 4294967297.0f;
+      keys[i] = -logf(u) / (recent ? kRecentPhotoWeight : 1.0f);
+    }
+    std::sort(g_shuffleBag, g_shuffleBag + g_shuffleBagSize,
+              [keys](int a, int b) { return keys[a] < keys[b]; });
+    free(keys);
+  }
+
+  // No back-to-back repeat across the pass boundary
+  if (g_shuffleBagSize > 1 && g_shuffleBag[0] == g_lastShuffledPhoto) {
+    std::swap(g_shuffleBag[0], g_shuffleBag[1 + random(g_shuffleBagSize - 1)]);
+  }
+}
+
+// Photo that nextShufflePhoto() will return, without consuming it
+int peekShufflePhoto() {
+  if (g_photoCount == 0) return -1;
+  if (g_shufflePos >= g_shuffleBagSize || g_shuffleBagSize != g_photoCount) {
+    refillShuffleBag();
+  }
+  return g_shufflePos < g_shuffleBagSize ? g_shuffleBag[g_shufflePos] : (int)random(g_photoCount);
+}
+
+int nextShufflePhoto() {
+  int index = peekShufflePhoto();
+  if (g_shufflePos < g_shuffleBagSize) g_shufflePos++;
+  g_lastShuffledPhoto = index;
+  return index;
+}
+
+void resetPhotoSlideshow() {
+  g_shuffleBagSize = 0;
+  g_shufflePos = 0;
+  g_lastShuffledPhoto = -1;
+  g_prefetchIndex = -1;
+  g_prefetchReady = false;
+}
+
+void releasePhotoFrames() {
+  returnCanvas(g_photoFrame);
+  returnCanvas(g_prefetchCanvas);
+  g_photoFrame = nullptr;
+  g_prefetchCanvas = nullptr;
+  g_prefetchIndex = -1;
+  g_prefetchReady = false;
+}
+
+// Revalidation of the loaded index against the directory, a few names per
+// step. Names come from getNextFileName(), which opens nothing; indexed photos
+// are checked with stat() and only new or changed files are opened for their
+// EXIF. New photos are appended as they are found (after the sorted part, so
+// indices already handed out stay valid); removals and the re-sort wait for
+// the end of the walk.
+constexpr int kPhotoScanNamesPerStep = 16;
+
+File g_photoScanDir;
+uint8_t* g_photoScanSeen = nullptr;  // Per indexed photo: found on the card, unchanged
+int g_photoScanIndexed = 0;          // Sorted prefix of g_photos the walk checks against
+bool g_photoScanChanged = false;
+
+void cancelPhotoIndexScan() {
+  if (g_photoScanDir) g_photoScanDir.close();
+  free(g_photoScanSeen);
+  g_photoScanSeen = nullptr;
+}
+
+bool startPhotoIndexScan() {
+  cancelPhotoIndexScan();
+  g_photoScanDir = SD_MMC.open(kPhotoDir);
+  g_photoScanSeen = (uint8_t*)calloc(max(g_photoCount, 1), 1);
+  if (!g_photoScanDir || !g_photoScanDir.isDirectory() || !g_photoScanSeen) {
+    cancelPhotoIndexScan();
+    return false;
+  }
+  g_photoScanIndexed = g_photoCount;
+  g_photoScanChanged = false;
+  return true;
+}
+
+// Drop indexed photos the walk did not find, re-sort, and save the index if
+// anything changed. Indices move, so the slideshow and cache fill restart.
+void finishPhotoIndexScan() {
+  bool hasCurrent = g_currentPhotoIndex >= 0 && g_currentPhotoIndex < g_photoCount;
+  uint32_t currentKey = hasCurrent ? photoCacheKey(g_photos[g_currentPhotoIndex]) : 0;
+  int kept = 0;
+  for (int i = 0; i < g_photoCount; ++i) {
+    bool found = i >= g_photoScanIndexed || g_photoScanSeen[i];
+    if (found) g_photos[kept++] = g_photos[i];
+  }
+  bool changed = g_photoScanChanged || kept != g_photoCount;
+  cancelPhotoIndexScan();
+  if (!changed) return;
+
+  g_photoCount = kept;
+  // Repack the names of the photos that are left
+  char* names = (char*)ps_malloc(max(g_photoNamesUsed, (size_t)1));
+  if (names) {
+    size_t used = 0;
+    for (int i = 0; i < g_photoCount; ++i) {
+      size_t bytes = strlen(g_photoNames + g_photos[i].nameOffset) + 1;
+      memcpy(names + used, g_photoNames + g_photos[i].nameOffset, bytes);
+      g_photos[i].nameOffset = used;
+      used += bytes;
+    }
+    free(g_photoNames);
+    g_photoNames = names;
+    g_photoNamesUsed = used;
+    g_photoNamesCapacity = max(used, (size_t)1);
+  }
+  std::sort(g_photos, g_photos + g_photoCount, [](const PhotoEntry& a, const PhotoEntry& b) {
+    return strcmp(g_photoNames + a.nameOffset, g_photoNames + b.nameOffset) < 0;
+  });
+
+  int current = -1;
+  for (int i = 0; hasCurrent && i < g_photoCount && current < 0; ++i) {
+    if (photoCacheKey(g_photos[i]) == currentKey) current = i;
+  }
+  g_currentPhotoIndex = current >= 0 ? current : min(g_currentPhotoIndex, g_photoCount - 1);
+  resetPhotoSlideshow();
+  g_cacheFillCursor = 0;
+  g_cacheFillComplete = false;
+  writePhotoIndexFile();
+}
+
+// Check up to `names` directory entries; returns false once no walk is in progress
+bool photoIndexScanStep(int names) {
+  if (!g_photoScanDir) return false;
+  for (int n = 0; n < names; ++n) {
+    bool isDir = false;
+    String path = g_photoScanDir.getNextFileName(&isDir);
+    if (path.length() == 0) {
+      finishPhotoIndexScan();
+      return true;
+    }
+    const char* slash = strrchr(path.c_str(), '/');
+    const char* name = slash ? slash + 1 : path.c_str();
+    if (isDir || !isPhotoFileName(name)) continue;
+
+    char vfsPath[320];
+    snprintf(vfsPath, sizeof(vfsPath), "%s%s", kSdMountPoint, path.c_str());
+    struct stat info;
+    if (stat(vfsPath, &info) != 0) continue;
+    const PhotoEntry* old = findPhotoEntry(g_photos, g_photoNames, g_photoScanIndexed, name);
+    if (old && old->size == (uint32_t)info.st_size && old->mtime == (uint32_t)info.st_mtime) {
+      g_photoScanSeen[old - g_photos] = 1;
+      continue;
     }
-    
-    // Draw day name and date on the left
-    M5.Display.setTextDatum(TL_DATUM);
-    M5.Display.setTextSize(2);
-    char dayLabel[32];
-    snprintf(dayLabel, sizeof(dayLabel), "%s %d/%d", dayNames[dow], dayMonth, dayDay);
-    M5.Display.drawString(dayLabel, 10, y + 5);
-    
-    // Show events for this day - arranged horizontally with wrapping
-    int eventX = 200;  // Start events after the date
-    int eventY = y + 10;
-    int lineHeight = 30;
-    setCalendarFont();
-    M5.Display.setTextSize(1);
-    
-    for (int i = 0; i < g_eventCount; i++) {
-      // Use recurrence-aware date matching
-      if (eventOccursOnDate(g_events[i], dayYear, dayMonth, dayDay)) {
-        
-        // Check if we need to wrap to next line
-        if (eventX > w - 300 && eventY < y + cellH - lineHeight - 5) {
-          eventX = 200;
-          eventY += lineHeight;
-        }
-        
-        // Stop if we run out of vertical space
-        if (eventY > y + cellH - lineHeight - 5) {
-          break;
-        }
-        
-        // Show time if available
-        if (g_events[i].time.length() > 0) {
-          M5.Display.setTextColor(TFT_CYAN);
-          M5.Display.drawString(g_events[i].time, eventX, eventY);
-          eventX += 80;
-        }
-        
-        // Show event name
-        M5.Display.setTextColor(TFT_YELLOW);
-        String eventText = g_events[i].summary;
-        // Limit event text width
-        if (eventText.length() > 20) {
-          eventText = eventText.substring(0, 20) + "...";
-        }
-        M5.Display.drawString(eventText, eventX, eventY);
-        M5.Display.setTextColor(TFT_WHITE);
-        
-        // Move to next event position
-        eventX += 250;
+
+    // New, or changed in place: a changed file's old entry is left unseen
+    g_photoScanChanged = true;
+    PhotoEntry entry = {};
+    entry.size = info.st_size;
+    entry.mtime = info.st_mtime;
+    parseCaptureDate(name, entry);
+    entry.orientation = 1;
+    if (strcasecmp(strrchr(name, '.'), ".png") != 0) {
+      File file = SD_MMC.open(path);
+      if (file) {
+        readExifInfo(file, entry);
+        file.close();
       }
     }
-    unloadCustomFont();
-    
-    // Cell border
-    M5.Display.drawRect(0, y, w, cellH, TFT_DARKGREY);
+    if (!addPhotoEntry(name, entry)) {
+      finishPhotoIndexScan();  // Out of memory: keep what fits
+      return true;
+    }
   }
-  
-  // Navigation hint
-  M5.Display.setTextDatum(BC_DATUM);
-  M5.Display.setTextSize(1);
-  M5.Display.drawString("< Prev Week | Next Week > | Tap top-left to exit", 
-                        M5.Display.width() / 2, M5.Display.height() - 5);
-  M5.Display.setTextDatum(TL_DATUM);
+  return true;
 }
 
-void drawTodoList() {
-  M5.Display.clear(TFT_BLACK);
-  M5.Display.setTextColor(TFT_WHITE);
-  
-  // Header
-  M5.Display.setTextSize(2);
-  M5.Display.setTextDatum(TC_DATUM);
-  M5.Display.drawString("To-Do List", M5.Display.width() / 2, 10);
-  
-  // Task list
-  M5.Display.setTextSize(1);
-  M5.Display.setTextDatum(TL_DATUM);
-  int y = 50;
-  int taskHeight = 80;
-  int visibleTasks = (M5.Display.height() - 80) / taskHeight;
-  
-  if (g_taskCount == 0) {
-    M5.Display.setTextDatum(MC_DATUM);
-    M5.Display.drawString("No tasks found", M5.Display.width() / 2, M5.Display.height() / 2);
-    M5.Display.setTextDatum(TL_DATUM);
-  } else {
-    setTodoFont();
-    for (int i = g_taskScrollOffset; i < g_taskCount && i < g_taskScrollOffset + visibleTasks; i++) {
-      int taskY = y + (i - g_taskScrollOffset) * taskHeight;
-      
-      // Checkbox
-      int cbSize = 40;
-      int cbX = 20;
-      int cbY = taskY + 10;
-      unloadCustomFont();
-      M5.Display.drawRect(cbX, cbY, cbSize, cbSize, TFT_WHITE);
-      if (g_tasks[i].completed) {
-        M5.Display.fillRect(cbX + 3, cbY + 3, cbSize - 6, cbSize - 6, TFT_GREEN);
-      }
-      
-      // Task text
-      setTodoFont();
-      String title = g_tasks[i].title;
-      if (title.length() > 28) {
-        title = title.substring(0, 28) + "...";
-      }
-      uint32_t textColor = g_tasks[i].completed ? TFT_DARKGREY : TFT_WHITE;
-      M5.Display.setTextColor(textColor);
-      M5.Display.drawString(title, cbX + cbSize + 10, taskY + 15);
-      M5.Display.setTextColor(TFT_WHITE);
-      
-      // Separator line
-      unloadCustomFont();
-      M5.Display.drawLine(10, taskY + taskHeight - 2, M5.Display.width() - 10, 
-                         taskY + taskHeight - 2, TFT_DARKGREY);
-    }
-    unloadCustomFont();
+void loadPhotoList() {
+  cancelPhotoIndexScan();
+  g_photoCount = 0;
+  g_photoNamesUsed = 0;
+  if (!g_sdMounted) return;
+
+  // A stored index is shown as is and revalidated by the photo worker; the
+  // very first walk has to finish before there is anything to show
+  bool indexed = readPhotoIndexFile();
+  if (!indexed) {
+    g_photoCount = 0;
+    g_photoNamesUsed = 0;
   }
-  
-  // Scroll indicator and navigation hint
-  M5.Display.setTextDatum(BC_DATUM);
-  if (g_taskCount > visibleTasks) {
-    char scrollInfo[32];
-    snprintf(scrollInfo, sizeof(scrollInfo), "Task %d-%d of %d", 
-             g_taskScrollOffset + 1, 
-             min(g_taskScrollOffset + visibleTasks, g_taskCount),
-             g_taskCount);
-    M5.Display.drawString(scrollInfo, M5.Display.width() / 2, M5.Display.height() - 20);
-  }
-  M5.Display.drawString("Left: Scroll Up | Right: Scroll Down | Top-left: Exit",
-                        M5.Display.width() / 2, M5.Display.height() - 5);
-  M5.Display.setTextDatum(TL_DATUM);
-}
-
-void drawQRCode(const char* text, int x, int y, int size) {
-  const int version = 4;  // 33x33 modules
-  QRCode qrcode;
-  uint8_t qrcodeData[qrcode_getBufferSize(version)];
-  qrcode_initText(&qrcode, qrcodeData, version, ECC_LOW, text);
-
-  int scale = size / qrcode.size;
-  if (scale < 1) {
-    scale = 1;
-  }
-  int drawSize = qrcode.size * scale;
-  M5.Display.fillRect(x, y, drawSize, drawSize, TFT_WHITE);
-  for (int row = 0; row < qrcode.size; ++row) {
-    for (int col = 0; col < qrcode.size; ++col) {
-      if (qrcode_getModule(&qrcode, col, row)) {
-        M5.Display.fillRect(x + col * scale, y + row * scale, scale, scale, TFT_BLACK);
-      }
+  if (startPhotoIndexScan() && !indexed) {
+    while (photoIndexScanStep(kPhotoScanNamesPerStep)) {
     }
   }
-  M5.Display.drawRect(x, y, drawSize, drawSize, TFT_BLACK);
+  loadPhotoCacheIndex();
+  g_cacheFillCursor = 0;
+  g_cacheFillComplete = false;
 }
 
-void layoutIcons() {
-  int w = M5.Display.width();
-  int h = M5.Display.height();
-  int margin = 20;
-  int gap = 12;
-  int rows = 2;
-  int cols = 4;
+// Decode the next scheduled photo ahead of time; called from the photo worker.
+// Returns whether it decoded anything.
+bool prefetchPhotoStep() {
+  if (g_photoCount < 2 || g_currentPhotoIndex < 0) return false;
+  // Stay clear of the next slideshow change
+  if (millis() - g_lastPhotoChange > kPhotoInterval - 2000) return false;
+  int next = peekShufflePhoto();
+  if (next == g_prefetchIndex || next == g_currentPhotoIndex) return false;
 
-  int iconW = (w - margin * 2 - gap * (cols - 1)) / cols;
-  int iconH = (h - margin * 2 - gap * (rows - 1)) / rows;
+  if (!g_prefetchCanvas) {
+    g_prefetchCanvas = borrowCanvas(M5.Display.width(), M5.Display.height());
+    if (!g_prefetchCanvas) return false;
+  }
+  g_prefetchIndex = next;
+  g_prefetchReady = loadPhotoFrame(next, *g_prefetchCanvas);
+  return true;
+}
 
-  for (int i = 0; i < kIconCount; ++i) {
-    int row = i / cols;
-    int col = i % cols;
-    int x = margin + col * (iconW + gap);
-    int y = margin + row * (iconH + gap);
-    g_icons[i] = {kIconLabels[i], x, y, iconW, iconH};
+// Background photo work: the prefetch first, then the photo index walk, and the
+// cache pre-fill when there is nothing else to do. A decode takes hundreds of ms, and loop() only polls
+// touch between iterations, so they run in their own task instead.
+// While App3 is open, g_photoLock guards the photo cache, the prefetch frame,
+// the canvas pool and the SD image stream; loop() takes it only to change the
+// photo on screen.
+constexpr uint32_t kPhotoWorkerPollMs = 250;  // Pause between steps, so loop() gets the lock
+
+SemaphoreHandle_t g_photoLock = nullptr;
+volatile bool g_photoWorkerActive = false;  // Set while App3 is open
+
+void photoWorkerTask(void*) {
+  for (;;) {
+    vTaskDelay(pdMS_TO_TICKS(kPhotoWorkerPollMs));
+    if (!g_photoWorkerActive) continue;
+    xSemaphoreTake(g_photoLock, portMAX_DELAY);
+    if (g_photoWorkerActive && !prefetchPhotoStep() && !photoIndexScanStep(kPhotoScanNamesPerStep)) {
+      fillPhotoCacheStep();
+    }
+    xSemaphoreGive(g_photoLock);
   }
 }
 
-void drawWelcome() {
-  M5.Display.clear(TFT_BLACK);
-  M5.Display.setTextColor(TFT_WHITE);
+void startPhotoWorker() {
+  g_photoLock = xSemaphoreCreateMutex();
+  // Same stack as the Arduino loop task, which used to run these decodes
+  xTaskCreatePinnedToCore(photoWorkerTask, "photo_worker", 8192, nullptr, 1, nullptr, tskNO_AFFINITY);
+}
 
-  int w = M5.Display.width();
-  int h = M5.Display.height();
+// Stop background photo work; returns with g_photoLock held
+void pausePhotoWorker() {
+  xSemaphoreTake(g_photoLock, portMAX_DELAY);
+  g_photoWorkerActive = false;
+}
 
-  // Large centered app name - use smooth FreeSans font
-  M5.Display.setFont(&fonts::FreeSans24pt7b);
-  M5.Display.setTextSize(1);  // No scaling for smooth font
-  M5.Display.setTextDatum(MC_DATUM);
-  M5.Display.drawString(kAppName, w / 2, h / 2 - 50);
-  
-  // Chinese subtitle centered
-  M5.Display.setFont(&fonts::efontTW_24);
-  M5.Display.setTextSize(1.5);  // Slightly larger than normal
-  M5.Display.drawString("有趣的ESP32之旅", w / 2, h / 2 + 10);
-  M5.Display.setFont(&fonts::Font0);
+// Photo transitions. Crossfade and Ken Burns blend on the ESP32-P4 PPA when
+// the driver is available and fall back to a SWAR RGB565 kernel otherwise;
+// the target is 30+ fps for full 1280x720 frames.
+enum class PhotoTransition {
+  Cut,
+  Crossfade,
+  Slide,
+  KenBurns
+};
 
-  // Left-aligned version info - larger text
-  M5.Display.setTextDatum(TL_DATUM);
-  M5.Display.setTextSize(2);
-  M5.Display.setCursor(20, h / 2 + 50);
-  M5.Display.print("Version: ");
-  M5.Display.println(kAppVersion);
-  M5.Display.setCursor(20, h / 2 + 75);
-  M5.Display.print("Author: ");
-  M5.Display.println(kAuthor);
-  M5.Display.setCursor(20, h / 2 + 100);
-  M5.Display.print("Build: ");
-  M5.Display.print(__DATE__);
-  M5.Display.print(" ");
-  M5.Display.println(__TIME__);
-  
-  // Show SD card status
-  M5.Display.setCursor(20, h / 2 + 125);
-  M5.Display.print("SD Card: ");
-  if (g_sdMounted) {
-    M5.Display.setTextColor(TFT_GREEN);
-    M5.Display.println("OK");
-    M5.Display.setTextColor(TFT_WHITE);
-  } else {
-    M5.Display.setTextColor(TFT_RED);
-    M5.Display.println("Not Found");
-    M5.Display.setTextColor(TFT_WHITE);
+constexpr PhotoTransition kPhotoTransition = PhotoTransition::Crossfade;
+constexpr uint32_t kTransitionMs = 800;
+constexpr float kKenBurnsZoom = 1.12f;  // Starting zoom of the incoming photo
+
+int g_photoDirection = 1;  // 1 = forward / slide left, -1 = back / slide right
+
+// Nearest-neighbour zoom about the centre; output is native byte order
+void zoomRgb565(const uint16_t* src, uint16_t* dst, int w, int h, float zoom) {
+  int32_t step = (int32_t)(65536 / zoom);
+  int32_t x0 = (w << 15) - (w * step) / 2;
+  int32_t y0 = (h << 15) - (h * step) / 2;
+  for (int y = 0; y < h; ++y) {
+    const uint16_t* row = src + ((y0 + y * step) >> 16) * w;
+    uint16_t* out = dst + y * w;
+    int32_t sx = x0;
+    for (int x = 0; x < w; ++x, sx += step) {
+      out[x] = __builtin_bswap16(row[sx >> 16]);
+    }
   }
+}
 
-  int qrSize = 140;
-  int logoX = 150;
-  int logoY = 150;
-  int qrX = w - qrSize - 20;
-  int qrY = h - qrSize - 20;
+#if HAS_PPA
+ppa_client_handle_t g_ppaBlend = nullptr;
+ppa_client_handle_t g_ppaScale = nullptr;
 
-  // Draw logo
-  M5.Display.setSwapBytes(true);
-  M5.Display.pushImage(logoX, logoY, kLogoWidth, kLogoHeight, kLogoData);
-  M5.Display.setSwapBytes(false);
+bool registerPpaClient(ppa_operation_t operation, ppa_client_handle_t& client) {
+  if (client) return true;
+  ppa_client_config_t config = {};
+  config.oper_type = operation;
+  config.max_pending_trans_num = 1;
+  if (ppa_register_client(&config, &client) != ESP_OK) {
+    client = nullptr;
+    return false;
+  }
+  return true;
+}
 
-  // Draw QR code
-  drawQRCode(kGithubUrl, qrX, qrY, qrSize);
-  M5.Display.setCursor(qrX, qrY - 14);
-  M5.Display.print("GitHub");
+// Hardware blend: out = fg * alpha + bg * (1 - alpha), native RGB565 output
+bool ppaBlendFrames(const uint16_t* bg, const uint16_t* fg, uint16_t* out,
+                    int w, int h, uint8_t alpha, bool fgNative) {
+  if (!registerPpaClient(PPA_OPERATION_BLEND, g_ppaBlend)) return false;
+  ppa_blend_oper_config_t op = {};
+  op.in_bg.buffer = bg;
+  op.in_bg.pic_w = w;
+  op.in_bg.pic_h = h;
+  op.in_bg.block_w = w;
+  op.in_bg.block_h = h;
+  op.in_bg.blend_cm = PPA_BLEND_COLOR_MODE_RGB565;
+  op.in_fg = op.in_bg;
+  op.in_fg.buffer = fg;
+  op.out.buffer = out;
+  op.out.buffer_size = (uint32_t)w * h * 2;
+  op.out.pic_w = w;
+  op.out.pic_h = h;
+  op.out.blend_cm = PPA_BLEND_COLOR_MODE_RGB565;
+  op.bg_byte_swap = true;  // Sprite buffers hold byte-swapped RGB565
+  op.fg_byte_swap = !fgNative;
+  op.bg_alpha_update_mode = PPA_ALPHA_FIX_VALUE;
+  op.bg_alpha_fix_val = 255;
+  op.fg_alpha_update_mode = PPA_ALPHA_FIX_VALUE;
+  op.fg_alpha_fix_val = alpha;
+  op.mode = PPA_TRANS_MODE_BLOCKING;
+  return ppa_do_blend(g_ppaBlend, &op) == ESP_OK;
 }
 
-void drawDashboard() {
-  M5.Display.clear(TFT_BLACK);
-  M5.Display.setTextColor(TFT_WHITE);
-  layoutIcons();
-  
-  for (int i = 0; i < kIconCount; ++i) {
-    const auto& icon = g_icons[i];
-    
-    bool iconDrawn = false;
-    
-    // Try to load icon from SD card if available
-    if (g_sdMounted) {
-      const char* path = getIconPath(i);
-      if (SD_MMC.exists(path)) {
-        // Read PNG file into memory buffer and draw scaled
-        auto file = SD_MMC.open(path);
-        if (file) {
-          size_t fileSize = file.size();
-          uint8_t* buffer = (uint8_t*)malloc(fileSize);
-          if (buffer) {
-            size_t bytesRead = file.read(buffer, fileSize);
-            if (bytesRead == fileSize) {
-              // Draw PNG directly to display, then get dimensions
-              // First, determine PNG dimensions by decoding header
-              M5Canvas canvas(&M5.Display);
-              canvas.createSprite(512, 512); // Max expected size
-              
-              if (canvas.drawPng(buffer, fileSize, 0, 0)) {
-                int srcWidth = canvas.width();
-                int srcHeight = canvas.height();
-                
-                // Center the scaled icon in the grid cell
-                int imgX = icon.x + (icon.w - kIconDisplaySize) / 2;
-                int imgY = icon.y + (icon.h - kIconDisplaySize) / 2;
-                
-                // Calculate scale to fit within 200x200
-                float scaleX = (float)kIconDisplaySize / srcWidth;
-                float scaleY = (float)kIconDisplaySize / srcHeight;
-                float scale = min(scaleX, scaleY);
-                
-                // Calculate actual display size maintaining aspect ratio
-                int displayW = srcWidth * scale;
-                int displayH = srcHeight * scale;
-                
-                // Center in the 200x200 area
-                int finalX = imgX + (kIconDisplaySize - displayW) / 2;
-                int finalY = imgY + (kIconDisplaySize - displayH) / 2;
-                
-                // Push sprite scaled
-                canvas.pushRotateZoom(finalX + displayW / 2, finalY + displayH / 2,
-                                     0, scale, scale);
-                iconDrawn = true;
-              }
-              canvas.deleteSprite();
-            }
-            free(buffer);
+// Hardware zoom about the centre, native RGB565 output
+bool ppaZoomFrame(const uint16_t* src, uint16_t* dst, int w, int h, float zoom) {
+  if (!registerPpaClient(PPA_OPERATION_SRM, g_ppaScale)) return false;
+  ppa_srm_oper_config_t op = {};
+  op.in.buffer = src;
+  op.in.pic_w = w;
+  op.in.pic_h = h;
+  op.in.block_w = (uint32_t)(w / zoom) & ~1u;
+  op.in.block_h = (uint32_t)(h / zoom) & ~1u;
+  op.in.block_offset_x = (w - op.in.block_w) / 2;
+  op.in.block_offset_y = (h - op.in.block_h) / 2;
+  op.in.srm_cm = PPA_SRM_COLOR_MODE_RGB565;
+  op.out.buffer = dst;
+  op.out.buffer_size = (uint32_t)w * h * 2;
+  op.out.pic_w = w;
+  op.out.pic_h = h;
+  op.out.srm_cm = PPA_SRM_COLOR_MODE_RGB565;
+  op.rotation_angle = PPA_SRM_ROTATION_ANGLE_0;
+  op.scale_x = (float)w / op.in.block_w;
+  op.scale_y = (float)h / op.in.block_h;
+  op.byte_swap = true;
+  op.mode = PPA_TRANS_MODE_BLOCKING;
+  return ppa_do_scale_rotate_mirror(g_ppaScale, &op) == ESP_OK;
+}
+#endif
+
+void blendFrames(const uint16_t* bg, const uint16_t* fg, uint16_t* out,
+                 int w, int h, uint8_t alpha, bool fgNative) {
+#if HAS_PPA
+  if (ppaBlendFrames(bg, fg, out, w, h, alpha, fgNative)) return;
+#endif
+  blendRgb565Swar(bg, fg, out, (size_t)w * h, (alpha + 4) >> 3, fgNative);
+}
+
+void zoomFrame(const uint16_t* src, uint16_t* dst, int w, int h, float zoom) {
+#if HAS_PPA
+  if (ppaZoomFrame(src, dst, w, h, zoom)) return;
+#endif
+  zoomRgb565(src, dst, w, h, zoom);
+}
+
+// Animate from the frame on screen to the next one; both are full-screen
+void runPhotoTransition(M5Canvas& from, M5Canvas& to) {
+  M5Canvas* scratch = nullptr;
+  if (kPhotoTransition != PhotoTransition::Cut) {
+    scratch = borrowCanvas(to.width(), to.height());
+  }
+  if (!scratch) {
+    to.pushSprite(0, 0);
+    return;
+  }
+
+  int w = to.width();
+  int h = to.height();
+  const uint16_t* src = (const uint16_t*)from.getBuffer();
+  const uint16_t* dst = (const uint16_t*)to.getBuffer();
+  uint16_t* out = (uint16_t*)scratch->getBuffer();
+
+  unsigned long start = millis();
+  int frames = 0;
+  for (uint32_t elapsed = 0; elapsed < kTransitionMs; elapsed = millis() - start) {
+    uint8_t alpha = elapsed * 255 / kTransitionMs;
+    switch (kPhotoTransition) {
+      case PhotoTransition::Crossfade:
+        blendFrames(src, dst, out, w, h, alpha, false);
+        M5.Display.pushImage(0, 0, w, h, (const lgfx::rgb565_t*)out);
+        break;
+      case PhotoTransition::Slide: {
+        // Both photos move together; offset is how far the new one has come in
+        int offset = w * elapsed / kTransitionMs;
+        for (int y = 0; y < h; ++y) {
+          const uint16_t* a = src + y * w;
+          const uint16_t* b = dst + y * w;
+          uint16_t* row = out + y * w;
+          if (g_photoDirection > 0) {
+            memcpy(row, a + offset, (w - offset) * 2);
+            memcpy(row + w - offset, b, offset * 2);
+          } else {
+            memcpy(row, b + w - offset, offset * 2);
+            memcpy(row + offset, a, (w - offset) * 2);
           }
-          file.close();
         }
+        scratch->pushSprite(0, 0);
+        break;
       }
+      case PhotoTransition::KenBurns: {
+        // The incoming photo settles from kKenBurnsZoom to 1:1 as it fades in
+        float zoom = kKenBurnsZoom - (kKenBurnsZoom - 1.0f) * elapsed / kTransitionMs;
+        zoomFrame(dst, out, w, h, zoom);
+        blendFrames(src, out, out, w, h, alpha, true);
+        M5.Display.pushImage(0, 0, w, h, (const lgfx::rgb565_t*)out);
+        break;
+      }
+      case PhotoTransition::Cut:
+        break;
     }
-    
-    // Always draw label below the icon - use smooth Chinese font
-    M5.Display.setTextColor(TFT_WHITE);
-    M5.Display.setFont(&fonts::efontTW_24);  // Smooth anti-aliased font
-    M5.Display.setTextSize(1);  // Keep font smooth without scaling
-    M5.Display.setTextDatum(TC_DATUM); // Top center
-    int labelY = icon.y + icon.h - 35; // Position label near bottom of cell
-    M5.Display.drawString(icon.label, icon.x + icon.w / 2, labelY);
-    M5.Display.setTextDatum(TL_DATUM);
-    M5.Display.setFont(&fonts::Font0);
-    
-    // Draw border if icon not loaded
-    if (!iconDrawn) {
-      M5.Display.drawRect(icon.x, icon.y, icon.w, icon.h, TFT_WHITE);
-    }
+    frames++;
   }
+  to.pushSprite(0, 0);
+  returnCanvas(scratch);
+
+  log_i("Photo transition: %d frames, %.1f fps", frames,
+        frames * 1000.0f / max(1UL, millis() - start));
 }
 
-void loadPhotoList() {
-  g_photoCount = 0;
-  if (!g_sdMounted) return;
-  
-  File dir = SD_MMC.open("/M5Stack-Tab-5-Adventure/photo-frame");
-  if (!dir || !dir.isDirectory()) return;
+// Instant preview: decode the small EXIF thumbnail and scale it to the panel
+// so a tap gets immediate feedback while the full photo decodes
+constexpr uint32_t kMaxThumbnailBytes = 64 * 1024;
+
+bool showPhotoPreview(int index) {
+  const PhotoEntry& photo = g_photos[index];
+  if (photo.thumbLength == 0 || photo.thumbLength > kMaxThumbnailBytes) return false;
+
+  File file = SD_MMC.open(getPhotoPath(index));
+  if (!file) return false;
+  uint8_t* buffer = (uint8_t*)malloc(photo.thumbLength);
+  bool ok = buffer && file.seek(photo.thumbOffset) &&
+            file.read(buffer, photo.thumbLength) == photo.thumbLength;
+  file.close();
+
+  int thumbW = 0, thumbH = 0;
+  MemoryReader reader = {buffer, photo.thumbLength, 0};
+  ok = ok && readJpegSize(reader, thumbW, thumbH);
+  M5Canvas* thumb = ok ? borrowCanvas(thumbW, thumbH) : nullptr;
+  ok = thumb && thumb->drawJpg(buffer, photo.thumbLength, 0, 0, thumbW, thumbH);
+  free(buffer);
+
+  if (ok) {
+    // Rotate by the EXIF orientation; mirrored variants flip the x zoom
+    static const int16_t kAngles[9] = {0, 0, 0, 180, 180, 270, 90, 90, 270};
+    static const int8_t kMirror[9] = {1, 1, -1, 1, -1, -1, 1, -1, 1};
+    uint8_t orientation = photo.orientation <= 8 ? photo.orientation : 1;
+    bool swapAxes = orientation >= 5;
+    int uprightW = swapAxes ? thumbH : thumbW;
+    int uprightH = swapAxes ? thumbW : thumbH;
+    float zoomX = (float)M5.Display.width() / uprightW;
+    float zoomY = (float)M5.Display.height() / uprightH;
+    // Centre mode previews as Fit: a thumbnail at 1:1 would be postage-stamp sized
+    float zoom = kPhotoFitMode == PhotoFitMode::Fill ? max(zoomX, zoomY) : min(zoomX, zoomY);
+    int shownW = uprightW * zoom;
+    int shownH = uprightH * zoom;
+    clearLetterbox(M5.Display, (M5.Display.width() - shownW) / 2, (M5.Display.height() - shownH) / 2,
+                   shownW, shownH);
+    thumb->pushRotateZoom(M5.Display.width() / 2.0f, M5.Display.height() / 2.0f,
+                          kAngles[orientation], zoom * kMirror[orientation], zoom);
+  }
+  returnCanvas(thumb);
+  return ok;
+}
+
+// Put the next photo on screen; called with g_photoLock held
+void changePhoto(unsigned long now) {
+  g_forcePhotoRedraw = false;
   
-  File file = dir.openNextFile();
-  while (file && g_photoCount < 100) {
-    String name = file.name();
-    name.toLowerCase();
-    if (!file.isDirectory() && (name.endsWith(".jpg") || name.endsWith(".png") || name.endsWith(".jpeg"))) {
-      g_photoFiles[g_photoCount++] = String(file.path());
+  // Shuffle-bag order only for auto-advance
+  if (g_currentPhotoIndex < 0 || (now - g_lastPhotoChange >= kPhotoInterval)) {
+    g_currentPhotoIndex = nextShufflePhoto();
+  }
+  g_lastPhotoChange = now;
+
+  // The next frame is usually prefetched already; otherwise load it now,
+  // showing the EXIF thumbnail while a full decode is needed
+  bool previewShown = false;
+  if (!(g_prefetchReady && g_prefetchIndex == g_currentPhotoIndex)) {
+    if (!g_prefetchCanvas) {
+      g_prefetchCanvas = borrowCanvas(M5.Display.width(), M5.Display.height());
+      if (!g_prefetchCanvas) return;
     }
-    file.close();
-    file = dir.openNextFile();
+    if (findPhotoCacheEntry(photoCacheKey(g_photos[g_currentPhotoIndex])) < 0) {
+      previewShown = showPhotoPreview(g_currentPhotoIndex);
+    }
+    g_prefetchIndex = g_currentPhotoIndex;
+    g_prefetchReady = loadPhotoFrame(g_currentPhotoIndex, *g_prefetchCanvas);
+    if (!g_prefetchReady) return;
+  }
+
+  if (g_photoFrame && !previewShown) {
+    runPhotoTransition(*g_photoFrame, *g_prefetchCanvas);
+  } else {
+    g_prefetchCanvas->pushSprite(0, 0);
   }
-  dir.close();
+  // The new photo becomes current; the old frame is reused for the next prefetch
+  std::swap(g_photoFrame, g_prefetchCanvas);
+  g_prefetchReady = false;
+  g_photoDirection = 1;
 }
 
 void drawPhotoFrame() {
@@ -776,69 +3509,273 @@ void drawPhotoFrame() {
                       g_forcePhotoRedraw;
   
   if (shouldChange) {
-    g_forcePhotoRedraw = false;
-    
-    // Random photo only for auto-advance
-    if (g_currentPhotoIndex < 0 || (now - g_lastPhotoChange >= kPhotoInterval)) {
-      g_currentPhotoIndex = random(g_photoCount);
-    }
-    g_lastPhotoChange = now;
-    
-    // Clear screen
-    M5.Display.clear(TFT_BLACK);
-    
-    // Load and display the pre-sized image (1200 width)
-    const char* photoPath = g_photoFiles[g_currentPhotoIndex].c_str();
-    File file = SD_MMC.open(photoPath);
-    if (file) {
-      size_t fileSize = file.size();
-      uint8_t* buffer = (uint8_t*)malloc(fileSize);
-      if (buffer) {
-        size_t bytesRead = file.read(buffer, fileSize);
-        if (bytesRead == fileSize) {
-          bool isPng = String(photoPath).endsWith(".png");
-          
-          // Use canvas for instant display without top-to-bottom effect
-          M5Canvas canvas(&M5.Display);
-          canvas.createSprite(1200, 675); // Full image size
-          
-          // Draw to canvas first
-          if (isPng) {
-            canvas.drawPng(buffer, fileSize, 0, 0);
-          } else {
-            canvas.drawJpg(buffer, fileSize, 0, 0);
-          }
-          
-          // Push canvas to display all at once (centered)
-          int x = (M5.Display.width() - 1200) / 2;
-          canvas.pushSprite(x, 0);
-          canvas.deleteSprite();
-        }
-        free(buffer);
-      }
-      file.close();
+    xSemaphoreTake(g_photoLock, portMAX_DELAY);
+    changePhoto(now);
+    xSemaphoreGive(g_photoLock);
+  }
+}
+
+// Screens as widget trees, built once in buildUi(). Layout is fixed there;
+// state changes invalidate the widgets that show it, and taps are routed by
+// the trees instead of per-screen coordinate checks.
+Container g_welcomeRoot;
+View g_welcomeView;
+
+CachedLayer g_dashboardRoot;
+Button g_iconCells[kIconCount];
+IconImage g_iconImages[kIconCount];
+Label g_iconLabels[kIconCount];
+
+Container g_calendarRoot;
+View g_calendarWeek;
+Label g_calendarHint;
+Widget g_calendarPrev;
+Widget g_calendarNext;
+Widget g_calendarBack;
+
+Container g_todoRoot;
+Label g_todoHeader;
+List g_todoList;
+Label g_todoScrollInfo;
+Label g_todoHint;
+Widget g_todoUp;
+Widget g_todoDown;
+Widget g_todoBack;
+
+Widget g_photoRoot;  // Tap zones only; the slideshow paints the panel itself
+Widget g_photoPrev;
+Widget g_photoNext;
+Widget g_photoBack;
+
+Container g_appRoot;  // Shared by the placeholder apps
+Label g_appTitle;
+Label g_appHint;
+Button g_appBack;
+
+void showScreen(Screen screen) {
+  g_screen = screen;
+  g_needsRedraw = true;
+}
+
+void updateTodoScrollInfo() {
+  char scrollInfo[32] = "";
+  if (g_todoList.count() > g_todoList.visibleRows()) {
+    snprintf(scrollInfo, sizeof(scrollInfo), "Task %d-%d of %d",
+             g_todoList.first() + 1,
+             min(g_todoList.first() + g_todoList.visibleRows(), g_todoList.count()),
+             g_todoList.count());
+  }
+  g_todoScrollInfo.setText(scrollInfo);
+}
+
+uint32_t g_dashboardDrawMs = 0;  // Last full dashboard redraw, for profiling
+
+// Decode on first use; afterwards a redraw never touches the SD card
+// Called on entering the dashboard; the keys cost a stat() per SD icon
+void loadDashboardIcons() {
+  for (int i = 0; i < kIconCount; ++i) {
+    uint32_t key = iconTileKey(i);
+    if (g_iconTiles[i].key == key) continue;
+    bool loaded = loadIconTile(i, g_iconTiles[i], key);
+    g_iconImages[i].setTile(&g_iconTiles[i]);
+    g_iconCells[i].setBorder(!loaded);  // Outline the cell if there is no icon
+    g_iconCells[i].invalidate();
+  }
+}
+
+void onWelcomeTap(Widget&) {
+  showScreen(Screen::Dashboard);
+}
+
+void onBackTap(Widget&) {
+  if (g_screen == Screen::App3) {
+    pausePhotoWorker();
+    cancelPhotoIndexScan();
+    releasePhotoFrames();
+    flushPhotoCacheIndex();
+    xSemaphoreGive(g_photoLock);
+  }
+  if (g_screen == Screen::App1 || g_screen == Screen::App2) saveFontUsage();
+  showScreen(Screen::Dashboard);
+}
+
+void onIconTap(Widget& cell) {
+  int i = cell.tag();
+  if (i == kIconCount - 1) {
+    showScreen(Screen::Welcome);
+    return;
+  }
+  if (i == 0) {
+    loadCalendarEvents();
+    g_calendarWeek.invalidate();
+  } else if (i == 1) {
+    loadTodoTasks();
+    g_todoList.setCount(g_taskCount);
+    g_todoList.scrollTo(0);
+    updateTodoScrollInfo();
+  } else if (i == 2) {
+    loadPhotoList();
+    resetPhotoSlideshow();
+    g_currentPhotoIndex = -1;
+    g_photoWorkerActive = true;
+  } else {
+    char title[16];
+    snprintf(title, sizeof(title), "App %d", i + 1);
+    g_appTitle.setText(title);
+  }
+  showScreen(static_cast<Screen>(static_cast<int>(Screen::App1) + i));
+}
+
+void onWeekTap(Widget& zone) {
+  g_weekOffset += zone.tag();
+  g_calendarWeek.invalidate();
+}
+
+void onTodoScrollTap(Widget& zone) {
+  if (g_todoList.scrollTo(g_todoList.first() + zone.tag())) updateTodoScrollInfo();
+}
+
+void onPhotoStepTap(Widget& zone) {
+  // The index walk in the photo worker can change the count and order
+  xSemaphoreTake(g_photoLock, portMAX_DELAY);
+  if (g_photoCount > 0) {
+    if (zone.tag() < 0) {
+      g_photoDirection = -1;
+      g_currentPhotoIndex--;
+      if (g_currentPhotoIndex < 0) g_currentPhotoIndex = g_photoCount - 1;
+    } else {
+      g_currentPhotoIndex++;
+      if (g_currentPhotoIndex >= g_photoCount) g_currentPhotoIndex = 0;
     }
+    g_lastPhotoChange = millis(); // Reset timer
+    g_forcePhotoRedraw = true;
   }
+  xSemaphoreGive(g_photoLock);
+}
+
+// Left and right halves step by -1 and +1; the top-left 100x100 corner, added
+// last so it wins, goes back to the dashboard
+void addPagingZones(Widget& root, Widget& prev, Widget& next, Widget& back,
+                    void (*onStep)(Widget&)) {
+  int w = M5.Display.width();
+  int h = M5.Display.height();
+  prev.setBounds(0, 0, w / 2, h);
+  prev.setOnTap(onStep, -1);
+  next.setBounds(w / 2, 0, w - w / 2, h);
+  next.setOnTap(onStep, 1);
+  back.setBounds(0, 0, 100, 100);
+  back.setOnTap(onBackTap);
+  root.add(prev);
+  root.add(next);
+  root.add(back);
 }
 
-void drawAppScreen(int index) {
-  M5.Display.clear(TFT_BLACK);
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.setTextSize(2);
-  M5.Display.setCursor(20, 20);
-  M5.Display.print("App ");
-  M5.Display.println(index + 1);
+void buildUi() {
+  int w = M5.Display.width();
+  int h = M5.Display.height();
+
+  g_welcomeRoot.setBounds(0, 0, w, h);
+  g_welcomeRoot.setOnTap(onWelcomeTap);
+  g_welcomeView.setBounds(0, 0, w, h);
+  g_welcomeView.setPainter(paintWelcome);
+  g_welcomeRoot.add(g_welcomeView);
+
+  // 4x2 grid of icon cells, each an icon with its label near the bottom
+  int margin = 20;
+  int gap = 12;
+  int rows = 2;
+  int cols = 4;
+  int iconW = (w - margin * 2 - gap * (cols - 1)) / cols;
+  int iconH = (h - margin * 2 - gap * (rows - 1)) / rows;
+  g_dashboardRoot.setBounds(0, 0, w, h);
+  for (int i = 0; i < kIconCount; ++i) {
+    int x = margin + (i % cols) * (iconW + gap);
+    int y = margin + (i / cols) * (iconH + gap);
+    g_iconCells[i].setBounds(x, y, iconW, iconH);
+    g_iconCells[i].setOnTap(onIconTap, i);
+    g_iconImages[i].setBounds(x, y, iconW, iconH);
+    g_iconLabels[i].setBounds(x, y + iconH - 35, iconW, 30);
+    g_iconLabels[i].setStyle(&fonts::efontTW_24, 1, TFT_WHITE, TC_DATUM);
+    g_iconLabels[i].setText(kIconLabels[i]);
+    g_iconCells[i].add(g_iconImages[i]);
+    g_iconCells[i].add(g_iconLabels[i]);
+    g_dashboardRoot.add(g_iconCells[i]);
+  }
+
+  g_calendarRoot.setBounds(0, 0, w, h);
+  g_calendarWeek.setBounds(0, 0, w, h - 25);
+  g_calendarWeek.setPainter(paintCalendarWeek);
+  g_calendarHint.setBounds(0, h - 13, w, 8);
+  g_calendarHint.setStyle(&fonts::Font0, 1, TFT_WHITE, BC_DATUM);
+  g_calendarHint.setText("< Prev Week | Next Week > | Tap top-left to exit");
+  g_calendarRoot.add(g_calendarWeek);
+  g_calendarRoot.add(g_calendarHint);
+  addPagingZones(g_calendarRoot, g_calendarPrev, g_calendarNext, g_calendarBack, onWeekTap);
+
+  g_todoRoot.setBounds(0, 0, w, h);
+  g_todoHeader.setBounds(0, 10, w, 16);
+  g_todoHeader.setStyle(&fonts::Font0, 2, TFT_WHITE, TC_DATUM);
+  g_todoHeader.setText("To-Do List");
+  g_todoList.setBounds(0, 50, w, h - 80);
+  g_todoList.setRows(80, drawTodoRow);
+  g_todoList.setEmptyText("No tasks found");
+  g_todoScrollInfo.setBounds(0, h - 28, w, 8);
+  g_todoScrollInfo.setStyle(&fonts::Font0, 1, TFT_WHITE, BC_DATUM);
+  g_todoHint.setBounds(0, h - 13, w, 8);
+  g_todoHint.setStyle(&fonts::Font0, 1, TFT_WHITE, BC_DATUM);
+  g_todoHint.setText("Left: Scroll Up | Right: Scroll Down | Top-left: Exit");
+  g_todoRoot.add(g_todoHeader);
+  g_todoRoot.add(g_todoList);
+  g_todoRoot.add(g_todoScrollInfo);
+  g_todoRoot.add(g_todoHint);
+  addPagingZones(g_todoRoot, g_todoUp, g_todoDown, g_todoBack, onTodoScrollTap);
 
-  M5.Display.setTextSize(1);
-  M5.Display.setCursor(20, 60);
-  M5.Display.println("Tap anywhere to return");
-  M5.Display.drawRect(10, 10, 80, 30, TFT_WHITE);
-  M5.Display.setCursor(18, 18);
-  M5.Display.println("Back");
+  g_photoRoot.setBounds(0, 0, w, h);
+  addPagingZones(g_photoRoot, g_photoPrev, g_photoNext, g_photoBack, onPhotoStepTap);
+
+  g_appRoot.setBounds(0, 0, w, h);
+  g_appRoot.setOnTap(onBackTap);  // Tap anywhere to go back to dashboard
+  g_appTitle.setBounds(20, 20, w - 40, 16);
+  g_appTitle.setStyle(&fonts::Font0, 2, TFT_WHITE, TL_DATUM);
+  g_appHint.setBounds(20, 60, w - 40, 8);
+  g_appHint.setText("Tap anywhere to return");
+  g_appBack.setBounds(10, 10, 80, 30);
+  g_appBack.setBorder(true);
+  g_appBack.setFilled(false);  // Drawn over the title, as it always was
+  g_appBack.setText("Back");
+  g_appRoot.add(g_appTitle);
+  g_appRoot.add(g_appHint);
+  g_appRoot.add(g_appBack);
+}
+
+Widget& screenRoot(Screen screen) {
+  switch (screen) {
+    case Screen::Welcome:
+      return g_welcomeRoot;
+    case Screen::Dashboard:
+      return g_dashboardRoot;
+    case Screen::App1:
+      return g_calendarRoot;
+    case Screen::App2:
+      return g_todoRoot;
+    case Screen::App3:
+      return g_photoRoot;
+    default:
+      return g_appRoot;
+  }
 }
 
-bool hitTest(const Icon& icon, int x, int y) {
-  return x >= icon.x && x <= (icon.x + icon.w) && y >= icon.y && y <= (icon.y + icon.h);
+// Draw a frame: everything on entering a screen, else only invalidated widgets
+void renderScreen(Widget& root) {
+  GlyphCacheStats before = g_glyphStats;
+  LovyanGFX& gfx = beginFrame();
+  root.paint(gfx, g_screenChanged);
+  presentFrame();
+  if (g_glyphStats.misses != before.misses || g_glyphStats.hits != before.hits) {
+    log_d("Glyph cache: %u hits, %u misses this frame (%u/%u total, %u evicted)",
+          (unsigned)(g_glyphStats.hits - before.hits), (unsigned)(g_glyphStats.misses - before.misses),
+          (unsigned)g_glyphStats.hits, (unsigned)g_glyphStats.misses, (unsigned)g_glyphStats.evictions);
+  }
 }
 }
 
@@ -848,10 +3785,14 @@ void setup() {
   M5.begin(cfg);
   M5.Display.setRotation(kRotationLandscape);
   M5.Display.setBrightness(kBrightness);
+  initCanvasPool();
+  buildUi();
   
   // Initialize SD card with M5Stack Tab 5 pins (SD_MMC)
   SD_MMC.setPins(43, 44, 39, 40, 41, 42); // CLK, CMD, D0, D1, D2, D3
-  g_sdMounted = SD_MMC.begin("/sdcard", true); // One bit mode
+  g_sdMounted = SD_MMC.begin(kSdMountPoint, true); // One bit mode
+  openAssetPack();
+  startPhotoWorker();
   
   // Load custom fonts from SD card
   loadCustomFonts();
@@ -868,38 +3809,25 @@ void loop() {
   M5.update();
 
   if (g_needsRedraw) {
+    uint32_t start = millis();
     g_needsRedraw = false;
-    switch (g_screen) {
-      case Screen::Welcome:
-        drawWelcome();
-        break;
-      case Screen::Dashboard:
-        drawDashboard();
-        break;
-      case Screen::App1:
-        drawCalendar();
-        break;
-      case Screen::App2:
-        drawTodoList();
-        break;
-      case Screen::App3:
-        drawPhotoFrame();
-        break;
-      case Screen::App4:
-        drawAppScreen(3);
-        break;
-      case Screen::App5:
-        drawAppScreen(4);
-        break;
-      case Screen::App6:
-        drawAppScreen(5);
-        break;
-      case Screen::App7:
-        drawAppScreen(6);
-        break;
-      case Screen::App8:
-        drawAppScreen(7);
-        break;
+    g_screenChanged = (int)g_screen != g_drawnScreen;
+    if (g_screen == Screen::Dashboard && g_screenChanged) loadDashboardIcons();
+    g_drawnScreen = (int)g_screen;
+    if (g_screen == Screen::App3) {
+      drawPhotoFrame();  // The slideshow draws to the panel itself
+    } else {
+      renderScreen(screenRoot(g_screen));
+    }
+    // Icons, paint and queueing the flush; the DMA itself finishes after this
+    if (g_screen == Screen::Dashboard && g_screenChanged) {
+      g_dashboardDrawMs = millis() - start;
+      log_i("Dashboard drawn in %u ms", (unsigned)g_dashboardDrawMs);
+    }
+    if (g_tapPending) {
+      g_tapPending = false;
+      log_i("Tap redraw pushed %u of %u bytes", (unsigned)(g_bytesPushed - g_tapBytesStart),
+            (unsigned)(M5.Display.width() * M5.Display.height() * 2));
     }
   }
   
@@ -910,142 +3838,8 @@ void loop() {
 
   auto t = M5.Touch.getDetail();
   if (t.wasPressed()) {
-    int tx = t.x;
-    int ty = t.y;
-
-    if (g_screen == Screen::Welcome) {
-      g_screen = Screen::Dashboard;
-      g_needsRedraw = true;
-      return;
-    }
-
-    if (g_screen == Screen::Dashboard) {
-      for (int i = 0; i < 8; ++i) {
-        if (hitTest(g_icons[i], tx, ty)) {
-          if (i == 7) {
-            g_screen = Screen::Welcome;
-          } else {
-            g_screen = static_cast<Screen>(static_cast<int>(Screen::App1) + i);
-            // Load calendar events when entering calendar
-            if (i == 0) {
-              loadCalendarEvents();
-            }
-            // Load tasks when entering todo
-            if (i == 1) {
-              loadTodoTasks();
-              g_taskScrollOffset = 0;
-            }
-            // Load photo list when entering photo frame
-            if (i == 2) {
-              loadPhotoList();
-              g_currentPhotoIndex = -1;
-            }
-          }
-          g_needsRedraw = true;
-          return;
-        }
-      }
-      return;
-    }
-
-    // Calendar navigation
-    if (g_screen == Screen::App1) {
-      // Top-left corner (100x100 area) = back to dashboard
-      if (tx < 100 && ty < 100) {
-        g_screen = Screen::Dashboard;
-        g_needsRedraw = true;
-        return;
-      }
-      
-      // Left half = previous week
-      if (tx < M5.Display.width() / 2) {
-        g_weekOffset--;
-        g_needsRedraw = true;
-        return;
-      }
-      
-      // Right half = next week
-      if (tx >= M5.Display.width() / 2) {
-        g_weekOffset++;
-        g_needsRedraw = true;
-        return;
-      }
-      return;
-    }
-
-    // Todo list navigation
-    if (g_screen == Screen::App2) {
-      // Top-left corner (100x100 area) = back to dashboard
-      if (tx < 100 && ty < 100) {
-        g_screen = Screen::Dashboard;
-        g_needsRedraw = true;
-        return;
-      }
-      
-      int visibleTasks = (M5.Display.height() - 80) / 40;
-      
-      // Left half = scroll up
-      if (tx < M5.Display.width() / 2) {
-        if (g_taskScrollOffset > 0) {
-          g_taskScrollOffset--;
-          g_needsRedraw = true;
-        }
-        return;
-      }
-      
-      // Right half = scroll down
-      if (tx >= M5.Display.width() / 2) {
-        if (g_taskScrollOffset + visibleTasks < g_taskCount) {
-          g_taskScrollOffset++;
-          g_needsRedraw = true;
-        }
-        return;
-      }
-      return;
-    }
-
-    // Photo frame navigation
-    if (g_screen == Screen::App3) {
-      // Top-left corner (100x100 area) = back to dashboard
-      if (tx < 100 && ty < 100) {
-        g_screen = Screen::Dashboard;
-        g_needsRedraw = true;
-        return;
-      }
-      
-      // Left half = previous photo
-      if (tx < M5.Display.width() / 2) {
-        if (g_photoCount > 0) {
-          g_currentPhotoIndex--;
-          if (g_currentPhotoIndex < 0) {
-            g_currentPhotoIndex = g_photoCount - 1;
-          }
-          g_lastPhotoChange = millis(); // Reset timer
-          g_forcePhotoRedraw = true;
-        }
-        return;
-      }
-      
-      // Right half = next photo
-      if (tx >= M5.Display.width() / 2) {
-        if (g_photoCount > 0) {
-          g_currentPhotoIndex++;
-          if (g_currentPhotoIndex >= g_photoCount) {
-            g_currentPhotoIndex = 0;
-          }
-          g_lastPhotoChange = millis(); // Reset timer
-          g_forcePhotoRedraw = true;
-        }
-        return;
-      }
-      return;
-    }
-
-    // Other apps: tap anywhere to go back to dashboard
-    if (g_screen != Screen::Welcome && g_screen != Screen::Dashboard) {
-      g_screen = Screen::Dashboard;
-      g_needsRedraw = true;
-      return;
-    }
+    g_tapBytesStart = g_bytesPushed;
+    screenRoot(g_screen).tap(t.x, t.y);
+    g_tapPending = g_needsRedraw;
   }
 }
@@ -0,0 +1,259 @@
+#pragma once
+
+// Generated by tools/build_assets.py from assets/ - do not edit.
+// FNV-1a of each asset as decoded by the script's qoi_decode/rle_decode,
+// over the pixels in panel byte order.
+
+const uint32_t kReferenceChecksums[] = {
+  0xB15350D2,
+  0xFC1A7B83,
+  0x99235738,
+  0x63BBC185,
+  0xFD77E91C,
+  0xFD0EE2D1,
+  0x5603262C,
+  0xE0ED3F6F,
+  0x9306DECC,
+};
+
+// Asset 6 re-encoded as RLE, so both formats are decoded
+constexpr int kAlternateAsset = 6;
+constexpr uint8_t kAlternateFormat = kAssetFormatRle;
+const uint8_t kAlternateData[3767] = {
+  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x04, 0x28, 0x61, 0x91, 0x64, 0xB1, 0xA5,
+  0x91, 0x64, 0x28, 0x61, 0x87, 0x00, 0x00, 0x00, 0x61, 0x03, 0x81, 0xA9, 0xA5, 0x00, 0x61, 0x03,
+  0x87, 0x00, 0x00, 0x04, 0x28, 0x61, 0x91, 0x64, 0xB1, 0xA5, 0x91, 0x64, 0x28, 0x61, 0xC4, 0x00,
+  0x00, 0x06, 0x18, 0x41, 0xC9, 0xE6, 0xE2, 0x07, 0xD2, 0x06, 0xE2, 0x06, 0xC9, 0xE6, 0x18, 0x41,
+  0x85, 0x00, 0x00, 0x01, 0x71, 0x23, 0xEA, 0x27, 0x81, 0xDA, 0x06, 0x01, 0xEA, 0x27, 0x71, 0x23,
+  0x85, 0x00, 0x00, 0x06, 0x18, 0x41, 0xC9, 0xE6, 0xE2, 0x07, 0xD2, 0x06, 0xE2, 0x06, 0xC9, 0xE6,
+  0x18, 0x41, 0xC3, 0x00, 0x00, 0x06, 0x71, 0x23, 0xE2, 0x27, 0xC9, 0xE6, 0xD1, 0xE6, 0xC9, 0xE6,
+  0xE2, 0x27, 0x71, 0x23, 0x84, 0x00, 0x00, 0x02, 0x10, 0x20, 0xC9, 0xE6, 0xD1, 0xE6, 0x81, 0xC9,
+  0xE6, 0x02, 0xD1, 0xE6, 0xC9, 0xE6, 0x10, 0x20, 0x84, 0x00, 0x00, 0x06, 0x71, 0x23, 0xE2, 0x27,
+  0xC9, 0xE6, 0xD1, 0xE6, 0xC9, 0xE6, 0xE2, 0x27, 0x71, 0x23, 0xC3, 0x00, 0x00, 0x06, 0x81, 0x44,
+  0xDA, 0x07, 0xC9, 0xE6, 0xD1, 0xE6, 0xC9, 0xE6, 0xDA, 0x07, 0x81, 0x44, 0x84, 0x00, 0x00, 0x00,
+  0x20, 0x41, 0x85, 0xD1, 0xE6, 0x00, 0x20, 0x41, 0x84, 0x00, 0x00, 0x06, 0x81, 0x44, 0xDA, 0x07,
+  0xC9, 0xE6, 0xD1, 0xE6, 0xC9, 0xE6, 0xDA, 0x07, 0x81, 0x44, 0xC3, 0x00, 0x00, 0x06, 0x81, 0x24,
+  0xDA, 0x07, 0xC9, 0xE6, 0xD1, 0xE6, 0xC9, 0xE6, 0xDA, 0x07, 0x81, 0x24, 0x84, 0x00, 0x00, 0x00,
+  0x18, 0x41, 0x85, 0xD1, 0xE6, 0x00, 0x18, 0x41, 0x84, 0x00, 0x00, 0x06, 0x81, 0x24, 0xDA, 0x07,
+  0xC9, 0xE6, 0xD1, 0xE6, 0xC9, 0xE6, 0xDA, 0x07, 0x81, 0x24, 0xC3, 0x00, 0x00, 0x01, 0x89, 0x23,
+  0xEA, 0x06, 0x82, 0xD9, 0xE6, 0x01, 0xEA, 0x06, 0x89, 0x23, 0x84, 0x00, 0x00, 0x00, 0x20, 0x41,
+  0x85, 0xD9, 0xE6, 0x00, 0x20, 0x41, 0x84, 0x00, 0x00, 0x01, 0x89, 0x23, 0xEA, 0x06, 0x82, 0xD9,
+  0xE6, 0x01, 0xEA, 0x06, 0x89, 0x23, 0xC3, 0x00, 0x00, 0x06, 0x49, 0x44, 0x82, 0x48, 0x7A, 0x07,
+  0x7A, 0x28, 0x7A, 0x07, 0x82, 0x48, 0x49, 0x44, 0x84, 0x00, 0x00, 0x00, 0x10, 0x41, 0x85, 0x7A,
+  0x28, 0x00, 0x10, 0x41, 0x84, 0x00, 0x00, 0x06, 0x49, 0x44, 0x82, 0x48, 0x7A, 0x07, 0x7A, 0x28,
+  0x7A, 0x07, 0x82, 0x48, 0x49, 0x44, 0xC3, 0x00, 0x00, 0x06, 0x21, 0x65, 0x42, 0x69, 0x3A, 0x28,
+  0x3A, 0x49, 0x3A, 0x28, 0x42, 0x69, 0x21, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x3A,
+  0x49, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x06, 0x21, 0x65, 0x42, 0x69, 0x3A, 0x28, 0x3A, 0x49,
+  0x3A, 0x28, 0x42, 0x69, 0x21, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x4A,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x4A, 0x28, 0x00,
+  0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x4A, 0x28, 0x01, 0x4A, 0x69,
+  0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69,
+  0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00,
+  0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00,
+  0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00,
+  0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65,
+  0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65,
+  0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41,
+  0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00,
+  0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69,
+  0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69,
+  0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00,
+  0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00,
+  0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00,
+  0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65,
+  0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65,
+  0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41,
+  0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00,
+  0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69,
+  0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69,
+  0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00,
+  0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00,
+  0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00,
+  0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65,
+  0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65,
+  0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41,
+  0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00,
+  0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69,
+  0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69,
+  0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00,
+  0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00,
+  0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00,
+  0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65,
+  0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65,
+  0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41,
+  0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00,
+  0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69,
+  0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69,
+  0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00,
+  0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00,
+  0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00,
+  0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65,
+  0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65,
+  0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41,
+  0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00,
+  0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69,
+  0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69,
+  0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00,
+  0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00,
+  0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00,
+  0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65,
+  0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65,
+  0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41,
+  0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00,
+  0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69,
+  0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69,
+  0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00,
+  0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00,
+  0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00,
+  0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65,
+  0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65,
+  0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41,
+  0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00,
+  0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69,
+  0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69,
+  0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00,
+  0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00,
+  0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00,
+  0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65,
+  0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65,
+  0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41,
+  0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00,
+  0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69,
+  0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69,
+  0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00,
+  0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00,
+  0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00,
+  0x00, 0x00, 0x08, 0x41, 0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65,
+  0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x65,
+  0x4A, 0x69, 0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0x84, 0x00, 0x00, 0x00, 0x08, 0x41,
+  0x85, 0x42, 0x28, 0x00, 0x08, 0x41, 0x84, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x69, 0x82, 0x42,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x65, 0xC3, 0x00, 0x00, 0x01, 0x29, 0x45, 0x4A, 0x69, 0x82, 0x42,
+  0x28, 0x01, 0x4A, 0x69, 0x29, 0x45, 0x84, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x42, 0x28, 0x81,
+  0x4A, 0x49, 0x81, 0x42, 0x28, 0x00, 0x00, 0x20, 0x84, 0x00, 0x00, 0x01, 0x29, 0x45, 0x4A, 0x69,
+  0x82, 0x42, 0x28, 0x01, 0x4A, 0x69, 0x29, 0x45, 0xC3, 0x00, 0x00, 0x00, 0x08, 0x61, 0x84, 0x42,
+  0x28, 0x00, 0x08, 0x61, 0x85, 0x00, 0x00, 0x01, 0x29, 0x65, 0x4A, 0x49, 0x81, 0x42, 0x08, 0x01,
+  0x4A, 0x49, 0x29, 0x65, 0x85, 0x00, 0x00, 0x00, 0x08, 0x61, 0x84, 0x42, 0x28, 0x00, 0x08, 0x61,
+  0xC4, 0x00, 0x00, 0x04, 0x18, 0xC3, 0x52, 0xAA, 0x4A, 0x49, 0x52, 0xAA, 0x18, 0xC3, 0x87, 0x00,
+  0x00, 0x00, 0x42, 0x08, 0x81, 0x52, 0x8A, 0x00, 0x42, 0x08, 0x87, 0x00, 0x00, 0x04, 0x18, 0xC3,
+  0x52, 0xAA, 0x4A, 0x49, 0x52, 0xAA, 0x18, 0xC3, 0xC5, 0x00, 0x00, 0x04, 0x08, 0x61, 0x8C, 0x71,
+  0x94, 0x92, 0x8C, 0x71, 0x08, 0x61, 0x87, 0x00, 0x00, 0x00, 0x52, 0x8A, 0x81, 0x9C, 0xD3, 0x00,
+  0x52, 0x8A, 0x87, 0x00, 0x00, 0x04, 0x08, 0x61, 0x8C, 0x71, 0x94, 0x92, 0x8C, 0x71, 0x08, 0x61,
+  0xC5, 0x00, 0x00, 0x04, 0x10, 0x82, 0x8C, 0x71, 0x94, 0xB2, 0x8C, 0x71, 0x10, 0x82, 0x87, 0x00,
+  0x00, 0x00, 0x52, 0x8A, 0x81, 0x9C, 0xF3, 0x00, 0x52, 0x8A, 0x87, 0x00, 0x00, 0x04, 0x10, 0x82,
+  0x8C, 0x71, 0x94, 0xB2, 0x8C, 0x71, 0x10, 0x82, 0xC5, 0x00, 0x00, 0x04, 0x10, 0x82, 0x8C, 0x71,
+  0x94, 0xB2, 0x8C, 0x71, 0x10, 0x82, 0x87, 0x00, 0x00, 0x00, 0x52, 0x8A, 0x81, 0x9C, 0xD3, 0x00,
+  0x52, 0x8A, 0x87, 0x00, 0x00, 0x04, 0x10, 0x82, 0x8C, 0x71, 0x94, 0xB2, 0x8C, 0x71, 0x10, 0x82,
+  0xC5, 0x00, 0x00, 0x04, 0x10, 0x82, 0x8C, 0x71, 0x94, 0xB2, 0x8C, 0x71, 0x10, 0x82, 0x87, 0x00,
+  0x00, 0x00, 0x52, 0x8A, 0x81, 0x9C, 0xD3, 0x00, 0x52, 0x8A, 0x87, 0x00, 0x00, 0x04, 0x10, 0x82,
+  0x8C, 0x71, 0x94, 0xB2, 0x8C, 0x71, 0x10, 0x82, 0xC5, 0x00, 0x00, 0x04, 0x10, 0x82, 0x8C, 0x71,
+  0x94, 0xB2, 0x8C, 0x71, 0x10, 0x82, 0x87, 0x00, 0x00, 0x00, 0x52, 0x8A, 0x81, 0x9C, 0xD3, 0x00,
+  0x52, 0x8A, 0x87, 0x00, 0x00, 0x04, 0x10, 0x82, 0x8C, 0x71, 0x94, 0xB2, 0x8C, 0x71, 0x10, 0x82,
+  0xC5, 0x00, 0x00, 0x04, 0x10, 0x82, 0x8C, 0x71, 0x94, 0xB2, 0x8C, 0x71, 0x10, 0x82, 0x87, 0x00,
+  0x00, 0x00, 0x52, 0x8A, 0x81, 0x9C, 0xD3, 0x00, 0x52, 0x8A, 0x87, 0x00, 0x00, 0x04, 0x10, 0x82,
+  0x8C, 0x71, 0x94, 0xB2, 0x8C, 0x71, 0x10, 0x82, 0xC5, 0x00, 0x00, 0x04, 0x10, 0x82, 0x8C, 0x71,
+  0x94, 0xB2, 0x8C, 0x71, 0x10, 0x82, 0x87, 0x00, 0x00, 0x00, 0x52, 0x8A, 0x81, 0x9C, 0xD3, 0x00,
+  0x52, 0x8A, 0x87, 0x00, 0x00, 0x04, 0x10, 0x82, 0x8C, 0x71, 0x94, 0xB2, 0x8C, 0x71, 0x10, 0x82,
+  0xC5, 0x00, 0x00, 0x04, 0x10, 0x82, 0x8C, 0x71, 0x94, 0xB2, 0x8C, 0x71, 0x10, 0x82, 0x87, 0x00,
+  0x00, 0x00, 0x52, 0x8A, 0x81, 0x9C, 0xD3, 0x00, 0x52, 0x8A, 0x87, 0x00, 0x00, 0x04, 0x10, 0x82,
+  0x8C, 0x71, 0x94, 0xB2, 0x8C, 0x71, 0x10, 0x82, 0xC5, 0x00, 0x00, 0x04, 0x10, 0x82, 0x8C, 0x71,
+  0x94, 0xB2, 0x8C, 0x71, 0x10, 0x82, 0x87, 0x00, 0x00, 0x00, 0x52, 0x8A, 0x81, 0x9C, 0xD3, 0x00,
+  0x52, 0x8A, 0x87, 0x00, 0x00, 0x04, 0x10, 0x82, 0x8C, 0x71, 0x94, 0xB2, 0x8C, 0x71, 0x10, 0x82,
+  0xC5, 0x00, 0x00, 0x04, 0x08, 0x61, 0x8C, 0x92, 0x94, 0xD3, 0x8C, 0x92, 0x08, 0x61, 0x87, 0x00,
+  0x00, 0x00, 0x4A, 0x8A, 0x81, 0x9C, 0xF3, 0x00, 0x4A, 0x8A, 0x87, 0x00, 0x00, 0x04, 0x08, 0x61,
+  0x8C, 0x92, 0x94, 0xD3, 0x8C, 0x92, 0x08, 0x61, 0xBC, 0x00, 0x00, 0x02, 0x08, 0x00, 0x18, 0x41,
+  0x18, 0x20, 0x83, 0x18, 0x40, 0x08, 0x18, 0x41, 0x18, 0x40, 0x20, 0xA2, 0x94, 0x30, 0x9C, 0x71,
+  0x94, 0x30, 0x20, 0xA2, 0x18, 0x40, 0x18, 0x41, 0x83, 0x18, 0x40, 0x02, 0x18, 0x41, 0x18, 0x40,
+  0x62, 0x8A, 0x81, 0xA4, 0x92, 0x02, 0x62, 0x8A, 0x18, 0x40, 0x18, 0x41, 0x83, 0x18, 0x40, 0x08,
+  0x18, 0x41, 0x18, 0x40, 0x20, 0xA2, 0x94, 0x30, 0x9C, 0x71, 0x94, 0x30, 0x20, 0xA2, 0x18, 0x40,
+  0x18, 0x41, 0x82, 0x18, 0x40, 0x81, 0x10, 0x20, 0x01, 0x18, 0x20, 0x08, 0x00, 0xB3, 0x00, 0x00,
+  0x02, 0x58, 0xE3, 0xEA, 0x48, 0xD2, 0x28, 0x86, 0xDA, 0x28, 0x82, 0xDA, 0x48, 0x89, 0xDA, 0x28,
+  0x81, 0xDA, 0x48, 0x89, 0xDA, 0x28, 0x82, 0xDA, 0x48, 0x85, 0xDA, 0x28, 0x03, 0xCA, 0x06, 0xC1,
+  0xC6, 0xDA, 0x06, 0x58, 0xC2, 0xB3, 0x00, 0x00, 0x02, 0x60, 0xE3, 0xF2, 0x69, 0xDA, 0x28, 0x86,
+  0xE2, 0x48, 0x82, 0xE2, 0x28, 0x88, 0xE2, 0x48, 0x83, 0xE2, 0x28, 0x88, 0xE2, 0x48, 0x82, 0xE2,
+  0x28, 0x85, 0xE2, 0x48, 0x03, 0xDA, 0x07, 0xC9, 0xE6, 0xE2, 0x27, 0x58, 0xE2, 0xB3, 0x00, 0x00,
+  0x01, 0x60, 0xE3, 0xEA, 0x69, 0xA9, 0xDA, 0x28, 0x03, 0xD1, 0xE6, 0xC9, 0xE6, 0xDA, 0x27, 0x58,
+  0xE2, 0xB3, 0x00, 0x00, 0x02, 0x58, 0xE3, 0xE2, 0x27, 0xD1, 0xE6, 0xA7, 0xD2, 0x06, 0x81, 0xD1,
+  0xE6, 0x02, 0xC9, 0xE6, 0xE2, 0x27, 0x58, 0xE2, 0xB3, 0x00, 0x00, 0x02, 0x58, 0xE2, 0xDA, 0x26,
+  0xC9, 0xE6, 0xA9, 0xD1, 0xE6, 0x02, 0xC9, 0xE6, 0xDA, 0x27, 0x58, 0xE2, 0xB3, 0x00, 0x00, 0x01,
+  0x58, 0xE3, 0xE2, 0x27, 0x81, 0xD2, 0x06, 0x00, 0xD1, 0xE6, 0xA5, 0xD2, 0x06, 0x00, 0xD1, 0xE6,
+  0x81, 0xD2, 0x06, 0x01, 0xE2, 0x27, 0x58, 0xE3, 0xB3, 0x00, 0x00, 0x00, 0x10, 0x20, 0x81, 0x28,
+  0x61, 0x02, 0x50, 0xC2, 0xB9, 0x85, 0xA9, 0x65, 0xA3, 0xB1, 0x65, 0x02, 0xA9, 0x65, 0xB9, 0x85,
+  0x50, 0xC2, 0x81, 0x28, 0x61, 0x00, 0x10, 0x20, 0xB6, 0x00, 0x00, 0x01, 0x28, 0x61, 0xB1, 0x64,
+  0xA5, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x28, 0x61, 0xB9, 0x00, 0x00, 0x01, 0x30, 0x61, 0xB1, 0x64,
+  0xA5, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x30, 0x61, 0xB9, 0x00, 0x00, 0x01, 0x30, 0x61, 0xB1, 0x64,
+  0xA5, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x30, 0x61, 0xB9, 0x00, 0x00, 0x01, 0x30, 0x61, 0xB1, 0x64,
+  0x90, 0xA1, 0x44, 0x83, 0xA9, 0x64, 0x90, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x30, 0x61, 0xB9, 0x00,
+  0x00, 0x01, 0x30, 0x61, 0xB1, 0x64, 0x8E, 0xA1, 0x44, 0x02, 0xA9, 0x64, 0xA1, 0x44, 0xA1, 0x04,
+  0x81, 0xA0, 0xE4, 0x02, 0xA1, 0x04, 0xA1, 0x44, 0xA9, 0x64, 0x8E, 0xA1, 0x44, 0x01, 0xB1, 0x64,
+  0x30, 0x61, 0xB9, 0x00, 0x00, 0x01, 0x30, 0x61, 0xB1, 0x64, 0x8D, 0xA1, 0x44, 0x03, 0xA9, 0x64,
+  0xA1, 0x24, 0xA9, 0x64, 0xC3, 0x27, 0x81, 0xD4, 0x29, 0x03, 0xC3, 0x07, 0xA1, 0x44, 0xA1, 0x24,
+  0xA9, 0x64, 0x8D, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x30, 0x61, 0xB9, 0x00, 0x00, 0x01, 0x30, 0x61,
+  0xB1, 0x64, 0x8C, 0xA1, 0x44, 0x03, 0xA9, 0x64, 0xA1, 0x24, 0xB2, 0x05, 0xED, 0xAB, 0x83, 0xFE,
+  0xED, 0x03, 0xE5, 0x4A, 0xA9, 0xA4, 0xA1, 0x24, 0xA9, 0x64, 0x8C, 0xA1, 0x44, 0x01, 0xB1, 0x64,
+  0x30, 0x61, 0xB9, 0x00, 0x00, 0x01, 0x30, 0x61, 0xB1, 0x64, 0x8D, 0xA1, 0x44, 0x03, 0xA9, 0x64,
+  0xED, 0xCB, 0xFE, 0xED, 0xF6, 0x6C, 0x81, 0xFE, 0x6C, 0x03, 0xF6, 0x6C, 0xFE, 0xCC, 0xE4, 0xC7,
+  0xA9, 0x64, 0x8D, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x30, 0x61, 0xB9, 0x00, 0x00, 0x01, 0x30, 0x61,
+  0xB1, 0x64, 0x8B, 0xA1, 0x44, 0x04, 0xA9, 0x64, 0xA1, 0x04, 0xCB, 0x88, 0xFE, 0xED, 0xF6, 0x6C,
+  0x83, 0xFE, 0x8C, 0x04, 0xF6, 0x6C, 0xF5, 0xE9, 0xC2, 0xE5, 0xA1, 0x04, 0xA9, 0x64, 0x8B, 0xA1,
+  0x44, 0x01, 0xB1, 0x64, 0x30, 0x61, 0xB9, 0x00, 0x00, 0x01, 0x30, 0x61, 0xB1, 0x64, 0x8B, 0xA1,
+  0x44, 0x03, 0xA9, 0x64, 0xA1, 0x04, 0xDC, 0xCA, 0xFE, 0xED, 0x84, 0xFE, 0x8C, 0x04, 0xFE, 0x6C,
+  0xF5, 0xC8, 0xD3, 0xE6, 0xA1, 0x04, 0xA9, 0x64, 0x8B, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x30, 0x61,
+  0xB9, 0x00, 0x00, 0x01, 0x30, 0x61, 0xB1, 0x64, 0x8B, 0xA1, 0x44, 0x03, 0xA9, 0x64, 0xA1, 0x04,
+  0xDC, 0xEA, 0xFE, 0xCD, 0x83, 0xFE, 0x8C, 0x05, 0xFE, 0xAD, 0xF6, 0x2B, 0xF5, 0xA8, 0xDC, 0x07,
+  0xA1, 0x04, 0xA9, 0x64, 0x8B, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x30, 0x61, 0xB9, 0x00, 0x00, 0x01,
+  0x30, 0x61, 0xB1, 0x64, 0x8B, 0xA1, 0x44, 0x04, 0xA9, 0x64, 0xA0, 0xE4, 0xD3, 0xE8, 0xFF, 0x0D,
+  0xF6, 0x6C, 0x81, 0xFE, 0x8C, 0x06, 0xFE, 0xAD, 0xFE, 0x8C, 0xF5, 0x88, 0xF5, 0xA8, 0xCB, 0x46,
+  0xA1, 0x04, 0xA9, 0x64, 0x8B, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x30, 0x61, 0xB9, 0x00, 0x00, 0x01,
+  0x30, 0x61, 0xB1, 0x64, 0x8B, 0xA1, 0x44, 0x04, 0xA1, 0x64, 0xA1, 0x24, 0xA9, 0xC5, 0xF6, 0x2B,
+  0xFE, 0xAC, 0x81, 0xFE, 0x8C, 0x00, 0xF6, 0x4B, 0x81, 0xF5, 0x88, 0x03, 0xED, 0x48, 0xA9, 0xA5,
+  0xA1, 0x44, 0xA1, 0x64, 0x8B, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x30, 0x61, 0xB9, 0x00, 0x00, 0x01,
+  0x30, 0x61, 0xB1, 0x64, 0x8C, 0xA1, 0x44, 0x0B, 0xA9, 0x64, 0xA1, 0x04, 0xBA, 0x65, 0xF5, 0x89,
+  0xFE, 0x09, 0xF5, 0xC9, 0xF5, 0x88, 0xF5, 0xA8, 0xED, 0x48, 0xBA, 0x65, 0xA1, 0x24, 0xA9, 0x64,
+  0x8C, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x30, 0x61, 0xB9, 0x00, 0x00, 0x01, 0x30, 0x61, 0xB1, 0x64,
+  0x8D, 0xA1, 0x44, 0x09, 0xA9, 0x64, 0xA1, 0x24, 0xA9, 0xC4, 0xD3, 0x86, 0xDC, 0x67, 0xDC, 0x87,
+  0xD3, 0xA6, 0xB1, 0xC5, 0xA1, 0x24, 0xA9, 0x64, 0x8D, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x30, 0x61,
+  0xB9, 0x00, 0x00, 0x01, 0x30, 0x61, 0xB1, 0x64, 0x8E, 0xA1, 0x44, 0x02, 0xA9, 0x64, 0xA1, 0x44,
+  0xA1, 0x04, 0x81, 0xA1, 0x24, 0x02, 0xA1, 0x04, 0xA1, 0x24, 0xA9, 0x64, 0x8E, 0xA1, 0x44, 0x01,
+  0xB1, 0x64, 0x30, 0x61, 0xB9, 0x00, 0x00, 0x01, 0x30, 0x61, 0xB1, 0x64, 0x8F, 0xA1, 0x44, 0x81,
+  0xA9, 0x64, 0x81, 0xA1, 0x64, 0x81, 0xA9, 0x64, 0x8F, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x30, 0x61,
+  0xB9, 0x00, 0x00, 0x01, 0x30, 0x61, 0xB1, 0x64, 0xA5, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x30, 0x61,
+  0xB9, 0x00, 0x00, 0x01, 0x30, 0x61, 0xB1, 0x64, 0xA5, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x30, 0x61,
+  0xB9, 0x00, 0x00, 0x01, 0x30, 0x61, 0xB1, 0x64, 0x87, 0xA1, 0x44, 0x95, 0xA9, 0x44, 0x87, 0xA1,
+  0x44, 0x01, 0xB1, 0x64, 0x30, 0x61, 0xB9, 0x00, 0x00, 0x01, 0x30, 0x61, 0xB1, 0x64, 0xA5, 0xA1,
+  0x44, 0x01, 0xB1, 0x64, 0x30, 0x61, 0xB9, 0x00, 0x00, 0x01, 0x30, 0x61, 0xB1, 0x64, 0x85, 0xA1,
+  0x44, 0x02, 0xA9, 0x44, 0xA1, 0x44, 0x20, 0x41, 0x93, 0x10, 0x20, 0x02, 0x20, 0x41, 0xA1, 0x44,
+  0xA9, 0x44, 0x85, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x30, 0x61, 0xB9, 0x00, 0x00, 0x01, 0x30, 0x61,
+  0xB1, 0x64, 0x85, 0xA1, 0x44, 0x02, 0xA9, 0x44, 0xA1, 0x44, 0x08, 0x20, 0x93, 0x00, 0x00, 0x02,
+  0x08, 0x20, 0xA1, 0x44, 0xA9, 0x44, 0x85, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x30, 0x61, 0xB9, 0x00,
+  0x00, 0x01, 0x30, 0x61, 0xB1, 0x64, 0x85, 0xA1, 0x44, 0x02, 0xA9, 0x44, 0xA1, 0x44, 0x10, 0x20,
+  0x93, 0x00, 0x00, 0x02, 0x10, 0x20, 0xA1, 0x44, 0xA9, 0x44, 0x85, 0xA1, 0x44, 0x01, 0xB1, 0x64,
+  0x30, 0x61, 0xB9, 0x00, 0x00, 0x01, 0x30, 0x61, 0xB1, 0x64, 0x85, 0xA1, 0x44, 0x02, 0xA9, 0x44,
+  0xA1, 0x44, 0x10, 0x20, 0x93, 0x00, 0x00, 0x02, 0x10, 0x20, 0xA1, 0x44, 0xA9, 0x44, 0x85, 0xA1,
+  0x44, 0x01, 0xB1, 0x64, 0x30, 0x61, 0xB9, 0x00, 0x00, 0x01, 0x30, 0x61, 0xB1, 0x64, 0x85, 0xA1,
+  0x44, 0x02, 0xA9, 0x44, 0xA1, 0x44, 0x10, 0x20, 0x93, 0x00, 0x00, 0x02, 0x10, 0x20, 0xA1, 0x44,
+  0xA9, 0x44, 0x85, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x30, 0x61, 0xB9, 0x00, 0x00, 0x01, 0x30, 0x61,
+  0xB1, 0x64, 0x85, 0xA1, 0x44, 0x02, 0xA9, 0x44, 0xA1, 0x44, 0x10, 0x20, 0x93, 0x00, 0x00, 0x02,
+  0x10, 0x20, 0xA1, 0x44, 0xA9, 0x44, 0x85, 0xA1, 0x44, 0x01, 0xB1, 0x64, 0x30, 0x61, 0xB9, 0x00,
+  0x00, 0x02, 0x30, 0x61, 0xB1, 0x65, 0xA9, 0x44, 0x85, 0xA9, 0x64, 0x01, 0xA9, 0x44, 0x10, 0x20,
+  0x93, 0x00, 0x00, 0x01, 0x10, 0x20, 0xA9, 0x44, 0x85, 0xA9, 0x64, 0x02, 0xA9, 0x44, 0xB1, 0x65,
+  0x30, 0x61, 0xB9, 0x00, 0x00, 0x02, 0x28, 0x61, 0x91, 0x24, 0x89, 0x03, 0x83, 0x89, 0x23, 0x03,
+  0x89, 0x03, 0x89, 0x23, 0x89, 0x03, 0x08, 0x20, 0x93, 0x00, 0x00, 0x03, 0x08, 0x20, 0x89, 0x03,
+  0x89, 0x23, 0x89, 0x03, 0x83, 0x89, 0x23, 0x02, 0x89, 0x03, 0x91, 0x24, 0x28, 0x61, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xC8, 0x00, 0x00,
+};
@@ -0,0 +1,118 @@
+// AssetDecoder on every image in assets_generated.h, checked against the
+// checksums of tools/build_assets.py's reference qoi_decode/rle_decode, whole
+// and in the stripe sizes drawCompressedImage uses, plus its host decode time.
+#include <unity.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+#include "assets_generated.h"
+#include "reference_assets.h"
+
+// Same FNV-1a as the script: pixels as big-endian RGB565, i.e. panel byte order
+uint32_t pixelChecksum(const std::vector<uint16_t>& pixels) {
+  uint32_t h = 0x811C9DC5;
+  for (uint16_t p : pixels) {
+    const uint8_t* bytes = (const uint8_t*)&p;  // Already in panel byte order
+    h = (h ^ bytes[0]) * 0x01000193;
+    h = (h ^ bytes[1]) * 0x01000193;
+  }
+  return h;
+}
+
+// Decode image `stripe` pixels per read, as the draw path does a few rows at a time
+std::vector<uint16_t> decode(const CompressedImage& image, int stripe) {
+  int count = image.width * image.height;
+  std::vector<uint16_t> pixels(count);
+  AssetDecoder decoder(image);
+  for (int at = 0; at < count; at += stripe) {
+    int n = count - at < stripe ? count - at : stripe;
+    TEST_ASSERT_TRUE_MESSAGE(decoder.read(pixels.data() + at, n), "decoder ran out of data");
+  }
+  return pixels;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_reference_covers_every_asset() {
+  TEST_ASSERT_EQUAL_INT(kAssetCount, sizeof(kReferenceChecksums) / sizeof(kReferenceChecksums[0]));
+}
+
+void test_assets_match_reference() {
+  for (int i = 0; i < kAssetCount; ++i) {
+    const CompressedImage& image = kAssets[i];
+    char message[48];
+    snprintf(message, sizeof(message), "asset %d", i);
+    uint32_t checksum = pixelChecksum(decode(image, image.width * image.height));
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE(kReferenceChecksums[i], checksum, message);
+  }
+}
+
+void test_assets_match_reference_in_stripes() {
+  // Odd sizes put run and literal boundaries mid-read
+  for (int stripe : {1, 7, 61, 100 * 8}) {
+    for (int i = 0; i < kAssetCount; ++i) {
+      char message[48];
+      snprintf(message, sizeof(message), "asset %d, stripe %d", i, stripe);
+      uint32_t checksum = pixelChecksum(decode(kAssets[i], stripe));
+      TEST_ASSERT_EQUAL_HEX32_MESSAGE(kReferenceChecksums[i], checksum, message);
+    }
+  }
+}
+
+void test_alternate_format_matches_reference() {
+  const CompressedImage& stored = kAssets[kAlternateAsset];
+  TEST_ASSERT_TRUE(kAlternateFormat != stored.format);
+  CompressedImage image = {stored.width, stored.height, kAlternateFormat, sizeof(kAlternateData), kAlternateData};
+  for (int stripe : {1, 7, image.width * image.height}) {
+    TEST_ASSERT_EQUAL_HEX32(kReferenceChecksums[kAlternateAsset], pixelChecksum(decode(image, stripe)));
+  }
+}
+
+void test_truncated_data_fails() {
+  for (int i = 0; i < kAssetCount; ++i) {
+    CompressedImage image = kAssets[i];
+    image.size /= 2;
+    std::vector<uint16_t> pixels(image.width * image.height);
+    AssetDecoder decoder(image);
+    TEST_ASSERT_FALSE(decoder.read(pixels.data(), pixels.size()));
+  }
+}
+
+// Host timing only; device figures come from the dashboard draw log line
+void test_decode_time() {
+  constexpr int kRuns = 200;
+  std::vector<uint16_t> pixels(150 * 150);
+  uint32_t checksum = 0;
+  double assetMs[kAssetCount] = {};
+  for (int i = 0; i < kAssetCount; ++i) {
+    const CompressedImage& image = kAssets[i];
+    auto start = std::chrono::steady_clock::now();
+    for (int run = 0; run < kRuns; ++run) {
+      AssetDecoder decoder(image);
+      decoder.read(pixels.data(), image.width * image.height);
+      checksum += pixels[run % (image.width * image.height)];
+    }
+    assetMs[i] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / kRuns;
+  }
+  double totalMs = 0;
+  for (double ms : assetMs) totalMs += ms;
+  char message[96];
+  snprintf(message, sizeof(message), "all %d assets: %.3f ms, logo: %.3f ms (checksum %08X)",
+           kAssetCount, totalMs, assetMs[kAssetLogo], (unsigned)checksum);
+  TEST_MESSAGE(message);
+  TEST_ASSERT_TRUE(totalMs > 0);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_reference_covers_every_asset);
+  RUN_TEST(test_assets_match_reference);
+  RUN_TEST(test_assets_match_reference_in_stripes);
+  RUN_TEST(test_alternate_format_matches_reference);
+  RUN_TEST(test_truncated_data_fails);
+  RUN_TEST(test_decode_time);
+  return UNITY_END();
+}
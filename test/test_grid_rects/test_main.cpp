@@ -0,0 +1,144 @@
+// fillGridRects must paint exactly the pixels of the set cells, whatever
+// the mask, and in fewer fills than one per cell on structured grids
+#include <unity.h>
+
+#include <stdio.h>
+#include <vector>
+
+#include "grid_rects.h"
+
+// Records fills into a pixel bitmap
+struct MaskGfx {
+  int w;
+  int h;
+  std::vector<uint8_t> pixels;
+  int fills = 0;
+  bool outOfBounds = false;
+
+  MaskGfx(int w, int h) : w(w), h(h), pixels(w * h) {}
+
+  void fillRect(int x, int y, int rw, int rh, uint32_t color) {
+    fills++;
+    if (x < 0 || y < 0 || rw <= 0 || rh <= 0 || x + rw > w || y + rh > h) {
+      outOfBounds = true;
+      return;
+    }
+    for (int r = y; r < y + rh; ++r) {
+      for (int c = x; c < x + rw; ++c) pixels[r * w + c] = (uint8_t)color;
+    }
+  }
+};
+
+struct Mask {
+  int cols;
+  std::vector<uint8_t> cells;
+};
+
+bool isMaskSet(const void* ctx, int col, int row) {
+  const Mask* mask = (const Mask*)ctx;
+  return mask->cells[row * mask->cols + col];
+}
+
+uint32_t g_seed = 99;
+uint32_t nextRandom() {
+  g_seed = g_seed * 1664525u + 1013904223u;
+  return g_seed >> 8;
+}
+
+// Paint the grid and compare every pixel with the cell it belongs to
+GridStats checkCoverage(int cols, int rows, bool (*isSet)(const void*, int, int), const void* ctx,
+                        const std::vector<int>& colEdges, const std::vector<int>& rowEdges) {
+  MaskGfx gfx(colEdges[cols], rowEdges[rows]);
+  GridStats stats = fillGridRects(gfx, cols, rows, isSet, ctx, colEdges.data(), rowEdges.data(), 1);
+  TEST_ASSERT_FALSE(gfx.outOfBounds);
+  TEST_ASSERT_EQUAL_INT(stats.rects, gfx.fills);
+  int modules = 0;
+  for (int row = 0; row < rows; ++row) {
+    for (int col = 0; col < cols; ++col) {
+      bool set = isSet(ctx, col, row);
+      modules += set;
+      for (int y = rowEdges[row]; y < rowEdges[row + 1]; ++y) {
+        for (int x = colEdges[col]; x < colEdges[col + 1]; ++x) {
+          TEST_ASSERT_EQUAL_INT_MESSAGE(set, gfx.pixels[y * gfx.w + x], "pixel coverage");
+        }
+      }
+    }
+  }
+  TEST_ASSERT_EQUAL_INT(modules, stats.modules);
+  TEST_ASSERT_TRUE(stats.rects <= stats.modules);
+  return stats;
+}
+
+std::vector<int> uniformEdges(int count, int start, int size) {
+  std::vector<int> edges(count + 1);
+  uniformGridEdges(edges.data(), count, start, size);
+  return edges;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_random_masks() {
+  const int sizes[] = {21, 25, 60, 177};
+  const int densities[] = {10, 50, 90};
+  for (int size : sizes) {
+    for (int density : densities) {
+      Mask mask = {size, std::vector<uint8_t>(size * size)};
+      for (auto& cell : mask.cells) cell = (int)(nextRandom() % 100) < density;
+      checkCoverage(size, size, isMaskSet, &mask, uniformEdges(size, 0, 3), uniformEdges(size, 0, 3));
+    }
+  }
+}
+
+void test_random_mask_uneven_cells() {
+  const int cols = 40, rows = 30;
+  Mask mask = {cols, std::vector<uint8_t>(cols * rows)};
+  for (auto& cell : mask.cells) cell = nextRandom() % 2;
+  std::vector<int> colEdges(cols + 1), rowEdges(rows + 1);
+  for (int i = 1; i <= cols; ++i) colEdges[i] = colEdges[i - 1] + 1 + nextRandom() % 4;
+  for (int i = 1; i <= rows; ++i) rowEdges[i] = rowEdges[i - 1] + 1 + nextRandom() % 4;
+  checkCoverage(cols, rows, isMaskSet, &mask, colEdges, rowEdges);
+}
+
+void test_calendar_lattice() {
+  // Seven days of 80 px between 1 px border lines, on a 500 px wide view
+  std::vector<int> colEdges = {0, 1, 499, 500};
+  std::vector<int> rowEdges(7 * 3 + 1);
+  for (int day = 0; day < 7; ++day) {
+    rowEdges[day * 3] = 40 + day * 80;
+    rowEdges[day * 3 + 1] = 40 + day * 80 + 1;
+    rowEdges[day * 3 + 2] = 40 + day * 80 + 79;
+  }
+  rowEdges[7 * 3] = 40 + 7 * 80;
+  GridStats stats = checkCoverage(3, 7 * 3, isCalendarBorderCell, nullptr, colEdges, rowEdges);
+  char message[64];
+  snprintf(message, sizeof(message), "calendar borders: %d cells in %d fills", stats.modules, stats.rects);
+  TEST_MESSAGE(message);
+  // 28 separate lines before; now 2 full-height sides and 8 horizontal lines
+  TEST_ASSERT_EQUAL_INT(10, stats.rects);
+}
+
+void test_full_and_empty_grids() {
+  Mask full = {8, std::vector<uint8_t>(64, 1)};
+  TEST_ASSERT_EQUAL_INT(1, checkCoverage(8, 8, isMaskSet, &full, uniformEdges(8, 5, 2), uniformEdges(8, 5, 2)).rects);
+  Mask empty = {8, std::vector<uint8_t>(64, 0)};
+  TEST_ASSERT_EQUAL_INT(0, checkCoverage(8, 8, isMaskSet, &empty, uniformEdges(8, 0, 2), uniformEdges(8, 0, 2)).rects);
+}
+
+void test_oversized_grid_draws_nothing() {
+  MaskGfx gfx(1, 1);
+  std::vector<int> edges(200, 0);
+  GridStats stats = fillGridRects(gfx, 178, 178, isCalendarBorderCell, nullptr, edges.data(), edges.data(), 1);
+  TEST_ASSERT_EQUAL_INT(0, stats.rects);
+  TEST_ASSERT_EQUAL_INT(0, gfx.fills);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_random_masks);
+  RUN_TEST(test_random_mask_uneven_cells);
+  RUN_TEST(test_calendar_lattice);
+  RUN_TEST(test_full_and_empty_grids);
+  RUN_TEST(test_oversized_grid_draws_nothing);
+  return UNITY_END();
+}
@@ -0,0 +1,214 @@
+// resampleRgb565 against a straightforward reference: rotate the source
+// upright first, then box-filter or bilinear-sample it pixel by pixel. Every
+// EXIF orientation is run through every fit mode's geometry.
+#include <unity.h>
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+#include "resample_rgb565.h"
+
+constexpr int kPanelW = 1280;
+constexpr int kPanelH = 720;
+
+uint32_t g_seed = 1;
+uint32_t nextRandom() {
+  g_seed = g_seed * 1664525u + 1013904223u;
+  return g_seed >> 8;
+}
+
+uint16_t swap16(uint16_t v) {
+  return (v << 8) | (v >> 8);
+}
+
+// Smooth gradients plus noise, so both filters see real variation
+std::vector<uint16_t> makeImage(int w, int h) {
+  std::vector<uint16_t> image(w * h);
+  for (int y = 0; y < h; ++y) {
+    for (int x = 0; x < w; ++x) {
+      uint32_t noise = nextRandom();
+      uint16_t r = (x * 31 / w + (noise & 3)) & 31;
+      uint16_t g = (y * 63 / h + ((noise >> 2) & 7)) & 63;
+      uint16_t b = ((x + y) & 31) ^ ((noise >> 5) & 1);
+      image[y * w + x] = swap16((r << 11) | (g << 5) | b);
+    }
+  }
+  return image;
+}
+
+// EXIF orientation, from its definition: the stored pixel shown at upright (x, y)
+uint16_t uprightPixel(const std::vector<uint16_t>& src, int w, int h, int orientation, int x, int y) {
+  int sx = x, sy = y;
+  switch (orientation) {
+    case 2: sx = w - 1 - x; sy = y; break;
+    case 3: sx = w - 1 - x; sy = h - 1 - y; break;
+    case 4: sx = x; sy = h - 1 - y; break;
+    case 5: sx = y; sy = x; break;
+    case 6: sx = y; sy = h - 1 - x; break;
+    case 7: sx = w - 1 - y; sy = h - 1 - x; break;
+    case 8: sx = w - 1 - y; sy = x; break;
+  }
+  return swap16(src[sy * w + sx]);
+}
+
+int channel(uint16_t c, int i) {
+  return i == 0 ? c >> 11 : i == 1 ? (c >> 5) & 63 : c & 31;
+}
+
+uint16_t fromChannels(const int* c) {
+  return (c[0] << 11) | (c[1] << 5) | c[2];
+}
+
+// Reference on an explicitly rotated and cropped copy. Sample positions use
+// the resampler's 16.16 steps; box averages round to nearest.
+std::vector<uint16_t> referenceResample(const std::vector<uint16_t>& src, int w, int h, int orientation,
+                                        const ResampleCrop& crop, int dstW, int dstH) {
+  std::vector<uint16_t> window(crop.w * crop.h);
+  for (int y = 0; y < crop.h; ++y) {
+    for (int x = 0; x < crop.w; ++x) {
+      window[y * crop.w + x] = uprightPixel(src, w, h, orientation, crop.x + x, crop.y + y);
+    }
+  }
+  auto at = [&](int x, int y) { return window[y * crop.w + x]; };
+
+  std::vector<uint16_t> out(dstW * dstH);
+  uint32_t xStep = ((uint32_t)crop.w << 16) / dstW;
+  uint32_t yStep = ((uint32_t)crop.h << 16) / dstH;
+  bool box = crop.w >= dstW && crop.h >= dstH;
+  for (int dy = 0; dy < dstH; ++dy) {
+    for (int dx = 0; dx < dstW; ++dx) {
+      int c[3];
+      if (box) {
+        int x0 = (dx * xStep) >> 16, x1 = std::max(x0 + 1, (int)(((dx + 1) * xStep) >> 16));
+        int y0 = (dy * yStep) >> 16, y1 = std::max(y0 + 1, (int)(((dy + 1) * yStep) >> 16));
+        int n = (x1 - x0) * (y1 - y0);
+        for (int i = 0; i < 3; ++i) {
+          int sum = 0;
+          for (int y = y0; y < y1; ++y) {
+            for (int x = x0; x < x1; ++x) sum += channel(at(x, y), i);
+          }
+          c[i] = (sum * 2 + n) / (2 * n);
+        }
+      } else {
+        int fx = std::max(0, (int)(dx * xStep + xStep / 2) - 32768);
+        int fy = std::max(0, (int)(dy * yStep + yStep / 2) - 32768);
+        int x0 = std::min(fx >> 16, crop.w - 1), x1 = std::min(x0 + 1, crop.w - 1);
+        int y0 = std::min(fy >> 16, crop.h - 1), y1 = std::min(y0 + 1, crop.h - 1);
+        int wx = (fx >> 11) & 31, wy = (fy >> 11) & 31;
+        for (int i = 0; i < 3; ++i) {
+          int top = (channel(at(x0, y0), i) * (32 - wx) + channel(at(x1, y0), i) * wx) >> 5;
+          int bottom = (channel(at(x0, y1), i) * (32 - wx) + channel(at(x1, y1), i) * wx) >> 5;
+          c[i] = (top * (32 - wy) + bottom * wy) >> 5;
+        }
+      }
+      out[dy * dstW + dx] = fromChannels(c);
+    }
+  }
+  return out;
+}
+
+// Largest per-channel difference; the box path divides through a 16-bit
+// reciprocal, so it may round one step differently from exact division
+int maxChannelError(const std::vector<uint16_t>& expected, const std::vector<uint16_t>& actual) {
+  int worst = 0;
+  for (size_t i = 0; i < expected.size(); ++i) {
+    uint16_t a = swap16(actual[i]);
+    for (int c = 0; c < 3; ++c) worst = std::max(worst, abs(channel(expected[i], c) - channel(a, c)));
+  }
+  return worst;
+}
+
+void checkPhoto(int srcW, int srcH, PhotoFitMode mode) {
+  std::vector<uint16_t> src = makeImage(srcW, srcH);
+  for (int orientation = 1; orientation <= 8; ++orientation) {
+    bool swapAxes = orientation >= 5;
+    int uprightW = swapAxes ? srcH : srcW;
+    int uprightH = swapAxes ? srcW : srcH;
+    PhotoFit fit = fitPhoto(uprightW, uprightH, kPanelW, kPanelH, mode);
+    ResampleCrop crop = fitCrop(fit, uprightW, uprightH);
+
+    // Geometry each mode promises
+    TEST_ASSERT_TRUE(fit.outW <= kPanelW && fit.outH <= kPanelH);
+    if (mode == PhotoFitMode::Fit) {
+      TEST_ASSERT_TRUE(fit.outW == kPanelW || fit.outH == kPanelH);
+      TEST_ASSERT_TRUE(crop.w == uprightW && crop.h == uprightH);
+    } else if (mode == PhotoFitMode::Fill) {
+      TEST_ASSERT_TRUE(fit.outW == kPanelW && fit.outH == kPanelH);
+    } else {
+      TEST_ASSERT_EQUAL_INT(std::min(uprightW, kPanelW), crop.w);
+      TEST_ASSERT_EQUAL_INT(std::min(uprightH, kPanelH), crop.h);
+    }
+
+    std::vector<uint16_t> out(fit.outW * fit.outH);
+    TEST_ASSERT_TRUE(resampleRgb565(src.data(), srcW, srcH, orientation, crop, out.data(), fit.outW, fit.outH));
+    std::vector<uint16_t> expected = referenceResample(src, srcW, srcH, orientation, crop, fit.outW, fit.outH);
+    bool box = crop.w >= fit.outW && crop.h >= fit.outH;
+    char message[96];
+    snprintf(message, sizeof(message), "%dx%d orientation %d mode %d", srcW, srcH, orientation, (int)mode);
+    TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(box ? 1 : 0, maxChannelError(expected, out), message);
+  }
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_fit_shrink() {
+  checkPhoto(2000, 1500, PhotoFitMode::Fit);
+}
+
+void test_fit_enlarge() {
+  checkPhoto(400, 300, PhotoFitMode::Fit);
+}
+
+void test_fill_shrink() {
+  checkPhoto(2000, 1500, PhotoFitMode::Fill);
+}
+
+void test_fill_enlarge() {
+  checkPhoto(300, 500, PhotoFitMode::Fill);
+}
+
+void test_centre_larger_than_panel() {
+  checkPhoto(1500, 1000, PhotoFitMode::Centre);
+}
+
+void test_centre_smaller_than_panel() {
+  checkPhoto(641, 359, PhotoFitMode::Centre);
+}
+
+void test_odd_sizes() {
+  checkPhoto(1281, 719, PhotoFitMode::Fit);
+  checkPhoto(97, 1203, PhotoFitMode::Fill);
+}
+
+// Host timing only: a 4:3 photo enlarged to fill the panel
+void test_bilinear_panel_time() {
+  constexpr int kRuns = 10;
+  std::vector<uint16_t> src = makeImage(960, 720);
+  std::vector<uint16_t> out(kPanelW * kPanelH);
+  ResampleCrop crop = {0, 90, 960, 540};
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kRuns; ++i) {
+    resampleRgb565(src.data(), 960, 720, 1, crop, out.data(), kPanelW, kPanelH);
+  }
+  double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  char message[64];
+  snprintf(message, sizeof(message), "bilinear 960x540 -> %dx%d: %.2f ms", kPanelW, kPanelH, ms / kRuns);
+  TEST_MESSAGE(message);
+  TEST_ASSERT_TRUE(ms > 0);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_fit_shrink);
+  RUN_TEST(test_fit_enlarge);
+  RUN_TEST(test_fill_shrink);
+  RUN_TEST(test_fill_enlarge);
+  RUN_TEST(test_centre_larger_than_panel);
+  RUN_TEST(test_centre_smaller_than_panel);
+  RUN_TEST(test_odd_sizes);
+  RUN_TEST(test_bilinear_panel_time);
+  return UNITY_END();
+}
@@ -0,0 +1,106 @@
+// blendRgb565Swar against a per-channel scalar blend, and its throughput on
+// a full 1280x720 panel frame
+#include <unity.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "rgb565.h"
+
+constexpr int kPanelW = 1280;
+constexpr int kPanelH = 720;
+
+uint32_t g_seed = 12345;
+uint16_t randomPixel() {
+  g_seed = g_seed * 1664525u + 1013904223u;
+  return g_seed >> 16;
+}
+
+uint16_t swap16(uint16_t v) {
+  return (v << 8) | (v >> 8);
+}
+
+// Reference: each channel weighted separately, same rounding as the kernel
+uint16_t blendScalar(uint16_t bg, uint16_t fg, uint32_t alpha) {
+  uint32_t r = (((bg >> 11) & 31) * (32 - alpha) + ((fg >> 11) & 31) * alpha) >> 5;
+  uint32_t g = (((bg >> 5) & 63) * (32 - alpha) + ((fg >> 5) & 63) * alpha) >> 5;
+  uint32_t b = ((bg & 31) * (32 - alpha) + (fg & 31) * alpha) >> 5;
+  return (r << 11) | (g << 5) | b;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void checkBlend(size_t count, bool fgNative) {
+  std::vector<uint16_t> bg(count), fg(count), out(count);
+  for (size_t i = 0; i < count; ++i) {
+    bg[i] = randomPixel();
+    fg[i] = randomPixel();
+  }
+  for (uint32_t alpha = 0; alpha <= 32; ++alpha) {
+    blendRgb565Swar(bg.data(), fg.data(), out.data(), count, alpha, fgNative);
+    for (size_t i = 0; i < count; ++i) {
+      uint16_t f = fgNative ? fg[i] : swap16(fg[i]);
+      TEST_ASSERT_EQUAL_HEX16_MESSAGE(blendScalar(swap16(bg[i]), f, alpha), out[i], "pixel mismatch");
+    }
+  }
+}
+
+void test_blend_matches_scalar() {
+  checkBlend(4096, false);
+}
+
+void test_blend_native_foreground() {
+  checkBlend(4096, true);
+}
+
+void test_blend_odd_count() {
+  checkBlend(1, false);
+  checkBlend(77, true);
+}
+
+void test_blend_endpoints() {
+  uint16_t bg[2] = {swap16(0xF800), swap16(0x07E0)};
+  uint16_t fg[2] = {swap16(0x001F), swap16(0xFFFF)};
+  uint16_t out[2];
+  blendRgb565Swar(bg, fg, out, 2, 0, false);
+  TEST_ASSERT_EQUAL_HEX16(0xF800, out[0]);
+  TEST_ASSERT_EQUAL_HEX16(0x07E0, out[1]);
+  blendRgb565Swar(bg, fg, out, 2, 32, false);
+  TEST_ASSERT_EQUAL_HEX16(0x001F, out[0]);
+  TEST_ASSERT_EQUAL_HEX16(0xFFFF, out[1]);
+}
+
+// Host timing only; device figures come from the transition log line
+void test_blend_panel_frame_time() {
+  constexpr size_t kCount = (size_t)kPanelW * kPanelH;
+  constexpr int kFrames = 100;
+  std::vector<uint16_t> bg(kCount), fg(kCount), out(kCount);
+  for (size_t i = 0; i < kCount; ++i) {
+    bg[i] = randomPixel();
+    fg[i] = randomPixel();
+  }
+  auto start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < kFrames; ++frame) {
+    blendRgb565Swar(bg.data(), fg.data(), out.data(), kCount, frame % 33, false);
+  }
+  double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  char message[96];
+  snprintf(message, sizeof(message), "%dx%d blend: %.2f ms/frame, %.0f fps (blend only)",
+           kPanelW, kPanelH, ms / kFrames, kFrames * 1000.0 / ms);
+  TEST_MESSAGE(message);
+  // The last frame's output is still checked, so the loop can't be dropped
+  TEST_ASSERT_EQUAL_HEX16(blendScalar(swap16(bg[0]), swap16(fg[0]), (kFrames - 1) % 33), out[0]);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_blend_matches_scalar);
+  RUN_TEST(test_blend_native_foreground);
+  RUN_TEST(test_blend_odd_count);
+  RUN_TEST(test_blend_endpoints);
+  RUN_TEST(test_blend_panel_frame_time);
+  return UNITY_END();
+}
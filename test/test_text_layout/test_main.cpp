@@ -0,0 +1,167 @@
+// breakLines with a fixed-pitch stand-in for the font: Latin glyphs are
+// 10 px wide and CJK/fullwidth glyphs 24 px, so expected breaks are exact.
+#include <unity.h>
+
+#include <string>
+
+#include "text_layout.h"
+
+float fakeAdvance(uint32_t codepoint, const char*) {
+  return codepoint >= 0x2E80 ? 24 : 10;
+}
+
+TextLayout g_layout;
+
+void layout(const char* text, int maxWidth, int maxLines) {
+  g_layout = {};
+  breakLines(text, maxWidth, maxLines, fakeAdvance, g_layout);
+}
+
+std::string line(const char* text, int i) {
+  return std::string(text + g_layout.start[i], text + g_layout.end[i]);
+}
+
+void expectLines(const char* text, const char* const* lines, int count, bool truncated) {
+  TEST_ASSERT_EQUAL_INT(count, g_layout.lineCount);
+  for (int i = 0; i < count; ++i) TEST_ASSERT_EQUAL_STRING(lines[i], line(text, i).c_str());
+  TEST_ASSERT_EQUAL_INT(truncated, g_layout.truncated);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_latin_breaks_at_spaces() {
+  const char* text = "the quick brown fox";
+  layout(text, 100, 3);
+  const char* lines[] = {"the quick", "brown fox"};
+  expectLines(text, lines, 2, false);
+}
+
+void test_latin_truncates_last_line() {
+  const char* text = "hello world foo bar";
+  layout(text, 60, 3);
+  // The last line keeps the rest of the text for the ellipsizer
+  const char* lines[] = {"hello", "world", "foo bar"};
+  expectLines(text, lines, 3, true);
+}
+
+void test_latin_breaks_after_hyphen() {
+  const char* text = "well-known fact";
+  layout(text, 60, 3);
+  const char* lines[] = {"well-", "known", "fact"};
+  expectLines(text, lines, 3, false);
+}
+
+void test_cjk_breaks_between_ideographs() {
+  const char* text = "今天下午开会，讨论项目进度。";
+  layout(text, 100, 3);
+  const char* lines[] = {"今天下午", "开会，讨", "论项目进度。"};
+  expectLines(text, lines, 3, true);
+}
+
+void test_fullwidth_close_never_starts_a_line() {
+  // "。" would overflow; it pulls the ideograph before it down instead
+  const char* text = "一二三四。五";
+  layout(text, 96, 3);
+  const char* lines[] = {"一二三", "四。五"};
+  expectLines(text, lines, 2, false);
+}
+
+void test_fullwidth_open_never_ends_a_line() {
+  const char* text = "一二三（四）";
+  layout(text, 96, 3);
+  const char* lines[] = {"一二三", "（四）"};
+  expectLines(text, lines, 2, false);
+}
+
+void test_mixed_latin_and_cjk() {
+  const char* text = "Meet 王 at 3pm";
+  layout(text, 80, 3);
+  const char* lines[] = {"Meet 王", "at 3pm"};
+  expectLines(text, lines, 2, false);
+}
+
+void test_overlong_word_breaks_anywhere() {
+  const char* text = "supercalifragilistic";
+  layout(text, 60, 3);
+  const char* lines[] = {"superc", "alifra", "gilistic"};
+  expectLines(text, lines, 3, true);
+}
+
+void test_overlong_word_after_short_one() {
+  const char* text = "a verylongword";
+  layout(text, 50, 3);
+  const char* lines[] = {"a", "veryl", "ongword"};
+  expectLines(text, lines, 3, true);
+}
+
+void test_newlines_end_lines() {
+  const char* text = "a\nb\nc";
+  layout(text, 200, 3);
+  const char* lines[] = {"a", "b", "c"};
+  expectLines(text, lines, 3, false);
+}
+
+void test_newline_past_line_limit_truncates() {
+  const char* text = "a\nb\nc";
+  layout(text, 200, 2);
+  const char* lines[] = {"a", "b\nc"};
+  expectLines(text, lines, 2, true);
+}
+
+void test_blank_line_is_kept() {
+  const char* text = "one\n\nthree";
+  layout(text, 200, 3);
+  const char* lines[] = {"one", "", "three"};
+  expectLines(text, lines, 3, false);
+}
+
+void test_trailing_newline_is_not_truncation() {
+  const char* text = "one\n";
+  layout(text, 200, 1);
+  const char* lines[] = {"one"};
+  expectLines(text, lines, 1, false);
+}
+
+void test_wrapped_spaces_are_dropped() {
+  const char* text = "aaaa    bbbb";
+  layout(text, 50, 3);
+  const char* lines[] = {"aaaa", "bbbb"};
+  expectLines(text, lines, 2, false);
+}
+
+void test_empty_text_is_one_empty_line() {
+  layout("", 100, 3);
+  const char* lines[] = {""};
+  expectLines("", lines, 1, false);
+}
+
+void test_next_codepoint() {
+  const char* p = "a\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x98\x80";
+  TEST_ASSERT_EQUAL_HEX32('a', nextCodepoint(p));
+  TEST_ASSERT_EQUAL_HEX32(0xE9, nextCodepoint(p));
+  TEST_ASSERT_EQUAL_HEX32(0x4E2D, nextCodepoint(p));
+  TEST_ASSERT_EQUAL_HEX32(0x1F600, nextCodepoint(p));
+  TEST_ASSERT_EQUAL_INT(0, *p);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_latin_breaks_at_spaces);
+  RUN_TEST(test_latin_truncates_last_line);
+  RUN_TEST(test_latin_breaks_after_hyphen);
+  RUN_TEST(test_cjk_breaks_between_ideographs);
+  RUN_TEST(test_fullwidth_close_never_starts_a_line);
+  RUN_TEST(test_fullwidth_open_never_ends_a_line);
+  RUN_TEST(test_mixed_latin_and_cjk);
+  RUN_TEST(test_overlong_word_breaks_anywhere);
+  RUN_TEST(test_overlong_word_after_short_one);
+  RUN_TEST(test_newlines_end_lines);
+  RUN_TEST(test_newline_past_line_limit_truncates);
+  RUN_TEST(test_blank_line_is_kept);
+  RUN_TEST(test_trailing_newline_is_not_truncation);
+  RUN_TEST(test_wrapped_spaces_are_dropped);
+  RUN_TEST(test_empty_text_is_one_empty_line);
+  RUN_TEST(test_next_codepoint);
+  return UNITY_END();
+}
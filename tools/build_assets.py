@@ -0,0 +1,487 @@
+#!/usr/bin/env python3
+"""Build-time asset pipeline for M5Stack Tab 5.
+
+Converts the PNGs in assets/ into pre-scaled, compressed RGB565 images and
+writes them, with an index, to src/assets_generated.h. Each image is stored in
+whichever of the two formats below is smaller. Checksums of the reference
+decodes go to test/test_asset_decoder/reference_assets.h for the native test. Runs as a PlatformIO
+pre: extra_script (see platformio.ini) and can also be run by hand:
+
+    python3 tools/build_assets.py [--force]
+    python3 tools/build_assets.py --pack [PATH]      # write the SD asset pack
+    python3 tools/build_assets.py --verify-pack PATH
+
+The SD asset pack (assets.pack, read by openAssetPack in src/main.cpp) holds
+pre-decoded tiles so the device loads each with one seek and one read:
+  header   magic "APK1", count, 8 reserved bytes          (uint32 LE)
+  table    count x {name FNV-1a, width, height, format,
+                    3 reserved, offset, size}              (20 bytes each)
+  data     each tile at a 512-byte (SD sector) aligned offset
+  format 0 = RGB565 in panel byte order,
+         1 = RGB565 composited on black followed by an 8-bit alpha plane
+
+Image formats (decoded by AssetDecoder in include/asset_decoder.h, which
+outputs panel byte order so nothing is swapped at draw time):
+  RLE (format 0): control byte c, then
+    c & 0x80: a run of (c & 0x7F) + 1 copies of the next pixel
+    else:     c + 1 literal pixels
+    Pixels are 2 bytes in panel byte order (big-endian RGB565).
+  QOI-565 (format 1), QOI adapted to 5/6/5-bit channels. Previous pixel starts
+  at 0, and a 64-entry table of seen colours at (r*3 + g*5 + b*7) % 64 is
+  updated by every op except INDEX and RUN:
+    00iiiiii            INDEX  table[i]
+    01rrggbb            DIFF   channel deltas -2..1, stored +2, modulo
+    10gggggg rrrrbbbb   LUMA   green delta -32..31 (+32); red and blue deltas
+                               minus the green delta, -8..7 (+8)
+    11111110 hi lo      RGB    literal, big-endian
+    11nnnnnn            RUN    n + 1 copies of the previous pixel (n < 62)
+"""
+
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+# name, source PNG, size, background the alpha is flattened onto
+ASSETS = [(f"Icon{i}", f"icon-{i}.png", 100, (0, 0, 0)) for i in range(1, 9)] + [
+    ("Logo", "logo.png", 150, (255, 255, 255)),
+]
+
+# name, source PNG, fit size of the pre-decoded tiles in the SD asset pack
+PACK_ASSETS = [(f"icon-{i}", f"icon-{i}.png", 200) for i in range(1, 9)]
+PACK_MAGIC = 0x314B5041  # "APK1"
+PACK_ALIGN = 512
+DEFAULT_PACK = os.path.join("assets", "SD_card", "M5Stack-Tab-5-Adventure", "assets.pack")
+
+# Literal arrays the pipeline replaces (logo.h and icons/icon_N.h), in bytes
+LEGACY_BYTES = 150 * 150 * 2 + 8 * 60 * 60 * 2
+
+FORMAT_RLE = 0
+FORMAT_QOI = 1
+FORMAT_NAMES = {FORMAT_RLE: "RLE", FORMAT_QOI: "QOI"}
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def to_rgb565(path, size, background):
+    from PIL import Image
+
+    img = Image.open(path).convert("RGBA")
+    img = img.resize((size, size), Image.Resampling.LANCZOS)
+    flat = Image.new("RGBA", img.size, background + (255,))
+    flat.alpha_composite(img)
+    rgba = flat.tobytes()
+    return [((rgba[k] >> 3) << 11) | ((rgba[k + 1] >> 2) << 5) | (rgba[k + 2] >> 3)
+            for k in range(0, len(rgba), 4)]
+
+
+def fnv1a(name):
+    h = 2166136261
+    for b in name.encode():
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def pack_tile(path, size):
+    """RGB565 composited on black, then alpha, fitted within size x size."""
+    from PIL import Image
+
+    img = Image.open(path).convert("RGBA")
+    scale = min(size / img.width, size / img.height)
+    img = img.resize((max(1, round(img.width * scale)), max(1, round(img.height * scale))),
+                     Image.Resampling.LANCZOS)
+    flat = Image.new("RGBA", img.size, (0, 0, 0, 255))
+    flat.alpha_composite(img)
+    rgba = flat.tobytes()
+    alpha = img.tobytes()[3::4]
+    pixels = bytearray()
+    for k in range(0, len(rgba), 4):
+        c = ((rgba[k] >> 3) << 11) | ((rgba[k + 1] >> 2) << 5) | (rgba[k + 2] >> 3)
+        pixels += c.to_bytes(2, "big")
+    return img.width, img.height, bytes(pixels) + alpha
+
+
+def build_pack(path):
+    import struct
+
+    tiles = [(name,) + pack_tile(os.path.join(PROJECT_DIR, "assets", src), size)
+             for name, src, size in PACK_ASSETS]
+    offset = 16 + 20 * len(tiles)
+    table = bytearray()
+    data = bytearray()
+    for name, width, height, blob in tiles:
+        offset = (offset + PACK_ALIGN - 1) // PACK_ALIGN * PACK_ALIGN
+        table += struct.pack("<IHHB3xII", fnv1a(name), width, height, 1, offset, len(blob))
+        data += bytes(offset - 16 - 20 * len(tiles) - len(data)) + blob
+        offset += len(blob)
+    with open(path, "wb") as f:
+        f.write(struct.pack("<IIII", PACK_MAGIC, len(tiles), 0, 0) + table + data)
+    print(f"build_assets: wrote {path} ({len(tiles)} tiles, {os.path.getsize(path)} bytes)")
+    verify_pack(path)
+
+
+def verify_pack(path):
+    import struct
+
+    with open(path, "rb") as f:
+        blob = f.read()
+    magic, count, _, _ = struct.unpack_from("<IIII", blob, 0)
+    if magic != PACK_MAGIC:
+        sys.exit(f"build_assets: {path}: bad magic")
+    expected = {fnv1a(name): (name, src, size) for name, src, size in PACK_ASSETS}
+    for i in range(count):
+        key, width, height, fmt, offset, size = struct.unpack_from("<IHHB3xII", blob, 16 + 20 * i)
+        bpp = 3 if fmt == 1 else 2
+        if offset % PACK_ALIGN or offset + size > len(blob) or size != width * height * bpp:
+            sys.exit(f"build_assets: {path}: entry {i} has a bad offset or size")
+        if key in expected:
+            name, src, fit = expected.pop(key)
+            if (width, height, blob[offset:offset + size]) != pack_tile(
+                    os.path.join(PROJECT_DIR, "assets", src), fit):
+                sys.exit(f"build_assets: {path}: {name} is stale, regenerate with --pack")
+    if expected:
+        missing = ", ".join(name for name, _, _ in expected.values())
+        sys.exit(f"build_assets: {path}: missing {missing}")
+    print(f"build_assets: {path} verified ({count} tiles)")
+
+
+def rle_encode(pixels):
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out.extend(p.to_bytes(2, "big"))
+
+    i = 0
+    while i < len(pixels):
+        j = i
+        while j < len(pixels) and pixels[j] == pixels[i] and j - i < 128:
+            j += 1
+        if j - i >= 2:
+            flush_literal()
+            out.append(0x80 | (j - i - 1))
+            out += pixels[i].to_bytes(2, "big")
+            i = j
+        else:
+            literal.append(pixels[i])
+            i += 1
+    flush_literal()
+    return bytes(out)
+
+
+def rle_decode(data, count):
+    pixels = []
+    pos = 0
+    while len(pixels) < count:
+        c = data[pos]
+        pos += 1
+        if c & 0x80:
+            pixels += [int.from_bytes(data[pos:pos + 2], "big")] * ((c & 0x7F) + 1)
+            pos += 2
+        else:
+            n = c + 1
+            pixels += [int.from_bytes(data[pos + k * 2:pos + k * 2 + 2], "big") for k in range(n)]
+            pos += n * 2
+    return pixels
+
+
+def qoi_split(p):
+    return (p >> 11) & 31, (p >> 5) & 63, p & 31
+
+
+def qoi_hash(p):
+    r, g, b = qoi_split(p)
+    return (r * 3 + g * 5 + b * 7) % 64
+
+
+def qoi_encode(pixels):
+    out = bytearray()
+    table = [0] * 64
+    prev = 0
+    run = 0
+    for p in pixels:
+        if p == prev:
+            run += 1
+            if run == 62:
+                out.append(0xC0 | (run - 1))
+                run = 0
+            continue
+        if run:
+            out.append(0xC0 | (run - 1))
+            run = 0
+        h = qoi_hash(p)
+        if table[h] == p:
+            out.append(h)
+        else:
+            table[h] = p
+            pr, pg, pb = qoi_split(prev)
+            r, g, b = qoi_split(p)
+            dr = (r - pr + 16) % 32 - 16
+            dg = (g - pg + 32) % 64 - 32
+            db = (b - pb + 16) % 32 - 16
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+                out.append(0x80 | (dg + 32))
+                out.append((dr - dg + 8) << 4 | (db - dg + 8))
+            else:
+                out.append(0xFE)
+                out.extend(p.to_bytes(2, "big"))
+        prev = p
+    if run:
+        out.append(0xC0 | (run - 1))
+    return bytes(out)
+
+
+def qoi_decode(data, count):
+    pixels = []
+    table = [0] * 64
+    prev = 0
+    pos = 0
+    while len(pixels) < count:
+        op = data[pos]
+        pos += 1
+        if op >= 0xC0 and op != 0xFE:
+            pixels += [prev] * ((op & 0x3F) + 1)
+            continue
+        if op < 0x40:
+            p = table[op]
+        else:
+            pr, pg, pb = qoi_split(prev)
+            if op < 0x80:
+                r, g, b = pr + ((op >> 4) & 3) - 2, pg + ((op >> 2) & 3) - 2, pb + (op & 3) - 2
+            elif op < 0xC0:
+                dg = (op & 0x3F) - 32
+                rb = data[pos]
+                pos += 1
+                r, g, b = pr + dg + (rb >> 4) - 8, pg + dg, pb + dg + (rb & 15) - 8
+            else:
+                r, g, b = qoi_split(int.from_bytes(data[pos:pos + 2], "big"))
+                pos += 2
+            p = (r & 31) << 11 | (g & 63) << 5 | (b & 31)
+        table[qoi_hash(p)] = p
+        prev = p
+        pixels.append(p)
+    return pixels
+
+
+CODECS = {
+    FORMAT_RLE: (rle_encode, rle_decode),
+    FORMAT_QOI: (qoi_encode, qoi_decode),
+}
+
+
+def write_header(path, images):
+    lines = [
+        "#pragma once",
+        "#include \"asset_decoder.h\"",
+        "",
+        "#ifndef PROGMEM",
+        "#define PROGMEM",
+        "#endif",
+        "",
+        "// Generated by tools/build_assets.py from assets/ - do not edit.",
+        "// Compressed RGB565 decoding to panel byte order; see the script for the formats.",
+        "",
+    ]
+    for name, width, height, fmt, data in images:
+        lines.append(f"const uint8_t kAsset{name}Data[{len(data)}] PROGMEM = {{")
+        for k in range(0, len(data), 16):
+            lines.append("  " + ", ".join(f"0x{b:02X}" for b in data[k:k + 16]) + ",")
+        lines.append("};")
+        lines.append("")
+    for index, (name, _, _, _, _) in enumerate(images):
+        lines.append(f"constexpr int kAsset{name} = {index};")
+    lines.append(f"constexpr int kAssetCount = {len(images)};")
+    lines.append("")
+    lines.append("const CompressedImage kAssets[kAssetCount] = {")
+    for name, width, height, fmt, data in images:
+        lines.append(f"  {{{width}, {height}, kAssetFormat{FORMAT_NAMES[fmt].title()}, "
+                     f"{len(data)}, kAsset{name}Data}},")
+    lines.append("};")
+    with open(path, "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+def pixel_checksum(pixels):
+    """FNV-1a over the pixels as big-endian RGB565, i.e. panel byte order."""
+    h = 0x811C9DC5
+    for p in pixels:
+        for byte in (p >> 8, p & 0xFF):
+            h = ((h ^ byte) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+def write_reference(path, checksums, alternate):
+    """Checksums of the reference decode of every asset, plus the smallest asset
+    re-encoded in the other format, so the native test covers both decoders."""
+    index, fmt, data = alternate
+    lines = [
+        "#pragma once",
+        "",
+        "// Generated by tools/build_assets.py from assets/ - do not edit.",
+        "// FNV-1a of each asset as decoded by the script's qoi_decode/rle_decode,",
+        "// over the pixels in panel byte order.",
+        "",
+        "const uint32_t kReferenceChecksums[] = {",
+    ]
+    lines += [f"  0x{c:08X}," for c in checksums]
+    lines += [
+        "};",
+        "",
+        f"// Asset {index} re-encoded as {FORMAT_NAMES[fmt]}, so both formats are decoded",
+        f"constexpr int kAlternateAsset = {index};",
+        f"constexpr uint8_t kAlternateFormat = kAssetFormat{FORMAT_NAMES[fmt].title()};",
+        f"const uint8_t kAlternateData[{len(data)}] = {{",
+    ]
+    for k in range(0, len(data), 16):
+        lines.append("  " + ", ".join(f"0x{b:02X}" for b in data[k:k + 16]) + ",")
+    lines.append("};")
+    with open(path, "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+# Decodes every asset with the firmware's AssetDecoder and prints the mean
+# milliseconds per pass for all of them and for the largest one
+DECODER_BENCH = r"""
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+#include "assets_generated.h"
+
+int main() {
+  constexpr int kRuns = 200;
+  double totalMs = 0, largestMs = 0;
+  uint32_t sink = 0;
+  for (int i = 0; i < kAssetCount; ++i) {
+    std::vector<uint16_t> pixels(kAssets[i].width * kAssets[i].height);
+    auto start = std::chrono::steady_clock::now();
+    for (int run = 0; run < kRuns; ++run) {
+      AssetDecoder decoder(kAssets[i]);
+      if (!decoder.read(pixels.data(), pixels.size())) return 1;
+      sink += pixels[run % pixels.size()];
+    }
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / kRuns;
+    totalMs += ms;
+    if (ms > largestMs) largestMs = ms;
+  }
+  printf("%f %f %u\n", totalMs, largestMs, (unsigned)sink);
+  return 0;
+}
+"""
+
+
+def time_asset_decoder():
+    """Host timing of include/asset_decoder.h on the generated header, or None
+    if no C++ compiler on PATH builds and runs it."""
+    cxx = next((c for c in ("c++", "g++", "clang++") if shutil.which(c)), None)
+    if not cxx:
+        return None
+    with tempfile.TemporaryDirectory() as tmp:
+        source = os.path.join(tmp, "bench.cpp")
+        program = os.path.join(tmp, "bench.exe" if os.name == "nt" else "bench")
+        with open(source, "w") as f:
+            f.write(DECODER_BENCH)
+        try:
+            subprocess.run([cxx, "-std=gnu++17", "-O2",
+                            "-I", os.path.join(PROJECT_DIR, "include"),
+                            "-I", os.path.join(PROJECT_DIR, "src"),
+                            source, "-o", program],
+                           check=True, capture_output=True, timeout=120)
+            out = subprocess.run([program], check=True, capture_output=True, text=True,
+                                 timeout=60).stdout.split()
+        except (OSError, subprocess.SubprocessError):
+            return None
+    return float(out[0]), float(out[1])
+
+
+def build(force=False):
+    asset_dir = os.path.join(PROJECT_DIR, "assets")
+    out_path = os.path.join(PROJECT_DIR, "src", "assets_generated.h")
+    reference_path = os.path.join(PROJECT_DIR, "test", "test_asset_decoder", "reference_assets.h")
+
+    # SCons runs this file without __file__, so name it from the project root
+    sources = [os.path.join(asset_dir, src) for _, src, _, _ in ASSETS]
+    sources.append(os.path.join(PROJECT_DIR, "tools", "build_assets.py"))
+    if not force and os.path.exists(out_path) and os.path.exists(reference_path):
+        newest = max(os.path.getmtime(p) for p in sources if os.path.exists(p))
+        if newest <= min(os.path.getmtime(out_path), os.path.getmtime(reference_path)):
+            return
+    try:
+        import PIL  # noqa: F401
+    except ImportError:
+        print("build_assets: Pillow not installed, keeping the checked-in assets_generated.h")
+        return
+
+    images = []
+    checksums = []
+    alternate = None
+    raw_total = 0
+    packed_total = 0
+    check_time = {fmt: 0.0 for fmt in CODECS}
+    for name, src, size, background in ASSETS:
+        pixels = to_rgb565(os.path.join(asset_dir, src), size, background)
+        encoded = {}
+        for fmt, (encode, decode) in CODECS.items():
+            data = encode(pixels)
+            start = time.perf_counter()
+            decoded = decode(data, len(pixels))
+            check_time[fmt] += time.perf_counter() - start
+            if decoded != pixels:
+                sys.exit(f"build_assets: {FORMAT_NAMES[fmt]} round trip failed for {src}")
+            encoded[fmt] = data
+        fmt = min(encoded, key=lambda f: len(encoded[f]))
+        data = encoded[fmt]
+        checksums.append(pixel_checksum(CODECS[fmt][1](data, len(pixels))))
+        for other, other_data in encoded.items():
+            if other != fmt and (alternate is None or len(other_data) < len(alternate[2])):
+                alternate = (len(images), other, other_data)
+        raw_total += len(pixels) * 2
+        packed_total += len(data)
+        sizes = ", ".join(f"{FORMAT_NAMES[f]} {len(d)}" for f, d in encoded.items())
+        print(f"build_assets: {src:12s} {size}x{size}  {len(pixels) * 2:7d} -> {len(data):6d} bytes "
+              f"{FORMAT_NAMES[fmt]} ({sizes})")
+        images.append((name, size, size, fmt, data))
+
+    write_header(out_path, images)
+    write_reference(reference_path, checksums, alternate)
+    print(f"build_assets: {raw_total} bytes raw RGB565 -> {packed_total} bytes compressed "
+          f"({100.0 * packed_total / raw_total:.0f}%), "
+          f"{LEGACY_BYTES - packed_total} bytes less flash than logo.h + icon_N.h")
+    times = ", ".join(f"{FORMAT_NAMES[f]} {t * 1000:.1f} ms" for f, t in check_time.items())
+    print(f"build_assets: Python round-trip check of all assets (not the firmware decoder): {times}")
+    decoder_time = time_asset_decoder()
+    if decoder_time:
+        total_ms, largest_ms = decoder_time
+        print(f"build_assets: AssetDecoder (C++, host -O2) decode of all assets: {total_ms:.3f} ms, "
+              f"largest {largest_ms:.3f} ms; device time comes from the dashboard draw log")
+    else:
+        print("build_assets: AssetDecoder timing skipped, no host C++ compiler could build it "
+              "(pio test -e native also times it)")
+
+
+def pack_path_arg(flag):
+    index = sys.argv.index(flag)
+    if index + 1 < len(sys.argv) and not sys.argv[index + 1].startswith("--"):
+        return sys.argv[index + 1]
+    return os.path.join(PROJECT_DIR, DEFAULT_PACK)
+
+
+if "--pack" in sys.argv:
+    build_pack(pack_path_arg("--pack"))
+elif "--verify-pack" in sys.argv:
+    verify_pack(pack_path_arg("--verify-pack"))
+else:
+    build(force="--force" in sys.argv)